@@ -252,6 +252,141 @@ BOOST_AUTO_TEST_CASE( testTabulatedDragCoefficient )
 
 }
 
+//! Function to compute (arbitrary) analytical force and moment coefficients as a function of Mach number and angle of
+//! attack, used to generate tabulated coefficients.
+basic_mathematics::Vector6d getAnalyticalAerodynamicCoefficients( const double machNumber, const double angleOfAttack )
+{
+    basic_mathematics::Vector6d coefficients;
+    coefficients << 0.3 + 0.1 * std::sin( machNumber ) * angleOfAttack * angleOfAttack,
+            0.02 * machNumber * angleOfAttack,
+            1.2 * std::cos( angleOfAttack ) + 0.005 * machNumber * machNumber,
+            0.01 * machNumber,
+            -0.2 * angleOfAttack * std::exp( -machNumber / 5.0 ),
+            0.03 * std::sin( angleOfAttack );
+    return coefficients;
+}
+
+// Test multi-dimensional tabulated coefficients, with multi-linear and cubic spline interpolation, and with only force
+// coefficients provided.
+BOOST_AUTO_TEST_CASE( testMultiDimensionalTabulatedCoefficients )
+{
+    using namespace simulation_setup;
+    using namespace interpolators;
+
+    // Create tables of force and moment coefficients.
+    std::vector< std::vector< double > > independentVariables( 2 );
+    for( unsigned int i = 0; i < 20; i++ )
+    {
+        independentVariables[ 0 ].push_back( 0.5 + 0.5 * static_cast< double >( i ) );
+    }
+    for( unsigned int j = 0; j < 21; j++ )
+    {
+        independentVariables[ 1 ].push_back( -0.5 + 0.05 * static_cast< double >( j ) );
+    }
+
+    boost::multi_array< Eigen::Vector3d, 2 > forceCoefficients( boost::extents[ 20 ][ 21 ] );
+    boost::multi_array< Eigen::Vector3d, 2 > momentCoefficients( boost::extents[ 20 ][ 21 ] );
+    for( unsigned int i = 0; i < 20; i++ )
+    {
+        for( unsigned int j = 0; j < 21; j++ )
+        {
+            basic_mathematics::Vector6d coefficients = getAnalyticalAerodynamicCoefficients(
+                        independentVariables[ 0 ][ i ], independentVariables[ 1 ][ j ] );
+            forceCoefficients[ i ][ j ] = coefficients.segment( 0, 3 );
+            momentCoefficients[ i ][ j ] = coefficients.segment( 3, 3 );
+        }
+    }
+
+    std::vector< aerodynamics::AerodynamicCoefficientsIndependentVariables > independentVariableNames;
+    independentVariableNames.push_back( aerodynamics::mach_number_dependent );
+    independentVariableNames.push_back( aerodynamics::angle_of_attack_dependent );
+
+    // Create coefficient interfaces with multi-linear and cubic spline interpolation, and with only force coefficients.
+    const double referenceArea = 2.0;
+    boost::shared_ptr< aerodynamics::AerodynamicCoefficientInterface > linearCoefficientInterface =
+            createAerodynamicCoefficientInterface(
+                boost::make_shared< TabulatedAerodynamicCoefficientSettings< 2 > >(
+                    independentVariables, forceCoefficients, momentCoefficients, 1.5, referenceArea, 1.5,
+                    Eigen::Vector3d::Zero( ), independentVariableNames, 1, 1,
+                    boost::make_shared< InterpolatorSettings >( linear_interpolator ) ), "Vehicle" );
+    boost::shared_ptr< aerodynamics::AerodynamicCoefficientInterface > cubicSplineCoefficientInterface =
+            createAerodynamicCoefficientInterface(
+                boost::make_shared< TabulatedAerodynamicCoefficientSettings< 2 > >(
+                    independentVariables, forceCoefficients, momentCoefficients, 1.5, referenceArea, 1.5,
+                    Eigen::Vector3d::Zero( ), independentVariableNames, 1, 1,
+                    boost::make_shared< InterpolatorSettings >( cubic_spline_interpolator ) ), "Vehicle" );
+    boost::shared_ptr< aerodynamics::AerodynamicCoefficientInterface > forceOnlyCoefficientInterface =
+            createAerodynamicCoefficientInterface(
+                boost::make_shared< TabulatedAerodynamicCoefficientSettings< 2 > >(
+                    independentVariables, forceCoefficients, referenceArea, independentVariableNames, 1, 1,
+                    boost::make_shared< InterpolatorSettings >( cubic_spline_interpolator ) ), "Vehicle" );
+
+    // Check that unsupported interpolator types are rejected.
+    BOOST_CHECK_THROW( createAerodynamicCoefficientInterface(
+                           boost::make_shared< TabulatedAerodynamicCoefficientSettings< 2 > >(
+                               independentVariables, forceCoefficients, referenceArea, independentVariableNames, 1, 1,
+                               boost::make_shared< InterpolatorSettings >( lagrange_interpolator ) ), "Vehicle" ),
+                       std::runtime_error );
+
+    // Check that both interpolators reproduce the tabulated values at the nodes.
+    std::vector< double > currentIndependentVariables( 2 );
+    for( unsigned int i = 0; i < 20; i++ )
+    {
+        for( unsigned int j = 0; j < 21; j++ )
+        {
+            currentIndependentVariables[ 0 ] = independentVariables[ 0 ][ i ];
+            currentIndependentVariables[ 1 ] = independentVariables[ 1 ][ j ];
+            linearCoefficientInterface->updateCurrentCoefficients( currentIndependentVariables );
+            cubicSplineCoefficientInterface->updateCurrentCoefficients( currentIndependentVariables );
+            for( unsigned int k = 0; k < 3; k++ )
+            {
+                BOOST_CHECK_SMALL( linearCoefficientInterface->getCurrentForceCoefficients( )( k ) -
+                                   forceCoefficients[ i ][ j ]( k ), 1.0E-14 );
+                BOOST_CHECK_SMALL( linearCoefficientInterface->getCurrentMomentCoefficients( )( k ) -
+                                   momentCoefficients[ i ][ j ]( k ), 1.0E-14 );
+                BOOST_CHECK_SMALL( cubicSplineCoefficientInterface->getCurrentForceCoefficients( )( k ) -
+                                   forceCoefficients[ i ][ j ]( k ), 1.0E-14 );
+                BOOST_CHECK_SMALL( cubicSplineCoefficientInterface->getCurrentMomentCoefficients( )( k ) -
+                                   momentCoefficients[ i ][ j ]( k ), 1.0E-14 );
+            }
+        }
+    }
+
+    // Check interpolation between nodes (away from the edges, where the natural spline boundary conditions dominate the
+    // error): the cubic spline should be much closer to the analytical coefficients than the multi-linear interpolation.
+    // With only force coefficients provided, the force coefficients should be unchanged, and the moment coefficients zero.
+    double maximumLinearError = 0.0, maximumCubicSplineError = 0.0;
+    for( unsigned int i = 2; i < 17; i++ )
+    {
+        for( unsigned int j = 2; j < 18; j++ )
+        {
+            currentIndependentVariables[ 0 ] = 0.5 * ( independentVariables[ 0 ][ i ] + independentVariables[ 0 ][ i + 1 ] );
+            currentIndependentVariables[ 1 ] = 0.5 * ( independentVariables[ 1 ][ j ] + independentVariables[ 1 ][ j + 1 ] );
+            basic_mathematics::Vector6d analyticalCoefficients = getAnalyticalAerodynamicCoefficients(
+                        currentIndependentVariables[ 0 ], currentIndependentVariables[ 1 ] );
+
+            linearCoefficientInterface->updateCurrentCoefficients( currentIndependentVariables );
+            cubicSplineCoefficientInterface->updateCurrentCoefficients( currentIndependentVariables );
+            forceOnlyCoefficientInterface->updateCurrentCoefficients( currentIndependentVariables );
+            maximumLinearError = std::max(
+                        maximumLinearError, ( linearCoefficientInterface->getCurrentAerodynamicCoefficients( ) -
+                                              analyticalCoefficients ).cwiseAbs( ).maxCoeff( ) );
+            maximumCubicSplineError = std::max(
+                        maximumCubicSplineError, ( cubicSplineCoefficientInterface->getCurrentAerodynamicCoefficients( ) -
+                                                   analyticalCoefficients ).cwiseAbs( ).maxCoeff( ) );
+
+            for( unsigned int k = 0; k < 3; k++ )
+            {
+                BOOST_CHECK_SMALL( forceOnlyCoefficientInterface->getCurrentForceCoefficients( )( k ) -
+                                   cubicSplineCoefficientInterface->getCurrentForceCoefficients( )( k ), 1.0E-14 );
+                BOOST_CHECK_EQUAL( forceOnlyCoefficientInterface->getCurrentMomentCoefficients( )( k ), 0.0 );
+            }
+        }
+    }
+    BOOST_CHECK_SMALL( maximumCubicSplineError, 5.0E-5 );
+    BOOST_CHECK_GT( maximumLinearError, 10.0 * maximumCubicSplineError );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
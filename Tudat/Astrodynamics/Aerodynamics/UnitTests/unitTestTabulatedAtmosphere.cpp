@@ -44,8 +44,10 @@
 
 #define BOOST_TEST_MAIN
 
+#include <cmath>
 #include <limits>
 
+#include <boost/make_shared.hpp>
 #include <boost/test/unit_test.hpp>
 
 #include "Tudat/Astrodynamics/Aerodynamics/tabulatedAtmosphere.h"
@@ -66,6 +68,7 @@ BOOST_AUTO_TEST_SUITE( test_tabulated_atmosphere )
 // Test 4: Test tabulated atmosphere at 1000 km altitude with table.
 // Test 5: Test if the atmosphere file can be read multiple times.
 // Test 6: Test if the position-independent functions work.
+// Test 7: Test adaptive tabulation of atmosphere model.
 
 //! Check if the atmosphere is calculated correctly at sea level.
 // Values from (US Standard Atmosphere, 1976).
@@ -121,6 +124,13 @@ BOOST_AUTO_TEST_CASE( testTabulatedAtmosphereAt10p5km )
     BOOST_CHECK_SMALL( 222.9350 - tabulatedAtmosphere.getTemperature( altitude ), 2.0e-2 );
     BOOST_CHECK_SMALL( 0.4110 - tabulatedAtmosphere.getDensity( altitude ), 1.0e-3 );
     BOOST_CHECK_SMALL( 26299.0 - tabulatedAtmosphere.getPressure( altitude ), 1.0 );
+
+    // Check that simultaneous computation of atmospheric properties gives identical results.
+    const Eigen::Vector3d atmosphericProperties =
+            tabulatedAtmosphere.getDensityPressureAndTemperature( altitude );
+    BOOST_CHECK_EQUAL( atmosphericProperties( 0 ), tabulatedAtmosphere.getDensity( altitude ) );
+    BOOST_CHECK_EQUAL( atmosphericProperties( 1 ), tabulatedAtmosphere.getPressure( altitude ) );
+    BOOST_CHECK_EQUAL( atmosphericProperties( 2 ), tabulatedAtmosphere.getTemperature( altitude ) );
 }
 
 //! Test tabulated atmosphere at 1000 km altitude.
@@ -175,6 +185,39 @@ BOOST_AUTO_TEST_CASE( testTabulatedAtmospherePositionIndependentFunctions)
     BOOST_CHECK_EQUAL( temperature1, temperature2 );
 }
 
+//! Test adaptive tabulation of atmosphere model.
+BOOST_AUTO_TEST_CASE( testAdaptivelyTabulatedAtmosphere )
+{
+    // Create densely tabulated atmosphere, used as source model.
+    boost::shared_ptr< aerodynamics::TabulatedAtmosphere > sourceAtmosphere =
+            boost::make_shared< aerodynamics::TabulatedAtmosphere >(
+                input_output::getTudatRootPath( ) + "/External/AtmosphereTables/" +
+                "USSA1976Until100kmPer100mUntil1000kmPer1000m.dat" );
+
+    // Tabulate source model adaptively.
+    const double relativeTolerance = 1.0E-4;
+    boost::shared_ptr< aerodynamics::TabulatedAtmosphere > adaptiveAtmosphere =
+            aerodynamics::createAdaptivelyTabulatedAtmosphere(
+                sourceAtmosphere, 0.0, 1.0E6, 5.0E4,
+                boost::make_shared< interpolators::AdaptiveTabulationSettings >( relativeTolerance ) );
+
+    // Check that adaptive tabulation requires fewer altitudes than source table.
+    BOOST_CHECK_LT( adaptiveAtmosphere->getAltitudeData( ).size( ),
+                    sourceAtmosphere->getAltitudeData( ).size( ) / 4 );
+
+    // Check atmospheric properties against source model.
+    for( int i = 0; i <= 5000; i++ )
+    {
+        const double altitude = 200.0 * static_cast< double >( i );
+        BOOST_CHECK_CLOSE_FRACTION( adaptiveAtmosphere->getDensity( altitude ),
+                                    sourceAtmosphere->getDensity( altitude ), 3.0 * relativeTolerance );
+        BOOST_CHECK_CLOSE_FRACTION( adaptiveAtmosphere->getPressure( altitude ),
+                                    sourceAtmosphere->getPressure( altitude ), 3.0 * relativeTolerance );
+        BOOST_CHECK_CLOSE_FRACTION( adaptiveAtmosphere->getTemperature( altitude ),
+                                    sourceAtmosphere->getTemperature( altitude ), 3.0 * relativeTolerance );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -35,7 +35,9 @@
  */
 
 #include <iostream>
+#include <map>
 
+#include <boost/bind.hpp>
 #include <boost/make_shared.hpp>
 
 #include "Tudat/InputOutput/matrixTextFileReader.h"
@@ -80,15 +82,76 @@ void TabulatedAtmosphere::initialize( const std::string& atmosphereTableFile )
         temperatureData_[ i ] = containerOfAtmosphereTableFileData( i, 3 );
     }
 
+    createInterpolator( );
+}
+
+//! Create interpolator of atmospheric properties.
+void TabulatedAtmosphere::createInterpolator( )
+{
     using namespace interpolators;
 
-    cubicSplineInterpolationForDensity_
-            = boost::make_shared< CubicSplineInterpolatorDouble >( altitudeData_, densityData_ );
-    cubicSplineInterpolationForPressure_
-            = boost::make_shared< CubicSplineInterpolatorDouble >( altitudeData_, pressureData_ );
-    cubicSplineInterpolationForTemperature_
-            = boost::make_shared< CubicSplineInterpolatorDouble >(
-                altitudeData_, temperatureData_ );
+    std::vector< std::vector< double > > atmosphericPropertiesData;
+    atmosphericPropertiesData.push_back( densityData_ );
+    atmosphericPropertiesData.push_back( pressureData_ );
+    atmosphericPropertiesData.push_back( temperatureData_ );
+
+    cubicSplineInterpolationForAtmosphericProperties_
+            = boost::make_shared< MultiOutputCubicSplineInterpolator< double, double, 3 > >(
+                altitudeData_, atmosphericPropertiesData );
+}
+
+//! Get density, pressure and temperature from atmosphere model at given position and time.
+static Eigen::Vector3d getAtmosphericProperties(
+        const boost::shared_ptr< AtmosphereModel > atmosphereModel,
+        const double longitude, const double latitude, const double time, const double altitude )
+{
+    return Eigen::Vector3d( atmosphereModel->getDensity( altitude, longitude, latitude, time ),
+                            atmosphereModel->getPressure( altitude, longitude, latitude, time ),
+                            atmosphereModel->getTemperature( altitude, longitude, latitude, time ) );
+}
+
+//! Create interpolator of atmospheric properties, as used by tabulated atmosphere.
+static boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::Vector3d > >
+createAtmosphericPropertiesInterpolator( const std::map< double, Eigen::Vector3d >& atmosphericProperties )
+{
+    return boost::make_shared< interpolators::MultiOutputCubicSplineInterpolator< double, double, 3 > >(
+                atmosphericProperties );
+}
+
+//! Create tabulated atmosphere from another atmosphere model, with adaptively selected altitudes.
+TabulatedAtmospherePointer createAdaptivelyTabulatedAtmosphere(
+        const boost::shared_ptr< AtmosphereModel > sourceAtmosphere,
+        const double minimumAltitude,
+        const double maximumAltitude,
+        const double initialAltitudeStep,
+        const boost::shared_ptr< interpolators::AdaptiveTabulationSettings > tabulationSettings,
+        const double longitude,
+        const double latitude,
+        const double time,
+        const double specificGasConstant,
+        const double ratioOfSpecificHeats )
+{
+    // Tabulate atmospheric properties.
+    const std::map< double, Eigen::Vector3d > atmosphericProperties =
+            interpolators::tabulateFunctionAdaptivelyWithCustomInterpolator< double, Eigen::Vector3d >(
+                boost::bind( &getAtmosphericProperties, sourceAtmosphere, longitude, latitude, time, _1 ),
+                minimumAltitude, maximumAltitude, initialAltitudeStep,
+                &createAtmosphericPropertiesInterpolator, tabulationSettings );
+
+    // Create tabulated atmosphere.
+    std::vector< double > altitudeData, densityData, pressureData, temperatureData;
+    for( std::map< double, Eigen::Vector3d >::const_iterator propertiesIterator = atmosphericProperties.begin( );
+         propertiesIterator != atmosphericProperties.end( ); propertiesIterator++ )
+    {
+        altitudeData.push_back( propertiesIterator->first );
+        densityData.push_back( propertiesIterator->second( 0 ) );
+        pressureData.push_back( propertiesIterator->second( 1 ) );
+        temperatureData.push_back( propertiesIterator->second( 2 ) );
+    }
+
+    return boost::make_shared< TabulatedAtmosphere >(
+                altitudeData, densityData, pressureData, temperatureData, specificGasConstant,
+                ratioOfSpecificHeats );
 }
 
 } // namespace aerodynamics
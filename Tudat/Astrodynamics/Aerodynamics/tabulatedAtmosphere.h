@@ -42,7 +42,9 @@
 #define TUDAT_TABULATED_ATMOSPHERE_H
 
 #include <string>
+#include <vector>
 
+#include <boost/make_shared.hpp>
 #include <boost/shared_ptr.hpp>
 
 #include <Eigen/Core>
@@ -52,7 +54,8 @@
 #include "Tudat/Astrodynamics/Aerodynamics/standardAtmosphere.h"
 #include "Tudat/Astrodynamics/Aerodynamics/aerodynamics.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
-#include "Tudat/Mathematics/Interpolators/cubicSplineInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/adaptiveTabulation.h"
+#include "Tudat/Mathematics/Interpolators/multiOutputCubicSplineInterpolator.h"
 
 namespace tudat
 {
@@ -89,6 +92,29 @@ public:
         initialize( atmosphereTableFile_ );
     }
 
+    //! Constructor from tabulated data.
+    /*!
+     *  Constructor from tabulated data, e.g. as created by createAdaptivelyTabulatedAtmosphere.
+     *  \param altitudeData Altitudes at which atmospheric properties are given, sorted in ascending order.
+     *  \param densityData Densities at altitudeData.
+     *  \param pressureData Pressures at altitudeData.
+     *  \param temperatureData Temperatures at altitudeData.
+     *  \param specificGasConstant The constant specific gas constant of the air
+     *  \param ratioOfSpecificHeats The constant ratio of specific heats of the air
+     */
+    TabulatedAtmosphere( const std::vector< double >& altitudeData,
+                         const std::vector< double >& densityData,
+                         const std::vector< double >& pressureData,
+                         const std::vector< double >& temperatureData,
+                         const double specificGasConstant = physical_constants::SPECIFIC_GAS_CONSTANT_AIR,
+                         const double ratioOfSpecificHeats = 1.4 )
+        : atmosphereTableFile_( "" ), altitudeData_( altitudeData ), densityData_( densityData ),
+          pressureData_( pressureData ), temperatureData_( temperatureData ),
+          specificGasConstant_( specificGasConstant ), ratioOfSpecificHeats_( ratioOfSpecificHeats )
+    {
+        createInterpolator( );
+    }
+
     //! Get atmosphere table file name.
     /*!
      * Returns atmosphere table file name.
@@ -96,6 +122,13 @@ public:
      */
     std::string getAtmosphereTableFile( ) { return atmosphereTableFile_; }
 
+    //! Get altitudes at which atmospheric properties are tabulated.
+    /*!
+     * Returns altitudes at which atmospheric properties are tabulated.
+     * \return Altitudes at which atmospheric properties are tabulated.
+     */
+    std::vector< double > getAltitudeData( ) { return altitudeData_; }
+
     //! Get specific gas constant.
     /*!
      * Returns the specific gas constant of the air in J/(kg K), its value is assumed constant.
@@ -128,7 +161,7 @@ public:
         TUDAT_UNUSED_PARAMETER( longitude );
         TUDAT_UNUSED_PARAMETER( latitude );
         TUDAT_UNUSED_PARAMETER( time );
-        return cubicSplineInterpolationForDensity_->interpolate( altitude );
+        return cubicSplineInterpolationForAtmosphericProperties_->interpolate( altitude )( 0 );
     }
 
     //! Get local pressure.
@@ -149,7 +182,7 @@ public:
         TUDAT_UNUSED_PARAMETER( longitude );
         TUDAT_UNUSED_PARAMETER( latitude );
         TUDAT_UNUSED_PARAMETER( time );
-        return cubicSplineInterpolationForPressure_->interpolate( altitude );
+        return cubicSplineInterpolationForAtmosphericProperties_->interpolate( altitude )( 1 );
     }
 
     //! Get local temperature.
@@ -170,7 +203,7 @@ public:
         TUDAT_UNUSED_PARAMETER( longitude );
         TUDAT_UNUSED_PARAMETER( latitude );
         TUDAT_UNUSED_PARAMETER( time );
-        return cubicSplineInterpolationForTemperature_->interpolate( altitude );
+        return cubicSplineInterpolationForAtmosphericProperties_->interpolate( altitude )( 2 );
     }
 
     //! Get local speed of sound in the atmosphere.
@@ -196,6 +229,29 @@ public:
                     specificGasConstant_ );
     }
 
+    //! Get local density, pressure and temperature.
+    /*!
+     * Returns the local density (kg/m^3), pressure (N/m^2) and temperature (K) of the atmosphere,
+     * which are obtained from a single interpolation of the tabulated data.
+     * \param altitude Altitude at which atmospheric properties are to be computed.
+     * \param longitude Longitude at which atmospheric properties are to be computed (not used but
+     * included for consistency with base class interface).
+     * \param latitude Latitude at which atmospheric properties are to be computed (not used but
+     * included for consistency with base class interface).
+     * \param time Time at which atmospheric properties are to be computed (not used but included
+     * for consistency with base class interface).
+     * \return Atmospheric density, pressure and temperature (in that order) at specified altitude.
+     */
+    Eigen::Vector3d getDensityPressureAndTemperature(
+            const double altitude, const double longitude = 0.0,
+            const double latitude = 0.0, const double time = 0.0 )
+    {
+        TUDAT_UNUSED_PARAMETER( longitude );
+        TUDAT_UNUSED_PARAMETER( latitude );
+        TUDAT_UNUSED_PARAMETER( time );
+        return cubicSplineInterpolationForAtmosphericProperties_->interpolate( altitude );
+    }
+
 protected:
 
 private:
@@ -207,6 +263,12 @@ private:
      */
     void initialize( const std::string& atmosphereTableFile );
 
+    //! Create interpolator of atmospheric properties.
+    /*!
+     * Creates interpolator of density, pressure and temperature from the tabulated data.
+     */
+    void createInterpolator( );
+
     //! The file name of the atmosphere table.
     /*!
      *  The file name of the atmosphere table. The file should contain four columns of data,
@@ -239,23 +301,13 @@ private:
      */
     std::vector< double > temperatureData_;
 
-    //! Cubic spline interpolation for density.
-    /*!
-     *  Cubic spline interpolation for density.
-     */
-    interpolators::CubicSplineInterpolatorDoublePointer cubicSplineInterpolationForDensity_;
-
-    //! Cubic spline interpolation for pressure.
-    /*!
-     *  Cubic spline interpolation for pressure.
-     */
-    interpolators::CubicSplineInterpolatorDoublePointer cubicSplineInterpolationForPressure_;
-
-    //! Cubic spline interpolation for temperature.
+    //! Cubic spline interpolation for density, pressure and temperature.
     /*!
-     *  Cubic spline interpolation for temperature.
+     *  Cubic spline interpolation for density, pressure and temperature (in that order), sharing
+     *  a single lookup of the altitude interval.
      */
-    interpolators::CubicSplineInterpolatorDoublePointer cubicSplineInterpolationForTemperature_;
+    boost::shared_ptr< interpolators::MultiOutputCubicSplineInterpolator< double, double, 3 > >
+    cubicSplineInterpolationForAtmosphericProperties_;
 
     //! Specific gas constant.
     /*!
@@ -274,6 +326,38 @@ private:
 //! Typedef for shared-pointer to TabulatedAtmosphere object.
 typedef boost::shared_ptr< TabulatedAtmosphere > TabulatedAtmospherePointer;
 
+//! Create tabulated atmosphere from another atmosphere model, with adaptively selected altitudes.
+/*!
+ * Creates a tabulated atmosphere from another (e.g. computationally expensive) atmosphere model, at
+ * fixed longitude, latitude and time. The altitudes at which the density, pressure and temperature
+ * are tabulated are selected adaptively, such that the error of the (cubic spline) interpolation
+ * meets the given tolerance (see interpolators::tabulateFunctionAdaptively). Since density and
+ * pressure vary by orders of magnitude, a relative error tolerance is normally used.
+ * \param sourceAtmosphere Atmosphere model that is to be tabulated.
+ * \param minimumAltitude Minimum altitude of tabulation.
+ * \param maximumAltitude Maximum altitude of tabulation.
+ * \param initialAltitudeStep Altitude step of initial, uniform, tabulation.
+ * \param tabulationSettings Settings for adaptive tabulation.
+ * \param longitude Longitude at which atmosphere is tabulated.
+ * \param latitude Latitude at which atmosphere is tabulated.
+ * \param time Time at which atmosphere is tabulated.
+ * \param specificGasConstant The constant specific gas constant of the air
+ * \param ratioOfSpecificHeats The constant ratio of specific heats of the air
+ * \return Tabulated atmosphere.
+ */
+TabulatedAtmospherePointer createAdaptivelyTabulatedAtmosphere(
+        const boost::shared_ptr< AtmosphereModel > sourceAtmosphere,
+        const double minimumAltitude,
+        const double maximumAltitude,
+        const double initialAltitudeStep,
+        const boost::shared_ptr< interpolators::AdaptiveTabulationSettings > tabulationSettings =
+        boost::make_shared< interpolators::AdaptiveTabulationSettings >( 1.0E-6 ),
+        const double longitude = 0.0,
+        const double latitude = 0.0,
+        const double time = 0.0,
+        const double specificGasConstant = physical_constants::SPECIFIC_GAS_CONSTANT_AIR,
+        const double ratioOfSpecificHeats = 1.4 );
+
 } // namespace aerodynamics
 } // namespace tudat
 
@@ -64,6 +64,7 @@
 #include <boost/random/uniform_real_distribution.hpp>
 #include <boost/random/mersenne_twister.hpp>
 
+#include <cmath>
 #include <fstream>
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/convertMeanToEccentricAnomalies.h"
@@ -466,6 +467,45 @@ BOOST_AUTO_TEST_CASE( test_convertMeanAnomalyToEccentricAnomaly_specificInitialG
                        1.0E-13 );
 }
 
+//! Test 8: Test conversion of multiple anomalies with fixed number of Halley iterations.
+BOOST_AUTO_TEST_CASE( test_convertMeanAnomaliesToEccentricAnomaliesWithHalley )
+{
+    // Set test values (see Test 2), with mean anomalies shifted by multiples of 2 PI.
+    Eigen::ArrayXd testEccentricities( 4 ), testMeanAnomalies( 4 ), referenceEccentricAnomalies( 4 );
+    testEccentricities << 0.01671, 0.43582, 0.78514, 0.91525;
+    testMeanAnomalies << convertDegreesToRadians( 60.0 ), convertDegreesToRadians( 90.0 ) + 2.0 * PI,
+            convertDegreesToRadians( 120.0 ) - 4.0 * PI, convertDegreesToRadians( 220.0 );
+    referenceEccentricAnomalies << 1.06178920406832, 1.97200731113253, 2.5392410896466,
+            3.51006218528448 - 2.0 * PI;
+
+    // Compute eccentric anomalies with four iterations (required for eccentricity above 0.8).
+    const Eigen::ArrayXd eccentricAnomalies = convertMeanAnomaliesToEccentricAnomaliesWithHalley< double >(
+                testEccentricities, testMeanAnomalies, 4 );
+    for ( int i = 0; i < 4; i++ )
+    {
+        BOOST_CHECK_CLOSE_FRACTION( eccentricAnomalies( i ), referenceEccentricAnomalies( i ), 1.0E-13 );
+    }
+
+    // Compare default number of iterations with iterative conversion over full range of mean anomaly.
+    const int numberOfTestValues = 1001;
+    const Eigen::ArrayXd meanAnomalies =
+            Eigen::ArrayXd::LinSpaced( numberOfTestValues, -3.0 * PI, 3.0 * PI );
+    for( double eccentricity = 0.0; eccentricity < 0.81; eccentricity += 0.1 )
+    {
+        const Eigen::ArrayXd eccentricities = Eigen::ArrayXd::Constant( numberOfTestValues, eccentricity );
+        const Eigen::ArrayXd computedEccentricAnomalies =
+                convertMeanAnomaliesToEccentricAnomaliesWithHalley< double >( eccentricities, meanAnomalies );
+        for( int i = 0; i < numberOfTestValues; i++ )
+        {
+            const double referenceEccentricAnomaly = convertMeanAnomalyToEccentricAnomaly(
+                        eccentricity, meanAnomalies( i ) );
+            BOOST_CHECK_SMALL( std::fabs( std::remainder(
+                                              computedEccentricAnomalies( i ) - referenceEccentricAnomaly,
+                                              2.0 * PI ) ), 1.0E-13 );
+        }
+    }
+}
+
 // End Boost test suite.
 BOOST_AUTO_TEST_SUITE_END( )
 
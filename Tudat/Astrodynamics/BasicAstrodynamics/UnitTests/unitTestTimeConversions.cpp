@@ -36,6 +36,7 @@
 #define BOOST_TEST_MAIN
 
 #include <limits>
+#include <stdexcept>
 
 #include <boost/test/floating_point_comparison.hpp>
 #include <boost/test/unit_test.hpp>
@@ -558,6 +559,19 @@ BOOST_AUTO_TEST_CASE( testTimeConversionsLong )
 
 }
 
+// Test retrieval of TAI-UTC from table of leap seconds (values from IERS Bulletin C).
+BOOST_AUTO_TEST_CASE( testTaiMinusUtc )
+{
+    BOOST_CHECK_EQUAL( getTaiMinusUtc( 41317.0 ), 10.0 );
+    BOOST_CHECK_EQUAL( getTaiMinusUtc( 51178.99 ), 31.0 );
+    BOOST_CHECK_EQUAL( getTaiMinusUtc( 51179.0 ), 32.0 );
+    BOOST_CHECK_EQUAL( getTaiMinusUtc( 54583.87 ), 33.0 );
+    BOOST_CHECK_EQUAL( getTaiMinusUtc( 57754.0 ), 37.0 );
+    BOOST_CHECK_EQUAL( getTaiMinusUtc( 60000.0 ), 37.0 );
+
+    BOOST_CHECK_THROW( getTaiMinusUtc( 41316.5 ), std::runtime_error );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -73,6 +73,9 @@ std::string getAccelerationModelName( const AvailableAcceleration accelerationTy
     case thrust_acceleration:
         accelerationName = "thrust ";
         break;
+    case multiple_third_body_central_gravity:
+        accelerationName = "multiple third-body central gravity ";
+        break;
     default:
         std::string errorMessage = "Error, acceleration type " +
                 boost::lexical_cast< std::string >( accelerationType ) +
@@ -129,6 +132,11 @@ AvailableAcceleration getAccelerationModelType(
     {
         accelerationType = thrust_acceleration;
     }
+    else if( boost::dynamic_pointer_cast< MultipleThirdBodyCentralGravityAcceleration >(
+                 accelerationModel ) != NULL )
+    {
+        accelerationType = multiple_third_body_central_gravity;
+    }
     else
     {
         throw std::runtime_error(
@@ -40,6 +40,7 @@
 #include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsGravityModel.h"
 #include "Tudat/Astrodynamics/Gravitation/mutualSphericalHarmonicGravityModel.h"
 #include "Tudat/Astrodynamics/Gravitation/thirdBodyPerturbation.h"
+#include "Tudat/Astrodynamics/Gravitation/multipleThirdBodyPerturbation.h"
 #include "Tudat/Astrodynamics/Aerodynamics/aerodynamicAcceleration.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/massRateModel.h"
 #include "Tudat/Astrodynamics/Propulsion/thrustAccelerationModel.h"
@@ -69,7 +70,8 @@ enum AvailableAcceleration
     third_body_central_gravity,
     third_body_spherical_harmonic_gravity,
     third_body_mutual_spherical_harmonic_gravity,
-    thrust_acceleration
+    thrust_acceleration,
+    multiple_third_body_central_gravity
 };
 
 //! Function to get a string representing a 'named identification' of an acceleration type
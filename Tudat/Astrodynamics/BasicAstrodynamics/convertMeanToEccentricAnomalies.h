@@ -73,6 +73,8 @@
 
 #include <cmath>
 
+#include <Eigen/Core>
+
 #include "Tudat/Mathematics/RootFinders/newtonRaphson.h"
 #include "Tudat/Mathematics/RootFinders/rootFinder.h"
 #include "Tudat/Mathematics/RootFinders/bisection.h"
@@ -293,6 +295,142 @@ ScalarType convertMeanAnomalyToEccentricAnomaly(
     return eccentricAnomaly;
 }
 
+//! Convert mean anomalies to eccentric anomalies for a list of elliptical orbit states.
+/*!
+ * Converts mean anomalies to eccentric anomalies for elliptical orbits, performing the Newton-Raphson
+ * iterations on all entries simultaneously (using Eigen array operations), so that no root finder
+ * objects are created and the trigonometric functions can be vectorized by the compiler. The same
+ * initial guess as in convertMeanAnomalyToEccentricAnomaly is used. Iterations are stopped when the
+ * change in all eccentric anomalies is below the tolerance. Entries that have not converged after
+ * the maximum number of iterations are recomputed using convertMeanAnomalyToEccentricAnomaly.
+ * \param eccentricities Eccentricities of the orbits (each >= 0.0 and < 1.0) [-].
+ * \param meanAnomalies Mean anomalies to convert to eccentric anomalies [rad].
+ * \param tolerance Absolute tolerance on eccentric anomaly (default 200 times ScalarType resolution).
+ * \param maximumNumberOfIterations Maximum number of Newton-Raphson iterations (default 1000).
+ * \return Eccentric anomalies, in the range 0 to 2.0*PI [rad].
+ */
+template< typename ScalarType = double >
+Eigen::Array< ScalarType, Eigen::Dynamic, 1 > convertMeanAnomaliesToEccentricAnomalies(
+        const Eigen::Array< ScalarType, Eigen::Dynamic, 1 >& eccentricities,
+        const Eigen::Array< ScalarType, Eigen::Dynamic, 1 >& meanAnomalies,
+        const ScalarType tolerance = 200.0 * std::numeric_limits< ScalarType >::epsilon( ),
+        const int maximumNumberOfIterations = 1000 )
+{
+    using namespace mathematical_constants;
+    typedef Eigen::Array< ScalarType, Eigen::Dynamic, 1 > ArrayType;
+
+    if( eccentricities.size( ) != meanAnomalies.size( ) )
+    {
+        throw std::runtime_error(
+                    "Error when converting mean to eccentric anomalies, input sizes are inconsistent." );
+    }
+
+    if( meanAnomalies.size( ) == 0 )
+    {
+        return ArrayType( );
+    }
+
+    if( ( eccentricities < getFloatingInteger< ScalarType >( 0 ) ).any( ) ||
+            ( eccentricities >= getFloatingInteger< ScalarType >( 1 ) ).any( ) )
+    {
+        boost::throw_exception(
+                    std::runtime_error(
+                        boost::str( boost::format(
+                                        "Invalid eccentricity. Valid range is 0.0 <= e < 1.0. "
+                                        "Minimum and maximum eccentricity were: '%f', '%f'." )
+                                    % eccentricities.minCoeff( ) % eccentricities.maxCoeff( ) ) ) );
+    }
+
+    // Set mean anomalies to region between 0 and 2 PI.
+    const ScalarType twoPi = getFloatingInteger< ScalarType >( 2 ) * getPi< ScalarType >( );
+    const ArrayType reducedMeanAnomalies = meanAnomalies - twoPi * ( meanAnomalies / twoPi ).floor( );
+
+    // Set initial guess (see convertMeanAnomalyToEccentricAnomaly).
+    ArrayType eccentricAnomalies = ( reducedMeanAnomalies > getPi< ScalarType >( ) ).select(
+                reducedMeanAnomalies - eccentricities, reducedMeanAnomalies + eccentricities );
+
+    // Perform Newton-Raphson iterations on all entries.
+    ArrayType eccentricAnomalyCorrections;
+    int numberOfIterations = 0;
+    do
+    {
+        eccentricAnomalyCorrections =
+                ( eccentricAnomalies - eccentricities * eccentricAnomalies.sin( ) - reducedMeanAnomalies ) /
+                ( getFloatingInteger< ScalarType >( 1 ) - eccentricities * eccentricAnomalies.cos( ) );
+        eccentricAnomalies -= eccentricAnomalyCorrections;
+        numberOfIterations++;
+    }
+    while( ( eccentricAnomalyCorrections.abs( ) >= tolerance ).any( ) &&
+           numberOfIterations < maximumNumberOfIterations );
+
+    // Recompute entries that have not converged using scalar conversion.
+    for( int i = 0; i < eccentricAnomalies.size( ); i++ )
+    {
+        if( !( std::fabs( eccentricAnomalyCorrections( i ) ) < tolerance ) )
+        {
+            eccentricAnomalies( i ) = convertMeanAnomalyToEccentricAnomaly< ScalarType >(
+                        eccentricities( i ), reducedMeanAnomalies( i ) );
+        }
+    }
+
+    return eccentricAnomalies;
+}
+
+//! Convert mean anomalies to eccentric anomalies using a fixed number of Halley iterations.
+/*!
+ * Converts mean anomalies to eccentric anomalies for elliptical orbits, using a branch-free
+ * algorithm that is suited for the evaluation of large numbers of orbits (e.g. in trajectory
+ * design sweeps). The mean anomalies are reduced to the interval -PI to PI, after which the
+ * initial guess E0 = M + e sin M ( 1 + e cos M ) (second-order series expansion in eccentricity)
+ * is improved by a fixed number of Halley iterations on all entries simultaneously. Since no
+ * convergence check is made, no branches occur in the iterations, and the trigonometric functions
+ * can be vectorized by the compiler. For eccentricities up to 0.8, three iterations (default)
+ * yield eccentric anomalies to machine precision; up to an eccentricity of 0.95, four iterations
+ * are required. For the (planetary) eccentricities below 0.25, two iterations are sufficient.
+ * \param eccentricities Eccentricities of the orbits (each >= 0.0 and < 1.0) [-].
+ * \param meanAnomalies Mean anomalies to convert to eccentric anomalies [rad].
+ * \param numberOfIterations Number of Halley iterations that is performed (default 3).
+ * \return Eccentric anomalies, in the range -PI to PI [rad].
+ */
+template< typename ScalarType = double >
+Eigen::Array< ScalarType, Eigen::Dynamic, 1 > convertMeanAnomaliesToEccentricAnomaliesWithHalley(
+        const Eigen::Array< ScalarType, Eigen::Dynamic, 1 >& eccentricities,
+        const Eigen::Array< ScalarType, Eigen::Dynamic, 1 >& meanAnomalies,
+        const int numberOfIterations = 3 )
+{
+    using namespace mathematical_constants;
+    typedef Eigen::Array< ScalarType, Eigen::Dynamic, 1 > ArrayType;
+
+    if( eccentricities.size( ) != meanAnomalies.size( ) )
+    {
+        throw std::runtime_error(
+                    "Error when converting mean to eccentric anomalies, input sizes are inconsistent." );
+    }
+
+    // Set mean anomalies to region between -PI and PI.
+    const ScalarType twoPi = getFloatingInteger< ScalarType >( 2 ) * getPi< ScalarType >( );
+    const ArrayType reducedMeanAnomalies = meanAnomalies -
+            twoPi * ( ( meanAnomalies + getPi< ScalarType >( ) ) / twoPi ).floor( );
+
+    // Set initial guess from series expansion in eccentricity.
+    ArrayType eccentricAnomalies = reducedMeanAnomalies + eccentricities * reducedMeanAnomalies.sin( ) *
+            ( getFloatingInteger< ScalarType >( 1 ) + eccentricities * reducedMeanAnomalies.cos( ) );
+
+    // Perform Halley iterations on all entries.
+    ArrayType eSinE, eCosE, keplerFunction, keplerFunctionDerivative;
+    for( int i = 0; i < numberOfIterations; i++ )
+    {
+        eSinE = eccentricities * eccentricAnomalies.sin( );
+        eCosE = eccentricities * eccentricAnomalies.cos( );
+        keplerFunction = eccentricAnomalies - eSinE - reducedMeanAnomalies;
+        keplerFunctionDerivative = getFloatingInteger< ScalarType >( 1 ) - eCosE;
+        eccentricAnomalies -= getFloatingInteger< ScalarType >( 2 ) * keplerFunction * keplerFunctionDerivative /
+                ( getFloatingInteger< ScalarType >( 2 ) * keplerFunctionDerivative.square( ) -
+                  keplerFunction * eSinE );
+    }
+
+    return eccentricAnomalies;
+}
 
 //! Convert mean anomaly to hyperbolic eccentric anomaly.
 /*!
@@ -0,0 +1,50 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
+
+namespace tudat
+{
+
+namespace orbital_element_conversions
+{
+
+//! Function to compute unit vectors towards periapsis and in the direction of motion at periapsis.
+void computePeriapsisAndPerpendicularDirections(
+        const Eigen::ArrayXd& argumentsOfPeriapsis,
+        const Eigen::ArrayXd& longitudesOfAscendingNode,
+        const Eigen::ArrayXd& sineOfInclinations,
+        const Eigen::ArrayXd& cosineOfInclinations,
+        Eigen::Array< double, Eigen::Dynamic, 3 >& periapsisDirections,
+        Eigen::Array< double, Eigen::Dynamic, 3 >& perpendicularDirections )
+{
+    const Eigen::ArrayXd sineOfArgumentsOfPeriapsis = argumentsOfPeriapsis.sin( );
+    const Eigen::ArrayXd cosineOfArgumentsOfPeriapsis = argumentsOfPeriapsis.cos( );
+    const Eigen::ArrayXd sineOfLongitudesOfAscendingNode = longitudesOfAscendingNode.sin( );
+    const Eigen::ArrayXd cosineOfLongitudesOfAscendingNode = longitudesOfAscendingNode.cos( );
+
+    periapsisDirections.resize( argumentsOfPeriapsis.size( ), 3 );
+    periapsisDirections.col( 0 ) = cosineOfArgumentsOfPeriapsis * cosineOfLongitudesOfAscendingNode -
+            sineOfArgumentsOfPeriapsis * sineOfLongitudesOfAscendingNode * cosineOfInclinations;
+    periapsisDirections.col( 1 ) = cosineOfArgumentsOfPeriapsis * sineOfLongitudesOfAscendingNode +
+            sineOfArgumentsOfPeriapsis * cosineOfLongitudesOfAscendingNode * cosineOfInclinations;
+    periapsisDirections.col( 2 ) = sineOfArgumentsOfPeriapsis * sineOfInclinations;
+
+    perpendicularDirections.resize( argumentsOfPeriapsis.size( ), 3 );
+    perpendicularDirections.col( 0 ) = -sineOfArgumentsOfPeriapsis * cosineOfLongitudesOfAscendingNode -
+            cosineOfArgumentsOfPeriapsis * sineOfLongitudesOfAscendingNode * cosineOfInclinations;
+    perpendicularDirections.col( 1 ) = -sineOfArgumentsOfPeriapsis * sineOfLongitudesOfAscendingNode +
+            cosineOfArgumentsOfPeriapsis * cosineOfLongitudesOfAscendingNode * cosineOfInclinations;
+    perpendicularDirections.col( 2 ) = cosineOfArgumentsOfPeriapsis * sineOfInclinations;
+}
+
+} // namespace orbital_element_conversions
+
+} // namespace tudat
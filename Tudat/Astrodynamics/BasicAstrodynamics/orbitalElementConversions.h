@@ -1074,6 +1074,27 @@ ScalarType convertSemiMajorAxisToEllipticalMeanMotion(
                           ( semiMajorAxis * semiMajorAxis * semiMajorAxis ) );
     }
 }
+
+//! Function to compute unit vectors towards periapsis and in the direction of motion at periapsis.
+/*!
+ *  Function to compute the unit vectors towards periapsis (P) and in the direction of motion at periapsis (Q) for a
+ *  set of orbits, in the frame in which the orbital elements are defined.
+ *  \param argumentsOfPeriapsis Arguments of periapsis of the orbits.
+ *  \param longitudesOfAscendingNode Longitudes of the ascending node of the orbits.
+ *  \param sineOfInclinations Sines of the inclinations of the orbits.
+ *  \param cosineOfInclinations Cosines of the inclinations of the orbits.
+ *  \param periapsisDirections Unit vectors towards periapsis, one column per component (returned by reference).
+ *  \param perpendicularDirections Unit vectors in the direction of motion at periapsis, one column per component
+ *  (returned by reference).
+ */
+void computePeriapsisAndPerpendicularDirections(
+        const Eigen::ArrayXd& argumentsOfPeriapsis,
+        const Eigen::ArrayXd& longitudesOfAscendingNode,
+        const Eigen::ArrayXd& sineOfInclinations,
+        const Eigen::ArrayXd& cosineOfInclinations,
+        Eigen::Array< double, Eigen::Dynamic, 3 >& periapsisDirections,
+        Eigen::Array< double, Eigen::Dynamic, 3 >& perpendicularDirections );
+
 } // namespace orbital_element_conversions
 
 } // namespace tudat
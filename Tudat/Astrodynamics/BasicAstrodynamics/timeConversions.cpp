@@ -32,6 +32,8 @@
  *
  */
 
+#include <stdexcept>
+
 #include <boost/date_time/gregorian/gregorian.hpp>
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
@@ -279,6 +281,32 @@ double approximateConvertTTtoTDB( const double ttSecondsSinceJ2000 )
     return ttSecondsSinceJ2000 + 0.001657  * std::sin( 628.3076 * ttCenturiesSinceJ2000 + 6.2401 );
 }
 
+//! Function to retrieve the difference between TAI and UTC.
+double getTaiMinusUtc( const double utcModifiedJulianDay )
+{
+    // Modified Julian days (UTC) at which leap seconds were introduced, starting at 1 January 1972 (TAI-UTC = 10 s).
+    static const double leapSecondModifiedJulianDays[ ] =
+    { 41317.0, 41499.0, 41683.0, 42048.0, 42413.0, 42778.0, 43144.0, 43509.0, 43874.0, 44239.0,
+      44786.0, 45151.0, 45516.0, 46247.0, 47161.0, 47892.0, 48257.0, 48804.0, 49169.0, 49534.0,
+      50083.0, 50630.0, 51179.0, 53736.0, 54832.0, 56109.0, 57204.0, 57754.0 };
+    static const int numberOfLeapSecondEntries =
+            sizeof( leapSecondModifiedJulianDays ) / sizeof( leapSecondModifiedJulianDays[ 0 ] );
+
+    if( utcModifiedJulianDay < leapSecondModifiedJulianDays[ 0 ] )
+    {
+        throw std::runtime_error( "Error, TAI-UTC is not defined before 1 January 1972." );
+    }
+
+    int numberOfLeapSeconds = 0;
+    while( ( numberOfLeapSeconds + 1 < numberOfLeapSecondEntries ) &&
+           ( utcModifiedJulianDay >= leapSecondModifiedJulianDays[ numberOfLeapSeconds + 1 ] ) )
+    {
+        numberOfLeapSeconds++;
+    }
+
+    return 10.0 + static_cast< double >( numberOfLeapSeconds );
+}
+
 
 } // namespace basic_astrodynamics
 } // namespace tudat
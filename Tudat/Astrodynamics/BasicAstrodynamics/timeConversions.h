@@ -449,6 +449,17 @@ TimeType convertTTtoTAI( const TimeType ttTime )
  */
 double approximateConvertTTtoTDB( const double ttSecondsSinceJ2000);
 
+//! Function to retrieve the difference between TAI and UTC.
+/*!
+ * Function to retrieve the difference between TAI and UTC (i.e. the accumulated number of leap seconds, plus 10
+ * seconds), from a table of leap seconds introduced up to and including 1 January 2017. The difference is not defined
+ * before 1 January 1972 (when UTC was not offset from TAI by an integer number of seconds), for which an exception is
+ * thrown.
+ * \param utcModifiedJulianDay Modified Julian day (in UTC) at which the difference is to be retrieved.
+ * \return Difference between TAI and UTC (in seconds).
+ */
+double getTaiMinusUtc( const double utcModifiedJulianDay );
+
 
 } // namespace basic_astrodynamics
 } // tudat
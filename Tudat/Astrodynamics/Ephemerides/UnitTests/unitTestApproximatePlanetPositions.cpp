@@ -64,6 +64,7 @@
 
 #include "Tudat/Astrodynamics/Ephemerides/approximatePlanetPositions.h"
 #include "Tudat/Astrodynamics/Ephemerides/approximatePlanetPositionsCircularCoplanar.h"
+#include "Tudat/Astrodynamics/Ephemerides/vectorizedApproximatePlanetPositions.h"
 
 namespace tudat
 {
@@ -142,6 +143,82 @@ BOOST_AUTO_TEST_CASE( testCircularCoplannar )
     BOOST_CHECK_EQUAL( marsEphemeris.getReferenceFrameOrigin( ), "Sun" );
 }
 
+//! Test the computation of states at a list of epochs against single-epoch states.
+BOOST_AUTO_TEST_CASE( testMultipleEpochs )
+{
+    using namespace ephemerides;
+
+    ApproximatePlanetPositions marsEphemeris( ApproximatePlanetPositions::mars );
+
+    std::vector< double > epochs;
+    for( unsigned int i = 0; i < 50; i++ )
+    {
+        epochs.push_back( -5.0E8 + static_cast< double >( i ) * 2.0E7 );
+    }
+
+    Eigen::Matrix< double, 6, Eigen::Dynamic > marsStates;
+    marsEphemeris.getCartesianStatesFromEphemeris( epochs, marsStates, 2455626.5 );
+    BOOST_CHECK_EQUAL( marsStates.cols( ), 50 );
+
+    for( unsigned int i = 0; i < epochs.size( ); i++ )
+    {
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    marsEphemeris.getCartesianStateFromEphemeris( epochs.at( i ), 2455626.5 ),
+                    basic_mathematics::Vector6d( marsStates.col( i ) ), 1.0E-12 );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testVectorizedApproximatePlanetPositions )
+{
+    using namespace ephemerides;
+
+    // Create vectorized ephemeris for all planets.
+    std::vector< ApproximatePlanetPositionsBase::BodiesWithEphemerisData > bodies;
+    bodies.push_back( ApproximatePlanetPositionsBase::mercury );
+    bodies.push_back( ApproximatePlanetPositionsBase::venus );
+    bodies.push_back( ApproximatePlanetPositionsBase::earthMoonBarycenter );
+    bodies.push_back( ApproximatePlanetPositionsBase::mars );
+    bodies.push_back( ApproximatePlanetPositionsBase::jupiter );
+    bodies.push_back( ApproximatePlanetPositionsBase::saturn );
+    bodies.push_back( ApproximatePlanetPositionsBase::uranus );
+    bodies.push_back( ApproximatePlanetPositionsBase::neptune );
+    bodies.push_back( ApproximatePlanetPositionsBase::pluto );
+    VectorizedApproximatePlanetPositions vectorizedEphemeris( bodies );
+
+    std::vector< double > epochs;
+    for( unsigned int i = 0; i < 300; i++ )
+    {
+        epochs.push_back( -3.0E9 + static_cast< double >( i ) * 2.1E7 );
+    }
+
+    // Compute states of all planets at all epochs, and compare with single-epoch ephemerides (differences are due
+    // to rounding of the Julian date in ApproximatePlanetPositions).
+    std::vector< Eigen::Matrix< double, 6, Eigen::Dynamic > > planetStates;
+    vectorizedEphemeris.getCartesianStates( epochs, planetStates, 2455626.5 );
+    BOOST_CHECK_EQUAL( planetStates.size( ), bodies.size( ) );
+
+    for( unsigned int i = 0; i < bodies.size( ); i++ )
+    {
+        ApproximatePlanetPositions planetEphemeris( bodies.at( i ) );
+        BOOST_CHECK_EQUAL( planetStates.at( i ).cols( ), 300 );
+        for( unsigned int j = 0; j < epochs.size( ); j++ )
+        {
+            const basic_mathematics::Vector6d expectedState =
+                    planetEphemeris.getCartesianStateFromEphemeris( epochs.at( j ), 2455626.5 );
+            const basic_mathematics::Vector6d stateDifference = planetStates.at( i ).col( j ) - expectedState;
+            BOOST_CHECK_SMALL( stateDifference.segment( 0, 3 ).norm( ) / expectedState.segment( 0, 3 ).norm( ),
+                               1.0E-10 );
+            BOOST_CHECK_SMALL( stateDifference.segment( 3, 3 ).norm( ) / expectedState.segment( 3, 3 ).norm( ),
+                               1.0E-10 );
+        }
+    }
+
+    // Check states of single planet.
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( vectorizedEphemeris.getCartesianStatesOfBody( 3, epochs, 2455626.5 ),
+                                       planetStates.at( 3 ), 1.0E-15 );
+    BOOST_CHECK_THROW( vectorizedEphemeris.getCartesianStatesOfBody( 9, epochs ), std::runtime_error );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -0,0 +1,251 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Ephemerides/chebyshevEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/keplerEphemeris.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_chebyshev_ephemeris )
+
+using namespace ephemerides;
+
+//! Test evaluation of Chebyshev series against explicit Chebyshev polynomials.
+BOOST_AUTO_TEST_CASE( testChebyshevSeriesEvaluation )
+{
+    Eigen::Matrix< double, 6, Eigen::Dynamic > coefficients( 6, 4 );
+    coefficients << 1.0, 2.0, 3.0, 4.0,
+            -1.0, 0.5, 0.25, 0.125,
+            0.0, 0.0, 0.0, 1.0,
+            3.0, 0.0, -2.0, 0.0,
+            1.0E3, 1.0E2, 1.0E1, 1.0,
+            0.0, 1.0, 0.0, 0.0;
+
+    for( int i = 0; i <= 20; i++ )
+    {
+        const double x = -1.0 + 0.1 * i;
+        Eigen::Vector4d chebyshevPolynomials( 1.0, x, 2.0 * x * x - 1.0, 4.0 * x * x * x - 3.0 * x );
+        basic_mathematics::Vector6d expectedValue = coefficients * chebyshevPolynomials;
+        basic_mathematics::Vector6d computedValue = evaluateChebyshevSeries( coefficients, x );
+        for( unsigned int j = 0; j < 6; j++ )
+        {
+            BOOST_CHECK_SMALL( computedValue( j ) - expectedValue( j ),
+                               1.0E-12 * ( 1.0 + std::fabs( expectedValue( j ) ) ) );
+        }
+    }
+}
+
+//! Test fit of Chebyshev ephemeris to eccentric Kepler orbit.
+BOOST_AUTO_TEST_CASE( testChebyshevEphemerisKeplerOrbit )
+{
+    // Create Kepler ephemeris of eccentric Earth orbit.
+    const double earthGravitationalParameter = 398600.4415e9;
+    basic_mathematics::Vector6d keplerElements;
+    keplerElements << 1.2E7, 0.3, 0.4, 1.0, 2.0, 0.5;
+    boost::shared_ptr< KeplerEphemeris > keplerEphemeris = boost::make_shared< KeplerEphemeris >(
+                keplerElements, 0.0, earthGravitationalParameter, "Earth", "ECLIPJ2000" );
+
+    // Fit Chebyshev ephemeris over two days.
+    const double initialTime = 1.0E6;
+    const double finalTime = initialTime + 2.0 * 86400.0;
+    const double positionTolerance = 1.0E-3;
+    ChebyshevEphemeris chebyshevEphemeris(
+                boost::bind( &Ephemeris::getCartesianStateFromEphemeris, keplerEphemeris, _1,
+                             basic_astrodynamics::JULIAN_DAY_ON_J2000 ),
+                initialTime, finalTime, positionTolerance, "Earth", "ECLIPJ2000" );
+
+    BOOST_CHECK_EQUAL( chebyshevEphemeris.getReferenceFrameOrigin( ), "Earth" );
+    BOOST_CHECK_EQUAL( chebyshevEphemeris.getPolynomialDegree( ), 12 );
+    BOOST_CHECK( chebyshevEphemeris.getNumberOfSegments( ) > 1 );
+    BOOST_CHECK( chebyshevEphemeris.getMaximumPositionFitError( ) <= positionTolerance );
+
+    // Check that segments are contiguous and cover fit interval.
+    std::vector< double > segmentStartTimes = chebyshevEphemeris.getSegmentStartTimes( );
+    BOOST_CHECK_EQUAL( segmentStartTimes.front( ), initialTime );
+    for( unsigned int i = 1; i < segmentStartTimes.size( ); i++ )
+    {
+        BOOST_CHECK( segmentStartTimes.at( i ) > segmentStartTimes.at( i - 1 ) );
+    }
+
+    // Compare Chebyshev ephemeris to Kepler ephemeris over fit interval (incl. segment boundaries).
+    double maximumPositionError = 0.0, maximumVelocityError = 0.0;
+    for( int i = 0; i <= 10000; i++ )
+    {
+        const double currentTime = initialTime + ( finalTime - initialTime ) * static_cast< double >( i ) / 10000.0;
+        basic_mathematics::Vector6d stateDifference =
+                chebyshevEphemeris.getCartesianStateFromEphemeris( currentTime ) -
+                keplerEphemeris->getCartesianStateFromEphemeris( currentTime );
+        maximumPositionError = std::max( maximumPositionError, stateDifference.segment( 0, 3 ).norm( ) );
+        maximumVelocityError = std::max( maximumVelocityError, stateDifference.segment( 3, 3 ).norm( ) );
+    }
+    BOOST_CHECK_SMALL( maximumPositionError, 2.0 * positionTolerance );
+    BOOST_CHECK_SMALL( maximumVelocityError, 1.0E-5 );
+
+    for( unsigned int i = 0; i < segmentStartTimes.size( ); i++ )
+    {
+        BOOST_CHECK_SMALL( ( chebyshevEphemeris.getCartesianStateFromEphemeris( segmentStartTimes.at( i ) ) -
+                             keplerEphemeris->getCartesianStateFromEphemeris( segmentStartTimes.at( i ) ) ).
+                           segment( 0, 3 ).norm( ), positionTolerance );
+    }
+
+    // Check that tighter tolerance leads to more segments.
+    ChebyshevEphemeris accurateChebyshevEphemeris(
+                boost::bind( &Ephemeris::getCartesianStateFromEphemeris, keplerEphemeris, _1,
+                             basic_astrodynamics::JULIAN_DAY_ON_J2000 ),
+                initialTime, finalTime, 1.0E-2 * positionTolerance, "Earth", "ECLIPJ2000" );
+    BOOST_CHECK( accurateChebyshevEphemeris.getNumberOfSegments( ) > chebyshevEphemeris.getNumberOfSegments( ) );
+    BOOST_CHECK( accurateChebyshevEphemeris.getMaximumPositionFitError( ) <= 1.0E-2 * positionTolerance );
+
+    // Check that inconsistent reference epoch is rejected.
+    bool isExceptionCaught = false;
+    try
+    {
+        chebyshevEphemeris.getCartesianStateFromEphemeris( initialTime, 2451545.0 + 1.0 );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+}
+
+//! Function returning a state of which the components are polynomials of (at most) third degree in time.
+basic_mathematics::Vector6d getCubicPolynomialState( const double time )
+{
+    basic_mathematics::Vector6d state;
+    state << 1.0, time, time * time, time * time * time, 2.0 - 3.0 * time * time, 5.0;
+    return state;
+}
+
+//! Test that polynomials of degree at most that of the fit are represented exactly by a single segment.
+BOOST_AUTO_TEST_CASE( testChebyshevEphemerisPolynomial )
+{
+    ChebyshevEphemeris chebyshevEphemeris( &getCubicPolynomialState, -10.0, 10.0, 1.0E-6, "SSB", "J2000", 3 );
+    BOOST_CHECK_EQUAL( chebyshevEphemeris.getNumberOfSegments( ), 1 );
+
+    // Check interpolation, and extrapolation outside of fit interval.
+    double testTimes[ 3 ] = { 4.2, -15.0, 12.0 };
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        basic_mathematics::Vector6d computedState = chebyshevEphemeris.getCartesianStateFromEphemeris( testTimes[ i ] );
+        basic_mathematics::Vector6d expectedState = getCubicPolynomialState( testTimes[ i ] );
+        for( unsigned int j = 0; j < 6; j++ )
+        {
+            BOOST_CHECK_SMALL( computedState( j ) - expectedState( j ), 1.0E-11 );
+        }
+    }
+}
+
+//! Function returning state with a kink at t = 1/3, to test deep local refinement.
+basic_mathematics::Vector6d getKinkedState( const double time )
+{
+    basic_mathematics::Vector6d state = basic_mathematics::Vector6d::Zero( );
+    state( 0 ) = std::fabs( time - 1.0 / 3.0 );
+    state( 1 ) = time;
+    return state;
+}
+
+//! Test deep local refinement, and retrieval of the correct segment for each time.
+BOOST_AUTO_TEST_CASE( testChebyshevEphemerisDeepRefinement )
+{
+    // Refine around kink with maximum number of bisections (segment sizes differing by factor 2^30).
+    ChebyshevEphemeris chebyshevEphemeris( &getKinkedState, 0.0, 1.0, 1.0E-12, "SSB", "J2000", 3, 30 );
+    BOOST_CHECK_LT( chebyshevEphemeris.getNumberOfSegments( ), 100 );
+
+    // Check that each segment is used for times in its own interval.
+    const std::vector< double > segmentStartTimes = chebyshevEphemeris.getSegmentStartTimes( );
+    for( unsigned int i = 0; i < segmentStartTimes.size( ); i++ )
+    {
+        const double segmentEndTime = ( i + 1 < segmentStartTimes.size( ) ) ? segmentStartTimes.at( i + 1 ) : 1.0;
+        const double testTime = 0.5 * ( segmentStartTimes.at( i ) + segmentEndTime );
+        if( std::fabs( testTime - 1.0 / 3.0 ) > 1.0E-6 )
+        {
+            BOOST_CHECK_SMALL( chebyshevEphemeris.getCartesianStateFromEphemeris( testTime )( 0 ) -
+                               std::fabs( testTime - 1.0 / 3.0 ), 1.0E-12 );
+        }
+    }
+}
+
+//! Function returning state with a narrow Gaussian peak at t = 0.8, to obtain segments of unequal length.
+basic_mathematics::Vector6d getPeakedState( const double time )
+{
+    basic_mathematics::Vector6d state = basic_mathematics::Vector6d::Zero( );
+    state( 0 ) = std::exp( -( time - 0.8 ) * ( time - 0.8 ) / 1.0E-4 );
+    state( 1 ) = std::sin( 2.0 * time );
+    return state;
+}
+
+//! Test retrieval of the correct segment for segments of unequal length, including times close to the boundaries.
+BOOST_AUTO_TEST_CASE( testChebyshevEphemerisUnequalSegments )
+{
+    const double positionTolerance = 1.0E-8;
+    ChebyshevEphemeris chebyshevEphemeris( &getPeakedState, 0.0, 1.0, positionTolerance, "SSB", "J2000", 8, 12 );
+    BOOST_CHECK( chebyshevEphemeris.getMaximumPositionFitError( ) <= positionTolerance );
+
+    // Check that segment lengths differ significantly.
+    std::vector< double > segmentBoundaries = chebyshevEphemeris.getSegmentStartTimes( );
+    segmentBoundaries.push_back( 1.0 );
+    double minimumSegmentLength = 1.0, maximumSegmentLength = 0.0;
+    for( unsigned int i = 1; i < segmentBoundaries.size( ); i++ )
+    {
+        const double segmentLength = segmentBoundaries.at( i ) - segmentBoundaries.at( i - 1 );
+        minimumSegmentLength = std::min( minimumSegmentLength, segmentLength );
+        maximumSegmentLength = std::max( maximumSegmentLength, segmentLength );
+    }
+    BOOST_CHECK_GE( maximumSegmentLength / minimumSegmentLength, 8.0 );
+
+    // Check states at start, middle and end of each segment (a wrong segment would be extrapolated).
+    for( unsigned int i = 1; i < segmentBoundaries.size( ); i++ )
+    {
+        const double segmentLength = segmentBoundaries.at( i ) - segmentBoundaries.at( i - 1 );
+        const double testTimes[ 3 ] = { segmentBoundaries.at( i - 1 ),
+                                        segmentBoundaries.at( i - 1 ) + 0.5 * segmentLength,
+                                        segmentBoundaries.at( i ) - 1.0E-9 * segmentLength };
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_SMALL( ( chebyshevEphemeris.getCartesianStateFromEphemeris( testTimes[ j ] ) -
+                                 getPeakedState( testTimes[ j ] ) ).segment( 0, 3 ).norm( ), 2.0 * positionTolerance );
+        }
+    }
+
+    // Check states on a dense grid over the fit interval.
+    double maximumPositionError = 0.0;
+    for( int i = 0; i <= 10000; i++ )
+    {
+        const double currentTime = static_cast< double >( i ) / 10000.0;
+        maximumPositionError = std::max(
+                    maximumPositionError, ( chebyshevEphemeris.getCartesianStateFromEphemeris( currentTime ) -
+                                            getPeakedState( currentTime ) ).segment( 0, 3 ).norm( ) );
+    }
+    BOOST_CHECK_SMALL( maximumPositionError, 2.0 * positionTolerance );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
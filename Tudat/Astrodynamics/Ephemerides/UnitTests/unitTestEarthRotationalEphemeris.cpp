@@ -0,0 +1,244 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      IAU SOFA Board, IAU SOFA Software Collection, http://www.iausofa.org (reference values computed with the
+ *        routines pnm06a, s06, c2ixys, era00, sp00, pom00 and c2tcio).
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/make_shared.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Ephemerides/earthRotationalEphemeris.h"
+#include "Tudat/InputOutput/basicInputOutput.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace ephemerides;
+
+//! Function to write (synthetic) Earth orientation parameters for 2010-01-04 to 2010-01-07 to a file.
+std::string writeTestEarthOrientationParametersFile( )
+{
+    const std::string fileName = input_output::getTudatRootPath( ) +
+            "Astrodynamics/Ephemerides/UnitTests/testEarthOrientationParameters.txt";
+    std::ofstream eopFile( fileName.c_str( ) );
+    eopFile << "% MJD (UTC)  x_p [as]  y_p [as]  UT1-UTC [s]  dX [as]  dY [as]" << std::endl
+            << "55197.0 0.04050 0.19610 -0.0910 0.00012 -0.00008" << std::endl
+            << "55198.0 0.04000 0.19750 -0.0920 0.00014 -0.00005" << std::endl
+            << "55199.0 0.03930 0.19880 -0.0932 0.00011 -0.00007" << std::endl
+            << "55200.0 0.03870 0.20010 -0.0941 0.00009 -0.00010" << std::endl;
+    eopFile.close( );
+    return fileName;
+}
+
+//! Function to compute rotations to target frame at a list of times, as performed by a single thread.
+void computeEarthRotationsAtTimes( const boost::shared_ptr< EarthRotationalEphemeris > earthRotationalEphemeris,
+                                   const std::vector< double >* times,
+                                   std::vector< Eigen::Matrix3d >* rotationsToTargetFrame )
+{
+    rotationsToTargetFrame->resize( times->size( ) );
+    for( unsigned int i = 0; i < times->size( ); i++ )
+    {
+        rotationsToTargetFrame->at( i ) =
+                Eigen::Matrix3d( earthRotationalEphemeris->getRotationToTargetFrame( times->at( i ) ) );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE( test_earth_rotational_ephemeris )
+
+// Test Earth rotation model, with and without caching of precession-nutation model, against Sofa.
+BOOST_AUTO_TEST_CASE( testEarthRotationalEphemerisAgainstSofa )
+{
+    const std::string eopFileName = writeTestEarthOrientationParametersFile( );
+    boost::shared_ptr< EarthOrientationParameters > earthOrientationParameters =
+            readEarthOrientationParametersFromFile( eopFileName );
+    std::remove( eopFileName.c_str( ) );
+
+    // Check time range of parameters (TT, TAI-UTC is 34 s).
+    BOOST_CHECK_CLOSE_FRACTION( earthOrientationParameters->getStartTime( ),
+                                ( 55197.0 - 51544.5 ) * 86400.0 + 34.0 + 32.184, 1.0E-15 );
+    BOOST_CHECK_CLOSE_FRACTION( earthOrientationParameters->getEndTime( ),
+                                ( 55200.0 - 51544.5 ) * 86400.0 + 34.0 + 32.184, 1.0E-15 );
+
+    boost::shared_ptr< EarthRotationalEphemeris > directEarthRotationalEphemeris =
+            boost::make_shared< EarthRotationalEphemeris >( earthOrientationParameters, 0.0 );
+    boost::shared_ptr< EarthRotationalEphemeris > cachedEarthRotationalEphemeris =
+            boost::make_shared< EarthRotationalEphemeris >( earthOrientationParameters );
+    BOOST_CHECK_EQUAL( cachedEarthRotationalEphemeris->getTargetFrameOrientation( ), "ITRS" );
+    BOOST_CHECK_EQUAL( cachedEarthRotationalEphemeris->getPrecessionNutationUpdateInterval( ), 3600.0 );
+
+    // Set test times (TDB) and Sofa rotation matrices from GCRS to ITRS.
+    const double testTimes[ 3 ] = { 315577066.184, 315697033.984, 315834866.184 };
+    Eigen::Matrix3d sofaRotationMatrices[ 3 ];
+    sofaRotationMatrices[ 0 ] << -0.25185294877701259, 0.96776548512977301, 0.00024079837722794985,
+            -0.96776499590282661, -0.25185306360278015, 0.00097316961303298252,
+            0.0010024457716858548, 1.2059396151126713e-05, 0.99999949747839667;
+    sofaRotationMatrices[ 1 ] << -0.40957956613222624, -0.9122743008307771, 0.00042314377519661595,
+            0.91227384533000688, -0.40957978451698152, -0.00091172464383951646,
+            0.001005054098273616, 1.2599214870225158e-05, 0.99999949485363204;
+    sofaRotationMatrices[ 2 ] << -0.2026968603219132, 0.9792415158634733, 0.00019085346670742821,
+            -0.97924102001597635, -0.20269694976416841, 0.00098553253236989481,
+            0.0010037597864841765, 1.2872806644314842e-05, 0.99999949615016392;
+
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        // Check direct evaluation (limited by precision of UT1 in seconds since J2000).
+        const Eigen::Matrix3d directRotationDifference =
+                Eigen::Matrix3d( directEarthRotationalEphemeris->getRotationToTargetFrame( testTimes[ i ] ) ) -
+                sofaRotationMatrices[ i ];
+        BOOST_CHECK_SMALL( directRotationDifference.norm( ), 1.0E-11 );
+
+        // Check evaluation with interpolated precession-nutation (10 microarcseconds is roughly 5E-11 rad).
+        const Eigen::Matrix3d cachedRotationDifference =
+                Eigen::Matrix3d( cachedEarthRotationalEphemeris->getRotationToTargetFrame( testTimes[ i ] ) ) -
+                sofaRotationMatrices[ i ];
+        BOOST_CHECK_SMALL( cachedRotationDifference.norm( ), 1.0E-10 );
+
+        // Check inverse rotation.
+        const Eigen::Matrix3d inverseRotationDifference =
+                Eigen::Matrix3d( cachedEarthRotationalEphemeris->getRotationToBaseFrame( testTimes[ i ] ) ) -
+                sofaRotationMatrices[ i ].transpose( );
+        BOOST_CHECK_SMALL( inverseRotationDifference.norm( ), 1.0E-10 );
+    }
+
+    // Check that times outside range of Earth orientation parameters are rejected.
+    BOOST_CHECK_THROW( cachedEarthRotationalEphemeris->getRotationToTargetFrame( 3.2E8 ), std::runtime_error );
+}
+
+// Test consistency of cached and direct evaluations, and of rotation and its time derivative.
+BOOST_AUTO_TEST_CASE( testEarthRotationalEphemerisConsistency )
+{
+    boost::shared_ptr< EarthRotationalEphemeris > directEarthRotationalEphemeris =
+            boost::make_shared< EarthRotationalEphemeris >(
+                boost::shared_ptr< EarthOrientationParameters >( ), 0.0, "ECLIPJ2000" );
+    boost::shared_ptr< EarthRotationalEphemeris > cachedEarthRotationalEphemeris =
+            boost::make_shared< EarthRotationalEphemeris >(
+                boost::shared_ptr< EarthOrientationParameters >( ), 1800.0, "ECLIPJ2000" );
+
+    for( int i = 0; i < 400; i++ )
+    {
+        // Evaluate forward in time at steps smaller than the cadence, then jump back.
+        const double testTime = ( i < 300 ) ? ( 4.0E8 + static_cast< double >( i ) * 617.3 ) :
+                                              ( 3.0E8 - static_cast< double >( i ) * 3.0E4 );
+
+        Eigen::Quaterniond rotationToTargetFrame;
+        Eigen::Matrix3d rotationToTargetFrameDerivative;
+        Eigen::Vector3d angularVelocityVectorInBaseFrame;
+        cachedEarthRotationalEphemeris->getFullRotationalQuantitiesToTargetFrame(
+                    rotationToTargetFrame, rotationToTargetFrameDerivative, angularVelocityVectorInBaseFrame,
+                    testTime );
+
+        // Compare cached and direct evaluations.
+        const Eigen::Matrix3d rotationDifference = Eigen::Matrix3d( rotationToTargetFrame ) -
+                Eigen::Matrix3d( directEarthRotationalEphemeris->getRotationToTargetFrame( testTime ) );
+        BOOST_CHECK_SMALL( rotationDifference.norm( ), 1.0E-10 );
+
+        // Compare combined and separate evaluations.
+        const Eigen::Matrix3d derivativeDifference = rotationToTargetFrameDerivative -
+                cachedEarthRotationalEphemeris->getDerivativeOfRotationToTargetFrame( testTime );
+        BOOST_CHECK_SMALL( derivativeDifference.norm( ), 1.0E-20 );
+
+        // Check angular velocity, and derivative against central difference (precession-nutation rates neglected).
+        const Eigen::Vector3d angularVelocityDifference =
+                angularVelocityVectorInBaseFrame - getRotationalVelocityVectorInBaseFrameFromMatrices(
+                    Eigen::Matrix3d( rotationToTargetFrame ), rotationToTargetFrameDerivative.transpose( ) );
+        BOOST_CHECK_SMALL( angularVelocityDifference.norm( ) / angularVelocityVectorInBaseFrame.norm( ), 1.0E-14 );
+
+        if( i % 20 == 0 )
+        {
+            const double timeStep = 10.0;
+            const Eigen::Matrix3d numericalRotationDerivative =
+                    ( Eigen::Matrix3d( directEarthRotationalEphemeris->getRotationToTargetFrame(
+                                           testTime + timeStep ) ) -
+                      Eigen::Matrix3d( directEarthRotationalEphemeris->getRotationToTargetFrame(
+                                           testTime - timeStep ) ) ) / ( 2.0 * timeStep );
+            BOOST_CHECK_SMALL( ( numericalRotationDerivative - rotationToTargetFrameDerivative ).norm( ) /
+                               rotationToTargetFrameDerivative.norm( ), 5.0E-7 );
+        }
+    }
+
+    // Check that unsupported frames and times before 1972 (without Earth orientation parameters) are rejected.
+    BOOST_CHECK_THROW( EarthRotationalEphemeris( boost::shared_ptr< EarthOrientationParameters >( ), 3600.0, "GCRS" ),
+                       std::runtime_error );
+    BOOST_CHECK_THROW( cachedEarthRotationalEphemeris->getRotationToTargetFrame( -9.0E8 ), std::runtime_error );
+}
+
+// Test concurrent use of Earth rotation model (with cached precession-nutation and Earth orientation parameters).
+BOOST_AUTO_TEST_CASE( testEarthRotationalEphemerisConcurrentUse )
+{
+    const std::string eopFileName = writeTestEarthOrientationParametersFile( );
+    boost::shared_ptr< EarthOrientationParameters > earthOrientationParameters =
+            readEarthOrientationParametersFromFile( eopFileName );
+    std::remove( eopFileName.c_str( ) );
+
+    boost::shared_ptr< EarthRotationalEphemeris > cachedEarthRotationalEphemeris =
+            boost::make_shared< EarthRotationalEphemeris >( earthOrientationParameters, 1800.0 );
+
+    // Create a different sequence of times for each thread (forward and backward, with different step sizes).
+    const int numberOfThreads = 4;
+    const double startTime = earthOrientationParameters->getStartTime( ) + 100.0;
+    const double endTime = earthOrientationParameters->getEndTime( ) - 100.0;
+    std::vector< std::vector< double > > testTimes( numberOfThreads );
+    for( int i = 0; i < numberOfThreads; i++ )
+    {
+        const double timeStep = 317.3 * static_cast< double >( i + 1 );
+        for( double time = 0.0; time < endTime - startTime; time += timeStep )
+        {
+            testTimes[ i ].push_back( ( i % 2 == 0 ) ? ( startTime + time ) : ( endTime - time ) );
+        }
+    }
+
+    // Compute reference rotations serially.
+    std::vector< std::vector< Eigen::Matrix3d > > expectedRotations( numberOfThreads );
+    for( int i = 0; i < numberOfThreads; i++ )
+    {
+        computeEarthRotationsAtTimes( cachedEarthRotationalEphemeris, &testTimes[ i ], &expectedRotations[ i ] );
+    }
+
+    // Compute rotations concurrently.
+    std::vector< std::vector< Eigen::Matrix3d > > computedRotations( numberOfThreads );
+    std::vector< std::thread > threads;
+    for( int i = 0; i < numberOfThreads; i++ )
+    {
+        threads.push_back( std::thread( &computeEarthRotationsAtTimes, cachedEarthRotationalEphemeris,
+                                        &testTimes[ i ], &computedRotations[ i ] ) );
+    }
+    for( int i = 0; i < numberOfThreads; i++ )
+    {
+        threads[ i ].join( );
+    }
+
+    for( int i = 0; i < numberOfThreads; i++ )
+    {
+        for( unsigned int j = 0; j < testTimes[ i ].size( ); j++ )
+        {
+            BOOST_CHECK_SMALL( ( computedRotations[ i ][ j ] - expectedRotations[ i ][ j ] ).norm( ), 1.0E-15 );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -146,6 +146,88 @@ BOOST_AUTO_TEST_CASE( test_FrameManager )
 
 }
 
+BOOST_AUTO_TEST_CASE( test_FrameManagerTranslationChains )
+{
+    // Create hierarchy of constant ephemerides.
+    std::map< std::string, boost::shared_ptr< Ephemeris > > ephemerisList;
+    std::map< std::string, basic_mathematics::Vector6d > ephemerisStates;
+    std::map< std::string, std::string > ephemerisOrigins;
+    ephemerisOrigins[ "Sun" ] = getBaseFrameName( );
+    ephemerisOrigins[ "Earth" ] = "Sun";
+    ephemerisOrigins[ "Moon" ] = "Earth";
+    ephemerisOrigins[ "LRO" ] = "Moon";
+    ephemerisOrigins[ "LAGEOS" ] = "Earth";
+    ephemerisOrigins[ "Mars" ] = "Sun";
+    ephemerisOrigins[ "Phobos" ] = "Mars";
+
+    int counter = 1;
+    for( std::map< std::string, std::string >::iterator originIterator = ephemerisOrigins.begin( );
+         originIterator != ephemerisOrigins.end( ); originIterator++ )
+    {
+        ephemerisStates[ originIterator->first ] =
+                basic_mathematics::Vector6d::Constant( static_cast< double >( counter ) * 1.0E6 );
+        ephemerisStates[ originIterator->first ]( counter % 6 ) *= -3.0;
+        ephemerisList[ originIterator->first ] = boost::make_shared< ConstantEphemeris >(
+                    ephemerisStates[ originIterator->first ], originIterator->second, "ECLIPJ2000" );
+        counter++;
+    }
+
+    boost::shared_ptr< ReferenceFrameManager > frameManager =
+            boost::make_shared< ReferenceFrameManager >( ephemerisList );
+
+    // Check that translation chains are cached.
+    BOOST_CHECK_EQUAL( frameManager->getFrameTranslationChain( "Moon", "Phobos" ),
+                       frameManager->getFrameTranslationChain( "Moon", "Phobos" ) );
+    BOOST_CHECK_EQUAL( frameManager->getFrameTranslationChain( "Moon", "Phobos" )->getNumberOfEphemerides( ), 4 );
+    BOOST_CHECK_EQUAL( frameManager->getFrameTranslationChain( "Earth", "LRO" )->getNumberOfEphemerides( ), 2 );
+
+    // Compare batched relative states with states from single ephemerides and expected states.
+    std::vector< std::string > origins, bodies;
+    origins.push_back( "Moon" );
+    bodies.push_back( "Phobos" );
+    origins.push_back( "Sun" );
+    bodies.push_back( "LRO" );
+    origins.push_back( "LAGEOS" );
+    bodies.push_back( getBaseFrameName( ) );
+    origins.push_back( "Earth" );
+    bodies.push_back( "Earth" );
+    origins.push_back( "LRO" );
+    bodies.push_back( "Moon" );
+
+    std::vector< basic_mathematics::Vector6d > expectedStates;
+    expectedStates.push_back( ephemerisStates[ "Mars" ] + ephemerisStates[ "Phobos" ] -
+                              ephemerisStates[ "Earth" ] - ephemerisStates[ "Moon" ] );
+    expectedStates.push_back( ephemerisStates[ "Earth" ] + ephemerisStates[ "Moon" ] + ephemerisStates[ "LRO" ] );
+    expectedStates.push_back( -ephemerisStates[ "Sun" ] - ephemerisStates[ "Earth" ] - ephemerisStates[ "LAGEOS" ] );
+    expectedStates.push_back( basic_mathematics::Vector6d::Zero( ) );
+    expectedStates.push_back( -ephemerisStates[ "LRO" ] );
+
+    std::vector< basic_mathematics::Vector6d > relativeStates =
+            frameManager->getRelativeStates( origins, bodies, 0.0 );
+    for( unsigned int i = 0; i < origins.size( ); i++ )
+    {
+        basic_mathematics::Vector6d ephemerisState =
+                frameManager->getEphemeris( origins.at( i ), bodies.at( i ) )->getCartesianStateFromEphemeris( 0.0 );
+        for( unsigned int j = 0; j < 6; j++ )
+        {
+            BOOST_CHECK_SMALL( relativeStates.at( i )( j ) - expectedStates.at( i )( j ), 1.0E-6 );
+            BOOST_CHECK_SMALL( ephemerisState( j ) - expectedStates.at( i )( j ), 1.0E-6 );
+        }
+    }
+
+    // Check that unknown frames are rejected.
+    bool isExceptionCaught = false;
+    try
+    {
+        frameManager->getFrameTranslationChain( "Moon", "Venus" );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
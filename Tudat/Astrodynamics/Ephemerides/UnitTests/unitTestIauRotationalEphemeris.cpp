@@ -0,0 +1,144 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/testMacros.h"
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/Ephemerides/iauRotationalEphemeris.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace ephemerides;
+
+BOOST_AUTO_TEST_SUITE( test_iau_rotational_ephemeris )
+
+// Test IAU rotation model by comparing results for Venus-fixed frame with Spice (pck00010.tpc, see
+// unitTestSimpleRotationalEphemeris).
+BOOST_AUTO_TEST_CASE( testIauRotationalEphemerisAgainstSpice )
+{
+    boost::shared_ptr< IauRotationalEphemeris > venusRotationalEphemeris = createIauRotationalEphemeris( "Venus" );
+    BOOST_CHECK_EQUAL( venusRotationalEphemeris->getBaseFrameOrientation( ), "J2000" );
+    BOOST_CHECK_EQUAL( venusRotationalEphemeris->getTargetFrameOrientation( ), "IAU_Venus" );
+
+    // Check rotation at J2000.
+    Eigen::Matrix3d spiceRotationMatrix;
+    spiceRotationMatrix << -0.9548214974296336, 0.2665104385944917, 0.1314841974018291,
+            -0.296591573568662, -0.882413772579987, -0.3652114078848295,
+            0.01869081416890202, -0.3877088083617989, 0.9215923900425705;
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                Eigen::Matrix3d( venusRotationalEphemeris->getRotationToTargetFrame( 0.0 ) ),
+                spiceRotationMatrix, 1.0E-15 );
+
+    // Check rotation and its time derivative at later time.
+    const double secondsSinceJ2000 = 1.0E6;
+    spiceRotationMatrix << -0.8249537745726603, 0.5148010526833556, 0.2333048348715243,
+            -0.5648910720519699, -0.7646317780963481, -0.3102197940834743,
+            0.01869081416890206, -0.3877088083617987, 0.9215923900425707;
+    Eigen::Matrix3d spiceRotationMatrixDerivative;
+    spiceRotationMatrixDerivative << 1.690407961416589e-07, 2.288121921543265e-07, 9.283170431475241e-08,
+            -2.468632444964533e-07, 1.540516111965609e-07, 6.981529179974795e-08,
+            0.0, 0.0, 0.0;
+
+    const Eigen::Matrix3d ephemerisRotation =
+            Eigen::Matrix3d( venusRotationalEphemeris->getRotationToTargetFrame( secondsSinceJ2000 ) );
+    const Eigen::Matrix3d ephemerisRotationDerivative =
+            venusRotationalEphemeris->getDerivativeOfRotationToTargetFrame( secondsSinceJ2000 );
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_SMALL( ephemerisRotation( i, j ) - spiceRotationMatrix( i, j ), 2.0E-15 );
+            BOOST_CHECK_SMALL( ephemerisRotationDerivative( i, j ) - spiceRotationMatrixDerivative( i, j ), 2.0E-22 );
+        }
+    }
+}
+
+// Test consistency of rotation, its time derivative and angular velocity for models with periodic terms and secular
+// pole motion.
+BOOST_AUTO_TEST_CASE( testIauRotationalEphemerisDerivatives )
+{
+    std::vector< std::string > bodiesToTest;
+    bodiesToTest.push_back( "Earth" );
+    bodiesToTest.push_back( "Moon" );
+    bodiesToTest.push_back( "Mercury" );
+    bodiesToTest.push_back( "Jupiter" );
+    bodiesToTest.push_back( "Neptune" );
+
+    for( unsigned int i = 0; i < bodiesToTest.size( ); i++ )
+    {
+        boost::shared_ptr< IauRotationalEphemeris > rotationalEphemeris =
+                createIauRotationalEphemeris( bodiesToTest.at( i ), "ECLIPJ2000" );
+
+        for( int j = -3; j < 4; j++ )
+        {
+            const double testTime = static_cast< double >( j ) * 3.2E8 + 1.0E5;
+
+            // Compare combined evaluation with separate evaluations.
+            Eigen::Quaterniond rotationToTargetFrame;
+            Eigen::Matrix3d rotationToTargetFrameDerivative;
+            Eigen::Vector3d angularVelocityVectorInBaseFrame;
+            rotationalEphemeris->getFullRotationalQuantitiesToTargetFrame(
+                        rotationToTargetFrame, rotationToTargetFrameDerivative, angularVelocityVectorInBaseFrame,
+                        testTime );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                        Eigen::Matrix3d( rotationToTargetFrame ),
+                        Eigen::Matrix3d( rotationalEphemeris->getRotationToTargetFrame( testTime ) ),
+                        std::numeric_limits< double >::epsilon( ) );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                        rotationToTargetFrameDerivative,
+                        rotationalEphemeris->getDerivativeOfRotationToTargetFrame( testTime ),
+                        std::numeric_limits< double >::epsilon( ) );
+            const Eigen::Vector3d angularVelocityDifference =
+                    angularVelocityVectorInBaseFrame - getRotationalVelocityVectorInBaseFrameFromMatrices(
+                        Eigen::Matrix3d( rotationToTargetFrame ), rotationToTargetFrameDerivative.transpose( ) );
+            BOOST_CHECK_SMALL( angularVelocityDifference.norm( ) / angularVelocityVectorInBaseFrame.norm( ), 1.0E-14 );
+
+            // Compare time derivative of rotation matrix with central difference.
+            const double timeStep = 5.0;
+            const Eigen::Matrix3d numericalRotationDerivative =
+                    ( Eigen::Matrix3d( rotationalEphemeris->getRotationToTargetFrame( testTime + timeStep ) ) -
+                      Eigen::Matrix3d( rotationalEphemeris->getRotationToTargetFrame( testTime - timeStep ) ) ) /
+                    ( 2.0 * timeStep );
+            const double derivativeScale = rotationToTargetFrameDerivative.norm( );
+            for( unsigned int k = 0; k < 3; k++ )
+            {
+                for( unsigned int l = 0; l < 3; l++ )
+                {
+                    BOOST_CHECK_SMALL( ( numericalRotationDerivative( k, l ) -
+                                         rotationToTargetFrameDerivative( k, l ) ) / derivativeScale, 5.0E-7 );
+                }
+            }
+        }
+    }
+
+    // Check that unknown bodies and frames are rejected.
+    BOOST_CHECK_THROW( createIauRotationalEphemeris( "Pluto" ), std::runtime_error );
+    BOOST_CHECK_THROW( createIauRotationalEphemeris( "Earth", "GCRS" ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -0,0 +1,291 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/Ephemerides/jplBinaryEphemeris.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_jpl_binary_ephemeris )
+
+using namespace ephemerides;
+
+//! Test file with the structure of a JPL DE binary ephemeris file, but (arbitrary) artificial coefficients.
+class ArtificialJplEphemerisFile
+{
+public:
+
+    ArtificialJplEphemerisFile( const std::string& fileName ):
+        startJulianDay_( 2451536.5 ), recordSpan_( 16.0 ), numberOfRecords_( 3 ), earthMoonMassRatio_( 81.3 )
+    {
+        // Set item pointers: 4 coefficients for bodies (2 subintervals for Moon), large libration item to ensure that
+        // header fits in first record (as is the case in actual files).
+        int currentOffset = 3;
+        for( unsigned int i = 0; i < 13; i++ )
+        {
+            itemPointers_[ i ][ 0 ] = currentOffset;
+            itemPointers_[ i ][ 1 ] = ( i == 12 ) ? 130 : ( ( i == 11 ) ? 3 : 4 );
+            itemPointers_[ i ][ 2 ] = ( i == 9 ) ? 2 : 1;
+            currentOffset += itemPointers_[ i ][ 1 ] * itemPointers_[ i ][ 2 ] * ( ( i == 11 ) ? 2 : 3 );
+        }
+        recordLength_ = currentOffset - 1;
+
+        // Create header record.
+        std::vector< char > headerRecord( recordLength_ * sizeof( double ), 0 );
+        std::memset( &headerRecord[ 0 ], ' ', 2652 );
+        std::memcpy( &headerRecord[ 252 ], "AU    EMRAT DENUM ", 18 );
+        double ephemerisInterval[ 3 ] =
+        { startJulianDay_, startJulianDay_ + numberOfRecords_ * recordSpan_, recordSpan_ };
+        std::memcpy( &headerRecord[ 2652 ], ephemerisInterval, sizeof( ephemerisInterval ) );
+        boost::int32_t numberOfConstants = 3, deNumber = 999;
+        double astronomicalUnit = 149597870.7;
+        std::memcpy( &headerRecord[ 2676 ], &numberOfConstants, sizeof( boost::int32_t ) );
+        std::memcpy( &headerRecord[ 2680 ], &astronomicalUnit, sizeof( double ) );
+        std::memcpy( &headerRecord[ 2688 ], &earthMoonMassRatio_, sizeof( double ) );
+        std::memcpy( &headerRecord[ 2696 ], itemPointers_, 36 * sizeof( boost::int32_t ) );
+        std::memcpy( &headerRecord[ 2840 ], &deNumber, sizeof( boost::int32_t ) );
+        std::memcpy( &headerRecord[ 2844 ], itemPointers_[ 12 ], 3 * sizeof( boost::int32_t ) );
+
+        // Create constants record.
+        std::vector< double > constantsRecord( recordLength_, 0.0 );
+        constantsRecord[ 0 ] = astronomicalUnit;
+        constantsRecord[ 1 ] = earthMoonMassRatio_;
+        constantsRecord[ 2 ] = deNumber;
+
+        // Create coefficient records.
+        coefficientRecords_.resize( numberOfRecords_ );
+        for( int i = 0; i < numberOfRecords_; i++ )
+        {
+            coefficientRecords_[ i ].resize( recordLength_ );
+            coefficientRecords_[ i ][ 0 ] = startJulianDay_ + i * recordSpan_;
+            coefficientRecords_[ i ][ 1 ] = startJulianDay_ + ( i + 1 ) * recordSpan_;
+            for( int j = 2; j < recordLength_; j++ )
+            {
+                coefficientRecords_[ i ][ j ] = 1.0E8 * std::sin( 1.0 + 7.0 * i + 0.37 * j ) / ( j * j );
+            }
+        }
+
+        std::ofstream fileStream( fileName.c_str( ), std::ios::out | std::ios::binary | std::ios::trunc );
+        fileStream.write( &headerRecord[ 0 ], headerRecord.size( ) );
+        fileStream.write( reinterpret_cast< const char* >( &constantsRecord[ 0 ] ), recordLength_ * sizeof( double ) );
+        for( int i = 0; i < numberOfRecords_; i++ )
+        {
+            fileStream.write( reinterpret_cast< const char* >( &coefficientRecords_[ i ][ 0 ] ),
+                              recordLength_ * sizeof( double ) );
+        }
+    }
+
+    //! Function to compute position (in m) of a data item, using explicit Chebyshev polynomials.
+    Eigen::Vector3d getItemPosition( const int itemIndex, const double secondsSinceJ2000 )
+    {
+        const double daysSinceStart = ( basic_astrodynamics::JULIAN_DAY_ON_J2000 - startJulianDay_ ) +
+                secondsSinceJ2000 / physical_constants::JULIAN_DAY;
+        const int recordIndex = static_cast< int >( daysSinceStart / recordSpan_ );
+        const double recordFraction = ( daysSinceStart - recordIndex * recordSpan_ ) / recordSpan_;
+        const int numberOfSubintervals = itemPointers_[ itemIndex ][ 2 ];
+        const int numberOfCoefficients = itemPointers_[ itemIndex ][ 1 ];
+        const int subintervalIndex = static_cast< int >( recordFraction * numberOfSubintervals );
+        const double scaledTime = 2.0 * ( recordFraction * numberOfSubintervals - subintervalIndex ) - 1.0;
+
+        Eigen::Vector3d position = Eigen::Vector3d::Zero( );
+        for( int j = 0; j < 3; j++ )
+        {
+            for( int k = 0; k < numberOfCoefficients; k++ )
+            {
+                position( j ) += coefficientRecords_[ recordIndex ][
+                        itemPointers_[ itemIndex ][ 0 ] - 1 + ( subintervalIndex * 3 + j ) * numberOfCoefficients + k ] *
+                        std::cos( k * std::acos( scaledTime ) );
+            }
+        }
+        return 1.0E3 * position;
+    }
+
+    double startJulianDay_;
+
+    double recordSpan_;
+
+    int numberOfRecords_;
+
+    double earthMoonMassRatio_;
+
+    boost::int32_t itemPointers_[ 13 ][ 3 ];
+
+    int recordLength_;
+
+    std::vector< std::vector< double > > coefficientRecords_;
+};
+
+//! Test reading and evaluating JPL DE binary ephemeris file.
+BOOST_AUTO_TEST_CASE( testJplBinaryEphemeris )
+{
+    const std::string fileName = ( boost::filesystem::temp_directory_path( ) /
+                                   boost::filesystem::unique_path( "tudatJplEphemeris%%%%%%%%.bin" ) ).string( );
+    ArtificialJplEphemerisFile artificialFile( fileName );
+
+    {
+        JplBinaryEphemerisFilePointer ephemerisFile = boost::make_shared< JplBinaryEphemerisFile >( fileName );
+
+        // Check header data.
+        BOOST_CHECK_EQUAL( ephemerisFile->getDeNumber( ), 999 );
+        BOOST_CHECK_EQUAL( ephemerisFile->getEarthMoonMassRatio( ), 81.3 );
+        BOOST_CHECK_EQUAL( ephemerisFile->getConstants( )[ "EMRAT" ], 81.3 );
+        BOOST_CHECK_EQUAL( ephemerisFile->getConstants( )[ "AU" ], 149597870.7 );
+        BOOST_CHECK_CLOSE_FRACTION( ephemerisFile->getStartTime( ), -8.5 * physical_constants::JULIAN_DAY,
+                                    std::numeric_limits< double >::epsilon( ) );
+        BOOST_CHECK_CLOSE_FRACTION( ephemerisFile->getEndTime( ), 39.5 * physical_constants::JULIAN_DAY,
+                                    std::numeric_limits< double >::epsilon( ) );
+
+        JplBinaryEphemeris venusEphemeris( ephemerisFile, "Venus", "SSB", "J2000" );
+        JplBinaryEphemeris sunEphemeris( ephemerisFile, "Sun", "SSB", "J2000" );
+        JplBinaryEphemeris earthEphemeris( ephemerisFile, "Earth", "SSB", "J2000" );
+        JplBinaryEphemeris moonEphemeris( ephemerisFile, "Moon", "SSB", "J2000" );
+        JplBinaryEphemeris geocentricMoonEphemeris( ephemerisFile, "Moon", "Earth", "J2000" );
+        JplBinaryEphemeris heliocentricEmbEphemeris( ephemerisFile, "Earth-Moon Barycenter", "Sun", "J2000" );
+        JplBinaryEphemeris eclipticVenusEphemeris( ephemerisFile, "Venus", "SSB", "ECLIPJ2000" );
+
+        for( int i = 0; i < 200; i++ )
+        {
+            const double testTime = ( -8.4 + 0.2393 * i ) * physical_constants::JULIAN_DAY;
+
+            // Compare positions of data items with explicit evaluation of Chebyshev polynomials.
+            basic_mathematics::Vector6d venusState = venusEphemeris.getCartesianStateFromEphemeris( testTime );
+            Eigen::Vector3d expectedVenusPosition = artificialFile.getItemPosition( jpl_venus, testTime );
+            Eigen::Vector3d expectedMoonPosition = artificialFile.getItemPosition( jpl_moon, testTime );
+            Eigen::Vector3d expectedHeliocentricEmbPosition =
+                    artificialFile.getItemPosition( jpl_earth_moon_barycenter, testTime ) -
+                    artificialFile.getItemPosition( jpl_sun, testTime );
+            for( unsigned int j = 0; j < 3; j++ )
+            {
+                BOOST_CHECK_CLOSE_FRACTION( venusState( j ), expectedVenusPosition( j ), 1.0E-12 );
+                BOOST_CHECK_CLOSE_FRACTION( geocentricMoonEphemeris.getCartesianStateFromEphemeris( testTime )( j ),
+                                            expectedMoonPosition( j ), 1.0E-12 );
+                BOOST_CHECK_CLOSE_FRACTION( heliocentricEmbEphemeris.getCartesianStateFromEphemeris( testTime )( j ),
+                                            expectedHeliocentricEmbPosition( j ), 1.0E-12 );
+            }
+
+            // Check consistency of Earth, Moon and Earth-Moon barycenter states.
+            basic_mathematics::Vector6d earthState = earthEphemeris.getCartesianStateFromEphemeris( testTime );
+            basic_mathematics::Vector6d moonState = moonEphemeris.getCartesianStateFromEphemeris( testTime );
+            basic_mathematics::Vector6d embState =
+                    heliocentricEmbEphemeris.getCartesianStateFromEphemeris( testTime ) +
+                    sunEphemeris.getCartesianStateFromEphemeris( testTime );
+            basic_mathematics::Vector6d computedEmbState =
+                    ( artificialFile.earthMoonMassRatio_ * earthState + moonState ) /
+                    ( 1.0 + artificialFile.earthMoonMassRatio_ );
+            basic_mathematics::Vector6d geocentricMoonState =
+                    geocentricMoonEphemeris.getCartesianStateFromEphemeris( testTime );
+            for( unsigned int j = 0; j < 6; j++ )
+            {
+                BOOST_CHECK_SMALL( computedEmbState( j ) - embState( j ), 1.0E-12 * embState.segment(
+                                       ( j / 3 ) * 3, 3 ).norm( ) );
+                BOOST_CHECK_SMALL( moonState( j ) - earthState( j ) - geocentricMoonState( j ),
+                                   1.0E-12 * moonState.segment( ( j / 3 ) * 3, 3 ).norm( ) );
+            }
+
+            // Compare velocity with numerical derivative of position.
+            const double timeStep = 10.0;
+            Eigen::Vector3d numericalVelocity =
+                    ( venusEphemeris.getCartesianStateFromEphemeris( testTime + timeStep ).segment( 0, 3 ) -
+                      venusEphemeris.getCartesianStateFromEphemeris( testTime - timeStep ).segment( 0, 3 ) ) /
+                    ( 2.0 * timeStep );
+            if( std::floor( ( testTime + timeStep ) / ( 16.0 * physical_constants::JULIAN_DAY ) + 8.5 / 16.0 ) ==
+                    std::floor( ( testTime - timeStep ) / ( 16.0 * physical_constants::JULIAN_DAY ) + 8.5 / 16.0 ) )
+            {
+                BOOST_CHECK_SMALL( ( numericalVelocity - venusState.segment( 3, 3 ) ).norm( ),
+                                   1.0E-6 * venusState.segment( 3, 3 ).norm( ) );
+            }
+
+            // Check rotation to ecliptic frame.
+            basic_mathematics::Vector6d eclipticVenusState =
+                    eclipticVenusEphemeris.getCartesianStateFromEphemeris( testTime );
+            const double obliquity = 84381.448 / 3600.0 * mathematical_constants::PI / 180.0;
+            BOOST_CHECK_CLOSE_FRACTION( eclipticVenusState( 0 ), venusState( 0 ), 1.0E-14 );
+            BOOST_CHECK_CLOSE_FRACTION(
+                        eclipticVenusState( 2 ), -std::sin( obliquity ) * venusState( 1 ) +
+                        std::cos( obliquity ) * venusState( 2 ), 1.0E-12 );
+            BOOST_CHECK_CLOSE_FRACTION(
+                        eclipticVenusState( 4 ), std::cos( obliquity ) * venusState( 4 ) +
+                        std::sin( obliquity ) * venusState( 5 ), 1.0E-12 );
+        }
+
+        // Check that times outside of file, and unavailable bodies and frames, are rejected.
+        bool isExceptionCaught = false;
+        try
+        {
+            venusEphemeris.getCartesianStateFromEphemeris( 40.0 * physical_constants::JULIAN_DAY );
+        }
+        catch( const std::runtime_error& )
+        {
+            isExceptionCaught = true;
+        }
+        BOOST_CHECK( isExceptionCaught );
+
+        isExceptionCaught = false;
+        try
+        {
+            JplBinaryEphemeris phobosEphemeris( ephemerisFile, "Phobos" );
+        }
+        catch( const std::runtime_error& )
+        {
+            isExceptionCaught = true;
+        }
+        BOOST_CHECK( isExceptionCaught );
+
+        isExceptionCaught = false;
+        try
+        {
+            JplBinaryEphemeris earthFixedEphemeris( ephemerisFile, "Moon", "Earth", "IAU_Earth" );
+        }
+        catch( const std::runtime_error& )
+        {
+            isExceptionCaught = true;
+        }
+        BOOST_CHECK( isExceptionCaught );
+    }
+
+    // Check that truncated file is rejected.
+    boost::filesystem::resize_file( fileName, 2 * artificialFile.recordLength_ * sizeof( double ) + 16 );
+    bool isExceptionCaught = false;
+    try
+    {
+        JplBinaryEphemerisFile truncatedFile( fileName );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+
+    boost::filesystem::remove( fileName );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -0,0 +1,179 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <stdexcept>
+
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/convertMeanToEccentricAnomalies.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/keplerPropagator.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
+#include "Tudat/Astrodynamics/Ephemerides/keplerCatalogPropagator.h"
+#include "Tudat/Mathematics/BasicMathematics/linearAlgebraTypes.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace orbital_element_conversions;
+
+//! Function to generate a catalog of random Earth orbits (perigee altitude above 200 km).
+Eigen::Array< double, Eigen::Dynamic, 6 > getRandomEarthOrbitCatalog( const int numberOfObjects )
+{
+    boost::random::mt19937 randomNumberGenerator( 42 );
+    boost::random::uniform_real_distribution< double > uniformDistribution( 0.0, 1.0 );
+
+    Eigen::Array< double, Eigen::Dynamic, 6 > keplerianElements( numberOfObjects, 6 );
+    for( int i = 0; i < numberOfObjects; i++ )
+    {
+        const double eccentricity = 0.9 * uniformDistribution( randomNumberGenerator );
+        keplerianElements( i, semiMajorAxisIndex ) =
+                ( 6578.0E3 + 4.0E7 * uniformDistribution( randomNumberGenerator ) ) / ( 1.0 - eccentricity );
+        keplerianElements( i, eccentricityIndex ) = eccentricity;
+        keplerianElements( i, inclinationIndex ) = mathematical_constants::PI *
+                uniformDistribution( randomNumberGenerator );
+        for( int j = 3; j < 6; j++ )
+        {
+            keplerianElements( i, j ) = 2.0 * mathematical_constants::PI *
+                    uniformDistribution( randomNumberGenerator ) - mathematical_constants::PI;
+        }
+    }
+    return keplerianElements;
+}
+
+BOOST_AUTO_TEST_SUITE( test_kepler_catalog_propagator )
+
+// Test Kepler propagation of catalog against scalar propagation of each object.
+BOOST_AUTO_TEST_CASE( testKeplerCatalogPropagatorAgainstKeplerPropagator )
+{
+    const double earthGravitationalParameter = 398600.4415E9;
+    const double referenceEpoch = 1.0E8;
+    const int numberOfObjects = 2000;
+    const Eigen::Array< double, Eigen::Dynamic, 6 > keplerianElements = getRandomEarthOrbitCatalog( numberOfObjects );
+
+    ephemerides::KeplerCatalogPropagator catalogPropagator(
+                keplerianElements, referenceEpoch, earthGravitationalParameter, 0.0, 0.0, 3 );
+    BOOST_CHECK_EQUAL( catalogPropagator.getNumberOfObjects( ), numberOfObjects );
+
+    const double testTimes[ 3 ] = { referenceEpoch, referenceEpoch - 12345.6, referenceEpoch + 8.64E5 };
+    Eigen::Matrix< double, 6, Eigen::Dynamic > cartesianStates;
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        catalogPropagator.getCartesianStates( testTimes[ i ], cartesianStates );
+        BOOST_CHECK_EQUAL( cartesianStates.cols( ), numberOfObjects );
+
+        for( int j = 0; j < numberOfObjects; j++ )
+        {
+            const basic_mathematics::Vector6d expectedCartesianState = convertKeplerianToCartesianElements(
+                        propagateKeplerOrbit( basic_mathematics::Vector6d( keplerianElements.row( j ).transpose( ) ),
+                                              testTimes[ i ] - referenceEpoch, earthGravitationalParameter ),
+                        earthGravitationalParameter );
+            BOOST_CHECK_SMALL( ( cartesianStates.block( 0, j, 3, 1 ) - expectedCartesianState.segment( 0, 3 ) ).norm( ) /
+                               expectedCartesianState.segment( 0, 3 ).norm( ), 1.0E-12 );
+            BOOST_CHECK_SMALL( ( cartesianStates.block( 3, j, 3, 1 ) - expectedCartesianState.segment( 3, 3 ) ).norm( ) /
+                               expectedCartesianState.segment( 3, 3 ).norm( ), 1.0E-12 );
+        }
+    }
+
+    // Check that results are independent of number of threads.
+    const Eigen::Matrix< double, 6, Eigen::Dynamic > singleThreadCartesianStates =
+            ephemerides::KeplerCatalogPropagator(
+                keplerianElements, referenceEpoch, earthGravitationalParameter, 0.0, 0.0, 1 ).getCartesianStates(
+                testTimes[ 2 ] );
+    BOOST_CHECK_EQUAL( ( singleThreadCartesianStates - cartesianStates ).cwiseAbs( ).maxCoeff( ), 0.0 );
+
+    // Check that non-elliptical orbits are rejected.
+    Eigen::Array< double, Eigen::Dynamic, 6 > invalidKeplerianElements = keplerianElements;
+    invalidKeplerianElements( 10, eccentricityIndex ) = 1.2;
+    BOOST_CHECK_THROW( ephemerides::KeplerCatalogPropagator(
+                           invalidKeplerianElements, referenceEpoch, earthGravitationalParameter ),
+                       std::runtime_error );
+}
+
+// Test secular J2 drift of catalog orbits.
+BOOST_AUTO_TEST_CASE( testKeplerCatalogPropagatorWithSecularJ2Drift )
+{
+    const double earthGravitationalParameter = 398600.4415E9;
+    const double earthJ2 = 1.0826E-3;
+    const double earthEquatorialRadius = 6378.137E3;
+    const double referenceEpoch = 0.0;
+    const int numberOfObjects = 1500;
+    const Eigen::Array< double, Eigen::Dynamic, 6 > keplerianElements = getRandomEarthOrbitCatalog( numberOfObjects );
+
+    ephemerides::KeplerCatalogPropagator catalogPropagator(
+                keplerianElements, referenceEpoch, earthGravitationalParameter, earthJ2, earthEquatorialRadius );
+
+    // Check nodal regression of a sun-synchronous orbit (roughly 360 degrees per year).
+    Eigen::Array< double, Eigen::Dynamic, 6 > sunSynchronousElements( 1, 6 );
+    sunSynchronousElements << 7078.137E3, 0.0, 98.19 * mathematical_constants::PI / 180.0, 0.0, 0.0, 0.0;
+    BOOST_CHECK_CLOSE_FRACTION(
+                ephemerides::KeplerCatalogPropagator(
+                    sunSynchronousElements, referenceEpoch, earthGravitationalParameter, earthJ2,
+                    earthEquatorialRadius ).getAscendingNodeRates( )( 0 ),
+                2.0 * mathematical_constants::PI / ( 365.2422 * 86400.0 ), 2.0E-3 );
+
+    // Compare with scalar evaluation of drifted elements.
+    const double propagationTime = 3.0 * 86400.0;
+    const Eigen::Matrix< double, 6, Eigen::Dynamic > cartesianStates =
+            catalogPropagator.getCartesianStates( referenceEpoch + propagationTime );
+    for( int j = 0; j < numberOfObjects; j++ )
+    {
+        const double semiMajorAxis = keplerianElements( j, semiMajorAxisIndex );
+        const double eccentricity = keplerianElements( j, eccentricityIndex );
+        const double cosineOfInclination = std::cos( keplerianElements( j, inclinationIndex ) );
+        const double meanMotion = std::sqrt( earthGravitationalParameter / std::pow( semiMajorAxis, 3.0 ) );
+        const double j2Factor = 1.5 * meanMotion * earthJ2 * std::pow(
+                    earthEquatorialRadius / ( semiMajorAxis * ( 1.0 - eccentricity * eccentricity ) ), 2.0 );
+
+        const double initialMeanAnomaly = convertEllipticalEccentricAnomalyToMeanAnomaly(
+                    convertTrueAnomalyToEllipticalEccentricAnomaly(
+                        keplerianElements( j, trueAnomalyIndex ), eccentricity ), eccentricity );
+        const double meanAnomaly = initialMeanAnomaly + propagationTime * (
+                    meanMotion + 0.5 * j2Factor * std::sqrt( 1.0 - eccentricity * eccentricity ) *
+                    ( 3.0 * cosineOfInclination * cosineOfInclination - 1.0 ) );
+
+        basic_mathematics::Vector6d driftedKeplerianElements = keplerianElements.row( j ).transpose( );
+        driftedKeplerianElements( argumentOfPeriapsisIndex ) += propagationTime * 0.5 * j2Factor *
+                ( 5.0 * cosineOfInclination * cosineOfInclination - 1.0 );
+        driftedKeplerianElements( longitudeOfAscendingNodeIndex ) -=
+                propagationTime * j2Factor * cosineOfInclination;
+        driftedKeplerianElements( trueAnomalyIndex ) = convertEllipticalEccentricAnomalyToTrueAnomaly(
+                    convertMeanAnomalyToEccentricAnomaly( eccentricity, std::fmod(
+                                                              meanAnomaly, 2.0 * mathematical_constants::PI ) ),
+                    eccentricity );
+
+        const basic_mathematics::Vector6d expectedCartesianState = convertKeplerianToCartesianElements(
+                    driftedKeplerianElements, earthGravitationalParameter );
+        BOOST_CHECK_SMALL( ( cartesianStates.block( 0, j, 3, 1 ) - expectedCartesianState.segment( 0, 3 ) ).norm( ) /
+                           expectedCartesianState.segment( 0, 3 ).norm( ), 1.0E-11 );
+        BOOST_CHECK_SMALL( ( cartesianStates.block( 3, j, 3, 1 ) - expectedCartesianState.segment( 3, 3 ) ).norm( ) /
+                           expectedCartesianState.segment( 3, 3 ).norm( ), 1.0E-11 );
+    }
+
+    // Check that J2 without equatorial radius is rejected.
+    BOOST_CHECK_THROW( ephemerides::KeplerCatalogPropagator(
+                           keplerianElements, referenceEpoch, earthGravitationalParameter, earthJ2 ),
+                       std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -17,6 +17,8 @@
 #include <boost/test/floating_point_comparison.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <boost/make_shared.hpp>
+
 #include <Eigen/Core>
 
 #include <Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h>
@@ -104,6 +106,39 @@ BOOST_AUTO_TEST_CASE( testKeplerEphemerisHyperbolic )
     }
 }
 
+//! Test 3: Comparison of KeplerEphemeris states at a list of epochs with single-epoch states.
+BOOST_AUTO_TEST_CASE( testKeplerEphemerisMultipleEpochs )
+{
+    // Create elliptical and hyperbolic ephemerides.
+    std::vector< boost::shared_ptr< ephemerides::KeplerEphemeris > > keplerEphemerides;
+    keplerEphemerides.push_back( boost::make_shared< ephemerides::KeplerEphemeris >(
+                                     getODTBXBenchmarkData( )[ 0.0 ], 0.0, 398600.4415e9 ) );
+    keplerEphemerides.push_back( boost::make_shared< ephemerides::KeplerEphemeris >(
+                                     getGTOPBenchmarkData( )[ 0.0 ], 0.0, getGTOPGravitationalParameter( ) ) );
+
+    // Set (unsorted) epochs at which states are to be computed.
+    std::vector< double > epochs;
+    for( unsigned int i = 0; i < 100; i++ )
+    {
+        epochs.push_back( -1.0E5 + static_cast< double >( ( i * 37 ) % 100 ) * 1234.5 );
+    }
+
+    for( unsigned int i = 0; i < keplerEphemerides.size( ); i++ )
+    {
+        Eigen::Matrix< double, 6, Eigen::Dynamic > states;
+        keplerEphemerides.at( i )->getCartesianStatesFromEphemeris( epochs, states );
+        BOOST_CHECK_EQUAL( states.cols( ), static_cast< int >( epochs.size( ) ) );
+
+        for( unsigned int j = 0; j < epochs.size( ); j++ )
+        {
+            basic_mathematics::Vector6d singleEpochState =
+                    keplerEphemerides.at( i )->getCartesianStateFromEphemeris( epochs.at( j ) );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                        singleEpochState, basic_mathematics::Vector6d( states.col( j ) ), 1.0E-12 );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
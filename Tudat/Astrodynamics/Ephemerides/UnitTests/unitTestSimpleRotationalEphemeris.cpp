@@ -344,6 +344,48 @@ BOOST_AUTO_TEST_CASE( testSimpleRotationalEphemeris )
     }
 }
 
+// Test combined computation of rotation, its time derivative and angular velocity vector.
+BOOST_AUTO_TEST_CASE( testSimpleRotationalEphemerisFullRotationalState )
+{
+    SimpleRotationalEphemeris venusRotationalEphemeris(
+                convertDegreesToRadians( 272.76 ), convertDegreesToRadians( 67.16 ),
+                convertDegreesToRadians( 160.20 ),
+                convertDegreesToRadians( -1.4813688 ) / physical_constants::JULIAN_DAY,
+                0.0, JULIAN_DAY_ON_J2000, "J2000", "IAU_VENUS" );
+
+    Eigen::Quaterniond rotationToTargetFrame;
+    Eigen::Matrix3d rotationToTargetFrameDerivative;
+    Eigen::Vector3d angularVelocityVectorInBaseFrame;
+    for( int i = -5; i < 5; i++ )
+    {
+        const double testTime = static_cast< double >( i ) * 1.234E7;
+        venusRotationalEphemeris.getFullRotationalQuantitiesToTargetFrame(
+                    rotationToTargetFrame, rotationToTargetFrameDerivative, angularVelocityVectorInBaseFrame,
+                    testTime );
+
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    Eigen::Matrix3d( rotationToTargetFrame ),
+                    Eigen::Matrix3d( venusRotationalEphemeris.getRotationToTargetFrame(
+                                         testTime, JULIAN_DAY_ON_J2000 ) ),
+                    std::numeric_limits< double >::epsilon( ) );
+        const Eigen::Matrix3d rotationToTargetFrameDerivativeDifference =
+                rotationToTargetFrameDerivative -
+                venusRotationalEphemeris.getDerivativeOfRotationToTargetFrame( testTime );
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            for( unsigned int k = 0; k < 3; k++ )
+            {
+                BOOST_CHECK_SMALL( rotationToTargetFrameDerivativeDifference( j, k ), 1.0E-21 );
+            }
+        }
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    angularVelocityVectorInBaseFrame,
+                    ephemerides::getRotationalVelocityVectorInBaseFrameFromMatrices(
+                        Eigen::Matrix3d( rotationToTargetFrame ), rotationToTargetFrameDerivative.transpose( ) ),
+                    1.0E-14 );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
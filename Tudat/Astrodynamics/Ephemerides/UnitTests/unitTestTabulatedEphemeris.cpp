@@ -33,15 +33,20 @@
 
 #define BOOST_TEST_MAIN
 
+#include <algorithm>
+#include <limits>
+
 #include <boost/test/floating_point_comparison.hpp>
 #include <boost/test/unit_test.hpp>
 
 #include "Tudat/Basics/testMacros.h"
 
 #include "Tudat/Astrodynamics/Ephemerides/approximatePlanetPositions.h"
+#include "Tudat/Astrodynamics/Ephemerides/columnarStateHistory.h"
 #include "Tudat/Astrodynamics/Ephemerides/tabulatedEphemeris.h"
 #include "Tudat/Mathematics/BasicMathematics/linearAlgebraTypes.h"
 #include "Tudat/Mathematics/Interpolators/cubicSplineInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
 
 namespace tudat
 {
@@ -173,7 +178,129 @@ BOOST_AUTO_TEST_CASE( testTabulatedEphemeris )
     // Check whether getting of interpolator is correct
     BOOST_CHECK_EQUAL( tabulatedEphemeris->getInterpolator( ), jupiterStateInterpolator );
 
+    // Check states at list of (sorted and unsorted) epochs against single-epoch states.
+    std::vector< double > sortedEpochs;
+    for( unsigned int i = 0; i < 200; i++ )
+    {
+        sortedEpochs.push_back( 1.0E5 + static_cast< double >( i ) * 4.321E4 );
+    }
+    std::vector< double > unsortedEpochs = sortedEpochs;
+    std::reverse( unsortedEpochs.begin( ), unsortedEpochs.end( ) );
+
+    Eigen::Matrix< double, 6, Eigen::Dynamic > sortedStates, unsortedStates;
+    tabulatedEphemeris->getCartesianStatesFromEphemeris( sortedEpochs, sortedStates );
+    tabulatedEphemeris->getCartesianStatesFromEphemeris( unsortedEpochs, unsortedStates );
+    for( unsigned int i = 0; i < sortedEpochs.size( ); i++ )
+    {
+        ephemerisState = tabulatedEphemeris->getCartesianStateFromEphemeris( sortedEpochs.at( i ) );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    ephemerisState, basic_mathematics::Vector6d( sortedStates.col( i ) ), 0.0 );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    ephemerisState,
+                    basic_mathematics::Vector6d( unsortedStates.col( sortedEpochs.size( ) - 1 - i ) ), 0.0 );
+    }
+
+
+}
+
+//! Test the interpolation of the states of multiple bodies from a single columnar state history.
+BOOST_AUTO_TEST_CASE( testColumnarStateHistory )
+{
+    using namespace ephemerides;
+
+    // Create combined state history of three planets, with three additional (dummy) entries before the states.
+    std::vector< boost::shared_ptr< Ephemeris > > planetEphemerides;
+    planetEphemerides.push_back( boost::make_shared< ApproximatePlanetPositions >(
+                                     ApproximatePlanetPositionsBase::mercury ) );
+    planetEphemerides.push_back( boost::make_shared< ApproximatePlanetPositions >(
+                                     ApproximatePlanetPositionsBase::mars ) );
+    planetEphemerides.push_back( boost::make_shared< ApproximatePlanetPositions >(
+                                     ApproximatePlanetPositionsBase::jupiter ) );
+    const int startIndex = 3;
+
+    std::map< double, Eigen::VectorXd > fullStateHistory;
+    std::vector< std::map< double, basic_mathematics::Vector6d > > planetStateHistories( 3 );
+    for( unsigned int i = 0; i < 100; i++ )
+    {
+        const double currentTime = 1.0E6 + static_cast< double >( i ) * 3.6E4;
+        fullStateHistory[ currentTime ] = Eigen::VectorXd::Zero( startIndex + 18 );
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            planetStateHistories[ j ][ currentTime ] = planetEphemerides.at( j )->getCartesianStateFromEphemeris(
+                        currentTime );
+            fullStateHistory[ currentTime ].segment( startIndex + 6 * j, 6 ) = planetStateHistories[ j ][ currentTime ];
+        }
+    }
+
+    boost::shared_ptr< ColumnarStateHistory< > > columnarStateHistory =
+            boost::make_shared< ColumnarStateHistory< > >( fullStateHistory, startIndex, 18 );
+    BOOST_CHECK_EQUAL( columnarStateHistory->getTimes( ).size( ), 100 );
+    BOOST_CHECK_EQUAL( columnarStateHistory->getStates( ).rows( ), 18 );
+
+    // Compare interpolated states with those of Lagrange interpolators created for each planet separately, in sorted
+    // order, in reverse order and at data points (including the edges, where cubic splines are used).
+    std::vector< double > testTimes;
+    for( unsigned int i = 0; i < 400; i++ )
+    {
+        testTimes.push_back( 1.0E6 + static_cast< double >( i ) * 8.91E3 );
+    }
+    for( unsigned int i = 0; i < 400; i++ )
+    {
+        testTimes.push_back( testTimes.at( 399 - i ) );
+    }
+    testTimes.push_back( 1.0E6 );
+    testTimes.push_back( 1.0E6 + 2.0 * 3.6E4 );
+    testTimes.push_back( 1.0E6 + 50.0 * 3.6E4 );
+    testTimes.push_back( 1.0E6 + 99.0 * 3.6E4 );
+
+    for( unsigned int j = 0; j < 3; j++ )
+    {
+        interpolators::LagrangeInterpolator< double, basic_mathematics::Vector6d > lagrangeInterpolator(
+                    planetStateHistories[ j ], 6 );
+        ColumnarStateHistorySliceInterpolator< > sliceInterpolator( columnarStateHistory, 6 * j );
+
+        for( unsigned int i = 0; i < testTimes.size( ); i++ )
+        {
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( lagrangeInterpolator.interpolate( testTimes.at( i ) ),
+                                               sliceInterpolator.interpolate( testTimes.at( i ) ),
+                                               std::numeric_limits< double >::epsilon( ) );
+        }
+    }
+
+    // Check that the data of a slice is retrieved through the (base class) interpolator interface.
+    boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, basic_mathematics::Vector6d > >
+            baseInterpolator = boost::make_shared< ColumnarStateHistorySliceInterpolator< > >(
+                columnarStateHistory, 12 );
+    std::vector< double > sliceTimes = baseInterpolator->getIndependentValues( );
+    std::vector< basic_mathematics::Vector6d > sliceStates = baseInterpolator->getDependentValues( );
+    BOOST_CHECK_EQUAL( sliceTimes.size( ), planetStateHistories[ 2 ].size( ) );
+    BOOST_CHECK_EQUAL( sliceStates.size( ), planetStateHistories[ 2 ].size( ) );
+    unsigned int currentIndex = 0;
+    for( std::map< double, basic_mathematics::Vector6d >::const_iterator stateIterator =
+         planetStateHistories[ 2 ].begin( ); stateIterator != planetStateHistories[ 2 ].end( ); stateIterator++ )
+    {
+        BOOST_CHECK_EQUAL( sliceTimes.at( currentIndex ), stateIterator->first );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( sliceStates.at( currentIndex ), stateIterator->second, 0.0 );
+        currentIndex++;
+    }
 
+    // Check that the slice interpolators may be used for tabulated ephemerides.
+    TabulatedCartesianEphemeris< > tabulatedEphemeris(
+                boost::make_shared< ColumnarStateHistorySliceInterpolator< > >( columnarStateHistory, 6 ) );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( tabulatedEphemeris.getCartesianStateFromEphemeris( 1.0E6 + 50.0 * 3.6E4 ),
+                                       planetStateHistories[ 1 ][ 1.0E6 + 50.0 * 3.6E4 ], 0.0 );
+
+    // Check that invalid slices are rejected.
+    bool isErrorCaught = 0;
+    try
+    {
+        ColumnarStateHistorySliceInterpolator< > invalidInterpolator( columnarStateHistory, 13 );
+    }
+    catch( const std::runtime_error& )
+    {
+        isErrorCaught = 1;
+    }
+    BOOST_CHECK_EQUAL( isErrorCaught, 1 );
 }
 
 BOOST_AUTO_TEST_SUITE_END( )
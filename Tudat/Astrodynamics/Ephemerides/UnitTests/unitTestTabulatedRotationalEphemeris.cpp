@@ -0,0 +1,207 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <limits>
+#include <map>
+#include <thread>
+#include <vector>
+
+#include <boost/make_shared.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/testMacros.h"
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/unitConversions.h"
+#include "Tudat/Astrodynamics/Ephemerides/iauRotationalEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/simpleRotationalEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/tabulatedRotationalEphemeris.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace ephemerides;
+using unit_conversions::convertDegreesToRadians;
+
+//! Function to compute rotations to target frame at a list of times, as performed by a single thread.
+void computeRotationsAtTimes( const boost::shared_ptr< TabulatedRotationalEphemeris > rotationalEphemeris,
+                              const std::vector< double >* times,
+                              std::vector< Eigen::Quaterniond >* rotationsToTargetFrame )
+{
+    rotationsToTargetFrame->resize( times->size( ) );
+    for( unsigned int i = 0; i < times->size( ); i++ )
+    {
+        rotationsToTargetFrame->at( i ) = rotationalEphemeris->getRotationToTargetFrame( times->at( i ) );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE( test_tabulated_rotational_ephemeris )
+
+// Test tabulated rotational ephemeris for uniform rotation, for which the interpolation is exact.
+BOOST_AUTO_TEST_CASE( testTabulatedRotationalEphemerisUniformRotation )
+{
+    boost::shared_ptr< SimpleRotationalEphemeris > venusRotationalEphemeris =
+            boost::make_shared< SimpleRotationalEphemeris >(
+                convertDegreesToRadians( 272.76 ), convertDegreesToRadians( 67.16 ),
+                convertDegreesToRadians( 160.20 ),
+                convertDegreesToRadians( -1.4813688 ) / physical_constants::JULIAN_DAY,
+                0.0, basic_astrodynamics::JULIAN_DAY_ON_J2000, "J2000", "IAU_VENUS" );
+
+    // Tabulate rotation with large time step (rotation by more than 10 degrees per step).
+    boost::shared_ptr< TabulatedRotationalEphemeris > tabulatedRotationalEphemeris =
+            createTabulatedRotationalEphemeris( venusRotationalEphemeris, -1.0E7, 1.0E7, 1.0E6 );
+    BOOST_CHECK_EQUAL( tabulatedRotationalEphemeris->getTimes( ).size( ), 21 );
+    BOOST_CHECK_EQUAL( tabulatedRotationalEphemeris->getTargetFrameOrientation( ), "IAU_VENUS" );
+
+    // Compare rotations, derivatives and angular velocities (in sorted order, reverse order, and at data points).
+    Eigen::Quaterniond rotationToTargetFrame;
+    Eigen::Matrix3d rotationToTargetFrameDerivative;
+    Eigen::Vector3d angularVelocityVectorInBaseFrame;
+    for( int i = -100; i < 300; i++ )
+    {
+        const double testTime = ( i < 100 ) ? ( static_cast< double >( i ) * 9.87E4 ) :
+                                              ( static_cast< double >( 199 - i ) * 9.87E4 );
+        tabulatedRotationalEphemeris->getFullRotationalQuantitiesToTargetFrame(
+                    rotationToTargetFrame, rotationToTargetFrameDerivative, angularVelocityVectorInBaseFrame,
+                    testTime );
+
+        const Eigen::Matrix3d rotationDifference =
+                Eigen::Matrix3d( rotationToTargetFrame ) -
+                Eigen::Matrix3d( venusRotationalEphemeris->getRotationToTargetFrame(
+                                     testTime, basic_astrodynamics::JULIAN_DAY_ON_J2000 ) );
+        BOOST_CHECK_SMALL( rotationDifference.norm( ), 1.0E-13 );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    Eigen::Matrix3d( tabulatedRotationalEphemeris->getRotationToTargetFrame( testTime ) ),
+                    Eigen::Matrix3d( rotationToTargetFrame ), std::numeric_limits< double >::epsilon( ) );
+
+        const Eigen::Matrix3d directRotationDerivative =
+                venusRotationalEphemeris->getDerivativeOfRotationToTargetFrame( testTime );
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            for( unsigned int k = 0; k < 3; k++ )
+            {
+                BOOST_CHECK_SMALL( rotationToTargetFrameDerivative( j, k ) - directRotationDerivative( j, k ),
+                                   1.0E-20 );
+            }
+        }
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    tabulatedRotationalEphemeris->getDerivativeOfRotationToTargetFrame( testTime ),
+                    rotationToTargetFrameDerivative, std::numeric_limits< double >::epsilon( ) );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    angularVelocityVectorInBaseFrame,
+                    getRotationalVelocityVectorInBaseFrameFromMatrices(
+                        Eigen::Matrix3d( venusRotationalEphemeris->getRotationToTargetFrame(
+                                             testTime, basic_astrodynamics::JULIAN_DAY_ON_J2000 ) ),
+                        directRotationDerivative.transpose( ) ), 1.0E-10 );
+    }
+}
+
+// Test tabulated rotational ephemeris for rotation with nutation and libration terms.
+BOOST_AUTO_TEST_CASE( testTabulatedRotationalEphemerisLunarRotation )
+{
+    boost::shared_ptr< IauRotationalEphemeris > moonRotationalEphemeris = createIauRotationalEphemeris( "Moon" );
+    boost::shared_ptr< TabulatedRotationalEphemeris > tabulatedRotationalEphemeris =
+            createTabulatedRotationalEphemeris( moonRotationalEphemeris, 0.0, 30.0 * physical_constants::JULIAN_DAY,
+                                                600.0 );
+
+    for( int i = 0; i < 1000; i++ )
+    {
+        const double testTime = static_cast< double >( i ) * 2.5E3 + 1.0;
+
+        // Check rotation (interpolation error of order of square of rotation angle per time step).
+        const Eigen::Matrix3d rotationDifference =
+                Eigen::Matrix3d( tabulatedRotationalEphemeris->getRotationToTargetFrame( testTime ) ) -
+                Eigen::Matrix3d( moonRotationalEphemeris->getRotationToTargetFrame( testTime ) );
+        BOOST_CHECK_SMALL( rotationDifference.norm( ), 5.0E-10 );
+
+        // Check derivative.
+        const Eigen::Matrix3d directRotationDerivative =
+                moonRotationalEphemeris->getDerivativeOfRotationToTargetFrame( testTime );
+        const Eigen::Matrix3d derivativeDifference =
+                tabulatedRotationalEphemeris->getDerivativeOfRotationToTargetFrame( testTime ) -
+                directRotationDerivative;
+        BOOST_CHECK_SMALL( derivativeDifference.norm( ) / directRotationDerivative.norm( ), 1.0E-6 );
+    }
+}
+
+// Test concurrent use of tabulated rotational ephemeris (with non-uniform tabulation times) by several threads.
+BOOST_AUTO_TEST_CASE( testTabulatedRotationalEphemerisConcurrentUse )
+{
+    boost::shared_ptr< SimpleRotationalEphemeris > venusRotationalEphemeris =
+            boost::make_shared< SimpleRotationalEphemeris >(
+                convertDegreesToRadians( 272.76 ), convertDegreesToRadians( 67.16 ),
+                convertDegreesToRadians( 160.20 ),
+                convertDegreesToRadians( -1.4813688 ) / physical_constants::JULIAN_DAY,
+                0.0, basic_astrodynamics::JULIAN_DAY_ON_J2000, "J2000", "IAU_VENUS" );
+
+    // Tabulate rotation at non-uniform times, so that the hunting algorithm is used to find the interval.
+    std::map< double, Eigen::Quaterniond > rotationsToTargetFrame;
+    for( int i = 0; i < 500; i++ )
+    {
+        const double tabulationTime =
+                1.0E5 * ( static_cast< double >( i ) + 0.3 * std::sin( static_cast< double >( i ) ) );
+        rotationsToTargetFrame[ tabulationTime ] = venusRotationalEphemeris->getRotationToTargetFrame(
+                    tabulationTime, basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+    }
+    boost::shared_ptr< TabulatedRotationalEphemeris > tabulatedRotationalEphemeris =
+            boost::make_shared< TabulatedRotationalEphemeris >( rotationsToTargetFrame, "J2000", "IAU_VENUS" );
+
+    // Create a different sequence of times for each thread (forward and backward, with different step sizes).
+    const int numberOfThreads = 4;
+    std::vector< std::vector< double > > testTimes( numberOfThreads );
+    for( int i = 0; i < numberOfThreads; i++ )
+    {
+        for( int j = 0; j < 5000; j++ )
+        {
+            const double timeStep = 9.87E3 * static_cast< double >( i + 1 );
+            testTimes[ i ].push_back( ( i % 2 == 0 ) ? ( static_cast< double >( j ) * timeStep ) :
+                                                       ( 4.9E7 - static_cast< double >( j ) * timeStep ) );
+        }
+    }
+
+    // Compute rotations concurrently.
+    std::vector< std::vector< Eigen::Quaterniond > > computedRotations( numberOfThreads );
+    std::vector< std::thread > threads;
+    for( int i = 0; i < numberOfThreads; i++ )
+    {
+        threads.push_back( std::thread( &computeRotationsAtTimes, tabulatedRotationalEphemeris,
+                                        &testTimes[ i ], &computedRotations[ i ] ) );
+    }
+    for( int i = 0; i < numberOfThreads; i++ )
+    {
+        threads[ i ].join( );
+    }
+
+    // Compare with rotations from original model (interpolation is exact for uniform rotation).
+    for( int i = 0; i < numberOfThreads; i++ )
+    {
+        for( unsigned int j = 0; j < testTimes[ i ].size( ); j++ )
+        {
+            const Eigen::Matrix3d rotationDifference =
+                    Eigen::Matrix3d( computedRotations[ i ][ j ] ) -
+                    Eigen::Matrix3d( venusRotationalEphemeris->getRotationToTargetFrame(
+                                         testTimes[ i ][ j ], basic_astrodynamics::JULIAN_DAY_ON_J2000 ) );
+            BOOST_CHECK_SMALL( rotationDifference.norm( ), 1.0E-12 );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
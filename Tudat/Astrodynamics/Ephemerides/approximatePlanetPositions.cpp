@@ -68,6 +68,70 @@ basic_mathematics::Vector6d ApproximatePlanetPositions::getCartesianStateFromEph
 //! Get keplerian state from ephemeris.
 basic_mathematics::Vector6d ApproximatePlanetPositions::getKeplerianStateFromEphemeris(
         const double secondsSinceEpoch, const double julianDayAtEpoch )
+{
+    using namespace orbital_element_conversions;
+
+    // Compute Keplerian elements (except true anomaly) and mean anomaly.
+    computeKeplerianElementsAndMeanAnomaly( secondsSinceEpoch, julianDayAtEpoch );
+
+    // Convert mean anomaly to eccentric anomaly.
+    eccentricAnomalyAtGivenJulianDate_ = convertMeanAnomalyToEccentricAnomaly(
+                planetKeplerianElementsAtGivenJulianDate_( eccentricityIndex ),
+                unit_conversions::convertDegreesToRadians(
+                    meanAnomalyAtGivenJulianDate_ ) );
+
+    // Convert eccentric anomaly to true anomaly and set in planet elements.
+    trueAnomalyAtGivenJulianData_
+            = orbital_element_conversions::convertEccentricAnomalyToTrueAnomaly(
+                eccentricAnomalyAtGivenJulianDate_,
+                planetKeplerianElementsAtGivenJulianDate_( eccentricityIndex ) );
+
+    planetKeplerianElementsAtGivenJulianDate_( trueAnomalyIndex )
+            = trueAnomalyAtGivenJulianData_;
+
+    return planetKeplerianElementsAtGivenJulianDate_;
+}
+
+//! Get cartesian states from ephemeris at a list of epochs.
+void ApproximatePlanetPositions::getCartesianStatesFromEphemeris(
+        const std::vector< double >& secondsSinceEpoch,
+        Eigen::Matrix< double, 6, Eigen::Dynamic >& statesFromEphemeris,
+        const double julianDayAtEpoch )
+{
+    using namespace orbital_element_conversions;
+
+    const int numberOfEpochs = static_cast< int >( secondsSinceEpoch.size( ) );
+
+    // Compute Keplerian elements (except true anomaly) and mean anomalies at all epochs.
+    Eigen::Matrix< double, 6, Eigen::Dynamic > keplerianElements( 6, numberOfEpochs );
+    Eigen::ArrayXd eccentricities( numberOfEpochs );
+    Eigen::ArrayXd meanAnomalies( numberOfEpochs );
+    for( int i = 0; i < numberOfEpochs; i++ )
+    {
+        computeKeplerianElementsAndMeanAnomaly( secondsSinceEpoch[ i ], julianDayAtEpoch );
+        keplerianElements.col( i ) = planetKeplerianElementsAtGivenJulianDate_;
+        eccentricities( i ) = planetKeplerianElementsAtGivenJulianDate_( eccentricityIndex );
+        meanAnomalies( i ) = unit_conversions::convertDegreesToRadians( meanAnomalyAtGivenJulianDate_ );
+    }
+
+    // Convert mean anomalies to eccentric anomalies at all epochs simultaneously.
+    const Eigen::ArrayXd eccentricAnomalies =
+            convertMeanAnomaliesToEccentricAnomalies< double >( eccentricities, meanAnomalies );
+
+    // Convert planet elements in Keplerian elements to Cartesian elements.
+    statesFromEphemeris.resize( 6, numberOfEpochs );
+    for( int i = 0; i < numberOfEpochs; i++ )
+    {
+        keplerianElements( trueAnomalyIndex, i ) = convertEccentricAnomalyToTrueAnomaly(
+                    eccentricAnomalies( i ), eccentricities( i ) );
+        statesFromEphemeris.col( i ) = convertKeplerianToCartesianElements(
+                    basic_mathematics::Vector6d( keplerianElements.col( i ) ), sunGravitationalParameter );
+    }
+}
+
+//! Compute Keplerian elements (except true anomaly) and mean anomaly at given epoch.
+void ApproximatePlanetPositions::computeKeplerianElementsAndMeanAnomaly(
+        const double secondsSinceEpoch, const double julianDayAtEpoch )
 {
     using std::pow;
     using std::sin;
@@ -145,21 +209,6 @@ basic_mathematics::Vector6d ApproximatePlanetPositions::getKeplerianStateFromEph
         meanAnomalyAtGivenJulianDate_ -= 360.0;
     }
 
-    // Convert mean anomaly to eccentric anomaly.
-    eccentricAnomalyAtGivenJulianDate_ = convertMeanAnomalyToEccentricAnomaly(
-                planetKeplerianElementsAtGivenJulianDate_( eccentricityIndex ),
-                unit_conversions::convertDegreesToRadians(
-                    meanAnomalyAtGivenJulianDate_ ) );
-
-    // Convert eccentric anomaly to true anomaly and set in planet elements.
-    trueAnomalyAtGivenJulianData_
-            = orbital_element_conversions::convertEccentricAnomalyToTrueAnomaly(
-                eccentricAnomalyAtGivenJulianDate_,
-                planetKeplerianElementsAtGivenJulianDate_( eccentricityIndex ) );
-
-    planetKeplerianElementsAtGivenJulianDate_( trueAnomalyIndex )
-            = trueAnomalyAtGivenJulianData_;
-
     // Convert Keplerian elements to standard units.
     // Convert semi-major axis from AU to meters.
     planetKeplerianElementsAtGivenJulianDate_( semiMajorAxisIndex )
@@ -180,8 +229,6 @@ basic_mathematics::Vector6d ApproximatePlanetPositions::getKeplerianStateFromEph
     planetKeplerianElementsAtGivenJulianDate_( argumentOfPeriapsisIndex )
             = unit_conversions::convertDegreesToRadians(
                 planetKeplerianElementsAtGivenJulianDate_( argumentOfPeriapsisIndex ) );
-
-    return planetKeplerianElementsAtGivenJulianDate_;
 }
 
 } // namespace ephemerides
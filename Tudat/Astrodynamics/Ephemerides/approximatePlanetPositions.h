@@ -108,10 +108,35 @@ public:
             const double secondsSinceEpoch,
             const double julianDayAtEpoch  = basic_astrodynamics::JULIAN_DAY_ON_J2000 );
 
+    //! Get cartesian states from ephemeris at a list of epochs.
+    /*!
+     * Computes cartesian states from ephemeris at a list of epochs, converting the mean anomalies
+     * at all epochs to eccentric anomalies simultaneously.
+     * \param secondsSinceEpoch Seconds since epoch.
+     * \param statesFromEphemeris States in Cartesian elements from ephemeris (returned by
+     * reference), with the state at secondsSinceEpoch[ i ] in column i.
+     * \param julianDayAtEpoch Reference epoch in Julian day.
+     */
+    void getCartesianStatesFromEphemeris(
+            const std::vector< double >& secondsSinceEpoch,
+            Eigen::Matrix< double, 6, Eigen::Dynamic >& statesFromEphemeris,
+            const double julianDayAtEpoch = basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+
 protected:
 
 private:
 
+    //! Compute Keplerian elements (except true anomaly) and mean anomaly at given epoch.
+    /*!
+     * Computes Keplerian elements (except true anomaly, in SI units) and mean anomaly (in degrees)
+     * at given epoch, and sets them in planetKeplerianElementsAtGivenJulianDate_ and
+     * meanAnomalyAtGivenJulianDate_.
+     * \param secondsSinceEpoch Seconds since epoch.
+     * \param julianDayAtEpoch Reference epoch in Julian day.
+     */
+    void computeKeplerianElementsAndMeanAnomaly( const double secondsSinceEpoch,
+                                                 const double julianDayAtEpoch );
+
     //! Eccentric anomaly at given Julian date.
     /*!
      * Eccentric anomaly of planet at given Julian date.
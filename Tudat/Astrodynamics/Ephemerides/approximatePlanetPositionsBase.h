@@ -131,6 +131,17 @@ public:
      */
     double getSunGravitationalParameter( ){ return sunGravitationalParameter; }
 
+    //! Returns the ephemeris data of the planet.
+    /*!
+     *  Returns the ephemeris data (orbital elements at J2000, their rates of change and additional
+     *  terms) of the planet, as read from the ephemeris file.
+     *  \return Approximate planet positions data container.
+     */
+    ApproximatePlanetPositionsDataContainer getApproximatePlanetPositionsDataContainer( )
+    {
+        return approximatePlanetPositionsDataContainer_;
+    }
+
 protected:
 
     //! Set planet.
@@ -0,0 +1,189 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+
+#include "Tudat/Astrodynamics/Ephemerides/chebyshevEphemeris.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Function to evaluate a Chebyshev series for a 6-dimensional state using Clenshaw's recurrence.
+basic_mathematics::Vector6d evaluateChebyshevSeries(
+        const Eigen::Ref< const Eigen::Matrix< double, 6, Eigen::Dynamic > >& coefficients,
+        const double scaledTime )
+{
+    basic_mathematics::Vector6d currentTerm = basic_mathematics::Vector6d::Zero( );
+    basic_mathematics::Vector6d previousTerm = basic_mathematics::Vector6d::Zero( );
+    basic_mathematics::Vector6d temporaryTerm;
+
+    const double twiceScaledTime = 2.0 * scaledTime;
+    for( int j = coefficients.cols( ) - 1; j > 0; j-- )
+    {
+        temporaryTerm = currentTerm;
+        currentTerm = twiceScaledTime * currentTerm - previousTerm + coefficients.col( j );
+        previousTerm = temporaryTerm;
+    }
+    return scaledTime * currentTerm - previousTerm + coefficients.col( 0 );
+}
+
+//! Constructor, fits the Chebyshev polynomials to a state function.
+ChebyshevEphemeris::ChebyshevEphemeris(
+        const boost::function< basic_mathematics::Vector6d( const double ) > stateFunction,
+        const double initialTime,
+        const double finalTime,
+        const double positionTolerance,
+        const std::string& referenceFrameOrigin,
+        const std::string& referenceFrameOrientation,
+        const int polynomialDegree,
+        const int maximumNumberOfBisections ):
+    Ephemeris( referenceFrameOrigin, referenceFrameOrientation ),
+    initialTime_( initialTime ), finalTime_( finalTime ), positionTolerance_( positionTolerance ),
+    polynomialDegree_( polynomialDegree ), maximumNumberOfBisections_( maximumNumberOfBisections ),
+    maximumPositionFitError_( 0.0 )
+{
+    // Check input consistency.
+    if( !( finalTime_ > initialTime_ ) )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, final time must be larger than initial time." );
+    }
+    else if( !( positionTolerance_ > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, position tolerance must be positive." );
+    }
+    else if( polynomialDegree_ < 1 )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, polynomial degree must be at least 1." );
+    }
+    else if( maximumNumberOfBisections_ < 0 || maximumNumberOfBisections_ > 30 )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, maximum number of bisections must be "
+                                  "between 0 and 30." );
+    }
+
+    // Fit segments, recursively bisecting the full interval where needed.
+    std::vector< Eigen::Matrix< double, 6, Eigen::Dynamic > > segmentCoefficients;
+    fitSegment( stateFunction, initialTime_, finalTime_, 0, segmentCoefficients );
+
+    // Store coefficients of all segments contiguously.
+    const int numberOfCoefficients = polynomialDegree_ + 1;
+    coefficients_.resize( 6, numberOfCoefficients * segmentCoefficients.size( ) );
+    for( unsigned int i = 0; i < segmentCoefficients.size( ); i++ )
+    {
+        coefficients_.block( 0, i * numberOfCoefficients, 6, numberOfCoefficients ) = segmentCoefficients[ i ];
+    }
+
+    // Create constant-time lookup scheme for segment boundaries, using a direct division by the segment length if
+    // all segments are of equal length.
+    std::vector< double > segmentBoundaries = segmentStartTimes_;
+    segmentBoundaries.push_back( finalTime_ );
+    segmentLookupScheme_ = interpolators::createLookupScheme(
+                segmentBoundaries,
+                ( interpolators::getBestSuitedLookupScheme( segmentBoundaries, interpolators::binarySearch ) ==
+                  interpolators::uniformGridLookup ) ? interpolators::uniformGridLookup :
+                                                       interpolators::piecewiseUniformGridLookup );
+
+    if( maximumPositionFitError_ > positionTolerance_ )
+    {
+        std::cerr << "Warning, Chebyshev ephemeris could not meet position tolerance of " << positionTolerance_
+                  << " with " << maximumNumberOfBisections_ << " bisections, maximum error is "
+                  << maximumPositionFitError_ << std::endl;
+    }
+}
+
+//! Function to get state from ephemeris.
+basic_mathematics::Vector6d ChebyshevEphemeris::getCartesianStateFromEphemeris(
+        const double secondsSinceEpoch, const double julianDayAtEpoch )
+{
+    if( julianDayAtEpoch != basic_astrodynamics::JULIAN_DAY_ON_J2000 )
+    {
+        throw std::runtime_error( "Error in Chebyshev ephemeris, reference epochs are inconsistent" );
+    }
+
+    // Find segment containing requested time (using first/last segment outside of fitted interval).
+    const int segmentIndex = segmentLookupScheme_->findNearestLowerNeighbour( secondsSinceEpoch );
+
+    // Evaluate polynomials of segment.
+    const double scaledTime = ( secondsSinceEpoch - segmentStartTimes_[ segmentIndex ] ) /
+            segmentHalfLengths_[ segmentIndex ] - 1.0;
+    return evaluateChebyshevSeries(
+                coefficients_.block( 0, segmentIndex * ( polynomialDegree_ + 1 ), 6, polynomialDegree_ + 1 ),
+                scaledTime );
+}
+
+//! Function to fit the Chebyshev polynomials over a given interval, bisecting it if needed.
+void ChebyshevEphemeris::fitSegment(
+        const boost::function< basic_mathematics::Vector6d( const double ) >& stateFunction,
+        const double segmentStartTime, const double segmentEndTime, const int numberOfBisections,
+        std::vector< Eigen::Matrix< double, 6, Eigen::Dynamic > >& segmentCoefficients )
+{
+    const int numberOfNodes = polynomialDegree_ + 1;
+    const double halfLength = 0.5 * ( segmentEndTime - segmentStartTime );
+    const double midTime = segmentStartTime + halfLength;
+
+    // Compute coefficients from states at Chebyshev nodes (Press et al., 2002).
+    Eigen::Matrix< double, 6, Eigen::Dynamic > nodeStates( 6, numberOfNodes );
+    for( int k = 0; k < numberOfNodes; k++ )
+    {
+        nodeStates.col( k ) = stateFunction(
+                    midTime + halfLength * std::cos( mathematical_constants::PI * ( k + 0.5 ) / numberOfNodes ) );
+    }
+
+    Eigen::Matrix< double, 6, Eigen::Dynamic > coefficients =
+            Eigen::Matrix< double, 6, Eigen::Dynamic >::Zero( 6, numberOfNodes );
+    for( int j = 0; j < numberOfNodes; j++ )
+    {
+        for( int k = 0; k < numberOfNodes; k++ )
+        {
+            coefficients.col( j ) += nodeStates.col( k ) *
+                    std::cos( mathematical_constants::PI * j * ( k + 0.5 ) / numberOfNodes );
+        }
+    }
+    coefficients *= 2.0 / static_cast< double >( numberOfNodes );
+    coefficients.col( 0 ) *= 0.5;
+
+    // Determine maximum position error at Chebyshev extrema (incl. segment boundaries).
+    double maximumPositionError = 0.0;
+    for( int i = 0; i <= polynomialDegree_; i++ )
+    {
+        const double scaledTime = std::cos( mathematical_constants::PI * i / polynomialDegree_ );
+        maximumPositionError = std::max(
+                    maximumPositionError,
+                    ( evaluateChebyshevSeries( coefficients, scaledTime ).segment( 0, 3 ) -
+                      stateFunction( midTime + halfLength * scaledTime ).segment( 0, 3 ) ).norm( ) );
+    }
+
+    // Bisect segment if tolerance is not met, or add segment to list.
+    if( maximumPositionError > positionTolerance_ && numberOfBisections < maximumNumberOfBisections_ )
+    {
+        fitSegment( stateFunction, segmentStartTime, midTime, numberOfBisections + 1,
+                    segmentCoefficients );
+        fitSegment( stateFunction, midTime, segmentEndTime, numberOfBisections + 1,
+                    segmentCoefficients );
+    }
+    else
+    {
+        segmentCoefficients.push_back( coefficients );
+        segmentStartTimes_.push_back( segmentStartTime );
+        segmentHalfLengths_.push_back( halfLength );
+        maximumPositionFitError_ = std::max( maximumPositionFitError_, maximumPositionError );
+    }
+}
+
+} // namespace ephemerides
+
+} // namespace tudat
@@ -0,0 +1,211 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Press, W.H., et al. Numerical Recipes in C++, 2nd edition, Cambridge University Press, 2002, Section 5.8.
+ *      Newhall, X.X. Numerical Representation of Planetary Ephemerides, Celestial Mechanics 45, 305-310, 1989.
+ */
+
+#ifndef TUDAT_CHEBYSHEVEPHEMERIS_H
+#define TUDAT_CHEBYSHEVEPHEMERIS_H
+
+#include <vector>
+
+#include <boost/function.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Ephemerides/ephemeris.h"
+#include "Tudat/Mathematics/Interpolators/lookupScheme.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Function to evaluate a Chebyshev series for a 6-dimensional state using Clenshaw's recurrence.
+/*!
+ *  Function to evaluate a Chebyshev series sum_{j} c_j T_j(x) for a 6-dimensional state using Clenshaw's
+ *  recurrence (Press et al., 2002).
+ *  \param coefficients Chebyshev coefficients, with the coefficients of T_j(x) in column j.
+ *  \param scaledTime Independent variable x of the series (should be in [-1,1] for interpolation).
+ *  \return Value of Chebyshev series at scaledTime.
+ */
+basic_mathematics::Vector6d evaluateChebyshevSeries(
+        const Eigen::Ref< const Eigen::Matrix< double, 6, Eigen::Dynamic > >& coefficients,
+        const double scaledTime );
+
+//! Ephemeris derived class that represents a state history by piecewise Chebyshev polynomials.
+/*!
+ *  Ephemeris derived class that represents a state history (e.g. from Spice, or from a numerically propagated
+ *  trajectory) by piecewise Chebyshev polynomials, in the manner of the JPL DE ephemerides (Newhall, 1989) and type 3
+ *  Spice kernels. Upon construction, the state function is fitted over a given interval: each segment is fitted by
+ *  polynomials of a fixed degree (separately for each position and velocity component), and is recursively bisected
+ *  until the position error at the Chebyshev extrema of the segment is below the requested tolerance. The fitting is
+ *  done by evaluating the state at the Chebyshev nodes of the segment, so that no tabulation of the state on a
+ *  fixed grid is needed. The segment containing a given time is found in constant time, by a uniform grid lookup if
+ *  all segments have the same length, and by a piecewise uniform grid lookup (see
+ *  interpolators::PiecewiseUniformGridLookupScheme) otherwise. The state in a segment is evaluated using Clenshaw's
+ *  recurrence.
+ *  Outside the fitted interval, the polynomials of the first/last segment are extrapolated.
+ */
+class ChebyshevEphemeris : public Ephemeris
+{
+public:
+
+    //! Constructor, fits the Chebyshev polynomials to a state function.
+    /*!
+     *  Constructor, fits the Chebyshev polynomials to a state function.
+     *  \param stateFunction Function returning the state as a function of time (in seconds since J2000) that is to be
+     *  represented by this ephemeris.
+     *  \param initialTime Start time of interval over which stateFunction is to be represented.
+     *  \param finalTime End time of interval over which stateFunction is to be represented.
+     *  \param positionTolerance Maximum allowed error in the position norm (at the test points in each segment).
+     *  \param referenceFrameOrigin Origin of reference frame (string identifier).
+     *  \param referenceFrameOrientation Orientation of reference frame (string identifier).
+     *  \param polynomialDegree Degree of the Chebyshev polynomials in each segment (default 12).
+     *  \param maximumNumberOfBisections Maximum number of times that the interval may be bisected to obtain a segment
+     *  (default 20). If the tolerance is not met for the shortest allowed segment, a warning is given.
+     */
+    ChebyshevEphemeris( const boost::function< basic_mathematics::Vector6d( const double ) > stateFunction,
+                        const double initialTime,
+                        const double finalTime,
+                        const double positionTolerance,
+                        const std::string& referenceFrameOrigin = "SSB",
+                        const std::string& referenceFrameOrientation = "ECLIPJ2000",
+                        const int polynomialDegree = 12,
+                        const int maximumNumberOfBisections = 20 );
+
+    //! Function to get state from ephemeris.
+    /*!
+     *  Returns state from ephemeris at given time, evaluated from the Chebyshev polynomials of the segment containing
+     *  the requested time.
+     *  \param secondsSinceEpoch Seconds since epoch.
+     *  \param julianDayAtEpoch Reference epoch in Julian day (only JULIAN_DAY_ON_J2000 is supported).
+     *  \return State from ephemeris at given time.
+     */
+    basic_mathematics::Vector6d getCartesianStateFromEphemeris(
+            const double secondsSinceEpoch,
+            const double julianDayAtEpoch = basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+
+    //! Function to retrieve the number of segments into which the interval has been divided.
+    /*!
+     *  Function to retrieve the number of segments into which the interval has been divided.
+     *  \return Number of segments into which the interval has been divided.
+     */
+    int getNumberOfSegments( )
+    {
+        return static_cast< int >( segmentStartTimes_.size( ) );
+    }
+
+    //! Function to retrieve the start times of the segments.
+    /*!
+     *  Function to retrieve the start times of the segments.
+     *  \return Start times of the segments.
+     */
+    std::vector< double > getSegmentStartTimes( )
+    {
+        return segmentStartTimes_;
+    }
+
+    //! Function to retrieve the degree of the Chebyshev polynomials in each segment.
+    /*!
+     *  Function to retrieve the degree of the Chebyshev polynomials in each segment.
+     *  \return Degree of the Chebyshev polynomials in each segment.
+     */
+    int getPolynomialDegree( )
+    {
+        return polynomialDegree_;
+    }
+
+    //! Function to retrieve the maximum position error at the test points in all segments.
+    /*!
+     *  Function to retrieve the maximum position error at the test points in all segments, as determined during the
+     *  fit.
+     *  \return Maximum position error at the test points in all segments.
+     */
+    double getMaximumPositionFitError( )
+    {
+        return maximumPositionFitError_;
+    }
+
+    //! Function to retrieve the start time of the interval over which the state is represented.
+    /*!
+     *  Function to retrieve the start time of the interval over which the state is represented.
+     *  \return Start time of the interval over which the state is represented.
+     */
+    double getInitialTime( )
+    {
+        return initialTime_;
+    }
+
+    //! Function to retrieve the end time of the interval over which the state is represented.
+    /*!
+     *  Function to retrieve the end time of the interval over which the state is represented.
+     *  \return End time of the interval over which the state is represented.
+     */
+    double getFinalTime( )
+    {
+        return finalTime_;
+    }
+
+private:
+
+    //! Function to fit the Chebyshev polynomials over a given interval, bisecting it if needed.
+    /*!
+     *  Function to fit the Chebyshev polynomials over a given interval, recursively bisecting it if the tolerance is
+     *  not met, and adding the resulting segment(s) to the member variables.
+     *  \param stateFunction Function returning the state as a function of time that is to be represented.
+     *  \param segmentStartTime Start time of interval.
+     *  \param segmentEndTime End time of interval.
+     *  \param numberOfBisections Number of bisections of the full interval by which current interval was obtained.
+     *  \param segmentCoefficients List of coefficients of all segments, to which segment(s) are added.
+     */
+    void fitSegment( const boost::function< basic_mathematics::Vector6d( const double ) >& stateFunction,
+                     const double segmentStartTime, const double segmentEndTime, const int numberOfBisections,
+                     std::vector< Eigen::Matrix< double, 6, Eigen::Dynamic > >& segmentCoefficients );
+
+    //! Start time of interval over which the state is represented.
+    double initialTime_;
+
+    //! End time of interval over which the state is represented.
+    double finalTime_;
+
+    //! Maximum allowed error in the position norm.
+    double positionTolerance_;
+
+    //! Degree of the Chebyshev polynomials in each segment.
+    int polynomialDegree_;
+
+    //! Maximum number of times that the interval may be bisected to obtain a segment.
+    int maximumNumberOfBisections_;
+
+    //! Maximum position error at the test points in all segments.
+    double maximumPositionFitError_;
+
+    //! Chebyshev coefficients of all segments (segment i in columns i * ( polynomialDegree_ + 1 ) onwards).
+    Eigen::Matrix< double, 6, Eigen::Dynamic > coefficients_;
+
+    //! Start times of the segments.
+    std::vector< double > segmentStartTimes_;
+
+    //! Half lengths of the segments.
+    std::vector< double > segmentHalfLengths_;
+
+    //! Lookup scheme to find the segment containing a given time (from the segment start times and final time).
+    boost::shared_ptr< interpolators::LookUpScheme< double > > segmentLookupScheme_;
+};
+
+} // namespace ephemerides
+
+} // namespace tudat
+
+#endif // TUDAT_CHEBYSHEVEPHEMERIS_H
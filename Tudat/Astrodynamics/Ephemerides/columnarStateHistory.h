@@ -0,0 +1,439 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_COLUMNARSTATEHISTORY_H
+#define TUDAT_COLUMNARSTATEHISTORY_H
+
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Mathematics/BasicMathematics/nearestNeighbourSearch.h"
+#include "Tudat/Mathematics/Interpolators/cubicSplineInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/oneDimensionalInterpolator.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Class storing the (translational) state history of a set of bodies on a single, shared time axis.
+/*!
+ *  Class storing the (translational) state history of a set of bodies on a single, shared time axis, with the states
+ *  of all bodies at a given time in a single column of a matrix (so that the state history of a single body is a
+ *  strided 6-row slice of this matrix). In addition, the denominators of the Lagrange interpolating polynomials for
+ *  each interval of the time axis are pre-computed. Since these depend only on the time axis, they are computed once
+ *  for all bodies. The state of a single body is interpolated from this object, without copying its data, by a
+ *  ColumnarStateHistorySliceInterpolator, so that the (propagated) state histories of any number of bodies may be
+ *  set as their ephemerides (see TabulatedCartesianEphemeris) with a single copy of the data.
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+class ColumnarStateHistory
+{
+public:
+
+    //! Constructor from (full) state history map.
+    /*!
+     *  Constructor from (full) state history map, as e.g. produced by a numerical propagation, of which a contiguous
+     *  block of entries is stored.
+     *  \param stateHistory State history map, with times as keys.
+     *  \param startIndex Index of first entry of the state vectors of stateHistory that is to be stored.
+     *  \param numberOfEntries Number of entries of the state vectors of stateHistory that is to be stored (multiple
+     *  of 6).
+     *  \param numberOfStages Number of data points that are used to calculate the interpolating polynomials (must be
+     *  even, default 6).
+     */
+    ColumnarStateHistory(
+            const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& stateHistory,
+            const int startIndex,
+            const int numberOfEntries,
+            const int numberOfStages = 6 ):
+        numberOfStages_( numberOfStages )
+    {
+        if( stateHistory.size( ) == 0 )
+        {
+            throw std::runtime_error( "Error when creating columnar state history, input is empty." );
+        }
+        if( numberOfEntries % 6 != 0 ||
+                stateHistory.begin( )->second.rows( ) < startIndex + numberOfEntries )
+        {
+            throw std::runtime_error(
+                        "Error when creating columnar state history, requested entries are inconsistent with input." );
+        }
+
+        // Copy (requested part of) state history into single matrix.
+        times_.reserve( stateHistory.size( ) );
+        states_.resize( numberOfEntries, stateHistory.size( ) );
+        int currentColumn = 0;
+        for( typename std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >::const_iterator
+             stateIterator = stateHistory.begin( ); stateIterator != stateHistory.end( ); stateIterator++ )
+        {
+            times_.push_back( stateIterator->first );
+            states_.col( currentColumn ) = stateIterator->second.segment( startIndex, numberOfEntries );
+            currentColumn++;
+        }
+
+        initializeDenominators( );
+    }
+
+    //! Constructor from time axis and state matrix.
+    /*!
+     *  Constructor from time axis and state matrix.
+     *  \param times Times at which the states are given, sorted in ascending order.
+     *  \param states States of the bodies, with the states at times[ i ] in column i (6 rows per body).
+     *  \param numberOfStages Number of data points that are used to calculate the interpolating polynomials (must be
+     *  even, default 6).
+     */
+    ColumnarStateHistory(
+            const std::vector< TimeType >& times,
+            const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& states,
+            const int numberOfStages = 6 ):
+        times_( times ), states_( states ), numberOfStages_( numberOfStages )
+    {
+        if( states_.rows( ) % 6 != 0 || states_.cols( ) != static_cast< int >( times_.size( ) ) )
+        {
+            throw std::runtime_error(
+                        "Error when creating columnar state history, size of states and times are inconsistent." );
+        }
+
+        initializeDenominators( );
+    }
+
+    //! Function to retrieve the (shared) time axis of the state history.
+    /*!
+     *  Function to retrieve the (shared) time axis of the state history.
+     *  \return Times at which the states are given.
+     */
+    const std::vector< TimeType >& getTimes( ) const
+    {
+        return times_;
+    }
+
+    //! Function to retrieve the states of all bodies.
+    /*!
+     *  Function to retrieve the states of all bodies, with the states at getTimes( )[ i ] in column i. The states may
+     *  be modified in place (e.g. to change the frame origin of one of the bodies) through the returned reference.
+     *  \return States of all bodies.
+     */
+    Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& getStates( )
+    {
+        return states_;
+    }
+
+    //! Function to retrieve the number of data points used to calculate the interpolating polynomials.
+    /*!
+     *  Function to retrieve the number of data points used to calculate the interpolating polynomials.
+     *  \return Number of data points used to calculate the interpolating polynomials.
+     */
+    int getNumberOfStages( ) const
+    {
+        return numberOfStages_;
+    }
+
+    //! Function to retrieve the number of entries at the edges of the time axis where centered interpolation is not used.
+    /*!
+     *  Function to retrieve the number of entries at the edges of the time axis where centered Lagrange interpolation
+     *  cannot be used.
+     *  \return Number of entries at the edges of the time axis where centered interpolation is not used.
+     */
+    int getOffsetEntries( ) const
+    {
+        return offsetEntries_;
+    }
+
+    //! Function to retrieve the pre-computed denominator of a Lagrange interpolating polynomial.
+    /*!
+     *  Function to retrieve the pre-computed denominator of a Lagrange interpolating polynomial.
+     *  \param intervalIndex Index of (lower bound of) interval in which the interpolation is performed.
+     *  \param stageIndex Index of data point (from 0 to numberOfStages - 1) in the interpolating polynomial.
+     *  \return Denominator of Lagrange interpolating polynomial.
+     */
+    TimeType getDenominator( const int intervalIndex, const int stageIndex ) const
+    {
+        return denominators_( stageIndex, intervalIndex );
+    }
+
+private:
+
+    //! Function to pre-compute the denominators of the Lagrange interpolating polynomials for each interval.
+    void initializeDenominators( )
+    {
+        if( numberOfStages_ % 2 != 0 || numberOfStages_ < 2 )
+        {
+            throw std::runtime_error(
+                        "Error when creating columnar state history, number of stages must be even and positive." );
+        }
+        offsetEntries_ = numberOfStages_ / 2 - 1;
+
+        const int numberOfTimes = static_cast< int >( times_.size( ) );
+        if( numberOfTimes < std::max( numberOfStages_, 4 ) )
+        {
+            throw std::runtime_error(
+                        "Error when creating columnar state history, insufficient data points for interpolation." );
+        }
+
+        // Compute denominators for each interval in which centered interpolation is used.
+        denominators_.setZero( numberOfStages_, numberOfTimes );
+        for( int i = offsetEntries_; i < numberOfTimes - offsetEntries_ - 1; i++ )
+        {
+            const int currentIterationStart = i - offsetEntries_;
+            for( int j = 0; j < numberOfStages_; j++ )
+            {
+                denominators_( j, i ) = mathematical_constants::getFloatingInteger< TimeType >( 1 );
+                for( int k = 0; k < numberOfStages_; k++ )
+                {
+                    if( k != j )
+                    {
+                        denominators_( j, i ) *= times_[ j + currentIterationStart ] - times_[ k + currentIterationStart ];
+                    }
+                }
+            }
+        }
+    }
+
+    //! Times at which the states are given.
+    std::vector< TimeType > times_;
+
+    //! States of all bodies, with the states at times_[ i ] in column i.
+    Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > states_;
+
+    //! Number of data points used to calculate the interpolating polynomials.
+    int numberOfStages_;
+
+    //! Number of entries at the edges of the time axis where centered interpolation is not used.
+    int offsetEntries_;
+
+    //! Denominators of Lagrange interpolating polynomials (interval i in column i).
+    Eigen::Matrix< TimeType, Eigen::Dynamic, Eigen::Dynamic > denominators_;
+};
+
+//! Interpolator for the state of a single body from a ColumnarStateHistory.
+/*!
+ *  Interpolator for the state of a single body from a ColumnarStateHistory, which performs Lagrange interpolation
+ *  directly on the (strided) slice of the state matrix that contains the states of the body, using the shared time
+ *  axis and pre-computed denominators of the history. The interpolated values are identical to those of a
+ *  LagrangeInterpolator (with cubic spline boundary interpolation) created from the state history of the body, but no
+ *  copy of the data is made (except for the few data points at the edges of the time axis, which are interpolated
+ *  by cubic splines). The interpolation interval is found by a hunting algorithm, the state of which is stored in a
+ *  lookup cursor, so that the interpolator may be used concurrently by several threads.
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+class ColumnarStateHistorySliceInterpolator:
+        public interpolators::OneDimensionalInterpolator< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > >
+{
+public:
+
+    //! Typedef for state type.
+    typedef Eigen::Matrix< StateScalarType, 6, 1 > StateType;
+
+    // Using statement to prevent compiler warning.
+    using interpolators::OneDimensionalInterpolator< TimeType, StateType >::interpolate;
+
+    //! Constructor.
+    /*!
+     *  Constructor.
+     *  \param stateHistory State history from which the state of the body is to be interpolated.
+     *  \param startRow Index of the first row of the state matrix of stateHistory that contains the states of the body.
+     */
+    ColumnarStateHistorySliceInterpolator(
+            const boost::shared_ptr< ColumnarStateHistory< StateScalarType, TimeType > > stateHistory,
+            const int startRow ):
+        stateHistory_( stateHistory ), startRow_( startRow )
+    {
+        if( startRow_ < 0 || startRow_ + 6 > stateHistory_->getStates( ).rows( ) )
+        {
+            throw std::runtime_error( "Error when creating columnar state history interpolator, start row is invalid." );
+        }
+        numberOfTimes_ = static_cast< int >( stateHistory_->getTimes( ).size( ) );
+
+        if( stateHistory_->getNumberOfStages( ) > 2 )
+        {
+            beginInterpolator_ = createBoundaryInterpolator( true );
+            endInterpolator_ = createBoundaryInterpolator( false );
+        }
+    }
+
+    //! Destructor.
+    ~ColumnarStateHistorySliceInterpolator( ){ }
+
+    //! Function to interpolate the state of the body at a given time.
+    /*!
+     *  Function to interpolate the state of the body at a given time. The polynomial centered on the requested
+     *  interval is used for the interpolation. At the edges of the time axis, where no centered polynomial is
+     *  available, a cubic spline with natural boundary conditions is used.
+     *  \param time Time at which the state is to be interpolated.
+     *  \param cursor Cursor storing the state of the sequence of lookups (modified by function).
+     *  \return Interpolated state of the body.
+     */
+    StateType interpolate( const TimeType time, interpolators::LookUpSchemeCursor& cursor ) const
+    {
+        const std::vector< TimeType >& times = stateHistory_->getTimes( );
+        const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& states = stateHistory_->getStates( );
+        const int offsetEntries = stateHistory_->getOffsetEntries( );
+
+        // Find interpolation interval.
+        const int lowerEntry = findNearestLowerIndex( time, cursor );
+
+        // Use cubic spline interpolation at edges of the time axis.
+        if( lowerEntry < offsetEntries || lowerEntry >= numberOfTimes_ - offsetEntries - 1 )
+        {
+            if( stateHistory_->getNumberOfStages( ) == 2 )
+            {
+                return StateType::Zero( );
+            }
+            return ( lowerEntry < offsetEntries ? beginInterpolator_ : endInterpolator_ )->interpolate( time );
+        }
+
+        // Check if requested time is equal to data point.
+        for( int i = -1; i <= 1; i++ )
+        {
+            if( times[ lowerEntry + i ] == time )
+            {
+                return states.block( startRow_, lowerEntry + i, 6, 1 );
+            }
+        }
+
+        // Evaluate interpolating polynomial at requested time.
+        const int numberOfStages = stateHistory_->getNumberOfStages( );
+        TimeType repeatedNumerator = mathematical_constants::getFloatingInteger< TimeType >( 1 );
+        for( int i = 0; i < numberOfStages; i++ )
+        {
+            repeatedNumerator *= time - times[ i + lowerEntry - offsetEntries ];
+        }
+
+        StateType interpolatedState = StateType::Zero( );
+        for( int i = 0; i < numberOfStages; i++ )
+        {
+            interpolatedState += states.block( startRow_, i + lowerEntry - offsetEntries, 6, 1 ) *
+                    static_cast< StateScalarType >(
+                        repeatedNumerator / ( ( time - times[ i + lowerEntry - offsetEntries ] ) *
+                                              stateHistory_->getDenominator( lowerEntry, i ) ) );
+        }
+
+        return interpolatedState;
+    }
+
+    //! Function to return the vector with independent variables used by the interpolator.
+    /*!
+     *  Function to return the vector with independent variables used by the interpolator, i.e. the (shared) time
+     *  axis of the state history.
+     *  \return Independent variables used by the interpolator.
+     */
+    std::vector< TimeType > getIndependentValues( )
+    {
+        return stateHistory_->getTimes( );
+    }
+
+    //! Function to return the vector with dependent variables used by the interpolator.
+    /*!
+     *  Function to return the vector with dependent variables used by the interpolator, i.e. the states of the body,
+     *  which are copied from the slice of the state matrix of the state history.
+     *  \return Dependent variables used by the interpolator.
+     */
+    std::vector< StateType > getDependentValues( )
+    {
+        const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& states = stateHistory_->getStates( );
+
+        std::vector< StateType > dependentValues;
+        dependentValues.reserve( numberOfTimes_ );
+        for( int i = 0; i < numberOfTimes_; i++ )
+        {
+            dependentValues.push_back( states.block( startRow_, i, 6, 1 ) );
+        }
+        return dependentValues;
+    }
+
+    //! Function to retrieve the state history from which the state of the body is interpolated.
+    /*!
+     *  Function to retrieve the state history from which the state of the body is interpolated.
+     *  \return State history from which the state of the body is interpolated.
+     */
+    boost::shared_ptr< ColumnarStateHistory< StateScalarType, TimeType > > getStateHistory( )
+    {
+        return stateHistory_;
+    }
+
+    //! Function to retrieve the index of the first row of the state matrix that contains the states of the body.
+    /*!
+     *  Function to retrieve the index of the first row of the state matrix that contains the states of the body.
+     *  \return Index of the first row of the state matrix that contains the states of the body.
+     */
+    int getStartRow( )
+    {
+        return startRow_;
+    }
+
+private:
+
+    //! Function to find the nearest lower data point of a given time, using a hunting algorithm.
+    int findNearestLowerIndex( const TimeType time, interpolators::LookUpSchemeCursor& cursor ) const
+    {
+        const std::vector< TimeType >& times = stateHistory_->getTimes( );
+        int& previousNearestLowerIndex = cursor.previousNearestLowerIndex_;
+        if( previousNearestLowerIndex < 0 || previousNearestLowerIndex > numberOfTimes_ - 2 )
+        {
+            previousNearestLowerIndex = std::max(
+                        0, std::min( static_cast< int >(
+                                         std::upper_bound( times.begin( ), times.end( ), time ) - times.begin( ) ) - 1,
+                                     numberOfTimes_ - 2 ) );
+        }
+        else if( !basic_mathematics::isIndependentVariableInInterval( previousNearestLowerIndex, time, times ) )
+        {
+            previousNearestLowerIndex = basic_mathematics::findNearestLeftNeighbourUsingHuntingAlgorithm(
+                        time, previousNearestLowerIndex, times );
+        }
+        return previousNearestLowerIndex;
+    }
+
+    //! Function to create the cubic spline interpolator at the start or end of the time axis.
+    boost::shared_ptr< interpolators::OneDimensionalInterpolator< TimeType, StateType > > createBoundaryInterpolator(
+            const bool isAtStart )
+    {
+        const std::vector< TimeType >& times = stateHistory_->getTimes( );
+        const int cubicSplineInputSize = std::max( stateHistory_->getOffsetEntries( ), 3 );
+        const int firstIndex = isAtStart ? 0 : numberOfTimes_ - cubicSplineInputSize - 1;
+
+        std::map< TimeType, StateType > boundaryStates;
+        for( int i = firstIndex; i <= firstIndex + cubicSplineInputSize; i++ )
+        {
+            boundaryStates[ times[ i ] ] = stateHistory_->getStates( ).block( startRow_, i, 6, 1 );
+        }
+        return boost::make_shared< interpolators::CubicSplineInterpolator< TimeType, StateType > >( boundaryStates );
+    }
+
+    //! State history from which the state of the body is interpolated.
+    boost::shared_ptr< ColumnarStateHistory< StateScalarType, TimeType > > stateHistory_;
+
+    //! Index of the first row of the state matrix of stateHistory_ that contains the states of the body.
+    int startRow_;
+
+    //! Number of data points in the state history.
+    int numberOfTimes_;
+
+    //! Interpolator used at the start of the time axis.
+    boost::shared_ptr< interpolators::OneDimensionalInterpolator< TimeType, StateType > > beginInterpolator_;
+
+    //! Interpolator used at the end of the time axis.
+    boost::shared_ptr< interpolators::OneDimensionalInterpolator< TimeType, StateType > > endInterpolator_;
+};
+
+} // namespace ephemerides
+
+} // namespace tudat
+
+#endif // TUDAT_COLUMNARSTATEHISTORY_H
@@ -0,0 +1,108 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <stdexcept>
+
+#include <boost/lexical_cast.hpp>
+#include <boost/make_shared.hpp>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/timeConversions.h"
+#include "Tudat/Astrodynamics/Ephemerides/earthOrientationParameters.h"
+#include "Tudat/InputOutput/matrixTextFileReader.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Constructor.
+EarthOrientationParameters::EarthOrientationParameters( const Eigen::MatrixXd& earthOrientationData )
+{
+    if( earthOrientationData.rows( ) < 2 ||
+            ( earthOrientationData.cols( ) != 4 && earthOrientationData.cols( ) != 6 ) )
+    {
+        throw std::runtime_error( "Error when creating Earth orientation parameters, data must have at least two rows "
+                                  "and either 4 or 6 columns, found " +
+                                  boost::lexical_cast< std::string >( earthOrientationData.rows( ) ) + " rows and " +
+                                  boost::lexical_cast< std::string >( earthOrientationData.cols( ) ) + " columns." );
+    }
+
+    const double arcsecondsToRadians = mathematical_constants::PI / ( 180.0 * 3600.0 );
+    const double modifiedJulianDayOnJ2000 =
+            basic_astrodynamics::JULIAN_DAY_ON_J2000 - basic_astrodynamics::JULIAN_DAY_AT_0_MJD;
+
+    for( int i = 0; i < earthOrientationData.rows( ); i++ )
+    {
+        // Convert tabulation time from UTC to TT.
+        const double utcModifiedJulianDay = earthOrientationData( i, 0 );
+        const double taiMinusUtc = basic_astrodynamics::getTaiMinusUtc( utcModifiedJulianDay );
+        const double currentTime = ( utcModifiedJulianDay - modifiedJulianDayOnJ2000 ) * physical_constants::JULIAN_DAY +
+                taiMinusUtc + basic_astrodynamics::TT_MINUS_TAI;
+        if( i > 0 && !( currentTime > times_.back( ) ) )
+        {
+            throw std::runtime_error( "Error when creating Earth orientation parameters, times are not in increasing "
+                                      "order." );
+        }
+        times_.push_back( currentTime );
+
+        Eigen::Matrix< double, 5, 1 > currentParameters;
+        currentParameters( 0 ) = earthOrientationData( i, 1 ) * arcsecondsToRadians;
+        currentParameters( 1 ) = earthOrientationData( i, 2 ) * arcsecondsToRadians;
+        currentParameters( 2 ) = earthOrientationData( i, 3 ) - taiMinusUtc - basic_astrodynamics::TT_MINUS_TAI;
+        if( earthOrientationData.cols( ) == 6 )
+        {
+            currentParameters( 3 ) = earthOrientationData( i, 4 ) * arcsecondsToRadians;
+            currentParameters( 4 ) = earthOrientationData( i, 5 ) * arcsecondsToRadians;
+        }
+        else
+        {
+            currentParameters( 3 ) = 0.0;
+            currentParameters( 4 ) = 0.0;
+        }
+        parameters_.push_back( currentParameters );
+    }
+
+    lookUpScheme_ = interpolators::createLookupScheme( times_, interpolators::huntingAlgorithm );
+}
+
+//! Function to interpolate the Earth orientation parameters.
+Eigen::Matrix< double, 5, 1 > EarthOrientationParameters::getEarthOrientationParameters(
+        const double ttSecondsSinceJ2000 )
+{
+    if( ttSecondsSinceJ2000 < times_.front( ) || ttSecondsSinceJ2000 > times_.back( ) )
+    {
+        throw std::runtime_error( "Error when interpolating Earth orientation parameters, time " +
+                                  boost::lexical_cast< std::string >( ttSecondsSinceJ2000 ) +
+                                  " is outside tabulated range." );
+    }
+
+    // Find interpolation interval.
+    const int lowerIndex = lookUpScheme_->findNearestLowerNeighbour( ttSecondsSinceJ2000 );
+
+    // Interpolate linearly.
+    const double fractionOfInterval = ( ttSecondsSinceJ2000 - times_[ lowerIndex ] ) /
+            ( times_[ lowerIndex + 1 ] - times_[ lowerIndex ] );
+    return parameters_[ lowerIndex ] +
+            fractionOfInterval * ( parameters_[ lowerIndex + 1 ] - parameters_[ lowerIndex ] );
+}
+
+//! Function to read Earth orientation parameters from a text file.
+boost::shared_ptr< EarthOrientationParameters > readEarthOrientationParametersFromFile( const std::string& fileName )
+{
+    return boost::make_shared< EarthOrientationParameters >(
+                input_output::readMatrixFromFile( fileName, " \t", "%" ) );
+}
+
+} // namespace ephemerides
+
+} // namespace tudat
@@ -0,0 +1,108 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_EARTH_ORIENTATION_PARAMETERS_H
+#define TUDAT_EARTH_ORIENTATION_PARAMETERS_H
+
+#include <string>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/Interpolators/lookupScheme.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Class to store and interpolate tabulated Earth orientation parameters.
+/*!
+ *  Class to store and interpolate tabulated Earth orientation parameters (EOP), as published by the IERS (e.g. the
+ *  EOP 14 C04 series): polar motion coordinates, UT1-UTC and celestial pole offsets. The parameters are interpolated
+ *  linearly in time, where the interpolation interval is found by a lookup scheme (see
+ *  interpolators::createLookupScheme), the state of which is stored in a thread-local cursor, so that the parameters
+ *  may be interpolated concurrently by several threads. To prevent discontinuities at leap seconds, UT1-UTC is stored as UT1-TT, and the tabulation times are converted from UTC to TT upon
+ *  construction.
+ */
+class EarthOrientationParameters
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor, sets the tabulated Earth orientation parameters.
+     *  \param earthOrientationData Matrix with one row per tabulation time (in increasing order), with columns:
+     *  modified Julian day (UTC), polar motion coordinates x_p and y_p (arcseconds), UT1-UTC (seconds) and,
+     *  optionally, celestial pole offsets dX and dY w.r.t. the IAU 2006/2000A model (arcseconds). At least two rows
+     *  must be provided, all at or after 1 January 1972.
+     */
+    EarthOrientationParameters( const Eigen::MatrixXd& earthOrientationData );
+
+    //! Function to interpolate the Earth orientation parameters.
+    /*!
+     *  Function to interpolate the Earth orientation parameters linearly at the given time. An exception is thrown if
+     *  the time is outside the tabulated range.
+     *  \param ttSecondsSinceJ2000 Time (TT) in seconds since J2000 at which parameters are to be interpolated.
+     *  \return Polar motion coordinates x_p and y_p (radians), UT1-TT (seconds), and celestial pole offsets dX and dY
+     *  (radians), in this order.
+     */
+    Eigen::Matrix< double, 5, 1 > getEarthOrientationParameters( const double ttSecondsSinceJ2000 );
+
+    //! Function to retrieve the first time (TT, in seconds since J2000) at which the parameters are tabulated.
+    /*!
+     *  Function to retrieve the first time (TT, in seconds since J2000) at which the parameters are tabulated.
+     *  \return First tabulation time.
+     */
+    double getStartTime( )
+    {
+        return times_.front( );
+    }
+
+    //! Function to retrieve the last time (TT, in seconds since J2000) at which the parameters are tabulated.
+    /*!
+     *  Function to retrieve the last time (TT, in seconds since J2000) at which the parameters are tabulated.
+     *  \return Last tabulation time.
+     */
+    double getEndTime( )
+    {
+        return times_.back( );
+    }
+
+private:
+
+    //! Tabulation times (TT, in seconds since J2000).
+    std::vector< double > times_;
+
+    //! Tabulated parameters (see getEarthOrientationParameters), in the same order as times_.
+    std::vector< Eigen::Matrix< double, 5, 1 > > parameters_;
+
+    //! Lookup scheme to find the interval in which the interpolation is to be performed.
+    boost::shared_ptr< interpolators::LookUpScheme< double > > lookUpScheme_;
+};
+
+//! Function to read Earth orientation parameters from a text file.
+/*!
+ *  Function to read Earth orientation parameters from a text file, with one line per tabulation time and columns
+ *  separated by spaces or tabs, as described for the constructor of EarthOrientationParameters. Lines starting with
+ *  % are skipped. Files in other formats (e.g. the IERS EOP C04 files) must be converted to this format beforehand.
+ *  \param fileName Path of file from which parameters are to be read.
+ *  \return Earth orientation parameters read from file.
+ */
+boost::shared_ptr< EarthOrientationParameters > readEarthOrientationParametersFromFile( const std::string& fileName );
+
+} // namespace ephemerides
+
+} // namespace tudat
+
+#endif // TUDAT_EARTH_ORIENTATION_PARAMETERS_H
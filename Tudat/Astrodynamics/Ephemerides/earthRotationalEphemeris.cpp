@@ -0,0 +1,248 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/timeConversions.h"
+#include "Tudat/Astrodynamics/Ephemerides/earthRotationalEphemeris.h"
+#include "Tudat/Astrodynamics/ReferenceFrames/earthOrientationCalculations.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Mathematics/Interpolators/lookupScheme.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Function to retrieve the thread-local precession-nutation nodes of an Earth rotational ephemeris.
+PrecessionNutationNodes& getThreadLocalPrecessionNutationNodes( const unsigned long long ownerIdentifier )
+{
+    // Only few Earth rotation models are used at the same time, so a small cache suffices.
+    static const unsigned long long cacheSize = 16;
+    static thread_local std::pair< unsigned long long, PrecessionNutationNodes > nodeCache[ cacheSize ];
+
+    std::pair< unsigned long long, PrecessionNutationNodes >& cacheEntry = nodeCache[ ownerIdentifier % cacheSize ];
+    if( cacheEntry.first != ownerIdentifier )
+    {
+        cacheEntry.first = ownerIdentifier;
+        cacheEntry.second.reset( );
+    }
+    return cacheEntry.second;
+}
+
+//! Constructor.
+EarthRotationalEphemeris::EarthRotationalEphemeris(
+        const boost::shared_ptr< EarthOrientationParameters > earthOrientationParameters,
+        const double precessionNutationUpdateInterval,
+        const std::string& baseFrameOrientation,
+        const std::string& targetFrameOrientation ):
+    RotationalEphemeris( baseFrameOrientation, targetFrameOrientation ),
+    earthOrientationParameters_( earthOrientationParameters ),
+    precessionNutationUpdateInterval_( precessionNutationUpdateInterval ),
+    nodeCacheOwnerIdentifier_( interpolators::generateLookUpSchemeCursorOwnerIdentifier( ) )
+{
+    if( baseFrameOrientation == "J2000" )
+    {
+        baseFrameToJ2000Rotation_.setIdentity( );
+    }
+    else if( baseFrameOrientation == "ECLIPJ2000" )
+    {
+        // Rotate by obliquity of the ecliptic at J2000 (IAU 1976, as used for the Spice ECLIPJ2000 frame).
+        baseFrameToJ2000Rotation_ = Eigen::AngleAxisd(
+                    84381.448 / 3600.0 * mathematical_constants::PI / 180.0,
+                    Eigen::Vector3d::UnitX( ) ).toRotationMatrix( );
+    }
+    else
+    {
+        throw std::runtime_error( "Error, frame orientation " + baseFrameOrientation +
+                                  " not supported by Earth rotation model, use J2000 or ECLIPJ2000." );
+    }
+}
+
+//! Get rotation quaternion to target frame from base frame.
+Eigen::Quaterniond EarthRotationalEphemeris::getRotationToTargetFrame(
+        const double secondsSinceEpoch, const double julianDayAtEpoch )
+{
+    Eigen::Matrix3d polarMotionRotation, celestialRotation;
+    double earthRotationAngle;
+    computeRotationComponents( secondsSinceEpoch, julianDayAtEpoch,
+                               polarMotionRotation, earthRotationAngle, celestialRotation );
+
+    return Eigen::Quaterniond( polarMotionRotation *
+                               Eigen::AngleAxisd( -earthRotationAngle, Eigen::Vector3d::UnitZ( ) ) *
+                               celestialRotation );
+}
+
+//! Function to calculate the derivative of the rotation matrix from original frame to target frame.
+Eigen::Matrix3d EarthRotationalEphemeris::getDerivativeOfRotationToTargetFrame(
+        const double secondsSinceEpoch, const double julianDayAtEpoch )
+{
+    Eigen::Quaterniond rotationToTargetFrame;
+    Eigen::Matrix3d rotationToTargetFrameDerivative;
+    Eigen::Vector3d angularVelocityVectorInBaseFrame;
+    getFullRotationalQuantitiesToTargetFrame( rotationToTargetFrame, rotationToTargetFrameDerivative,
+                                              angularVelocityVectorInBaseFrame, secondsSinceEpoch,
+                                              julianDayAtEpoch );
+    return rotationToTargetFrameDerivative;
+}
+
+//! Function to calculate the full rotational state at given time
+void EarthRotationalEphemeris::getFullRotationalQuantitiesToTargetFrame(
+        Eigen::Quaterniond& currentRotationToLocalFrame,
+        Eigen::Matrix3d& currentRotationToLocalFrameDerivative,
+        Eigen::Vector3d& currentAngularVelocityVectorInGlobalFrame,
+        const double secondsSinceEpoch, const double julianDayAtEpoch )
+{
+    Eigen::Matrix3d polarMotionRotation, celestialRotation;
+    double earthRotationAngle;
+    computeRotationComponents( secondsSinceEpoch, julianDayAtEpoch,
+                               polarMotionRotation, earthRotationAngle, celestialRotation );
+
+    // Compute Earth rotation matrix R3(ERA) and its derivative.
+    const double cosineOfAngle = std::cos( earthRotationAngle );
+    const double sineOfAngle = std::sin( earthRotationAngle );
+    Eigen::Matrix3d earthRotationMatrix, earthRotationMatrixDerivative;
+    earthRotationMatrix << cosineOfAngle, sineOfAngle, 0.0,
+            -sineOfAngle, cosineOfAngle, 0.0,
+            0.0, 0.0, 1.0;
+    earthRotationMatrixDerivative << -sineOfAngle, cosineOfAngle, 0.0,
+            -cosineOfAngle, -sineOfAngle, 0.0,
+            0.0, 0.0, 0.0;
+    earthRotationMatrixDerivative *= reference_frames::EARTH_ROTATION_ANGLE_RATE;
+
+    const Eigen::Matrix3d rotationToTargetFrame = polarMotionRotation * earthRotationMatrix * celestialRotation;
+    currentRotationToLocalFrame = Eigen::Quaterniond( rotationToTargetFrame );
+    currentRotationToLocalFrameDerivative = polarMotionRotation * earthRotationMatrixDerivative * celestialRotation;
+
+    // Angular velocity is along the celestial intermediate pole.
+    currentAngularVelocityVectorInGlobalFrame = reference_frames::EARTH_ROTATION_ANGLE_RATE *
+            celestialRotation.transpose( ).col( 2 );
+}
+
+//! Function to compute the rotation matrices from which the rotation to the target frame is composed.
+void EarthRotationalEphemeris::computeRotationComponents(
+        const double secondsSinceEpoch,
+        const double julianDayAtEpoch,
+        Eigen::Matrix3d& polarMotionRotation,
+        double& earthRotationAngle,
+        Eigen::Matrix3d& celestialRotation )
+{
+    // Set number of seconds since J2000.
+    double secondsSinceJ2000 = secondsSinceEpoch;
+    if ( julianDayAtEpoch != basic_astrodynamics::JULIAN_DAY_ON_J2000 )
+    {
+        secondsSinceJ2000 -= ( basic_astrodynamics::JULIAN_DAY_ON_J2000 - julianDayAtEpoch )
+                * physical_constants::JULIAN_DAY;
+    }
+
+    // Convert TDB to TT, using the inverse of the approximate TT to TDB conversion.
+    const double ttSecondsSinceJ2000 =
+            2.0 * secondsSinceJ2000 - basic_astrodynamics::approximateConvertTTtoTDB( secondsSinceJ2000 );
+    const double ttCenturiesSinceJ2000 = ttSecondsSinceJ2000 / ( 100.0 * physical_constants::JULIAN_YEAR );
+
+    // Retrieve Earth orientation parameters.
+    double ut1MinusTt;
+    Eigen::Vector2d polarMotion = Eigen::Vector2d::Zero( );
+    Eigen::Vector2d celestialPoleOffsets = Eigen::Vector2d::Zero( );
+    if( earthOrientationParameters_ != NULL )
+    {
+        const Eigen::Matrix< double, 5, 1 > currentParameters =
+                earthOrientationParameters_->getEarthOrientationParameters( ttSecondsSinceJ2000 );
+        polarMotion = currentParameters.segment( 0, 2 );
+        ut1MinusTt = currentParameters( 2 );
+        celestialPoleOffsets = currentParameters.segment( 3, 2 );
+    }
+    else
+    {
+        // Set UT1 equal to UTC, retrieving TAI-UTC at the (approximate) current UTC.
+        const double ttModifiedJulianDay = ttSecondsSinceJ2000 / physical_constants::JULIAN_DAY +
+                basic_astrodynamics::JULIAN_DAY_ON_J2000 - basic_astrodynamics::JULIAN_DAY_AT_0_MJD;
+        const double approximateUtcModifiedJulianDay = ttModifiedJulianDay -
+                ( basic_astrodynamics::TT_MINUS_TAI + basic_astrodynamics::getTaiMinusUtc( ttModifiedJulianDay ) ) /
+                physical_constants::JULIAN_DAY;
+        ut1MinusTt = -basic_astrodynamics::TT_MINUS_TAI -
+                basic_astrodynamics::getTaiMinusUtc( approximateUtcModifiedJulianDay );
+    }
+
+    // Compute celestial and terrestrial parts of the rotation, and Earth rotation angle.
+    const Eigen::Vector3d celestialPoleAndOriginLocator = getCelestialPoleAndOriginLocator( ttSecondsSinceJ2000 );
+    celestialRotation = reference_frames::calculateCelestialToIntermediateRotationMatrix(
+                celestialPoleAndOriginLocator( 0 ) + celestialPoleOffsets( 0 ),
+                celestialPoleAndOriginLocator( 1 ) + celestialPoleOffsets( 1 ),
+                celestialPoleAndOriginLocator( 2 ) ) * baseFrameToJ2000Rotation_;
+    polarMotionRotation = reference_frames::calculatePolarMotionRotationMatrix(
+                polarMotion( 0 ), polarMotion( 1 ),
+                reference_frames::calculateTerrestrialIntermediateOriginLocator( ttCenturiesSinceJ2000 ) );
+    earthRotationAngle = reference_frames::calculateEarthRotationAngle( ttSecondsSinceJ2000 + ut1MinusTt );
+}
+
+//! Function to retrieve the (interpolated) position of the celestial pole and the CIO locator.
+Eigen::Vector3d EarthRotationalEphemeris::getCelestialPoleAndOriginLocator( const double ttSecondsSinceJ2000 )
+{
+    const double secondsPerCentury = 100.0 * physical_constants::JULIAN_YEAR;
+
+    // Evaluate model directly if no interpolation is used.
+    if( !( precessionNutationUpdateInterval_ > 0.0 ) )
+    {
+        const double ttCenturiesSinceJ2000 = ttSecondsSinceJ2000 / secondsPerCentury;
+        const Eigen::Vector2d celestialPolePosition =
+                reference_frames::calculateCelestialIntermediatePolePosition( ttCenturiesSinceJ2000 );
+        return ( Eigen::Vector3d( ) << celestialPolePosition,
+                 reference_frames::calculateCelestialIntermediateOriginLocator(
+                     ttCenturiesSinceJ2000, celestialPolePosition( 0 ), celestialPolePosition( 1 ) ) ).finished( );
+    }
+
+    // Update cached nodes of current thread if required, reusing the previous upper node when moving forward by a
+    // single node.
+    PrecessionNutationNodes& nodes = getThreadLocalPrecessionNutationNodes( nodeCacheOwnerIdentifier_ );
+    const double currentNodeIndex = std::floor( ttSecondsSinceJ2000 / precessionNutationUpdateInterval_ );
+    if( currentNodeIndex != nodes.lowerNodeIndex_ )
+    {
+        const bool reuseUpperNode = ( currentNodeIndex == nodes.lowerNodeIndex_ + 1.0 );
+        nodes.lowerNodeIndex_ = currentNodeIndex;
+        for( int i = ( reuseUpperNode ? 1 : 0 ); i < 2; i++ )
+        {
+            const double nodeCenturiesSinceJ2000 =
+                    ( currentNodeIndex + static_cast< double >( i ) ) * precessionNutationUpdateInterval_ /
+                    secondsPerCentury;
+            const Eigen::Vector2d celestialPolePosition =
+                    reference_frames::calculateCelestialIntermediatePolePosition( nodeCenturiesSinceJ2000 );
+            const Eigen::Vector3d nodeValues = ( Eigen::Vector3d( ) << celestialPolePosition,
+                                                 reference_frames::calculateCelestialIntermediateOriginLocator(
+                                                     nodeCenturiesSinceJ2000, celestialPolePosition( 0 ),
+                                                     celestialPolePosition( 1 ) ) ).finished( );
+            if( i == 0 )
+            {
+                nodes.lowerNodeValues_ = nodeValues;
+            }
+            else
+            {
+                if( reuseUpperNode )
+                {
+                    nodes.lowerNodeValues_ = nodes.upperNodeValues_;
+                }
+                nodes.upperNodeValues_ = nodeValues;
+            }
+        }
+    }
+
+    // Interpolate linearly between nodes.
+    const double fractionOfInterval =
+            ttSecondsSinceJ2000 / precessionNutationUpdateInterval_ - nodes.lowerNodeIndex_;
+    return nodes.lowerNodeValues_ + fractionOfInterval * ( nodes.upperNodeValues_ - nodes.lowerNodeValues_ );
+}
+
+} // namespace ephemerides
+
+} // namespace tudat
@@ -0,0 +1,259 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Petit, G., Luzum, B. (eds.), IERS Conventions (2010), IERS Technical Note 36, 2010.
+ */
+
+#ifndef TUDAT_EARTH_ROTATIONAL_EPHEMERIS_H
+#define TUDAT_EARTH_ROTATIONAL_EPHEMERIS_H
+
+#include <limits>
+#include <string>
+
+#include <boost/shared_ptr.hpp>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include "Tudat/Astrodynamics/Ephemerides/earthOrientationParameters.h"
+#include "Tudat/Astrodynamics/Ephemerides/rotationalEphemeris.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Cached nodes of the precession-nutation model, between which its results are interpolated.
+/*!
+ *  Cached nodes of the precession-nutation model, i.e. the position of the celestial intermediate pole X, Y and the
+ *  CIO locator s at two subsequent multiples of the update interval, between which these quantities are interpolated
+ *  linearly by the EarthRotationalEphemeris.
+ */
+class PrecessionNutationNodes
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor, initializes the nodes to denote that no values have been computed.
+     */
+    PrecessionNutationNodes( )
+    {
+        reset( );
+    }
+
+    //! Function to reset the nodes.
+    /*!
+     *  Function to reset the nodes, so that the values are recomputed upon the next evaluation.
+     */
+    void reset( )
+    {
+        lowerNodeIndex_ = std::numeric_limits< double >::quiet_NaN( );
+    }
+
+    //! Index (time divided by update interval) of the lower node (NaN if no values have been computed).
+    double lowerNodeIndex_;
+
+    //! Celestial pole position X, Y and CIO locator s at the lower node.
+    Eigen::Vector3d lowerNodeValues_;
+
+    //! Celestial pole position X, Y and CIO locator s at the upper node.
+    Eigen::Vector3d upperNodeValues_;
+};
+
+//! Function to retrieve the thread-local precession-nutation nodes of an Earth rotational ephemeris.
+/*!
+ *  Function to retrieve the thread-local precession-nutation nodes of an Earth rotational ephemeris. In the same
+ *  manner as the thread-local cursors of the lookup schemes (see interpolators::getThreadLocalLookUpSchemeCursor),
+ *  the nodes are stored in a fixed-size cache for each thread, indexed by the identifier of their owner. If the entry
+ *  for the owner is occupied by the nodes of another owner, reset nodes are returned.
+ *  \param ownerIdentifier Identifier of Earth rotational ephemeris for which the nodes are to be retrieved (see
+ *  interpolators::generateLookUpSchemeCursorOwnerIdentifier).
+ *  \return Nodes of the current thread for the given owner.
+ */
+PrecessionNutationNodes& getThreadLocalPrecessionNutationNodes( const unsigned long long ownerIdentifier );
+
+//! Class to compute the high-precision rotation of the Earth, according to the IERS Conventions 2010.
+/*!
+ *  Class to compute the rotation from the GCRS (or an ecliptic frame derived from it) to the ITRS, using the
+ *  CIO-based transformation of the IERS Conventions 2010 (eq. 5.1): R = W(t) R3(ERA) Q(t), with the IAU 2006/2000A
+ *  precession-nutation model (Q), the Earth rotation angle (ERA) and polar motion (W).
+ *
+ *  As the precession-nutation model (1365 nutation terms) is expensive to evaluate, and varies slowly, the position
+ *  of the celestial intermediate pole (X, Y) and the CIO locator (s) are only evaluated at a fixed cadence, and
+ *  interpolated linearly in between (with an error of roughly 10 microarcseconds for a cadence of one hour). The
+ *  values at the two nodes bracketing the most recent evaluation are cached (separately for each thread), so that for
+ *  subsequent evaluations (e.g. during a numerical propagation) only the Earth rotation angle and polar motion have to
+ *  be recomputed. A
+ *  non-positive cadence results in the direct evaluation of the precession-nutation model at each call.
+ *
+ *  Earth orientation parameters (polar motion, UT1-UTC and celestial pole offsets) are interpolated from tabulated
+ *  values, if provided. If not, polar motion and celestial pole offsets are neglected and UT1 is set equal to UTC
+ *  (with TAI-UTC retrieved from a table of leap seconds), which results in errors of up to roughly 1 arcsecond.
+ *
+ *  The input times of all functions are TDB, which is converted to TT using the approximate (1.7 ms amplitude)
+ *  relation between the two. In the computation of the time derivative of the rotation matrix, only the Earth
+ *  rotation is taken into account, the rates of change of the precession-nutation and polar motion matrices (which
+ *  are roughly seven orders of magnitude smaller) are neglected. As the cached values are stored locally to each
+ *  thread, the ephemeris may be used concurrently by several threads.
+ */
+class EarthRotationalEphemeris: public RotationalEphemeris
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor, sets the Earth orientation parameters and the cadence at which the precession-nutation model is
+     *  evaluated.
+     *  \param earthOrientationParameters Tabulated Earth orientation parameters. If NULL, polar motion and celestial
+     *  pole offsets are neglected, and UT1 is set equal to UTC.
+     *  \param precessionNutationUpdateInterval Time interval (in seconds) at which the precession-nutation model is
+     *  evaluated (and in between which its results are interpolated). If zero or negative, the model is evaluated
+     *  directly at each call.
+     *  \param baseFrameOrientation Base frame identifier, J2000 (taken to coincide with the GCRS) or ECLIPJ2000.
+     *  \param targetFrameOrientation Target frame identifier.
+     */
+    EarthRotationalEphemeris(
+            const boost::shared_ptr< EarthOrientationParameters > earthOrientationParameters =
+            boost::shared_ptr< EarthOrientationParameters >( ),
+            const double precessionNutationUpdateInterval = 3600.0,
+            const std::string& baseFrameOrientation = "J2000",
+            const std::string& targetFrameOrientation = "ITRS" );
+
+    //! Get rotation quaternion from target frame to base frame.
+    /*!
+     *  Function to calculate the rotation quaternion from target frame to base frame at specified time.
+     *  \param secondsSinceEpoch Seconds since Julian day epoch specified by 2nd argument.
+     *  \param julianDayAtEpoch Reference epoch in Julian days from which number of seconds are counted.
+     *  \return Rotation quaternion computed.
+     */
+    Eigen::Quaterniond getRotationToBaseFrame(
+            const double secondsSinceEpoch,
+            const double julianDayAtEpoch = basic_astrodynamics::JULIAN_DAY_ON_J2000 )
+    {
+        return getRotationToTargetFrame( secondsSinceEpoch, julianDayAtEpoch ).inverse( );
+    }
+
+    //! Get rotation quaternion to target frame from base frame.
+    /*!
+     *  Function to calculate the rotation quaternion to target frame from base frame at specified time.
+     *  \param secondsSinceEpoch Seconds since Julian day epoch specified by 2nd argument.
+     *  \param julianDayAtEpoch Reference epoch in Julian days from which number of seconds are counted.
+     *  \return Rotation quaternion computed.
+     */
+    Eigen::Quaterniond getRotationToTargetFrame(
+            const double secondsSinceEpoch,
+            const double julianDayAtEpoch = basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+
+    //! Function to calculate the derivative of the rotation matrix from target frame to original frame.
+    /*!
+     *  Function to calculate the derivative of the rotation matrix from target frame to original frame at specified
+     *  time.
+     *  \param secondsSinceEpoch Seconds since Julian day epoch specified by 2nd argument.
+     *  \param julianDayAtEpoch Reference epoch in Julian days from which number of seconds are counted.
+     *  \return Derivative of rotation from target (typically local) to original (typically global) frame at
+     *  specified time.
+     */
+    Eigen::Matrix3d getDerivativeOfRotationToBaseFrame(
+            const double secondsSinceEpoch,
+            const double julianDayAtEpoch = basic_astrodynamics::JULIAN_DAY_ON_J2000 )
+    {
+        return getDerivativeOfRotationToTargetFrame( secondsSinceEpoch, julianDayAtEpoch ).transpose( );
+    }
+
+    //! Function to calculate the derivative of the rotation matrix from original frame to target frame.
+    /*!
+     *  Function to calculate the derivative of the rotation matrix from original frame to target frame at specified
+     *  time.
+     *  \param secondsSinceEpoch Seconds since Julian day epoch specified by 2nd argument.
+     *  \param julianDayAtEpoch Reference epoch in Julian days from which number of seconds are counted.
+     *  \return Derivative of rotation from original (typically global) to target (typically local) frame at
+     *  specified time.
+     */
+    Eigen::Matrix3d getDerivativeOfRotationToTargetFrame(
+            const double secondsSinceEpoch,
+            const double julianDayAtEpoch = basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+
+    //! Function to calculate the full rotational state at given time
+    /*!
+     *  Function to calculate the full rotational state at given time (rotation matrix, derivative of rotation matrix
+     *  and angular velocity vector), from a single evaluation of the Earth orientation.
+     *  \param currentRotationToLocalFrame Current rotation to local frame (returned by reference)
+     *  \param currentRotationToLocalFrameDerivative Current derivative of rotation matrix to local frame
+     *  (returned by reference)
+     *  \param currentAngularVelocityVectorInGlobalFrame Current angular velocity vector, expressed in global frame
+     *  (returned by reference)
+     *  \param secondsSinceEpoch Seconds since Julian day epoch specified by 2nd argument
+     *  \param julianDayAtEpoch Reference epoch in Julian days from which number of seconds are counted.
+     */
+    void getFullRotationalQuantitiesToTargetFrame(
+            Eigen::Quaterniond& currentRotationToLocalFrame,
+            Eigen::Matrix3d& currentRotationToLocalFrameDerivative,
+            Eigen::Vector3d& currentAngularVelocityVectorInGlobalFrame,
+            const double secondsSinceEpoch,
+            const double julianDayAtEpoch = basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+
+    //! Function to retrieve the time interval at which the precession-nutation model is evaluated.
+    /*!
+     *  Function to retrieve the time interval at which the precession-nutation model is evaluated.
+     *  \return Time interval at which the precession-nutation model is evaluated.
+     */
+    double getPrecessionNutationUpdateInterval( )
+    {
+        return precessionNutationUpdateInterval_;
+    }
+
+private:
+
+    //! Function to compute the rotation matrices from which the rotation to the target frame is composed.
+    /*!
+     *  Function to compute the rotation matrices from which the rotation to the target frame is composed, i.e.
+     *  R = polarMotionRotation * R3(earthRotationAngle) * celestialRotation.
+     *  \param secondsSinceEpoch Seconds since Julian day epoch specified by 2nd argument.
+     *  \param julianDayAtEpoch Reference epoch in Julian days from which number of seconds are counted.
+     *  \param polarMotionRotation Rotation from TIRS to target frame (returned by reference).
+     *  \param earthRotationAngle Earth rotation angle (returned by reference).
+     *  \param celestialRotation Rotation from base frame to CIRS (returned by reference).
+     */
+    void computeRotationComponents(
+            const double secondsSinceEpoch,
+            const double julianDayAtEpoch,
+            Eigen::Matrix3d& polarMotionRotation,
+            double& earthRotationAngle,
+            Eigen::Matrix3d& celestialRotation );
+
+    //! Function to retrieve the (interpolated) position of the celestial pole and the CIO locator.
+    /*!
+     *  Function to retrieve the position of the celestial intermediate pole X, Y and the CIO locator s, interpolated
+     *  from the values at the cached nodes (which are updated if required).
+     *  \param ttSecondsSinceJ2000 Time (TT) in seconds since J2000.
+     *  \return Celestial pole position X, Y and CIO locator s.
+     */
+    Eigen::Vector3d getCelestialPoleAndOriginLocator( const double ttSecondsSinceJ2000 );
+
+    //! Tabulated Earth orientation parameters (NULL if not used).
+    boost::shared_ptr< EarthOrientationParameters > earthOrientationParameters_;
+
+    //! Time interval at which the precession-nutation model is evaluated.
+    double precessionNutationUpdateInterval_;
+
+    //! Rotation from base frame to J2000 (GCRS).
+    Eigen::Matrix3d baseFrameToJ2000Rotation_;
+
+    //! Identifier by which the thread-local cached nodes of the precession-nutation model are retrieved.
+    unsigned long long nodeCacheOwnerIdentifier_;
+};
+
+} // namespace ephemerides
+
+} // namespace tudat
+
+#endif // TUDAT_EARTH_ROTATIONAL_EPHEMERIS_H
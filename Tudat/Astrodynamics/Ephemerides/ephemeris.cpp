@@ -28,6 +28,19 @@ Eigen::Matrix< long double, 6, 1 > Ephemeris::getTemplatedStateFromEphemeris( co
     return getCartesianLongStateFromEphemeris( time, basic_astrodynamics::JULIAN_DAY_ON_J2000 );
 }
 
+//! Get states from ephemeris at a list of epochs.
+void Ephemeris::getCartesianStatesFromEphemeris(
+        const std::vector< double >& secondsSinceEpoch,
+        Eigen::Matrix< double, 6, Eigen::Dynamic >& statesFromEphemeris,
+        const double julianDayAtEpoch )
+{
+    statesFromEphemeris.resize( 6, secondsSinceEpoch.size( ) );
+    for( unsigned int i = 0; i < secondsSinceEpoch.size( ); i++ )
+    {
+        statesFromEphemeris.col( i ) = getCartesianStateFromEphemeris( secondsSinceEpoch[ i ], julianDayAtEpoch );
+    }
+}
+
 //! Function to compute the relative state from two state functions.
 void getRelativeState(
         basic_mathematics::Vector6d& relativeState,
@@ -40,6 +40,8 @@
 #ifndef TUDAT_EPHEMERIS_H
 #define TUDAT_EPHEMERIS_H
 
+#include <vector>
+
 #include <boost/shared_ptr.hpp>
 #include <boost/function.hpp>
 
@@ -106,6 +108,21 @@ public:
         return getCartesianStateFromEphemeris( secondsSinceEpoch, julianDayAtEpoch ).cast< long double >( );
     }
 
+    //! Get states from ephemeris at a list of epochs.
+    /*!
+     * Computes the states from ephemeris at a list of epochs. By default, this function calls
+     * getCartesianStateFromEphemeris for each epoch. It may be overridden by derived classes to
+     * evaluate the states more efficiently, by sharing the work that is common to all epochs.
+     * \param secondsSinceEpoch Seconds since epoch at which ephemeris is to be evaluated.
+     * \param statesFromEphemeris States from ephemeris (returned by reference), with the state at
+     * secondsSinceEpoch[ i ] in column i.
+     * \param julianDayAtEpoch Reference epoch in Julian day.
+     */
+    virtual void getCartesianStatesFromEphemeris(
+            const std::vector< double >& secondsSinceEpoch,
+            Eigen::Matrix< double, 6, Eigen::Dynamic >& statesFromEphemeris,
+            const double julianDayAtEpoch = basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+
     //! Get state from ephemeris, with state scalar as template type.
     /*!
      * Returns state from ephemeris (state scalar as template type) at given time.
@@ -155,52 +155,105 @@ void ReferenceFrameManager::setEphemerides(
                         "Error, multiple reference frame orientations of ephemerides currently not supported" );
         }
     }
+
+    // Assign identifiers to all frames (global base frame first), and set their properties per identifier.
+    frameIds_.clear( );
+    frameNames_.clear( );
+    frameIds_[ getBaseFrameName( ) ] = 0;
+    frameNames_.push_back( getBaseFrameName( ) );
+    for( unsigned int i = 0; i < baseFrameList_.size( ); i++ )
+    {
+        for( std::map< std::string, std::string >::const_iterator frameIterator = baseFrameList_[ i ].begin( );
+             frameIterator != baseFrameList_[ i ].end( ); frameIterator++ )
+        {
+            frameIds_[ frameIterator->first ] = frameNames_.size( );
+            frameNames_.push_back( frameIterator->first );
+        }
+    }
+
+    frameLevels_.resize( frameNames_.size( ) );
+    baseFrameIds_.resize( frameNames_.size( ) );
+    frameEphemerides_.resize( frameNames_.size( ) );
+    frameLevels_[ 0 ] = -1;
+    baseFrameIds_[ 0 ] = -1;
+    for( unsigned int i = 1; i < frameNames_.size( ); i++ )
+    {
+        frameLevels_[ i ] = frameIndexList_.at( frameNames_[ i ] );
+        baseFrameIds_[ i ] = frameIds_.at( baseFrameList_[ frameLevels_[ i ] ].at( frameNames_[ i ] ) );
+        frameEphemerides_[ i ] = availableEphemerides_.at( frameNames_[ i ] );
+    }
+
+    translationChainCache_.clear( );
 }
 
 
-//! Returns an ephemeris along a single line of the hierarchy tree.
-std::vector< boost::shared_ptr< Ephemeris > > ReferenceFrameManager::getDirectEphemerisFromLowerToUpperFrame(
-        const std::string& lowerFrame, const std::string& upperFrame )
+//! Function to retrieve the chain of ephemerides that gives the state of a body w.r.t. an origin.
+boost::shared_ptr< FrameTranslationChain > ReferenceFrameManager::getFrameTranslationChain(
+        const std::string& origin, const std::string& body )
 {
-    // Get indices of frames.
-    int upperIndex = frameIndexList_.at( upperFrame );
-    int lowerIndex = frameIndexList_.at( lowerFrame );
+    const int originId = getFrameId( origin );
+    const int bodyId = getFrameId( body );
 
-    std::vector< boost::shared_ptr< Ephemeris > > ephemerisList;
+    // Check if chain has already been created.
+    std::map< std::pair< int, int >, boost::shared_ptr< FrameTranslationChain > >::const_iterator chainIterator =
+            translationChainCache_.find( std::make_pair( originId, bodyId ) );
+    if( chainIterator != translationChainCache_.end( ) )
+    {
+        return chainIterator->second;
+    }
 
-    // Check validity of input (i.e. upper > lower)
-    if( upperIndex < lowerIndex )
+    // Move down from body and origin to nearest common frame, storing ephemerides on path from
+    // body (to be added) and on path from origin (to be subtracted).
+    std::vector< int > bodyPathIds, originPathIds;
+    int currentBodyPathId = bodyId;
+    int currentOriginPathId = originId;
+    while( currentBodyPathId != currentOriginPathId )
     {
-        throw std::runtime_error(
-            "Error when making direct ephemeris link in frame manager, upper index is smaller than lower index" );
+        if( frameLevels_[ currentBodyPathId ] >= frameLevels_[ currentOriginPathId ] )
+        {
+            bodyPathIds.push_back( currentBodyPathId );
+            currentBodyPathId = baseFrameIds_[ currentBodyPathId ];
+        }
+        else
+        {
+            originPathIds.push_back( currentOriginPathId );
+            currentOriginPathId = baseFrameIds_[ currentOriginPathId ];
+        }
     }
-    // If frames are not equal, make list of ephemeris
-    else if( upperIndex != lowerIndex )
+
+    // Create flattened chain of ephemerides.
+    std::vector< int > frameIds;
+    std::vector< boost::shared_ptr< Ephemeris > > ephemerides;
+    std::vector< bool > isStateAdded;
+    for( unsigned int i = 0; i < bodyPathIds.size( ); i++ )
     {
-        // Start list creation at upper frame.
-        int currentIndex = upperIndex;
-        std::string currentFrame = upperFrame;
+        frameIds.push_back( bodyPathIds.at( i ) );
+        ephemerides.push_back( frameEphemerides_.at( bodyPathIds.at( i ) ) );
+        isStateAdded.push_back( true );
+    }
+    for( unsigned int i = 0; i < originPathIds.size( ); i++ )
+    {
+        frameIds.push_back( originPathIds.at( i ) );
+        ephemerides.push_back( frameEphemerides_.at( originPathIds.at( i ) ) );
+        isStateAdded.push_back( false );
+    }
 
-        // Continue while lower frame is reached
-        while( currentIndex > lowerIndex )
-        {
-            // Check whether current frame is consistent with current frame index.
-            if( frameIndexList_[ currentFrame ] != currentIndex )
-            {
-                throw std::runtime_error(
-                            "Error when making direct constituent ephemeris, frame index inconsistent." );
-            }
+    boost::shared_ptr< FrameTranslationChain > translationChain =
+            boost::make_shared< FrameTranslationChain >( frameIds, ephemerides, isStateAdded );
+    translationChainCache_[ std::make_pair( originId, bodyId ) ] = translationChain;
 
-            // Add base frame of current frame.
-            std::string currentBase = baseFrameList_[ currentIndex ][ currentFrame ];
-            ephemerisList.push_back( availableEphemerides_[ currentFrame ] );
+    return translationChain;
+}
 
-            // Decrement frame level and move to one frame level lower.
-            currentIndex--;
-            currentFrame = currentBase;
-        }
+//! Function to retrieve the identifier of a frame.
+int ReferenceFrameManager::getFrameId( const std::string& frame )
+{
+    std::map< std::string, int >::const_iterator frameIdIterator = frameIds_.find( frame );
+    if( frameIdIterator == frameIds_.end( ) )
+    {
+        throw std::runtime_error( "Error, frame " + frame + " not found in frame manager" );
     }
-    return ephemerisList;
+    return frameIdIterator->second;
 }
 
 //! Return the level at which the requested ephemeris is in the hierarchy.
@@ -45,6 +45,108 @@ bool isFrameInertial( const std::string& frame );
  */
 std::string getBaseFrameName( );
 
+//! Class containing the chain of ephemerides that gives the state of a body w.r.t. an origin.
+/*!
+ *  Class containing the (flattened) chain of ephemerides that gives the state of a body w.r.t. an
+ *  origin, as determined by the ReferenceFrameManager. The state of the body w.r.t. the origin is
+ *  the sum of the states of the ephemerides on the path from the body down to the nearest common
+ *  frame, minus the sum of the states of the ephemerides on the path from the origin down to the
+ *  nearest common frame.
+ */
+class FrameTranslationChain
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor.
+     *  \param frameIds Identifiers (in frame manager) of the frames of which the ephemerides are
+     *  in the chain.
+     *  \param ephemerides Ephemerides in the chain.
+     *  \param isStateAdded List of booleans denoting whether the state of the corresponding
+     *  ephemeris is to be added (true) or subtracted (false).
+     */
+    FrameTranslationChain( const std::vector< int >& frameIds,
+                           const std::vector< boost::shared_ptr< Ephemeris > >& ephemerides,
+                           const std::vector< bool >& isStateAdded ):
+        frameIds_( frameIds ), ephemerides_( ephemerides ), isStateAdded_( isStateAdded ){ }
+
+    //! Function to compute the state of the body w.r.t. the origin.
+    /*!
+     *  Function to compute the state of the body w.r.t. the origin.
+     *  \param time Time at which state is to be computed.
+     *  \return State of the body w.r.t. the origin.
+     */
+    template< typename StateScalarType = double, typename TimeType = double >
+    Eigen::Matrix< StateScalarType, 6, 1 > getState( const TimeType time ) const
+    {
+        Eigen::Matrix< StateScalarType, 6, 1 > state = Eigen::Matrix< StateScalarType, 6, 1 >::Zero( );
+        for( unsigned int i = 0; i < ephemerides_.size( ); i++ )
+        {
+            if( isStateAdded_[ i ] )
+            {
+                state += ephemerides_[ i ]->getTemplatedStateFromEphemeris< StateScalarType, TimeType >( time );
+            }
+            else
+            {
+                state -= ephemerides_[ i ]->getTemplatedStateFromEphemeris< StateScalarType, TimeType >( time );
+            }
+        }
+        return state;
+    }
+
+    //! Function to retrieve the number of ephemerides in the chain.
+    /*!
+     *  Function to retrieve the number of ephemerides in the chain.
+     *  \return Number of ephemerides in the chain.
+     */
+    unsigned int getNumberOfEphemerides( ) const
+    {
+        return ephemerides_.size( );
+    }
+
+    //! Function to retrieve the identifiers of the frames of which the ephemerides are in the chain.
+    /*!
+     *  Function to retrieve the identifiers of the frames of which the ephemerides are in the chain.
+     *  \return Identifiers of the frames of which the ephemerides are in the chain.
+     */
+    const std::vector< int >& getFrameIds( ) const
+    {
+        return frameIds_;
+    }
+
+    //! Function to retrieve the ephemerides in the chain.
+    /*!
+     *  Function to retrieve the ephemerides in the chain.
+     *  \return Ephemerides in the chain.
+     */
+    const std::vector< boost::shared_ptr< Ephemeris > >& getEphemerides( ) const
+    {
+        return ephemerides_;
+    }
+
+    //! Function to retrieve whether the state of each ephemeris is added or subtracted.
+    /*!
+     *  Function to retrieve whether the state of each ephemeris is added (true) or subtracted (false).
+     *  \return List of booleans denoting whether the state of each ephemeris is added.
+     */
+    const std::vector< bool >& getIsStateAdded( ) const
+    {
+        return isStateAdded_;
+    }
+
+private:
+
+    //! Identifiers (in frame manager) of the frames of which the ephemerides are in the chain.
+    std::vector< int > frameIds_;
+
+    //! Ephemerides in the chain.
+    std::vector< boost::shared_ptr< Ephemeris > > ephemerides_;
+
+    //! List of booleans denoting whether the state of each ephemeris is added (true) or subtracted (false).
+    std::vector< bool > isStateAdded_;
+};
+
 
 //! Class to retrieve translation functions between different frames
 /*!
@@ -88,75 +190,23 @@ public:
         }
         else
         {
-            // Set frames between which ephemeris must be created.
-            std::vector< std::string > framesToCheck;
-            framesToCheck.push_back( origin );
-            framesToCheck.push_back( body );
+            // Retrieve (cached) chain of ephemerides between frames.
+            boost::shared_ptr< FrameTranslationChain > translationChain =
+                    getFrameTranslationChain( origin, body );
 
-            // Find nearest common frame between frames.
-            std::pair< std::string, int > nearestCommonFrame = getNearestCommonFrame( framesToCheck );
-
-            // Initialize list of ephemeris functions for composite ephemeris creation
+            // Initialize list of ephemeris functions for composite ephemeris creation, with states
+            // of ephemerides of frames on path to body added, and those on path to origin subtracted.
             std::map< int, std::pair< boost::function< StateType( const TimeType& ) >, bool > >
                  totalEphemerisList;
-
-            // If body is nearest common frame, get set of ephemeris and set to subtract them when
-            // making composite ephemeris.
-            std::vector< boost::shared_ptr< Ephemeris > > ephemerisList;
-            if( nearestCommonFrame.first == body )
-            {
-                ephemerisList = getDirectEphemerisFromLowerToUpperFrame( body, origin );
-                for( unsigned int i = 0; i < ephemerisList.size( ); i++ )
-                {
-                    totalEphemerisList[ i ] = std::make_pair(
-                                boost::bind( &Ephemeris::getTemplatedStateFromEphemeris
-                                             < StateScalarType, TimeType >,
-                                             ephemerisList[ i ], _1 ), false );
-                }
-            }
-            // If origin is nearest common frame, get set of ephemeris and set to add them when
-            // making composite ephemeris.
-            else if( nearestCommonFrame.first == origin )
+            for( unsigned int i = 0; i < translationChain->getNumberOfEphemerides( ); i++ )
             {
-                ephemerisList = getDirectEphemerisFromLowerToUpperFrame( origin, body );
-                for( unsigned int i = 0; i < ephemerisList.size( ); i++ )
-                {
-                    totalEphemerisList[ i ] = std::make_pair(
-                                boost::bind( &Ephemeris::getTemplatedStateFromEphemeris
-                                             < StateScalarType, TimeType >,
-                                             ephemerisList[ i ], _1 ), true );
-                }
-            }
-            // If nearest common frame is neither input, create link from both to nearest common frame.
-            else
-            {
-                // Get set of ephemeris from nearest common frame to body and set to add them when
-                // making composite ephemeris.
-                ephemerisList = getDirectEphemerisFromLowerToUpperFrame( nearestCommonFrame.first, body );
-                for( unsigned int i = 0; i < ephemerisList.size( ); i++ )
-                {
-                    totalEphemerisList[ i ] = std::make_pair(
-                                boost::bind( &Ephemeris::getTemplatedStateFromEphemeris
-                                             < StateScalarType, TimeType >,
-                                             ephemerisList[ i ], _1 ), true );
-                }
-                int firstListSize = ephemerisList.size( );
-
-                // Get set of ephemeris from nearest common frame to origin and set to subtract them
-                // when making composite ephemeris.
-                ephemerisList = getDirectEphemerisFromLowerToUpperFrame( nearestCommonFrame.first, origin );
-                for( unsigned int i = 0; i < ephemerisList.size( ); i++ )
-                {
-                    totalEphemerisList[ i + firstListSize ] = std::make_pair(
-                                boost::bind( &Ephemeris::getTemplatedStateFromEphemeris
-                                             < StateScalarType, TimeType >,
-                                             ephemerisList[ i ], _1 ), false );
-                }
+                totalEphemerisList[ i ] = std::make_pair(
+                            boost::bind( &Ephemeris::getTemplatedStateFromEphemeris
+                                         < StateScalarType, TimeType >,
+                                         translationChain->getEphemerides( ).at( i ), _1 ),
+                            translationChain->getIsStateAdded( ).at( i ) );
             }
 
-            typedef Eigen::Matrix< StateScalarType, 6, 1 > StateType;
-
-
             // Create composite ephemeris
             ephemerisBetweenFrames = boost::make_shared< CompositeEphemeris< TimeType, StateScalarType > >(
                         totalEphemerisList,
@@ -167,6 +217,84 @@ public:
         return ephemerisBetweenFrames;
     }
 
+    //! Function to retrieve the chain of ephemerides that gives the state of a body w.r.t. an origin.
+    /*!
+     *  Function to retrieve the chain of ephemerides that gives the state of a body w.r.t. an
+     *  origin, through their nearest common frame. The chain is determined only once for each
+     *  (origin, body) pair, using the identifiers of the frames, after which it is retrieved from
+     *  a cache. Both the body and the origin must be loaded into the frame manager.
+     *  \param origin Origin of ephemeris
+     *  \param body Body for which ephemeris is requested.
+     *  \return Chain of ephemerides that gives the state of body w.r.t. origin (shared between
+     *  all calls with same input).
+     */
+    boost::shared_ptr< FrameTranslationChain > getFrameTranslationChain(
+            const std::string& origin, const std::string& body );
+
+    //! Function to compute the states of a list of bodies w.r.t. a list of origins at a single time.
+    /*!
+     *  Function to compute the states of a list of bodies w.r.t. a list of origins at a single
+     *  time. The state of each ephemeris that is needed is computed only once, and shared between
+     *  all (origin, body) pairs that require it (e.g. the state of the Earth w.r.t. the Sun is
+     *  computed once when requesting the states of both the Moon and a satellite w.r.t. the Sun).
+     *  \param origins Origins w.r.t. which the states are to be computed.
+     *  \param bodies Bodies for which the states are to be computed (same size as origins).
+     *  \param time Time at which states are to be computed.
+     *  \return States of bodies w.r.t. the corresponding origins.
+     */
+    template< typename StateScalarType = double, typename TimeType = double >
+    std::vector< Eigen::Matrix< StateScalarType, 6, 1 > > getRelativeStates(
+            const std::vector< std::string >& origins, const std::vector< std::string >& bodies,
+            const TimeType time )
+    {
+        typedef Eigen::Matrix< StateScalarType, 6, 1 > StateType;
+
+        if( origins.size( ) != bodies.size( ) )
+        {
+            throw std::runtime_error(
+                        "Error when computing relative states in frame manager, input vector sizes inconsistent" );
+        }
+
+        // Initialize list of ephemeris states, per frame identifier.
+        std::vector< StateType > ephemerisStates( frameNames_.size( ) );
+        std::vector< bool > isEphemerisStateComputed( frameNames_.size( ), false );
+
+        std::vector< StateType > relativeStates( bodies.size( ) );
+        for( unsigned int i = 0; i < bodies.size( ); i++ )
+        {
+            relativeStates[ i ] = StateType::Zero( );
+            if( origins.at( i ) != bodies.at( i ) )
+            {
+                boost::shared_ptr< FrameTranslationChain > translationChain =
+                        getFrameTranslationChain( origins.at( i ), bodies.at( i ) );
+
+                // Add/subtract states of ephemerides in chain, computing each state only once.
+                for( unsigned int j = 0; j < translationChain->getNumberOfEphemerides( ); j++ )
+                {
+                    const int currentFrameId = translationChain->getFrameIds( ).at( j );
+                    if( !isEphemerisStateComputed[ currentFrameId ] )
+                    {
+                        ephemerisStates[ currentFrameId ] =
+                                translationChain->getEphemerides( ).at( j )->
+                                template getTemplatedStateFromEphemeris< StateScalarType, TimeType >( time );
+                        isEphemerisStateComputed[ currentFrameId ] = true;
+                    }
+
+                    if( translationChain->getIsStateAdded( ).at( j ) )
+                    {
+                        relativeStates[ i ] += ephemerisStates[ currentFrameId ];
+                    }
+                    else
+                    {
+                        relativeStates[ i ] -= ephemerisStates[ currentFrameId ];
+                    }
+                }
+            }
+        }
+
+        return relativeStates;
+    }
+
     //! Return the level at which the requested ephemeris is in the hierarchy.
     /*!
      *  Return the level at which the requested ephemeris is in the hierarchy.
@@ -201,6 +329,15 @@ public:
      */
     std::vector< std::string > getEphemerisOrigins( const std::vector< std::string >& bodyList );
 
+    //! Function to retrieve the identifier of a frame.
+    /*!
+     *  Function to retrieve the identifier of a frame, which is used to index the frame properties
+     *  internally. The global base frame has identifier 0.
+     *  \param frame Name of frame for which the identifier is to be retrieved.
+     *  \return Identifier of frame.
+     */
+    int getFrameId( const std::string& frame );
+
 private:
 
     //! Vector of frames with associated base frames, ordered by frame level.
@@ -225,13 +362,23 @@ private:
      */
     std::map< std::string, int > frameIndexList_;
 
-    //! Returns an ephemeris along a single line of the hierarchy tree.
-    /*!
-     *  Returns an ephemeris along a single line of the hierarchy tree, i.e. returned ephemeris
-     *  constituent frame levels must be continuously increasing
-     */
-    std::vector< boost::shared_ptr< Ephemeris > > getDirectEphemerisFromLowerToUpperFrame(
-            const std::string& lowerFrame, const std::string& upperFrame );
+    //! Map giving the identifier for each frame name.
+    std::map< std::string, int > frameIds_;
+
+    //! Names of frames, with the identifier of the frame as index.
+    std::vector< std::string > frameNames_;
+
+    //! Frame levels of frames, with the identifier of the frame as index.
+    std::vector< int > frameLevels_;
+
+    //! Identifiers of base frames of frames, with the identifier of the frame as index (-1 for global base frame).
+    std::vector< int > baseFrameIds_;
+
+    //! Ephemerides of frames, with the identifier of the frame as index (empty for global base frame).
+    std::vector< boost::shared_ptr< Ephemeris > > frameEphemerides_;
+
+    //! Cache of chains of ephemerides, with pairs of identifiers of origin and body as keys.
+    std::map< std::pair< int, int >, boost::shared_ptr< FrameTranslationChain > > translationChainCache_;
 
     //! Function to determine frame levels and base frames of all frames.
     /*!
@@ -275,8 +422,8 @@ getTranslationFunctionsFromIntegrationFrameToEphemerisFrame(
             if( centralBodies.at( i ) != frameManager->getBaseFrameNameOfBody( bodiesToIntegrate.at( i ) ) )
             {
                 translationFunctionMap[ bodiesToIntegrate.at( i ) ] = boost::bind(
-                            &ephemerides::Ephemeris::getTemplatedStateFromEphemeris< StateScalarType, TimeType >,
-                            frameManager->getEphemeris< StateScalarType, TimeType >(
+                            &ephemerides::FrameTranslationChain::getState< StateScalarType, TimeType >,
+                            frameManager->getFrameTranslationChain(
                                 centralBodies.at( i ),
                                 frameManager->getBaseFrameNameOfBody( bodiesToIntegrate.at( i ) )  ), _1 );
             }
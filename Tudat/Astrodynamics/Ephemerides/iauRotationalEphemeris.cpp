@@ -0,0 +1,374 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <stdexcept>
+
+#include <boost/make_shared.hpp>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/unitConversions.h"
+#include "Tudat/Astrodynamics/Ephemerides/iauRotationalEphemeris.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Constructor.
+IauRotationalEphemeris::IauRotationalEphemeris(
+        const Eigen::Vector2d& poleRightAscensionCoefficients,
+        const Eigen::Vector2d& poleDeclinationCoefficients,
+        const Eigen::Vector3d& primeMeridianCoefficients,
+        const Eigen::VectorXd& argumentConstants,
+        const Eigen::VectorXd& argumentRates,
+        const Eigen::VectorXd& rightAscensionAmplitudes,
+        const Eigen::VectorXd& declinationAmplitudes,
+        const Eigen::VectorXd& primeMeridianAmplitudes,
+        const std::string& baseFrameOrientation,
+        const std::string& targetFrameOrientation ):
+    RotationalEphemeris( baseFrameOrientation, targetFrameOrientation ),
+    poleRightAscensionCoefficients_( poleRightAscensionCoefficients ),
+    poleDeclinationCoefficients_( poleDeclinationCoefficients ),
+    primeMeridianCoefficients_( primeMeridianCoefficients ),
+    argumentConstants_( argumentConstants ),
+    argumentRates_( argumentRates ),
+    rightAscensionAmplitudes_( rightAscensionAmplitudes ),
+    declinationAmplitudes_( declinationAmplitudes ),
+    primeMeridianAmplitudes_( primeMeridianAmplitudes )
+{
+    const int numberOfPeriodicTerms = argumentConstants_.rows( );
+    if( argumentRates_.rows( ) != numberOfPeriodicTerms ||
+            rightAscensionAmplitudes_.rows( ) != numberOfPeriodicTerms ||
+            declinationAmplitudes_.rows( ) != numberOfPeriodicTerms ||
+            primeMeridianAmplitudes_.rows( ) != numberOfPeriodicTerms )
+    {
+        throw std::runtime_error( "Error when creating IAU rotation model, number of periodic terms is inconsistent." );
+    }
+
+    if( baseFrameOrientation == "J2000" )
+    {
+        baseFrameToJ2000Rotation_.setIdentity( );
+    }
+    else if( baseFrameOrientation == "ECLIPJ2000" )
+    {
+        // Rotate by obliquity of the ecliptic at J2000 (IAU 1976, as used for the Spice ECLIPJ2000 frame).
+        baseFrameToJ2000Rotation_ = Eigen::AngleAxisd(
+                    84381.448 / 3600.0 * mathematical_constants::PI / 180.0,
+                    Eigen::Vector3d::UnitX( ) ).toRotationMatrix( );
+    }
+    else
+    {
+        throw std::runtime_error( "Error, frame orientation " + baseFrameOrientation +
+                                  " not supported by IAU rotation model, use J2000 or ECLIPJ2000." );
+    }
+}
+
+//! Get rotation quaternion to target frame from base frame.
+Eigen::Quaterniond IauRotationalEphemeris::getRotationToTargetFrame(
+        const double secondsSinceEpoch, const double julianDayAtEpoch )
+{
+    Eigen::Vector3d rotationAngles, rotationAngleRates;
+    getRotationAngles( secondsSinceEpoch, julianDayAtEpoch, rotationAngles, rotationAngleRates );
+
+    Eigen::Matrix3d rotationToTargetFrame, rotationToTargetFrameDerivative;
+    computeRotationAndDerivative( rotationAngles, rotationAngleRates,
+                                  rotationToTargetFrame, rotationToTargetFrameDerivative );
+    return Eigen::Quaterniond( rotationToTargetFrame );
+}
+
+//! Function to calculate the derivative of the rotation matrix from original frame to target frame.
+Eigen::Matrix3d IauRotationalEphemeris::getDerivativeOfRotationToTargetFrame(
+        const double secondsSinceEpoch, const double julianDayAtEpoch )
+{
+    Eigen::Vector3d rotationAngles, rotationAngleRates;
+    getRotationAngles( secondsSinceEpoch, julianDayAtEpoch, rotationAngles, rotationAngleRates );
+
+    Eigen::Matrix3d rotationToTargetFrame, rotationToTargetFrameDerivative;
+    computeRotationAndDerivative( rotationAngles, rotationAngleRates,
+                                  rotationToTargetFrame, rotationToTargetFrameDerivative );
+    return rotationToTargetFrameDerivative;
+}
+
+//! Function to calculate the full rotational state at given time
+void IauRotationalEphemeris::getFullRotationalQuantitiesToTargetFrame(
+        Eigen::Quaterniond& currentRotationToLocalFrame,
+        Eigen::Matrix3d& currentRotationToLocalFrameDerivative,
+        Eigen::Vector3d& currentAngularVelocityVectorInGlobalFrame,
+        const double secondsSinceEpoch, const double julianDayAtEpoch )
+{
+    Eigen::Vector3d rotationAngles, rotationAngleRates;
+    getRotationAngles( secondsSinceEpoch, julianDayAtEpoch, rotationAngles, rotationAngleRates );
+
+    Eigen::Matrix3d rotationToTargetFrame;
+    computeRotationAndDerivative( rotationAngles, rotationAngleRates,
+                                  rotationToTargetFrame, currentRotationToLocalFrameDerivative );
+    currentRotationToLocalFrame = Eigen::Quaterniond( rotationToTargetFrame );
+
+    // Calculate angular velocity vector.
+    currentAngularVelocityVectorInGlobalFrame = getRotationalVelocityVectorInBaseFrameFromMatrices(
+                rotationToTargetFrame, currentRotationToLocalFrameDerivative.transpose( ) );
+}
+
+//! Function to compute the right ascension and declination of the pole and the location of the prime meridian.
+void IauRotationalEphemeris::getRotationAngles(
+        const double secondsSinceEpoch,
+        const double julianDayAtEpoch,
+        Eigen::Vector3d& rotationAngles,
+        Eigen::Vector3d& rotationAngleRates )
+{
+    // Set number of days and centuries since J2000.
+    double secondsSinceJ2000 = secondsSinceEpoch;
+    if ( julianDayAtEpoch != basic_astrodynamics::JULIAN_DAY_ON_J2000 )
+    {
+        secondsSinceJ2000 -= ( basic_astrodynamics::JULIAN_DAY_ON_J2000 - julianDayAtEpoch )
+                * physical_constants::JULIAN_DAY;
+    }
+    const double daysSinceJ2000 = secondsSinceJ2000 / physical_constants::JULIAN_DAY;
+    const double centuriesSinceJ2000 = daysSinceJ2000 / 36525.0;
+
+    // Compute secular terms.
+    rotationAngles << poleRightAscensionCoefficients_( 0 ) + poleRightAscensionCoefficients_( 1 ) * centuriesSinceJ2000,
+            poleDeclinationCoefficients_( 0 ) + poleDeclinationCoefficients_( 1 ) * centuriesSinceJ2000,
+            primeMeridianCoefficients_( 0 ) + ( primeMeridianCoefficients_( 1 ) +
+                                                primeMeridianCoefficients_( 2 ) * daysSinceJ2000 ) * daysSinceJ2000;
+    rotationAngleRates << poleRightAscensionCoefficients_( 1 ) / 36525.0,
+            poleDeclinationCoefficients_( 1 ) / 36525.0,
+            primeMeridianCoefficients_( 1 ) + 2.0 * primeMeridianCoefficients_( 2 ) * daysSinceJ2000;
+
+    // Add periodic terms.
+    if( argumentConstants_.rows( ) > 0 )
+    {
+        const Eigen::ArrayXd arguments = argumentConstants_ + argumentRates_ * daysSinceJ2000;
+        const Eigen::ArrayXd argumentSines = arguments.sin( );
+        const Eigen::ArrayXd argumentCosines = arguments.cos( );
+
+        rotationAngles( 0 ) += ( rightAscensionAmplitudes_ * argumentSines ).sum( );
+        rotationAngles( 1 ) += ( declinationAmplitudes_ * argumentCosines ).sum( );
+        rotationAngles( 2 ) += ( primeMeridianAmplitudes_ * argumentSines ).sum( );
+
+        rotationAngleRates( 0 ) += ( rightAscensionAmplitudes_ * argumentCosines * argumentRates_ ).sum( );
+        rotationAngleRates( 1 ) -= ( declinationAmplitudes_ * argumentSines * argumentRates_ ).sum( );
+        rotationAngleRates( 2 ) += ( primeMeridianAmplitudes_ * argumentCosines * argumentRates_ ).sum( );
+    }
+
+    // Convert rates from per day to per second.
+    rotationAngleRates /= physical_constants::JULIAN_DAY;
+}
+
+//! Function to compute the rotation and its time derivative from the rotation angles and their rates.
+void IauRotationalEphemeris::computeRotationAndDerivative(
+        const Eigen::Vector3d& rotationAngles,
+        const Eigen::Vector3d& rotationAngleRates,
+        Eigen::Matrix3d& rotationToTargetFrame,
+        Eigen::Matrix3d& rotationToTargetFrameDerivative )
+{
+    // Compute constituent rotations (see getInertialToPlanetocentricFrameTransformationQuaternion).
+    const Eigen::Matrix3d primeMeridianRotation =
+            Eigen::AngleAxisd( -rotationAngles( 2 ), Eigen::Vector3d::UnitZ( ) ).toRotationMatrix( );
+    const Eigen::Matrix3d declinationRotation =
+            Eigen::AngleAxisd( -( mathematical_constants::PI / 2.0 - rotationAngles( 1 ) ),
+                               Eigen::Vector3d::UnitX( ) ).toRotationMatrix( );
+    const Eigen::Matrix3d rightAscensionRotation =
+            Eigen::AngleAxisd( -( rotationAngles( 0 ) + mathematical_constants::PI / 2.0 ),
+                               Eigen::Vector3d::UnitZ( ) ).toRotationMatrix( );
+
+    // Matrices to compute derivatives of rotations about z- and x-axes w.r.t. their angle.
+    Eigen::Matrix3d zRotationDerivativeMatrix, xRotationDerivativeMatrix;
+    zRotationDerivativeMatrix << 0.0, 1.0, 0.0, -1.0, 0.0, 0.0, 0.0, 0.0, 0.0;
+    xRotationDerivativeMatrix << 0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, -1.0, 0.0;
+
+    const Eigen::Matrix3d poleRotation = declinationRotation * rightAscensionRotation;
+    rotationToTargetFrame = primeMeridianRotation * poleRotation * baseFrameToJ2000Rotation_;
+    rotationToTargetFrameDerivative =
+            ( rotationAngleRates( 2 ) * zRotationDerivativeMatrix * primeMeridianRotation * poleRotation -
+              rotationAngleRates( 1 ) * primeMeridianRotation * xRotationDerivativeMatrix * poleRotation +
+              rotationAngleRates( 0 ) * primeMeridianRotation * declinationRotation * zRotationDerivativeMatrix *
+              rightAscensionRotation ) * baseFrameToJ2000Rotation_;
+}
+
+//! Function to create an IAU rotation model from coefficients in degrees.
+/*!
+ *  Function to create an IAU rotation model from coefficients in degrees (see IauRotationalEphemeris constructor).
+ *  \param poleRightAscensionCoefficients Constant and secular term of right ascension of pole.
+ *  \param poleDeclinationCoefficients Constant and secular term of declination of pole.
+ *  \param primeMeridianCoefficients Constant, linear and quadratic term of location of prime meridian.
+ *  \param argumentConstants Values of arguments of the periodic terms at J2000.
+ *  \param argumentRates Rates of change of arguments of the periodic terms.
+ *  \param rightAscensionAmplitudes Amplitudes of periodic terms of right ascension of pole.
+ *  \param declinationAmplitudes Amplitudes of periodic terms of declination of pole.
+ *  \param primeMeridianAmplitudes Amplitudes of periodic terms of location of prime meridian.
+ *  \param baseFrameOrientation Base frame identifier.
+ *  \param targetFrameOrientation Target frame identifier.
+ *  \return IAU rotation model.
+ */
+boost::shared_ptr< IauRotationalEphemeris > createIauRotationalEphemerisFromDegrees(
+        const Eigen::Vector2d& poleRightAscensionCoefficients,
+        const Eigen::Vector2d& poleDeclinationCoefficients,
+        const Eigen::Vector3d& primeMeridianCoefficients,
+        const Eigen::VectorXd& argumentConstants,
+        const Eigen::VectorXd& argumentRates,
+        const Eigen::VectorXd& rightAscensionAmplitudes,
+        const Eigen::VectorXd& declinationAmplitudes,
+        const Eigen::VectorXd& primeMeridianAmplitudes,
+        const std::string& baseFrameOrientation,
+        const std::string& targetFrameOrientation )
+{
+    using unit_conversions::convertDegreesToRadians;
+    return boost::make_shared< IauRotationalEphemeris >(
+                convertDegreesToRadians( poleRightAscensionCoefficients ),
+                convertDegreesToRadians( poleDeclinationCoefficients ),
+                convertDegreesToRadians( primeMeridianCoefficients ),
+                convertDegreesToRadians( argumentConstants ),
+                convertDegreesToRadians( argumentRates ),
+                convertDegreesToRadians( rightAscensionAmplitudes ),
+                convertDegreesToRadians( declinationAmplitudes ),
+                convertDegreesToRadians( primeMeridianAmplitudes ),
+                baseFrameOrientation, targetFrameOrientation );
+}
+
+//! Function to create the IAU rotation model of a solar system body.
+boost::shared_ptr< IauRotationalEphemeris > createIauRotationalEphemeris(
+        const std::string& bodyName,
+        const std::string& baseFrameOrientation,
+        const std::string& targetFrameOrientation )
+{
+    const std::string targetFrame = ( targetFrameOrientation == "" ) ? ( "IAU_" + bodyName ) : targetFrameOrientation;
+
+    // Coefficients in degrees (and per century or per day), from IAU WGCCRE 2009 report.
+    Eigen::Vector2d rightAscension, declination;
+    Eigen::Vector3d primeMeridian;
+    Eigen::VectorXd argumentConstants = Eigen::VectorXd::Zero( 0 );
+    Eigen::VectorXd argumentRates = Eigen::VectorXd::Zero( 0 );
+    Eigen::VectorXd rightAscensionAmplitudes = Eigen::VectorXd::Zero( 0 );
+    Eigen::VectorXd declinationAmplitudes = Eigen::VectorXd::Zero( 0 );
+    Eigen::VectorXd primeMeridianAmplitudes = Eigen::VectorXd::Zero( 0 );
+
+    if( bodyName == "Sun" )
+    {
+        rightAscension << 286.13, 0.0;
+        declination << 63.87, 0.0;
+        primeMeridian << 84.176, 14.1844000, 0.0;
+    }
+    else if( bodyName == "Mercury" )
+    {
+        rightAscension << 281.0097, -0.0328;
+        declination << 61.4143, -0.0049;
+        primeMeridian << 329.5469, 6.1385025, 0.0;
+
+        // Libration terms M1 to M5.
+        argumentConstants.resize( 5 );
+        argumentConstants << 174.791086, 349.582171, 164.373257, 339.164343, 153.955429;
+        argumentRates.resize( 5 );
+        argumentRates << 4.092335, 8.184670, 12.277005, 16.369340, 20.461675;
+        rightAscensionAmplitudes = Eigen::VectorXd::Zero( 5 );
+        declinationAmplitudes = Eigen::VectorXd::Zero( 5 );
+        primeMeridianAmplitudes.resize( 5 );
+        primeMeridianAmplitudes << 0.00993822, -0.00104581, -0.00010280, -0.00002364, -0.00000532;
+    }
+    else if( bodyName == "Venus" )
+    {
+        rightAscension << 272.76, 0.0;
+        declination << 67.16, 0.0;
+        primeMeridian << 160.20, -1.4813688, 0.0;
+    }
+    else if( bodyName == "Earth" )
+    {
+        rightAscension << 0.0, -0.641;
+        declination << 90.0, -0.557;
+        primeMeridian << 190.147, 360.9856235, 0.0;
+    }
+    else if( bodyName == "Moon" )
+    {
+        rightAscension << 269.9949, 0.0031;
+        declination << 66.5392, 0.0130;
+        primeMeridian << 38.3213, 13.17635815, -1.4E-12;
+
+        // Arguments E1 to E13.
+        argumentConstants.resize( 13 );
+        argumentConstants << 125.045, 250.089, 260.008, 176.625, 357.529, 311.589, 134.963,
+                276.617, 34.226, 15.134, 119.743, 239.961, 25.053;
+        argumentRates.resize( 13 );
+        argumentRates << -0.0529921, -0.1059842, 13.0120009, 13.3407154, 0.9856003, 26.4057084, 13.0649930,
+                0.3287146, 1.7484877, -0.1589763, 0.0036096, 0.1643573, 12.9590088;
+        rightAscensionAmplitudes.resize( 13 );
+        rightAscensionAmplitudes << -3.8787, -0.1204, 0.0700, -0.0172, 0.0, 0.0072, 0.0,
+                0.0, 0.0, -0.0052, 0.0, 0.0, 0.0043;
+        declinationAmplitudes.resize( 13 );
+        declinationAmplitudes << 1.5419, 0.0239, -0.0278, 0.0068, 0.0, -0.0029, 0.0009,
+                0.0, 0.0, 0.0008, 0.0, 0.0, -0.0009;
+        primeMeridianAmplitudes.resize( 13 );
+        primeMeridianAmplitudes << 3.5610, 0.1208, -0.0642, 0.0158, 0.0252, -0.0066, -0.0047,
+                -0.0046, 0.0028, 0.0052, 0.0040, 0.0019, -0.0044;
+    }
+    else if( bodyName == "Mars" )
+    {
+        rightAscension << 317.68143, -0.1061;
+        declination << 52.88650, -0.0609;
+        primeMeridian << 176.630, 350.89198226, 0.0;
+    }
+    else if( bodyName == "Jupiter" )
+    {
+        rightAscension << 268.056595, -0.006499;
+        declination << 64.495303, 0.002413;
+        primeMeridian << 284.95, 870.5360000, 0.0;
+
+        // Arguments Ja to Je (rates given per century).
+        argumentConstants.resize( 5 );
+        argumentConstants << 99.360714, 175.895369, 300.323162, 114.012305, 49.511251;
+        argumentRates.resize( 5 );
+        argumentRates << 4850.4046, 1191.9605, 262.5475, 6070.2476, 64.3000;
+        argumentRates /= 36525.0;
+        rightAscensionAmplitudes.resize( 5 );
+        rightAscensionAmplitudes << 0.000117, 0.000938, 0.001432, 0.000030, 0.002150;
+        declinationAmplitudes.resize( 5 );
+        declinationAmplitudes << 0.000050, 0.000404, 0.000617, -0.000013, 0.000926;
+        primeMeridianAmplitudes = Eigen::VectorXd::Zero( 5 );
+    }
+    else if( bodyName == "Saturn" )
+    {
+        rightAscension << 40.589, -0.036;
+        declination << 83.537, -0.004;
+        primeMeridian << 38.90, 810.7939024, 0.0;
+    }
+    else if( bodyName == "Uranus" )
+    {
+        rightAscension << 257.311, 0.0;
+        declination << -15.175, 0.0;
+        primeMeridian << 203.81, -501.1600928, 0.0;
+    }
+    else if( bodyName == "Neptune" )
+    {
+        rightAscension << 299.36, 0.0;
+        declination << 43.46, 0.0;
+        primeMeridian << 253.18, 536.3128492, 0.0;
+
+        // Argument N (rate given per century).
+        argumentConstants = Eigen::VectorXd::Constant( 1, 357.85 );
+        argumentRates = Eigen::VectorXd::Constant( 1, 52.316 / 36525.0 );
+        rightAscensionAmplitudes = Eigen::VectorXd::Constant( 1, 0.70 );
+        declinationAmplitudes = Eigen::VectorXd::Constant( 1, -0.51 );
+        primeMeridianAmplitudes = Eigen::VectorXd::Constant( 1, -0.48 );
+    }
+    else
+    {
+        throw std::runtime_error( "Error, IAU rotation model not available for body " + bodyName );
+    }
+
+    return createIauRotationalEphemerisFromDegrees(
+                rightAscension, declination, primeMeridian, argumentConstants, argumentRates,
+                rightAscensionAmplitudes, declinationAmplitudes, primeMeridianAmplitudes,
+                baseFrameOrientation, targetFrame );
+}
+
+} // namespace ephemerides
+
+} // namespace tudat
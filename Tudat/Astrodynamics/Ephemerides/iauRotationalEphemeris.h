@@ -0,0 +1,235 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Archinal, B.A. et al. Report of the IAU Working Group on Cartographic Coordinates and Rotational Elements:
+ *          2009, Celestial Mechanics and Dynamical Astronomy, 109(2), 101-135, 2011.
+ */
+
+#ifndef TUDAT_IAU_ROTATIONAL_EPHEMERIS_H
+#define TUDAT_IAU_ROTATIONAL_EPHEMERIS_H
+
+#include <string>
+
+#include <boost/shared_ptr.hpp>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include "Tudat/Astrodynamics/Ephemerides/rotationalEphemeris.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Class to compute the rotation of a body from the IAU (WGCCRE) rotational element series.
+/*!
+ *  Class to compute the rotation of a body from the series for the right ascension and declination of its pole and
+ *  the location of its prime meridian, as defined by the IAU Working Group on Cartographic Coordinates and
+ *  Rotational Elements (WGCCRE):
+ *
+ *      alpha = a0 + a1 T + sum_k A_k sin( theta_k )
+ *      delta = d0 + d1 T + sum_k D_k cos( theta_k )
+ *      W = w0 + w1 d + w2 d^2 + sum_k W_k sin( theta_k )
+ *      theta_k = theta0_k + theta1_k d
+ *
+ *  with d the number of days, and T the number of Julian centuries, since J2000. The rotation and its time
+ *  derivative are computed analytically, without the use of Spice, and are both obtained from a single evaluation of
+ *  the series by the getFullRotationalQuantitiesToTargetFrame function. All angles (and rates) are in radians (per
+ *  day or per century, as indicated above).
+ */
+class IauRotationalEphemeris: public RotationalEphemeris
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor, sets the coefficients of the rotational element series.
+     *  \param poleRightAscensionCoefficients Constant and secular (per century) term of right ascension of pole.
+     *  \param poleDeclinationCoefficients Constant and secular (per century) term of declination of pole.
+     *  \param primeMeridianCoefficients Constant, linear (per day) and quadratic (per day squared) term of
+     *  location of prime meridian.
+     *  \param argumentConstants Values of arguments theta_k of the periodic terms at J2000.
+     *  \param argumentRates Rates of change of arguments theta_k of the periodic terms (per day).
+     *  \param rightAscensionAmplitudes Amplitudes A_k of periodic terms of right ascension of pole.
+     *  \param declinationAmplitudes Amplitudes D_k of periodic terms of declination of pole.
+     *  \param primeMeridianAmplitudes Amplitudes W_k of periodic terms of location of prime meridian.
+     *  \param baseFrameOrientation Base frame identifier, J2000 (for which the rotational elements are defined) or
+     *  ECLIPJ2000.
+     *  \param targetFrameOrientation Target frame identifier.
+     */
+    IauRotationalEphemeris(
+            const Eigen::Vector2d& poleRightAscensionCoefficients,
+            const Eigen::Vector2d& poleDeclinationCoefficients,
+            const Eigen::Vector3d& primeMeridianCoefficients,
+            const Eigen::VectorXd& argumentConstants = Eigen::VectorXd::Zero( 0 ),
+            const Eigen::VectorXd& argumentRates = Eigen::VectorXd::Zero( 0 ),
+            const Eigen::VectorXd& rightAscensionAmplitudes = Eigen::VectorXd::Zero( 0 ),
+            const Eigen::VectorXd& declinationAmplitudes = Eigen::VectorXd::Zero( 0 ),
+            const Eigen::VectorXd& primeMeridianAmplitudes = Eigen::VectorXd::Zero( 0 ),
+            const std::string& baseFrameOrientation = "J2000",
+            const std::string& targetFrameOrientation = "" );
+
+    //! Get rotation quaternion from target frame to base frame.
+    /*!
+     *  Function to calculate the rotation quaternion from target frame to base frame at specified time.
+     *  \param secondsSinceEpoch Seconds since Julian day epoch specified by 2nd argument.
+     *  \param julianDayAtEpoch Reference epoch in Julian days from which number of seconds are counted.
+     *  \return Rotation quaternion computed.
+     */
+    Eigen::Quaterniond getRotationToBaseFrame(
+            const double secondsSinceEpoch,
+            const double julianDayAtEpoch = basic_astrodynamics::JULIAN_DAY_ON_J2000 )
+    {
+        return getRotationToTargetFrame( secondsSinceEpoch, julianDayAtEpoch ).inverse( );
+    }
+
+    //! Get rotation quaternion to target frame from base frame.
+    /*!
+     *  Function to calculate the rotation quaternion to target frame from base frame at specified time.
+     *  \param secondsSinceEpoch Seconds since Julian day epoch specified by 2nd argument.
+     *  \param julianDayAtEpoch Reference epoch in Julian days from which number of seconds are counted.
+     *  \return Rotation quaternion computed.
+     */
+    Eigen::Quaterniond getRotationToTargetFrame(
+            const double secondsSinceEpoch,
+            const double julianDayAtEpoch = basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+
+    //! Function to calculate the derivative of the rotation matrix from target frame to original frame.
+    /*!
+     *  Function to calculate the derivative of the rotation matrix from target frame to original frame at specified
+     *  time.
+     *  \param secondsSinceEpoch Seconds since Julian day epoch specified by 2nd argument.
+     *  \param julianDayAtEpoch Reference epoch in Julian days from which number of seconds are counted.
+     *  \return Derivative of rotation from target (typically local) to original (typically global) frame at
+     *  specified time.
+     */
+    Eigen::Matrix3d getDerivativeOfRotationToBaseFrame(
+            const double secondsSinceEpoch,
+            const double julianDayAtEpoch = basic_astrodynamics::JULIAN_DAY_ON_J2000 )
+    {
+        return getDerivativeOfRotationToTargetFrame( secondsSinceEpoch, julianDayAtEpoch ).transpose( );
+    }
+
+    //! Function to calculate the derivative of the rotation matrix from original frame to target frame.
+    /*!
+     *  Function to calculate the derivative of the rotation matrix from original frame to target frame at specified
+     *  time.
+     *  \param secondsSinceEpoch Seconds since Julian day epoch specified by 2nd argument.
+     *  \param julianDayAtEpoch Reference epoch in Julian days from which number of seconds are counted.
+     *  \return Derivative of rotation from original (typically global) to target (typically local) frame at
+     *  specified time.
+     */
+    Eigen::Matrix3d getDerivativeOfRotationToTargetFrame(
+            const double secondsSinceEpoch,
+            const double julianDayAtEpoch = basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+
+    //! Function to calculate the full rotational state at given time
+    /*!
+     *  Function to calculate the full rotational state at given time (rotation matrix, derivative of rotation matrix
+     *  and angular velocity vector), from a single evaluation of the rotational element series.
+     *  \param currentRotationToLocalFrame Current rotation to local frame (returned by reference)
+     *  \param currentRotationToLocalFrameDerivative Current derivative of rotation matrix to local frame
+     *  (returned by reference)
+     *  \param currentAngularVelocityVectorInGlobalFrame Current angular velocity vector, expressed in global frame
+     *  (returned by reference)
+     *  \param secondsSinceEpoch Seconds since Julian day epoch specified by 2nd argument
+     *  \param julianDayAtEpoch Reference epoch in Julian days from which number of seconds are counted.
+     */
+    void getFullRotationalQuantitiesToTargetFrame(
+            Eigen::Quaterniond& currentRotationToLocalFrame,
+            Eigen::Matrix3d& currentRotationToLocalFrameDerivative,
+            Eigen::Vector3d& currentAngularVelocityVectorInGlobalFrame,
+            const double secondsSinceEpoch,
+            const double julianDayAtEpoch = basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+
+    //! Function to compute the right ascension and declination of the pole and the location of the prime meridian.
+    /*!
+     *  Function to compute the right ascension and declination of the pole and the location of the prime meridian,
+     *  as well as their time derivatives.
+     *  \param secondsSinceEpoch Seconds since Julian day epoch specified by 2nd argument.
+     *  \param julianDayAtEpoch Reference epoch in Julian days from which number of seconds are counted.
+     *  \param rotationAngles Right ascension of pole, declination of pole and location of prime meridian
+     *  (returned by reference).
+     *  \param rotationAngleRates Time derivatives (per second) of entries of rotationAngles (returned by reference).
+     */
+    void getRotationAngles(
+            const double secondsSinceEpoch,
+            const double julianDayAtEpoch,
+            Eigen::Vector3d& rotationAngles,
+            Eigen::Vector3d& rotationAngleRates );
+
+private:
+
+    //! Function to compute the rotation and its time derivative from the rotation angles and their rates.
+    /*!
+     *  Function to compute the rotation to the target frame and its time derivative from the rotation angles and
+     *  their rates.
+     *  \param rotationAngles Right ascension of pole, declination of pole and location of prime meridian.
+     *  \param rotationAngleRates Time derivatives (per second) of entries of rotationAngles.
+     *  \param rotationToTargetFrame Rotation to target frame (returned by reference).
+     *  \param rotationToTargetFrameDerivative Time derivative of rotation matrix to target frame (returned by
+     *  reference).
+     */
+    void computeRotationAndDerivative(
+            const Eigen::Vector3d& rotationAngles,
+            const Eigen::Vector3d& rotationAngleRates,
+            Eigen::Matrix3d& rotationToTargetFrame,
+            Eigen::Matrix3d& rotationToTargetFrameDerivative );
+
+    //! Rotation from base frame to J2000 frame (identity if base frame is J2000).
+    Eigen::Matrix3d baseFrameToJ2000Rotation_;
+
+    //! Constant and secular (per century) term of right ascension of pole.
+    Eigen::Vector2d poleRightAscensionCoefficients_;
+
+    //! Constant and secular (per century) term of declination of pole.
+    Eigen::Vector2d poleDeclinationCoefficients_;
+
+    //! Constant, linear (per day) and quadratic (per day squared) term of location of prime meridian.
+    Eigen::Vector3d primeMeridianCoefficients_;
+
+    //! Values of arguments of the periodic terms at J2000.
+    Eigen::ArrayXd argumentConstants_;
+
+    //! Rates of change of arguments of the periodic terms (per day).
+    Eigen::ArrayXd argumentRates_;
+
+    //! Amplitudes of periodic terms of right ascension of pole.
+    Eigen::ArrayXd rightAscensionAmplitudes_;
+
+    //! Amplitudes of periodic terms of declination of pole.
+    Eigen::ArrayXd declinationAmplitudes_;
+
+    //! Amplitudes of periodic terms of location of prime meridian.
+    Eigen::ArrayXd primeMeridianAmplitudes_;
+};
+
+//! Function to create the IAU rotation model of a solar system body.
+/*!
+ *  Function to create the IAU rotation model of a solar system body, with the rotational elements of the
+ *  IAU WGCCRE 2009 report (as also used in the pck00010 Spice kernel). Models are available for the Sun, the planets
+ *  and the Moon.
+ *  \param bodyName Name of the body for which the rotation model is to be created.
+ *  \param baseFrameOrientation Base frame identifier (the rotational elements are defined w.r.t. the ICRF).
+ *  \param targetFrameOrientation Target frame identifier (default "IAU_" + bodyName, if empty).
+ *  \return IAU rotation model of body.
+ */
+boost::shared_ptr< IauRotationalEphemeris > createIauRotationalEphemeris(
+        const std::string& bodyName,
+        const std::string& baseFrameOrientation = "J2000",
+        const std::string& targetFrameOrientation = "" );
+
+} // namespace ephemerides
+
+} // namespace tudat
+
+#endif // TUDAT_IAU_ROTATIONAL_EPHEMERIS_H
@@ -0,0 +1,357 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+#include <boost/algorithm/string/trim.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <Eigen/Geometry>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/Ephemerides/jplBinaryEphemeris.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Byte offsets of entries in header record of JPL DE binary ephemeris file (see testeph.f).
+static const std::size_t jplConstantNamesOffset = 252;
+static const std::size_t jplEphemerisIntervalOffset = 2652;
+static const std::size_t jplNumberOfConstantsOffset = 2676;
+static const std::size_t jplEarthMoonMassRatioOffset = 2688;
+static const std::size_t jplItemPointersOffset = 2696;
+static const std::size_t jplDeNumberOffset = 2840;
+static const std::size_t jplLibrationPointerOffset = 2844;
+static const std::size_t jplExtraConstantNamesOffset = 2856;
+
+//! Size (in characters) of constant names in JPL DE binary ephemeris file.
+static const std::size_t jplConstantNameSize = 6;
+
+//! Function to copy a value of given type from an (unaligned) memory location.
+template< typename ValueType >
+ValueType readJplHeaderEntry( const char* headerData, const std::size_t offset )
+{
+    ValueType value;
+    std::memcpy( &value, headerData + offset, sizeof( ValueType ) );
+    return value;
+}
+
+//! Function to retrieve the JPL ephemeris body identifier from a body name.
+JplEphemerisBody getJplEphemerisBody( const std::string& bodyName )
+{
+    static const std::string planetsWithBarycenter[ 6 ] =
+    { "Mars", "Jupiter", "Saturn", "Uranus", "Neptune", "Pluto" };
+
+    if( bodyName == "Mercury" )
+    {
+        return jpl_mercury;
+    }
+    else if( bodyName == "Venus" )
+    {
+        return jpl_venus;
+    }
+    else if( bodyName == "Earth" )
+    {
+        return jpl_earth;
+    }
+    else if( bodyName == "Moon" )
+    {
+        return jpl_moon;
+    }
+    else if( bodyName == "Sun" )
+    {
+        return jpl_sun;
+    }
+    else if( bodyName == "SSB" || bodyName == "Solar System Barycenter" || bodyName == "Solar system barycenter" )
+    {
+        return jpl_solar_system_barycenter;
+    }
+    else if( bodyName == "EMB" || bodyName == "Earth-Moon Barycenter" || bodyName == "Earth Barycenter" )
+    {
+        return jpl_earth_moon_barycenter;
+    }
+
+    for( unsigned int i = 0; i < 6; i++ )
+    {
+        if( bodyName == planetsWithBarycenter[ i ] + " Barycenter" )
+        {
+            return static_cast< JplEphemerisBody >( jpl_mars_barycenter + i );
+        }
+        else if( bodyName == planetsWithBarycenter[ i ] )
+        {
+            std::cerr<<"Warning, position of "<<bodyName<<" taken as barycenter of that body's "
+                    <<"planetary system."<<std::endl;
+            return static_cast< JplEphemerisBody >( jpl_mars_barycenter + i );
+        }
+    }
+
+    throw std::runtime_error( "Error, body " + bodyName + " is not available in JPL DE ephemeris files." );
+}
+
+//! Constructor, maps JPL DE binary ephemeris file into memory.
+JplBinaryEphemerisFile::JplBinaryEphemerisFile( const std::string& fileName )
+{
+    // Map complete file into memory (read-only).
+    try
+    {
+        boost::interprocess::file_mapping( fileName.c_str( ), boost::interprocess::read_only ).swap( fileMapping_ );
+        boost::interprocess::mapped_region( fileMapping_, boost::interprocess::read_only ).swap( mappedRegion_ );
+    }
+    catch( boost::interprocess::interprocess_exception& mappingException )
+    {
+        throw std::runtime_error( "Error, JPL ephemeris file " + fileName + " could not be mapped into memory: " +
+                                  mappingException.what( ) );
+    }
+
+    const char* fileData = static_cast< const char* >( mappedRegion_.get_address( ) );
+    const std::size_t fileSize = mappedRegion_.get_size( );
+    if( fileSize < jplExtraConstantNamesOffset )
+    {
+        throw std::runtime_error( "Error, file " + fileName + " is too small to be a JPL ephemeris file." );
+    }
+
+    // Read header entries, and check whether they are consistent with the byte order of this machine.
+    double ephemerisInterval[ 3 ];
+    std::memcpy( ephemerisInterval, fileData + jplEphemerisIntervalOffset, sizeof( ephemerisInterval ) );
+    const boost::int32_t numberOfConstants =
+            readJplHeaderEntry< boost::int32_t >( fileData, jplNumberOfConstantsOffset );
+    deNumber_ = readJplHeaderEntry< boost::int32_t >( fileData, jplDeNumberOffset );
+    earthMoonMassRatio_ = readJplHeaderEntry< double >( fileData, jplEarthMoonMassRatioOffset );
+
+    if( deNumber_ <= 0 || deNumber_ > 10000 || numberOfConstants < 0 || numberOfConstants > 10000 ||
+            !( ephemerisInterval[ 2 ] > 0.0 ) || !( ephemerisInterval[ 1 ] > ephemerisInterval[ 0 ] ) )
+    {
+        throw std::runtime_error( "Error, file " + fileName + " is not a JPL ephemeris file, or was written with "
+                                                             "different byte order." );
+    }
+
+    // Read pointers to data items in records (items 14 and 15 are only present for DE430 and later).
+    std::memset( itemPointers_, 0, sizeof( itemPointers_ ) );
+    std::memcpy( itemPointers_, fileData + jplItemPointersOffset, 12 * 3 * sizeof( boost::int32_t ) );
+    std::memcpy( itemPointers_[ 12 ], fileData + jplLibrationPointerOffset, 3 * sizeof( boost::int32_t ) );
+
+    const std::size_t numberOfExtraConstants = std::max( numberOfConstants - 400, 0 );
+    const std::size_t additionalPointersOffset =
+            jplExtraConstantNamesOffset + numberOfExtraConstants * jplConstantNameSize;
+    if( fileSize >= additionalPointersOffset + 6 * sizeof( boost::int32_t ) )
+    {
+        std::memcpy( itemPointers_[ 13 ], fileData + additionalPointersOffset, 6 * sizeof( boost::int32_t ) );
+    }
+
+    // Determine record length from item pointers.
+    recordLength_ = 0;
+    for( unsigned int i = 0; i < 15; i++ )
+    {
+        const int numberOfComponents = ( i == 11 ) ? 2 : ( ( i == 14 ) ? 1 : 3 );
+        if( itemPointers_[ i ][ 0 ] < 3 || itemPointers_[ i ][ 1 ] <= 0 || itemPointers_[ i ][ 2 ] <= 0 )
+        {
+            if( i < 11 )
+            {
+                throw std::runtime_error( "Error, JPL ephemeris file " + fileName + " does not contain data item " +
+                                          boost::lexical_cast< std::string >( i + 1 ) );
+            }
+            std::memset( itemPointers_[ i ], 0, 3 * sizeof( boost::int32_t ) );
+        }
+        else
+        {
+            recordLength_ = std::max( recordLength_, itemPointers_[ i ][ 0 ] - 1 +
+                                      itemPointers_[ i ][ 1 ] * itemPointers_[ i ][ 2 ] * numberOfComponents );
+        }
+    }
+
+    // Determine number of records, and check consistency of first record.
+    const std::size_t recordSize = recordLength_ * sizeof( double );
+    numberOfRecords_ = std::min(
+                static_cast< int >( fileSize / recordSize ) - 2,
+                static_cast< int >( ( ephemerisInterval[ 1 ] - ephemerisInterval[ 0 ] ) /
+                                    ephemerisInterval[ 2 ] + 0.5 ) );
+    if( numberOfRecords_ < 1 || fileSize < ( 2 + numberOfRecords_ ) * recordSize )
+    {
+        throw std::runtime_error( "Error, JPL ephemeris file " + fileName + " contains no coefficient records." );
+    }
+
+    recordData_ = reinterpret_cast< const double* >( fileData + 2 * recordSize );
+    if( std::fabs( recordData_[ 0 ] - ephemerisInterval[ 0 ] ) > 1.0E-6 ||
+            std::fabs( recordData_[ 1 ] - ephemerisInterval[ 0 ] - ephemerisInterval[ 2 ] ) > 1.0E-6 )
+    {
+        throw std::runtime_error( "Error, time interval of first record of JPL ephemeris file " + fileName +
+                                  " is inconsistent with header." );
+    }
+
+    startTime_ = ( ephemerisInterval[ 0 ] - basic_astrodynamics::JULIAN_DAY_ON_J2000 ) *
+            physical_constants::JULIAN_DAY;
+    recordTimeSpan_ = ephemerisInterval[ 2 ] * physical_constants::JULIAN_DAY;
+
+    // Read constants (names from header, values from second record).
+    const double* constantValues = reinterpret_cast< const double* >( fileData + recordSize );
+    for( int i = 0; i < std::min( numberOfConstants, recordLength_ ); i++ )
+    {
+        const std::size_t nameOffset = ( i < 400 ) ?
+                    ( jplConstantNamesOffset + i * jplConstantNameSize ) :
+                    ( jplExtraConstantNamesOffset + ( i - 400 ) * jplConstantNameSize );
+        constants_[ boost::algorithm::trim_copy( std::string( fileData + nameOffset, jplConstantNameSize ) ) ] =
+                constantValues[ i ];
+    }
+}
+
+//! Function to compute the state of a body w.r.t. the solar system barycenter.
+basic_mathematics::Vector6d JplBinaryEphemerisFile::getBarycentricState(
+        const JplEphemerisBody body, const double secondsSinceJ2000 ) const
+{
+    switch( body )
+    {
+    case jpl_solar_system_barycenter:
+        return basic_mathematics::Vector6d::Zero( );
+    case jpl_earth:
+        return getItemState( jpl_earth_moon_barycenter, secondsSinceJ2000 ) -
+                getItemState( jpl_moon, secondsSinceJ2000 ) / ( 1.0 + earthMoonMassRatio_ );
+    case jpl_moon:
+        return getItemState( jpl_earth_moon_barycenter, secondsSinceJ2000 ) +
+                getItemState( jpl_moon, secondsSinceJ2000 ) * ( earthMoonMassRatio_ / ( 1.0 + earthMoonMassRatio_ ) );
+    default:
+        return getItemState( body, secondsSinceJ2000 );
+    }
+}
+
+//! Function to compute the state of a body w.r.t. another body.
+basic_mathematics::Vector6d JplBinaryEphemerisFile::getRelativeState(
+        const JplEphemerisBody targetBody, const JplEphemerisBody centralBody, const double secondsSinceJ2000 ) const
+{
+    // Use (geocentric) lunar ephemeris directly for Earth-Moon state, to prevent loss of precision.
+    if( targetBody == jpl_moon && centralBody == jpl_earth )
+    {
+        return getItemState( jpl_moon, secondsSinceJ2000 );
+    }
+    else if( targetBody == jpl_earth && centralBody == jpl_moon )
+    {
+        return -getItemState( jpl_moon, secondsSinceJ2000 );
+    }
+    else if( targetBody == centralBody )
+    {
+        return basic_mathematics::Vector6d::Zero( );
+    }
+    else
+    {
+        return getBarycentricState( targetBody, secondsSinceJ2000 ) -
+                getBarycentricState( centralBody, secondsSinceJ2000 );
+    }
+}
+
+//! Function to compute the state of one of the data items in the file.
+basic_mathematics::Vector6d JplBinaryEphemerisFile::getItemState(
+        const int itemIndex, const double secondsSinceJ2000 ) const
+{
+    // Find record containing requested time.
+    const double timeSinceStart = secondsSinceJ2000 - startTime_;
+    if( !( timeSinceStart >= 0.0 ) || timeSinceStart > numberOfRecords_ * recordTimeSpan_ )
+    {
+        throw std::runtime_error( "Error, time " + boost::lexical_cast< std::string >( secondsSinceJ2000 ) +
+                                  " is outside of interval covered by JPL ephemeris file." );
+    }
+    const int recordIndex = std::min( static_cast< int >( timeSinceStart / recordTimeSpan_ ), numberOfRecords_ - 1 );
+
+    // Find subinterval containing requested time, and compute scaled time in subinterval.
+    const int numberOfCoefficients = itemPointers_[ itemIndex ][ 1 ];
+    const int numberOfSubintervals = itemPointers_[ itemIndex ][ 2 ];
+    const double subintervalPosition = ( timeSinceStart - recordIndex * recordTimeSpan_ ) / recordTimeSpan_ *
+            static_cast< double >( numberOfSubintervals );
+    const int subintervalIndex = std::min( static_cast< int >( subintervalPosition ), numberOfSubintervals - 1 );
+    const double scaledTime = 2.0 * ( subintervalPosition - subintervalIndex ) - 1.0;
+
+    const double* coefficients = recordData_ + recordIndex * recordLength_ + ( itemPointers_[ itemIndex ][ 0 ] - 1 ) +
+            subintervalIndex * numberOfCoefficients * 3;
+
+    // Evaluate Chebyshev polynomials and their derivatives (Standish, testeph.f).
+    basic_mathematics::Vector6d state = basic_mathematics::Vector6d::Zero( );
+    double polynomialValue = 1.0, previousPolynomialValue = 0.0, temporaryValue;
+    double derivativeValue = 0.0, previousDerivativeValue = 0.0;
+    for( int k = 0; k < numberOfCoefficients; k++ )
+    {
+        for( int j = 0; j < 3; j++ )
+        {
+            state( j ) += coefficients[ j * numberOfCoefficients + k ] * polynomialValue;
+            state( j + 3 ) += coefficients[ j * numberOfCoefficients + k ] * derivativeValue;
+        }
+
+        temporaryValue = derivativeValue;
+        derivativeValue = ( k == 0 ) ? 1.0 :
+                                       ( 2.0 * scaledTime * derivativeValue + 2.0 * polynomialValue -
+                                         previousDerivativeValue );
+        previousDerivativeValue = temporaryValue;
+
+        temporaryValue = polynomialValue;
+        polynomialValue = ( k == 0 ) ? scaledTime :
+                                       ( 2.0 * scaledTime * polynomialValue - previousPolynomialValue );
+        previousPolynomialValue = temporaryValue;
+    }
+
+    // Convert from km and km per scaled time unit to m and m/s.
+    state.segment( 0, 3 ) *= 1.0E3;
+    state.segment( 3, 3 ) *= 1.0E3 * 2.0 * static_cast< double >( numberOfSubintervals ) / recordTimeSpan_;
+    return state;
+}
+
+//! Constructor.
+JplBinaryEphemeris::JplBinaryEphemeris( const JplBinaryEphemerisFilePointer ephemerisFile,
+                                        const std::string& targetBodyName,
+                                        const std::string& referenceFrameOrigin,
+                                        const std::string& referenceFrameOrientation ):
+    Ephemeris( referenceFrameOrigin, referenceFrameOrientation ),
+    ephemerisFile_( ephemerisFile ),
+    targetBody_( getJplEphemerisBody( targetBodyName ) ),
+    centralBody_( getJplEphemerisBody( referenceFrameOrigin ) )
+{
+    if( referenceFrameOrientation == "J2000" )
+    {
+        rotateToEcliptic_ = false;
+        eclipticRotation_.setIdentity( );
+    }
+    else if( referenceFrameOrientation == "ECLIPJ2000" )
+    {
+        // Rotate by obliquity of the ecliptic at J2000 (IAU 1976, as used for the Spice ECLIPJ2000 frame).
+        rotateToEcliptic_ = true;
+        eclipticRotation_ = Eigen::AngleAxisd(
+                    -84381.448 / 3600.0 * mathematical_constants::PI / 180.0,
+                    Eigen::Vector3d::UnitX( ) ).toRotationMatrix( );
+    }
+    else
+    {
+        throw std::runtime_error( "Error, frame orientation " + referenceFrameOrientation +
+                                  " not supported by JPL binary ephemeris, use J2000 or ECLIPJ2000." );
+    }
+}
+
+//! Function to get state from ephemeris.
+basic_mathematics::Vector6d JplBinaryEphemeris::getCartesianStateFromEphemeris(
+        const double secondsSinceEpoch, const double julianDayAtEpoch )
+{
+    basic_mathematics::Vector6d state = ephemerisFile_->getRelativeState(
+                targetBody_, centralBody_, secondsSinceEpoch +
+                ( julianDayAtEpoch - basic_astrodynamics::JULIAN_DAY_ON_J2000 ) * physical_constants::JULIAN_DAY );
+
+    if( rotateToEcliptic_ )
+    {
+        state.segment( 0, 3 ) = eclipticRotation_ * state.segment( 0, 3 );
+        state.segment( 3, 3 ) = eclipticRotation_ * state.segment( 3, 3 );
+    }
+    return state;
+}
+
+} // namespace ephemerides
+
+} // namespace tudat
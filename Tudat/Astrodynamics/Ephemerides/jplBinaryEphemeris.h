@@ -0,0 +1,281 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Standish, E.M. JPL Planetary and Lunar Ephemerides, export information and Fortran reader testeph.f,
+ *          ftp://ssd.jpl.nasa.gov/pub/eph/planets/fortran/.
+ *      Folkner, W.M., et al. The Planetary and Lunar Ephemerides DE430 and DE431, IPN Progress Report 42-196, 2014.
+ */
+
+#ifndef TUDAT_JPLBINARYEPHEMERIS_H
+#define TUDAT_JPLBINARYEPHEMERIS_H
+
+#include <map>
+#include <string>
+
+#include <boost/cstdint.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Ephemerides/ephemeris.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Bodies (and barycenters) for which a state can be retrieved from a JPL DE binary ephemeris file.
+/*!
+ *  Bodies (and barycenters) for which a state can be retrieved from a JPL DE binary ephemeris file. The first ten
+ *  entries correspond to the order of the data items in the file. Note that the states of Mars through Pluto in the
+ *  DE ephemerides are those of the barycenters of their planetary systems.
+ */
+enum JplEphemerisBody
+{
+    jpl_mercury = 0,
+    jpl_venus = 1,
+    jpl_earth_moon_barycenter = 2,
+    jpl_mars_barycenter = 3,
+    jpl_jupiter_barycenter = 4,
+    jpl_saturn_barycenter = 5,
+    jpl_uranus_barycenter = 6,
+    jpl_neptune_barycenter = 7,
+    jpl_pluto_barycenter = 8,
+    jpl_moon = 9,
+    jpl_sun = 10,
+    jpl_earth = 11,
+    jpl_solar_system_barycenter = 12
+};
+
+//! Function to retrieve the JPL ephemeris body identifier from a body name.
+/*!
+ *  Function to retrieve the JPL ephemeris body identifier from a body name (e.g. "Earth", "Moon", "SSB",
+ *  "Jupiter Barycenter"). Since only the barycenters of the planetary systems of Mars through Pluto are included in
+ *  the DE ephemerides, the barycenter is used (with a warning) when the planet itself is requested.
+ *  \param bodyName Name of body.
+ *  \return JPL ephemeris body identifier.
+ */
+JplEphemerisBody getJplEphemerisBody( const std::string& bodyName );
+
+//! Class providing access to the data in a memory-mapped JPL DE binary ephemeris file.
+/*!
+ *  Class providing access to the data in a JPL DE binary ephemeris file (e.g. linux_p1550p2650.430 or
+ *  linux_p1550p2650.440), as distributed by JPL, without using the Spice toolkit. The file is mapped read-only into
+ *  memory upon construction, after which the header is parsed and checked. States are computed by evaluating the
+ *  Chebyshev polynomials in the record containing the requested epoch directly from the mapped memory. Since the
+ *  object is not modified after construction, and no (global) state is used during evaluation, the state functions
+ *  may be called concurrently from any number of threads. Only files with the same byte order as the machine on which
+ *  they are read are supported.
+ */
+class JplBinaryEphemerisFile
+{
+public:
+
+    //! Constructor, maps JPL DE binary ephemeris file into memory.
+    /*!
+     *  Constructor, maps JPL DE binary ephemeris file into memory, and parses and checks its header.
+     *  \param fileName Name of JPL DE binary ephemeris file.
+     */
+    JplBinaryEphemerisFile( const std::string& fileName );
+
+    //! Function to compute the state of a body w.r.t. the solar system barycenter.
+    /*!
+     *  Function to compute the Cartesian state of a body w.r.t. the solar system barycenter, in the ICRF (J2000) frame.
+     *  \param body Body for which the state is to be computed.
+     *  \param secondsSinceJ2000 Time (TDB) in seconds since J2000 at which the state is to be computed.
+     *  \return Cartesian state (in m and m/s) of the body w.r.t. the solar system barycenter.
+     */
+    basic_mathematics::Vector6d getBarycentricState( const JplEphemerisBody body,
+                                                     const double secondsSinceJ2000 ) const;
+
+    //! Function to compute the state of a body w.r.t. another body.
+    /*!
+     *  Function to compute the Cartesian state of a body w.r.t. another body, in the ICRF (J2000) frame.
+     *  \param targetBody Body for which the state is to be computed.
+     *  \param centralBody Body w.r.t. which the state is to be computed.
+     *  \param secondsSinceJ2000 Time (TDB) in seconds since J2000 at which the state is to be computed.
+     *  \return Cartesian state (in m and m/s) of targetBody w.r.t. centralBody.
+     */
+    basic_mathematics::Vector6d getRelativeState( const JplEphemerisBody targetBody,
+                                                  const JplEphemerisBody centralBody,
+                                                  const double secondsSinceJ2000 ) const;
+
+    //! Function to retrieve the number of the DE ephemeris (e.g. 430).
+    /*!
+     *  Function to retrieve the number of the DE ephemeris (e.g. 430).
+     *  \return Number of the DE ephemeris.
+     */
+    int getDeNumber( ) const
+    {
+        return deNumber_;
+    }
+
+    //! Function to retrieve the first epoch covered by the file.
+    /*!
+     *  Function to retrieve the first epoch covered by the file.
+     *  \return First epoch (TDB) covered by the file, in seconds since J2000.
+     */
+    double getStartTime( ) const
+    {
+        return startTime_;
+    }
+
+    //! Function to retrieve the last epoch covered by the file.
+    /*!
+     *  Function to retrieve the last epoch covered by the file.
+     *  \return Last epoch (TDB) covered by the file, in seconds since J2000.
+     */
+    double getEndTime( ) const
+    {
+        return startTime_ + numberOfRecords_ * recordTimeSpan_;
+    }
+
+    //! Function to retrieve the Earth-Moon mass ratio used in the ephemeris.
+    /*!
+     *  Function to retrieve the Earth-Moon mass ratio used in the ephemeris.
+     *  \return Earth-Moon mass ratio used in the ephemeris.
+     */
+    double getEarthMoonMassRatio( ) const
+    {
+        return earthMoonMassRatio_;
+    }
+
+    //! Function to retrieve the constants stored in the file.
+    /*!
+     *  Function to retrieve the constants stored in the file (e.g. "AU", "GM1", "EMRAT"), with their names as keys.
+     *  \return Constants stored in the file.
+     */
+    std::map< std::string, double > getConstants( ) const
+    {
+        return constants_;
+    }
+
+private:
+
+    //! Function to compute the state of one of the data items in the file.
+    /*!
+     *  Function to compute the state of one of the data items in the file, by evaluating the Chebyshev polynomials
+     *  (and their derivatives) of the (sub)interval containing the requested time.
+     *  \param itemIndex Index of data item (0 to 10) in the file.
+     *  \param secondsSinceJ2000 Time (TDB) in seconds since J2000 at which the state is to be computed.
+     *  \return State (in m and m/s) of the data item.
+     */
+    basic_mathematics::Vector6d getItemState( const int itemIndex, const double secondsSinceJ2000 ) const;
+
+    //! Object representing the ephemeris file.
+    boost::interprocess::file_mapping fileMapping_;
+
+    //! Region of memory into which the complete ephemeris file is mapped.
+    boost::interprocess::mapped_region mappedRegion_;
+
+    //! Pointer to the first coefficient record in the mapped region.
+    const double* recordData_;
+
+    //! Offset (1-based), number of coefficients and number of subintervals of the data items in each record.
+    boost::int32_t itemPointers_[ 15 ][ 3 ];
+
+    //! Number of doubles in each record.
+    int recordLength_;
+
+    //! Number of coefficient records in the file.
+    int numberOfRecords_;
+
+    //! Start time (TDB) of first record, in seconds since J2000.
+    double startTime_;
+
+    //! Time span of each record, in seconds.
+    double recordTimeSpan_;
+
+    //! Number of the DE ephemeris.
+    int deNumber_;
+
+    //! Earth-Moon mass ratio used in the ephemeris.
+    double earthMoonMassRatio_;
+
+    //! Constants stored in the file, with their names as keys.
+    std::map< std::string, double > constants_;
+};
+
+//! Typedef for shared-pointer to JplBinaryEphemerisFile object.
+typedef boost::shared_ptr< JplBinaryEphemerisFile > JplBinaryEphemerisFilePointer;
+
+//! Ephemeris derived class which retrieves the state of a body from a JPL DE binary ephemeris file.
+/*!
+ *  Ephemeris derived class which retrieves the state of a body from a JPL DE binary ephemeris file, by direct
+ *  evaluation of the Chebyshev polynomials in the memory-mapped file. In contrast to the SpiceEphemeris, no body or
+ *  frame names are resolved during evaluation, and the state may be retrieved concurrently from multiple threads. Any
+ *  number of ephemeris objects may share a single JplBinaryEphemerisFile. The state is provided in either the J2000
+ *  (ICRF) or ECLIPJ2000 frame.
+ */
+class JplBinaryEphemeris : public Ephemeris
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor.
+     *  \param ephemerisFile Memory-mapped ephemeris file from which the state is retrieved.
+     *  \param targetBodyName Name of body for which the ephemeris is created.
+     *  \param referenceFrameOrigin Name of body w.r.t. which the state is computed (default "SSB").
+     *  \param referenceFrameOrientation Orientation of the frame in which the state is computed, "J2000" or
+     *  "ECLIPJ2000" (default).
+     */
+    JplBinaryEphemeris( const JplBinaryEphemerisFilePointer ephemerisFile,
+                        const std::string& targetBodyName,
+                        const std::string& referenceFrameOrigin = "SSB",
+                        const std::string& referenceFrameOrientation = "ECLIPJ2000" );
+
+    //! Function to get state from ephemeris.
+    /*!
+     *  Returns state from ephemeris at given time.
+     *  \param secondsSinceEpoch Seconds since epoch (TDB).
+     *  \param julianDayAtEpoch Reference epoch in Julian day.
+     *  \return State from ephemeris at given time.
+     */
+    basic_mathematics::Vector6d getCartesianStateFromEphemeris(
+            const double secondsSinceEpoch,
+            const double julianDayAtEpoch = basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+
+    //! Function to retrieve the memory-mapped ephemeris file from which the state is retrieved.
+    /*!
+     *  Function to retrieve the memory-mapped ephemeris file from which the state is retrieved.
+     *  \return Memory-mapped ephemeris file from which the state is retrieved.
+     */
+    JplBinaryEphemerisFilePointer getEphemerisFile( )
+    {
+        return ephemerisFile_;
+    }
+
+private:
+
+    //! Memory-mapped ephemeris file from which the state is retrieved.
+    JplBinaryEphemerisFilePointer ephemerisFile_;
+
+    //! Body for which the ephemeris is created.
+    JplEphemerisBody targetBody_;
+
+    //! Body w.r.t. which the state is computed.
+    JplEphemerisBody centralBody_;
+
+    //! Boolean denoting whether the state is to be rotated from the J2000 to the ECLIPJ2000 frame.
+    bool rotateToEcliptic_;
+
+    //! Rotation matrix from J2000 to ECLIPJ2000 frame.
+    Eigen::Matrix3d eclipticRotation_;
+};
+
+} // namespace ephemerides
+
+} // namespace tudat
+
+#endif // TUDAT_JPLBINARYEPHEMERIS_H
@@ -0,0 +1,254 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <boost/lexical_cast.hpp>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/convertMeanToEccentricAnomalies.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
+#include "Tudat/Astrodynamics/Ephemerides/keplerCatalogPropagator.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Maximum number of objects for which the states are computed simultaneously.
+const int KeplerCatalogPropagator::objectBlockSize_ = 512;
+
+//! Constructor.
+KeplerCatalogPropagator::KeplerCatalogPropagator(
+        const Eigen::Array< double, Eigen::Dynamic, 6 >& keplerianElements,
+        const double referenceEpoch,
+        const double centralBodyGravitationalParameter,
+        const double centralBodyJ2,
+        const double centralBodyEquatorialRadius,
+        const int numberOfThreads,
+        const int numberOfKeplerIterations ):
+    referenceEpoch_( referenceEpoch ),
+    numberOfThreads_( numberOfThreads ),
+    numberOfKeplerIterations_( numberOfKeplerIterations ),
+    includeSecularDrift_( centralBodyJ2 != 0.0 )
+{
+    using namespace orbital_element_conversions;
+
+    const int numberOfObjects = static_cast< int >( keplerianElements.rows( ) );
+
+    // Check input elements.
+    for( int i = 0; i < numberOfObjects; i++ )
+    {
+        if( !( keplerianElements( i, semiMajorAxisIndex ) > 0.0 ) ||
+                !( keplerianElements( i, eccentricityIndex ) >= 0.0 &&
+                   keplerianElements( i, eccentricityIndex ) < 1.0 ) )
+        {
+            throw std::runtime_error( "Error when creating Kepler catalog propagator, orbit of object " +
+                                      boost::lexical_cast< std::string >( i ) + " is not elliptical." );
+        }
+    }
+
+    if( includeSecularDrift_ && !( centralBodyEquatorialRadius > 0.0 ) )
+    {
+        throw std::runtime_error(
+                    "Error when creating Kepler catalog propagator, equatorial radius must be positive when J2 is used." );
+    }
+
+    // Use all available hardware threads, if not specified.
+    if( numberOfThreads_ <= 0 )
+    {
+        numberOfThreads_ = std::max( static_cast< int >( std::thread::hardware_concurrency( ) ), 1 );
+    }
+
+    semiMajorAxes_ = keplerianElements.col( semiMajorAxisIndex );
+    eccentricities_ = keplerianElements.col( eccentricityIndex );
+    semiMinorAxes_ = semiMajorAxes_ * ( 1.0 - eccentricities_.square( ) ).sqrt( );
+    meanMotions_ = ( centralBodyGravitationalParameter / semiMajorAxes_.cube( ) ).sqrt( );
+    argumentsOfPeriapsisAtReferenceEpoch_ = keplerianElements.col( argumentOfPeriapsisIndex );
+    ascendingNodesAtReferenceEpoch_ = keplerianElements.col( longitudeOfAscendingNodeIndex );
+    sineOfInclinations_ = keplerianElements.col( inclinationIndex ).sin( );
+    cosineOfInclinations_ = keplerianElements.col( inclinationIndex ).cos( );
+
+    // Convert true anomalies to mean anomalies.
+    meanAnomaliesAtReferenceEpoch_.resize( numberOfObjects );
+    for( int i = 0; i < numberOfObjects; i++ )
+    {
+        meanAnomaliesAtReferenceEpoch_( i ) = convertEllipticalEccentricAnomalyToMeanAnomaly(
+                    convertTrueAnomalyToEllipticalEccentricAnomaly(
+                        keplerianElements( i, trueAnomalyIndex ), eccentricities_( i ) ), eccentricities_( i ) );
+    }
+
+    // Compute secular rates of elements due to J2 (Vallado, 2013, eq. 9-41).
+    if( includeSecularDrift_ )
+    {
+        const Eigen::ArrayXd semiLatusRecta = semiMajorAxes_ * ( 1.0 - eccentricities_.square( ) );
+        const Eigen::ArrayXd j2Factors = 1.5 * centralBodyJ2 * meanMotions_ *
+                ( centralBodyEquatorialRadius / semiLatusRecta ).square( );
+        const Eigen::ArrayXd squaredCosineOfInclinations = cosineOfInclinations_.square( );
+
+        ascendingNodeRates_ = -j2Factors * cosineOfInclinations_;
+        argumentOfPeriapsisRates_ = 0.5 * j2Factors * ( 5.0 * squaredCosineOfInclinations - 1.0 );
+        meanAnomalyRates_ = meanMotions_ + 0.5 * j2Factors * ( 1.0 - eccentricities_.square( ) ).sqrt( ) *
+                ( 3.0 * squaredCosineOfInclinations - 1.0 );
+    }
+    else
+    {
+        ascendingNodeRates_ = Eigen::ArrayXd::Zero( numberOfObjects );
+        argumentOfPeriapsisRates_ = Eigen::ArrayXd::Zero( numberOfObjects );
+        meanAnomalyRates_ = meanMotions_;
+
+        // Orientation of the orbits is constant, so precompute the orbit orientation unit vectors.
+        orbital_element_conversions::computePeriapsisAndPerpendicularDirections(
+                    argumentsOfPeriapsisAtReferenceEpoch_, ascendingNodesAtReferenceEpoch_,
+                    sineOfInclinations_, cosineOfInclinations_, periapsisDirections_, perpendicularDirections_ );
+    }
+}
+
+//! Function to compute the Cartesian states of all objects at a given epoch.
+void KeplerCatalogPropagator::getCartesianStates(
+        const double secondsSinceJ2000,
+        Eigen::Matrix< double, 6, Eigen::Dynamic >& cartesianStates ) const
+{
+    const int totalNumberOfObjects = getNumberOfObjects( );
+    if( cartesianStates.cols( ) != totalNumberOfObjects )
+    {
+        cartesianStates.resize( 6, totalNumberOfObjects );
+    }
+
+    const double timeSinceReferenceEpoch = secondsSinceJ2000 - referenceEpoch_;
+
+    // Distribute objects over threads in contiguous ranges of whole blocks, so that no two threads write to the same
+    // cache line of the output.
+    const int numberOfBlocks = ( totalNumberOfObjects + objectBlockSize_ - 1 ) / objectBlockSize_;
+    const int numberOfThreads = std::min( numberOfThreads_, numberOfBlocks );
+    if( numberOfThreads <= 1 )
+    {
+        computeCartesianStatesOfObjectRange( 0, totalNumberOfObjects, timeSinceReferenceEpoch, &cartesianStates );
+    }
+    else
+    {
+        std::vector< std::thread > threads;
+        threads.reserve( numberOfThreads - 1 );
+        int firstObjectIndex = 0;
+        for( int i = 0; i < numberOfThreads; i++ )
+        {
+            const int numberOfBlocksInRange = numberOfBlocks / numberOfThreads +
+                    ( ( i < numberOfBlocks % numberOfThreads ) ? 1 : 0 );
+            const int numberOfObjects = std::min(
+                        numberOfBlocksInRange * objectBlockSize_, totalNumberOfObjects - firstObjectIndex );
+
+            // Compute last range on the calling thread.
+            if( i < numberOfThreads - 1 )
+            {
+                threads.push_back( std::thread( &KeplerCatalogPropagator::computeCartesianStatesOfObjectRange, this,
+                                                firstObjectIndex, numberOfObjects, timeSinceReferenceEpoch,
+                                                &cartesianStates ) );
+            }
+            else
+            {
+                computeCartesianStatesOfObjectRange(
+                            firstObjectIndex, numberOfObjects, timeSinceReferenceEpoch, &cartesianStates );
+            }
+            firstObjectIndex += numberOfObjects;
+        }
+
+        for( unsigned int i = 0; i < threads.size( ); i++ )
+        {
+            threads[ i ].join( );
+        }
+    }
+}
+
+//! Function to compute the Cartesian states of a range of objects, processing them in blocks.
+void KeplerCatalogPropagator::computeCartesianStatesOfObjectRange(
+        const int firstObjectIndex,
+        const int numberOfObjects,
+        const double timeSinceReferenceEpoch,
+        Eigen::Matrix< double, 6, Eigen::Dynamic >* cartesianStates ) const
+{
+    const int endObjectIndex = firstObjectIndex + numberOfObjects;
+    for( int blockStartIndex = firstObjectIndex; blockStartIndex < endObjectIndex;
+         blockStartIndex += objectBlockSize_ )
+    {
+        computeCartesianStatesOfObjectBlock(
+                    blockStartIndex, std::min( objectBlockSize_, endObjectIndex - blockStartIndex ),
+                    timeSinceReferenceEpoch, *cartesianStates );
+    }
+}
+
+//! Function to compute the Cartesian states of a block of objects.
+void KeplerCatalogPropagator::computeCartesianStatesOfObjectBlock(
+        const int firstObjectIndex,
+        const int numberOfObjects,
+        const double timeSinceReferenceEpoch,
+        Eigen::Matrix< double, 6, Eigen::Dynamic >& cartesianStates ) const
+{
+    const Eigen::ArrayXd eccentricities = eccentricities_.segment( firstObjectIndex, numberOfObjects );
+    const Eigen::ArrayXd semiMajorAxes = semiMajorAxes_.segment( firstObjectIndex, numberOfObjects );
+    const Eigen::ArrayXd semiMinorAxes = semiMinorAxes_.segment( firstObjectIndex, numberOfObjects );
+
+    // Solve Kepler's equation for all objects in block simultaneously.
+    const Eigen::ArrayXd meanAnomalies = meanAnomaliesAtReferenceEpoch_.segment( firstObjectIndex, numberOfObjects ) +
+            meanAnomalyRates_.segment( firstObjectIndex, numberOfObjects ) * timeSinceReferenceEpoch;
+    const Eigen::ArrayXd eccentricAnomalies =
+            orbital_element_conversions::convertMeanAnomaliesToEccentricAnomaliesWithHalley(
+                eccentricities, meanAnomalies, numberOfKeplerIterations_ );
+
+    // Compute position and velocity in perifocal frame.
+    const Eigen::ArrayXd sineOfEccentricAnomalies = eccentricAnomalies.sin( );
+    const Eigen::ArrayXd cosineOfEccentricAnomalies = eccentricAnomalies.cos( );
+    const Eigen::ArrayXd eccentricAnomalyRates = meanMotions_.segment( firstObjectIndex, numberOfObjects ) /
+            ( 1.0 - eccentricities * cosineOfEccentricAnomalies );
+
+    const Eigen::ArrayXd perifocalX = semiMajorAxes * ( cosineOfEccentricAnomalies - eccentricities );
+    const Eigen::ArrayXd perifocalY = semiMinorAxes * sineOfEccentricAnomalies;
+    const Eigen::ArrayXd perifocalVelocityX = -semiMajorAxes * sineOfEccentricAnomalies * eccentricAnomalyRates;
+    const Eigen::ArrayXd perifocalVelocityY = semiMinorAxes * cosineOfEccentricAnomalies * eccentricAnomalyRates;
+
+    // Retrieve (or compute, for drifting orbits) unit vectors towards periapsis (P) and in direction of motion at
+    // periapsis (Q).
+    Eigen::Array< double, Eigen::Dynamic, 3 > periapsisDirections;
+    Eigen::Array< double, Eigen::Dynamic, 3 > perpendicularDirections;
+    if( includeSecularDrift_ )
+    {
+        orbital_element_conversions::computePeriapsisAndPerpendicularDirections(
+                    argumentsOfPeriapsisAtReferenceEpoch_.segment( firstObjectIndex, numberOfObjects ) +
+                    argumentOfPeriapsisRates_.segment( firstObjectIndex, numberOfObjects ) * timeSinceReferenceEpoch,
+                    ascendingNodesAtReferenceEpoch_.segment( firstObjectIndex, numberOfObjects ) +
+                    ascendingNodeRates_.segment( firstObjectIndex, numberOfObjects ) * timeSinceReferenceEpoch,
+                    sineOfInclinations_.segment( firstObjectIndex, numberOfObjects ),
+                    cosineOfInclinations_.segment( firstObjectIndex, numberOfObjects ),
+                    periapsisDirections, perpendicularDirections );
+    }
+    else
+    {
+        periapsisDirections = periapsisDirections_.block( firstObjectIndex, 0, numberOfObjects, 3 );
+        perpendicularDirections = perpendicularDirections_.block( firstObjectIndex, 0, numberOfObjects, 3 );
+    }
+
+    // Compute Cartesian states, and set in output.
+    Eigen::Array< double, Eigen::Dynamic, 6 > states( numberOfObjects, 6 );
+    for( int j = 0; j < 3; j++ )
+    {
+        states.col( j ) = perifocalX * periapsisDirections.col( j ) + perifocalY * perpendicularDirections.col( j );
+        states.col( j + 3 ) = perifocalVelocityX * periapsisDirections.col( j ) +
+                perifocalVelocityY * perpendicularDirections.col( j );
+    }
+
+    cartesianStates.block( 0, firstObjectIndex, 6, numberOfObjects ) = states.matrix( ).transpose( );
+}
+
+} // namespace ephemerides
+
+} // namespace tudat
@@ -0,0 +1,223 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Vallado, D.A., Fundamentals of Astrodynamics and Applications, 4th edition, Microcosm Press, 2013.
+ */
+
+#ifndef TUDAT_KEPLER_CATALOG_PROPAGATOR_H
+#define TUDAT_KEPLER_CATALOG_PROPAGATOR_H
+
+#include <boost/shared_ptr.hpp>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Class to propagate the Kepler orbits (with optional secular J2 drift) of a catalog of objects.
+/*!
+ *  Class to compute the Cartesian states of a large number of objects (e.g. a catalog of Earth-orbiting objects for
+ *  conjunction screening) at a given epoch, assuming each object to move on a Kepler orbit. Optionally, the secular
+ *  drift of the longitude of the ascending node, argument of periapsis and mean anomaly due to the J2 term of the
+ *  central body is included (first-order theory, Vallado, 2013, eq. 9-41), in which case the elements are taken as
+ *  mean elements w.r.t. the equator of the central body. The velocities are computed from the Kepler motion in the
+ *  (drifting) orbital plane, i.e. the contribution of the rotation of the orbital plane to the velocity is neglected.
+ *
+ *  The elements of all objects are stored in structure-of-arrays layout, and all computations are performed on Eigen
+ *  arrays containing blocks of objects (sized such that all arrays remain in cache), so that they may be vectorized
+ *  by the compiler. Kepler's equation is solved by a fixed number of Halley iterations (see
+ *  convertMeanAnomaliesToEccentricAnomaliesWithHalley). The blocks of objects are distributed over a number of
+ *  threads. Only elliptical orbits are supported. Since the object is not modified after construction, the state
+ *  functions may be called concurrently from any number of threads.
+ */
+class KeplerCatalogPropagator
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor, sets the orbits of the objects, and precomputes all time-independent quantities.
+     *  \param keplerianElements Kepler elements of all objects at the reference epoch, with one row per object and
+     *  the semi-major axis, eccentricity, inclination, argument of periapsis, longitude of ascending node and true
+     *  anomaly in the columns (in the order of orbital_element_conversions::KeplerianElementIndices).
+     *  \param referenceEpoch Epoch (in seconds since J2000) at which the Kepler elements are given.
+     *  \param centralBodyGravitationalParameter Gravitational parameter of the central body.
+     *  \param centralBodyJ2 Unnormalized J2 coefficient of the central body (zero for pure Kepler orbits).
+     *  \param centralBodyEquatorialRadius Equatorial radius of the central body (only used if J2 is non-zero).
+     *  \param numberOfThreads Number of threads over which the objects are distributed (if zero, the number of
+     *  concurrent threads supported by the hardware is used).
+     *  \param numberOfKeplerIterations Number of Halley iterations used to solve Kepler's equation (default 4, which
+     *  yields machine precision for eccentricities up to 0.95).
+     */
+    KeplerCatalogPropagator( const Eigen::Array< double, Eigen::Dynamic, 6 >& keplerianElements,
+                             const double referenceEpoch,
+                             const double centralBodyGravitationalParameter,
+                             const double centralBodyJ2 = 0.0,
+                             const double centralBodyEquatorialRadius = 0.0,
+                             const int numberOfThreads = 0,
+                             const int numberOfKeplerIterations = 4 );
+
+    //! Function to compute the Cartesian states of all objects at a given epoch.
+    /*!
+     *  Function to compute the Cartesian states of all objects at a given epoch.
+     *  \param secondsSinceJ2000 Epoch (in seconds since J2000) at which the states are to be computed.
+     *  \param cartesianStates Cartesian states (returned by reference), with the state of object i in column i. The
+     *  matrix is only resized if its size is not yet correct, so that its memory can be reused between calls.
+     */
+    void getCartesianStates( const double secondsSinceJ2000,
+                             Eigen::Matrix< double, 6, Eigen::Dynamic >& cartesianStates ) const;
+
+    //! Function to compute the Cartesian states of all objects at a given epoch.
+    /*!
+     *  Function to compute the Cartesian states of all objects at a given epoch.
+     *  \param secondsSinceJ2000 Epoch (in seconds since J2000) at which the states are to be computed.
+     *  \return Cartesian states, with the state of object i in column i.
+     */
+    Eigen::Matrix< double, 6, Eigen::Dynamic > getCartesianStates( const double secondsSinceJ2000 ) const
+    {
+        Eigen::Matrix< double, 6, Eigen::Dynamic > cartesianStates;
+        getCartesianStates( secondsSinceJ2000, cartesianStates );
+        return cartesianStates;
+    }
+
+    //! Function to retrieve the number of objects in the catalog.
+    /*!
+     *  Function to retrieve the number of objects in the catalog.
+     *  \return Number of objects in the catalog.
+     */
+    int getNumberOfObjects( ) const
+    {
+        return static_cast< int >( semiMajorAxes_.size( ) );
+    }
+
+    //! Function to retrieve the secular rates of the longitudes of the ascending node.
+    /*!
+     *  Function to retrieve the secular rates of the longitudes of the ascending node of all objects (zero if J2 is
+     *  not used).
+     *  \return Secular rates of the longitudes of the ascending node.
+     */
+    Eigen::ArrayXd getAscendingNodeRates( ) const
+    {
+        return ascendingNodeRates_;
+    }
+
+    //! Function to retrieve the secular rates of the arguments of periapsis.
+    /*!
+     *  Function to retrieve the secular rates of the arguments of periapsis of all objects (zero if J2 is not used).
+     *  \return Secular rates of the arguments of periapsis.
+     */
+    Eigen::ArrayXd getArgumentOfPeriapsisRates( ) const
+    {
+        return argumentOfPeriapsisRates_;
+    }
+
+private:
+
+    //! Function to compute the Cartesian states of a block of objects.
+    /*!
+     *  Function to compute the Cartesian states of a block of (at most objectBlockSize_) objects, with all operations
+     *  performed on arrays containing all objects in the block.
+     *  \param firstObjectIndex Index of the first object in the block.
+     *  \param numberOfObjects Number of objects in the block.
+     *  \param timeSinceReferenceEpoch Time since the reference epoch of the elements.
+     *  \param cartesianStates Cartesian states of all objects, in which the states of the objects in the block are set
+     *  (returned by reference).
+     */
+    void computeCartesianStatesOfObjectBlock(
+            const int firstObjectIndex,
+            const int numberOfObjects,
+            const double timeSinceReferenceEpoch,
+            Eigen::Matrix< double, 6, Eigen::Dynamic >& cartesianStates ) const;
+
+    //! Function to compute the Cartesian states of a range of objects, processing them in blocks.
+    /*!
+     *  Function to compute the Cartesian states of a range of objects, processing them in blocks (see
+     *  computeCartesianStatesOfObjectBlock). Used as the task of a single thread.
+     *  \param firstObjectIndex Index of the first object in the range.
+     *  \param numberOfObjects Number of objects in the range.
+     *  \param timeSinceReferenceEpoch Time since the reference epoch of the elements.
+     *  \param cartesianStates Cartesian states of all objects, in which the states of the objects in the range are set
+     *  (returned by reference).
+     */
+    void computeCartesianStatesOfObjectRange(
+            const int firstObjectIndex,
+            const int numberOfObjects,
+            const double timeSinceReferenceEpoch,
+            Eigen::Matrix< double, 6, Eigen::Dynamic >* cartesianStates ) const;
+
+    //! Maximum number of objects for which the states are computed simultaneously.
+    static const int objectBlockSize_;
+
+    //! Epoch (in seconds since J2000) at which the Kepler elements are given.
+    double referenceEpoch_;
+
+    //! Number of threads over which the objects are distributed.
+    int numberOfThreads_;
+
+    //! Number of Halley iterations used to solve Kepler's equation.
+    int numberOfKeplerIterations_;
+
+    //! Boolean denoting whether the secular J2 drift of the orbits is included.
+    bool includeSecularDrift_;
+
+    //! Semi-major axes of the objects.
+    Eigen::ArrayXd semiMajorAxes_;
+
+    //! Eccentricities of the objects.
+    Eigen::ArrayXd eccentricities_;
+
+    //! Semi-minor axes of the objects.
+    Eigen::ArrayXd semiMinorAxes_;
+
+    //! Mean motions of the objects (unperturbed, used for velocity computation).
+    Eigen::ArrayXd meanMotions_;
+
+    //! Mean anomalies of the objects at the reference epoch.
+    Eigen::ArrayXd meanAnomaliesAtReferenceEpoch_;
+
+    //! Rates of change of the mean anomalies of the objects (including J2 drift, if used).
+    Eigen::ArrayXd meanAnomalyRates_;
+
+    //! Arguments of periapsis of the objects at the reference epoch.
+    Eigen::ArrayXd argumentsOfPeriapsisAtReferenceEpoch_;
+
+    //! Secular rates of the arguments of periapsis of the objects.
+    Eigen::ArrayXd argumentOfPeriapsisRates_;
+
+    //! Longitudes of the ascending node of the objects at the reference epoch.
+    Eigen::ArrayXd ascendingNodesAtReferenceEpoch_;
+
+    //! Secular rates of the longitudes of the ascending node of the objects.
+    Eigen::ArrayXd ascendingNodeRates_;
+
+    //! Cosines of the inclinations of the objects.
+    Eigen::ArrayXd cosineOfInclinations_;
+
+    //! Sines of the inclinations of the objects.
+    Eigen::ArrayXd sineOfInclinations_;
+
+    //! Unit vectors towards periapsis of the objects (one column per component; only set without secular drift).
+    Eigen::Array< double, Eigen::Dynamic, 3 > periapsisDirections_;
+
+    //! Unit vectors in the direction of motion at periapsis (one column per component; only set without drift).
+    Eigen::Array< double, Eigen::Dynamic, 3 > perpendicularDirections_;
+};
+
+//! Typedef for shared-pointer to KeplerCatalogPropagator object.
+typedef boost::shared_ptr< KeplerCatalogPropagator > KeplerCatalogPropagatorPointer;
+
+} // namespace ephemerides
+
+} // namespace tudat
+
+#endif // TUDAT_KEPLER_CATALOG_PROPAGATOR_H
@@ -190,5 +190,61 @@ basic_mathematics::Vector6d KeplerEphemeris::getCartesianStateFromEphemeris(
     return currentCartesianState;
 }
 
+//! Function to get states from ephemeris at a list of epochs.
+void KeplerEphemeris::getCartesianStatesFromEphemeris(
+        const std::vector< double >& secondsSinceEpoch,
+        Eigen::Matrix< double, 6, Eigen::Dynamic >& statesFromEphemeris,
+        const double julianDayAtEpoch )
+{
+    using namespace tudat::orbital_element_conversions;
+
+    if( isOrbitHyperbolic_ )
+    {
+        Ephemeris::getCartesianStatesFromEphemeris( secondsSinceEpoch, statesFromEphemeris, julianDayAtEpoch );
+        return;
+    }
+
+    const int numberOfEpochs = static_cast< int >( secondsSinceEpoch.size( ) );
+
+    // Compute mean anomalies at all epochs.
+    const double meanMotion = basic_astrodynamics::computeKeplerMeanMotion(
+                semiMajorAxis_, centralBodyGravitationalParameter_ );
+    const Eigen::ArrayXd meanAnomalies = initialMeanAnomaly_ + meanMotion * (
+                Eigen::Map< const Eigen::ArrayXd >( secondsSinceEpoch.data( ), numberOfEpochs ) -
+                epochOfInitialState_ );
+
+    // Compute eccentric anomalies at all epochs.
+    const Eigen::ArrayXd eccentricAnomalies = convertMeanAnomaliesToEccentricAnomalies< double >(
+                Eigen::ArrayXd::Constant( numberOfEpochs, eccentricity_ ), meanAnomalies );
+
+    // Compute sine and cosine of true anomalies from eccentric anomalies.
+    const Eigen::ArrayXd cosineOfEccentricAnomalies = eccentricAnomalies.cos( );
+    const Eigen::ArrayXd inverseDenominators = 1.0 / ( 1.0 - eccentricity_ * cosineOfEccentricAnomalies );
+    const Eigen::ArrayXd cosineOfTrueAnomalies =
+            ( cosineOfEccentricAnomalies - eccentricity_ ) * inverseDenominators;
+    const Eigen::ArrayXd sineOfTrueAnomalies =
+            std::sqrt( 1.0 - eccentricity_ * eccentricity_ ) * eccentricAnomalies.sin( ) * inverseDenominators;
+
+    // Compute positions and velocities in the perifocal coordinate system.
+    const Eigen::ArrayXd radii = semiLatusRectum_ / ( 1.0 + eccentricity_ * cosineOfTrueAnomalies );
+    const double velocityScale = std::sqrt( centralBodyGravitationalParameter_ / semiLatusRectum_ );
+
+    Eigen::Matrix< double, 3, Eigen::Dynamic > perifocalPositions =
+            Eigen::Matrix< double, 3, Eigen::Dynamic >::Zero( 3, numberOfEpochs );
+    Eigen::Matrix< double, 3, Eigen::Dynamic > perifocalVelocities =
+            Eigen::Matrix< double, 3, Eigen::Dynamic >::Zero( 3, numberOfEpochs );
+    perifocalPositions.row( 0 ) = ( radii * cosineOfTrueAnomalies ).matrix( ).transpose( );
+    perifocalPositions.row( 1 ) = ( radii * sineOfTrueAnomalies ).matrix( ).transpose( );
+    perifocalVelocities.row( 0 ) = ( -velocityScale * sineOfTrueAnomalies ).matrix( ).transpose( );
+    perifocalVelocities.row( 1 ) =
+            ( velocityScale * ( eccentricity_ + cosineOfTrueAnomalies ) ).matrix( ).transpose( );
+
+    // Rotate orbital plane to correct orientation.
+    const Eigen::Matrix3d rotationFromOrbitalPlane = rotationFromOrbitalPlane_.toRotationMatrix( );
+    statesFromEphemeris.resize( 6, numberOfEpochs );
+    statesFromEphemeris.topRows( 3 ).noalias( ) = rotationFromOrbitalPlane * perifocalPositions;
+    statesFromEphemeris.bottomRows( 3 ).noalias( ) = rotationFromOrbitalPlane * perifocalVelocities;
+}
+
 } // namespace ephemerides
 } // namespace tudat
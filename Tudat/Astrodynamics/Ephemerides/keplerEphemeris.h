@@ -100,6 +100,23 @@ public:
             const double secondsSinceEpoch,
             const double julianDayAtEpoch = basic_astrodynamics::JULIAN_DAY_ON_J2000 );
 
+    //! Function to get states from ephemeris at a list of epochs.
+    /*!
+     *  Computes states from ephemeris at a list of epochs, assuming a purely Keplerian orbit. For
+     *  elliptical orbits, the conversion from mean to eccentric anomaly is performed for all epochs
+     *  simultaneously (see convertMeanAnomaliesToEccentricAnomalies), as is the subsequent conversion
+     *  to Cartesian elements. For hyperbolic orbits, getCartesianStateFromEphemeris is called for
+     *  each epoch.
+     *  \param secondsSinceEpoch Seconds since epoch (w.r.t. same reference time as epochOfInitialState).
+     *  \param statesFromEphemeris Keplerian orbit Cartesian states (returned by reference), with the
+     *  state at secondsSinceEpoch[ i ] in column i.
+     *  \param julianDayAtEpoch Reference epoch in Julian day (default JD on J2000).
+     */
+    void getCartesianStatesFromEphemeris(
+            const std::vector< double >& secondsSinceEpoch,
+            Eigen::Matrix< double, 6, Eigen::Dynamic >& statesFromEphemeris,
+            const double julianDayAtEpoch = basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+
 private:
 
     //! Kepler elements at time epochOfInitialState.
@@ -89,6 +89,23 @@ Eigen::Matrix3d SimpleRotationalEphemeris::getDerivativeOfRotationToTargetFrame(
             * Eigen::Matrix3d( initialRotationToTargetFrame_ );
 }
 
+//! Function to calculate the full rotational state at given time
+void SimpleRotationalEphemeris::getFullRotationalQuantitiesToTargetFrame(
+        Eigen::Quaterniond& currentRotationToLocalFrame,
+        Eigen::Matrix3d& currentRotationToLocalFrameDerivative,
+        Eigen::Vector3d& currentAngularVelocityVectorInGlobalFrame,
+        const double secondsSinceEpoch, const double julianDayAtEpoch )
+{
+    // Calculate rotation, and its derivative from the rotation (without recomputing it).
+    currentRotationToLocalFrame = getRotationToTargetFrame( secondsSinceEpoch, julianDayAtEpoch );
+    const Eigen::Matrix3d rotationMatrixToLocalFrame = Eigen::Matrix3d( currentRotationToLocalFrame );
+    currentRotationToLocalFrameDerivative = rotationRate_ * auxiliaryMatrix_ * rotationMatrixToLocalFrame;
+
+    // Angular velocity vector is along local z-axis.
+    currentAngularVelocityVectorInGlobalFrame =
+            rotationRate_ * rotationMatrixToLocalFrame.transpose( ) * Eigen::Vector3d::UnitZ( );
+}
+
 //! Function to reset the right ascension and declination of body's north pole.
 void SimpleRotationalEphemeris::resetInitialPoleRightAscensionAndDeclination( const double rightAscension,
                                                    const double declination )
@@ -35,6 +35,7 @@
 #define TUDAT_TABULATEDEPHEMERIS_H
 
 #include <map>
+#include <vector>
 
 #include <Eigen/Core>
 
@@ -54,7 +55,9 @@ namespace ephemerides
  *  Class that determines an ephemeris from tabulated data, by using numerical interpolation of
  *  this data. Required input to this class is a OneDimensionalInterpolator, which may be reset.
  *  This class may for instance be used for setting the numerically integrated state of a body
- *  as its 'new' ephemeris
+ *  as its 'new' ephemeris. Since the interpolators do not modify their data during
+ *  interpolation, the state functions may be called concurrently from several threads (but not
+ *  concurrently with resetting the interpolator).
  */
 template< typename StateScalarType = double, typename TimeType = double >
 class TabulatedCartesianEphemeris : public Ephemeris
@@ -131,6 +134,41 @@ public:
             const double secondsSinceEpoch,
             const double julianDayAtEpoch = basic_astrodynamics::JULIAN_DAY_ON_J2000 );
 
+    //! Get cartesian states from ephemeris at a list of epochs.
+    /*!
+     * Computes cartesian states from ephemeris at a list of epochs, as calculated from
+     * interpolator_. The reference epoch is checked only once, and the interpolation is performed
+     * by the interpolateAtMultipleValues function of the interpolator, which uses a single lookup
+     * cursor for all epochs, so that the interval of each sorted epoch is found by hunting from
+     * that of the previous epoch.
+     * \param secondsSinceEpoch Seconds since epoch.
+     * \param statesFromEphemeris States in Cartesian elements from ephemeris (returned by
+     * reference), with the state at secondsSinceEpoch[ i ] in column i.
+     * \param julianDayAtEpoch Reference epoch in Julian day.
+     */
+    void getCartesianStatesFromEphemeris(
+            const std::vector< double >& secondsSinceEpoch,
+            Eigen::Matrix< double, 6, Eigen::Dynamic >& statesFromEphemeris,
+            const double julianDayAtEpoch = basic_astrodynamics::JULIAN_DAY_ON_J2000 )
+    {
+        if( julianDayAtEpoch != julianDayAtEpoch_ )
+        {
+            throw std::runtime_error(
+                        "Error in Tabulated Ephemeris, reference epochs are inconsistent" );
+        }
+
+        std::vector< StateType > interpolatedStates;
+        interpolator_->interpolateAtMultipleValues(
+                    std::vector< TimeType >( secondsSinceEpoch.begin( ), secondsSinceEpoch.end( ) ),
+                    interpolatedStates );
+
+        statesFromEphemeris.resize( 6, interpolatedStates.size( ) );
+        for( unsigned int i = 0; i < interpolatedStates.size( ); i++ )
+        {
+            statesFromEphemeris.col( i ) = interpolatedStates[ i ].template cast< double >( );
+        }
+    }
+
 
     //! Function to return the interpolator
     /*!
@@ -0,0 +1,157 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <stdexcept>
+
+#include <boost/make_shared.hpp>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/Ephemerides/tabulatedRotationalEphemeris.h"
+#include "Tudat/Mathematics/BasicMathematics/linearAlgebra.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Constructor.
+TabulatedRotationalEphemeris::TabulatedRotationalEphemeris(
+        const std::map< double, Eigen::Quaterniond >& rotationsToTargetFrame,
+        const std::string& baseFrameOrientation,
+        const std::string& targetFrameOrientation ):
+    RotationalEphemeris( baseFrameOrientation, targetFrameOrientation )
+{
+    if( rotationsToTargetFrame.size( ) < 2 )
+    {
+        throw std::runtime_error( "Error when creating tabulated rotational ephemeris, at least two rotations are "
+                                  "required." );
+    }
+
+    for( std::map< double, Eigen::Quaterniond >::const_iterator rotationIterator = rotationsToTargetFrame.begin( );
+         rotationIterator != rotationsToTargetFrame.end( ); rotationIterator++ )
+    {
+        times_.push_back( rotationIterator->first );
+        rotationsToTargetFrame_.push_back( rotationIterator->second.normalized( ) );
+    }
+
+    // Compute constant rotation rate in each interval, along shortest path between subsequent rotations.
+    for( unsigned int i = 0; i < times_.size( ) - 1; i++ )
+    {
+        Eigen::Quaterniond intervalRotation =
+                rotationsToTargetFrame_.at( i ).conjugate( ) * rotationsToTargetFrame_.at( i + 1 );
+        if( intervalRotation.w( ) < 0.0 )
+        {
+            intervalRotation.coeffs( ) *= -1.0;
+        }
+
+        const Eigen::AngleAxisd intervalAngleAxis( intervalRotation );
+        intervalRotationRates_.push_back(
+                    intervalAngleAxis.axis( ) * intervalAngleAxis.angle( ) / ( times_.at( i + 1 ) - times_.at( i ) ) );
+    }
+
+    lookUpScheme_ = interpolators::createLookupScheme( times_, interpolators::huntingAlgorithm );
+}
+
+//! Get rotation quaternion to target frame from base frame.
+Eigen::Quaterniond TabulatedRotationalEphemeris::getRotationToTargetFrame(
+        const double secondsSinceEpoch, const double julianDayAtEpoch )
+{
+    Eigen::Quaterniond rotationToTargetFrame;
+    interpolateRotation( secondsSinceEpoch, julianDayAtEpoch, rotationToTargetFrame );
+    return rotationToTargetFrame;
+}
+
+//! Function to calculate the derivative of the rotation matrix from original frame to target frame.
+Eigen::Matrix3d TabulatedRotationalEphemeris::getDerivativeOfRotationToTargetFrame(
+        const double secondsSinceEpoch, const double julianDayAtEpoch )
+{
+    Eigen::Quaterniond rotationToTargetFrame;
+    const Eigen::Vector3d rotationRate = interpolateRotation(
+                secondsSinceEpoch, julianDayAtEpoch, rotationToTargetFrame );
+    return Eigen::Matrix3d( rotationToTargetFrame ) * linear_algebra::getCrossProductMatrix( rotationRate );
+}
+
+//! Function to calculate the full rotational state at given time
+void TabulatedRotationalEphemeris::getFullRotationalQuantitiesToTargetFrame(
+        Eigen::Quaterniond& currentRotationToLocalFrame,
+        Eigen::Matrix3d& currentRotationToLocalFrameDerivative,
+        Eigen::Vector3d& currentAngularVelocityVectorInGlobalFrame,
+        const double secondsSinceEpoch, const double julianDayAtEpoch )
+{
+    const Eigen::Vector3d rotationRate = interpolateRotation(
+                secondsSinceEpoch, julianDayAtEpoch, currentRotationToLocalFrame );
+    currentRotationToLocalFrameDerivative =
+            Eigen::Matrix3d( currentRotationToLocalFrame ) * linear_algebra::getCrossProductMatrix( rotationRate );
+    currentAngularVelocityVectorInGlobalFrame = -rotationRate;
+}
+
+//! Function to interpolate the rotation to the target frame, and retrieve the rotation rate.
+Eigen::Vector3d TabulatedRotationalEphemeris::interpolateRotation(
+        const double secondsSinceEpoch,
+        const double julianDayAtEpoch,
+        Eigen::Quaterniond& rotationToTargetFrame )
+{
+    // Set number of seconds since J2000.
+    double secondsSinceJ2000 = secondsSinceEpoch;
+    if ( julianDayAtEpoch != basic_astrodynamics::JULIAN_DAY_ON_J2000 )
+    {
+        secondsSinceJ2000 -= ( basic_astrodynamics::JULIAN_DAY_ON_J2000 - julianDayAtEpoch )
+                * physical_constants::JULIAN_DAY;
+    }
+
+    // Find interpolation interval.
+    const int lowerIndex = lookUpScheme_->findNearestLowerNeighbour( secondsSinceJ2000 );
+
+    // Rotate from rotation at start of interval at constant rate.
+    const Eigen::Vector3d& rotationRate = intervalRotationRates_[ lowerIndex ];
+    const Eigen::Vector3d rotationVector = rotationRate * ( secondsSinceJ2000 - times_[ lowerIndex ] );
+    const double rotationAngle = rotationVector.norm( );
+    if( rotationAngle > 0.0 )
+    {
+        rotationToTargetFrame = rotationsToTargetFrame_[ lowerIndex ] *
+                Eigen::Quaterniond( Eigen::AngleAxisd( rotationAngle, rotationVector / rotationAngle ) );
+    }
+    else
+    {
+        rotationToTargetFrame = rotationsToTargetFrame_[ lowerIndex ];
+    }
+
+    return rotationRate;
+}
+
+//! Function to create a tabulated rotational ephemeris from any other rotational ephemeris.
+boost::shared_ptr< TabulatedRotationalEphemeris > createTabulatedRotationalEphemeris(
+        const boost::shared_ptr< RotationalEphemeris > originalRotationalEphemeris,
+        const double startTime,
+        const double endTime,
+        const double timeStep )
+{
+    if( !( timeStep > 0.0 ) || !( endTime > startTime ) )
+    {
+        throw std::runtime_error( "Error when creating tabulated rotational ephemeris, time interval is invalid." );
+    }
+
+    std::map< double, Eigen::Quaterniond > rotationsToTargetFrame;
+    double currentTime = startTime;
+    while( currentTime < endTime + timeStep )
+    {
+        rotationsToTargetFrame[ currentTime ] = originalRotationalEphemeris->getRotationToTargetFrame( currentTime );
+        currentTime += timeStep;
+    }
+
+    return boost::make_shared< TabulatedRotationalEphemeris >(
+                rotationsToTargetFrame, originalRotationalEphemeris->getBaseFrameOrientation( ),
+                originalRotationalEphemeris->getTargetFrameOrientation( ) );
+}
+
+} // namespace ephemerides
+
+} // namespace tudat
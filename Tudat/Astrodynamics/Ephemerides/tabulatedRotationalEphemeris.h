@@ -0,0 +1,197 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_TABULATED_ROTATIONAL_EPHEMERIS_H
+#define TUDAT_TABULATED_ROTATIONAL_EPHEMERIS_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include "Tudat/Astrodynamics/Ephemerides/rotationalEphemeris.h"
+#include "Tudat/Mathematics/Interpolators/lookupScheme.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Class to compute the rotation of a body by interpolation of tabulated rotations.
+/*!
+ *  Class to compute the rotation of a body by spherical linear interpolation (SLERP) of tabulated rotation
+ *  quaternions. Between two subsequent data points, the body is taken to rotate at a constant angular velocity about
+ *  a fixed axis, so that the time derivative of the rotation matrix is obtained directly from the interpolated
+ *  rotation (and the constant angular velocity of the current interval), without additional evaluations. The
+ *  interpolated rotation is exact for bodies rotating at a constant rate about a fixed axis (such as those
+ *  described by a SimpleRotationalEphemeris). The angular velocity in each interval is computed upon construction,
+ *  and the interval in which the interpolation is to be performed is found by a lookup scheme (see
+ *  interpolators::createLookupScheme), which keeps the state of the lookups in a thread-local cursor, so that the
+ *  ephemeris may be used concurrently by several threads. Requested times outside the tabulated range are
+ *  extrapolated using the first/last interval.
+ */
+class TabulatedRotationalEphemeris: public RotationalEphemeris
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor, sets the tabulated rotations and computes the angular velocity in each interval.
+     *  \param rotationsToTargetFrame Rotations from base to target frame, with the time (in seconds since J2000) as
+     *  key. At least two rotations must be provided.
+     *  \param baseFrameOrientation Base frame identifier.
+     *  \param targetFrameOrientation Target frame identifier.
+     */
+    TabulatedRotationalEphemeris(
+            const std::map< double, Eigen::Quaterniond >& rotationsToTargetFrame,
+            const std::string& baseFrameOrientation = "",
+            const std::string& targetFrameOrientation = "" );
+
+    //! Get rotation quaternion from target frame to base frame.
+    /*!
+     *  Function to calculate the rotation quaternion from target frame to base frame at specified time.
+     *  \param secondsSinceEpoch Seconds since Julian day epoch specified by 2nd argument.
+     *  \param julianDayAtEpoch Reference epoch in Julian days from which number of seconds are counted.
+     *  \return Rotation quaternion computed.
+     */
+    Eigen::Quaterniond getRotationToBaseFrame(
+            const double secondsSinceEpoch,
+            const double julianDayAtEpoch = basic_astrodynamics::JULIAN_DAY_ON_J2000 )
+    {
+        return getRotationToTargetFrame( secondsSinceEpoch, julianDayAtEpoch ).inverse( );
+    }
+
+    //! Get rotation quaternion to target frame from base frame.
+    /*!
+     *  Function to calculate the rotation quaternion to target frame from base frame at specified time.
+     *  \param secondsSinceEpoch Seconds since Julian day epoch specified by 2nd argument.
+     *  \param julianDayAtEpoch Reference epoch in Julian days from which number of seconds are counted.
+     *  \return Rotation quaternion computed.
+     */
+    Eigen::Quaterniond getRotationToTargetFrame(
+            const double secondsSinceEpoch,
+            const double julianDayAtEpoch = basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+
+    //! Function to calculate the derivative of the rotation matrix from target frame to original frame.
+    /*!
+     *  Function to calculate the derivative of the rotation matrix from target frame to original frame at specified
+     *  time.
+     *  \param secondsSinceEpoch Seconds since Julian day epoch specified by 2nd argument.
+     *  \param julianDayAtEpoch Reference epoch in Julian days from which number of seconds are counted.
+     *  \return Derivative of rotation from target (typically local) to original (typically global) frame at
+     *  specified time.
+     */
+    Eigen::Matrix3d getDerivativeOfRotationToBaseFrame(
+            const double secondsSinceEpoch,
+            const double julianDayAtEpoch = basic_astrodynamics::JULIAN_DAY_ON_J2000 )
+    {
+        return getDerivativeOfRotationToTargetFrame( secondsSinceEpoch, julianDayAtEpoch ).transpose( );
+    }
+
+    //! Function to calculate the derivative of the rotation matrix from original frame to target frame.
+    /*!
+     *  Function to calculate the derivative of the rotation matrix from original frame to target frame at specified
+     *  time.
+     *  \param secondsSinceEpoch Seconds since Julian day epoch specified by 2nd argument.
+     *  \param julianDayAtEpoch Reference epoch in Julian days from which number of seconds are counted.
+     *  \return Derivative of rotation from original (typically global) to target (typically local) frame at
+     *  specified time.
+     */
+    Eigen::Matrix3d getDerivativeOfRotationToTargetFrame(
+            const double secondsSinceEpoch,
+            const double julianDayAtEpoch = basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+
+    //! Function to calculate the full rotational state at given time
+    /*!
+     *  Function to calculate the full rotational state at given time (rotation matrix, derivative of rotation matrix
+     *  and angular velocity vector), from a single interpolation of the tabulated rotations.
+     *  \param currentRotationToLocalFrame Current rotation to local frame (returned by reference)
+     *  \param currentRotationToLocalFrameDerivative Current derivative of rotation matrix to local frame
+     *  (returned by reference)
+     *  \param currentAngularVelocityVectorInGlobalFrame Current angular velocity vector, expressed in global frame
+     *  (returned by reference)
+     *  \param secondsSinceEpoch Seconds since Julian day epoch specified by 2nd argument
+     *  \param julianDayAtEpoch Reference epoch in Julian days from which number of seconds are counted.
+     */
+    void getFullRotationalQuantitiesToTargetFrame(
+            Eigen::Quaterniond& currentRotationToLocalFrame,
+            Eigen::Matrix3d& currentRotationToLocalFrameDerivative,
+            Eigen::Vector3d& currentAngularVelocityVectorInGlobalFrame,
+            const double secondsSinceEpoch,
+            const double julianDayAtEpoch = basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+
+    //! Function to retrieve the times at which the rotations are tabulated.
+    /*!
+     *  Function to retrieve the times at which the rotations are tabulated.
+     *  \return Times at which the rotations are tabulated.
+     */
+    std::vector< double > getTimes( )
+    {
+        return times_;
+    }
+
+private:
+
+    //! Function to interpolate the rotation to the target frame, and retrieve the rotation rate.
+    /*!
+     *  Function to interpolate the rotation to the target frame, and retrieve the (constant) rotation rate vector in
+     *  the interpolation interval.
+     *  \param secondsSinceEpoch Seconds since Julian day epoch specified by 2nd argument.
+     *  \param julianDayAtEpoch Reference epoch in Julian days from which number of seconds are counted.
+     *  \param rotationToTargetFrame Interpolated rotation to target frame (returned by reference).
+     *  \return Rotation rate vector omega in interpolation interval, for which the time derivative of the rotation
+     *  matrix R to the target frame is R [omega]x (the angular velocity vector of the target frame, expressed in the
+     *  base frame, is -omega).
+     */
+    Eigen::Vector3d interpolateRotation(
+            const double secondsSinceEpoch,
+            const double julianDayAtEpoch,
+            Eigen::Quaterniond& rotationToTargetFrame );
+
+    //! Times at which the rotations are tabulated.
+    std::vector< double > times_;
+
+    //! Tabulated rotations from base to target frame.
+    std::vector< Eigen::Quaterniond > rotationsToTargetFrame_;
+
+    //! Rotation rate vectors in each interval (see interpolateRotation).
+    std::vector< Eigen::Vector3d > intervalRotationRates_;
+
+    //! Lookup scheme to find the interval in which the interpolation is to be performed.
+    boost::shared_ptr< interpolators::LookUpScheme< double > > lookUpScheme_;
+};
+
+//! Function to create a tabulated rotational ephemeris from any other rotational ephemeris.
+/*!
+ *  Function to create a tabulated rotational ephemeris from any other rotational ephemeris, by evaluating its
+ *  rotation at a fixed time step. The resulting model may be used instead of the original one when the rotation is
+ *  required many times (e.g. for a Spice-based model during a propagation).
+ *  \param originalRotationalEphemeris Rotational ephemeris of which the rotations are to be tabulated.
+ *  \param startTime Time (in seconds since J2000) of first tabulated rotation.
+ *  \param endTime Time (in seconds since J2000) up to which the rotations are to be tabulated.
+ *  \param timeStep Time step between tabulated rotations.
+ *  \return Tabulated rotational ephemeris.
+ */
+boost::shared_ptr< TabulatedRotationalEphemeris > createTabulatedRotationalEphemeris(
+        const boost::shared_ptr< RotationalEphemeris > originalRotationalEphemeris,
+        const double startTime,
+        const double endTime,
+        const double timeStep );
+
+} // namespace ephemerides
+
+} // namespace tudat
+
+#endif // TUDAT_TABULATED_ROTATIONAL_EPHEMERIS_H
@@ -0,0 +1,210 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <boost/lexical_cast.hpp>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/convertMeanToEccentricAnomalies.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/unitConversions.h"
+#include "Tudat/Astrodynamics/Ephemerides/approximatePlanetPositions.h"
+#include "Tudat/Astrodynamics/Ephemerides/vectorizedApproximatePlanetPositions.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Maximum number of epochs for which the states are computed simultaneously.
+const int VectorizedApproximatePlanetPositions::epochBlockSize_ = 256;
+
+//! Constructor.
+VectorizedApproximatePlanetPositions::VectorizedApproximatePlanetPositions(
+        const std::vector< ApproximatePlanetPositionsBase::BodiesWithEphemerisData >& bodiesWithEphemerisData,
+        const double sunGravitationalParameter,
+        const int numberOfKeplerIterations ):
+    bodiesWithEphemerisData_( bodiesWithEphemerisData ),
+    sunGravitationalParameter_( sunGravitationalParameter ),
+    numberOfKeplerIterations_( numberOfKeplerIterations )
+{
+    const int numberOfBodies = static_cast< int >( bodiesWithEphemerisData_.size( ) );
+    elementsAtJ2000_.resize( 6, numberOfBodies );
+    elementRates_.resize( 6, numberOfBodies );
+    additionalTerms_.resize( 4, numberOfBodies );
+
+    // Retrieve ephemeris data of all planets.
+    for( int i = 0; i < numberOfBodies; i++ )
+    {
+        const ApproximatePlanetPositionsDataContainer planetData =
+                ApproximatePlanetPositions( bodiesWithEphemerisData_.at( i ), sunGravitationalParameter_ )
+                .getApproximatePlanetPositionsDataContainer( );
+
+        elementsAtJ2000_.col( i ) << planetData.semiMajorAxis_, planetData.eccentricity_,
+                planetData.inclination_, planetData.meanLongitude_, planetData.longitudeOfPerihelion_,
+                planetData.longitudeOfAscendingNode_;
+        elementRates_.col( i ) << planetData.rateOfChangeOfSemiMajorAxis_, planetData.rateOfChangeOfEccentricity_,
+                planetData.rateOfChangeOfInclination_, planetData.rateOfChangeOfMeanLongitude_,
+                planetData.rateOfChangeOfLongitudeOfPerihelion_,
+                planetData.rateOfChangeOfLongitudeOfAscendingNode_;
+        additionalTerms_.col( i ) << planetData.additionalTermB_, planetData.additionalTermC_,
+                planetData.additionalTermS_, planetData.additionalTermF_;
+    }
+}
+
+//! Function to compute the Cartesian states of all planets at a list of epochs.
+void VectorizedApproximatePlanetPositions::getCartesianStates(
+        const std::vector< double >& secondsSinceEpoch,
+        std::vector< Eigen::Matrix< double, 6, Eigen::Dynamic > >& cartesianStates,
+        const double julianDayAtEpoch ) const
+{
+    std::vector< int > bodyIndices;
+    for( unsigned int i = 0; i < bodiesWithEphemerisData_.size( ); i++ )
+    {
+        bodyIndices.push_back( i );
+    }
+    computeCartesianStates( bodyIndices, secondsSinceEpoch, julianDayAtEpoch, cartesianStates );
+}
+
+//! Function to compute the Cartesian states of a single planet at a list of epochs.
+Eigen::Matrix< double, 6, Eigen::Dynamic > VectorizedApproximatePlanetPositions::getCartesianStatesOfBody(
+        const int bodyIndex,
+        const std::vector< double >& secondsSinceEpoch,
+        const double julianDayAtEpoch ) const
+{
+    if( bodyIndex < 0 || bodyIndex >= static_cast< int >( bodiesWithEphemerisData_.size( ) ) )
+    {
+        throw std::runtime_error( "Error when computing approximate planet positions, body index " +
+                                  boost::lexical_cast< std::string >( bodyIndex ) + " is out of range." );
+    }
+
+    std::vector< Eigen::Matrix< double, 6, Eigen::Dynamic > > cartesianStates;
+    computeCartesianStates( std::vector< int >( 1, bodyIndex ), secondsSinceEpoch, julianDayAtEpoch,
+                            cartesianStates );
+    return cartesianStates.at( 0 );
+}
+
+//! Function to compute the Cartesian states of a set of planets at a list of epochs.
+void VectorizedApproximatePlanetPositions::computeCartesianStates(
+        const std::vector< int >& bodyIndices,
+        const std::vector< double >& secondsSinceEpoch,
+        const double julianDayAtEpoch,
+        std::vector< Eigen::Matrix< double, 6, Eigen::Dynamic > >& cartesianStates ) const
+{
+    const int totalNumberOfEpochs = static_cast< int >( secondsSinceEpoch.size( ) );
+
+    // Compute number of centuries past J2000 at each epoch.
+    const Eigen::ArrayXd allCenturiesPastJ2000 =
+            ( Eigen::Map< const Eigen::ArrayXd >( secondsSinceEpoch.data( ), totalNumberOfEpochs ) /
+              physical_constants::JULIAN_DAY + ( julianDayAtEpoch - basic_astrodynamics::JULIAN_DAY_ON_J2000 ) ) /
+            36525.0;
+
+    cartesianStates.resize( bodyIndices.size( ) );
+    for( unsigned int i = 0; i < bodyIndices.size( ); i++ )
+    {
+        cartesianStates[ i ].resize( 6, totalNumberOfEpochs );
+    }
+
+    // Compute states for blocks of epochs, so that all intermediate arrays remain in cache.
+    for( int firstEpochIndex = 0; firstEpochIndex < totalNumberOfEpochs; firstEpochIndex += epochBlockSize_ )
+    {
+        const int numberOfEpochs = std::min( epochBlockSize_, totalNumberOfEpochs - firstEpochIndex );
+        computeCartesianStatesOfEpochBlock(
+                    bodyIndices, allCenturiesPastJ2000.segment( firstEpochIndex, numberOfEpochs ),
+                    firstEpochIndex, cartesianStates );
+    }
+}
+
+//! Function to compute the Cartesian states of a set of planets for a block of epochs.
+void VectorizedApproximatePlanetPositions::computeCartesianStatesOfEpochBlock(
+        const std::vector< int >& bodyIndices,
+        const Eigen::ArrayXd& centuriesPastJ2000,
+        const int firstEpochIndex,
+        std::vector< Eigen::Matrix< double, 6, Eigen::Dynamic > >& cartesianStates ) const
+{
+    const int numberOfEpochs = static_cast< int >( centuriesPastJ2000.size( ) );
+    const int numberOfBodies = static_cast< int >( bodyIndices.size( ) );
+    const int numberOfEntries = numberOfEpochs * numberOfBodies;
+
+    // Compute orbital elements (AU and degrees) of all planets at all epochs, with the entries of body i in segment
+    // i * numberOfEpochs to ( i + 1 ) * numberOfEpochs.
+    Eigen::Array< double, Eigen::Dynamic, 6 > elements( numberOfEntries, 6 );
+    Eigen::ArrayXd additionalMeanAnomalyTerms( numberOfEntries );
+    for( int i = 0; i < numberOfBodies; i++ )
+    {
+        const int bodyIndex = bodyIndices.at( i );
+        for( int j = 0; j < 6; j++ )
+        {
+            elements.block( i * numberOfEpochs, j, numberOfEpochs, 1 ) =
+                    elementsAtJ2000_( j, bodyIndex ) + elementRates_( j, bodyIndex ) * centuriesPastJ2000;
+        }
+
+        additionalMeanAnomalyTerms.segment( i * numberOfEpochs, numberOfEpochs ) =
+                additionalTerms_( 0, bodyIndex ) * centuriesPastJ2000.square( ) +
+                additionalTerms_( 1, bodyIndex ) * ( additionalTerms_( 3, bodyIndex ) * centuriesPastJ2000 ).cos( ) +
+                additionalTerms_( 2, bodyIndex ) * ( additionalTerms_( 3, bodyIndex ) * centuriesPastJ2000 ).sin( );
+    }
+
+    // Convert elements to SI units, and compute argument of periapsis and mean anomaly.
+    const double degreesToRadians = unit_conversions::convertDegreesToRadians( 1.0 );
+    const Eigen::ArrayXd semiMajorAxes = unit_conversions::convertAstronomicalUnitsToMeters( 1.0 ) * elements.col( 0 );
+    const Eigen::ArrayXd eccentricities = elements.col( 1 );
+    const Eigen::ArrayXd inclinations = degreesToRadians * elements.col( 2 );
+    const Eigen::ArrayXd longitudesOfAscendingNode = degreesToRadians * elements.col( 5 );
+    const Eigen::ArrayXd argumentsOfPeriapsis = degreesToRadians * ( elements.col( 4 ) - elements.col( 5 ) );
+    const Eigen::ArrayXd meanAnomalies = degreesToRadians *
+            ( elements.col( 3 ) - elements.col( 4 ) + additionalMeanAnomalyTerms );
+
+    // Solve Kepler's equation for all planets at all epochs simultaneously.
+    const Eigen::ArrayXd eccentricAnomalies =
+            orbital_element_conversions::convertMeanAnomaliesToEccentricAnomaliesWithHalley(
+                eccentricities, meanAnomalies, numberOfKeplerIterations_ );
+
+    // Compute position and velocity in perifocal frame.
+    const Eigen::ArrayXd sineOfEccentricAnomalies = eccentricAnomalies.sin( );
+    const Eigen::ArrayXd cosineOfEccentricAnomalies = eccentricAnomalies.cos( );
+    const Eigen::ArrayXd semiMinorAxes = semiMajorAxes * ( 1.0 - eccentricities.square( ) ).sqrt( );
+    const Eigen::ArrayXd eccentricAnomalyRates = ( sunGravitationalParameter_ / semiMajorAxes.cube( ) ).sqrt( ) /
+            ( 1.0 - eccentricities * cosineOfEccentricAnomalies );
+
+    const Eigen::ArrayXd perifocalX = semiMajorAxes * ( cosineOfEccentricAnomalies - eccentricities );
+    const Eigen::ArrayXd perifocalY = semiMinorAxes * sineOfEccentricAnomalies;
+    const Eigen::ArrayXd perifocalVelocityX = -semiMajorAxes * sineOfEccentricAnomalies * eccentricAnomalyRates;
+    const Eigen::ArrayXd perifocalVelocityY = semiMinorAxes * cosineOfEccentricAnomalies * eccentricAnomalyRates;
+
+    // Compute unit vectors towards periapsis (P) and in direction of motion at periapsis (Q).
+    Eigen::Array< double, Eigen::Dynamic, 3 > periapsisDirections;
+    Eigen::Array< double, Eigen::Dynamic, 3 > perpendicularDirections;
+    orbital_element_conversions::computePeriapsisAndPerpendicularDirections(
+                argumentsOfPeriapsis, longitudesOfAscendingNode, inclinations.sin( ), inclinations.cos( ),
+                periapsisDirections, perpendicularDirections );
+
+    // Compute Cartesian states, and set in output.
+    Eigen::Array< double, Eigen::Dynamic, 6 > states( numberOfEntries, 6 );
+    for( int j = 0; j < 3; j++ )
+    {
+        states.col( j ) = perifocalX * periapsisDirections.col( j ) + perifocalY * perpendicularDirections.col( j );
+        states.col( j + 3 ) = perifocalVelocityX * periapsisDirections.col( j ) +
+                perifocalVelocityY * perpendicularDirections.col( j );
+    }
+
+    for( int i = 0; i < numberOfBodies; i++ )
+    {
+        cartesianStates[ i ].block( 0, firstEpochIndex, 6, numberOfEpochs ) =
+                states.block( i * numberOfEpochs, 0, numberOfEpochs, 6 ).matrix( ).transpose( );
+    }
+}
+
+} // namespace ephemerides
+
+} // namespace tudat
@@ -0,0 +1,177 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Standish, E.M. Keplerian Elements for Approximate Positions of the Major Planets,
+ *          http://ssd.jpl.nasa.gov/txt/aprx_pos_planets.pdf, last accessed: 24 February, 2011.
+ */
+
+#ifndef TUDAT_VECTORIZED_APPROXIMATE_PLANET_POSITIONS_H
+#define TUDAT_VECTORIZED_APPROXIMATE_PLANET_POSITIONS_H
+
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/timeConversions.h"
+#include "Tudat/Astrodynamics/Ephemerides/approximatePlanetPositionsBase.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Class to evaluate the JPL "Approximate Positions of Major Planets" for many epochs and planets at once.
+/*!
+ *  Class to evaluate the JPL "Approximate Positions of Major Planets" (the same model as used by
+ *  ApproximatePlanetPositions) for a list of epochs and a list of planets simultaneously, as required for e.g.
+ *  porkchop plots and launch window sweeps. All computations are performed on Eigen arrays containing the elements of
+ *  all planets at a block of epochs (sized such that all arrays remain in cache), so that they may be vectorized by the
+ *  compiler. Kepler's equation is solved by a
+ *  fixed number of Halley iterations (see convertMeanAnomaliesToEccentricAnomaliesWithHalley), so that no root finder
+ *  objects are created, and no branches occur in the evaluation. The planet data is read from the ephemeris file only
+ *  once, upon construction. Since the object is not modified after construction, the state functions may be called
+ *  concurrently from any number of threads. As for ApproximatePlanetPositions, the states are heliocentric, w.r.t.
+ *  the mean ecliptic and equinox of J2000.
+ */
+class VectorizedApproximatePlanetPositions
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor, retrieves the ephemeris data of the planets.
+     *  \param bodiesWithEphemerisData Planets for which the states are to be computed.
+     *  \param sunGravitationalParameter The gravitational parameter of the Sun [m^3/s^2].
+     *  \param numberOfKeplerIterations Number of Halley iterations used to solve Kepler's equation (default 3, which
+     *  yields machine precision for all planets).
+     */
+    VectorizedApproximatePlanetPositions(
+            const std::vector< ApproximatePlanetPositionsBase::BodiesWithEphemerisData >& bodiesWithEphemerisData,
+            const double sunGravitationalParameter = 1.32712440018e20,
+            const int numberOfKeplerIterations = 3 );
+
+    //! Function to compute the Cartesian states of all planets at a list of epochs.
+    /*!
+     *  Function to compute the Cartesian states of all planets at a list of epochs.
+     *  \param secondsSinceEpoch Seconds since epoch at which the states are to be computed.
+     *  \param cartesianStates Cartesian states (returned by reference), with the states of planet i (in the order of
+     *  the constructor input) in entry i, and the state at secondsSinceEpoch[ j ] in column j of each entry.
+     *  \param julianDayAtEpoch Reference epoch in Julian day.
+     */
+    void getCartesianStates(
+            const std::vector< double >& secondsSinceEpoch,
+            std::vector< Eigen::Matrix< double, 6, Eigen::Dynamic > >& cartesianStates,
+            const double julianDayAtEpoch = basic_astrodynamics::JULIAN_DAY_ON_J2000 ) const;
+
+    //! Function to compute the Cartesian states of a single planet at a list of epochs.
+    /*!
+     *  Function to compute the Cartesian states of a single planet at a list of epochs.
+     *  \param bodyIndex Index of the planet (in the order of the constructor input).
+     *  \param secondsSinceEpoch Seconds since epoch at which the states are to be computed.
+     *  \param julianDayAtEpoch Reference epoch in Julian day.
+     *  \return Cartesian states, with the state at secondsSinceEpoch[ j ] in column j.
+     */
+    Eigen::Matrix< double, 6, Eigen::Dynamic > getCartesianStatesOfBody(
+            const int bodyIndex,
+            const std::vector< double >& secondsSinceEpoch,
+            const double julianDayAtEpoch = basic_astrodynamics::JULIAN_DAY_ON_J2000 ) const;
+
+    //! Function to retrieve the planets for which the states are computed.
+    /*!
+     *  Function to retrieve the planets for which the states are computed.
+     *  \return Planets for which the states are computed.
+     */
+    std::vector< ApproximatePlanetPositionsBase::BodiesWithEphemerisData > getBodiesWithEphemerisData( ) const
+    {
+        return bodiesWithEphemerisData_;
+    }
+
+    //! Function to retrieve the gravitational parameter of the Sun.
+    /*!
+     *  Function to retrieve the gravitational parameter of the Sun that is used in the calculations.
+     *  \return Gravitational parameter of the Sun.
+     */
+    double getSunGravitationalParameter( ) const
+    {
+        return sunGravitationalParameter_;
+    }
+
+private:
+
+    //! Function to compute the Cartesian states of a set of planets at a list of epochs.
+    /*!
+     *  Function to compute the Cartesian states of a set of planets at a list of epochs, processing the epochs in
+     *  blocks (see computeCartesianStatesOfEpochBlock).
+     *  \param bodyIndices Indices of the planets for which the states are to be computed.
+     *  \param secondsSinceEpoch Seconds since epoch at which the states are to be computed.
+     *  \param julianDayAtEpoch Reference epoch in Julian day.
+     *  \param cartesianStates Cartesian states (returned by reference), with the states of planet bodyIndices[ i ]
+     *  in entry i.
+     */
+    void computeCartesianStates(
+            const std::vector< int >& bodyIndices,
+            const std::vector< double >& secondsSinceEpoch,
+            const double julianDayAtEpoch,
+            std::vector< Eigen::Matrix< double, 6, Eigen::Dynamic > >& cartesianStates ) const;
+
+    //! Function to compute the Cartesian states of a set of planets for a block of epochs.
+    /*!
+     *  Function to compute the Cartesian states of a set of planets for a block of (at most epochBlockSize_)
+     *  epochs, with all operations performed on arrays containing the elements of all planets at all epochs in the
+     *  block.
+     *  \param bodyIndices Indices of the planets for which the states are to be computed.
+     *  \param centuriesPastJ2000 Number of Julian centuries past J2000 of the epochs in the block.
+     *  \param firstEpochIndex Index of the first epoch of the block in the full list of epochs.
+     *  \param cartesianStates Cartesian states of the planets at the full list of epochs, in which the states at the
+     *  epochs in the block are set (returned by reference).
+     */
+    void computeCartesianStatesOfEpochBlock(
+            const std::vector< int >& bodyIndices,
+            const Eigen::ArrayXd& centuriesPastJ2000,
+            const int firstEpochIndex,
+            std::vector< Eigen::Matrix< double, 6, Eigen::Dynamic > >& cartesianStates ) const;
+
+    //! Maximum number of epochs for which the states are computed simultaneously.
+    static const int epochBlockSize_;
+
+    //! Planets for which the states are computed.
+    std::vector< ApproximatePlanetPositionsBase::BodiesWithEphemerisData > bodiesWithEphemerisData_;
+
+    //! Gravitational parameter of the Sun.
+    double sunGravitationalParameter_;
+
+    //! Number of Halley iterations used to solve Kepler's equation.
+    int numberOfKeplerIterations_;
+
+    //! Orbital elements of the planets at J2000 (row per element, column per planet; AU and degrees).
+    /*!
+     *  Orbital elements of the planets at J2000, with the semi-major axis, eccentricity, inclination, mean longitude,
+     *  longitude of perihelion and longitude of ascending node in rows 0 to 5, and one column per planet.
+     */
+    Eigen::Array< double, 6, Eigen::Dynamic > elementsAtJ2000_;
+
+    //! Rates of change of the orbital elements of the planets, per Julian century (see elementsAtJ2000_).
+    Eigen::Array< double, 6, Eigen::Dynamic > elementRates_;
+
+    //! Additional terms b, c, s and f for the mean anomaly of the planets (row per term, column per planet).
+    Eigen::Array< double, 4, Eigen::Dynamic > additionalTerms_;
+};
+
+//! Typedef for shared-pointer to VectorizedApproximatePlanetPositions object.
+typedef boost::shared_ptr< VectorizedApproximatePlanetPositions > VectorizedApproximatePlanetPositionsPointer;
+
+} // namespace ephemerides
+
+} // namespace tudat
+
+#endif // TUDAT_VECTORIZED_APPROXIMATE_PLANET_POSITIONS_H
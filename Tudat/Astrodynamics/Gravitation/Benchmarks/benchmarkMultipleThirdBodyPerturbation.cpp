@@ -0,0 +1,216 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <iostream>
+#include <iomanip>
+
+#include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include "Tudat/Astrodynamics/Gravitation/centralGravityModel.h"
+#include "Tudat/Astrodynamics/Gravitation/thirdBodyPerturbation.h"
+#include "Tudat/Astrodynamics/Gravitation/multipleThirdBodyPerturbation.h"
+
+using namespace tudat;
+using namespace tudat::gravitation;
+
+//! Simple point mass, mimicking the position and gravitational parameter interface of a body in the environment.
+class PointMass
+{
+public:
+
+    PointMass( const Eigen::Vector3d& position, const double gravitationalParameter ):
+        position_( position ), gravitationalParameter_( gravitationalParameter ){ }
+
+    Eigen::Vector3d getPosition( ) { return position_; }
+
+    double getGravitationalParameter( ) { return gravitationalParameter_; }
+
+    Eigen::Vector3d position_;
+
+    double gravitationalParameter_;
+};
+
+//! Function to set positions of list of point masses in a single matrix.
+void getPositions( const std::vector< boost::shared_ptr< PointMass > >& bodies, Eigen::Matrix3Xd& positions )
+{
+    for( unsigned int i = 0; i < bodies.size( ); i++ )
+    {
+        positions.col( i ) = bodies[ i ]->getPosition( );
+    }
+}
+
+//! Function to set gravitational parameters of list of point masses in a single vector.
+void getGravitationalParameters( const std::vector< boost::shared_ptr< PointMass > >& bodies,
+                                 Eigen::VectorXd& gravitationalParameters )
+{
+    for( unsigned int i = 0; i < bodies.size( ); i++ )
+    {
+        gravitationalParameters( i ) = bodies[ i ]->getGravitationalParameter( );
+    }
+}
+
+//! Function to compute summed third-body perturbation in long double precision, as reference.
+Eigen::Vector3d computeReferenceAcceleration(
+        const Eigen::Vector3d& acceleratedBodyPosition, const Eigen::Vector3d& centralBodyPosition,
+        const std::vector< boost::shared_ptr< PointMass > >& perturbingBodies )
+{
+    Eigen::Matrix< long double, 3, 1 > acceleration = Eigen::Matrix< long double, 3, 1 >::Zero( );
+    Eigen::Matrix< long double, 3, 1 > relativePosition =
+            ( acceleratedBodyPosition.cast< long double >( ) - centralBodyPosition.cast< long double >( ) );
+    for( unsigned int i = 0; i < perturbingBodies.size( ); i++ )
+    {
+        Eigen::Matrix< long double, 3, 1 > perturbingBodyPosition =
+                perturbingBodies[ i ]->getPosition( ).cast< long double >( ) -
+                centralBodyPosition.cast< long double >( );
+        Eigen::Matrix< long double, 3, 1 > distanceVector = perturbingBodyPosition - relativePosition;
+        acceleration += static_cast< long double >( perturbingBodies[ i ]->getGravitationalParameter( ) ) * (
+                    distanceVector / std::pow( distanceVector.norm( ), 3 ) -
+                    perturbingBodyPosition / std::pow( perturbingBodyPosition.norm( ), 3 ) );
+    }
+    return acceleration.cast< double >( );
+}
+
+//! Benchmark of MultipleThirdBodyCentralGravityAcceleration against list of ThirdBodyCentralGravityAcceleration objects.
+/*!
+ *  Benchmark of MultipleThirdBodyCentralGravityAcceleration against a list of ThirdBodyCentralGravityAcceleration
+ *  objects, for the third-body perturbations of the Sun, Moon and nine planets (incl. Pluto) on a satellite orbiting the
+ *  Earth, for a range of orbital radii. Output is in CSV format, with columns: model name, orbit radius (m),
+ *  number of evaluations, time per evaluation (ns), maximum relative error w.r.t. long double reference, checksum.
+ */
+int main( )
+{
+    // Define (approximate, fixed) positions and gravitational parameters of perturbing bodies.
+    const Eigen::Vector3d earthPosition( -2.65E10, 1.33E11, 5.77E10 );
+    std::vector< boost::shared_ptr< PointMass > > perturbingBodies;
+    perturbingBodies.push_back( boost::make_shared< PointMass >( Eigen::Vector3d::Zero( ), 1.32712440018E20 ) );
+    perturbingBodies.push_back( boost::make_shared< PointMass >(
+                                    earthPosition + Eigen::Vector3d( 3.1E8, 2.2E8, -0.4E8 ), 4.9028E12 ) );
+    perturbingBodies.push_back( boost::make_shared< PointMass >(
+                                    Eigen::Vector3d( 4.4E10, -3.7E10, -2.4E10 ), 2.2032E13 ) );
+    perturbingBodies.push_back( boost::make_shared< PointMass >(
+                                    Eigen::Vector3d( -0.9E11, 0.4E11, 0.2E11 ), 3.24859E14 ) );
+    perturbingBodies.push_back( boost::make_shared< PointMass >(
+                                    Eigen::Vector3d( 2.0E11, 0.5E11, 0.2E11 ), 4.282837E13 ) );
+    perturbingBodies.push_back( boost::make_shared< PointMass >(
+                                    Eigen::Vector3d( 7.4E11, -2.1E11, -1.1E11 ), 1.26686534E17 ) );
+    perturbingBodies.push_back( boost::make_shared< PointMass >(
+                                    Eigen::Vector3d( -1.0E12, 0.9E12, 0.4E12 ), 3.7931187E16 ) );
+    perturbingBodies.push_back( boost::make_shared< PointMass >(
+                                    Eigen::Vector3d( 2.6E12, 1.3E12, 0.5E12 ), 5.793939E15 ) );
+    perturbingBodies.push_back( boost::make_shared< PointMass >(
+                                    Eigen::Vector3d( 4.3E12, -1.2E12, -0.6E12 ), 6.836529E15 ) );
+    perturbingBodies.push_back( boost::make_shared< PointMass >(
+                                    Eigen::Vector3d( 0.9E12, -4.4E12, -1.6E12 ), 8.71E11 ) );
+    perturbingBodies.push_back( boost::make_shared< PointMass >(
+                                    Eigen::Vector3d( 1.0E11, 0.6E11, 0.3E11 ), 6.3E10 ) );
+
+    boost::shared_ptr< PointMass > centralBody = boost::make_shared< PointMass >( earthPosition, 3.986004418E14 );
+    boost::shared_ptr< PointMass > satellite = boost::make_shared< PointMass >( earthPosition, 0.0 );
+
+    // Create existing composition of ThirdBodyCentralGravityAcceleration objects.
+    std::vector< boost::shared_ptr< ThirdBodyCentralGravityAcceleration > > thirdBodyAccelerations;
+    for( unsigned int i = 0; i < perturbingBodies.size( ); i++ )
+    {
+        thirdBodyAccelerations.push_back(
+                    boost::make_shared< ThirdBodyCentralGravityAcceleration >(
+                        boost::make_shared< CentralGravitationalAccelerationModel3d >(
+                            boost::bind( &PointMass::getPosition, satellite ),
+                            boost::bind( &PointMass::getGravitationalParameter, perturbingBodies[ i ] ),
+                            boost::bind( &PointMass::getPosition, perturbingBodies[ i ] ) ),
+                        boost::make_shared< CentralGravitationalAccelerationModel3d >(
+                            boost::bind( &PointMass::getPosition, centralBody ),
+                            boost::bind( &PointMass::getGravitationalParameter, perturbingBodies[ i ] ),
+                            boost::bind( &PointMass::getPosition, perturbingBodies[ i ] ) ), "Earth" ) );
+    }
+
+    // Create combined model.
+    MultipleThirdBodyCentralGravityAcceleration multipleThirdBodyAcceleration(
+                boost::bind( &PointMass::getPosition, satellite ),
+                boost::bind( &getPositions, perturbingBodies, _1 ),
+                boost::bind( &getGravitationalParameters, perturbingBodies, _1 ),
+                std::vector< std::string >( perturbingBodies.size( ), "" ), "Earth",
+                boost::bind( &PointMass::getPosition, centralBody ) );
+
+    const int numberOfEvaluations = 200000;
+    double orbitRadii[ 3 ] = { 7.0E6, 4.2E7, 1.0E9 };
+
+    std::cout << "model,orbit_radius_m,evaluations,time_per_evaluation_ns,maximum_relative_error,checksum" << std::endl;
+    for( unsigned int j = 0; j < 3; j++ )
+    {
+        // Define satellite positions on circular orbit.
+        std::vector< Eigen::Vector3d > satellitePositions;
+        for( int i = 0; i < 1000; i++ )
+        {
+            satellitePositions.push_back(
+                        earthPosition + orbitRadii[ j ] * Eigen::Vector3d(
+                            std::cos( 0.01 * i ), 0.9 * std::sin( 0.01 * i ), 0.43588989 * std::sin( 0.01 * i ) ) );
+        }
+
+        // Time both models.
+        for( unsigned int model = 0; model < 2; model++ )
+        {
+            Eigen::Vector3d checkSum = Eigen::Vector3d::Zero( );
+            boost::posix_time::ptime startTime = boost::posix_time::microsec_clock::local_time( );
+            for( int i = 0; i < numberOfEvaluations; i++ )
+            {
+                satellite->position_ = satellitePositions[ i % 1000 ];
+                if( model == 0 )
+                {
+                    for( unsigned int k = 0; k < thirdBodyAccelerations.size( ); k++ )
+                    {
+                        thirdBodyAccelerations[ k ]->updateMembers( static_cast< double >( i ) );
+                        checkSum += thirdBodyAccelerations[ k ]->getAcceleration( );
+                    }
+                }
+                else
+                {
+                    multipleThirdBodyAcceleration.updateMembers( static_cast< double >( i ) );
+                    checkSum += multipleThirdBodyAcceleration.getAcceleration( );
+                }
+            }
+            double elapsedTime = static_cast< double >(
+                        ( boost::posix_time::microsec_clock::local_time( ) - startTime ).total_microseconds( ) ) * 1.0E-6;
+
+            // Compute maximum error w.r.t. long double reference.
+            double maximumError = 0.0;
+            for( int i = 0; i < 1000; i++ )
+            {
+                satellite->position_ = satellitePositions[ i ];
+                Eigen::Vector3d acceleration = Eigen::Vector3d::Zero( );
+                if( model == 0 )
+                {
+                    for( unsigned int k = 0; k < thirdBodyAccelerations.size( ); k++ )
+                    {
+                        thirdBodyAccelerations[ k ]->updateMembers( -static_cast< double >( i ) - 1.0 );
+                        acceleration += thirdBodyAccelerations[ k ]->getAcceleration( );
+                    }
+                }
+                else
+                {
+                    multipleThirdBodyAcceleration.updateMembers( -static_cast< double >( i ) - 1.0 );
+                    acceleration = multipleThirdBodyAcceleration.getAcceleration( );
+                }
+                Eigen::Vector3d referenceAcceleration = computeReferenceAcceleration(
+                            satellite->position_, centralBody->position_, perturbingBodies );
+                maximumError = std::max( maximumError, ( acceleration - referenceAcceleration ).norm( ) /
+                                         referenceAcceleration.norm( ) );
+            }
+
+            std::cout << std::setprecision( 6 ) << ( model == 0 ? "third_body_composition" : "multiple_third_body" )
+                      << "," << orbitRadii[ j ] << "," << numberOfEvaluations << ","
+                      << elapsedTime / static_cast< double >( numberOfEvaluations ) * 1.0E9 << ","
+                      << maximumError << "," << checkSum.norm( ) << std::endl;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
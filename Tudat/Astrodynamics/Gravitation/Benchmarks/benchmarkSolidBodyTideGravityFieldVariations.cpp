@@ -0,0 +1,143 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <iostream>
+#include <iomanip>
+
+#include <boost/bind.hpp>
+#include <boost/lambda/lambda.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include "Tudat/Astrodynamics/Gravitation/basicSolidBodyTideGravityFieldVariations.h"
+#include "Tudat/Astrodynamics/Gravitation/fastSolidBodyTideGravityFieldVariations.h"
+
+using namespace tudat;
+using namespace tudat::gravitation;
+
+//! Function to compute state on inclined circular orbit, used as state of deforming bodies.
+basic_mathematics::Vector6d getCircularOrbitState(
+        const double time, const double radius, const double meanMotion,
+        const double inclination, const double phase )
+{
+    const double argument = meanMotion * time + phase;
+    basic_mathematics::Vector6d state;
+    state << radius * std::cos( argument ),
+            radius * std::sin( argument ) * std::cos( inclination ),
+            radius * std::sin( argument ) * std::sin( inclination ),
+            -radius * meanMotion * std::sin( argument ),
+            radius * meanMotion * std::cos( argument ) * std::cos( inclination ),
+            radius * meanMotion * std::cos( argument ) * std::sin( inclination );
+    return state;
+}
+
+//! Function to compute rotation to frame of uniformly rotating deformed body.
+Eigen::Quaterniond getRotationToBodyFixedFrame( const double time )
+{
+    return Eigen::Quaterniond( Eigen::AngleAxisd( -7.292115E-5 * time, Eigen::Vector3d::UnitZ( ) ) );
+}
+
+//! Function to compute state of deformed body, fixed at origin.
+basic_mathematics::Vector6d getZeroState( const double time )
+{
+    return basic_mathematics::Vector6d::Zero( );
+}
+
+//! Function to time the evaluation of a tide model, and compute its maximum difference w.r.t. reference model.
+void runBenchmark( const std::string& modelName,
+                   const boost::shared_ptr< GravityFieldVariations > tideModel,
+                   const boost::shared_ptr< GravityFieldVariations > referenceModel,
+                   const int numberOfEvaluations, const double timeStep )
+{
+    // Time evaluations.
+    double checkSum = 0.0;
+    boost::posix_time::ptime startTime = boost::posix_time::microsec_clock::local_time( );
+    for( int i = 0; i < numberOfEvaluations; i++ )
+    {
+        checkSum += tideModel->calculateSphericalHarmonicsCorrections(
+                    static_cast< double >( i ) * timeStep ).first( 0, 0 );
+    }
+    double elapsedTime = static_cast< double >(
+                ( boost::posix_time::microsec_clock::local_time( ) - startTime ).total_microseconds( ) ) * 1.0E-6;
+
+    // Compute maximum difference w.r.t. reference model, relative to maximum correction.
+    double maximumDifference = 0.0;
+    for( int i = 0; i < numberOfEvaluations; i += 97 )
+    {
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd > corrections =
+                tideModel->calculateSphericalHarmonicsCorrections( static_cast< double >( i ) * timeStep );
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd > referenceCorrections =
+                referenceModel->calculateSphericalHarmonicsCorrections( static_cast< double >( i ) * timeStep );
+        double currentDifference = std::max(
+                    ( corrections.first - referenceCorrections.first ).cwiseAbs( ).maxCoeff( ),
+                    ( corrections.second - referenceCorrections.second ).cwiseAbs( ).maxCoeff( ) ) /
+                referenceCorrections.first.cwiseAbs( ).maxCoeff( );
+        maximumDifference = std::max( maximumDifference, currentDifference );
+    }
+
+    std::cout << std::setprecision( 6 ) << modelName << "," << numberOfEvaluations << ","
+              << elapsedTime / static_cast< double >( numberOfEvaluations ) * 1.0E9 << ","
+              << maximumDifference << "," << checkSum << std::endl;
+}
+
+//! Benchmark of FastSolidBodyTideGravityFieldVariations against BasicSolidBodyTideGravityFieldVariations.
+/*!
+ *  Benchmark of FastSolidBodyTideGravityFieldVariations against BasicSolidBodyTideGravityFieldVariations, for degree 2
+ *  and 3 tides raised by the Moon and Sun on an Earth-like body. Output is in CSV format, with columns: model name,
+ *  number of evaluations, time per evaluation (ns), maximum relative difference w.r.t. basic model, checksum.
+ */
+int main( )
+{
+    std::vector< boost::function< basic_mathematics::Vector6d( const double ) > > deformingBodyStateFunctions;
+    deformingBodyStateFunctions.push_back(
+                boost::bind( &getCircularOrbitState, _1, 384400.0E3, 2.66E-6, 0.4, 0.3 ) );
+    deformingBodyStateFunctions.push_back(
+                boost::bind( &getCircularOrbitState, _1, 1.496E11, 1.99E-7, 0.409, 1.2 ) );
+
+    std::vector< boost::function< double( ) > > deformingBodyMasses;
+    deformingBodyMasses.push_back( boost::lambda::constant( 4.9028E12 ) );
+    deformingBodyMasses.push_back( boost::lambda::constant( 1.32712440018E20 ) );
+    boost::function< double( ) > deformedBodyMass = boost::lambda::constant( 3.986004418E14 );
+
+    std::vector< std::string > deformingBodies;
+    deformingBodies.push_back( "Moon" );
+    deformingBodies.push_back( "Sun" );
+
+    std::vector< std::vector< std::complex< double > > > loveNumbers;
+    loveNumbers.push_back( std::vector< std::complex< double > >( 3, std::complex< double >( 0.3, -0.0013 ) ) );
+    loveNumbers.push_back( std::vector< std::complex< double > >( 4, std::complex< double >( 0.093, 0.0 ) ) );
+
+    boost::shared_ptr< GravityFieldVariations > basicTide =
+            boost::make_shared< BasicSolidBodyTideGravityFieldVariations >(
+                &getZeroState, &getRotationToBodyFixedFrame, deformingBodyStateFunctions, 6378.0E3,
+                deformedBodyMass, deformingBodyMasses, loveNumbers, deformingBodies );
+
+    const int numberOfEvaluations = 200000;
+    const double timeStep = 10.0;
+
+    std::cout << "model,evaluations,time_per_evaluation_ns,maximum_relative_difference,checksum" << std::endl;
+    runBenchmark( "basic", basicTide, basicTide, numberOfEvaluations, timeStep );
+    runBenchmark( "fast", boost::make_shared< FastSolidBodyTideGravityFieldVariations >(
+                      &getZeroState, &getRotationToBodyFixedFrame, deformingBodyStateFunctions, 6378.0E3,
+                      deformedBodyMass, deformingBodyMasses, loveNumbers, deformingBodies ),
+                  basicTide, numberOfEvaluations, timeStep );
+
+    double tideUpdateIntervals[ 3 ] = { 60.0, 300.0, 900.0 };
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        runBenchmark( "fast_interpolated_" + boost::lexical_cast< std::string >( tideUpdateIntervals[ i ] ),
+                      boost::make_shared< FastSolidBodyTideGravityFieldVariations >(
+                          &getZeroState, &getRotationToBodyFixedFrame, deformingBodyStateFunctions, 6378.0E3,
+                          deformedBodyMass, deformingBodyMasses, loveNumbers, deformingBodies,
+                          tideUpdateIntervals[ i ] ),
+                      basicTide, numberOfEvaluations, timeStep );
+    }
+
+    return EXIT_SUCCESS;
+}
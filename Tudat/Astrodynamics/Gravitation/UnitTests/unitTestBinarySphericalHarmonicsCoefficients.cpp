@@ -0,0 +1,177 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+#include <boost/filesystem.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Astrodynamics/Gravitation/binarySphericalHarmonicsCoefficients.h"
+#include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsGravityField.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_binary_spherical_harmonics_coefficients )
+
+using namespace tudat::gravitation;
+
+//! Test writing, memory-mapping and using binary spherical harmonic coefficient files.
+BOOST_AUTO_TEST_CASE( testBinarySphericalHarmonicsCoefficients )
+{
+    // Define (arbitrary) coefficients up to degree 12 and order 10.
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( 13, 11 );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( 13, 11 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    for( int degree = 2; degree < 13; degree++ )
+    {
+        for( int order = 0; ( order <= degree ) && ( order < 11 ); order++ )
+        {
+            cosineCoefficients( degree, order ) = 1.0E-5 / ( degree * degree ) * std::cos( 2.0 * degree + order );
+            if( order > 0 )
+            {
+                sineCoefficients( degree, order ) = 1.0E-5 / ( degree * degree ) * std::sin( degree + 3.0 * order );
+            }
+        }
+    }
+    const double gravitationalParameter = 4.9028001E12;
+    const double referenceRadius = 1738.0E3;
+
+    // Write coefficients to binary file.
+    const std::string fileName = ( boost::filesystem::temp_directory_path( ) /
+                                   boost::filesystem::unique_path( "tudatBinarySh%%%%%%%%.bin" ) ).string( );
+    writeSphericalHarmonicsCoefficientsToBinaryFile(
+                fileName, gravitationalParameter, referenceRadius, cosineCoefficients, sineCoefficients, "IAU_Moon" );
+
+    // Check that only the coefficients with degree >= order are stored.
+    BOOST_CHECK_EQUAL( getNumberOfPackedSphericalHarmonicsCoefficients( 12, 10 ), 13 * 11 - 55 );
+    BOOST_CHECK_EQUAL( boost::filesystem::file_size( fileName ),
+                       sizeof( BinarySphericalHarmonicsFileHeader ) + 2 * ( 13 * 11 - 55 ) * sizeof( double ) );
+
+    {
+        // Map file, and check that contents are reproduced exactly.
+        MappedSphericalHarmonicsCoefficientsPointer mappedCoefficients =
+                boost::make_shared< MappedSphericalHarmonicsCoefficients >( fileName );
+        BOOST_CHECK_EQUAL( mappedCoefficients->getMaximumDegree( ), 12 );
+        BOOST_CHECK_EQUAL( mappedCoefficients->getMaximumOrder( ), 10 );
+        BOOST_CHECK_EQUAL( mappedCoefficients->getGravitationalParameter( ), gravitationalParameter );
+        BOOST_CHECK_EQUAL( mappedCoefficients->getReferenceRadius( ), referenceRadius );
+        BOOST_CHECK_EQUAL( mappedCoefficients->getReferenceFrame( ), "IAU_Moon" );
+        BOOST_CHECK( mappedCoefficients->getCosineCoefficients( ) == cosineCoefficients );
+        BOOST_CHECK( mappedCoefficients->getSineCoefficients( ) == sineCoefficients );
+        BOOST_CHECK( mappedCoefficients->getCosineCoefficients( 7, 7 ) == cosineCoefficients.block( 0, 0, 8, 8 ) );
+        BOOST_CHECK( mappedCoefficients->getSineCoefficients( 12, 3 ) == sineCoefficients.block( 0, 0, 13, 4 ) );
+        for( int degree = 0; degree < 13; degree++ )
+        {
+            for( int order = 0; order < 11; order++ )
+            {
+                BOOST_CHECK_EQUAL( mappedCoefficients->getCosineCoefficient( degree, order ),
+                                   cosineCoefficients( degree, order ) );
+                BOOST_CHECK_EQUAL( mappedCoefficients->getSineCoefficient( degree, order ),
+                                   sineCoefficients( degree, order ) );
+            }
+        }
+
+        // Create gravity fields from mapped and in-memory coefficients.
+        SphericalHarmonicsGravityField mappedGravityField( mappedCoefficients );
+        SphericalHarmonicsGravityField gravityField(
+                    gravitationalParameter, referenceRadius, cosineCoefficients, sineCoefficients, "IAU_Moon" );
+        BOOST_CHECK( mappedGravityField.getUsesMappedCoefficients( ) );
+        BOOST_CHECK_EQUAL( mappedGravityField.getFixedReferenceFrame( ), "IAU_Moon" );
+        BOOST_CHECK( mappedGravityField.getCosineCoefficients( 8, 6 ) == gravityField.getCosineCoefficients( 8, 6 ) );
+        BOOST_CHECK( mappedGravityField.getSineCoefficients( 8, 6 ) == gravityField.getSineCoefficients( 8, 6 ) );
+
+        // Check that the full coefficients are returned by reference, without detaching field from mapped file.
+        const Eigen::MatrixXd& fullCosineCoefficients = mappedGravityField.getCosineCoefficients( );
+        BOOST_CHECK( fullCosineCoefficients == cosineCoefficients );
+        BOOST_CHECK( mappedGravityField.getSineCoefficients( ) == sineCoefficients );
+        BOOST_CHECK_EQUAL( &mappedGravityField.getCosineCoefficients( ), &fullCosineCoefficients );
+        BOOST_CHECK( mappedGravityField.getUsesMappedCoefficients( ) );
+
+        // Check that potential and its gradient are identical.
+        const Eigen::Vector3d position( 1.2E6, -1.1E6, 0.8E6 );
+        BOOST_CHECK_EQUAL( mappedGravityField.getGravitationalPotential( position ),
+                           gravityField.getGravitationalPotential( position ) );
+        const Eigen::Vector3d mappedGradient = mappedGravityField.getGradientOfPotential( position );
+        const Eigen::Vector3d gradient = gravityField.getGradientOfPotential( position );
+        for( unsigned int i = 0; i < 3; i++ )
+        {
+            BOOST_CHECK_EQUAL( mappedGradient( i ), gradient( i ) );
+        }
+
+        // Check that resetting coefficients detaches field from mapped file.
+        Eigen::MatrixXd modifiedCosineCoefficients = cosineCoefficients;
+        modifiedCosineCoefficients( 2, 0 ) += 1.0E-6;
+        mappedGravityField.setCosineCoefficients( modifiedCosineCoefficients );
+        BOOST_CHECK( !mappedGravityField.getUsesMappedCoefficients( ) );
+        BOOST_CHECK( mappedGravityField.getCosineCoefficients( ) == modifiedCosineCoefficients );
+        BOOST_CHECK( mappedGravityField.getSineCoefficients( ) == sineCoefficients );
+        BOOST_CHECK( mappedCoefficients->getCosineCoefficients( ) == cosineCoefficients );
+    }
+
+    // Check that coefficients with order exceeding degree can not be written.
+    Eigen::MatrixXd invalidSineCoefficients = sineCoefficients;
+    invalidSineCoefficients( 3, 5 ) = 1.0E-8;
+    bool isExceptionCaught = false;
+    try
+    {
+        writeSphericalHarmonicsCoefficientsToBinaryFile(
+                    fileName, gravitationalParameter, referenceRadius, cosineCoefficients, invalidSineCoefficients );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+
+    // Check that truncated or corrupted files are rejected.
+    {
+        std::fstream fileStream( fileName.c_str( ), std::ios::in | std::ios::out | std::ios::binary );
+        fileStream.seekp( 0 );
+        fileStream.write( "NOTTUDAT", 8 );
+    }
+    isExceptionCaught = false;
+    try
+    {
+        MappedSphericalHarmonicsCoefficients corruptedCoefficients( fileName );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+
+    boost::filesystem::resize_file( fileName, 100 );
+    isExceptionCaught = false;
+    try
+    {
+        MappedSphericalHarmonicsCoefficients truncatedCoefficients( fileName );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+
+    boost::filesystem::remove( fileName );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -0,0 +1,165 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <limits>
+
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/bind.hpp>
+#include <boost/lambda/lambda.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Gravitation/basicSolidBodyTideGravityFieldVariations.h"
+#include "Tudat/Astrodynamics/Gravitation/fastSolidBodyTideGravityFieldVariations.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_fast_solid_body_tide_gravity_field_variations )
+
+using namespace tudat::gravitation;
+
+//! Function to compute state on inclined circular orbit, used as test state of deforming bodies.
+basic_mathematics::Vector6d getCircularOrbitState(
+        const double time, const double radius, const double meanMotion,
+        const double inclination, const double phase )
+{
+    const double argument = meanMotion * time + phase;
+    basic_mathematics::Vector6d state;
+    state << radius * std::cos( argument ),
+            radius * std::sin( argument ) * std::cos( inclination ),
+            radius * std::sin( argument ) * std::sin( inclination ),
+            -radius * meanMotion * std::sin( argument ),
+            radius * meanMotion * std::cos( argument ) * std::cos( inclination ),
+            radius * meanMotion * std::cos( argument ) * std::sin( inclination );
+    return state;
+}
+
+//! Function to compute rotation to frame of uniformly rotating deformed body.
+Eigen::Quaterniond getRotationToBodyFixedFrame( const double time, const double rotationRate )
+{
+    return Eigen::Quaterniond( Eigen::AngleAxisd( -rotationRate * time, Eigen::Vector3d::UnitZ( ) ) );
+}
+
+//! Function to compute state of deformed body, fixed at origin.
+basic_mathematics::Vector6d getZeroState( const double time )
+{
+    return basic_mathematics::Vector6d::Zero( );
+}
+
+BOOST_AUTO_TEST_CASE( testFastSolidBodyTideGravityFieldVariations )
+{
+    // Define properties of deformed body (Earth-like) and deforming bodies (Moon- and Sun-like).
+    const double referenceRadius = 6378.0E3;
+    const double rotationRate = 7.292115E-5;
+
+    std::vector< boost::function< basic_mathematics::Vector6d( const double ) > > deformingBodyStateFunctions;
+    deformingBodyStateFunctions.push_back(
+                boost::bind( &getCircularOrbitState, _1, 384400.0E3, 2.66E-6, 0.4, 0.3 ) );
+    deformingBodyStateFunctions.push_back(
+                boost::bind( &getCircularOrbitState, _1, 1.496E11, 1.99E-7, 0.409, 1.2 ) );
+
+    std::vector< boost::function< double( ) > > deformingBodyMasses;
+    deformingBodyMasses.push_back( boost::lambda::constant( 4.9028E12 ) );
+    deformingBodyMasses.push_back( boost::lambda::constant( 1.32712440018E20 ) );
+    boost::function< double( ) > deformedBodyMass = boost::lambda::constant( 3.986004418E14 );
+
+    std::vector< std::string > deformingBodies;
+    deformingBodies.push_back( "Moon" );
+    deformingBodies.push_back( "Sun" );
+
+    // Define complex Love numbers up to degree 3, with different value per degree and order.
+    std::vector< std::vector< std::complex< double > > > loveNumbers;
+    loveNumbers.push_back( std::vector< std::complex< double > >( ) );
+    loveNumbers[ 0 ].push_back( std::complex< double >( 0.30190, 0.0 ) );
+    loveNumbers[ 0 ].push_back( std::complex< double >( 0.29830, -0.00144 ) );
+    loveNumbers[ 0 ].push_back( std::complex< double >( 0.30102, -0.00130 ) );
+    loveNumbers.push_back( std::vector< std::complex< double > >( 4, std::complex< double >( 0.093, 0.0 ) ) );
+
+    boost::function< Eigen::Quaterniond( const double ) > orientationFunction =
+            boost::bind( &getRotationToBodyFixedFrame, _1, rotationRate );
+
+    // Create nominal and efficient tide models.
+    BasicSolidBodyTideGravityFieldVariations basicTide(
+                &getZeroState, orientationFunction, deformingBodyStateFunctions, referenceRadius,
+                deformedBodyMass, deformingBodyMasses, loveNumbers, deformingBodies );
+    FastSolidBodyTideGravityFieldVariations fastTide(
+                &getZeroState, orientationFunction, deformingBodyStateFunctions, referenceRadius,
+                deformedBodyMass, deformingBodyMasses, loveNumbers, deformingBodies );
+    FastSolidBodyTideGravityFieldVariations interpolatedFastTide(
+                &getZeroState, orientationFunction, deformingBodyStateFunctions, referenceRadius,
+                deformedBodyMass, deformingBodyMasses, loveNumbers, deformingBodies, 300.0 );
+
+    // Compare variations at range of times (non-monotonic, to test node window updates).
+    double testTimes[ 7 ] = { 1.0E6, 1.0E6 + 123.0, 1.0E6 + 450.0, 1.0E6 + 300.0, 1.0E6 - 700.0,
+                              3.0E6 + 55.0, -2.0E5 };
+    for( unsigned int t = 0; t < 7; t++ )
+    {
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd > basicCorrections =
+                basicTide.calculateSphericalHarmonicsCorrections( testTimes[ t ] );
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd > fastCorrections =
+                fastTide.calculateSphericalHarmonicsCorrections( testTimes[ t ] );
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd > interpolatedCorrections =
+                interpolatedFastTide.calculateSphericalHarmonicsCorrections( testTimes[ t ] );
+
+        BOOST_CHECK_EQUAL( fastCorrections.first.rows( ), 2 );
+        BOOST_CHECK_EQUAL( fastCorrections.first.cols( ), 4 );
+
+        // Check direct evaluation to within numerical precision, and interpolation to within 1 ppm of maximum tide.
+        const double maximumCorrection = basicCorrections.first.cwiseAbs( ).maxCoeff( );
+        for( unsigned int i = 0; i < 2; i++ )
+        {
+            for( unsigned int j = 0; j < 4; j++ )
+            {
+                BOOST_CHECK_SMALL( fastCorrections.first( i, j ) - basicCorrections.first( i, j ),
+                                   1.0E-14 * maximumCorrection );
+                BOOST_CHECK_SMALL( fastCorrections.second( i, j ) - basicCorrections.second( i, j ),
+                                   1.0E-14 * maximumCorrection );
+                BOOST_CHECK_SMALL( interpolatedCorrections.first( i, j ) - basicCorrections.first( i, j ),
+                                   1.0E-6 * maximumCorrection );
+                BOOST_CHECK_SMALL( interpolatedCorrections.second( i, j ) - basicCorrections.second( i, j ),
+                                   1.0E-6 * maximumCorrection );
+            }
+        }
+    }
+
+    // Check that Love numbers are used as currently set.
+    std::vector< std::complex< double > > newLoveNumbers( 2, std::complex< double >( 0.5, 0.0 ) );
+    basicTide.resetLoveNumbersOfDegree( newLoveNumbers, 2 );
+    interpolatedFastTide.resetLoveNumbersOfDegree( newLoveNumbers, 2 );
+    BOOST_CHECK_SMALL( interpolatedFastTide.calculateSphericalHarmonicsCorrections( 1.0E6 ).first( 0, 0 ) -
+                       basicTide.calculateSphericalHarmonicsCorrections( 1.0E6 ).first( 0, 0 ),
+                       1.0E-6 * std::fabs( basicTide.calculateSphericalHarmonicsCorrections( 1.0E6 ).first( 0, 0 ) ) );
+
+    // Check that models of too high degree are rejected.
+    loveNumbers.push_back( std::vector< std::complex< double > >( 5, std::complex< double >( 0.01, 0.0 ) ) );
+    bool isExceptionCaught = false;
+    try
+    {
+        FastSolidBodyTideGravityFieldVariations invalidTide(
+                    &getZeroState, orientationFunction, deformingBodyStateFunctions, referenceRadius,
+                    deformedBodyMass, deformingBodyMasses, loveNumbers, deformingBodies );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
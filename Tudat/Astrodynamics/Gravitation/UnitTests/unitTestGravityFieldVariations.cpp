@@ -275,6 +275,33 @@ BOOST_AUTO_TEST_CASE( testGravityFieldVariations )
         }
     }
 
+    // Test whether repeated updates, and updates after modifying the nominal field, only modify the
+    // coefficients as required.
+    {
+        // Update twice at same time, and check that coefficients are unchanged.
+        timeDependentGravityField->update( testTime );
+        timeDependentGravityField->update( testTime );
+        for( unsigned int i = 0; i < 5; i++ )
+        {
+            for( unsigned int j = 0; j < 5; j++ )
+            {
+                BOOST_CHECK_EQUAL( timeDependentGravityField->getCosineCoefficients( )( i, j ),
+                                   perturbedCosineCoefficients( i, j ) );
+                BOOST_CHECK_EQUAL( timeDependentGravityField->getSineCoefficients( )( i, j ),
+                                   perturbedSineCoefficients( i, j ) );
+            }
+        }
+
+        // Modify nominal coefficient outside of variation blocks, and check that it is updated.
+        timeDependentGravityField->setNominalCosineCoefficient( 4, 4, 1.0E-6 );
+        timeDependentGravityField->update( testTime );
+        BOOST_CHECK_EQUAL( timeDependentGravityField->getCosineCoefficients( )( 4, 4 ), 1.0E-6 );
+        BOOST_CHECK_SMALL( timeDependentGravityField->getCosineCoefficients( )( 2, 0 ) -
+                           perturbedCosineCoefficients( 2, 0 ), 1.0E-18 );
+        timeDependentGravityField->setNominalCosineCoefficient(
+                    4, 4, nominalCosineCoefficients( 4, 4 ) );
+    }
+
     // Test calculated tidal corrections against manual corrections directly from Cartesian states
     // of perturbing bodies.
     {
@@ -0,0 +1,156 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <limits>
+#include <vector>
+
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/bind.hpp>
+#include <boost/lambda/lambda.hpp>
+#include <boost/make_shared.hpp>
+
+#include "Tudat/Astrodynamics/Gravitation/centralGravityModel.h"
+#include "Tudat/Astrodynamics/Gravitation/thirdBodyPerturbation.h"
+#include "Tudat/Astrodynamics/Gravitation/multipleThirdBodyPerturbation.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_multiple_third_body_perturbation )
+
+using namespace tudat::gravitation;
+
+//! Function to set list of positions in a single matrix.
+void getPositions( const std::vector< Eigen::Vector3d >& positionList, Eigen::Matrix3Xd& positions )
+{
+    for( unsigned int i = 0; i < positionList.size( ); i++ )
+    {
+        positions.col( i ) = positionList[ i ];
+    }
+}
+
+//! Function to set list of gravitational parameters in a single vector.
+void getGravitationalParameters( const std::vector< double >& gravitationalParameterList,
+                                 Eigen::VectorXd& gravitationalParameters )
+{
+    for( unsigned int i = 0; i < gravitationalParameterList.size( ); i++ )
+    {
+        gravitationalParameters( i ) = gravitationalParameterList[ i ];
+    }
+}
+
+//! Function to compute third-body perturbation in long double precision, as reference.
+Eigen::Vector3d computeReferenceThirdBodyPerturbation(
+        const double gravitationalParameter, const Eigen::Vector3d& relativePositionOfAffectedBody,
+        const Eigen::Vector3d& relativePositionOfPerturbingBody )
+{
+    Eigen::Matrix< long double, 3, 1 > affectedBodyPosition = relativePositionOfAffectedBody.cast< long double >( );
+    Eigen::Matrix< long double, 3, 1 > perturbingBodyPosition = relativePositionOfPerturbingBody.cast< long double >( );
+    Eigen::Matrix< long double, 3, 1 > relativePosition = perturbingBodyPosition - affectedBodyPosition;
+
+    return ( static_cast< long double >( gravitationalParameter ) * (
+                 relativePosition / std::pow( relativePosition.norm( ), 3 ) -
+                 perturbingBodyPosition / std::pow( perturbingBodyPosition.norm( ), 3 ) ) ).cast< double >( );
+}
+
+//! Test combined third-body acceleration w.r.t. separate ThirdBodyCentralGravityAcceleration objects.
+BOOST_AUTO_TEST_CASE( testMultipleThirdBodyPerturbation )
+{
+    // Define (arbitrary, Earth-centered) positions of central body, accelerated body and perturbing bodies.
+    const Eigen::Vector3d centralBodyPosition( -2.6E10, 1.4E11, 6.1E10 );
+    const Eigen::Vector3d acceleratedBodyPosition = centralBodyPosition + Eigen::Vector3d( 4.2E6, -5.1E6, 1.3E6 );
+
+    std::vector< Eigen::Vector3d > perturbingBodyPositions;
+    perturbingBodyPositions.push_back( Eigen::Vector3d::Zero( ) );
+    perturbingBodyPositions.push_back( centralBodyPosition + Eigen::Vector3d( 3.1E8, 2.2E8, -0.4E8 ) );
+    perturbingBodyPositions.push_back( Eigen::Vector3d( 7.4E11, -2.1E11, 0.3E11 ) );
+    perturbingBodyPositions.push_back( Eigen::Vector3d( -0.9E11, 0.4E11, 0.2E11 ) );
+
+    std::vector< double > gravitationalParameters;
+    gravitationalParameters.push_back( 1.32712440018E20 );
+    gravitationalParameters.push_back( 4.9028E12 );
+    gravitationalParameters.push_back( 1.26686534E17 );
+    gravitationalParameters.push_back( 3.24859E14 );
+
+    std::vector< std::string > perturbingBodyNames;
+    perturbingBodyNames.push_back( "Sun" );
+    perturbingBodyNames.push_back( "Moon" );
+    perturbingBodyNames.push_back( "Jupiter" );
+    perturbingBodyNames.push_back( "Venus" );
+
+    // Create combined acceleration model, both w.r.t. central body and inertial origin.
+    MultipleThirdBodyCentralGravityAcceleration multipleThirdBodyAcceleration(
+                boost::lambda::constant( acceleratedBodyPosition ),
+                boost::bind( &getPositions, perturbingBodyPositions, _1 ),
+                boost::bind( &getGravitationalParameters, gravitationalParameters, _1 ),
+                perturbingBodyNames, "Earth", boost::lambda::constant( centralBodyPosition ), true );
+    MultipleThirdBodyCentralGravityAcceleration multipleDirectAcceleration(
+                boost::lambda::constant( acceleratedBodyPosition ),
+                boost::bind( &getPositions, perturbingBodyPositions, _1 ),
+                boost::bind( &getGravitationalParameters, gravitationalParameters, _1 ),
+                perturbingBodyNames, "SSB", boost::lambda::constant( Eigen::Vector3d::Zero( ) ), false );
+    multipleThirdBodyAcceleration.updateMembers( 0.0 );
+    multipleDirectAcceleration.updateMembers( 0.0 );
+
+    BOOST_CHECK_EQUAL( multipleThirdBodyAcceleration.getPerturbingBodyNames( ).size( ), 4 );
+    BOOST_CHECK_EQUAL( multipleThirdBodyAcceleration.getCentralBodyName( ), "Earth" );
+
+    // Compute acceleration from existing models, and long double reference.
+    Eigen::Vector3d thirdBodyAcceleration = Eigen::Vector3d::Zero( );
+    Eigen::Vector3d directAcceleration = Eigen::Vector3d::Zero( );
+    Eigen::Vector3d referenceAcceleration = Eigen::Vector3d::Zero( );
+    Eigen::Vector3d battinAcceleration = Eigen::Vector3d::Zero( );
+    for( unsigned int i = 0; i < perturbingBodyPositions.size( ); i++ )
+    {
+        boost::shared_ptr< CentralGravitationalAccelerationModel3d > directModel =
+                boost::make_shared< CentralGravitationalAccelerationModel3d >(
+                    boost::lambda::constant( acceleratedBodyPosition ),
+                    gravitationalParameters.at( i ),
+                    boost::lambda::constant( perturbingBodyPositions.at( i ) ) );
+        ThirdBodyCentralGravityAcceleration thirdBodyModel(
+                    directModel, boost::make_shared< CentralGravitationalAccelerationModel3d >(
+                        boost::lambda::constant( centralBodyPosition ),
+                        gravitationalParameters.at( i ),
+                        boost::lambda::constant( perturbingBodyPositions.at( i ) ) ), "Earth" );
+        thirdBodyModel.updateMembers( 0.0 );
+        thirdBodyAcceleration += thirdBodyModel.getAcceleration( );
+        directAcceleration += directModel->getAcceleration( );
+
+        referenceAcceleration += computeReferenceThirdBodyPerturbation(
+                    gravitationalParameters.at( i ), acceleratedBodyPosition - centralBodyPosition,
+                    perturbingBodyPositions.at( i ) - centralBodyPosition );
+        battinAcceleration += computeThirdBodyPerturbingAccelerationUsingBattinFormulation(
+                    gravitationalParameters.at( i ), acceleratedBodyPosition - centralBodyPosition,
+                    perturbingBodyPositions.at( i ) - centralBodyPosition );
+    }
+
+    // Check combined model against existing models (limited by cancellation in existing models) and reference.
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        BOOST_CHECK_SMALL( multipleThirdBodyAcceleration.getAcceleration( )( i ) - thirdBodyAcceleration( i ),
+                           1.0E-8 * referenceAcceleration.norm( ) );
+        BOOST_CHECK_SMALL( multipleThirdBodyAcceleration.getAcceleration( )( i ) - referenceAcceleration( i ),
+                           1.0E-14 * referenceAcceleration.norm( ) );
+        BOOST_CHECK_SMALL( battinAcceleration( i ) - referenceAcceleration( i ),
+                           1.0E-14 * referenceAcceleration.norm( ) );
+        BOOST_CHECK_SMALL( multipleDirectAcceleration.getAcceleration( )( i ) - directAcceleration( i ),
+                           1.0E-14 * directAcceleration.norm( ) );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -316,6 +316,67 @@ BOOST_AUTO_TEST_CASE( test_SphericalHarmonicsGravitationalAccelerationWrapperCla
     TUDAT_CHECK_MATRIX_CLOSE_FRACTION( expectedAcceleration, acceleration, 1.0e-15 );
 }
 
+// Check adaptive truncation of spherical harmonic expansion, and its hysteresis.
+BOOST_AUTO_TEST_CASE( test_SphericalHarmonicsGravitationalAccelerationAdaptiveTruncation )
+{
+    // Short-cuts.
+    using namespace gravitation;
+
+    const double gravitationalParameter = 3.986004418e14;
+    const double planetaryRadius = 6378137.0;
+
+    // Define (arbitrary) coefficients up to degree and order 20, with magnitude according to Kaula's rule.
+    const int maximumDegree = 20;
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    for( int degree = 2; degree <= maximumDegree; degree++ )
+    {
+        for( int order = 0; order <= degree; order++ )
+        {
+            cosineCoefficients( degree, order ) = 1.0E-5 / ( degree * degree ) * std::cos( degree + 2.0 * order );
+            if( order > 0 )
+            {
+                sineCoefficients( degree, order ) = 1.0E-5 / ( degree * degree ) * std::sin( 3.0 * degree + order );
+            }
+        }
+    }
+
+    // Create acceleration models with and without adaptive truncation.
+    Eigen::Vector3d position = 4.0 * planetaryRadius * Eigen::Vector3d( 0.48, 0.6, 0.64 );
+    SphericalHarmonicsGravitationalAccelerationModelPointer fullGravity
+            = boost::make_shared< SphericalHarmonicsGravitationalAccelerationModel >(
+                boost::lambda::var( position ), gravitationalParameter, planetaryRadius,
+                cosineCoefficients, sineCoefficients );
+    SphericalHarmonicsGravitationalAccelerationModelPointer truncatedGravity
+            = boost::make_shared< SphericalHarmonicsGravitationalAccelerationModel >(
+                boost::lambda::var( position ), gravitationalParameter, planetaryRadius,
+                cosineCoefficients, sineCoefficients );
+    truncatedGravity->setAdaptiveTruncation( 1.0E-6, 10.0 );
+    BOOST_CHECK_EQUAL( fullGravity->getCurrentMaximumDegree( ), maximumDegree );
+
+    // Define sequence of distances (in reference radii), and expected truncation degrees: degree is increased as soon
+    // as required, but only decreased once below tolerance divided by hysteresis factor.
+    const double distances[ 6 ] = { 4.0, 4.3, 2.0, 2.1, 4.0, 0.99 };
+    const int expectedDegrees[ 6 ] = { 9, 9, 19, 19, 11, 20 };
+
+    for( unsigned int i = 0; i < 6; i++ )
+    {
+        position = distances[ i ] * planetaryRadius * Eigen::Vector3d( 0.48, 0.6, 0.64 );
+        fullGravity->updateMembers( static_cast< double >( i ) );
+        truncatedGravity->updateMembers( static_cast< double >( i ) );
+
+        BOOST_CHECK_EQUAL( truncatedGravity->getCurrentMaximumDegree( ), expectedDegrees[ i ] );
+
+        // Check that omitted terms are below tolerance.
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_SMALL( truncatedGravity->getAcceleration( )( j ) - fullGravity->getAcceleration( )( j ),
+                               1.0E-6 * fullGravity->getAcceleration( ).norm( ) );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -0,0 +1,239 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#include <boost/lexical_cast.hpp>
+#include <boost/static_assert.hpp>
+
+#include "Tudat/Astrodynamics/Gravitation/binarySphericalHarmonicsCoefficients.h"
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+BOOST_STATIC_ASSERT( sizeof( BinarySphericalHarmonicsFileHeader ) == 128 );
+
+//! Identifier of binary spherical harmonic coefficient file type.
+static const char binarySphericalHarmonicsFileIdentifier[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'S', 'H', 'C' };
+
+//! Current version of binary spherical harmonic coefficient file format.
+static const boost::uint32_t binarySphericalHarmonicsFormatVersion = 2;
+
+//! Marker used to verify byte order of binary spherical harmonic coefficient file.
+static const boost::uint32_t binarySphericalHarmonicsByteOrderMarker = 0x01020304;
+
+//! Function to write spherical harmonic gravity field coefficients to a binary file.
+void writeSphericalHarmonicsCoefficientsToBinaryFile(
+        const std::string& fileName,
+        const double gravitationalParameter,
+        const double referenceRadius,
+        const Eigen::MatrixXd& cosineCoefficients,
+        const Eigen::MatrixXd& sineCoefficients,
+        const std::string& referenceFrame )
+{
+    // Check input consistency.
+    if( ( cosineCoefficients.rows( ) != sineCoefficients.rows( ) ) ||
+            ( cosineCoefficients.cols( ) != sineCoefficients.cols( ) ) )
+    {
+        throw std::runtime_error( "Error when writing binary spherical harmonic coefficient file " + fileName +
+                                  ", sine and cosine matrix sizes are not equal." );
+    }
+
+    if( cosineCoefficients.rows( ) == 0 || cosineCoefficients.cols( ) == 0 )
+    {
+        throw std::runtime_error( "Error when writing binary spherical harmonic coefficient file " + fileName +
+                                  ", coefficient matrices are empty." );
+    }
+
+    if( cosineCoefficients.cols( ) > cosineCoefficients.rows( ) )
+    {
+        throw std::runtime_error( "Error when writing binary spherical harmonic coefficient file " + fileName +
+                                  ", maximum order exceeds maximum degree." );
+    }
+
+    for( int order = 1; order < cosineCoefficients.cols( ); order++ )
+    {
+        if( ( cosineCoefficients.col( order ).head( order ).array( ) != 0.0 ).any( ) ||
+                ( sineCoefficients.col( order ).head( order ).array( ) != 0.0 ).any( ) )
+        {
+            throw std::runtime_error( "Error when writing binary spherical harmonic coefficient file " + fileName +
+                                      ", non-zero coefficient found with order exceeding degree." );
+        }
+    }
+
+    BinarySphericalHarmonicsFileHeader fileHeader;
+    if( referenceFrame.size( ) >= sizeof( fileHeader.referenceFrame ) )
+    {
+        throw std::runtime_error( "Error when writing binary spherical harmonic coefficient file " + fileName +
+                                  ", reference frame name " + referenceFrame + " is too long." );
+    }
+
+    // Set file header.
+    std::memset( &fileHeader, 0, sizeof( fileHeader ) );
+    std::memcpy( fileHeader.fileIdentifier, binarySphericalHarmonicsFileIdentifier,
+                 sizeof( fileHeader.fileIdentifier ) );
+    fileHeader.formatVersion = binarySphericalHarmonicsFormatVersion;
+    fileHeader.byteOrderMarker = binarySphericalHarmonicsByteOrderMarker;
+    fileHeader.maximumDegree = cosineCoefficients.rows( ) - 1;
+    fileHeader.maximumOrder = cosineCoefficients.cols( ) - 1;
+    fileHeader.gravitationalParameter = gravitationalParameter;
+    fileHeader.referenceRadius = referenceRadius;
+    std::memcpy( fileHeader.referenceFrame, referenceFrame.c_str( ), referenceFrame.size( ) );
+
+    // Write header and packed coefficients (degree >= order, column-major) to file.
+    std::ofstream fileStream( fileName.c_str( ), std::ios::out | std::ios::binary | std::ios::trunc );
+    if( fileStream.fail( ) )
+    {
+        throw std::runtime_error( "Error, binary spherical harmonic coefficient file " + fileName +
+                                  " could not be opened for writing." );
+    }
+
+    fileStream.write( reinterpret_cast< const char* >( &fileHeader ), sizeof( fileHeader ) );
+    for( int order = 0; order < cosineCoefficients.cols( ); order++ )
+    {
+        fileStream.write( reinterpret_cast< const char* >( cosineCoefficients.col( order ).data( ) + order ),
+                          static_cast< std::streamsize >( ( cosineCoefficients.rows( ) - order ) * sizeof( double ) ) );
+    }
+    for( int order = 0; order < sineCoefficients.cols( ); order++ )
+    {
+        fileStream.write( reinterpret_cast< const char* >( sineCoefficients.col( order ).data( ) + order ),
+                          static_cast< std::streamsize >( ( sineCoefficients.rows( ) - order ) * sizeof( double ) ) );
+    }
+    fileStream.close( );
+
+    if( fileStream.fail( ) )
+    {
+        throw std::runtime_error( "Error when writing binary spherical harmonic coefficient file " + fileName );
+    }
+}
+
+//! Constructor, maps binary coefficient file into memory.
+MappedSphericalHarmonicsCoefficients::MappedSphericalHarmonicsCoefficients( const std::string& fileName )
+{
+    // Map complete file into memory (read-only).
+    try
+    {
+        boost::interprocess::file_mapping( fileName.c_str( ), boost::interprocess::read_only ).swap( fileMapping_ );
+        boost::interprocess::mapped_region( fileMapping_, boost::interprocess::read_only ).swap( mappedRegion_ );
+    }
+    catch( boost::interprocess::interprocess_exception& mappingException )
+    {
+        throw std::runtime_error( "Error, binary spherical harmonic coefficient file " + fileName +
+                                  " could not be mapped into memory: " + mappingException.what( ) );
+    }
+
+    // Check file header.
+    if( mappedRegion_.get_size( ) < sizeof( BinarySphericalHarmonicsFileHeader ) )
+    {
+        throw std::runtime_error( "Error, file " + fileName + " is too small to be a binary spherical harmonic "
+                                                             "coefficient file." );
+    }
+
+    const BinarySphericalHarmonicsFileHeader* fileHeader =
+            static_cast< const BinarySphericalHarmonicsFileHeader* >( mappedRegion_.get_address( ) );
+    if( std::memcmp( fileHeader->fileIdentifier, binarySphericalHarmonicsFileIdentifier,
+                     sizeof( fileHeader->fileIdentifier ) ) != 0 )
+    {
+        throw std::runtime_error( "Error, file " + fileName + " is not a binary spherical harmonic coefficient file." );
+    }
+    else if( fileHeader->byteOrderMarker != binarySphericalHarmonicsByteOrderMarker )
+    {
+        throw std::runtime_error( "Error, binary spherical harmonic coefficient file " + fileName +
+                                  " was written with different byte order." );
+    }
+    else if( fileHeader->formatVersion != binarySphericalHarmonicsFormatVersion )
+    {
+        throw std::runtime_error( "Error, binary spherical harmonic coefficient file " + fileName +
+                                  " has unsupported format version " +
+                                  boost::lexical_cast< std::string >( fileHeader->formatVersion ) );
+    }
+    else if( fileHeader->maximumDegree < 0 || fileHeader->maximumOrder < 0 ||
+             fileHeader->maximumOrder > fileHeader->maximumDegree )
+    {
+        throw std::runtime_error( "Error, binary spherical harmonic coefficient file " + fileName +
+                                  " has invalid maximum degree or order." );
+    }
+
+    // Check file size against packed coefficient block size.
+    const boost::uint64_t numberOfCoefficients = static_cast< boost::uint64_t >(
+                getNumberOfPackedSphericalHarmonicsCoefficients(
+                    fileHeader->maximumDegree, fileHeader->maximumOrder ) );
+    if( mappedRegion_.get_size( ) != sizeof( BinarySphericalHarmonicsFileHeader ) +
+            2 * numberOfCoefficients * sizeof( double ) )
+    {
+        throw std::runtime_error( "Error, size of binary spherical harmonic coefficient file " + fileName +
+                                  " is inconsistent with its maximum degree and order." );
+    }
+
+    // Set properties of gravity field and pointers to coefficient blocks.
+    numberOfDegrees_ = static_cast< int >( fileHeader->maximumDegree + 1 );
+    numberOfOrders_ = static_cast< int >( fileHeader->maximumOrder + 1 );
+    gravitationalParameter_ = fileHeader->gravitationalParameter;
+    referenceRadius_ = fileHeader->referenceRadius;
+    referenceFrame_ = std::string( fileHeader->referenceFrame,
+                                   std::find( fileHeader->referenceFrame, fileHeader->referenceFrame +
+                                              sizeof( fileHeader->referenceFrame ), '\0' ) );
+
+    cosineCoefficientsData_ = reinterpret_cast< const double* >( fileHeader + 1 );
+    sineCoefficientsData_ = cosineCoefficientsData_ + numberOfCoefficients;
+}
+
+//! Function to expand a block of packed coefficients into a dense matrix.
+Eigen::MatrixXd MappedSphericalHarmonicsCoefficients::expandPackedCoefficients(
+        const double* packedCoefficients, const int maximumDegree, const int maximumOrder ) const
+{
+    if( maximumDegree < 0 || maximumOrder < 0 || maximumDegree >= numberOfDegrees_ ||
+            maximumOrder >= numberOfOrders_ )
+    {
+        throw std::runtime_error( "Error, requested spherical harmonic coefficients up to degree " +
+                                  boost::lexical_cast< std::string >( maximumDegree ) + " and order " +
+                                  boost::lexical_cast< std::string >( maximumOrder ) +
+                                  " are not available in mapped file." );
+    }
+
+    // Copy the coefficients of each order, which are contiguous in the packed block.
+    Eigen::MatrixXd coefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumOrder + 1 );
+    for( int order = 0; order <= std::min( maximumOrder, maximumDegree ); order++ )
+    {
+        coefficients.col( order ).tail( maximumDegree + 1 - order ) =
+                Eigen::Map< const Eigen::VectorXd >(
+                    packedCoefficients + getPackedSphericalHarmonicsCoefficientIndex(
+                        order, order, numberOfDegrees_ - 1 ), maximumDegree + 1 - order );
+    }
+    return coefficients;
+}
+
+//! Function to retrieve a single coefficient from a block of packed coefficients.
+double MappedSphericalHarmonicsCoefficients::getPackedCoefficient(
+        const double* packedCoefficients, const int degree, const int order ) const
+{
+    if( degree < 0 || order < 0 || degree >= numberOfDegrees_ || order >= numberOfOrders_ )
+    {
+        throw std::runtime_error( "Error, requested spherical harmonic coefficient of degree " +
+                                  boost::lexical_cast< std::string >( degree ) + " and order " +
+                                  boost::lexical_cast< std::string >( order ) +
+                                  " is not available in mapped file." );
+    }
+    else if( order > degree )
+    {
+        return 0.0;
+    }
+    return packedCoefficients[ getPackedSphericalHarmonicsCoefficientIndex( degree, order, numberOfDegrees_ - 1 ) ];
+}
+
+} // namespace gravitation
+
+} // namespace tudat
@@ -0,0 +1,321 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_BINARY_SPHERICAL_HARMONICS_COEFFICIENTS_H
+#define TUDAT_BINARY_SPHERICAL_HARMONICS_COEFFICIENTS_H
+
+#include <string>
+
+#include <boost/cstdint.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+//! Header of binary spherical harmonic coefficient file.
+/*!
+ *  Header of binary spherical harmonic coefficient file, as written by writeSphericalHarmonicsCoefficientsToBinaryFile.
+ *  The header (of fixed size of 128 bytes) is followed directly by the cosine and the sine coefficients
+ *  (geodesy-normalized) as doubles, each block storing only the coefficients for which the degree is at least equal to
+ *  the order: first those of order 0 (degree 0 to maximumDegree), then those of order 1 (degree 1 to maximumDegree),
+ *  up to order maximumOrder. This is the lower triangle (or trapezoid, if maximumOrder < maximumDegree) of the
+ *  coefficient matrix in column-major order, so that the coefficients of each order are contiguous (see
+ *  getPackedSphericalHarmonicsCoefficientIndex), which roughly halves the file size w.r.t. storing the full matrix.
+ */
+struct BinarySphericalHarmonicsFileHeader
+{
+    //! Identifier of file type (equal to TUDATSHC, without terminating null character).
+    char fileIdentifier[ 8 ];
+
+    //! Version of binary file format.
+    boost::uint32_t formatVersion;
+
+    //! Marker to verify that file was written with same byte order as that of the machine on which it is read.
+    boost::uint32_t byteOrderMarker;
+
+    //! Maximum degree of coefficients in file.
+    boost::int64_t maximumDegree;
+
+    //! Maximum order of coefficients in file.
+    boost::int64_t maximumOrder;
+
+    //! Gravitational parameter of gravity field.
+    double gravitationalParameter;
+
+    //! Reference radius of spherical harmonic field expansion.
+    double referenceRadius;
+
+    //! Identifier for body-fixed reference frame to which the coefficients are referred (null-terminated).
+    char referenceFrame[ 80 ];
+};
+
+//! Function to compute the number of coefficients in a packed block of spherical harmonic coefficients.
+/*!
+ *  Function to compute the number of coefficients in a packed block of spherical harmonic coefficients, i.e. the
+ *  number of coefficients for which the degree is at least equal to the order (see
+ *  BinarySphericalHarmonicsFileHeader).
+ *  \param maximumDegree Maximum degree of the coefficients.
+ *  \param maximumOrder Maximum order of the coefficients (at most equal to maximumDegree).
+ *  \return Number of coefficients in packed block.
+ */
+inline boost::int64_t getNumberOfPackedSphericalHarmonicsCoefficients(
+        const boost::int64_t maximumDegree, const boost::int64_t maximumOrder )
+{
+    return ( maximumOrder + 1 ) * ( maximumDegree + 1 ) - maximumOrder * ( maximumOrder + 1 ) / 2;
+}
+
+//! Function to compute the index of a coefficient in a packed block of spherical harmonic coefficients.
+/*!
+ *  Function to compute the index of a coefficient in a packed block of spherical harmonic coefficients (see
+ *  BinarySphericalHarmonicsFileHeader).
+ *  \param degree Degree of the coefficient.
+ *  \param order Order of the coefficient (at most equal to degree).
+ *  \param maximumDegree Maximum degree of the coefficients in the packed block.
+ *  \return Index of the coefficient in the packed block.
+ */
+inline boost::int64_t getPackedSphericalHarmonicsCoefficientIndex(
+        const boost::int64_t degree, const boost::int64_t order, const boost::int64_t maximumDegree )
+{
+    return order * ( maximumDegree + 1 ) - order * ( order - 1 ) / 2 + ( degree - order );
+}
+
+//! Function to write spherical harmonic gravity field coefficients to a binary file.
+/*!
+ *  Function to write spherical harmonic gravity field coefficients to a binary file, in the format defined by
+ *  BinarySphericalHarmonicsFileHeader, which can subsequently be loaded (without parsing or copying) using the
+ *  MappedSphericalHarmonicsCoefficients class. Only the coefficients for which the degree is at least equal to the
+ *  order are written, an exception is thrown if any of the other coefficients is non-zero.
+ *  \param fileName Name of binary file that is to be written.
+ *  \param gravitationalParameter Gravitational parameter of gravity field.
+ *  \param referenceRadius Reference radius of spherical harmonic field expansion.
+ *  \param cosineCoefficients Cosine spherical harmonic coefficients (geodesy normalized).
+ *  \param sineCoefficients Sine spherical harmonic coefficients (geodesy normalized).
+ *  \param referenceFrame Identifier for body-fixed reference frame to which the coefficients are referred (optional;
+ *  at most 79 characters).
+ */
+void writeSphericalHarmonicsCoefficientsToBinaryFile(
+        const std::string& fileName,
+        const double gravitationalParameter,
+        const double referenceRadius,
+        const Eigen::MatrixXd& cosineCoefficients,
+        const Eigen::MatrixXd& sineCoefficients,
+        const std::string& referenceFrame = "" );
+
+//! Class providing access to the spherical harmonic coefficients in a memory-mapped binary file.
+/*!
+ *  Class providing access to the spherical harmonic coefficients in a binary file (as written by
+ *  writeSphericalHarmonicsCoefficientsToBinaryFile), which is mapped read-only into memory upon construction. The
+ *  coefficients are read directly from the packed (triangular) storage in the mapped file, so that no parsing takes
+ *  place, and the memory pages containing the coefficients are shared between all processes on a machine that map the
+ *  same file. Only the (blocks of) coefficient matrices that are explicitly requested are expanded into dense matrices.
+ *  The file remains mapped for as long as the object exists.
+ */
+class MappedSphericalHarmonicsCoefficients
+{
+public:
+
+    //! Constructor, maps binary coefficient file into memory.
+    /*!
+     *  Constructor, maps binary coefficient file into memory, and checks its consistency.
+     *  \param fileName Name of binary coefficient file.
+     */
+    MappedSphericalHarmonicsCoefficients( const std::string& fileName );
+
+    //! Function to retrieve the full matrix of cosine spherical harmonic coefficients (geodesy normalized).
+    /*!
+     *  Function to retrieve the full matrix of cosine spherical harmonic coefficients (geodesy normalized), expanded
+     *  from the packed storage in the mapped file.
+     *  \return Cosine spherical harmonic coefficients (geodesy normalized).
+     */
+    Eigen::MatrixXd getCosineCoefficients( ) const
+    {
+        return getCosineCoefficients( numberOfDegrees_ - 1, numberOfOrders_ - 1 );
+    }
+
+    //! Function to retrieve the full matrix of sine spherical harmonic coefficients (geodesy normalized).
+    /*!
+     *  Function to retrieve the full matrix of sine spherical harmonic coefficients (geodesy normalized), expanded
+     *  from the packed storage in the mapped file.
+     *  \return Sine spherical harmonic coefficients (geodesy normalized).
+     */
+    Eigen::MatrixXd getSineCoefficients( ) const
+    {
+        return getSineCoefficients( numberOfDegrees_ - 1, numberOfOrders_ - 1 );
+    }
+
+    //! Function to retrieve a block of cosine spherical harmonic coefficients (geodesy normalized).
+    /*!
+     *  Function to retrieve a block of cosine spherical harmonic coefficients (geodesy normalized) up to a given degree
+     *  and order, expanded from the packed storage in the mapped file.
+     *  \param maximumDegree Maximum degree of coefficient block.
+     *  \param maximumOrder Maximum order of coefficient block.
+     *  \return Cosine spherical harmonic coefficients (geodesy normalized) up to given degree and order.
+     */
+    Eigen::MatrixXd getCosineCoefficients( const int maximumDegree, const int maximumOrder ) const
+    {
+        return expandPackedCoefficients( cosineCoefficientsData_, maximumDegree, maximumOrder );
+    }
+
+    //! Function to retrieve a block of sine spherical harmonic coefficients (geodesy normalized).
+    /*!
+     *  Function to retrieve a block of sine spherical harmonic coefficients (geodesy normalized) up to a given degree
+     *  and order, expanded from the packed storage in the mapped file.
+     *  \param maximumDegree Maximum degree of coefficient block.
+     *  \param maximumOrder Maximum order of coefficient block.
+     *  \return Sine spherical harmonic coefficients (geodesy normalized) up to given degree and order.
+     */
+    Eigen::MatrixXd getSineCoefficients( const int maximumDegree, const int maximumOrder ) const
+    {
+        return expandPackedCoefficients( sineCoefficientsData_, maximumDegree, maximumOrder );
+    }
+
+    //! Function to retrieve a single cosine spherical harmonic coefficient (geodesy normalized).
+    /*!
+     *  Function to retrieve a single cosine spherical harmonic coefficient (geodesy normalized) directly from the
+     *  mapped file.
+     *  \param degree Degree of coefficient.
+     *  \param order Order of coefficient.
+     *  \return Cosine spherical harmonic coefficient (zero if order exceeds degree).
+     */
+    double getCosineCoefficient( const int degree, const int order ) const
+    {
+        return getPackedCoefficient( cosineCoefficientsData_, degree, order );
+    }
+
+    //! Function to retrieve a single sine spherical harmonic coefficient (geodesy normalized).
+    /*!
+     *  Function to retrieve a single sine spherical harmonic coefficient (geodesy normalized) directly from the mapped
+     *  file.
+     *  \param degree Degree of coefficient.
+     *  \param order Order of coefficient.
+     *  \return Sine spherical harmonic coefficient (zero if order exceeds degree).
+     */
+    double getSineCoefficient( const int degree, const int order ) const
+    {
+        return getPackedCoefficient( sineCoefficientsData_, degree, order );
+    }
+
+    //! Function to retrieve the gravitational parameter of the gravity field.
+    /*!
+     *  Function to retrieve the gravitational parameter of the gravity field.
+     *  \return Gravitational parameter of the gravity field.
+     */
+    double getGravitationalParameter( ) const
+    {
+        return gravitationalParameter_;
+    }
+
+    //! Function to retrieve the reference radius of the spherical harmonic field expansion.
+    /*!
+     *  Function to retrieve the reference radius of the spherical harmonic field expansion.
+     *  \return Reference radius of the spherical harmonic field expansion.
+     */
+    double getReferenceRadius( ) const
+    {
+        return referenceRadius_;
+    }
+
+    //! Function to retrieve the identifier for body-fixed reference frame to which the coefficients are referred.
+    /*!
+     *  Function to retrieve the identifier for body-fixed reference frame to which the coefficients are referred.
+     *  \return Identifier for body-fixed reference frame to which the coefficients are referred.
+     */
+    std::string getReferenceFrame( ) const
+    {
+        return referenceFrame_;
+    }
+
+    //! Function to retrieve the maximum degree of the coefficients in the file.
+    /*!
+     *  Function to retrieve the maximum degree of the coefficients in the file.
+     *  \return Maximum degree of the coefficients in the file.
+     */
+    int getMaximumDegree( ) const
+    {
+        return numberOfDegrees_ - 1;
+    }
+
+    //! Function to retrieve the maximum order of the coefficients in the file.
+    /*!
+     *  Function to retrieve the maximum order of the coefficients in the file.
+     *  \return Maximum order of the coefficients in the file.
+     */
+    int getMaximumOrder( ) const
+    {
+        return numberOfOrders_ - 1;
+    }
+
+private:
+
+    //! Function to expand a block of packed coefficients into a dense matrix.
+    /*!
+     *  Function to expand a block of packed coefficients into a dense matrix, with all coefficients for which the order
+     *  exceeds the degree equal to zero.
+     *  \param packedCoefficients Pointer to the first coefficient of the packed block in the mapped region.
+     *  \param maximumDegree Maximum degree of coefficient block.
+     *  \param maximumOrder Maximum order of coefficient block.
+     *  \return Coefficients up to given degree and order.
+     */
+    Eigen::MatrixXd expandPackedCoefficients( const double* packedCoefficients,
+                                              const int maximumDegree, const int maximumOrder ) const;
+
+    //! Function to retrieve a single coefficient from a block of packed coefficients.
+    /*!
+     *  Function to retrieve a single coefficient from a block of packed coefficients.
+     *  \param packedCoefficients Pointer to the first coefficient of the packed block in the mapped region.
+     *  \param degree Degree of coefficient.
+     *  \param order Order of coefficient.
+     *  \return Coefficient (zero if order exceeds degree).
+     */
+    double getPackedCoefficient( const double* packedCoefficients, const int degree, const int order ) const;
+
+    //! Object representing the binary coefficient file.
+    boost::interprocess::file_mapping fileMapping_;
+
+    //! Region of memory into which the complete binary coefficient file is mapped.
+    boost::interprocess::mapped_region mappedRegion_;
+
+    //! Pointer to the first cosine coefficient in the mapped region.
+    const double* cosineCoefficientsData_;
+
+    //! Pointer to the first sine coefficient in the mapped region.
+    const double* sineCoefficientsData_;
+
+    //! Number of degrees (rows) of the full coefficient matrices.
+    int numberOfDegrees_;
+
+    //! Number of orders (columns) of the full coefficient matrices.
+    int numberOfOrders_;
+
+    //! Gravitational parameter of the gravity field.
+    double gravitationalParameter_;
+
+    //! Reference radius of the spherical harmonic field expansion.
+    double referenceRadius_;
+
+    //! Identifier for body-fixed reference frame to which the coefficients are referred.
+    std::string referenceFrame_;
+};
+
+//! Typedef for shared-pointer to MappedSphericalHarmonicsCoefficients object.
+typedef boost::shared_ptr< MappedSphericalHarmonicsCoefficients > MappedSphericalHarmonicsCoefficientsPointer;
+
+} // namespace gravitation
+
+} // namespace tudat
+
+#endif // TUDAT_BINARY_SPHERICAL_HARMONICS_COEFFICIENTS_H
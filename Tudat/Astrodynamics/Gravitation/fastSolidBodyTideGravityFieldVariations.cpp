@@ -0,0 +1,223 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <cmath>
+#include <algorithm>
+
+#include <boost/lexical_cast.hpp>
+
+#include "Tudat/Astrodynamics/Gravitation/fastSolidBodyTideGravityFieldVariations.h"
+#include "Tudat/Mathematics/BasicMathematics/legendrePolynomials.h"
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+//! Function to calculate the Love number-independent part of degree 2 and 3 solid body tides due to a single body.
+void calculateDegreeTwoAndThreeTideTerms(
+        const Eigen::Vector3d& relativeBodyFixedPosition, const double referenceRadius,
+        const Eigen::MatrixXd& normalizationFactors, Eigen::MatrixXcd& tideTerms )
+{
+    // Compute sine of latitude, and cos(latitude) * exp( -i * longitude ).
+    const double distance = relativeBodyFixedPosition.norm( );
+    const double sineOfLatitude = relativeBodyFixedPosition.z( ) / distance;
+    const std::complex< double > reducedLongitudeTerm(
+                relativeBodyFixedPosition.x( ) / distance, -relativeBodyFixedPosition.y( ) / distance );
+    const std::complex< double > reducedLongitudeTermSquared = reducedLongitudeTerm * reducedLongitudeTerm;
+
+    // Compute (R/r)^(n+1) for degree 2.
+    const double radiusRatio = referenceRadius / distance;
+    double radiusRatioPower = radiusRatio * radiusRatio * radiusRatio;
+
+    // Compute degree 2 terms; Legendre polynomials are divided by cos^m(latitude).
+    const double sineOfLatitudeSquared = sineOfLatitude * sineOfLatitude;
+    tideTerms( 0, 0 ) = radiusRatioPower * normalizationFactors( 0, 0 ) * 0.5 * ( 3.0 * sineOfLatitudeSquared - 1.0 );
+    tideTerms( 0, 1 ) = radiusRatioPower * normalizationFactors( 0, 1 ) * 3.0 * sineOfLatitude * reducedLongitudeTerm;
+    tideTerms( 0, 2 ) = radiusRatioPower * normalizationFactors( 0, 2 ) * 3.0 * reducedLongitudeTermSquared;
+
+    // Compute degree 3 terms, if required.
+    if( tideTerms.rows( ) > 1 )
+    {
+        radiusRatioPower *= radiusRatio;
+        tideTerms( 1, 0 ) = radiusRatioPower * normalizationFactors( 1, 0 ) *
+                0.5 * sineOfLatitude * ( 5.0 * sineOfLatitudeSquared - 3.0 );
+        tideTerms( 1, 1 ) = radiusRatioPower * normalizationFactors( 1, 1 ) *
+                1.5 * ( 5.0 * sineOfLatitudeSquared - 1.0 ) * reducedLongitudeTerm;
+        tideTerms( 1, 2 ) = radiusRatioPower * normalizationFactors( 1, 2 ) *
+                15.0 * sineOfLatitude * reducedLongitudeTermSquared;
+        tideTerms( 1, 3 ) = radiusRatioPower * normalizationFactors( 1, 3 ) *
+                15.0 * reducedLongitudeTermSquared * reducedLongitudeTerm;
+    }
+}
+
+//! Constructor
+FastSolidBodyTideGravityFieldVariations::FastSolidBodyTideGravityFieldVariations(
+        const boost::function< basic_mathematics::Vector6d( const double ) > deformedBodyStateFunction,
+        const boost::function< Eigen::Quaterniond( const double ) > deformedBodyOrientationFunction,
+        const std::vector< boost::function< basic_mathematics::Vector6d( const double ) > >
+        deformingBodyStateFunctions,
+        const double deformedBodyReferenceRadius,
+        const boost::function< double( ) > deformedBodyMass,
+        const std::vector< boost::function< double( ) > > deformingBodyMasses,
+        const std::vector< std::vector< std::complex< double > > > loveNumbers,
+        const std::vector< std::string > deformingBodies,
+        const double tideUpdateInterval ):
+    BasicSolidBodyTideGravityFieldVariations(
+        deformedBodyStateFunction, deformedBodyOrientationFunction, deformingBodyStateFunctions,
+        deformedBodyReferenceRadius, deformedBodyMass, deformingBodyMasses, loveNumbers, deformingBodies ),
+    tideUpdateInterval_( tideUpdateInterval ), firstNodeIndex_( 0 ), isNodeWindowSet_( false )
+{
+    // Check input consistency.
+    if( loveNumbers.size( ) < 1 || loveNumbers.size( ) > 2 )
+    {
+        throw std::runtime_error(
+                    "Error when creating fast solid body tide variations, maximum degree must be 2 or 3, found " +
+                    boost::lexical_cast< std::string >( loveNumbers.size( ) + 1 ) );
+    }
+
+    if( !( tideUpdateInterval_ >= 0.0 ) )
+    {
+        throw std::runtime_error(
+                    "Error when creating fast solid body tide variations, tide update interval must be positive." );
+    }
+
+    // Precompute normalization factors.
+    normalizationFactors_ = Eigen::MatrixXd::Zero( numberOfDegrees_, numberOfOrders_ );
+    for( int n = 2; n <= maximumDegree_; n++ )
+    {
+        for( int m = 0; m <= n; m++ )
+        {
+            normalizationFactors_( n - 2, m ) = basic_mathematics::calculateLegendreGeodesyNormalizationFactor( n, m ) /
+                    ( 2.0 * static_cast< double >( n ) + 1.0 );
+        }
+    }
+
+    // Allocate tide terms.
+    currentTideTerms_.resize( deformingBodyStateFunctions_.size( ),
+                              Eigen::MatrixXcd::Zero( numberOfDegrees_, numberOfOrders_ ) );
+    if( tideUpdateInterval_ > 0.0 )
+    {
+        nodeTideTerms_.resize( 4, currentTideTerms_ );
+    }
+}
+
+//! Function to calculate the geometric part of the tide of all bodies causing deformation.
+void FastSolidBodyTideGravityFieldVariations::calculateTideTerms(
+        const double time, std::vector< Eigen::MatrixXcd >& tideTerms )
+{
+    // Retrieve state and orientation of deformed body once.
+    deformedBodyPosition = deformedBodyStateFunction_( time ).segment( 0, 3 );
+    toDeformedBodyFrameRotation = deformedBodyOrientationFunction_( time );
+
+    // Compute terms of all bodies causing deformation.
+    for( unsigned int i = 0; i < deformingBodyStateFunctions_.size( ); i++ )
+    {
+        relativeBodyFixedPosition_ = toDeformedBodyFrameRotation * (
+                    deformingBodyStateFunctions_[ i ]( time ).segment( 0, 3 ) - deformedBodyPosition );
+        calculateDegreeTwoAndThreeTideTerms(
+                    relativeBodyFixedPosition_, deformedBodyReferenceRadius_, normalizationFactors_, tideTerms[ i ] );
+    }
+}
+
+//! Function to update the geometric part of the tide at the current time.
+void FastSolidBodyTideGravityFieldVariations::updateCurrentTideTerms( const double time )
+{
+    if( !( tideUpdateInterval_ > 0.0 ) )
+    {
+        calculateTideTerms( time, currentTideTerms_ );
+    }
+    else
+    {
+        // Determine interval in which current time lies, nodes -1, 0, 1, 2 w.r.t. this interval are used.
+        const long intervalIndex = static_cast< long >( std::floor( time / tideUpdateInterval_ ) );
+        const long requiredFirstNodeIndex = intervalIndex - 1;
+
+        // Shift node window by one interval if possible, recompute all nodes otherwise.
+        int numberOfNewNodes = 4;
+        if( isNodeWindowSet_ )
+        {
+            if( requiredFirstNodeIndex == firstNodeIndex_ )
+            {
+                numberOfNewNodes = 0;
+            }
+            else if( requiredFirstNodeIndex == firstNodeIndex_ + 1 )
+            {
+                std::rotate( nodeTideTerms_.begin( ), nodeTideTerms_.begin( ) + 1, nodeTideTerms_.end( ) );
+                numberOfNewNodes = 1;
+            }
+            else if( requiredFirstNodeIndex == firstNodeIndex_ - 1 )
+            {
+                std::rotate( nodeTideTerms_.begin( ), nodeTideTerms_.begin( ) + 3, nodeTideTerms_.end( ) );
+                calculateTideTerms( static_cast< double >( requiredFirstNodeIndex ) * tideUpdateInterval_,
+                                    nodeTideTerms_[ 0 ] );
+                numberOfNewNodes = 0;
+            }
+        }
+
+        for( int i = 4 - numberOfNewNodes; i < 4; i++ )
+        {
+            calculateTideTerms( static_cast< double >( requiredFirstNodeIndex + i ) * tideUpdateInterval_,
+                                nodeTideTerms_[ i ] );
+        }
+        firstNodeIndex_ = requiredFirstNodeIndex;
+        isNodeWindowSet_ = true;
+
+        // Compute cubic Lagrange interpolation weights for nodes at -1, 0, 1, 2 (in units of interval).
+        const double s = time / tideUpdateInterval_ - static_cast< double >( intervalIndex );
+        const double weights[ 4 ] = { -s * ( s - 1.0 ) * ( s - 2.0 ) / 6.0,
+                                      ( s + 1.0 ) * ( s - 1.0 ) * ( s - 2.0 ) / 2.0,
+                                      -( s + 1.0 ) * s * ( s - 2.0 ) / 2.0,
+                                      ( s + 1.0 ) * s * ( s - 1.0 ) / 6.0 };
+
+        for( unsigned int i = 0; i < currentTideTerms_.size( ); i++ )
+        {
+            currentTideTerms_[ i ] = weights[ 0 ] * nodeTideTerms_[ 0 ][ i ] + weights[ 1 ] * nodeTideTerms_[ 1 ][ i ] +
+                    weights[ 2 ] * nodeTideTerms_[ 2 ][ i ] + weights[ 3 ] * nodeTideTerms_[ 3 ][ i ];
+        }
+    }
+}
+
+//! Derived function for calculating spherical harmonic coefficient corrections.
+std::pair< Eigen::MatrixXd, Eigen::MatrixXd > FastSolidBodyTideGravityFieldVariations::
+calculateSphericalHarmonicsCorrections( const double time )
+{
+    updateCurrentTideTerms( time );
+
+    currentCosineCorrections_.setZero( );
+    currentSineCorrections_.setZero( );
+
+    // Add contributions of all bodies, weighted by current mass ratios and Love numbers.
+    const double deformedBodyMass = deformedBodyMass_( );
+    std::complex< double > stokesCoefficientCorrection;
+    for( unsigned int i = 0; i < currentTideTerms_.size( ); i++ )
+    {
+        massRatio = deformingBodyMasses_[ i ]( ) / deformedBodyMass;
+        for( unsigned int n = 2; n < loveNumbers_.size( ) + 2; n++ )
+        {
+            for( unsigned int m = 0; ( m <= n && m < loveNumbers_[ n - 2 ].size( ) ); m++ )
+            {
+                stokesCoefficientCorrection = massRatio * loveNumbers_[ n - 2 ][ m ] * currentTideTerms_[ i ]( n - 2, m );
+                currentCosineCorrections_( n - 2, m ) += stokesCoefficientCorrection.real( );
+                if( m != 0 )
+                {
+                    currentSineCorrections_( n - 2, m ) -= stokesCoefficientCorrection.imag( );
+                }
+            }
+        }
+    }
+
+    return std::make_pair( currentCosineCorrections_, currentSineCorrections_ );
+}
+
+} // namespace gravitation
+
+} // namespace tudat
@@ -0,0 +1,177 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_FASTSOLIDBODYTIDEGRAVITYFIELDVARIATIONS_H
+#define TUDAT_FASTSOLIDBODYTIDEGRAVITYFIELDVARIATIONS_H
+
+#include <vector>
+#include <complex>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Gravitation/basicSolidBodyTideGravityFieldVariations.h"
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+//! Function to calculate the Love number-independent part of degree 2 and 3 solid body tides due to a single body.
+/*!
+ *  Function to calculate the Love number-independent part of degree 2 and 3 solid body tides due to a single body, i.e.
+ *  the terms T_{n,m} such that Delta C_{n,m} - i * Delta S_{n,m} = k_{n,m} * T_{n,m}, with k_{n,m} the Love number
+ *  (Petit et al. 2010, eq. 6.6). The terms are computed in one pass directly from the Cartesian position of the body
+ *  causing the deformation, using closed-form expressions for the associated Legendre polynomials and
+ *  cos^m(latitude) exp(-i m longitude) = ( ( x - i y ) / r )^m, so that no spherical coordinate conversion,
+ *  complex exponentials or factorials need to be evaluated.
+ *  \param relativeBodyFixedPosition Cartesian position of body causing deformation in a frame centered on and fixed to
+ *  the body that is being deformed.
+ *  \param referenceRadius Reference radius of body being deformed.
+ *  \param normalizationFactors Geodesy normalization factors divided by (2n+1), for each degree (row; index 0 is
+ *  degree 2) and order (column).
+ *  \param tideTerms Love number-independent tide terms (returned by reference, may be of size 1x3 or 2x4, for a
+ *  maximum degree of 2 or 3, respectively).
+ */
+void calculateDegreeTwoAndThreeTideTerms(
+        const Eigen::Vector3d& relativeBodyFixedPosition, const double referenceRadius,
+        const Eigen::MatrixXd& normalizationFactors, Eigen::MatrixXcd& tideTerms );
+
+//! Class to efficiently calculate first-order degree 2 and 3 solid body tide gravity field variations.
+/*!
+ *  Class to efficiently calculate first-order degree 2 and 3 solid body tide gravity field variations, raised by any
+ *  number of bodies. The results are identical to those of the BasicSolidBodyTideGravityFieldVariations base class,
+ *  but all degree 2 and 3 terms of each body are computed in a single pass by calculateDegreeTwoAndThreeTideTerms. When
+ *  the state functions of the deformed and deforming bodies are linked to the current states in the environment (i.e.
+ *  Body::getState), the states that have already been set by the EnvironmentUpdater are reused directly.
+ *  Optionally, the geometric (Love number- and mass-independent) part of the tide may be evaluated at a coarser, fixed,
+ *  cadence, with cubic Lagrange interpolation between the four surrounding nodes. In this case, the state and
+ *  orientation functions must be true functions of time (e.g. from the ephemerides), as they are evaluated at the
+ *  nodes, not at the current time.
+ */
+class FastSolidBodyTideGravityFieldVariations: public BasicSolidBodyTideGravityFieldVariations
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Contructor, sets Love numbers and properties of deformed and tide-raising bodies.
+     *  \param deformedBodyStateFunction Function returning state of body being deformed.
+     *  \param deformedBodyOrientationFunction Function providing rotation from inertial to body
+     *  being deformed-fixed frame
+     *  \param deformingBodyStateFunctions List of state functions of body causing deformations.
+     *  \param deformedBodyReferenceRadius Reference radius (typically equatorial) of body being
+     *  deformed's spherical harmonic gravity field.
+     *  \param deformedBodyMass Function returning mass (or gravitational parameter) of body being
+     *  deformed.
+     *  \param deformingBodyMasses List of functions returning masses (or gravitational parameters)
+     *  of bodies causing deformation.
+     *  \param loveNumbers List of love numbers for each degree and order. First vector level
+     *  denotes degree (index 0 = degree 2), second vector level denotes order. Maximum degree must be 2 or 3.
+     *  \param deformingBodies List of names of bodies causing deformation
+     *  \param tideUpdateInterval Interval between subsequent evaluations of the geometric part of the tide, between
+     *  which the tide is interpolated. If zero (default), the tide is evaluated directly at each call.
+     */
+    FastSolidBodyTideGravityFieldVariations(
+            const boost::function< basic_mathematics::Vector6d( const double ) >
+            deformedBodyStateFunction,
+            const boost::function< Eigen::Quaterniond( const double ) >
+            deformedBodyOrientationFunction,
+            const std::vector< boost::function< basic_mathematics::Vector6d( const double ) > >
+            deformingBodyStateFunctions,
+            const double deformedBodyReferenceRadius,
+            const boost::function< double( ) > deformedBodyMass,
+            const std::vector< boost::function< double( ) > > deformingBodyMasses,
+            const std::vector< std::vector< std::complex< double > > > loveNumbers,
+            const std::vector< std::string > deformingBodies,
+            const double tideUpdateInterval = 0.0 );
+
+    //! Destructor
+    /*!
+     *  Destructor
+     */
+    virtual ~FastSolidBodyTideGravityFieldVariations( ){ }
+
+    //! Derived function for calculating spherical harmonic coefficient corrections.
+    /*!
+     *  Derived function for calculating spherical harmonic coefficient corrections.
+     *  \param time Time at which variations are to be calculated.
+     *  \return Pair of matrices containing variations in (cosine,sine) coefficients.
+     */
+    std::pair< Eigen::MatrixXd, Eigen::MatrixXd > calculateSphericalHarmonicsCorrections(
+            const double time );
+
+    //! Function to reset the current time of the object.
+    /*!
+     *  Function to reset the current time of the object, clearing all tide terms cached at the interpolation nodes
+     *  (for instance after the ephemerides of the bodies involved have been modified).
+     */
+    virtual void resetCurrentTime( )
+    {
+        isNodeWindowSet_ = false;
+    }
+
+    //! Function to retrieve the interval between subsequent evaluations of the geometric part of the tide.
+    /*!
+     *  Function to retrieve the interval between subsequent evaluations of the geometric part of the tide.
+     *  \return Interval between subsequent evaluations of the geometric part of the tide (zero if evaluated directly).
+     */
+    double getTideUpdateInterval( )
+    {
+        return tideUpdateInterval_;
+    }
+
+protected:
+
+    //! Function to calculate the geometric part of the tide of all bodies causing deformation.
+    /*!
+     *  Function to calculate the geometric (Love number- and mass-independent) part of the tide of all bodies causing
+     *  deformation at given time.
+     *  \param time Time at which the tide terms are to be calculated.
+     *  \param tideTerms Tide terms of each body causing deformation (returned by reference).
+     */
+    void calculateTideTerms( const double time, std::vector< Eigen::MatrixXcd >& tideTerms );
+
+    //! Function to update the geometric part of the tide at the current time.
+    /*!
+     *  Function to update the geometric part of the tide at the current time (set in currentTideTerms_), either
+     *  directly or by interpolation of the cached node values.
+     *  \param time Time at which the tide terms are to be calculated.
+     */
+    void updateCurrentTideTerms( const double time );
+
+    //! Interval between subsequent evaluations of the geometric part of the tide (zero if evaluated directly).
+    double tideUpdateInterval_;
+
+    //! Geodesy normalization factors divided by (2n+1), for each degree (row; index 0 is degree 2) and order (column).
+    Eigen::MatrixXd normalizationFactors_;
+
+    //! Current geometric part of the tide of each body causing deformation.
+    std::vector< Eigen::MatrixXcd > currentTideTerms_;
+
+    //! Geometric part of the tide of each body causing deformation, at the four current interpolation nodes.
+    std::vector< std::vector< Eigen::MatrixXcd > > nodeTideTerms_;
+
+    //! Index of first of the four current interpolation nodes (node time is index times tideUpdateInterval_).
+    long firstNodeIndex_;
+
+    //! Boolean denoting whether the nodeTideTerms_ have been set.
+    bool isNodeWindowSet_;
+
+    //! Relative position of currently considered deforming body, in frame fixed to deformed body.
+    Eigen::Vector3d relativeBodyFixedPosition_;
+
+};
+
+} // namespace gravitation
+
+} // namespace tudat
+
+#endif // TUDAT_FASTSOLIDBODYTIDEGRAVITYFIELDVARIATIONS_H
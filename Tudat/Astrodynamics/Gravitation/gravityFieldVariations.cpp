@@ -257,6 +257,35 @@ GravityFieldVariationsSet::getVariationFunctions( )
     return variationFunctions;
 }
 
+//! Function to retrieve whether the variation functions depend only on time.
+std::vector< bool > GravityFieldVariationsSet::getVariationFunctionTimeDependenceOnly( )
+{
+    std::vector< bool > isOnlyTimeDependent;
+    for( unsigned int i = 0; i < variationObjects_.size( ); i++ )
+    {
+        // Interpolated variations are pre-computed from ephemerides, tabulated variations are
+        // explicit functions of time.
+        isOnlyTimeDependent.push_back( ( createInterpolator_.count( i ) > 0 ) ||
+                                       ( variationType_.at( i ) == tabulated_variation ) );
+    }
+    return isOnlyTimeDependent;
+}
+
+//! Function to retrieve list of coefficient blocks that are affected by the variations.
+std::vector< boost::tuple< int, int, int, int > > GravityFieldVariationsSet::getVariationBlocks( )
+{
+    std::vector< boost::tuple< int, int, int, int > > variationBlocks;
+    for( unsigned int i = 0; i < variationObjects_.size( ); i++ )
+    {
+        variationBlocks.push_back(
+                    boost::make_tuple( variationObjects_.at( i )->getMinimumDegree( ),
+                                       variationObjects_.at( i )->getMinimumOrder( ),
+                                       variationObjects_.at( i )->getNumberOfDegrees( ),
+                                       variationObjects_.at( i )->getNumberOfOrders( ) ) );
+    }
+    return variationBlocks;
+}
+
 } // namespace gravitation
 
 } // namespace tudat
@@ -12,6 +12,7 @@
 #define TUDAT_GRAVITYFIELDVARIATIONS_H
 
 #include <boost/function.hpp>
+#include <boost/tuple/tuple.hpp>
 #include <iostream>
 
 #include <Eigen/Core>
@@ -186,6 +187,14 @@ public:
             Eigen::MatrixXd& sineCoefficients,
             Eigen::MatrixXd& cosineCoefficients );
 
+    //! Function to reset the current time of the object.
+    /*!
+     *  Function to reset the current time of the object, signalling that any data cached by the derived class is to be
+     *  recomputed (for instance after the environment models on which the variations depend have been modified).
+     *  Default implementation does nothing.
+     */
+    virtual void resetCurrentTime( ){ }
+
     //! Function to return the maximum degree of the corrections.
     /*!
      *  Function to return the maximum degree of the corrections.
@@ -376,6 +385,25 @@ public:
     std::vector< boost::function< void( const double, Eigen::MatrixXd&, Eigen::MatrixXd& ) > >
     getVariationFunctions( );
 
+    //! Function to retrieve whether the variation functions depend only on time.
+    /*!
+     *  Function to retrieve whether the variation functions, as returned by getVariationFunctions,
+     *  depend only on time (and not on the current state of the environment). This is the case for
+     *  interpolated and tabulated variations, which may therefore be skipped when re-evaluating the
+     *  variations at the same time as the previous evaluation.
+     *  \return List of booleans (one per entry of getVariationFunctions), true if associated
+     *  variation function depends only on time.
+     */
+    std::vector< bool > getVariationFunctionTimeDependenceOnly( );
+
+    //! Function to retrieve list of coefficient blocks that are affected by the variations.
+    /*!
+     *  Function to retrieve list of coefficient blocks that are affected by the variations.
+     *  \return List of (minimum degree, minimum order, number of degrees, number of orders) of the
+     *  correction block of each entry of variationObjects_.
+     */
+    std::vector< boost::tuple< int, int, int, int > > getVariationBlocks( );
+
     std::vector< boost::shared_ptr< GravityFieldVariations > > getVariationObjects( )
     {
         return variationObjects_;
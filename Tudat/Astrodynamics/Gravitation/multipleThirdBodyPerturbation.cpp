@@ -0,0 +1,84 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <cmath>
+
+#include "Tudat/Astrodynamics/Gravitation/multipleThirdBodyPerturbation.h"
+
+namespace tudat
+{
+namespace gravitation
+{
+
+//! Compute perturbing acceleration by third body, using the formulation of Battin.
+Eigen::Vector3d computeThirdBodyPerturbingAccelerationUsingBattinFormulation(
+        const double gravitationalParameterOfPerturbingBody,
+        const Eigen::Vector3d& relativePositionOfAffectedBody,
+        const Eigen::Vector3d& relativePositionOfPerturbingBody )
+{
+    const Eigen::Vector3d positionWithRespectToPerturbingBody =
+            relativePositionOfAffectedBody - relativePositionOfPerturbingBody;
+    const double distanceToPerturbingBody = positionWithRespectToPerturbingBody.norm( );
+    const double q = relativePositionOfAffectedBody.dot(
+                relativePositionOfAffectedBody - 2.0 * relativePositionOfPerturbingBody ) /
+            relativePositionOfPerturbingBody.squaredNorm( );
+
+    return -gravitationalParameterOfPerturbingBody /
+            ( distanceToPerturbingBody * distanceToPerturbingBody * distanceToPerturbingBody ) *
+            ( relativePositionOfAffectedBody + evaluateBattinThirdBodyFunction( q ) * relativePositionOfPerturbingBody );
+}
+
+//! Update member variables to current state, and compute acceleration.
+void MultipleThirdBodyCentralGravityAcceleration::updateMembers( const double currentTime )
+{
+    if( !( this->currentTime_ == currentTime ) )
+    {
+        // Retrieve current positions and gravitational parameters.
+        positionOfBodySubjectToAcceleration_ = positionOfBodySubjectToAccelerationFunction_( );
+        perturbingBodyPositionsFunction_( perturbingBodyPositions_ );
+        perturbingBodyGravitationalParametersFunction_( gravitationalParameters_ );
+
+        currentAcceleration_.setZero( );
+        if( useIndirectTerms_ )
+        {
+            // Compute positions w.r.t. central body.
+            const Eigen::Vector3d centralBodyPosition = positionOfCentralBodyFunction_( );
+            positionOfBodySubjectToAcceleration_ -= centralBodyPosition;
+            perturbingBodyPositions_.colwise( ) -= centralBodyPosition;
+
+            // Add perturbations of all bodies, using Battin's formulation.
+            for( int i = 0; i < perturbingBodyPositions_.cols( ); i++ )
+            {
+                currentAcceleration_ += computeThirdBodyPerturbingAccelerationUsingBattinFormulation(
+                            gravitationalParameters_( i ), positionOfBodySubjectToAcceleration_,
+                            perturbingBodyPositions_.col( i ) );
+            }
+        }
+        else
+        {
+            // Add direct accelerations of all bodies.
+            Eigen::Vector3d relativePosition;
+            double distanceToPerturbingBody;
+            for( int i = 0; i < perturbingBodyPositions_.cols( ); i++ )
+            {
+                relativePosition = positionOfBodySubjectToAcceleration_ - perturbingBodyPositions_.col( i );
+                distanceToPerturbingBody = relativePosition.norm( );
+                currentAcceleration_ -= gravitationalParameters_( i ) /
+                        ( distanceToPerturbingBody * distanceToPerturbingBody * distanceToPerturbingBody ) *
+                        relativePosition;
+            }
+        }
+
+        this->currentTime_ = currentTime;
+    }
+}
+
+} // namespace gravitation
+} // namespace tudat
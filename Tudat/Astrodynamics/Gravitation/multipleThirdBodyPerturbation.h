@@ -0,0 +1,206 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Battin, R.H. An Introduction to the Mathematics and Methods of Astrodynamics, Revised Edition,
+ *          AIAA Education Series, 1999.
+ *      Montebruck O, Gill E. Satellite Orbits, Corrected Third Printing, Springer, 2005.
+ */
+
+#ifndef TUDAT_MULTIPLE_THIRD_BODY_PERTURBATION_H
+#define TUDAT_MULTIPLE_THIRD_BODY_PERTURBATION_H
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <boost/function.hpp>
+#include <boost/lambda/lambda.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/accelerationModel.h"
+
+namespace tudat
+{
+namespace gravitation
+{
+
+//! Function to evaluate Battin's f(q) function for the computation of third-body perturbations.
+/*!
+ *  Function to evaluate Battin's f(q) function, which is equal to (1+q)^(3/2) - 1, but is formulated such that no
+ *  cancellation occurs for small q (Battin, 1999, eq. 8.60).
+ *  \param q Input parameter q, as computed by computeThirdBodyPerturbingAccelerationUsingBattinFormulation
+ *  \return Value of f(q)
+ */
+inline double evaluateBattinThirdBodyFunction( const double q )
+{
+    const double onePlusQ = 1.0 + q;
+    return q * ( 3.0 + q * ( 3.0 + q ) ) / ( 1.0 + onePlusQ * std::sqrt( onePlusQ ) );
+}
+
+//! Compute perturbing acceleration by third body, using the formulation of Battin.
+/*!
+ *  Computes the perturbing acceleration on a point mass in orbit about a central body (point mass), caused by a third
+ *  body (point mass), expressed in a non-rotating frame centered on the central body. As opposed to
+ *  computeThirdBodyPerturbingAcceleration, the direct and indirect terms are not computed separately and subtracted
+ *  (which leads to a loss of precision if the third body is far away w.r.t. the distance between the central and the
+ *  accelerated body). Instead, the acceleration is computed as:
+ *  a = -mu / |d|^3 * ( r + f(q) * s ),
+ *  with r the position of the accelerated body, s the position of the third body, d = r - s and f(q) given by
+ *  evaluateBattinThirdBodyFunction, for q = r.(r - 2s) / (s.s) (Battin, 1999, Section 8.4).
+ *  \param gravitationalParameterOfPerturbingBody Gravitational parameter of the perturbing body.
+ *  \param relativePositionOfAffectedBody Position of the body undergoing the acceleration, w.r.t. the central body.
+ *  \param relativePositionOfPerturbingBody Position of the perturbing body, w.r.t. the central body.
+ *  \return Perturbing acceleration of the third body.
+ */
+Eigen::Vector3d computeThirdBodyPerturbingAccelerationUsingBattinFormulation(
+        const double gravitationalParameterOfPerturbingBody,
+        const Eigen::Vector3d& relativePositionOfAffectedBody,
+        const Eigen::Vector3d& relativePositionOfPerturbingBody );
+
+//! Class for calculating the combined point-mass third-body acceleration of any number of perturbing bodies.
+/*!
+ *  Class for calculating the combined point-mass third-body acceleration of any number of perturbing bodies, on a body
+ *  that is propagated w.r.t. a central body. As opposed to using a ThirdBodyCentralGravityAcceleration for each
+ *  perturbing body (which each contain two CentralGravitationalAccelerationModel3d objects with separate position
+ *  functions), the positions and gravitational parameters of all perturbing bodies are retrieved by a single function
+ *  call each, into a single contiguous 3xN matrix and N vector, from which the accelerations are evaluated in one loop.
+ *  If the central body is not an inertial frame origin, the difference between the direct and indirect
+ *  terms is evaluated using the formulation of Battin (see
+ *  computeThirdBodyPerturbingAccelerationUsingBattinFormulation), avoiding the numerical cancellation of the direct
+ *  computation of the difference. Otherwise, only the direct terms are evaluated.
+ */
+class MultipleThirdBodyCentralGravityAcceleration: public basic_astrodynamics::AccelerationModel< Eigen::Vector3d >
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor.
+     *  \param positionOfBodySubjectToAccelerationFunction Function returning position of body undergoing acceleration.
+     *  \param perturbingBodyPositionsFunction Function setting the positions of all perturbing bodies (one per column)
+     *  in the matrix that is passed by reference.
+     *  \param perturbingBodyGravitationalParametersFunction Function setting the gravitational parameters of all
+     *  perturbing bodies in the vector that is passed by reference.
+     *  \param perturbingBodyNames Names of the perturbing bodies (in same order as positions and gravitational
+     *  parameters).
+     *  \param centralBodyName Name of the central body w.r.t. which the acceleration is computed.
+     *  \param positionOfCentralBodyFunction Function returning position of central body.
+     *  \param useIndirectTerms Boolean denoting whether the accelerations of the perturbing bodies on the central body
+     *  are to be subtracted (should be false only if the central body is an inertial frame origin).
+     */
+    MultipleThirdBodyCentralGravityAcceleration(
+            const boost::function< Eigen::Vector3d( ) > positionOfBodySubjectToAccelerationFunction,
+            const boost::function< void( Eigen::Matrix3Xd& ) > perturbingBodyPositionsFunction,
+            const boost::function< void( Eigen::VectorXd& ) > perturbingBodyGravitationalParametersFunction,
+            const std::vector< std::string >& perturbingBodyNames,
+            const std::string& centralBodyName,
+            const boost::function< Eigen::Vector3d( ) > positionOfCentralBodyFunction =
+            boost::lambda::constant( Eigen::Vector3d::Zero( ) ),
+            const bool useIndirectTerms = true ):
+        positionOfBodySubjectToAccelerationFunction_( positionOfBodySubjectToAccelerationFunction ),
+        perturbingBodyPositionsFunction_( perturbingBodyPositionsFunction ),
+        perturbingBodyGravitationalParametersFunction_( perturbingBodyGravitationalParametersFunction ),
+        perturbingBodyNames_( perturbingBodyNames ),
+        centralBodyName_( centralBodyName ),
+        positionOfCentralBodyFunction_( positionOfCentralBodyFunction ),
+        useIndirectTerms_( useIndirectTerms ),
+        perturbingBodyPositions_( Eigen::Matrix3Xd::Zero( 3, perturbingBodyNames.size( ) ) ),
+        gravitationalParameters_( Eigen::VectorXd::Zero( perturbingBodyNames.size( ) ) ),
+        currentAcceleration_( Eigen::Vector3d::Zero( ) ){ }
+
+    //! Function to retrieve the combined third body gravity acceleration.
+    /*!
+     *  Function to retrieve the combined third body gravity acceleration, as computed by last call to updateMembers.
+     *  \return Current combined third body acceleration
+     */
+    Eigen::Vector3d getAcceleration( )
+    {
+        return currentAcceleration_;
+    }
+
+    //! Update member variables to current state, and compute acceleration.
+    /*!
+     *  Update member variables to current state, and compute acceleration.
+     *  \param currentTime Time at which acceleration model is to be updated.
+     */
+    void updateMembers( const double currentTime = TUDAT_NAN );
+
+    //! Function to return the names of the perturbing bodies.
+    /*!
+     *  Function to return the names of the perturbing bodies.
+     *  \return Names of the perturbing bodies.
+     */
+    std::vector< std::string > getPerturbingBodyNames( )
+    {
+        return perturbingBodyNames_;
+    }
+
+    //! Function to return the name of the central body w.r.t. which the acceleration is computed.
+    /*!
+     *  Function to return the name of the central body w.r.t. which the acceleration is computed.
+     *  \return Name of the central body w.r.t. which the acceleration is computed.
+     */
+    std::string getCentralBodyName( )
+    {
+        return centralBodyName_;
+    }
+
+    //! Function to return whether the accelerations of the perturbing bodies on the central body are subtracted.
+    /*!
+     *  Function to return whether the accelerations of the perturbing bodies on the central body are subtracted.
+     *  \return True if the accelerations of the perturbing bodies on the central body are subtracted.
+     */
+    bool getUseIndirectTerms( )
+    {
+        return useIndirectTerms_;
+    }
+
+private:
+
+    //! Function returning position of body undergoing acceleration.
+    boost::function< Eigen::Vector3d( ) > positionOfBodySubjectToAccelerationFunction_;
+
+    //! Function setting the positions of all perturbing bodies (one per column).
+    boost::function< void( Eigen::Matrix3Xd& ) > perturbingBodyPositionsFunction_;
+
+    //! Function setting the gravitational parameters of all perturbing bodies.
+    boost::function< void( Eigen::VectorXd& ) > perturbingBodyGravitationalParametersFunction_;
+
+    //! Names of the perturbing bodies.
+    std::vector< std::string > perturbingBodyNames_;
+
+    //! Name of the central body w.r.t. which the acceleration is computed.
+    std::string centralBodyName_;
+
+    //! Function returning position of central body.
+    boost::function< Eigen::Vector3d( ) > positionOfCentralBodyFunction_;
+
+    //! Boolean denoting whether the accelerations of the perturbing bodies on the central body are subtracted.
+    bool useIndirectTerms_;
+
+    //! Current positions of the perturbing bodies (one per column; w.r.t. central body if useIndirectTerms_ is true).
+    Eigen::Matrix3Xd perturbingBodyPositions_;
+
+    //! Current gravitational parameters of the perturbing bodies.
+    Eigen::VectorXd gravitationalParameters_;
+
+    //! Current position of body undergoing acceleration (w.r.t. central body if useIndirectTerms_ is true).
+    Eigen::Vector3d positionOfBodySubjectToAcceleration_;
+
+    //! Current combined third body acceleration.
+    Eigen::Vector3d currentAcceleration_;
+};
+
+} // namespace gravitation
+
+} // namespace tudat
+
+#endif // TUDAT_MULTIPLE_THIRD_BODY_PERTURBATION_H
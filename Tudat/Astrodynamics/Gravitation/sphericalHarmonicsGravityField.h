@@ -61,6 +61,7 @@
 #include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 
 #include "Tudat/Mathematics/BasicMathematics/legendrePolynomials.h"
+#include "Tudat/Astrodynamics/Gravitation/binarySphericalHarmonicsCoefficients.h"
 #include "Tudat/Astrodynamics/Gravitation/gravityFieldModel.h"
 #include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsGravityModel.h"
 
@@ -127,6 +128,29 @@ public:
                                                               cosineCoefficients_.cols( ) + 1 );
     }
 
+    //! Class constructor, using coefficients from a memory-mapped binary file.
+    /*!
+     *  Class constructor, using coefficients from a memory-mapped binary file. The coefficients are not copied, but are
+     *  used directly from the packed storage in the mapped file (until they are reset by setCosineCoefficients or
+     *  setSineCoefficients), with only the requested coefficient blocks expanded when they are evaluated.
+     *  \param mappedCoefficients Object providing the gravitational parameter, reference radius and coefficients
+     *  from a memory-mapped binary file.
+     *  \param fixedReferenceFrame Identifier for body-fixed reference frame to which the field is fixed (optional; if
+     *  empty, the reference frame in the binary file is used).
+     */
+    SphericalHarmonicsGravityField( const MappedSphericalHarmonicsCoefficientsPointer mappedCoefficients,
+                                    const std::string& fixedReferenceFrame = "" )
+        : GravityFieldModel( mappedCoefficients->getGravitationalParameter( ) ),
+          referenceRadius_( mappedCoefficients->getReferenceRadius( ) ),
+          fixedReferenceFrame_( fixedReferenceFrame.empty( ) ? mappedCoefficients->getReferenceFrame( ) :
+                                                               fixedReferenceFrame ),
+          mappedCoefficients_( mappedCoefficients )
+    {
+        sphericalHarmonicsCache_ = boost::make_shared< basic_mathematics::SphericalHarmonicsCache >( );
+        sphericalHarmonicsCache_->resetMaximumDegreeAndOrder( mappedCoefficients_->getMaximumDegree( ) + 2,
+                                                              mappedCoefficients_->getMaximumOrder( ) + 2 );
+    }
+
     //! Virtual destructor.
     /*!
      *  Virtual destructor.
@@ -145,21 +169,31 @@ public:
 
     //! Function to get the cosine spherical harmonic coefficients (geodesy normalized)
     /*!
-     *  Function to get the cosine spherical harmonic coefficients (geodesy normalized)
+     *  Function to get the cosine spherical harmonic coefficients (geodesy normalized). If the coefficients are used
+     *  from a memory-mapped binary file, they are copied to the cosineCoefficients_ member on the first call.
      *  \return Cosine spherical harmonic coefficients (geodesy normalized)
      */
-    Eigen::MatrixXd getCosineCoefficients( )
+    const Eigen::MatrixXd& getCosineCoefficients( )
     {
+        if( mappedCoefficients_ != NULL && cosineCoefficients_.size( ) == 0 )
+        {
+            cosineCoefficients_ = mappedCoefficients_->getCosineCoefficients( );
+        }
         return cosineCoefficients_;
     }
 
     //! Function to get the sine spherical harmonic coefficients (geodesy normalized)
     /*!
-     *  Function to get the sine spherical harmonic coefficients (geodesy normalized)
+     *  Function to get the sine spherical harmonic coefficients (geodesy normalized). If the coefficients are used
+     *  from a memory-mapped binary file, they are copied to the sineCoefficients_ member on the first call.
      *  \return Sine spherical harmonic coefficients (geodesy normalized)
      */
-    Eigen::MatrixXd getSineCoefficients( )
+    const Eigen::MatrixXd& getSineCoefficients( )
     {
+        if( mappedCoefficients_ != NULL && sineCoefficients_.size( ) == 0 )
+        {
+            sineCoefficients_ = mappedCoefficients_->getSineCoefficients( );
+        }
         return sineCoefficients_;
     }
 
@@ -170,6 +204,7 @@ public:
      */
     void setCosineCoefficients( const Eigen::MatrixXd& cosineCoefficients )
     {
+        detachFromMappedCoefficients( );
         cosineCoefficients_ = cosineCoefficients;
     }
 
@@ -180,6 +215,7 @@ public:
      */
     void setSineCoefficients( const Eigen::MatrixXd& sineCoefficients )
     {
+        detachFromMappedCoefficients( );
         sineCoefficients_ = sineCoefficients;
     }
 
@@ -194,6 +230,10 @@ public:
      */
     Eigen::MatrixXd getCosineCoefficients( const int maximumDegree, const int maximumOrder )
     {
+        if( mappedCoefficients_ != NULL )
+        {
+            return mappedCoefficients_->getCosineCoefficients( maximumDegree, maximumOrder );
+        }
         return cosineCoefficients_.block( 0, 0, maximumDegree + 1, maximumOrder + 1 );
     }
 
@@ -208,6 +248,10 @@ public:
      */
     Eigen::MatrixXd getSineCoefficients( const int maximumDegree, const int maximumOrder )
     {
+        if( mappedCoefficients_ != NULL )
+        {
+            return mappedCoefficients_->getSineCoefficients( maximumDegree, maximumOrder );
+        }
         return sineCoefficients_.block( 0, 0, maximumDegree + 1, maximumOrder + 1 );
     }
 
@@ -218,7 +262,7 @@ public:
      */
     double getDegreeOfExpansion( )
     {
-        return cosineCoefficients_.rows( ) + 1;
+        return getNumberOfCoefficientDegrees( ) + 1;
     }
 
     //! Get maximum order of spherical harmonics gravity field expansion.
@@ -228,7 +272,7 @@ public:
      */
     double getOrderOfExpansion( )
     {
-        return cosineCoefficients_.cols( ) + 1;
+        return getNumberOfCoefficientOrders( ) + 1;
     }
 
     //! Function to calculate the gravitational potential at a given point
@@ -242,8 +286,8 @@ public:
      */
     double getGravitationalPotential( const Eigen::Vector3d& bodyFixedPosition )
     {
-        return getGravitationalPotential( bodyFixedPosition, cosineCoefficients_.rows( ) - 1,
-                                          sineCoefficients_.cols( ) - 1 );
+        return getGravitationalPotential( bodyFixedPosition, getNumberOfCoefficientDegrees( ) - 1,
+                                          getNumberOfCoefficientOrders( ) - 1 );
     }
 
     //! Function to calculate the gravitational potential due to terms up to given degree and
@@ -268,8 +312,8 @@ public:
     {
         return calculateSphericalHarmonicGravitationalPotential(
                     bodyFixedPosition, gravitationalParameter_, referenceRadius_,
-                    cosineCoefficients_.block( 0, 0, maximumDegree + 1, maximumOrder + 1 ),
-                    sineCoefficients_.block( 0, 0, maximumDegree + 1, maximumOrder + 1 ),
+                    getCosineCoefficients( maximumDegree, maximumOrder ),
+                    getSineCoefficients( maximumDegree, maximumOrder ),
                     sphericalHarmonicsCache_,
                     minimumDegree, minimumOrder );
     }
@@ -284,8 +328,8 @@ public:
      */
     Eigen::Vector3d getGradientOfPotential( const Eigen::Vector3d& bodyFixedPosition )
     {
-        return getGradientOfPotential( bodyFixedPosition, cosineCoefficients_.rows( ),
-                                       sineCoefficients_.cols( ) );
+        return getGradientOfPotential( bodyFixedPosition, getNumberOfCoefficientDegrees( ),
+                                       getNumberOfCoefficientOrders( ) );
     }
 
     //! Get the gradient of the potential.
@@ -302,8 +346,9 @@ public:
     {
         return computeGeodesyNormalizedGravitationalAccelerationSum(
                     bodyFixedPosition, gravitationalParameter_, referenceRadius_,
-                    cosineCoefficients_.block( 0, 0, maximumDegree, maximumOrder ),
-                    sineCoefficients_.block( 0, 0, maximumDegree, maximumOrder ), sphericalHarmonicsCache_ );
+                    getCosineCoefficients( maximumDegree - 1, maximumOrder - 1 ),
+                    getSineCoefficients( maximumDegree - 1, maximumOrder - 1 ),
+                    sphericalHarmonicsCache_ );
     }
 
     //! Function to retrieve the tdentifier for body-fixed reference frame
@@ -316,8 +361,63 @@ public:
         return fixedReferenceFrame_;
     }
 
+    //! Function to retrieve whether the coefficients are used directly from a memory-mapped binary file.
+    /*!
+     *  Function to retrieve whether the coefficients are used directly from a memory-mapped binary file.
+     *  \return True if the coefficients are used directly from a memory-mapped binary file.
+     */
+    bool getUsesMappedCoefficients( )
+    {
+        return ( mappedCoefficients_ != NULL );
+    }
+
 protected:
 
+    //! Function to retrieve the number of degrees (rows) of the current coefficient matrices.
+    /*!
+     *  Function to retrieve the number of degrees (rows) of the current coefficient matrices, without expanding the
+     *  coefficients from the memory-mapped binary file (if any).
+     *  \return Number of degrees of the current coefficient matrices.
+     */
+    int getNumberOfCoefficientDegrees( ) const
+    {
+        if( mappedCoefficients_ != NULL )
+        {
+            return mappedCoefficients_->getMaximumDegree( ) + 1;
+        }
+        return cosineCoefficients_.rows( );
+    }
+
+    //! Function to retrieve the number of orders (columns) of the current coefficient matrices.
+    /*!
+     *  Function to retrieve the number of orders (columns) of the current coefficient matrices, without expanding the
+     *  coefficients from the memory-mapped binary file (if any).
+     *  \return Number of orders of the current coefficient matrices.
+     */
+    int getNumberOfCoefficientOrders( ) const
+    {
+        if( mappedCoefficients_ != NULL )
+        {
+            return mappedCoefficients_->getMaximumOrder( ) + 1;
+        }
+        return cosineCoefficients_.cols( );
+    }
+
+    //! Function to copy the coefficients from the memory-mapped binary file (if any) to the coefficient members.
+    /*!
+     *  Function to copy the coefficients from the memory-mapped binary file (if any) to the cosineCoefficients_ and
+     *  sineCoefficients_ members, and release the mapped file, so that the coefficients can be modified.
+     */
+    void detachFromMappedCoefficients( )
+    {
+        if( mappedCoefficients_ != NULL )
+        {
+            cosineCoefficients_ = mappedCoefficients_->getCosineCoefficients( );
+            sineCoefficients_ = mappedCoefficients_->getSineCoefficients( );
+            mappedCoefficients_.reset( );
+        }
+    }
+
     //! Reference radius of spherical harmonic field expansion
     /*!
      *  Reference radius of spherical harmonic field expansion
@@ -342,6 +442,13 @@ protected:
      */
     std::string fixedReferenceFrame_;
 
+    //! Coefficients from memory-mapped binary file (NULL if coefficients are stored in coefficient members)
+    /*!
+     *  Coefficients from memory-mapped binary file. If not NULL, these are used instead of the cosineCoefficients_ and
+     *  sineCoefficients_ members.
+     */
+    MappedSphericalHarmonicsCoefficientsPointer mappedCoefficients_;
+
     //! Cache object for potential calculations.
     boost::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache_;
 };
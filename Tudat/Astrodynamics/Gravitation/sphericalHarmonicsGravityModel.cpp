@@ -32,6 +32,7 @@
  *
  */
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <stdexcept>
@@ -64,10 +65,12 @@ Eigen::Vector3d computeGeodesyNormalizedGravitationalAccelerationSum(
         const double equatorialRadius,
         const Eigen::MatrixXd& cosineHarmonicCoefficients,
         const Eigen::MatrixXd& sineHarmonicCoefficients,
-        boost::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache )
+        boost::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache,
+        const int maximumDegree )
 {
     // Set highest degree and order.
-    const int highestDegree = cosineHarmonicCoefficients.rows( );
+    const int highestDegree = ( maximumDegree < 0 ) ? cosineHarmonicCoefficients.rows( ) :
+                                                      std::min< int >( maximumDegree + 1, cosineHarmonicCoefficients.rows( ) );
     const int highestOrder = cosineHarmonicCoefficients.cols( );
 
     // Declare spherical position vector.
@@ -80,7 +83,7 @@ Eigen::Vector3d computeGeodesyNormalizedGravitationalAccelerationSum(
     sphericalHarmonicsCache->update( sphericalpositionOfBodySubjectToAcceleration( 0 ),
                                      sineOfAngle,
                                      sphericalpositionOfBodySubjectToAcceleration( 2 ),
-                                     equatorialRadius );
+                                     equatorialRadius, maximumDegree );
 
     boost::shared_ptr< basic_mathematics::LegendreCache > legendreCacheReference =
             sphericalHarmonicsCache->getLegendreCache( );
@@ -125,6 +128,40 @@ Eigen::Vector3d computeGeodesyNormalizedGravitationalAccelerationSum(
                 sphericalGradient, positionOfBodySubjectToAcceleration );
 }
 
+//! Function to compute the maximum degree to which a spherical harmonic expansion is to be evaluated.
+int computeAdaptiveTruncationDegree(
+        const double referenceRadiusRatio,
+        const double truncationTolerance,
+        const double hysteresisFactor,
+        const int previousDegree,
+        const int fullDegree )
+{
+    // Use full expansion if inside reference sphere.
+    if( !( referenceRadiusRatio < 1.0 ) )
+    {
+        return fullDegree;
+    }
+
+    // Compute highest degree n for which (R/r)^n exceeds the tolerance, and the tolerance divided by hysteresis factor.
+    const double logarithmOfRadiusRatio = std::log( referenceRadiusRatio );
+    const double requiredDegree = std::floor( std::log( truncationTolerance ) / logarithmOfRadiusRatio );
+    const double allowedDegree = std::floor( std::log( truncationTolerance / hysteresisFactor ) / logarithmOfRadiusRatio );
+
+    // Increase degree if required, decrease only if allowed by hysteresis.
+    int truncationDegree = previousDegree;
+    if( previousDegree < 0 || static_cast< double >( previousDegree ) < requiredDegree )
+    {
+        truncationDegree = ( requiredDegree < static_cast< double >( fullDegree ) ) ?
+                    static_cast< int >( requiredDegree ) : fullDegree;
+    }
+    else if( static_cast< double >( previousDegree ) > allowedDegree )
+    {
+        truncationDegree = static_cast< int >( allowedDegree );
+    }
+
+    return std::min( truncationDegree, fullDegree );
+}
+
 //! Compute gravitational acceleration due to single spherical harmonics term.
 Eigen::Vector3d computeSingleGeodesyNormalizedGravitationalAcceleration(
         const Eigen::Vector3d& positionOfBodySubjectToAcceleration,
@@ -99,6 +99,8 @@ namespace gravitation
  *          coefficients. The matrix must be equal in size to cosineHarmonicCoefficients.
  * \param sphericalHarmonicsCache Cache object for computing/retrieving repeated terms in spherical harmonics potential
  *          gradient calculation.
+ * \param maximumDegree Maximum degree up to which the harmonic terms are to be summed (and the cache is to be
+ *          updated). If negative (default), all terms in the coefficient matrices are used.
  * \return Cartesian acceleration vector resulting from the summation of all harmonic terms.
  *           The order is important!
  *           acceleration( 0 ) = x acceleration [m s^-2],
@@ -111,7 +113,31 @@ Eigen::Vector3d computeGeodesyNormalizedGravitationalAccelerationSum(
         const double equatorialRadius,
         const Eigen::MatrixXd& cosineHarmonicCoefficients,
         const Eigen::MatrixXd& sineHarmonicCoefficients,
-        boost::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache );
+        boost::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache,
+        const int maximumDegree = -1 );
+
+//! Function to compute the maximum degree to which a spherical harmonic expansion is to be evaluated.
+/*!
+ *  Function to compute the maximum degree to which a spherical harmonic expansion is to be evaluated, for an adaptive
+ *  truncation of the expansion. The terms of degree n are reduced w.r.t. the central term by (R/r)^n (with R the
+ *  reference radius and r the distance), so that all degrees for which (R/r)^n is below the truncation tolerance are
+ *  omitted. To prevent the truncation degree from switching back and forth in subsequent evaluations (which would
+ *  disturb the step-size control of variable step-size integrators), a hysteresis is applied: the degree is increased
+ *  as soon as (R/r)^n exceeds the tolerance, but is only decreased when (R/r)^n is below the tolerance divided by the
+ *  hysteresis factor.
+ *  \param referenceRadiusRatio Ratio R/r of reference radius and distance from origin.
+ *  \param truncationTolerance Tolerance (relative to central term) below which terms are omitted.
+ *  \param hysteresisFactor Factor (>= 1) by which (R/r)^n must be below the tolerance before degree n is omitted.
+ *  \param previousDegree Maximum degree used at the previous evaluation (negative if none).
+ *  \param fullDegree Maximum degree of spherical harmonic expansion.
+ *  \return Maximum degree to which the expansion is to be evaluated.
+ */
+int computeAdaptiveTruncationDegree(
+        const double referenceRadiusRatio,
+        const double truncationTolerance,
+        const double hysteresisFactor,
+        const int previousDegree,
+        const int fullDegree );
 
 //! Compute gravitational acceleration due to single spherical harmonics term.
 /*!
@@ -240,7 +266,8 @@ public:
           rotationFromBodyFixedToIntegrationFrameFunction_(
               rotationFromBodyFixedToIntegrationFrameFunction ),
           sphericalHarmonicsCache_( sphericalHarmonicsCache ),
-          currentAcceleration_( Eigen::Vector3d::Zero( ) )
+          currentAcceleration_( Eigen::Vector3d::Zero( ) ),
+          truncationTolerance_( 0.0 ), truncationHysteresisFactor_( 1.0 ), currentMaximumDegree_( -1 )
 
     {
         sphericalHarmonicsCache_->resetMaximumDegreeAndOrder(
@@ -299,7 +326,8 @@ public:
           getSineHarmonicsCoefficients( sineHarmonicCoefficientsFunction ),
           rotationFromBodyFixedToIntegrationFrameFunction_( rotationFromBodyFixedToIntegrationFrameFunction ),
           sphericalHarmonicsCache_( sphericalHarmonicsCache ),
-          currentAcceleration_( Eigen::Vector3d::Zero( ) )
+          currentAcceleration_( Eigen::Vector3d::Zero( ) ),
+          truncationTolerance_( 0.0 ), truncationHysteresisFactor_( 1.0 ), currentMaximumDegree_( -1 )
     {
         sphericalHarmonicsCache_->resetMaximumDegreeAndOrder(
                     std::max< int >( static_cast< int >( getCosineHarmonicsCoefficients( ).rows( ) ), sphericalHarmonicsCache_->getMaximumDegree( ) ),
@@ -335,6 +363,21 @@ public:
             sineHarmonicCoefficients = getSineHarmonicsCoefficients( );
             rotationToIntegrationFrame_ = rotationFromBodyFixedToIntegrationFrameFunction_( );
             this->updateBaseMembers( );
+
+            // Determine maximum degree to which expansion is to be evaluated.
+            const int fullDegree = static_cast< int >( cosineHarmonicCoefficients.rows( ) ) - 1;
+            if( truncationTolerance_ > 0.0 )
+            {
+                currentMaximumDegree_ = computeAdaptiveTruncationDegree(
+                            equatorialRadius / ( this->positionOfBodySubjectToAcceleration -
+                                                 this->positionOfBodyExertingAcceleration ).norm( ),
+                            truncationTolerance_, truncationHysteresisFactor_, currentMaximumDegree_, fullDegree );
+            }
+            else
+            {
+                currentMaximumDegree_ = fullDegree;
+            }
+
             currentAcceleration_ = rotationToIntegrationFrame_ *
                     computeGeodesyNormalizedGravitationalAccelerationSum(
                         rotationToIntegrationFrame_.inverse( ) * (
@@ -342,8 +385,50 @@ public:
                         gravitationalParameter,
                         equatorialRadius,
                         cosineHarmonicCoefficients,
-                        sineHarmonicCoefficients, sphericalHarmonicsCache_ );
+                        sineHarmonicCoefficients, sphericalHarmonicsCache_, currentMaximumDegree_ );
+        }
+    }
+
+    //! Function to set the settings for adaptive truncation of the spherical harmonic expansion.
+    /*!
+     *  Function to set the settings for adaptive truncation of the spherical harmonic expansion, in which the maximum
+     *  degree is determined at each evaluation from the current distance, using computeAdaptiveTruncationDegree.
+     *  \param truncationTolerance Tolerance (relative to central term) below which terms are omitted. If zero, the
+     *  full expansion is always evaluated.
+     *  \param hysteresisFactor Factor (>= 1) by which (R/r)^n must be below the tolerance before degree n is omitted.
+     */
+    void setAdaptiveTruncation( const double truncationTolerance, const double hysteresisFactor = 10.0 )
+    {
+        if( truncationTolerance < 0.0 || truncationTolerance >= 1.0 || hysteresisFactor < 1.0 )
+        {
+            throw std::runtime_error( "Error when setting adaptive spherical harmonic truncation, tolerance must be in "
+                                      "range [0,1) and hysteresis factor may not be smaller than 1." );
         }
+        truncationTolerance_ = truncationTolerance;
+        truncationHysteresisFactor_ = hysteresisFactor;
+        currentMaximumDegree_ = -1;
+        this->currentTime_ = TUDAT_NAN;
+    }
+
+    //! Function to retrieve the tolerance used for adaptive truncation of the spherical harmonic expansion.
+    /*!
+     *  Function to retrieve the tolerance used for adaptive truncation of the spherical harmonic expansion.
+     *  \return Tolerance used for adaptive truncation (zero if no adaptive truncation is used).
+     */
+    double getTruncationTolerance( )
+    {
+        return truncationTolerance_;
+    }
+
+    //! Function to retrieve the maximum degree used in the last evaluation of the acceleration.
+    /*!
+     *  Function to retrieve the maximum degree used in the last evaluation of the acceleration (equal to the maximum
+     *  degree of the coefficients, unless adaptive truncation is used).
+     *  \return Maximum degree used in the last evaluation of the acceleration.
+     */
+    int getCurrentMaximumDegree( )
+    {
+        return currentMaximumDegree_;
     }
 
     //! Function to retrieve the spherical harmonics cache for this acceleration.
@@ -452,6 +537,15 @@ private:
     //! Current acceleration, as computed by last call to updateMembers function
     Eigen::Vector3d currentAcceleration_;
 
+    //! Tolerance (relative to central term) below which terms are omitted (zero if no adaptive truncation is used).
+    double truncationTolerance_;
+
+    //! Hysteresis factor used for adaptive truncation (see computeAdaptiveTruncationDegree).
+    double truncationHysteresisFactor_;
+
+    //! Maximum degree used in the last evaluation of the acceleration.
+    int currentMaximumDegree_;
+
 };
 
 
@@ -38,15 +38,47 @@ void TimeDependentSphericalHarmonicsGravityField::clearVariations( )
 {
     gravityFieldVariationsSet_ = boost::shared_ptr< GravityFieldVariationsSet >( );
     correctionFunctions_.clear( );
+    correctionBlocks_.clear( );
+    areCorrectionsOnlyTimeDependent_ = false;
+    resetFullCoefficients_ = true;
+    currentTime_ = TUDAT_NAN;
 }
 
 
 //! Update gravity field to current time.
 void TimeDependentSphericalHarmonicsGravityField::update( const double time )
 {
+    // Check if coefficients are already up to date.
+    if( areCorrectionsOnlyTimeDependent_ && ( time == currentTime_ ) && !resetFullCoefficients_ )
+    {
+        return;
+    }
+
     // Initialize current coefficients to nominal values.
-    sineCoefficients_ = nominalSineCoefficients_;
-    cosineCoefficients_ = nominalCosineCoefficients_;
+    if( resetFullCoefficients_ )
+    {
+        sineCoefficients_ = nominalSineCoefficients_;
+        cosineCoefficients_ = nominalCosineCoefficients_;
+        resetFullCoefficients_ = false;
+    }
+    // Reset only those coefficients that are modified by the corrections.
+    else
+    {
+        for( unsigned int i = 0; i < correctionBlocks_.size( ); i++ )
+        {
+            const int startDegree = correctionBlocks_[ i ].get< 0 >( );
+            const int startOrder = correctionBlocks_[ i ].get< 1 >( );
+            const int numberOfDegrees = correctionBlocks_[ i ].get< 2 >( );
+            const int numberOfOrders = correctionBlocks_[ i ].get< 3 >( );
+
+            sineCoefficients_.block( startDegree, startOrder, numberOfDegrees, numberOfOrders ) =
+                    nominalSineCoefficients_.block(
+                        startDegree, startOrder, numberOfDegrees, numberOfOrders );
+            cosineCoefficients_.block( startDegree, startOrder, numberOfDegrees, numberOfOrders ) =
+                    nominalCosineCoefficients_.block(
+                        startDegree, startOrder, numberOfDegrees, numberOfOrders );
+        }
+    }
 
     // Iterate over all corrections.
     for( unsigned int i = 0; i < correctionFunctions_.size( ); i++ )
@@ -54,6 +86,8 @@ void TimeDependentSphericalHarmonicsGravityField::update( const double time )
         // Add correction of this iteration to current coefficients.
         correctionFunctions_[ i ]( time, sineCoefficients_, cosineCoefficients_ );
     }
+
+    currentTime_ = time;
 }
 
 } // namespace gravitation
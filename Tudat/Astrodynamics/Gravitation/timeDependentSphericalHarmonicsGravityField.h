@@ -14,8 +14,12 @@
 #include <boost/function.hpp>
 #include <boost/make_shared.hpp>
 
+#include <algorithm>
 #include <vector>
 
+#include <boost/tuple/tuple.hpp>
+
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 #include "Tudat/Mathematics/Interpolators/cubicSplineInterpolator.h"
 
 #include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsGravityField.h"
@@ -66,7 +70,10 @@ public:
             gravitationalParameter, referenceRadius, nominalCosineCoefficients,
             nominalSineCoefficients, fixedReferenceFrame ),
         nominalSineCoefficients_( nominalSineCoefficients ),
-        nominalCosineCoefficients_( nominalCosineCoefficients )
+        nominalCosineCoefficients_( nominalCosineCoefficients ),
+        areCorrectionsOnlyTimeDependent_( false ),
+        resetFullCoefficients_( true ),
+        currentTime_( TUDAT_NAN )
     { }
 
     //! Full class constructor.
@@ -94,7 +101,10 @@ public:
             nominalCosineCoefficients, nominalSineCoefficients, fixedReferenceFrame ),
         nominalSineCoefficients_( nominalSineCoefficients ),
         nominalCosineCoefficients_( nominalCosineCoefficients ),
-        gravityFieldVariationsSet_( gravityFieldVariationUpdateSettings )
+        gravityFieldVariationsSet_( gravityFieldVariationUpdateSettings ),
+        areCorrectionsOnlyTimeDependent_( false ),
+        resetFullCoefficients_( true ),
+        currentTime_( TUDAT_NAN )
     {
         updateCorrectionFunctions( );
     }
@@ -108,7 +118,11 @@ public:
     //! Update gravity field to current time.
     /*!
      *  Update gravity field coefficient corrections to current time. All correction functions are
-     *  called and subsequently added to the nominal value.
+     *  called and subsequently added to the nominal value. Only the coefficient blocks that are
+     *  affected by the corrections are reset to their nominal values, unless the nominal
+     *  coefficients have been modified since the previous update. If all corrections depend only on
+     *  time (see GravityFieldVariationsSet::getVariationFunctionTimeDependenceOnly) and the time is
+     *  equal to that of the previous update, no computations are performed.
      *  \param time Current time.
      */
     void update( const double time );
@@ -129,8 +143,39 @@ public:
         {
             // Reset correction functions.
             correctionFunctions_ = gravityFieldVariationsSet_->getVariationFunctions( );
+            correctionBlocks_ = gravityFieldVariationsSet_->getVariationBlocks( );
+
+            // Reset data cached by variation objects.
+            std::vector< boost::shared_ptr< GravityFieldVariations > > variationObjects =
+                    gravityFieldVariationsSet_->getVariationObjects( );
+            for( unsigned int i = 0; i < variationObjects.size( ); i++ )
+            {
+                variationObjects.at( i )->resetCurrentTime( );
+            }
+
+            std::vector< bool > isCorrectionOnlyTimeDependent =
+                    gravityFieldVariationsSet_->getVariationFunctionTimeDependenceOnly( );
+            areCorrectionsOnlyTimeDependent_ =
+                    ( std::find( isCorrectionOnlyTimeDependent.begin( ),
+                                 isCorrectionOnlyTimeDependent.end( ), false ) ==
+                      isCorrectionOnlyTimeDependent.end( ) );
         }
 
+        // Force full recomputation of coefficients at next update.
+        resetFullCoefficients_ = true;
+        currentTime_ = TUDAT_NAN;
+    }
+
+    //! Function to reset the current time of the gravity field.
+    /*!
+     *  Function to reset the current time of the gravity field, signalling that the corrections
+     *  are to be recomputed at the next call of update, even if the time is unchanged. Coefficients
+     *  are not recomputed by calling this function.
+     *  \param currentTime New value of currentTime_ variable.
+     */
+    void resetCurrentTime( const double currentTime = TUDAT_NAN )
+    {
+        currentTime_ = currentTime;
     }
 
     //! Function to (re)set the gravity field variations
@@ -171,6 +216,8 @@ public:
     void setNominalCosineCoefficients( Eigen::MatrixXd nominalCosineCoefficients )
     {
         nominalCosineCoefficients_ = nominalCosineCoefficients;
+        resetFullCoefficients_ = true;
+        currentTime_ = TUDAT_NAN;
     }
 
     //! Set nominal (i.e. with zero variations) cosine coefficient of given degree and order.
@@ -186,6 +233,8 @@ public:
                 order <= nominalCosineCoefficients_.cols( ) )
         {
             nominalCosineCoefficients_( degree, order ) = coefficient;
+            resetFullCoefficients_ = true;
+            currentTime_ = TUDAT_NAN;
         }
         else
         {
@@ -211,6 +260,8 @@ public:
     void setNominalSineCoefficients( const Eigen::MatrixXd& nominalSineCoefficients )
     {
         nominalSineCoefficients_ = nominalSineCoefficients;
+        resetFullCoefficients_ = true;
+        currentTime_ = TUDAT_NAN;
     }
 
     //! Set nominal (i.e. with zero variations) sine coefficient of given degree and order.
@@ -226,6 +277,8 @@ public:
                 order <= nominalSineCoefficients_.cols( ) )
         {
             nominalSineCoefficients_( degree, order ) = coefficient;
+            resetFullCoefficients_ = true;
+            currentTime_ = TUDAT_NAN;
         }
         else
         {
@@ -277,6 +330,32 @@ private:
      */
     boost::shared_ptr< GravityFieldVariationsSet > gravityFieldVariationsSet_;
 
+    //! List of coefficient blocks affected by the entries of correctionFunctions_.
+    /*!
+     *  List of coefficient blocks affected by the entries of correctionFunctions_, given as
+     *  (minimum degree, minimum order, number of degrees, number of orders). Only these blocks are
+     *  reset to their nominal values when calling the update function.
+     */
+    std::vector< boost::tuple< int, int, int, int > > correctionBlocks_;
+
+    //! Boolean denoting whether all entries of correctionFunctions_ depend only on time.
+    /*!
+     *  Boolean denoting whether all entries of correctionFunctions_ depend only on time, in which
+     *  case the update is skipped if the time is equal to currentTime_.
+     */
+    bool areCorrectionsOnlyTimeDependent_;
+
+    //! Boolean denoting whether the complete coefficient matrices are to be reset at next update.
+    /*!
+     *  Boolean denoting whether the complete coefficient matrices are to be reset to their nominal
+     *  values at the next update (i.e. if the nominal values or correction functions have changed),
+     *  instead of only the blocks in correctionBlocks_.
+     */
+    bool resetFullCoefficients_;
+
+    //! Time at which the coefficients were last updated.
+    double currentTime_;
+
 };
 
 } // namespace gravitation
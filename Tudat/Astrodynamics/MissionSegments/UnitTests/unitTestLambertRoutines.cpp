@@ -62,6 +62,8 @@
 
 #define BOOST_TEST_MAIN
 
+#include <cmath>
+
 #include <boost/test/unit_test.hpp>
 
 #include <Eigen/Core>
@@ -71,6 +73,7 @@
 #include "Tudat/Basics/testMacros.h"
 
 #include "Tudat/Astrodynamics/MissionSegments/lambertRoutines.h"
+#include "Tudat/Astrodynamics/MissionSegments/lambertTransferGrid.h"
 
 namespace tudat
 {
@@ -580,6 +583,81 @@ BOOST_AUTO_TEST_CASE( testsolveLambertProblemGoodingElliptical )
     BOOST_CHECK_SMALL( testInertialVelocityAtArrival.z( ), tolerance );
 }
 
+//! Test the computation of excess velocities of Lambert transfers on a grid of epochs.
+BOOST_AUTO_TEST_CASE( testLambertTransferExcessVelocityGrid )
+{
+    // Set central body graviational parameter and radii of (circular) orbits of departure and arrival body.
+    const double testGravitationalParameter = 1.32712440018e20;
+    const double departureRadius = 1.496e11, arrivalRadius = 2.279e11;
+
+    // Set departure and arrival epochs, and compute states of bodies at these epochs.
+    std::vector< double > departureEpochs, arrivalEpochs;
+    Eigen::Matrix< double, 6, Eigen::Dynamic > departureStates( 6, 5 ), arrivalStates( 6, 7 );
+    for( int i = 0; i < 7; i++ )
+    {
+        if( i < 5 )
+        {
+            departureEpochs.push_back( static_cast< double >( i ) * 1.0E6 );
+            const double meanMotion = std::sqrt( testGravitationalParameter / std::pow( departureRadius, 3.0 ) );
+            const double angle = meanMotion * departureEpochs.back( );
+            departureStates.col( i ) << departureRadius * std::cos( angle ), departureRadius * std::sin( angle ), 0.0,
+                    -departureRadius * meanMotion * std::sin( angle ), departureRadius * meanMotion * std::cos( angle ),
+                    0.0;
+        }
+
+        arrivalEpochs.push_back( 3.0E6 + static_cast< double >( i ) * 3.0E6 );
+        const double meanMotion = std::sqrt( testGravitationalParameter / std::pow( arrivalRadius, 3.0 ) );
+        const double angle = 2.0 + meanMotion * arrivalEpochs.back( );
+        arrivalStates.col( i ) << arrivalRadius * std::cos( angle ), arrivalRadius * std::sin( angle ), 0.0,
+                -arrivalRadius * meanMotion * std::sin( angle ), arrivalRadius * meanMotion * std::cos( angle ), 0.0;
+    }
+
+    // Compute excess velocities on grid.
+    Eigen::MatrixXd departureExcessVelocities, arrivalExcessVelocities;
+    mission_segments::computeLambertTransferExcessVelocityGrid(
+                departureStates, departureEpochs, arrivalStates, arrivalEpochs, testGravitationalParameter,
+                departureExcessVelocities, arrivalExcessVelocities );
+    BOOST_CHECK_EQUAL( departureExcessVelocities.rows( ), 5 );
+    BOOST_CHECK_EQUAL( departureExcessVelocities.cols( ), 7 );
+    BOOST_CHECK_EQUAL( arrivalExcessVelocities.rows( ), 5 );
+    BOOST_CHECK_EQUAL( arrivalExcessVelocities.cols( ), 7 );
+
+    // Compare with Lambert problems solved separately, and check that entries with non-positive time of flight are
+    // not set.
+    Eigen::Vector3d velocityAtDeparture, velocityAtArrival;
+    for( int i = 0; i < 5; i++ )
+    {
+        for( int j = 0; j < 7; j++ )
+        {
+            if( arrivalEpochs.at( j ) <= departureEpochs.at( i ) )
+            {
+                BOOST_CHECK( departureExcessVelocities( i, j ) != departureExcessVelocities( i, j ) );
+                BOOST_CHECK( arrivalExcessVelocities( i, j ) != arrivalExcessVelocities( i, j ) );
+            }
+            else
+            {
+                mission_segments::solveLambertProblemIzzo(
+                            departureStates.block( 0, i, 3, 1 ), arrivalStates.block( 0, j, 3, 1 ),
+                            arrivalEpochs.at( j ) - departureEpochs.at( i ), testGravitationalParameter,
+                            velocityAtDeparture, velocityAtArrival );
+                BOOST_CHECK_CLOSE_FRACTION( departureExcessVelocities( i, j ),
+                                            ( velocityAtDeparture - departureStates.block( 3, i, 3, 1 ) ).norm( ),
+                                            1.0E-15 );
+                BOOST_CHECK_CLOSE_FRACTION( arrivalExcessVelocities( i, j ),
+                                            ( velocityAtArrival - arrivalStates.block( 3, j, 3, 1 ) ).norm( ),
+                                            1.0E-15 );
+            }
+        }
+    }
+
+    // Check that inconsistent input is rejected.
+    departureEpochs.pop_back( );
+    BOOST_CHECK_THROW( mission_segments::computeLambertTransferExcessVelocityGrid(
+                           departureStates, departureEpochs, arrivalStates, arrivalEpochs,
+                           testGravitationalParameter, departureExcessVelocities, arrivalExcessVelocities ),
+                       std::runtime_error );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
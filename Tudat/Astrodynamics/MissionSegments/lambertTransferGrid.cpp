@@ -0,0 +1,81 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <limits>
+#include <stdexcept>
+
+#include "Tudat/Astrodynamics/MissionSegments/lambertRoutines.h"
+#include "Tudat/Astrodynamics/MissionSegments/lambertTransferGrid.h"
+
+namespace tudat
+{
+namespace mission_segments
+{
+
+//! Compute the excess velocities of Lambert transfers for a grid of departure and arrival epochs.
+void computeLambertTransferExcessVelocityGrid(
+        const Eigen::Matrix< double, 6, Eigen::Dynamic >& departureBodyStates,
+        const std::vector< double >& departureEpochs,
+        const Eigen::Matrix< double, 6, Eigen::Dynamic >& arrivalBodyStates,
+        const std::vector< double >& arrivalEpochs,
+        const double gravitationalParameter,
+        Eigen::MatrixXd& departureExcessVelocities,
+        Eigen::MatrixXd& arrivalExcessVelocities,
+        const bool isRetrograde )
+{
+    const int numberOfDepartureEpochs = static_cast< int >( departureEpochs.size( ) );
+    const int numberOfArrivalEpochs = static_cast< int >( arrivalEpochs.size( ) );
+
+    if( departureBodyStates.cols( ) != numberOfDepartureEpochs ||
+            arrivalBodyStates.cols( ) != numberOfArrivalEpochs )
+    {
+        throw std::runtime_error(
+                    "Error when computing Lambert transfer grid, number of states and epochs are inconsistent." );
+    }
+
+    departureExcessVelocities.setConstant(
+                numberOfDepartureEpochs, numberOfArrivalEpochs, std::numeric_limits< double >::quiet_NaN( ) );
+    arrivalExcessVelocities.setConstant(
+                numberOfDepartureEpochs, numberOfArrivalEpochs, std::numeric_limits< double >::quiet_NaN( ) );
+
+    Eigen::Vector3d velocityAtDeparture, velocityAtArrival;
+    for( int i = 0; i < numberOfDepartureEpochs; i++ )
+    {
+        for( int j = 0; j < numberOfArrivalEpochs; j++ )
+        {
+            const double timeOfFlight = arrivalEpochs[ j ] - departureEpochs[ i ];
+            if( !( timeOfFlight > 0.0 ) )
+            {
+                continue;
+            }
+
+            // Solve Lambert problem, leaving excess velocities at NaN if solver does not converge.
+            try
+            {
+                solveLambertProblemIzzo( departureBodyStates.block( 0, i, 3, 1 ),
+                                         arrivalBodyStates.block( 0, j, 3, 1 ),
+                                         timeOfFlight, gravitationalParameter,
+                                         velocityAtDeparture, velocityAtArrival, isRetrograde );
+            }
+            catch( const std::runtime_error& )
+            {
+                continue;
+            }
+
+            departureExcessVelocities( i, j ) =
+                    ( velocityAtDeparture - departureBodyStates.block( 3, i, 3, 1 ) ).norm( );
+            arrivalExcessVelocities( i, j ) =
+                    ( velocityAtArrival - arrivalBodyStates.block( 3, j, 3, 1 ) ).norm( );
+        }
+    }
+}
+
+} // namespace mission_segments
+} // namespace tudat
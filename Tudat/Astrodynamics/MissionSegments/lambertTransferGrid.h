@@ -0,0 +1,60 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_LAMBERT_TRANSFER_GRID_H
+#define TUDAT_LAMBERT_TRANSFER_GRID_H
+
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+namespace mission_segments
+{
+
+//! Compute the excess velocities of Lambert transfers for a grid of departure and arrival epochs.
+/*!
+ * Computes the hyperbolic excess velocities at departure and arrival of zero-revolution Lambert
+ * transfers (solved with Izzo's algorithm) between a departure and an arrival body, for all
+ * combinations of a list of departure epochs and a list of arrival epochs, as used for porkchop
+ * plots and launch window analyses. The states of the bodies at all epochs are provided as input,
+ * so that they can be computed beforehand in a single call (e.g. by
+ * ephemerides::VectorizedApproximatePlanetPositions, or Ephemeris::getCartesianStatesFromEphemeris),
+ * instead of being recomputed for each transfer. For combinations with an arrival epoch that is not
+ * later than the departure epoch, or for which the Lambert solver does not converge, the excess
+ * velocities are set to NaN.
+ * \param departureBodyStates Cartesian states of departure body at departure epochs (one column
+ *          per epoch). [Input]
+ * \param departureEpochs Departure epochs. [Input]
+ * \param arrivalBodyStates Cartesian states of arrival body at arrival epochs (one column per
+ *          epoch). [Input]
+ * \param arrivalEpochs Arrival epochs. [Input]
+ * \param gravitationalParameter Gravitational parameter of the central body. [Input]
+ * \param departureExcessVelocities Magnitude of the excess velocity at departure, with the entry
+ *          for departureEpochs[ i ] and arrivalEpochs[ j ] in row i and column j. [Output]
+ * \param arrivalExcessVelocities Magnitude of the excess velocity at arrival, with the entry
+ *          for departureEpochs[ i ] and arrivalEpochs[ j ] in row i and column j. [Output]
+ * \param isRetrograde Boolean flag to indicate direction of motion. [Input, Optional]
+ */
+void computeLambertTransferExcessVelocityGrid(
+        const Eigen::Matrix< double, 6, Eigen::Dynamic >& departureBodyStates,
+        const std::vector< double >& departureEpochs,
+        const Eigen::Matrix< double, 6, Eigen::Dynamic >& arrivalBodyStates,
+        const std::vector< double >& arrivalEpochs,
+        const double gravitationalParameter,
+        Eigen::MatrixXd& departureExcessVelocities,
+        Eigen::MatrixXd& arrivalExcessVelocities,
+        const bool isRetrograde = false );
+
+} // namespace mission_segments
+} // namespace tudat
+
+#endif // TUDAT_LAMBERT_TRANSFER_GRID_H
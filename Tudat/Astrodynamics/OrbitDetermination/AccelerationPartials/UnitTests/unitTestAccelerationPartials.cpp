@@ -421,6 +421,45 @@ BOOST_AUTO_TEST_CASE( testThirdBodyGravityPartials )
                                        partialWrtEarthGravitationalParameter, std::numeric_limits< double >::epsilon(  ) );
 }
 
+//! Function setting (zero) positions of perturbing bodies in combined third-body acceleration test model.
+void getZeroPerturbingBodyPositions( Eigen::Matrix3Xd& perturbingBodyPositions )
+{
+    perturbingBodyPositions.setZero( );
+}
+
+//! Function setting (unit) gravitational parameters of perturbing bodies in combined third-body acceleration test model.
+void getUnitPerturbingBodyGravitationalParameters( Eigen::VectorXd& gravitationalParameters )
+{
+    gravitationalParameters.setOnes( );
+}
+
+BOOST_AUTO_TEST_CASE( testMultipleThirdBodyGravityPartialRejection )
+{
+    std::vector< std::string > perturbingBodies;
+    perturbingBodies.push_back( "Sun" );
+    perturbingBodies.push_back( "Moon" );
+
+    // Create combined third-body acceleration, for which no analytical partial is available.
+    boost::shared_ptr< MultipleThirdBodyCentralGravityAcceleration > multipleThirdBodyAcceleration =
+            boost::make_shared< MultipleThirdBodyCentralGravityAcceleration >(
+                boost::lambda::constant( Eigen::Vector3d( 1.0, 0.0, 0.0 ) ), &getZeroPerturbingBodyPositions,
+                &getUnitPerturbingBodyGravitationalParameters, perturbingBodies, "Earth" );
+
+    // Check that creation of partial is rejected.
+    bool isExceptionCaught = false;
+    try
+    {
+        createAnalyticalAccelerationPartial(
+                    multipleThirdBodyAcceleration, std::make_pair( "Vehicle", boost::make_shared< Body >( ) ),
+                    std::make_pair( "", boost::shared_ptr< Body >( ) ), NamedBodyMap( ) );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -10,6 +10,7 @@
 
 #define BOOST_TEST_MAIN
 
+#include <algorithm>
 #include <limits>
 
 #include <boost/test/unit_test.hpp>
@@ -596,6 +597,140 @@ BOOST_AUTO_TEST_CASE( test_NonConservativeForceEnvironmentUpdate )
     }
 }
 
+//! Test set up and environment update of combined point-mass third-body acceleration of multiple bodies.
+BOOST_AUTO_TEST_CASE( test_MultipleThirdBodyEnvironmentUpdate )
+{
+    using namespace gravitation;
+
+    // Define gravitational parameters of bodies.
+    std::map< std::string, double > gravitationalParameters;
+    gravitationalParameters[ "Sun" ] = 1.32712440018E20;
+    gravitationalParameters[ "Earth" ] = 3.986004418E14;
+    gravitationalParameters[ "Moon" ] = 4.9028E12;
+    gravitationalParameters[ "Mars" ] = 4.282837E13;
+    gravitationalParameters[ "Venus" ] = 3.24859E14;
+
+    // Create bodies, with (arbitrary) Kepler orbits about the Sun.
+    std::map< std::string, boost::shared_ptr< BodySettings > > bodySettings;
+    std::map< std::string, basic_mathematics::Vector6d > keplerElements;
+    keplerElements[ "Earth" ] = ( basic_mathematics::Vector6d( ) << 1.496E11, 0.0167, 0.0, 1.8, 0.0, 0.3 ).finished( );
+    keplerElements[ "Moon" ] = ( basic_mathematics::Vector6d( ) << 1.4998E11, 0.06, 0.09, 1.2, 0.4, 0.29 ).finished( );
+    keplerElements[ "Mars" ] = ( basic_mathematics::Vector6d( ) << 2.279E11, 0.0934, 0.032, 5.0, 0.86, 2.1 ).finished( );
+    keplerElements[ "Venus" ] = ( basic_mathematics::Vector6d( ) << 1.082E11, 0.0068, 0.059, 0.96, 1.34, 4.2 ).finished( );
+    for( std::map< std::string, double >::const_iterator bodyIterator = gravitationalParameters.begin( );
+         bodyIterator != gravitationalParameters.end( ); bodyIterator++ )
+    {
+        bodySettings[ bodyIterator->first ] = boost::make_shared< BodySettings >( );
+        bodySettings[ bodyIterator->first ]->gravityFieldSettings =
+                boost::make_shared< CentralGravityFieldSettings >( bodyIterator->second );
+        if( bodyIterator->first == "Sun" )
+        {
+            bodySettings[ bodyIterator->first ]->ephemerisSettings = boost::make_shared< ConstantEphemerisSettings >(
+                        basic_mathematics::Vector6d::Zero( ), "SSB", "ECLIPJ2000" );
+        }
+        else
+        {
+            bodySettings[ bodyIterator->first ]->ephemerisSettings = boost::make_shared< KeplerEphemerisSettings >(
+                        keplerElements.at( bodyIterator->first ), 0.0, gravitationalParameters.at( "Sun" ),
+                        "SSB", "ECLIPJ2000" );
+        }
+    }
+    bodySettings[ "Vehicle" ] = boost::make_shared< BodySettings >( );
+    bodySettings[ "Vehicle" ]->ephemerisSettings =
+            boost::make_shared< KeplerEphemerisSettings >(
+                ( basic_mathematics::Vector6d( ) << 7000.0E3, 0.05, 0.3, 0.0, 0.0, 0.0 ).finished( ),
+                0.0, gravitationalParameters.at( "Earth" ), "Earth", "ECLIPJ2000" );
+    NamedBodyMap bodyMap = createBodies( bodySettings );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    // Define test time and state.
+    double testTime = 2.0 * 86400.0;
+    std::unordered_map< IntegratedStateType, Eigen::VectorXd > integratedStateToSet;
+    Eigen::VectorXd testState = 1.1 * bodyMap[ "Vehicle" ]->getEphemeris( )->getCartesianStateFromEphemeris( testTime ) +
+            bodyMap.at( "Earth" )->getEphemeris( )->getCartesianStateFromEphemeris( testTime );
+    integratedStateToSet[ transational_state ] = testState;
+
+    // Define accelerations, with combined third-body acceleration of Sun, Moon and Mars (but not Venus).
+    std::vector< std::string > perturbingBodies = boost::assign::list_of( "Sun" )( "Moon" )( "Mars" );
+    SelectedAccelerationMap accelerationSettingsMap;
+    accelerationSettingsMap[ "Vehicle" ][ "Earth" ].push_back(
+                boost::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationSettingsMap[ "Vehicle" ][ "Earth" ].push_back(
+                boost::make_shared< MultipleThirdBodyAccelerationSettings >( perturbingBodies ) );
+
+    // Define origin of integration
+    std::map< std::string, std::string > centralBodies;
+    centralBodies[ "Vehicle" ] = "Earth";
+    std::vector< std::string > propagatedBodyList;
+    propagatedBodyList.push_back( "Vehicle" );
+    std::vector< std::string > centralBodyList;
+    centralBodyList.push_back( centralBodies[ "Vehicle" ] );
+
+    // Create accelerations, and retrieve combined third-body acceleration.
+    AccelerationMap accelerationsMap = createAccelerationModelsMap(
+                bodyMap, accelerationSettingsMap, centralBodies );
+    BOOST_CHECK_EQUAL( accelerationsMap.at( "Vehicle" ).at( "Earth" ).size( ), 2 );
+    boost::shared_ptr< MultipleThirdBodyCentralGravityAcceleration > multipleThirdBodyAcceleration =
+            boost::dynamic_pointer_cast< MultipleThirdBodyCentralGravityAcceleration >(
+                accelerationsMap.at( "Vehicle" ).at( "Earth" ).at( 1 ) );
+    BOOST_CHECK( multipleThirdBodyAcceleration != NULL );
+    BOOST_CHECK_EQUAL( multipleThirdBodyAcceleration->getCentralBodyName( ), "Earth" );
+    BOOST_CHECK_EQUAL( multipleThirdBodyAcceleration->getPerturbingBodyNames( ).size( ), 3 );
+
+    // Create environment update settings, and check that Earth, Sun, Moon and Mars (but not Venus) are updated.
+    boost::shared_ptr< PropagatorSettings< double > > propagatorSettings =
+            boost::make_shared< TranslationalStatePropagatorSettings< double > >(
+                centralBodyList, accelerationsMap, propagatedBodyList, getInitialStateOfBody(
+                    "Vehicle", centralBodies[ "Vehicle" ], bodyMap, 0.0 ), 10.0 * 86400.0 );
+    std::map< propagators::EnvironmentModelsToUpdate, std::vector< std::string > > environmentModelsToUpdate =
+            createEnvironmentUpdaterSettings< double >( propagatorSettings, bodyMap );
+
+    BOOST_CHECK_EQUAL( environmentModelsToUpdate.size( ), 1 );
+    BOOST_CHECK_EQUAL( environmentModelsToUpdate.count( body_transational_state_update ), 1 );
+    std::vector< std::string > updatedBodies = environmentModelsToUpdate.at( body_transational_state_update );
+    std::sort( updatedBodies.begin( ), updatedBodies.end( ) );
+    updatedBodies.erase( std::unique( updatedBodies.begin( ), updatedBodies.end( ) ), updatedBodies.end( ) );
+    std::vector< std::string > expectedUpdatedBodies = boost::assign::list_of( "Earth" )( "Mars" )( "Moon" )( "Sun" );
+    BOOST_CHECK_EQUAL_COLLECTIONS( updatedBodies.begin( ), updatedBodies.end( ),
+                                   expectedUpdatedBodies.begin( ), expectedUpdatedBodies.end( ) );
+
+    // Create and call updater.
+    boost::shared_ptr< propagators::EnvironmentUpdater< double, double > > updater =
+            createEnvironmentUpdaterForDynamicalEquations< double, double >(
+                propagatorSettings, bodyMap );
+    updater->updateEnvironment( testTime, integratedStateToSet );
+
+    for( unsigned int i = 0; i < expectedUpdatedBodies.size( ); i++ )
+    {
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    bodyMap.at( expectedUpdatedBodies.at( i ) )->getState( ),
+                    bodyMap.at( expectedUpdatedBodies.at( i ) )->getEphemeris( )->getCartesianStateFromEphemeris(
+                        testTime ), std::numeric_limits< double >::epsilon( ) );
+    }
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                bodyMap.at( "Vehicle" )->getState( ), testState,
+                std::numeric_limits< double >::epsilon( ) );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                bodyMap.at( "Venus" )->getState( ), basic_mathematics::Vector6d::Zero( ),
+                std::numeric_limits< double >::epsilon( ) );
+
+    // Compute acceleration from updated environment, and compare with separate third-body accelerations.
+    multipleThirdBodyAcceleration->updateMembers( testTime );
+    Eigen::Vector3d expectedAcceleration = Eigen::Vector3d::Zero( );
+    for( unsigned int i = 0; i < perturbingBodies.size( ); i++ )
+    {
+        expectedAcceleration += computeThirdBodyPerturbingAcceleration(
+                    gravitationalParameters.at( perturbingBodies.at( i ) ),
+                    bodyMap.at( perturbingBodies.at( i ) )->getPosition( ),
+                    bodyMap.at( "Vehicle" )->getPosition( ), bodyMap.at( "Earth" )->getPosition( ) );
+    }
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        BOOST_CHECK_SMALL( multipleThirdBodyAcceleration->getAcceleration( )( i ) - expectedAcceleration( i ),
+                           1.0E-8 * expectedAcceleration.norm( ) );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
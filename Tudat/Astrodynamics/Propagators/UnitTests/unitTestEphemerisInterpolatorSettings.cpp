@@ -0,0 +1,171 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include <Tudat/Basics/testMacros.h>
+#include <Tudat/Astrodynamics/BasicAstrodynamics/keplerPropagator.h>
+#include <Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h>
+#include <Tudat/Astrodynamics/BasicAstrodynamics/unitConversions.h>
+#include <Tudat/Astrodynamics/BasicAstrodynamics/stateVectorIndices.h>
+#include <Tudat/Mathematics/BasicMathematics/linearAlgebraTypes.h>
+#include <Tudat/Mathematics/Interpolators/createInterpolator.h>
+#include <Tudat/Mathematics/Interpolators/hermiteInterpolator.h>
+
+#include "Tudat/SimulationSetup/PropagationSetup/dynamicsSimulator.h"
+#include <Tudat/SimulationSetup/EnvironmentSetup/body.h>
+#include <Tudat/SimulationSetup/EnvironmentSetup/createBodies.h>
+#include "Tudat/SimulationSetup/PropagationSetup/createNumericalSimulator.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace tudat::propagators;
+using namespace tudat::simulation_setup;
+using namespace tudat::numerical_integrators;
+
+BOOST_AUTO_TEST_SUITE( test_ephemeris_interpolator_settings )
+
+// Test whether the ephemeris interpolator settings of the translational propagator are used when resetting the
+// ephemeris of a propagated body from the numerical solution.
+BOOST_AUTO_TEST_CASE( testHermiteEphemerisInterpolatorSettings )
+{
+    using namespace basic_astrodynamics;
+    using namespace orbital_element_conversions;
+    using namespace basic_mathematics;
+    using namespace unit_conversions;
+
+    // Set simulation end epoch and numerical integration fixed step size.
+    const double simulationEndEpoch = 3.0 * 3600.0;
+    const double fixedStepSize = 30.0;
+
+    // Define body settings for simulation.
+    const double earthGravitationalParameter = 3.986004418E14;
+    std::map< std::string, boost::shared_ptr< BodySettings > > bodySettings;
+    bodySettings[ "Earth" ] = boost::make_shared< BodySettings >( );
+    bodySettings[ "Earth" ]->ephemerisSettings = boost::make_shared< ConstantEphemerisSettings >(
+                basic_mathematics::Vector6d::Zero( ), "SSB", "J2000" );
+    bodySettings[ "Earth" ]->gravityFieldSettings = boost::make_shared< CentralGravityFieldSettings >(
+                earthGravitationalParameter );
+
+    // Create Earth object
+    NamedBodyMap bodyMap = createBodies( bodySettings );
+
+    // Create spacecraft object.
+    bodyMap[ "Asterix" ] = boost::make_shared< simulation_setup::Body >( );
+    bodyMap[ "Asterix" ]->setEphemeris( boost::make_shared< ephemerides::TabulatedCartesianEphemeris< > >(
+                                            boost::shared_ptr< interpolators::OneDimensionalInterpolator
+                                            < double, Vector6d  > >( ), "Earth", "J2000" ) );
+
+    // Finalize body creation.
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "J2000" );
+
+    // Define propagation settings.
+    SelectedAccelerationMap accelerationMap;
+    std::vector< std::string > bodiesToPropagate;
+    std::vector< std::string > centralBodies;
+    accelerationMap[ "Asterix" ][ "Earth" ].push_back( boost::make_shared< AccelerationSettings >(
+                                                            basic_astrodynamics::central_gravity ) );
+    bodiesToPropagate.push_back( "Asterix" );
+    centralBodies.push_back( "Earth" );
+
+    // Create acceleration models.
+    basic_astrodynamics::AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationMap, bodiesToPropagate, centralBodies );
+
+    // Set Keplerian elements for Asterix, and convert to Cartesian elements.
+    Vector6d asterixInitialStateInKeplerianElements;
+    asterixInitialStateInKeplerianElements( semiMajorAxisIndex ) = 7500.0E3;
+    asterixInitialStateInKeplerianElements( eccentricityIndex ) = 0.1;
+    asterixInitialStateInKeplerianElements( inclinationIndex ) = convertDegreesToRadians( 85.3 );
+    asterixInitialStateInKeplerianElements( argumentOfPeriapsisIndex )
+            = convertDegreesToRadians( 235.7 );
+    asterixInitialStateInKeplerianElements( longitudeOfAscendingNodeIndex )
+            = convertDegreesToRadians( 23.4 );
+    asterixInitialStateInKeplerianElements( trueAnomalyIndex ) = convertDegreesToRadians( 139.87 );
+    Eigen::VectorXd systemInitialState = convertKeplerianToCartesianElements(
+                asterixInitialStateInKeplerianElements, earthGravitationalParameter );
+
+    // Create propagator settings, with Hermite interpolation of the resulting ephemeris.
+    boost::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            boost::make_shared< TranslationalStatePropagatorSettings< double > >
+            ( centralBodies, accelerationModelMap, bodiesToPropagate, systemInitialState,
+              boost::make_shared< PropagationTimeTerminationSettings >( simulationEndEpoch ) );
+    propagatorSettings->ephemerisInterpolatorSettings_ =
+            boost::make_shared< interpolators::HermiteInterpolatorSettings >( 4 );
+
+    boost::shared_ptr< IntegratorSettings< > > integratorSettings =
+            boost::make_shared< IntegratorSettings< > >( rungeKutta4, 0.0, fixedStepSize );
+
+    // Create simulation object and propagate dynamics.
+    SingleArcDynamicsSimulator< > dynamicsSimulator(
+                bodyMap, integratorSettings, propagatorSettings, true, false, true );
+    std::map< double, Eigen::VectorXd > integratedState =
+            dynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+
+    // Check that the ephemeris of Asterix is now interpolated by a Hermite interpolator.
+    boost::shared_ptr< ephemerides::TabulatedCartesianEphemeris< > > asterixEphemeris =
+            boost::dynamic_pointer_cast< ephemerides::TabulatedCartesianEphemeris< > >(
+                bodyMap.at( "Asterix" )->getEphemeris( ) );
+    BOOST_CHECK( asterixEphemeris != NULL );
+    typedef interpolators::HermiteStateInterpolator< double, double > HermiteStateInterpolatorType;
+    BOOST_CHECK( boost::dynamic_pointer_cast< HermiteStateInterpolatorType >(
+                     asterixEphemeris->getInterpolator( ) ) != NULL );
+
+    // Check that the ephemeris reproduces the integrated states at the integration epochs.
+    double maximumIntegrationError = 0.0;
+    for( std::map< double, Eigen::VectorXd >::const_iterator stateIterator = integratedState.begin( );
+         stateIterator != integratedState.end( ); stateIterator++ )
+    {
+        Vector6d ephemerisState = asterixEphemeris->getCartesianStateFromEphemeris( stateIterator->first );
+        for( int i = 0; i < 3; i++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( ephemerisState( i ) - stateIterator->second( i ) ), 1.0E-6 );
+            BOOST_CHECK_SMALL( std::fabs( ephemerisState( i + 3 ) - stateIterator->second( i + 3 ) ), 1.0E-9 );
+        }
+
+        // Determine error of numerical solution w.r.t. analytical Kepler orbit.
+        Vector6d keplerState = convertKeplerianToCartesianElements(
+                    propagateKeplerOrbit( asterixInitialStateInKeplerianElements, stateIterator->first,
+                                          earthGravitationalParameter ), earthGravitationalParameter );
+        maximumIntegrationError = std::max(
+                    maximumIntegrationError,
+                    ( keplerState.segment( 0, 3 ) - stateIterator->second.segment( 0, 3 ) ).norm( ) );
+    }
+
+    // Check that the ephemeris between the integration epochs agrees with the analytical Kepler orbit to within the
+    // numerical integration error (plus a margin for the interpolation error).
+    for( std::map< double, Eigen::VectorXd >::const_iterator stateIterator = integratedState.begin( );
+         stateIterator != --integratedState.end( ); stateIterator++ )
+    {
+        double currentTime = stateIterator->first + fixedStepSize / 2.0;
+        Vector6d ephemerisState = asterixEphemeris->getCartesianStateFromEphemeris( currentTime );
+        Vector6d keplerState = convertKeplerianToCartesianElements(
+                    propagateKeplerOrbit( asterixInitialStateInKeplerianElements, currentTime,
+                                          earthGravitationalParameter ), earthGravitationalParameter );
+        BOOST_CHECK_SMALL( ( ephemerisState.segment( 0, 3 ) - keplerState.segment( 0, 3 ) ).norm( ),
+                           maximumIntegrationError + 1.0E-3 );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -23,14 +23,16 @@ Eigen::MatrixXd SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::g
 {
     combinedStateTransitionMatrix_.setZero( );
 
-    // Set Phi and S matrices.
+    // Set Phi and S matrices (interpolated by reference, so that the memory of the matrices is reused).
+    stateTransitionMatrixInterpolator_->interpolate( evaluationTime, interpolatedStateTransitionMatrix_ );
     combinedStateTransitionMatrix_.block( 0, 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_ ) =
-            stateTransitionMatrixInterpolator_->interpolate( evaluationTime );
+            interpolatedStateTransitionMatrix_;
 
     if( sensitivityMatrixSize_ > 0 )
     {
+        sensitivityMatrixInterpolator_->interpolate( evaluationTime, interpolatedSensitivityMatrix_ );
         combinedStateTransitionMatrix_.block( 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_, sensitivityMatrixSize_ ) =
-                sensitivityMatrixInterpolator_->interpolate( evaluationTime );
+                interpolatedSensitivityMatrix_;
     }
 
     return combinedStateTransitionMatrix_;
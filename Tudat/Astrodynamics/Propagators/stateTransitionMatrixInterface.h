@@ -202,6 +202,12 @@ private:
     //! Predefined matrix to use as return value when calling getCombinedStateTransitionAndSensitivityMatrix.
     Eigen::MatrixXd combinedStateTransitionMatrix_;
 
+    //! Predefined matrix in which the state transition matrix is interpolated (reused between calls).
+    Eigen::MatrixXd interpolatedStateTransitionMatrix_;
+
+    //! Predefined matrix in which the sensitivity matrix is interpolated (reused between calls).
+    Eigen::MatrixXd interpolatedSensitivityMatrix_;
+
     //! Interpolator returning the state transition matrix as a function of time.
     boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >
     stateTransitionMatrixInterpolator_;
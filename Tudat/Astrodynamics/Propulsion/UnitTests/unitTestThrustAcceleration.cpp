@@ -860,6 +860,73 @@ BOOST_AUTO_TEST_CASE( testInterpolatedThrustVector )
 
 }
 
+//! Function returning (arbitrary) thrust magnitude as a function of time, used as source of tabulated thrust.
+double getSourceThrustMagnitude( const double time )
+{
+    return 1000.0 + 200.0 * std::sin( time / 100.0 ) + 50.0 * std::cos( time / 23.0 );
+}
+
+//! Function returning (arbitrary) specific impulse as a function of time, used as source of tabulated thrust.
+double getSourceSpecificImpulse( const double time )
+{
+    return 300.0 + 10.0 * std::cos( time / 70.0 );
+}
+
+//! Function returning whether engine is on, used as source of tabulated thrust.
+bool getIsSourceEngineOn( const double time )
+{
+    return ( time < 2000.0 );
+}
+
+//! Test adaptively tabulated thrust magnitude and specific impulse w.r.t. source functions.
+BOOST_AUTO_TEST_CASE( testAdaptivelyTabulatedThrust )
+{
+    using namespace tudat::simulation_setup;
+    using namespace tudat::interpolators;
+
+    const Eigen::Vector3d thrustDirection = Eigen::Vector3d( 0.6, 0.0, -0.8 );
+    boost::shared_ptr< FromFunctionThrustEngineSettings > sourceThrustSettings =
+            boost::make_shared< FromFunctionThrustEngineSettings >(
+                &getSourceThrustMagnitude, &getSourceSpecificImpulse, &getIsSourceEngineOn, thrustDirection );
+
+    const double startTime = 0.0;
+    const double endTime = 3000.0;
+    std::vector< boost::shared_ptr< InterpolatorSettings > > interpolatorSettings;
+    interpolatorSettings.push_back( boost::make_shared< InterpolatorSettings >( linear_interpolator ) );
+    interpolatorSettings.push_back( boost::make_shared< InterpolatorSettings >( cubic_spline_interpolator ) );
+    std::vector< double > relativeErrorTolerances;
+    relativeErrorTolerances.push_back( 1.0E-6 );
+    relativeErrorTolerances.push_back( 1.0E-9 );
+
+    for( unsigned int i = 0; i < interpolatorSettings.size( ); i++ )
+    {
+        // Create tabulated thrust settings.
+        boost::shared_ptr< FromFunctionThrustEngineSettings > tabulatedThrustSettings =
+                createAdaptivelyTabulatedThrustEngineSettings(
+                    sourceThrustSettings, startTime, endTime, 100.0, interpolatorSettings.at( i ),
+                    boost::make_shared< AdaptiveTabulationSettings >( relativeErrorTolerances.at( i ) ) );
+
+        // Check that settings other than thrust magnitude and specific impulse are copied.
+        BOOST_CHECK_EQUAL( tabulatedThrustSettings->bodyFixedThrustDirection_, thrustDirection );
+        BOOST_CHECK_EQUAL( tabulatedThrustSettings->isEngineOnFunction_( 1000.0 ), true );
+        BOOST_CHECK_EQUAL( tabulatedThrustSettings->isEngineOnFunction_( 2500.0 ), false );
+
+        // Check tabulated thrust magnitude and specific impulse w.r.t. source functions, on a grid that does not
+        // coincide with the tabulation nodes (interpolation error is only controlled at midpoints of tabulation
+        // intervals, so a margin is used).
+        for( unsigned int j = 0; j <= 10000; j++ )
+        {
+            const double currentTime = startTime + ( endTime - startTime ) * static_cast< double >( j ) / 10000.0;
+            BOOST_CHECK_CLOSE_FRACTION( tabulatedThrustSettings->thrustMagnitudeFunction_( currentTime ),
+                                        getSourceThrustMagnitude( currentTime ),
+                                        2.0 * relativeErrorTolerances.at( i ) );
+            BOOST_CHECK_CLOSE_FRACTION( tabulatedThrustSettings->specificImpulseFunction_( currentTime ),
+                                        getSourceSpecificImpulse( currentTime ),
+                                        2.0 * relativeErrorTolerances.at( i ) );
+        }
+    }
+}
+
 
 BOOST_AUTO_TEST_SUITE_END( )
 
@@ -0,0 +1,121 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      IAU SOFA Board, IAU SOFA Software Collection, http://www.iausofa.org (reference values computed with the
+ *        routines nut00a, pnm06a, s06, c2ixys, era00 and pom00).
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/ReferenceFrames/earthOrientationCalculations.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace reference_frames;
+
+BOOST_AUTO_TEST_SUITE( test_earth_orientation_calculations )
+
+// Test precession-nutation quantities against Sofa.
+BOOST_AUTO_TEST_CASE( testPrecessionNutationAgainstSofa )
+{
+    const double testCenturies[ 2 ] = { -0.17, 0.2345 };
+
+    // Nutation in longitude and obliquity (nut00a).
+    Eigen::Vector2d sofaNutationAngles[ 2 ];
+    sofaNutationAngles[ 0 ] << -7.9809715218422513e-05, -5.4356829548307268e-06;
+    sofaNutationAngles[ 1 ] << -4.4787366528601717e-05, 3.5370136015208043e-05;
+
+    // Bias-precession-nutation matrix (pnm06a).
+    Eigen::Matrix3d sofaBiasPrecessionNutationMatrices[ 2 ];
+    sofaBiasPrecessionNutationMatrices[ 0 ] <<
+            0.99999107777126139, 0.0038742109033478977, 0.0016837065502829424,
+            -0.0038742200748803964, 0.99999249517885591, 2.1857221562671114e-06,
+            -0.0016836854464178138, -8.7087523720219551e-06, 0.99999858256273311;
+    sofaBiasPrecessionNutationMatrices[ 1 ] <<
+            0.99998391016387744, -0.005202831418702634, -0.0022605217518628169,
+            0.0052027516018361593, 0.99998646474805231, -4.1188125247726415e-05,
+            0.0022607054500034893, 2.9426529372100774e-05, 0.99999744416920766;
+
+    // CIO locator (s06).
+    const double sofaCelestialOriginLocators[ 2 ] = { -2.0952587726087243e-08, -3.9911499443313569e-08 };
+
+    // Celestial-to-intermediate matrix (c2ixys).
+    Eigen::Matrix3d sofaCelestialToIntermediateMatrices[ 2 ];
+    sofaCelestialToIntermediateMatrices[ 0 ] <<
+            0.99999858260065377, 1.3621182655756958e-08, 0.0016836854466002842,
+            -2.828396297466923e-08, 0.99999999996207867, 8.7087170944554053e-06,
+            -0.0016836854464178136, -8.7087523720223227e-06, 0.999998582562733;
+    sofaCelestialToIntermediateMatrices[ 1 ] <<
+            0.99999744460216644, 6.6490992572942886e-09, -0.0022607054511779448,
+            -7.3173797623601877e-08, 0.99999999956703978, -2.9426439143956444e-05,
+            0.0022607054500034893, 2.9426529372100774e-05, 0.99999744416920766;
+
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        // Check nutation angles (1 microarcsecond is roughly 5E-12 rad).
+        const Eigen::Vector2d nutationAngles = calculateIau2000aNutationAngles( testCenturies[ i ] );
+        BOOST_CHECK_SMALL( ( nutationAngles - sofaNutationAngles[ i ] ).norm( ), 1.0E-15 );
+
+        // Check bias-precession-nutation matrix and pole position.
+        const Eigen::Matrix3d biasPrecessionNutationMatrix =
+                calculateIau2006BiasPrecessionNutationMatrix( testCenturies[ i ] );
+        BOOST_CHECK_SMALL( ( biasPrecessionNutationMatrix - sofaBiasPrecessionNutationMatrices[ i ] ).norm( ),
+                           1.0E-15 );
+
+        const Eigen::Vector2d celestialPolePosition = calculateCelestialIntermediatePolePosition( testCenturies[ i ] );
+        BOOST_CHECK_SMALL( celestialPolePosition( 0 ) - sofaBiasPrecessionNutationMatrices[ i ]( 2, 0 ), 1.0E-15 );
+        BOOST_CHECK_SMALL( celestialPolePosition( 1 ) - sofaBiasPrecessionNutationMatrices[ i ]( 2, 1 ), 1.0E-15 );
+
+        // Check CIO locator and celestial-to-intermediate matrix.
+        const double celestialOriginLocator = calculateCelestialIntermediateOriginLocator(
+                    testCenturies[ i ], celestialPolePosition( 0 ), celestialPolePosition( 1 ) );
+        BOOST_CHECK_SMALL( celestialOriginLocator - sofaCelestialOriginLocators[ i ], 1.0E-17 );
+
+        const Eigen::Matrix3d celestialToIntermediateMatrix = calculateCelestialToIntermediateRotationMatrix(
+                    celestialPolePosition( 0 ), celestialPolePosition( 1 ), celestialOriginLocator );
+        BOOST_CHECK_SMALL( ( celestialToIntermediateMatrix - sofaCelestialToIntermediateMatrices[ i ] ).norm( ),
+                           1.0E-15 );
+    }
+}
+
+// Test Earth rotation angle and polar motion matrix against Sofa.
+BOOST_AUTO_TEST_CASE( testEarthRotationAndPolarMotionAgainstSofa )
+{
+    // Check Earth rotation angle (era00).
+    BOOST_CHECK_SMALL( calculateEarthRotationAngle( -1.23456789E8 ) - 6.0882960940956998, 1.0E-11 );
+    BOOST_CHECK_SMALL( calculateEarthRotationAngle( 43200.0 ) - 1.7619696490215855, 1.0E-14 );
+
+    // Check rate of Earth rotation angle.
+    const double timeStep = 100.0;
+    BOOST_CHECK_CLOSE_FRACTION( ( calculateEarthRotationAngle( 1.0E7 + timeStep ) -
+                                  calculateEarthRotationAngle( 1.0E7 ) ) / timeStep,
+                                EARTH_ROTATION_ANGLE_RATE, 1.0E-9 );
+
+    // Check polar motion matrix (pom00).
+    Eigen::Matrix3d sofaPolarMotionMatrix;
+    sofaPolarMotionMatrix << 0.99999999999949996, -2.9999999999984997e-10, 9.999999999998333e-07,
+            3.0199999999939837e-10, 0.99999999999800004, -1.9999999999976668e-06,
+            -9.9999999939783322e-07, 2.0000000002986667e-06, 0.9999999999975;
+    BOOST_CHECK_SMALL( ( calculatePolarMotionRotationMatrix( 1.0E-6, 2.0E-6, -3.0E-10 ) -
+                         sofaPolarMotionMatrix ).norm( ), 1.0E-16 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
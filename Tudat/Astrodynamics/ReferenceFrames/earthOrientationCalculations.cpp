@@ -0,0 +1,427 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Petit, G., Luzum, B. (eds.), IERS Conventions (2010), IERS Technical Note 36, 2010.
+ *      Wallace, P.T., Capitaine, N., Precession-nutation procedures consistent with IAU 2006 resolutions, Astronomy
+ *        and Astrophysics, 459, 981-985, 2006.
+ */
+
+#include <cmath>
+
+#include <Eigen/Geometry>
+
+#include "Tudat/Astrodynamics/ReferenceFrames/earthOrientationCalculations.h"
+#include "Tudat/Astrodynamics/ReferenceFrames/iau2000aNutationSeries.h"
+
+namespace tudat
+{
+
+namespace reference_frames
+{
+
+//! Conversion factor from arcseconds to radians.
+static const double ARCSECONDS_TO_RADIANS = mathematical_constants::PI / ( 180.0 * 3600.0 );
+
+//! Number of arcseconds in a full circle.
+static const double ARCSECONDS_IN_FULL_CIRCLE = 1296000.0;
+
+//! Precomputed argument multipliers and coefficients of the IAU 2000A nutation series.
+/*!
+ *  Precomputed argument multipliers and coefficients of the IAU 2000A nutation series, stored as matrices so that the
+ *  arguments (and coefficients) of all terms are evaluated by a single matrix-vector product. The argument multipliers
+ *  of both the luni-solar and planetary terms multiply the full vector of fundamental arguments, as computed by
+ *  calculateFundamentalArguments. Coefficients are converted to radians.
+ */
+struct Iau2000aNutationSeriesTables
+{
+    //! Constructor, fills matrices from the IAU 2000A nutation series terms.
+    Iau2000aNutationSeriesTables( ):
+        luniSolarArgumentMultipliers( Eigen::MatrixXd::Zero( NUMBER_OF_IAU_2000A_LUNI_SOLAR_NUTATION_TERMS, 5 ) ),
+        luniSolarCoefficients( NUMBER_OF_IAU_2000A_LUNI_SOLAR_NUTATION_TERMS, 6 ),
+        planetaryArgumentMultipliers( Eigen::MatrixXd::Zero( NUMBER_OF_IAU_2000A_PLANETARY_NUTATION_TERMS, 14 ) ),
+        planetaryCoefficients( NUMBER_OF_IAU_2000A_PLANETARY_NUTATION_TERMS, 4 )
+    {
+        // Series coefficients are given in units of 0.1 microarcseconds.
+        const double coefficientToRadians = ARCSECONDS_TO_RADIANS * 1.0E-7;
+
+        for( int i = 0; i < NUMBER_OF_IAU_2000A_LUNI_SOLAR_NUTATION_TERMS; i++ )
+        {
+            const Iau2000aLuniSolarNutationTerm& currentTerm = IAU_2000A_LUNI_SOLAR_NUTATION_TERMS[ i ];
+            for( int j = 0; j < 5; j++ )
+            {
+                luniSolarArgumentMultipliers( i, j ) = static_cast< double >( currentTerm.argumentMultipliers[ j ] );
+            }
+            luniSolarCoefficients.row( i ) << currentTerm.longitudeSineCoefficient,
+                    currentTerm.longitudeSineRateCoefficient, currentTerm.longitudeCosineCoefficient,
+                    currentTerm.obliquityCosineCoefficient, currentTerm.obliquityCosineRateCoefficient,
+                    currentTerm.obliquitySineCoefficient;
+        }
+        luniSolarCoefficients *= coefficientToRadians;
+
+        for( int i = 0; i < NUMBER_OF_IAU_2000A_PLANETARY_NUTATION_TERMS; i++ )
+        {
+            const Iau2000aPlanetaryNutationTerm& currentTerm = IAU_2000A_PLANETARY_NUTATION_TERMS[ i ];
+
+            // Planetary terms have no dependency on l' (second fundamental argument).
+            planetaryArgumentMultipliers( i, 0 ) = static_cast< double >( currentTerm.argumentMultipliers[ 0 ] );
+            for( int j = 1; j < 13; j++ )
+            {
+                planetaryArgumentMultipliers( i, j + 1 ) =
+                        static_cast< double >( currentTerm.argumentMultipliers[ j ] );
+            }
+            planetaryCoefficients.row( i ) << currentTerm.longitudeSineCoefficient,
+                    currentTerm.longitudeCosineCoefficient, currentTerm.obliquitySineCoefficient,
+                    currentTerm.obliquityCosineCoefficient;
+        }
+        planetaryCoefficients *= coefficientToRadians;
+    }
+
+    //! Multipliers of Delaunay arguments for luni-solar terms.
+    Eigen::MatrixXd luniSolarArgumentMultipliers;
+
+    //! Coefficients of luni-solar terms (columns as in Iau2000aLuniSolarNutationTerm).
+    Eigen::MatrixXd luniSolarCoefficients;
+
+    //! Multipliers of fundamental arguments for planetary terms.
+    Eigen::MatrixXd planetaryArgumentMultipliers;
+
+    //! Coefficients of planetary terms (columns as in Iau2000aPlanetaryNutationTerm).
+    Eigen::MatrixXd planetaryCoefficients;
+};
+
+//! Function to retrieve the (single) precomputed IAU 2000A nutation series tables.
+static const Iau2000aNutationSeriesTables& getIau2000aNutationSeriesTables( )
+{
+    static const Iau2000aNutationSeriesTables nutationSeriesTables;
+    return nutationSeriesTables;
+}
+
+//! Single term of the series for the CIO locator (IERS Conventions 2010, table 5.2d).
+struct CelestialOriginLocatorTerm
+{
+    //! Multipliers of l, l', F, D, Omega, mean longitudes of Venus and Earth, and general precession in longitude.
+    int argumentMultipliers[ 8 ];
+
+    //! Coefficient of sine of argument (microarcseconds).
+    double sineCoefficient;
+
+    //! Coefficient of cosine of argument (microarcseconds).
+    double cosineCoefficient;
+};
+
+//! Polynomial part of s + XY/2 (microarcseconds, per power of Julian centuries).
+static const double CELESTIAL_ORIGIN_LOCATOR_POLYNOMIAL[ 6 ] =
+{ 94.00, 3808.65, -122.68, -72574.11, 27.98, 15.62 };
+
+//! Number of terms in the series for s + XY/2, for each power of time (0 to 4).
+static const int NUMBER_OF_CELESTIAL_ORIGIN_LOCATOR_TERMS[ 5 ] = { 33, 3, 25, 4, 1 };
+
+//! Terms of the series for s + XY/2, ordered by power of time (0 to 4).
+static const CelestialOriginLocatorTerm CELESTIAL_ORIGIN_LOCATOR_TERMS[ 66 ] =
+{
+    // Terms of order t^0.
+    { { 0, 0, 0, 0, 1, 0, 0, 0 }, -2640.73, 0.39 },
+    { { 0, 0, 0, 0, 2, 0, 0, 0 }, -63.53, 0.02 },
+    { { 0, 0, 2, -2, 3, 0, 0, 0 }, -11.75, -0.01 },
+    { { 0, 0, 2, -2, 1, 0, 0, 0 }, -11.21, -0.01 },
+    { { 0, 0, 2, -2, 2, 0, 0, 0 }, 4.57, 0.00 },
+    { { 0, 0, 2, 0, 3, 0, 0, 0 }, -2.02, 0.00 },
+    { { 0, 0, 2, 0, 1, 0, 0, 0 }, -1.98, 0.00 },
+    { { 0, 0, 0, 0, 3, 0, 0, 0 }, 1.72, 0.00 },
+    { { 0, 1, 0, 0, 1, 0, 0, 0 }, 1.41, 0.01 },
+    { { 0, 1, 0, 0, -1, 0, 0, 0 }, 1.26, 0.01 },
+    { { 1, 0, 0, 0, -1, 0, 0, 0 }, 0.63, 0.00 },
+    { { 1, 0, 0, 0, 1, 0, 0, 0 }, 0.63, 0.00 },
+    { { 0, 1, 2, -2, 3, 0, 0, 0 }, -0.46, 0.00 },
+    { { 0, 1, 2, -2, 1, 0, 0, 0 }, -0.45, 0.00 },
+    { { 0, 0, 4, -4, 4, 0, 0, 0 }, -0.36, 0.00 },
+    { { 0, 0, 1, -1, 1, -8, 12, 0 }, 0.24, 0.12 },
+    { { 0, 0, 2, 0, 0, 0, 0, 0 }, -0.32, 0.00 },
+    { { 0, 0, 2, 0, 2, 0, 0, 0 }, -0.28, 0.00 },
+    { { 1, 0, 2, 0, 3, 0, 0, 0 }, -0.27, 0.00 },
+    { { 1, 0, 2, 0, 1, 0, 0, 0 }, -0.26, 0.00 },
+    { { 0, 0, 2, -2, 0, 0, 0, 0 }, 0.21, 0.00 },
+    { { 0, 1, -2, 2, -3, 0, 0, 0 }, -0.19, 0.00 },
+    { { 0, 1, -2, 2, -1, 0, 0, 0 }, -0.18, 0.00 },
+    { { 0, 0, 0, 0, 0, 8, -13, -1 }, 0.10, -0.05 },
+    { { 0, 0, 0, 2, 0, 0, 0, 0 }, -0.15, 0.00 },
+    { { 2, 0, -2, 0, -1, 0, 0, 0 }, 0.14, 0.00 },
+    { { 0, 1, 2, -2, 2, 0, 0, 0 }, 0.14, 0.00 },
+    { { 1, 0, 0, -2, 1, 0, 0, 0 }, -0.14, 0.00 },
+    { { 1, 0, 0, -2, -1, 0, 0, 0 }, -0.14, 0.00 },
+    { { 0, 0, 4, -2, 4, 0, 0, 0 }, -0.13, 0.00 },
+    { { 0, 0, 2, -2, 4, 0, 0, 0 }, 0.11, 0.00 },
+    { { 1, 0, -2, 0, -3, 0, 0, 0 }, -0.11, 0.00 },
+    { { 1, 0, -2, 0, -1, 0, 0, 0 }, -0.11, 0.00 },
+
+    // Terms of order t^1.
+    { { 0, 0, 0, 0, 2, 0, 0, 0 }, -0.07, 3.57 },
+    { { 0, 0, 0, 0, 1, 0, 0, 0 }, 1.73, -0.03 },
+    { { 0, 0, 2, -2, 3, 0, 0, 0 }, 0.00, 0.48 },
+
+    // Terms of order t^2.
+    { { 0, 0, 0, 0, 1, 0, 0, 0 }, 743.52, -0.17 },
+    { { 0, 0, 2, -2, 2, 0, 0, 0 }, 56.91, 0.06 },
+    { { 0, 0, 2, 0, 2, 0, 0, 0 }, 9.84, -0.01 },
+    { { 0, 0, 0, 0, 2, 0, 0, 0 }, -8.85, 0.01 },
+    { { 0, 1, 0, 0, 0, 0, 0, 0 }, -6.38, -0.05 },
+    { { 1, 0, 0, 0, 0, 0, 0, 0 }, -3.07, 0.00 },
+    { { 0, 1, 2, -2, 2, 0, 0, 0 }, 2.23, 0.00 },
+    { { 0, 0, 2, 0, 1, 0, 0, 0 }, 1.67, 0.00 },
+    { { 1, 0, 2, 0, 2, 0, 0, 0 }, 1.30, 0.00 },
+    { { 0, 1, -2, 2, -2, 0, 0, 0 }, 0.93, 0.00 },
+    { { 1, 0, 0, -2, 0, 0, 0, 0 }, 0.68, 0.00 },
+    { { 0, 0, 2, -2, 1, 0, 0, 0 }, -0.55, 0.00 },
+    { { 1, 0, -2, 0, -2, 0, 0, 0 }, 0.53, 0.00 },
+    { { 0, 0, 0, 2, 0, 0, 0, 0 }, -0.27, 0.00 },
+    { { 1, 0, 0, 0, 1, 0, 0, 0 }, -0.27, 0.00 },
+    { { 1, 0, -2, -2, -2, 0, 0, 0 }, -0.26, 0.00 },
+    { { 1, 0, 0, 0, -1, 0, 0, 0 }, -0.25, 0.00 },
+    { { 1, 0, 2, 0, 1, 0, 0, 0 }, 0.22, 0.00 },
+    { { 2, 0, 0, -2, 0, 0, 0, 0 }, -0.21, 0.00 },
+    { { 2, 0, -2, 0, -1, 0, 0, 0 }, 0.20, 0.00 },
+    { { 0, 0, 2, 2, 2, 0, 0, 0 }, 0.17, 0.00 },
+    { { 2, 0, 2, 0, 2, 0, 0, 0 }, 0.13, 0.00 },
+    { { 2, 0, 0, 0, 0, 0, 0, 0 }, -0.13, 0.00 },
+    { { 1, 0, 2, -2, 2, 0, 0, 0 }, -0.12, 0.00 },
+    { { 0, 0, 2, 0, 0, 0, 0, 0 }, -0.11, 0.00 },
+
+    // Terms of order t^3.
+    { { 0, 0, 0, 0, 1, 0, 0, 0 }, 0.30, -23.42 },
+    { { 0, 0, 2, -2, 2, 0, 0, 0 }, -0.03, -1.46 },
+    { { 0, 0, 2, 0, 2, 0, 0, 0 }, -0.01, -0.25 },
+    { { 0, 0, 0, 0, 2, 0, 0, 0 }, 0.00, 0.23 },
+
+    // Terms of order t^4.
+    { { 0, 0, 0, 0, 1, 0, 0, 0 }, -0.26, -0.01 }
+};
+
+//! Indices of the arguments of the CIO locator series in the vector of fundamental arguments.
+static const int CELESTIAL_ORIGIN_LOCATOR_ARGUMENT_INDICES[ 8 ] = { 0, 1, 2, 3, 4, 6, 7, 13 };
+
+//! Function to compute a polynomial in arcseconds, reduced to a single revolution and converted to radians.
+static double calculateAngleFromPolynomialInArcseconds(
+        const double c0, const double c1, const double c2, const double c3, const double c4, const double t )
+{
+    return std::fmod( c0 + t * ( c1 + t * ( c2 + t * ( c3 + t * c4 ) ) ), ARCSECONDS_IN_FULL_CIRCLE ) *
+            ARCSECONDS_TO_RADIANS;
+}
+
+//! Function to compute the Delaunay arguments and planetary longitudes used in the IERS Conventions 2010.
+Eigen::Matrix< double, 14, 1 > calculateFundamentalArguments( const double julianCenturiesSinceJ2000 )
+{
+    const double t = julianCenturiesSinceJ2000;
+    const double fullCircle = 2.0 * mathematical_constants::PI;
+
+    Eigen::Matrix< double, 14, 1 > fundamentalArguments;
+
+    // Delaunay arguments (eq. 5.43).
+    fundamentalArguments( 0 ) = calculateAngleFromPolynomialInArcseconds(
+                485868.249036, 1717915923.2178, 31.8792, 0.051635, -0.00024470, t );
+    fundamentalArguments( 1 ) = calculateAngleFromPolynomialInArcseconds(
+                1287104.793048, 129596581.0481, -0.5532, 0.000136, -0.00001149, t );
+    fundamentalArguments( 2 ) = calculateAngleFromPolynomialInArcseconds(
+                335779.526232, 1739527262.8478, -12.7512, -0.001037, 0.00000417, t );
+    fundamentalArguments( 3 ) = calculateAngleFromPolynomialInArcseconds(
+                1072260.703692, 1602961601.2090, -6.3706, 0.006593, -0.00003169, t );
+    fundamentalArguments( 4 ) = calculateAngleFromPolynomialInArcseconds(
+                450160.398036, -6962890.5431, 7.4722, 0.007702, -0.00005939, t );
+
+    // Mean longitudes of the planets and general precession in longitude (eq. 5.44).
+    fundamentalArguments( 5 ) = std::fmod( 4.402608842 + 2608.7903141574 * t, fullCircle );
+    fundamentalArguments( 6 ) = std::fmod( 3.176146697 + 1021.3285546211 * t, fullCircle );
+    fundamentalArguments( 7 ) = std::fmod( 1.753470314 + 628.3075849991 * t, fullCircle );
+    fundamentalArguments( 8 ) = std::fmod( 6.203480913 + 334.0612426700 * t, fullCircle );
+    fundamentalArguments( 9 ) = std::fmod( 0.599546497 + 52.9690962641 * t, fullCircle );
+    fundamentalArguments( 10 ) = std::fmod( 0.874016757 + 21.3299104960 * t, fullCircle );
+    fundamentalArguments( 11 ) = std::fmod( 5.481293872 + 7.4781598567 * t, fullCircle );
+    fundamentalArguments( 12 ) = std::fmod( 5.311886287 + 3.8133035638 * t, fullCircle );
+    fundamentalArguments( 13 ) = ( 0.02438175 + 0.00000538691 * t ) * t;
+
+    return fundamentalArguments;
+}
+
+//! Function to compute the nutation angles according to the IAU 2000A nutation model.
+Eigen::Vector2d calculateIau2000aNutationAngles( const double julianCenturiesSinceJ2000 )
+{
+    const Iau2000aNutationSeriesTables& nutationSeriesTables = getIau2000aNutationSeriesTables( );
+    const Eigen::Matrix< double, 14, 1 > fundamentalArguments =
+            calculateFundamentalArguments( julianCenturiesSinceJ2000 );
+
+    // Evaluate arguments of all terms.
+    const Eigen::ArrayXd luniSolarArguments =
+            nutationSeriesTables.luniSolarArgumentMultipliers * fundamentalArguments.segment( 0, 5 );
+
+    // Planetary terms use the (linear) MHB2000 expressions for l, F, D, Omega and the mean longitude of Neptune.
+    const double t = julianCenturiesSinceJ2000;
+    const double fullCircle = 2.0 * mathematical_constants::PI;
+    Eigen::Matrix< double, 14, 1 > planetaryFundamentalArguments = fundamentalArguments;
+    planetaryFundamentalArguments( 0 ) = std::fmod( 2.35555598 + 8328.6914269554 * t, fullCircle );
+    planetaryFundamentalArguments( 2 ) = std::fmod( 1.627905234 + 8433.466158131 * t, fullCircle );
+    planetaryFundamentalArguments( 3 ) = std::fmod( 5.198466741 + 7771.3771468121 * t, fullCircle );
+    planetaryFundamentalArguments( 4 ) = std::fmod( 2.18243920 - 33.757045 * t, fullCircle );
+    planetaryFundamentalArguments( 12 ) = std::fmod( 5.321159000 + 3.8127774000 * t, fullCircle );
+    const Eigen::ArrayXd planetaryArguments =
+            nutationSeriesTables.planetaryArgumentMultipliers * planetaryFundamentalArguments;
+
+    const Eigen::ArrayXd luniSolarSines = luniSolarArguments.sin( );
+    const Eigen::ArrayXd luniSolarCosines = luniSolarArguments.cos( );
+    const Eigen::ArrayXd planetarySines = planetaryArguments.sin( );
+    const Eigen::ArrayXd planetaryCosines = planetaryArguments.cos( );
+
+    // Sum luni-solar and planetary terms.
+    const Eigen::MatrixXd& luniSolarCoefficients = nutationSeriesTables.luniSolarCoefficients;
+    const Eigen::MatrixXd& planetaryCoefficients = nutationSeriesTables.planetaryCoefficients;
+
+    Eigen::Vector2d nutationAngles;
+    nutationAngles( 0 ) =
+            ( ( luniSolarCoefficients.col( 0 ) + t * luniSolarCoefficients.col( 1 ) ).array( ) *
+              luniSolarSines ).sum( ) +
+            ( luniSolarCoefficients.col( 2 ).array( ) * luniSolarCosines ).sum( ) +
+            ( planetaryCoefficients.col( 0 ).array( ) * planetarySines ).sum( ) +
+            ( planetaryCoefficients.col( 1 ).array( ) * planetaryCosines ).sum( );
+    nutationAngles( 1 ) =
+            ( ( luniSolarCoefficients.col( 3 ) + t * luniSolarCoefficients.col( 4 ) ).array( ) *
+              luniSolarCosines ).sum( ) +
+            ( luniSolarCoefficients.col( 5 ).array( ) * luniSolarSines ).sum( ) +
+            ( planetaryCoefficients.col( 2 ).array( ) * planetarySines ).sum( ) +
+            ( planetaryCoefficients.col( 3 ).array( ) * planetaryCosines ).sum( );
+
+    return nutationAngles;
+}
+
+//! Function to compute the IAU 2006/2000A bias-precession-nutation matrix.
+Eigen::Matrix3d calculateIau2006BiasPrecessionNutationMatrix( const double julianCenturiesSinceJ2000 )
+{
+    const double t = julianCenturiesSinceJ2000;
+
+    // Compute Fukushima-Williams precession angles (IERS Conventions 2010, eq. 5.40) and mean obliquity (eq. 5.39).
+    const double gammaBar = ( -0.052928 + ( 10.556378 + ( 0.4932044 + ( -0.00031238 + ( -0.000002788 +
+                              0.0000000260 * t ) * t ) * t ) * t ) * t ) * ARCSECONDS_TO_RADIANS;
+    const double phiBar = ( 84381.412819 + ( -46.811016 + ( 0.0511268 + ( 0.00053289 + ( -0.000000440 -
+                            0.0000000176 * t ) * t ) * t ) * t ) * t ) * ARCSECONDS_TO_RADIANS;
+    const double psiBar = ( -0.041775 + ( 5038.481484 + ( 1.5584175 + ( -0.00018522 + ( -0.000026452 -
+                            0.0000000148 * t ) * t ) * t ) * t ) * t ) * ARCSECONDS_TO_RADIANS;
+    const double meanObliquity = ( 84381.406 + ( -46.836769 + ( -0.0001831 + ( 0.00200340 + ( -0.000000576 -
+                                   0.0000000434 * t ) * t ) * t ) * t ) * t ) * ARCSECONDS_TO_RADIANS;
+
+    // Compute nutation angles, adjusted for consistency with IAU 2006 precession (eq. 5.35 and 5.36).
+    const Eigen::Vector2d nutationAngles = calculateIau2000aNutationAngles( t );
+    const double j2RateCorrection = -2.7774E-6 * t;
+    const double nutationInLongitude = nutationAngles( 0 ) * ( 1.0 + 0.4697E-6 + j2RateCorrection );
+    const double nutationInObliquity = nutationAngles( 1 ) * ( 1.0 + j2RateCorrection );
+
+    // Compose matrix as R1(-eps) R3(-psi) R1(phi) R3(gamma) (eq. 5.38).
+    return ( Eigen::AngleAxisd( meanObliquity + nutationInObliquity, Eigen::Vector3d::UnitX( ) ) *
+             Eigen::AngleAxisd( psiBar + nutationInLongitude, Eigen::Vector3d::UnitZ( ) ) *
+             Eigen::AngleAxisd( -phiBar, Eigen::Vector3d::UnitX( ) ) *
+             Eigen::AngleAxisd( -gammaBar, Eigen::Vector3d::UnitZ( ) ) ).toRotationMatrix( );
+}
+
+//! Function to compute the position of the celestial intermediate pole in the GCRS.
+Eigen::Vector2d calculateCelestialIntermediatePolePosition( const double julianCenturiesSinceJ2000 )
+{
+    const Eigen::Matrix3d biasPrecessionNutationMatrix =
+            calculateIau2006BiasPrecessionNutationMatrix( julianCenturiesSinceJ2000 );
+    return ( Eigen::Vector2d( ) << biasPrecessionNutationMatrix( 2, 0 ), biasPrecessionNutationMatrix( 2, 1 ) ).finished( );
+}
+
+//! Function to compute the celestial intermediate origin locator.
+double calculateCelestialIntermediateOriginLocator( const double julianCenturiesSinceJ2000,
+                                                    const double celestialPoleX,
+                                                    const double celestialPoleY )
+{
+    const double t = julianCenturiesSinceJ2000;
+    const Eigen::Matrix< double, 14, 1 > fundamentalArguments = calculateFundamentalArguments( t );
+
+    // Sum periodic terms for each power of time.
+    double seriesCoefficients[ 6 ];
+    int currentTerm = 0;
+    for( int i = 0; i < 6; i++ )
+    {
+        seriesCoefficients[ i ] = CELESTIAL_ORIGIN_LOCATOR_POLYNOMIAL[ i ];
+        if( i < 5 )
+        {
+            for( int j = 0; j < NUMBER_OF_CELESTIAL_ORIGIN_LOCATOR_TERMS[ i ]; j++ )
+            {
+                const CelestialOriginLocatorTerm& term = CELESTIAL_ORIGIN_LOCATOR_TERMS[ currentTerm ];
+                double argument = 0.0;
+                for( int k = 0; k < 8; k++ )
+                {
+                    argument += static_cast< double >( term.argumentMultipliers[ k ] ) *
+                            fundamentalArguments( CELESTIAL_ORIGIN_LOCATOR_ARGUMENT_INDICES[ k ] );
+                }
+                seriesCoefficients[ i ] += term.sineCoefficient * std::sin( argument ) +
+                        term.cosineCoefficient * std::cos( argument );
+                currentTerm++;
+            }
+        }
+    }
+
+    // Evaluate polynomial in time, and subtract XY/2.
+    const double locatorPlusHalfXY =
+            ( seriesCoefficients[ 0 ] + ( seriesCoefficients[ 1 ] + ( seriesCoefficients[ 2 ] +
+              ( seriesCoefficients[ 3 ] + ( seriesCoefficients[ 4 ] + seriesCoefficients[ 5 ] * t ) * t ) * t ) *
+              t ) * t ) * 1.0E-6 * ARCSECONDS_TO_RADIANS;
+    return locatorPlusHalfXY - celestialPoleX * celestialPoleY / 2.0;
+}
+
+//! Function to compute the rotation matrix from the GCRS to the celestial intermediate reference system.
+Eigen::Matrix3d calculateCelestialToIntermediateRotationMatrix( const double celestialPoleX,
+                                                                const double celestialPoleY,
+                                                                const double celestialOriginLocator )
+{
+    // Compute spherical angles E and d of the CIP (eq. 5.7).
+    const double squaredPoleDistance = celestialPoleX * celestialPoleX + celestialPoleY * celestialPoleY;
+    const double poleLongitude = ( squaredPoleDistance > 0.0 ) ? std::atan2( celestialPoleY, celestialPoleX ) : 0.0;
+    const double poleDistance = std::atan( std::sqrt( squaredPoleDistance / ( 1.0 - squaredPoleDistance ) ) );
+
+    // Compose matrix as R3(-(E+s)) R2(d) R3(E) (eq. 5.10).
+    return ( Eigen::AngleAxisd( poleLongitude + celestialOriginLocator, Eigen::Vector3d::UnitZ( ) ) *
+             Eigen::AngleAxisd( -poleDistance, Eigen::Vector3d::UnitY( ) ) *
+             Eigen::AngleAxisd( -poleLongitude, Eigen::Vector3d::UnitZ( ) ) ).toRotationMatrix( );
+}
+
+//! Function to compute the Earth rotation angle.
+double calculateEarthRotationAngle( const double ut1SecondsSinceJ2000 )
+{
+    const double ut1DaysSinceJ2000 = ut1SecondsSinceJ2000 / 86400.0;
+
+    // Use fraction of day separately to retain precision (J2000 is at noon, Julian day fraction zero).
+    const double fractionOfDay = std::fmod( ut1SecondsSinceJ2000, 86400.0 ) / 86400.0;
+    double earthRotationAngle = 2.0 * mathematical_constants::PI * std::fmod(
+                fractionOfDay + 0.7790572732640 + 0.00273781191135448 * ut1DaysSinceJ2000, 1.0 );
+    if( earthRotationAngle < 0.0 )
+    {
+        earthRotationAngle += 2.0 * mathematical_constants::PI;
+    }
+    return earthRotationAngle;
+}
+
+//! Function to compute the terrestrial intermediate origin locator.
+double calculateTerrestrialIntermediateOriginLocator( const double julianCenturiesSinceJ2000 )
+{
+    return -47.0E-6 * julianCenturiesSinceJ2000 * ARCSECONDS_TO_RADIANS;
+}
+
+//! Function to compute the polar motion matrix.
+Eigen::Matrix3d calculatePolarMotionRotationMatrix( const double polarMotionX,
+                                                    const double polarMotionY,
+                                                    const double terrestrialOriginLocator )
+{
+    // Compose matrix as R1(-y_p) R2(-x_p) R3(s').
+    return ( Eigen::AngleAxisd( polarMotionY, Eigen::Vector3d::UnitX( ) ) *
+             Eigen::AngleAxisd( polarMotionX, Eigen::Vector3d::UnitY( ) ) *
+             Eigen::AngleAxisd( -terrestrialOriginLocator, Eigen::Vector3d::UnitZ( ) ) ).toRotationMatrix( );
+}
+
+} // namespace reference_frames
+
+} // namespace tudat
@@ -0,0 +1,140 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Petit, G., Luzum, B. (eds.), IERS Conventions (2010), IERS Technical Note 36, 2010.
+ *      Capitaine, N., Wallace, P.T., Chapront, J., Expressions for IAU 2000 precession quantities, Astronomy and
+ *        Astrophysics, 412, 567-586, 2003.
+ *      Wallace, P.T., Capitaine, N., Precession-nutation procedures consistent with IAU 2006 resolutions, Astronomy
+ *        and Astrophysics, 459, 981-985, 2006.
+ *
+ *    Notes
+ *      The rotation matrices in this file are defined as frame rotations, as in the IERS Conventions, i.e.
+ *      R_{i}(angle) rotates the coordinate frame by angle about its i-th axis (which corresponds to
+ *      Eigen::AngleAxisd( -angle, axis ) ).
+ */
+
+#ifndef TUDAT_EARTH_ORIENTATION_CALCULATIONS_H
+#define TUDAT_EARTH_ORIENTATION_CALCULATIONS_H
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace reference_frames
+{
+
+//! Rate of change of the Earth rotation angle, in radians per UT1 second (IERS Conventions 2010, eq. 5.15).
+const static double EARTH_ROTATION_ANGLE_RATE =
+        2.0 * mathematical_constants::PI * 1.00273781191135448 / 86400.0;
+
+//! Function to compute the Delaunay arguments and planetary longitudes used in the IERS Conventions 2010.
+/*!
+ *  Function to compute the fundamental arguments of the luni-solar and planetary nutation theories, as defined in the
+ *  IERS Conventions 2010 (eq. 5.43 and 5.44).
+ *  \param julianCenturiesSinceJ2000 Julian centuries (TT) since J2000.
+ *  \return Delaunay arguments l, l', F, D and Omega, mean longitudes of Mercury, Venus, Earth, Mars, Jupiter, Saturn,
+ *  Uranus and Neptune, and general accumulated precession in longitude (all in radians, in this order).
+ */
+Eigen::Matrix< double, 14, 1 > calculateFundamentalArguments( const double julianCenturiesSinceJ2000 );
+
+//! Function to compute the nutation angles according to the IAU 2000A nutation model.
+/*!
+ *  Function to compute the nutation in longitude and obliquity according to the IAU 2000A (MHB2000) nutation model,
+ *  using all 1365 luni-solar and planetary terms. The arguments of all terms are computed at once from precomputed
+ *  tables of argument multipliers. No corrections for consistency with the IAU 2006 precession are applied.
+ *  \param julianCenturiesSinceJ2000 Julian centuries (TT) since J2000.
+ *  \return Nutation in longitude and obliquity (in radians).
+ */
+Eigen::Vector2d calculateIau2000aNutationAngles( const double julianCenturiesSinceJ2000 );
+
+//! Function to compute the IAU 2006/2000A bias-precession-nutation matrix.
+/*!
+ *  Function to compute the matrix that rotates from the GCRS to the true equator and equinox of date, combining the
+ *  frame bias, the IAU 2006 precession (Fukushima-Williams angles) and the IAU 2000A nutation (including the
+ *  adjustments for consistency with the IAU 2006 precession).
+ *  \param julianCenturiesSinceJ2000 Julian centuries (TT) since J2000.
+ *  \return Bias-precession-nutation matrix.
+ */
+Eigen::Matrix3d calculateIau2006BiasPrecessionNutationMatrix( const double julianCenturiesSinceJ2000 );
+
+//! Function to compute the position of the celestial intermediate pole in the GCRS.
+/*!
+ *  Function to compute the coordinates X and Y of the celestial intermediate pole (CIP) in the GCRS, according to the
+ *  IAU 2006/2000A precession-nutation model. Celestial pole offsets (dX, dY) from the IERS are not included.
+ *  \param julianCenturiesSinceJ2000 Julian centuries (TT) since J2000.
+ *  \return Coordinates X and Y of the celestial intermediate pole.
+ */
+Eigen::Vector2d calculateCelestialIntermediatePolePosition( const double julianCenturiesSinceJ2000 );
+
+//! Function to compute the celestial intermediate origin locator.
+/*!
+ *  Function to compute the celestial intermediate origin (CIO) locator s, according to the IAU 2006/2000A
+ *  precession-nutation model (IERS Conventions 2010, table 5.2d, using all terms).
+ *  \param julianCenturiesSinceJ2000 Julian centuries (TT) since J2000.
+ *  \param celestialPoleX Coordinate X of the celestial intermediate pole.
+ *  \param celestialPoleY Coordinate Y of the celestial intermediate pole.
+ *  \return Celestial intermediate origin locator s (in radians).
+ */
+double calculateCelestialIntermediateOriginLocator( const double julianCenturiesSinceJ2000,
+                                                    const double celestialPoleX,
+                                                    const double celestialPoleY );
+
+//! Function to compute the rotation matrix from the GCRS to the celestial intermediate reference system.
+/*!
+ *  Function to compute the rotation matrix from the GCRS to the celestial intermediate reference system (CIRS),
+ *  from the position of the celestial intermediate pole and the CIO locator (IERS Conventions 2010, eq. 5.10).
+ *  \param celestialPoleX Coordinate X of the celestial intermediate pole.
+ *  \param celestialPoleY Coordinate Y of the celestial intermediate pole.
+ *  \param celestialOriginLocator Celestial intermediate origin locator s.
+ *  \return Rotation matrix from GCRS to CIRS.
+ */
+Eigen::Matrix3d calculateCelestialToIntermediateRotationMatrix( const double celestialPoleX,
+                                                                const double celestialPoleY,
+                                                                const double celestialOriginLocator );
+
+//! Function to compute the Earth rotation angle.
+/*!
+ *  Function to compute the Earth rotation angle (IERS Conventions 2010, eq. 5.15), i.e. the angle between the
+ *  celestial and terrestrial intermediate origins.
+ *  \param ut1SecondsSinceJ2000 UT1 in seconds since 1 January 2000, 12:00 UT1.
+ *  \return Earth rotation angle, in the interval [0, 2 pi).
+ */
+double calculateEarthRotationAngle( const double ut1SecondsSinceJ2000 );
+
+//! Function to compute the terrestrial intermediate origin locator.
+/*!
+ *  Function to compute the terrestrial intermediate origin (TIO) locator s', using its secular approximation
+ *  (IERS Conventions 2010, eq. 5.13).
+ *  \param julianCenturiesSinceJ2000 Julian centuries (TT) since J2000.
+ *  \return Terrestrial intermediate origin locator s' (in radians).
+ */
+double calculateTerrestrialIntermediateOriginLocator( const double julianCenturiesSinceJ2000 );
+
+//! Function to compute the polar motion matrix.
+/*!
+ *  Function to compute the rotation matrix from the terrestrial intermediate reference system (TIRS) to the ITRS,
+ *  i.e. the inverse of the polar motion matrix W of the IERS Conventions 2010 (eq. 5.3).
+ *  \param polarMotionX Polar motion coordinate x_p (in radians).
+ *  \param polarMotionY Polar motion coordinate y_p (in radians).
+ *  \param terrestrialOriginLocator Terrestrial intermediate origin locator s'.
+ *  \return Rotation matrix from TIRS to ITRS.
+ */
+Eigen::Matrix3d calculatePolarMotionRotationMatrix( const double polarMotionX,
+                                                    const double polarMotionY,
+                                                    const double terrestrialOriginLocator );
+
+} // namespace reference_frames
+
+} // namespace tudat
+
+#endif // TUDAT_EARTH_ORIENTATION_CALCULATIONS_H
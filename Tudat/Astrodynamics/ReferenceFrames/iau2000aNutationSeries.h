@@ -0,0 +1,82 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_IAU_2000A_NUTATION_SERIES_H
+#define TUDAT_IAU_2000A_NUTATION_SERIES_H
+
+namespace tudat
+{
+
+namespace reference_frames
+{
+
+//! Number of luni-solar terms in the IAU 2000A nutation series.
+const static int NUMBER_OF_IAU_2000A_LUNI_SOLAR_NUTATION_TERMS = 678;
+
+//! Number of planetary terms in the IAU 2000A nutation series.
+const static int NUMBER_OF_IAU_2000A_PLANETARY_NUTATION_TERMS = 687;
+
+//! Single luni-solar term of the IAU 2000A nutation series.
+struct Iau2000aLuniSolarNutationTerm
+{
+    //! Multipliers of the Delaunay arguments l, l', F, D and Omega.
+    int argumentMultipliers[ 5 ];
+
+    //! Coefficient of sine of argument in nutation in longitude (0.1 microarcseconds).
+    double longitudeSineCoefficient;
+
+    //! Coefficient of time times sine of argument in nutation in longitude (0.1 microarcseconds per century).
+    double longitudeSineRateCoefficient;
+
+    //! Coefficient of cosine of argument in nutation in longitude (0.1 microarcseconds).
+    double longitudeCosineCoefficient;
+
+    //! Coefficient of cosine of argument in nutation in obliquity (0.1 microarcseconds).
+    double obliquityCosineCoefficient;
+
+    //! Coefficient of time times cosine of argument in nutation in obliquity (0.1 microarcseconds per century).
+    double obliquityCosineRateCoefficient;
+
+    //! Coefficient of sine of argument in nutation in obliquity (0.1 microarcseconds).
+    double obliquitySineCoefficient;
+};
+
+//! Single planetary term of the IAU 2000A nutation series.
+struct Iau2000aPlanetaryNutationTerm
+{
+    //! Multipliers of l, F, D, Omega, the mean longitudes of Mercury to Neptune and the general precession.
+    int argumentMultipliers[ 13 ];
+
+    //! Coefficient of sine of argument in nutation in longitude (0.1 microarcseconds).
+    double longitudeSineCoefficient;
+
+    //! Coefficient of cosine of argument in nutation in longitude (0.1 microarcseconds).
+    double longitudeCosineCoefficient;
+
+    //! Coefficient of sine of argument in nutation in obliquity (0.1 microarcseconds).
+    double obliquitySineCoefficient;
+
+    //! Coefficient of cosine of argument in nutation in obliquity (0.1 microarcseconds).
+    double obliquityCosineCoefficient;
+};
+
+//! Luni-solar terms of the IAU 2000A nutation series (MHB2000 model, IERS Conventions 2010 table 5.3a).
+extern const Iau2000aLuniSolarNutationTerm
+IAU_2000A_LUNI_SOLAR_NUTATION_TERMS[ NUMBER_OF_IAU_2000A_LUNI_SOLAR_NUTATION_TERMS ];
+
+//! Planetary terms of the IAU 2000A nutation series (MHB2000 model, IERS Conventions 2010 table 5.3b).
+extern const Iau2000aPlanetaryNutationTerm
+IAU_2000A_PLANETARY_NUTATION_TERMS[ NUMBER_OF_IAU_2000A_PLANETARY_NUTATION_TERMS ];
+
+} // namespace reference_frames
+
+} // namespace tudat
+
+#endif // TUDAT_IAU_2000A_NUTATION_SERIES_H
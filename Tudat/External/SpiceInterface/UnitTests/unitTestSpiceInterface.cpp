@@ -51,6 +51,7 @@
 #include <boost/make_shared.hpp>
 #include <boost/bind.hpp>
 #include <boost/exception/all.hpp>
+#include <boost/filesystem.hpp>
 #include <boost/function.hpp>
 #include <boost/shared_ptr.hpp>
 
@@ -59,12 +60,15 @@
 #include "Tudat/InputOutput/basicInputOutput.h"
 #include "Tudat/Mathematics/BasicMathematics/linearAlgebraTypes.h"
 #include "Tudat/External/SpiceInterface/spiceEphemeris.h"
+#include "Tudat/External/SpiceInterface/spiceGateway.h"
 #include "Tudat/External/SpiceInterface/spiceInterface.h"
 #include "Tudat/External/SpiceInterface/spiceRotationalEphemeris.h"
 
+#include <fstream>
 #include <limits>
 #include <iostream>
 #include <stdexcept>
+#include <thread>
 
 namespace tudat
 {
@@ -73,6 +77,42 @@ namespace unit_tests
 
 using basic_mathematics::Vector6d;
 
+//! Function to write a (temporary) Spice text kernel that maps a body name to a NAIF ID.
+std::string writeBodyNameKernel( const std::string& bodyName, const int naifId )
+{
+    const std::string kernelFileName = ( boost::filesystem::temp_directory_path( ) /
+                                         boost::filesystem::unique_path( "tudat-%%%%-%%%%.tpc" ) ).string( );
+    std::ofstream kernelFile( kernelFileName.c_str( ) );
+    kernelFile << "KPL/PCK" << std::endl << std::endl
+               << "\\begindata" << std::endl << std::endl
+               << "NAIF_BODY_NAME += ( '" << bodyName << "' )" << std::endl
+               << "NAIF_BODY_CODE += ( " << naifId << " )" << std::endl << std::endl
+               << "\\begintext" << std::endl;
+    kernelFile.close( );
+    return kernelFileName;
+}
+
+//! Function to compute states and rotations with the thread-safe Spice wrappers, as performed by a single thread.
+void computeSpiceResultsWithGateway( const std::string targetBodyName,
+                                     const std::vector< double >* ephemerisTimes,
+                                     std::vector< Vector6d >* states,
+                                     std::vector< Eigen::Matrix3d >* rotations )
+{
+    using namespace spice_interface;
+
+    for( unsigned int i = 0; i < ephemerisTimes->size( ); i++ )
+    {
+        states->push_back( getBodyCartesianStateAtEpochThreadSafe(
+                               targetBodyName, "Earth", "J2000", "NONE", ephemerisTimes->at( i ) ) );
+        rotations->push_back( computeRotationQuaternionBetweenFramesThreadSafe(
+                                  "J2000", "IAU_EARTH", ephemerisTimes->at( i ) ).toRotationMatrix( ) );
+    }
+
+    std::vector< Vector6d > batchStates = getBodyCartesianStatesAtEpochs(
+                targetBodyName, "Earth", "J2000", "NONE", *ephemerisTimes );
+    states->insert( states->end( ), batchStates.begin( ), batchStates.end( ) );
+}
+
 BOOST_AUTO_TEST_SUITE( test_spice_wrappers )
 
 // Test 1: Test Julian day <-> Ephemeris time conversions at J2000.
@@ -500,6 +540,18 @@ BOOST_AUTO_TEST_CASE( testSpiceWrappers_7 )
     // Loaded kernels should be 4.
     BOOST_CHECK_EQUAL( spiceKernelsLoaded, 4 );
 
+    // Check file names of loaded kernels, and that they are all included in identifier of loaded kernels.
+    const std::vector< std::string > loadedKernelFiles = getLoadedSpiceKernelFiles( );
+    BOOST_CHECK_EQUAL( loadedKernelFiles.size( ), 4 );
+    BOOST_CHECK_EQUAL( loadedKernelFiles.at( 0 ), getSpiceKernelPath( ) + "de421.bsp" );
+    BOOST_CHECK_EQUAL( loadedKernelFiles.at( 3 ), getSpiceKernelPath( ) + "de-403-masses.tpc" );
+    const std::string loadedKernelsIdentifier = getLoadedSpiceKernelsIdentifier( );
+    for( unsigned int i = 0; i < loadedKernelFiles.size( ); i++ )
+    {
+        BOOST_CHECK( loadedKernelsIdentifier.find( "kernel=" + loadedKernelFiles.at( i ) + ",size=" ) !=
+                     std::string::npos );
+    }
+
     // Clear all Spice kernels.
     clearSpiceKernels( );
 
@@ -508,6 +560,195 @@ BOOST_AUTO_TEST_CASE( testSpiceWrappers_7 )
 
     // Loaded kernels should be 0.
     BOOST_CHECK_EQUAL( spiceKernelsLoaded, 0 );
+    BOOST_CHECK_EQUAL( getLoadedSpiceKernelsIdentifier( ), "" );
+}
+
+// Test 8: Compare results of thread-safe Spice gateway with direct wrappers.
+BOOST_AUTO_TEST_CASE( testSpiceWrappers_8 )
+{
+    using namespace spice_interface;
+    using namespace input_output;
+
+    // Load spice kernels.
+    loadSpiceKernelInTudat( getSpiceKernelPath( ) + "de421.bsp" );
+    loadSpiceKernelInTudat( getSpiceKernelPath( ) + "pck00009.tpc" );
+    loadSpiceKernelInTudat( getSpiceKernelPath( ) + "naif0009.tls" );
+
+    const std::string target = "Moon";
+    const std::string observer = "Earth";
+    const std::string referenceFrame = "J2000";
+    const std::string abberationCorrections = "NONE";
+
+    // Check NAIF ID retrieved from cache.
+    BOOST_CHECK_EQUAL( getCachedNaifId( target ), 301 );
+    BOOST_CHECK_EQUAL( getCachedNaifId( target ), 301 );
+
+    // Set epochs at which to compare results.
+    std::vector< double > ephemerisTimes;
+    for( unsigned int i = 0; i < 10; i++ )
+    {
+        ephemerisTimes.push_back( 1.0E7 + static_cast< double >( i ) * 3600.0 );
+    }
+
+    std::vector< Vector6d > batchStates = getBodyCartesianStatesAtEpochs(
+                target, observer, referenceFrame, abberationCorrections, ephemerisTimes );
+    std::vector< Eigen::Quaterniond > batchRotations = computeRotationQuaternionsBetweenFrames(
+                "J2000", "IAU_EARTH", ephemerisTimes );
+
+    for( unsigned int i = 0; i < ephemerisTimes.size( ); i++ )
+    {
+        // Compare states (twice, to check both uncached and cached results).
+        const Vector6d directState = getBodyCartesianStateAtEpoch(
+                    target, observer, referenceFrame, abberationCorrections, ephemerisTimes.at( i ) );
+        for( unsigned int j = 0; j < 2; j++ )
+        {
+            const Vector6d gatewayState = getBodyCartesianStateAtEpochThreadSafe(
+                        target, observer, referenceFrame, abberationCorrections, ephemerisTimes.at( i ) );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( directState, gatewayState,
+                                               std::numeric_limits< double >::epsilon( ) );
+        }
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( directState, batchStates.at( i ),
+                                           std::numeric_limits< double >::epsilon( ) );
+
+        // Compare rotations (twice, to check both uncached and cached results).
+        const Eigen::Matrix3d directRotation = computeRotationQuaternionBetweenFrames(
+                    "J2000", "IAU_EARTH", ephemerisTimes.at( i ) ).toRotationMatrix( );
+        const Eigen::Matrix3d directRotationDerivative = computeRotationMatrixDerivativeBetweenFrames(
+                    "J2000", "IAU_EARTH", ephemerisTimes.at( i ) );
+        for( unsigned int j = 0; j < 2; j++ )
+        {
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                        directRotation, computeRotationQuaternionBetweenFramesThreadSafe(
+                            "J2000", "IAU_EARTH", ephemerisTimes.at( i ) ).toRotationMatrix( ),
+                        std::numeric_limits< double >::epsilon( ) );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                        directRotationDerivative,
+                        computeRotationQuaternionAndRotationMatrixDerivativeBetweenFramesThreadSafe(
+                            "J2000", "IAU_EARTH", ephemerisTimes.at( i ) ).second,
+                        std::numeric_limits< double >::epsilon( ) );
+        }
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( directRotation, batchRotations.at( i ).toRotationMatrix( ),
+                                           std::numeric_limits< double >::epsilon( ) );
+    }
+
+    // Check that cached results are not used after the kernels are cleared, using a body name that is mapped to the
+    // Moon by a (temporary) text kernel.
+    const std::string testBodyName = "TUDAT_GATEWAY_TEST_BODY";
+    const std::string firstNameKernel = writeBodyNameKernel( testBodyName, 301 );
+    loadSpiceKernelInTudat( firstNameKernel );
+    BOOST_CHECK_EQUAL( getCachedNaifId( testBodyName ), 301 );
+    const Vector6d moonState = getBodyCartesianStateAtEpochThreadSafe(
+                testBodyName, observer, referenceFrame, abberationCorrections, ephemerisTimes.at( 0 ) );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( moonState, batchStates.at( 0 ), std::numeric_limits< double >::epsilon( ) );
+
+    // Unload all kernels, after which the body name can no longer be resolved.
+    clearSpiceKernels( );
+    bool isExceptionCaught = false;
+    try
+    {
+        getCachedNaifId( testBodyName );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+
+    isExceptionCaught = false;
+    try
+    {
+        getBodyCartesianStateAtEpochThreadSafe(
+                    testBodyName, observer, referenceFrame, abberationCorrections, ephemerisTimes.at( 0 ) );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+
+    // Map the same body name to the Sun, and check that the (same) state request now returns the state of the Sun.
+    loadSpiceKernelInTudat( getSpiceKernelPath( ) + "de421.bsp" );
+    const std::string secondNameKernel = writeBodyNameKernel( testBodyName, 10 );
+    loadSpiceKernelInTudat( secondNameKernel );
+    BOOST_CHECK_EQUAL( getCachedNaifId( testBodyName ), 10 );
+    const Vector6d sunState = getBodyCartesianStateAtEpochThreadSafe(
+                testBodyName, observer, referenceFrame, abberationCorrections, ephemerisTimes.at( 0 ) );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                sunState, getBodyCartesianStateAtEpoch( "Sun", observer, referenceFrame, abberationCorrections,
+                                                        ephemerisTimes.at( 0 ) ),
+                std::numeric_limits< double >::epsilon( ) );
+    BOOST_CHECK_GT( ( sunState - moonState ).segment( 0, 3 ).norm( ), 1.0E11 );
+
+    clearSpiceKernels( );
+    boost::filesystem::remove( firstNameKernel );
+    boost::filesystem::remove( secondNameKernel );
+}
+
+// Test 9: Test concurrent use of the thread-safe Spice wrappers by several threads.
+BOOST_AUTO_TEST_CASE( testSpiceWrappers_9 )
+{
+    using namespace spice_interface;
+    using namespace input_output;
+
+    // Load spice kernels.
+    loadSpiceKernelInTudat( getSpiceKernelPath( ) + "de421.bsp" );
+    loadSpiceKernelInTudat( getSpiceKernelPath( ) + "pck00009.tpc" );
+    loadSpiceKernelInTudat( getSpiceKernelPath( ) + "naif0009.tls" );
+
+    // Set epochs at which to compute results, with repeated epochs so that the per-thread caches are used.
+    std::vector< double > ephemerisTimes;
+    for( unsigned int i = 0; i < 1000; i++ )
+    {
+        ephemerisTimes.push_back( 1.0E7 + static_cast< double >( i % 200 ) * 600.0 );
+    }
+
+    // Compute reference results serially, without the thread-safe wrappers.
+    const std::vector< std::string > targets = { "Moon", "Sun", "Mars", "Jupiter" };
+    std::vector< std::vector< Vector6d > > expectedStates( targets.size( ) );
+    std::vector< Eigen::Matrix3d > expectedRotations;
+    for( unsigned int j = 0; j < ephemerisTimes.size( ); j++ )
+    {
+        for( unsigned int i = 0; i < targets.size( ); i++ )
+        {
+            expectedStates[ i ].push_back( getBodyCartesianStateAtEpoch(
+                                               targets[ i ], "Earth", "J2000", "NONE", ephemerisTimes[ j ] ) );
+        }
+        expectedRotations.push_back( computeRotationQuaternionBetweenFrames(
+                                         "J2000", "IAU_EARTH", ephemerisTimes[ j ] ).toRotationMatrix( ) );
+    }
+
+    // Compute results concurrently, one target per thread (all threads also compute the same rotations).
+    std::vector< std::vector< Vector6d > > computedStates( targets.size( ) );
+    std::vector< std::vector< Eigen::Matrix3d > > computedRotations( targets.size( ) );
+    std::vector< std::thread > threads;
+    for( unsigned int i = 0; i < targets.size( ); i++ )
+    {
+        threads.push_back( std::thread( &computeSpiceResultsWithGateway, targets[ i ], &ephemerisTimes,
+                                        &computedStates[ i ], &computedRotations[ i ] ) );
+    }
+    for( unsigned int i = 0; i < threads.size( ); i++ )
+    {
+        threads[ i ].join( );
+    }
+
+    for( unsigned int i = 0; i < targets.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( computedStates[ i ].size( ), 2 * ephemerisTimes.size( ) );
+        BOOST_CHECK_EQUAL( computedRotations[ i ].size( ), ephemerisTimes.size( ) );
+        for( unsigned int j = 0; j < ephemerisTimes.size( ); j++ )
+        {
+            // Compare results of single-epoch and batch functions.
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( expectedStates[ i ][ j ], computedStates[ i ][ j ],
+                                               std::numeric_limits< double >::epsilon( ) );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( expectedStates[ i ][ j ],
+                                               computedStates[ i ][ j + ephemerisTimes.size( ) ],
+                                               std::numeric_limits< double >::epsilon( ) );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( expectedRotations[ j ], computedRotations[ i ][ j ],
+                                               std::numeric_limits< double >::epsilon( ) );
+        }
+    }
+
+    clearSpiceKernels( );
 }
 
 BOOST_AUTO_TEST_SUITE_END( )
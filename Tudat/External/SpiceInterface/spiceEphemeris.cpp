@@ -42,6 +42,7 @@
 #include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
 
 #include "Tudat/External/SpiceInterface/spiceEphemeris.h"
+#include "Tudat/External/SpiceInterface/spiceGateway.h"
 
 namespace tudat
 {
@@ -117,12 +118,42 @@ basic_mathematics::Vector6d SpiceEphemeris::getCartesianStateFromEphemeris(
 
     // Retrieve Cartesian state from spice.
     const basic_mathematics::Vector6d cartesianStateAtEpoch =
-            spice_interface::getBodyCartesianStateAtEpoch(
+            spice_interface::getBodyCartesianStateAtEpochThreadSafe(
                 targetBodyName_, referenceFrameOrigin_, referenceFrameOrientation_,
                 abberationCorrections_, ephemerisTime );
 
     return cartesianStateAtEpoch;
 }
 
+//! Get Cartesian states from ephemeris at a list of epochs.
+void SpiceEphemeris::getCartesianStatesFromEphemeris(
+        const std::vector< double >& secondsSinceEpoch,
+        Eigen::Matrix< double, 6, Eigen::Dynamic >& statesFromEphemeris,
+        const double julianDayAtEpoch )
+{
+    using namespace basic_astrodynamics;
+
+    // Calculate ephemeris times at which cartesian states are to be determind.
+    const double ephemerisTimeOffset = ( JULIAN_DAY_ON_J2000 - julianDayAtEpoch ) *
+            physical_constants::JULIAN_DAY;
+    std::vector< double > ephemerisTimes( secondsSinceEpoch.size( ) );
+    for( unsigned int i = 0; i < secondsSinceEpoch.size( ); i++ )
+    {
+        ephemerisTimes[ i ] = secondsSinceEpoch[ i ] + ephemerisTimeOffset;
+    }
+
+    // Retrieve Cartesian states from spice.
+    const std::vector< basic_mathematics::Vector6d > cartesianStates =
+            spice_interface::getBodyCartesianStatesAtEpochs(
+                targetBodyName_, referenceFrameOrigin_, referenceFrameOrientation_,
+                abberationCorrections_, ephemerisTimes );
+
+    statesFromEphemeris.resize( 6, cartesianStates.size( ) );
+    for( unsigned int i = 0; i < cartesianStates.size( ); i++ )
+    {
+        statesFromEphemeris.col( i ) = cartesianStates[ i ];
+    }
+}
+
 } // namespace ephemerides
 } // namespace tudat
@@ -95,6 +95,21 @@ public:
             const double secondsSinceEpoch, 
             const double julianDayAtEpoch = basic_astrodynamics::JULIAN_DAY_ON_J2000 );
 
+    //! Get Cartesian states from ephemeris at a list of epochs.
+    /*!
+     * Computes Cartesian states from ephemeris at a list of epochs, retrieving all states from
+     * Spice in a single call to the Spice gateway (see getBodyCartesianStatesAtEpochs).
+     * \param secondsSinceEpoch Seconds since reference epoch at which Cartesian states are to be
+     *          determined.
+     * \param statesFromEphemeris States from ephemeris (returned by reference), with the state at
+     *          secondsSinceEpoch[ i ] in column i.
+     * \param julianDayAtEpoch Reference epoch in Julian day.
+     */
+    void getCartesianStatesFromEphemeris(
+            const std::vector< double >& secondsSinceEpoch,
+            Eigen::Matrix< double, 6, Eigen::Dynamic >& statesFromEphemeris,
+            const double julianDayAtEpoch = basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+
 private:
 
     //! Name of body of which ephemeris is to be determined
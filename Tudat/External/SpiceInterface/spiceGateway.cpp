@@ -0,0 +1,285 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <atomic>
+#include <cstring>
+#include <map>
+#include <stdexcept>
+
+#include <boost/functional/hash.hpp>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/unitConversions.h"
+#include "Tudat/External/SpiceInterface/spiceGateway.h"
+#include "Tudat/External/SpiceInterface/spiceInterface.h"
+
+namespace tudat
+{
+
+namespace spice_interface
+{
+
+using basic_mathematics::Vector6d;
+
+//! Number of entries in each per-thread result cache.
+static const std::size_t spiceGatewayCacheSize = 64;
+
+//! Counter that is incremented whenever the caches are reset, invalidating all entries cached before.
+static std::atomic< unsigned int > spiceGatewayCacheGeneration( 1 );
+
+//! Cache of NAIF IDs of body names (guarded by Spice mutex).
+static std::map< std::string, int > cachedNaifIds;
+
+//! Key of a request to Spice, consisting of (up to) four names and an epoch.
+struct SpiceRequestKey
+{
+    std::string firstName;
+    std::string secondName;
+    std::string thirdName;
+    std::string fourthName;
+    double ephemerisTime;
+
+    bool operator==( const SpiceRequestKey& otherKey ) const
+    {
+        return ( std::memcmp( &ephemerisTime, &otherKey.ephemerisTime, sizeof( double ) ) == 0 ) &&
+                firstName == otherKey.firstName && secondName == otherKey.secondName &&
+                thirdName == otherKey.thirdName && fourthName == otherKey.fourthName;
+    }
+};
+
+//! Direct-mapped cache of results of requests to Spice, intended for use by a single thread.
+template< typename ValueType >
+class SpiceResultCache
+{
+public:
+
+    SpiceResultCache( ): keys_( spiceGatewayCacheSize ), values_( spiceGatewayCacheSize ),
+        generations_( spiceGatewayCacheSize, 0 ){ }
+
+    //! Function to retrieve cached result of request, returns false if result is not cached.
+    bool getValue( const SpiceRequestKey& key, ValueType& value )
+    {
+        const std::size_t index = getIndex( key );
+        if( generations_[ index ] == spiceGatewayCacheGeneration.load( ) && keys_[ index ] == key )
+        {
+            value = values_[ index ];
+            return true;
+        }
+        return false;
+    }
+
+    //! Function to add result of request to cache (overwriting any result with same index).
+    void setValue( const SpiceRequestKey& key, const ValueType& value, const unsigned int generation )
+    {
+        const std::size_t index = getIndex( key );
+        keys_[ index ] = key;
+        values_[ index ] = value;
+        generations_[ index ] = generation;
+    }
+
+private:
+
+    std::size_t getIndex( const SpiceRequestKey& key )
+    {
+        std::size_t hash = boost::hash_value( key.ephemerisTime );
+        boost::hash_combine( hash, key.firstName );
+        boost::hash_combine( hash, key.secondName );
+        return hash % spiceGatewayCacheSize;
+    }
+
+    std::vector< SpiceRequestKey > keys_;
+
+    std::vector< ValueType > values_;
+
+    std::vector< unsigned int > generations_;
+};
+
+//! Per-thread caches of Cartesian states, rotation quaternions and full rotations.
+static thread_local SpiceResultCache< Vector6d > stateCache;
+static thread_local SpiceResultCache< Eigen::Quaterniond > rotationCache;
+static thread_local SpiceResultCache< std::pair< Eigen::Quaterniond, Eigen::Matrix3d > > fullRotationCache;
+
+//! Function to retrieve NAIF ID of a body from cache (resolving it with Spice if needed); Spice mutex must be locked.
+static int getCachedNaifIdWithLockedMutex( const std::string& bodyName )
+{
+    std::map< std::string, int >::const_iterator naifIdIterator = cachedNaifIds.find( bodyName );
+    if( naifIdIterator != cachedNaifIds.end( ) )
+    {
+        return naifIdIterator->second;
+    }
+
+    SpiceInt bodyNaifId;
+    SpiceBoolean isIdFound;
+    bods2c_c( bodyName.c_str( ), &bodyNaifId, &isIdFound );
+    if( !isIdFound )
+    {
+        throw std::runtime_error( "Error, could not find NAIF ID of body " + bodyName + " in Spice." );
+    }
+
+    cachedNaifIds[ bodyName ] = static_cast< int >( bodyNaifId );
+    return static_cast< int >( bodyNaifId );
+}
+
+//! Function to compute state with Spice from NAIF IDs; Spice mutex must be locked.
+static Vector6d getBodyCartesianStateFromNaifIdsWithLockedMutex(
+        const int targetNaifId, const int observerNaifId,
+        const std::string& referenceFrameName, const std::string& abberationCorrections,
+        const double ephemerisTime )
+{
+    double stateAtEpoch[ 6 ];
+    double lightTime;
+    spkez_c( targetNaifId, ephemerisTime, referenceFrameName.c_str( ), abberationCorrections.c_str( ),
+             observerNaifId, stateAtEpoch, &lightTime );
+
+    // Convert from km(/s) to m(/s).
+    return unit_conversions::convertKilometersToMeters< Vector6d >( Eigen::Map< Vector6d >( stateAtEpoch ) );
+}
+
+//! Function to retrieve the mutex by which all calls to Spice through the thread-safe functions are serialized.
+std::mutex& getSpiceMutex( )
+{
+    static std::mutex spiceMutex;
+    return spiceMutex;
+}
+
+//! Function to (thread-safely) convert a body name to its NAIF identification number, using a cache.
+int getCachedNaifId( const std::string& bodyName )
+{
+    std::lock_guard< std::mutex > spiceLock( getSpiceMutex( ) );
+    return getCachedNaifIdWithLockedMutex( bodyName );
+}
+
+//! Function to (thread-safely) get Cartesian state of a body, as observed from another body.
+Vector6d getBodyCartesianStateAtEpochThreadSafe(
+        const std::string& targetBodyName, const std::string& observerBodyName,
+        const std::string& referenceFrameName, const std::string& abberationCorrections,
+        const double ephemerisTime )
+{
+    // Check if state is in cache of this thread.
+    SpiceRequestKey requestKey =
+    { targetBodyName, observerBodyName, referenceFrameName, abberationCorrections, ephemerisTime };
+    Vector6d cartesianState;
+    if( stateCache.getValue( requestKey, cartesianState ) )
+    {
+        return cartesianState;
+    }
+
+    // Compute state with Spice, and add to cache.
+    unsigned int cacheGeneration;
+    {
+        std::lock_guard< std::mutex > spiceLock( getSpiceMutex( ) );
+        cacheGeneration = spiceGatewayCacheGeneration.load( );
+        cartesianState = getBodyCartesianStateFromNaifIdsWithLockedMutex(
+                    getCachedNaifIdWithLockedMutex( targetBodyName ),
+                    getCachedNaifIdWithLockedMutex( observerBodyName ),
+                    referenceFrameName, abberationCorrections, ephemerisTime );
+    }
+    stateCache.setValue( requestKey, cartesianState, cacheGeneration );
+
+    return cartesianState;
+}
+
+//! Function to (thread-safely) get Cartesian states of a body at a list of epochs, as observed from another body.
+std::vector< Vector6d > getBodyCartesianStatesAtEpochs(
+        const std::string& targetBodyName, const std::string& observerBodyName,
+        const std::string& referenceFrameName, const std::string& abberationCorrections,
+        const std::vector< double >& ephemerisTimes )
+{
+    std::vector< Vector6d > cartesianStates( ephemerisTimes.size( ) );
+
+    std::lock_guard< std::mutex > spiceLock( getSpiceMutex( ) );
+    const int targetNaifId = getCachedNaifIdWithLockedMutex( targetBodyName );
+    const int observerNaifId = getCachedNaifIdWithLockedMutex( observerBodyName );
+    for( unsigned int i = 0; i < ephemerisTimes.size( ); i++ )
+    {
+        cartesianStates[ i ] = getBodyCartesianStateFromNaifIdsWithLockedMutex(
+                    targetNaifId, observerNaifId, referenceFrameName, abberationCorrections, ephemerisTimes[ i ] );
+    }
+
+    return cartesianStates;
+}
+
+//! Function to (thread-safely) compute quaternion of rotation between two frames.
+Eigen::Quaterniond computeRotationQuaternionBetweenFramesThreadSafe( const std::string& originalFrame,
+                                                                     const std::string& newFrame,
+                                                                     const double ephemerisTime )
+{
+    // Check if rotation is in cache of this thread.
+    SpiceRequestKey requestKey = { originalFrame, newFrame, "", "", ephemerisTime };
+    Eigen::Quaterniond rotation;
+    if( rotationCache.getValue( requestKey, rotation ) )
+    {
+        return rotation;
+    }
+
+    // Compute rotation with Spice, and add to cache.
+    unsigned int cacheGeneration;
+    {
+        std::lock_guard< std::mutex > spiceLock( getSpiceMutex( ) );
+        cacheGeneration = spiceGatewayCacheGeneration.load( );
+        rotation = computeRotationQuaternionBetweenFrames( originalFrame, newFrame, ephemerisTime );
+    }
+    rotationCache.setValue( requestKey, rotation, cacheGeneration );
+
+    return rotation;
+}
+
+//! Function to (thread-safely) compute quaternions of rotation between two frames at a list of epochs.
+std::vector< Eigen::Quaterniond > computeRotationQuaternionsBetweenFrames( const std::string& originalFrame,
+                                                                           const std::string& newFrame,
+                                                                           const std::vector< double >& ephemerisTimes )
+{
+    std::vector< Eigen::Quaterniond > rotations( ephemerisTimes.size( ) );
+
+    std::lock_guard< std::mutex > spiceLock( getSpiceMutex( ) );
+    for( unsigned int i = 0; i < ephemerisTimes.size( ); i++ )
+    {
+        rotations[ i ] = computeRotationQuaternionBetweenFrames( originalFrame, newFrame, ephemerisTimes[ i ] );
+    }
+
+    return rotations;
+}
+
+//! Function to (thread-safely) compute rotation quaternion and derivative of rotation matrix between two frames.
+std::pair< Eigen::Quaterniond, Eigen::Matrix3d >
+computeRotationQuaternionAndRotationMatrixDerivativeBetweenFramesThreadSafe(
+        const std::string& originalFrame, const std::string& newFrame, const double ephemerisTime )
+{
+    // Check if rotation is in cache of this thread.
+    SpiceRequestKey requestKey = { originalFrame, newFrame, "", "", ephemerisTime };
+    std::pair< Eigen::Quaterniond, Eigen::Matrix3d > fullRotation;
+    if( fullRotationCache.getValue( requestKey, fullRotation ) )
+    {
+        return fullRotation;
+    }
+
+    // Compute rotation with Spice, and add to cache.
+    unsigned int cacheGeneration;
+    {
+        std::lock_guard< std::mutex > spiceLock( getSpiceMutex( ) );
+        cacheGeneration = spiceGatewayCacheGeneration.load( );
+        fullRotation = computeRotationQuaternionAndRotationMatrixDerivativeBetweenFrames(
+                    originalFrame, newFrame, ephemerisTime );
+    }
+    fullRotationCache.setValue( requestKey, fullRotation, cacheGeneration );
+
+    return fullRotation;
+}
+
+//! Function to reset all caches of the Spice gateway.
+void resetSpiceGatewayCaches( )
+{
+    std::lock_guard< std::mutex > spiceLock( getSpiceMutex( ) );
+    cachedNaifIds.clear( );
+    spiceGatewayCacheGeneration++;
+}
+
+} // namespace spice_interface
+
+} // namespace tudat
@@ -0,0 +1,141 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      The CSPICE library uses global state (kernel pool, error status, internal buffers), and its functions may
+ *      therefore not be called concurrently from multiple threads. The functions in this file serialize all calls to
+ *      Spice through a single mutex, so that they may be used from any number of threads. The functions in
+ *      spiceInterface.h (except for loading and clearing kernels) are not protected in this way, and should only be
+ *      used from a single thread (or while holding the mutex returned by getSpiceMutex).
+ */
+
+#ifndef TUDAT_SPICE_GATEWAY_H
+#define TUDAT_SPICE_GATEWAY_H
+
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include "Tudat/Mathematics/BasicMathematics/linearAlgebraTypes.h"
+
+namespace tudat
+{
+
+namespace spice_interface
+{
+
+//! Function to retrieve the mutex by which all calls to Spice through the thread-safe functions are serialized.
+/*!
+ *  Function to retrieve the mutex by which all calls to Spice through the thread-safe functions in this file are
+ *  serialized. Code calling other Spice functions from multiple threads should lock this mutex as well.
+ *  \return Mutex by which all calls to Spice are serialized.
+ */
+std::mutex& getSpiceMutex( );
+
+//! Function to (thread-safely) convert a body name to its NAIF identification number, using a cache.
+/*!
+ *  Function to (thread-safely) convert a body name to its NAIF identification number. The name is resolved by Spice
+ *  only once, after which the identifier is retrieved from a cache (until resetSpiceGatewayCaches is called).
+ *  \param bodyName Name of the body (or NAIF ID as string).
+ *  \return NAIF identification number of the body.
+ */
+int getCachedNaifId( const std::string& bodyName );
+
+//! Function to (thread-safely) get Cartesian state of a body, as observed from another body.
+/*!
+ *  Function to (thread-safely) get Cartesian state of a body, as observed from another body (see
+ *  getBodyCartesianStateAtEpoch for a description of the input). The body names are converted to NAIF IDs once
+ *  (see getCachedNaifId), and the call to Spice is serialized with all other calls through this gateway. The most
+ *  recent results are cached per thread, so that repeated requests for the same state (e.g. by different
+ *  acceleration models at the same time) do not require a call to Spice.
+ *  \param targetBodyName Name of the body of which the state is to be obtained.
+ *  \param observerBodyName Name of the body relative to which the state is to be obtained.
+ *  \param referenceFrameName Spice-recognized name of the reference frame in which the state is to be returned.
+ *  \param abberationCorrections Setting for abberation corrections (see getBodyCartesianStateAtEpoch).
+ *  \param ephemerisTime Observation time (or transmission time of observed light).
+ *  \return Cartesian state vector (x,y,z, position+velocity).
+ */
+basic_mathematics::Vector6d getBodyCartesianStateAtEpochThreadSafe(
+        const std::string& targetBodyName, const std::string& observerBodyName,
+        const std::string& referenceFrameName, const std::string& abberationCorrections,
+        const double ephemerisTime );
+
+//! Function to (thread-safely) get Cartesian states of a body at a list of epochs, as observed from another body.
+/*!
+ *  Function to (thread-safely) get Cartesian states of a body at a list of epochs, as observed from another body,
+ *  using a single lock of the Spice mutex and a single resolution of the body names for all epochs.
+ *  \param targetBodyName Name of the body of which the states are to be obtained.
+ *  \param observerBodyName Name of the body relative to which the states are to be obtained.
+ *  \param referenceFrameName Spice-recognized name of the reference frame in which the states are to be returned.
+ *  \param abberationCorrections Setting for abberation corrections (see getBodyCartesianStateAtEpoch).
+ *  \param ephemerisTimes Observation times (or transmission times of observed light).
+ *  \return Cartesian state vectors (x,y,z, position+velocity), in the same order as ephemerisTimes.
+ */
+std::vector< basic_mathematics::Vector6d > getBodyCartesianStatesAtEpochs(
+        const std::string& targetBodyName, const std::string& observerBodyName,
+        const std::string& referenceFrameName, const std::string& abberationCorrections,
+        const std::vector< double >& ephemerisTimes );
+
+//! Function to (thread-safely) compute quaternion of rotation between two frames.
+/*!
+ *  Function to (thread-safely) compute quaternion of rotation between two frames (see
+ *  computeRotationQuaternionBetweenFrames), with per-thread caching of the most recent results.
+ *  \param originalFrame Reference frame from which the rotation is made.
+ *  \param newFrame Reference frame to which the rotation is made.
+ *  \param ephemerisTime Value of ephemeris time at which rotation is to be determined.
+ *  \return Rotation quaternion from original to new frame at given time.
+ */
+Eigen::Quaterniond computeRotationQuaternionBetweenFramesThreadSafe( const std::string& originalFrame,
+                                                                     const std::string& newFrame,
+                                                                     const double ephemerisTime );
+
+//! Function to (thread-safely) compute quaternions of rotation between two frames at a list of epochs.
+/*!
+ *  Function to (thread-safely) compute quaternions of rotation between two frames at a list of epochs, using a
+ *  single lock of the Spice mutex.
+ *  \param originalFrame Reference frame from which the rotation is made.
+ *  \param newFrame Reference frame to which the rotation is made.
+ *  \param ephemerisTimes Values of ephemeris time at which rotation is to be determined.
+ *  \return Rotation quaternions from original to new frame, in the same order as ephemerisTimes.
+ */
+std::vector< Eigen::Quaterniond > computeRotationQuaternionsBetweenFrames( const std::string& originalFrame,
+                                                                           const std::string& newFrame,
+                                                                           const std::vector< double >& ephemerisTimes );
+
+//! Function to (thread-safely) compute rotation quaternion and derivative of rotation matrix between two frames.
+/*!
+ *  Function to (thread-safely) compute rotation quaternion and time derivative of rotation matrix between two frames
+ *  (see computeRotationQuaternionAndRotationMatrixDerivativeBetweenFrames), with per-thread caching of the most
+ *  recent results.
+ *  \param originalFrame Reference frame from which the rotation is made.
+ *  \param newFrame Reference frame to which the rotation is made.
+ *  \param ephemerisTime Value of ephemeris time at which rotation is to be determined.
+ *  \return Pair of rotation quaternion and time derivative of rotation matrix from original to new frame.
+ */
+std::pair< Eigen::Quaterniond, Eigen::Matrix3d >
+computeRotationQuaternionAndRotationMatrixDerivativeBetweenFramesThreadSafe(
+        const std::string& originalFrame, const std::string& newFrame, const double ephemerisTime );
+
+//! Function to reset all caches of the Spice gateway.
+/*!
+ *  Function to reset all caches of the Spice gateway (NAIF IDs and per-thread results of all threads). Must be called
+ *  when the kernel pool is modified other than through loadSpiceKernelInTudat or clearSpiceKernels (which reset the
+ *  caches automatically).
+ */
+void resetSpiceGatewayCaches( );
+
+} // namespace spice_interface
+
+} // namespace tudat
+
+#endif // TUDAT_SPICE_GATEWAY_H
@@ -35,9 +35,13 @@
  */
 
 
+#include <ctime>
+
+#include <boost/filesystem.hpp>
 #include <boost/lexical_cast.hpp>
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/unitConversions.h"
+#include "Tudat/External/SpiceInterface/spiceGateway.h"
 #include "Tudat/External/SpiceInterface/spiceInterface.h"
 
 namespace tudat
@@ -292,7 +296,11 @@ bool checkBodyPropertyInKernelPool( const std::string& bodyName, const std::stri
 //! Load a Spice kernel.
 void loadSpiceKernelInTudat( const std::string& fileName )
 {
-    furnsh_c(  fileName.c_str( ) );
+    {
+        std::lock_guard< std::mutex > spiceLock( getSpiceMutex( ) );
+        furnsh_c(  fileName.c_str( ) );
+    }
+    resetSpiceGatewayCaches( );
 }
 
 //! Get the amount of loaded Spice kernels.
@@ -303,8 +311,70 @@ int getTotalCountOfKernelsLoaded( )
     return count;
 }
 
+//! Get the file names of the loaded Spice kernels.
+std::vector< std::string > getLoadedSpiceKernelFiles( )
+{
+    std::lock_guard< std::mutex > spiceLock( getSpiceMutex( ) );
+
+    SpiceInt count;
+    ktotal_c( "ALL", &count );
+
+    std::vector< std::string > kernelFiles;
+    const SpiceInt maximumFileNameLength = 1024;
+    const SpiceInt maximumFileTypeLength = 32;
+    SpiceChar fileName[ maximumFileNameLength ];
+    SpiceChar fileType[ maximumFileTypeLength ];
+    SpiceChar sourceFileName[ maximumFileNameLength ];
+    SpiceInt handle;
+    SpiceBoolean isKernelFound;
+    for( SpiceInt i = 0; i < count; i++ )
+    {
+        kdata_c( i, "ALL", maximumFileNameLength, maximumFileTypeLength, maximumFileNameLength,
+                 fileName, fileType, sourceFileName, &handle, &isKernelFound );
+        if( isKernelFound )
+        {
+            kernelFiles.push_back( fileName );
+        }
+    }
+    return kernelFiles;
+}
+
+//! Get an identifier of the set of loaded Spice kernels.
+std::string getLoadedSpiceKernelsIdentifier( )
+{
+    const std::vector< std::string > kernelFiles = getLoadedSpiceKernelFiles( );
+
+    std::string kernelsIdentifier;
+    for( unsigned int i = 0; i < kernelFiles.size( ); i++ )
+    {
+        kernelsIdentifier += "kernel=" + kernelFiles.at( i );
+
+        // Add size and modification time, if the file can be accessed.
+        boost::system::error_code fileError;
+        const boost::uintmax_t fileSize = boost::filesystem::file_size( kernelFiles.at( i ), fileError );
+        if( !fileError )
+        {
+            kernelsIdentifier += ",size=" + boost::lexical_cast< std::string >( fileSize );
+        }
+        const std::time_t modificationTime = boost::filesystem::last_write_time( kernelFiles.at( i ), fileError );
+        if( !fileError )
+        {
+            kernelsIdentifier += ",modified=" + boost::lexical_cast< std::string >( modificationTime );
+        }
+        kernelsIdentifier += ";";
+    }
+    return kernelsIdentifier;
+}
+
 //! Clear all Spice kernels.
-void clearSpiceKernels( ) { kclear_c( ); }
+void clearSpiceKernels( )
+{
+    {
+        std::lock_guard< std::mutex > spiceLock( getSpiceMutex( ) );
+        kclear_c( );
+    }
+    resetSpiceGatewayCaches( );
+}
 
 } // namespace spice_interface
 } // namespace tudat
@@ -263,7 +263,8 @@ bool checkBodyPropertyInKernelPool( const std::string& bodyName, const std::stri
  * This function loads a Spice kernel into the kernel pool, from which it can be used by the
  * various internal spice routines. Matters regarding the manner in which Spice handles different
  * kernels containing the same information can be found in the spice required reading
- * documentation, kernel section. Wrapper for the furnsh_c function.
+ * documentation, kernel section. Wrapper for the furnsh_c function, which is serialized with the
+ * functions in spiceGateway.h, and resets the caches of those functions.
  * \param fileName The file name of the Kernel to be loaded.
  */
 void loadSpiceKernelInTudat( const std::string& fileName );
@@ -276,9 +277,28 @@ void loadSpiceKernelInTudat( const std::string& fileName );
  */
 int getTotalCountOfKernelsLoaded( );
 
+//! Get the file names of the loaded Spice kernels.
+/*!
+ * This function returns the file names of the Spice kernels that are loaded into the kernel pool, in the order in
+ * which they were loaded (including kernels loaded by meta-kernels). Wrapper for the kdata_c function.
+ * \return File names of loaded Spice kernels.
+ */
+std::vector< std::string > getLoadedSpiceKernelFiles( );
+
+//! Get an identifier of the set of loaded Spice kernels.
+/*!
+ * This function returns an identifier of the set of Spice kernels that are loaded into the kernel pool, composed of
+ * the file name, size and last modification time of each loaded kernel (in the order in which they were loaded).
+ * The identifier changes when kernels are loaded, unloaded or modified, so that it may be used to identify data
+ * derived from the kernels (e.g. in a cache of tabulated Spice ephemerides).
+ * \return Identifier of the set of loaded Spice kernels.
+ */
+std::string getLoadedSpiceKernelsIdentifier( );
+
 //! Clear all Spice kernels.
 /*!
- * This function removes all Spice kernels from the kernel pool. Wrapper for the kclear_c function.
+ * This function removes all Spice kernels from the kernel pool. Wrapper for the kclear_c function,
+ * which is serialized with the functions in spiceGateway.h, and resets the caches of those functions.
  */
 void clearSpiceKernels( );
 
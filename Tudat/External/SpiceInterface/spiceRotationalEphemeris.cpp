@@ -5,6 +5,7 @@
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/timeConversions.h"
+#include "Tudat/External/SpiceInterface/spiceGateway.h"
 #include "Tudat/External/SpiceInterface/spiceInterface.h"
 #include "Tudat/External/SpiceInterface/spiceRotationalEphemeris.h"
 
@@ -28,7 +29,7 @@ Eigen::Quaterniond SpiceRotationalEphemeris::getRotationToBaseFrame(
     }
 
     // Get rotational quaternion from spice wrapper function
-    return spice_interface::computeRotationQuaternionBetweenFrames(
+    return spice_interface::computeRotationQuaternionBetweenFramesThreadSafe(
                 targetFrameOrientation_, baseFrameOrientation_, ephemerisTime );
 }
 
@@ -46,8 +47,8 @@ Eigen::Matrix3d SpiceRotationalEphemeris::getDerivativeOfRotationToBaseFrame(
     }
 
     // Get rotation matrix derivative from spice wrapper function
-    return spice_interface::computeRotationMatrixDerivativeBetweenFrames(
-                targetFrameOrientation_, baseFrameOrientation_, ephemerisTime );
+    return spice_interface::computeRotationQuaternionAndRotationMatrixDerivativeBetweenFramesThreadSafe(
+                targetFrameOrientation_, baseFrameOrientation_, ephemerisTime ).second;
 }
 
 //! Function to calculate the full rotational state at given time
@@ -67,7 +68,7 @@ void SpiceRotationalEphemeris::getFullRotationalQuantitiesToTargetFrame(
 
     // Calculate rotation (and its time derivative) directly from spice.
     std::pair< Eigen::Quaterniond, Eigen::Matrix3d > fullRotation =
-            spice_interface::computeRotationQuaternionAndRotationMatrixDerivativeBetweenFrames(
+            spice_interface::computeRotationQuaternionAndRotationMatrixDerivativeBetweenFramesThreadSafe(
                 baseFrameOrientation_, targetFrameOrientation_, ephemerisTime );
     currentRotationToLocalFrame = fullRotation.first;
     currentRotationToLocalFrameDerivative = fullRotation.second;
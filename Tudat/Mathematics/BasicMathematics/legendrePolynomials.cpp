@@ -88,9 +88,9 @@ LegendreCache::LegendreCache( const int maximumDegree, const int maximumOrder, c
 }
 
 //! Get Legendre polynomial from cache when possible, and from direct computation otherwise.
-void LegendreCache::update( const double polynomialParameter  )
+void LegendreCache::update( const double polynomialParameter, const int maximumDegreeToUpdate )
 {
-    // Check if cache needs update
+    // Check if polynomial parameter has changed
     if( !( polynomialParameter == currentPolynomialParameter_ ) )
     {
         currentPolynomialParameter_ = polynomialParameter;
@@ -98,10 +98,23 @@ void LegendreCache::update( const double polynomialParameter  )
         // Set complement of argument (assuming it to be sine of latitude) cosine of latitude is always positive.
         currentPolynomialParameterComplement_ = std::sqrt( 1.0 - polynomialParameter * polynomialParameter );
 
+        currentMaximumUpdatedDegree_ = -1;
+    }
+
+    // Set degree up to which polynomials are to be computed.
+    const int degreeToUpdate = ( maximumDegreeToUpdate < 0 || maximumDegreeToUpdate > maximumDegree_ ) ?
+                maximumDegree_ : maximumDegreeToUpdate;
+
+    // Check if cache needs update
+    if( degreeToUpdate > currentMaximumUpdatedDegree_ )
+    {
+        const int minimumDegreeToUpdate = currentMaximumUpdatedDegree_ + 1;
+        currentMaximumUpdatedDegree_ = degreeToUpdate;
+
         LegendreCache& thisReference = *this;
 
         int jMax = -1;
-        for( int i = 0; i <= maximumDegree_; i++ )
+        for( int i = minimumDegreeToUpdate; i <= degreeToUpdate; i++ )
         {
             jMax = std::min( i, maximumOrder_ );
             for( int j = 0; j <= jMax ; j++ )
@@ -157,7 +170,7 @@ void LegendreCache::update( const double polynomialParameter  )
         // Compute second derivatives of Legendre polynomials if needed
         if( computeSecondDerivatives_ )
         {
-            for( int i = 0; i <= maximumDegree_; i++ )
+            for( int i = minimumDegreeToUpdate; i <= degreeToUpdate; i++ )
             {
                 jMax = std::min( i, maximumOrder_ );
                 for( int j = 0; j <= jMax ; j++ )
@@ -253,6 +266,7 @@ void LegendreCache::resetMaximumDegreeAndOrder( const int maximumDegree, const i
 
     currentPolynomialParameter_ = TUDAT_NAN;
     currentPolynomialParameterComplement_ = TUDAT_NAN;
+    currentMaximumUpdatedDegree_ = -1;
 }
 
 
@@ -107,11 +107,15 @@ public:
 
     //! Update cache with new polynomial parameter (sine of latitude)
     /*!
-     * Update cache with new polynomial parameter (sine of latitude).
+     * Update cache with new polynomial parameter (sine of latitude). Optionally, the polynomials may be updated only up
+     * to a degree below the maximum degree of the cache. The higher degree polynomials are then computed by a later
+     * call to this function (with the same polynomial parameter) if they are requested.
      * \param polynomialParameter Parameter used as input argument for Legendre polynomials, in astrodynamics
      * applications, this is typically the sine of the body-fixed latitude.
+     * \param maximumDegreeToUpdate Maximum degree up to which the polynomials are to be updated (maximum degree of cache
+     * if negative, default).
      */
-   void update( const double polynomialParameter );
+   void update( const double polynomialParameter, const int maximumDegreeToUpdate = -1 );
 
     //! Function to return the current polynomial parameter (typically sine of latitude)
     /*!
@@ -218,6 +222,9 @@ private:
     //! Current 'complement' to polynomial parameter (cosine of latitude).
     double currentPolynomialParameterComplement_;
 
+    //! Maximum degree up to which the polynomials have been computed for the current polynomial parameter.
+    int currentMaximumUpdatedDegree_;
+
     //! List of current values of Legendre polynomials at degree and order (n,m)
     /*!
      * List of current values of Legendre polynomials at degree and order (n,m). The corresponding polynomial is at entry
@@ -58,6 +58,9 @@ void SphericalHarmonicsCache::resetMaximumDegreeAndOrder( const int maximumDegre
 
     sinesOfLongitude_.resize( maximumOrder_ + 1 );
     cosinesOfLongitude_.resize( maximumOrder_ + 1 );
+    currentLongitude_ = TUDAT_NAN;
+    currentMaximumUpdatedOrder_ = -1;
+    referenceRadiusRatio_ = TUDAT_NAN;
     referenceRadiusRatioPowers_.resize( maximumDegree_ + 2 );
 }
 
@@ -108,12 +108,15 @@ public:
      * \param polynomialParameter Input parameter to Legendre polynomials (sine of latitude)
      * \param longitude Current latitude
      * \param referenceRadius Reference (typically equatorial) radius of gravity field.
+     * \param maximumDegreeToUpdate Maximum degree up to which the Legendre polynomials and multiple longitude sines
+     * and cosines are to be updated (maximum degree of cache if negative, default).
      */
     void update( const double radius, const double polynomialParameter,
-                 const double longitude, const double referenceRadius )
+                 const double longitude, const double referenceRadius,
+                 const int maximumDegreeToUpdate = -1 )
     {
-        legendreCache_->update( polynomialParameter );
-        updateSines( longitude );
+        legendreCache_->update( polynomialParameter, maximumDegreeToUpdate );
+        updateSines( longitude, maximumDegreeToUpdate );
         updateRadiusPowers( referenceRadius / radius );
     }
 
@@ -197,18 +200,29 @@ private:
     /*!
      * Update cached values of sines and cosines of longitude/
      * \param longitude Current longitude.
+     * \param maximumOrderToUpdate Maximum order up to which the sines and cosines are to be updated (maximum order of
+     * cache if negative).
      */
-    void updateSines( const double longitude )
+    void updateSines( const double longitude, const int maximumOrderToUpdate )
     {
-        //! Check if update is needed.
+        //! Check if longitude has changed.
         if( !( currentLongitude_ == longitude ) )
         {
             currentLongitude_ = longitude;
-            for( unsigned int i = 0; i < sinesOfLongitude_.size( ); i++ )
+            currentMaximumUpdatedOrder_ = -1;
+        }
+
+        //! Check if update is needed.
+        const int orderToUpdate = ( maximumOrderToUpdate < 0 || maximumOrderToUpdate > maximumOrder_ ) ?
+                    maximumOrder_ : maximumOrderToUpdate;
+        if( orderToUpdate > currentMaximumUpdatedOrder_ )
+        {
+            for( int i = currentMaximumUpdatedOrder_ + 1; i <= orderToUpdate; i++ )
             {
                 sinesOfLongitude_[ i ] = std::sin( static_cast< double >( i ) * longitude );
                 cosinesOfLongitude_[ i ] = std::cos( static_cast< double >( i ) * longitude );
             }
+            currentMaximumUpdatedOrder_ = orderToUpdate;
         }
     }
 
@@ -241,6 +255,9 @@ private:
     //! Current longitude.
     double currentLongitude_;
 
+    //! Maximum order up to which the sines and cosines have been computed for the current longitude.
+    int currentMaximumUpdatedOrder_;
+
     //! Current ratio of distance to reference radius
     double referenceRadiusRatio_;
 
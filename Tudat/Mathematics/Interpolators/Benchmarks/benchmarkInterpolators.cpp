@@ -0,0 +1,402 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/array.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/multi_array.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/Interpolators/createInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/multiLinearInterpolator.h"
+
+using namespace tudat;
+using namespace tudat::interpolators;
+
+//! Vector type of size 6, as used for Cartesian states.
+typedef Eigen::Matrix< double, 6, 1 > Vector6d;
+
+//! Number of interpolations performed per benchmark case.
+const int numberOfEvaluations = 100000;
+
+//! Number of interpolations performed before timing of each benchmark case.
+const int numberOfWarmUpEvaluations = 1000;
+
+//! Function to create dependent variable value (or its derivative) of benchmark data at a given independent variable.
+template< typename DependentVariableType >
+DependentVariableType getBenchmarkDependentValue( const double independentVariable, const bool getDerivative );
+
+template< >
+double getBenchmarkDependentValue< double >( const double independentVariable, const bool getDerivative )
+{
+    return getDerivative ? 0.01 * std::cos( 0.01 * independentVariable ) : std::sin( 0.01 * independentVariable );
+}
+
+template< >
+long double getBenchmarkDependentValue< long double >( const double independentVariable, const bool getDerivative )
+{
+    return static_cast< long double >( getBenchmarkDependentValue< double >( independentVariable, getDerivative ) );
+}
+
+template< >
+Vector6d getBenchmarkDependentValue< Vector6d >( const double independentVariable, const bool getDerivative )
+{
+    Vector6d dependentValue;
+    for( int i = 0; i < 6; i++ )
+    {
+        dependentValue( i ) = static_cast< double >( i + 1 ) *
+                getBenchmarkDependentValue< double >( independentVariable + 100.0 * i, getDerivative );
+    }
+    return dependentValue;
+}
+
+template< >
+Eigen::MatrixXd getBenchmarkDependentValue< Eigen::MatrixXd >(
+        const double independentVariable, const bool getDerivative )
+{
+    Eigen::MatrixXd dependentValue( 3, 3 );
+    for( int i = 0; i < 9; i++ )
+    {
+        dependentValue( i / 3, i % 3 ) = static_cast< double >( i + 1 ) *
+                getBenchmarkDependentValue< double >( independentVariable + 50.0 * i, getDerivative );
+    }
+    return dependentValue;
+}
+
+//! Function to retrieve name of dependent variable type, for output.
+template< typename DependentVariableType >
+std::string getDependentVariableTypeName( );
+
+template< >
+std::string getDependentVariableTypeName< double >( ){ return "double"; }
+
+template< >
+std::string getDependentVariableTypeName< long double >( ){ return "long_double"; }
+
+template< >
+std::string getDependentVariableTypeName< Vector6d >( ){ return "Vector6d"; }
+
+template< >
+std::string getDependentVariableTypeName< Eigen::MatrixXd >( ){ return "MatrixXd"; }
+
+//! Function to retrieve contribution of interpolated value to checksum (prevents optimizing out interpolation).
+double getChecksumContribution( const double interpolatedValue )
+{
+    return interpolatedValue;
+}
+
+//! Function to retrieve contribution of interpolated value to checksum (prevents optimizing out interpolation).
+double getChecksumContribution( const long double interpolatedValue )
+{
+    return static_cast< double >( interpolatedValue );
+}
+
+//! Function to retrieve contribution of interpolated value to checksum (prevents optimizing out interpolation).
+template< typename ScalarType, int Rows, int Columns, int Options, int MaximumRows, int MaximumColumns >
+double getChecksumContribution(
+        const Eigen::Matrix< ScalarType, Rows, Columns, Options, MaximumRows, MaximumColumns >& interpolatedValue )
+{
+    return static_cast< double >( interpolatedValue.sum( ) );
+}
+
+//! Function to retrieve name of lookup scheme, for output.
+std::string getLookupSchemeName( const AvailableLookupScheme lookupScheme )
+{
+    switch( lookupScheme )
+    {
+    case huntingAlgorithm:
+        return "hunting";
+    case binarySearch:
+        return "binary_search";
+    case uniformGridLookup:
+        return "uniform_grid";
+    case piecewiseUniformGridLookup:
+        return "piecewise_uniform_grid";
+    default:
+        throw std::runtime_error( "Error, lookup scheme not recognized in interpolator benchmark." );
+    }
+}
+
+//! Function to create independent variable grid of benchmark data.
+/*!
+ *  Function to create independent variable grid of benchmark data, with either uniform spacing, or spacing that grows
+ *  linearly over the grid (so that the ratio of the largest and smallest spacing is large, and the selected hunting or
+ *  binary search lookup scheme is retained, see getBestSuitedLookupScheme).
+ *  \param numberOfNodes Number of nodes in the grid.
+ *  \param useUniformGrid Boolean denoting whether a uniform grid is to be created.
+ *  \return Independent variable grid on interval [0, 1000].
+ */
+std::vector< double > getBenchmarkGrid( const int numberOfNodes, const bool useUniformGrid )
+{
+    std::vector< double > grid;
+    for( int i = 0; i < numberOfNodes; i++ )
+    {
+        const double fraction = static_cast< double >( i ) / static_cast< double >( numberOfNodes - 1 );
+        grid.push_back( 1000.0 * ( useUniformGrid ? fraction : fraction * fraction ) );
+    }
+    return grid;
+}
+
+//! Function to create sequential (ascending) or random query values in interval [0, 1000].
+std::vector< double > getBenchmarkQueryValues( const bool useRandomQueries, boost::random::mt19937& randomGenerator )
+{
+    boost::random::uniform_real_distribution< double > distribution( 0.0, 1000.0 );
+    std::vector< double > queryValues;
+    for( int i = 0; i < numberOfEvaluations; i++ )
+    {
+        queryValues.push_back(
+                    useRandomQueries ? distribution( randomGenerator ) :
+                                       1000.0 * static_cast< double >( i ) / static_cast< double >( numberOfEvaluations ) );
+    }
+    return queryValues;
+}
+
+//! Function to print single benchmark result as line of CSV output.
+void printBenchmarkResult( const std::string& interpolatorName, const int numberOfDimensions,
+                           const std::string& dependentVariableTypeName, const bool useUniformGrid,
+                           const AvailableLookupScheme selectedLookupScheme,
+                           const AvailableLookupScheme usedLookupScheme, const bool useRandomQueries,
+                           const boost::posix_time::ptime& startTime, const double checksum )
+{
+    const double elapsedTime = static_cast< double >(
+                ( boost::posix_time::microsec_clock::local_time( ) - startTime ).total_microseconds( ) ) * 1.0E-6;
+
+    std::cout << std::setprecision( 6 ) << interpolatorName << "," << numberOfDimensions << ","
+              << dependentVariableTypeName << "," << ( useUniformGrid ? "uniform" : "nonuniform" ) << ","
+              << getLookupSchemeName( selectedLookupScheme ) << "," << getLookupSchemeName( usedLookupScheme ) << ","
+              << ( useRandomQueries ? "random" : "sequential" ) << "," << numberOfEvaluations << ","
+              << elapsedTime / static_cast< double >( numberOfEvaluations ) * 1.0E9 << ","
+              << std::setprecision( 12 ) << checksum << std::endl;
+}
+
+//! Function to benchmark one-dimensional interpolators of given dependent variable type.
+/*!
+ *  Function to benchmark linear, cubic spline, Hermite cubic spline and Lagrange (orders 4 to 12) interpolators of
+ *  given dependent variable type, for uniform and nonuniform grids, hunting and binary search lookup schemes and
+ *  sequential and random queries.
+ *  \param randomGenerator Random number generator used for random queries.
+ */
+template< typename DependentVariableType >
+void benchmarkOneDimensionalInterpolators( boost::random::mt19937& randomGenerator )
+{
+    const int numberOfNodes = 1001;
+
+    std::vector< boost::shared_ptr< InterpolatorSettings > > interpolatorSettingsList;
+    std::vector< std::string > interpolatorNames;
+    interpolatorSettingsList.push_back( boost::make_shared< InterpolatorSettings >( linear_interpolator ) );
+    interpolatorNames.push_back( "linear" );
+    interpolatorSettingsList.push_back( boost::make_shared< InterpolatorSettings >( cubic_spline_interpolator ) );
+    interpolatorNames.push_back( "cubic_spline" );
+    interpolatorSettingsList.push_back( boost::make_shared< InterpolatorSettings >( hermite_spline_interpolator ) );
+    interpolatorNames.push_back( "hermite_cubic_spline" );
+    for( int order = 4; order <= 12; order += 2 )
+    {
+        interpolatorSettingsList.push_back( boost::make_shared< LagrangeInterpolatorSettings >( order ) );
+        interpolatorNames.push_back( "lagrange_" + boost::lexical_cast< std::string >( order ) );
+    }
+
+    AvailableLookupScheme lookupSchemes[ 2 ] = { huntingAlgorithm, binarySearch };
+    for( int gridIndex = 0; gridIndex < 2; gridIndex++ )
+    {
+        // Create benchmark data.
+        const bool useUniformGrid = ( gridIndex == 0 );
+        const std::vector< double > grid = getBenchmarkGrid( numberOfNodes, useUniformGrid );
+        std::map< double, DependentVariableType > dataMap;
+        std::vector< DependentVariableType > derivativeValues;
+        for( unsigned int i = 0; i < grid.size( ); i++ )
+        {
+            dataMap[ grid.at( i ) ] = getBenchmarkDependentValue< DependentVariableType >( grid.at( i ), false );
+            derivativeValues.push_back( getBenchmarkDependentValue< DependentVariableType >( grid.at( i ), true ) );
+        }
+
+        for( int queryIndex = 0; queryIndex < 2; queryIndex++ )
+        {
+            const bool useRandomQueries = ( queryIndex == 1 );
+            const std::vector< double > queryValues = getBenchmarkQueryValues( useRandomQueries, randomGenerator );
+
+            for( unsigned int i = 0; i < interpolatorSettingsList.size( ); i++ )
+            {
+                for( int j = 0; j < 2; j++ )
+                {
+                    // Create interpolator with current lookup scheme.
+                    boost::shared_ptr< InterpolatorSettings > interpolatorSettings;
+                    if( boost::dynamic_pointer_cast< LagrangeInterpolatorSettings >(
+                                interpolatorSettingsList.at( i ) ) != NULL )
+                    {
+                        interpolatorSettings = boost::make_shared< LagrangeInterpolatorSettings >(
+                                    boost::dynamic_pointer_cast< LagrangeInterpolatorSettings >(
+                                        interpolatorSettingsList.at( i ) )->getInterpolatorOrder( ),
+                                    false, lookupSchemes[ j ] );
+                    }
+                    else
+                    {
+                        interpolatorSettings = boost::make_shared< InterpolatorSettings >(
+                                    interpolatorSettingsList.at( i )->getInterpolatorType( ), lookupSchemes[ j ] );
+                    }
+                    boost::shared_ptr< OneDimensionalInterpolator< double, DependentVariableType > > interpolator =
+                            createOneDimensionalInterpolator( dataMap, interpolatorSettings, derivativeValues );
+
+                    // Time interpolation.
+                    double checksum = 0.0;
+                    for( int k = 0; k < numberOfWarmUpEvaluations; k++ )
+                    {
+                        checksum += getChecksumContribution( interpolator->interpolate( queryValues.at( k ) ) );
+                    }
+                    checksum = 0.0;
+
+                    boost::posix_time::ptime startTime = boost::posix_time::microsec_clock::local_time( );
+                    for( int k = 0; k < numberOfEvaluations; k++ )
+                    {
+                        checksum += getChecksumContribution( interpolator->interpolate( queryValues[ k ] ) );
+                    }
+                    printBenchmarkResult( interpolatorNames.at( i ), 1,
+                                          getDependentVariableTypeName< DependentVariableType >( ),
+                                          useUniformGrid, lookupSchemes[ j ],
+                                          getBestSuitedLookupScheme( grid, lookupSchemes[ j ] ),
+                                          useRandomQueries, startTime, checksum );
+                }
+            }
+        }
+    }
+}
+
+//! Function to benchmark multi-linear interpolator of given dimension and dependent variable type.
+/*!
+ *  Function to benchmark multi-linear interpolator of given dimension and dependent variable type, for uniform and
+ *  nonuniform grids, hunting and binary search lookup schemes and sequential (along the diagonal of the grid) and
+ *  random queries.
+ *  \param numberOfNodesPerDimension Number of grid nodes in each dimension.
+ *  \param randomGenerator Random number generator used for random queries.
+ */
+template< typename DependentVariableType, int NumberOfDimensions >
+void benchmarkMultiLinearInterpolator( const int numberOfNodesPerDimension,
+                                       boost::random::mt19937& randomGenerator )
+{
+    boost::array< std::size_t, NumberOfDimensions > gridShape;
+    gridShape.fill( static_cast< std::size_t >( numberOfNodesPerDimension ) );
+
+    AvailableLookupScheme lookupSchemes[ 2 ] = { huntingAlgorithm, binarySearch };
+    for( int gridIndex = 0; gridIndex < 2; gridIndex++ )
+    {
+        // Create benchmark data, with value depending on sum of independent variables.
+        const bool useUniformGrid = ( gridIndex == 0 );
+        const std::vector< double > grid = getBenchmarkGrid( numberOfNodesPerDimension, useUniformGrid );
+        std::vector< std::vector< double > > independentValues( NumberOfDimensions, grid );
+
+        boost::multi_array< DependentVariableType, NumberOfDimensions > dependentData( gridShape );
+        for( std::size_t i = 0; i < dependentData.num_elements( ); i++ )
+        {
+            std::size_t remainingIndex = i;
+            double independentVariableSum = 0.0;
+            for( int dimension = NumberOfDimensions - 1; dimension >= 0; dimension-- )
+            {
+                independentVariableSum += grid.at( remainingIndex % numberOfNodesPerDimension );
+                remainingIndex /= numberOfNodesPerDimension;
+            }
+            dependentData.data( )[ i ] = getBenchmarkDependentValue< DependentVariableType >(
+                        independentVariableSum / static_cast< double >( NumberOfDimensions ), false );
+        }
+
+        for( int queryIndex = 0; queryIndex < 2; queryIndex++ )
+        {
+            // Create query points (sequential queries are along the diagonal of the grid).
+            const bool useRandomQueries = ( queryIndex == 1 );
+            std::vector< std::vector< double > > queryPoints(
+                        numberOfEvaluations, std::vector< double >( NumberOfDimensions ) );
+            for( int dimension = 0; dimension < NumberOfDimensions; dimension++ )
+            {
+                const std::vector< double > queryValues =
+                        getBenchmarkQueryValues( useRandomQueries, randomGenerator );
+                for( int k = 0; k < numberOfEvaluations; k++ )
+                {
+                    queryPoints[ k ][ dimension ] = queryValues.at( k );
+                }
+            }
+
+            for( int j = 0; j < 2; j++ )
+            {
+                MultiLinearInterpolator< double, DependentVariableType, NumberOfDimensions > interpolator(
+                            independentValues, dependentData, lookupSchemes[ j ] );
+
+                // Time interpolation.
+                double checksum = 0.0;
+                for( int k = 0; k < numberOfWarmUpEvaluations; k++ )
+                {
+                    checksum += getChecksumContribution( interpolator.interpolate( queryPoints.at( k ) ) );
+                }
+                checksum = 0.0;
+
+                boost::posix_time::ptime startTime = boost::posix_time::microsec_clock::local_time( );
+                for( int k = 0; k < numberOfEvaluations; k++ )
+                {
+                    checksum += getChecksumContribution( interpolator.interpolate( queryPoints[ k ] ) );
+                }
+                printBenchmarkResult( "multi_linear", NumberOfDimensions,
+                                      getDependentVariableTypeName< DependentVariableType >( ),
+                                      useUniformGrid, lookupSchemes[ j ],
+                                      getBestSuitedLookupScheme( grid, lookupSchemes[ j ] ),
+                                      useRandomQueries, startTime, checksum );
+            }
+        }
+    }
+}
+
+//! Function to benchmark multi-linear interpolators of dimensions 1 to 5 and given dependent variable type.
+template< typename DependentVariableType >
+void benchmarkMultiLinearInterpolators( boost::random::mt19937& randomGenerator )
+{
+    benchmarkMultiLinearInterpolator< DependentVariableType, 1 >( 1001, randomGenerator );
+    benchmarkMultiLinearInterpolator< DependentVariableType, 2 >( 101, randomGenerator );
+    benchmarkMultiLinearInterpolator< DependentVariableType, 3 >( 31, randomGenerator );
+    benchmarkMultiLinearInterpolator< DependentVariableType, 4 >( 15, randomGenerator );
+    benchmarkMultiLinearInterpolator< DependentVariableType, 5 >( 9, randomGenerator );
+}
+
+//! Benchmark of interpolation throughput of the one-dimensional and multi-linear interpolators.
+/*!
+ *  Benchmark of interpolation throughput of the linear, cubic spline, Hermite cubic spline, Lagrange (orders 4 to 12)
+ *  and multi-linear (1 to 5 dimensions) interpolators, for double, long double, Vector6d and MatrixXd (3x3) dependent
+ *  variables. Each interpolator is timed for a uniform and a nonuniform grid, with the hunting and binary search
+ *  lookup schemes (which are replaced by a constant-time lookup for the uniform grid, see createLookupScheme) and for
+ *  sequential and random queries. Output is in CSV format, with columns: interpolator name, number of dimensions,
+ *  dependent variable type, grid type, selected lookup scheme, used lookup scheme, query pattern, number of
+ *  evaluations, time per evaluation (ns), checksum.
+ */
+int main( )
+{
+    boost::random::mt19937 randomGenerator( 42 );
+
+    std::cout << "interpolator,dimensions,dependent_type,grid,selected_lookup_scheme,used_lookup_scheme,"
+              << "query_pattern,evaluations,time_per_evaluation_ns,checksum" << std::endl;
+
+    benchmarkOneDimensionalInterpolators< double >( randomGenerator );
+    benchmarkOneDimensionalInterpolators< long double >( randomGenerator );
+    benchmarkOneDimensionalInterpolators< Vector6d >( randomGenerator );
+    benchmarkOneDimensionalInterpolators< Eigen::MatrixXd >( randomGenerator );
+
+    benchmarkMultiLinearInterpolators< double >( randomGenerator );
+    benchmarkMultiLinearInterpolators< long double >( randomGenerator );
+    benchmarkMultiLinearInterpolators< Vector6d >( randomGenerator );
+    benchmarkMultiLinearInterpolators< Eigen::MatrixXd >( randomGenerator );
+
+    return EXIT_SUCCESS;
+}
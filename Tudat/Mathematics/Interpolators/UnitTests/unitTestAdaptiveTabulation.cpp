@@ -0,0 +1,189 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <map>
+#include <stdexcept>
+
+#include <boost/make_shared.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/Interpolators/adaptiveTabulation.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace interpolators;
+
+//! Function with narrow peak, to be tabulated in tests.
+double getPeakedFunctionValue( const double independentVariable )
+{
+    return 1.0 / ( 1.0 + 400.0 * ( independentVariable - 0.3 ) * ( independentVariable - 0.3 ) );
+}
+
+//! Function returning position of body in eccentric orbit (solved from Kepler's equation), to be tabulated in tests.
+Eigen::Vector2d getEccentricOrbitPosition( const double time )
+{
+    const double eccentricity = 0.8;
+    double eccentricAnomaly = time;
+    for( int i = 0; i < 50; i++ )
+    {
+        eccentricAnomaly -= ( eccentricAnomaly - eccentricity * std::sin( eccentricAnomaly ) - time ) /
+                ( 1.0 - eccentricity * std::cos( eccentricAnomaly ) );
+    }
+    return Eigen::Vector2d( std::cos( eccentricAnomaly ) - eccentricity,
+                            std::sqrt( 1.0 - eccentricity * eccentricity ) * std::sin( eccentricAnomaly ) );
+}
+
+//! Step function, to be tabulated in tests.
+double getStepFunctionValue( const double independentVariable )
+{
+    return independentVariable < 0.55 ? 1.0 : 2.0;
+}
+
+BOOST_AUTO_TEST_SUITE( test_adaptive_tabulation )
+
+// Test adaptive tabulation of scalar function with narrow peak, for various interpolators.
+BOOST_AUTO_TEST_CASE( testAdaptiveTabulationOfScalarFunction )
+{
+    const double absoluteErrorTolerance = 1.0E-6;
+    for( int interpolatorIndex = 0; interpolatorIndex < 3; interpolatorIndex++ )
+    {
+        boost::shared_ptr< InterpolatorSettings > interpolatorSettings;
+        if( interpolatorIndex == 0 )
+        {
+            interpolatorSettings = boost::make_shared< InterpolatorSettings >( linear_interpolator );
+        }
+        else if( interpolatorIndex == 1 )
+        {
+            interpolatorSettings = boost::make_shared< InterpolatorSettings >( cubic_spline_interpolator );
+        }
+        else
+        {
+            interpolatorSettings = boost::make_shared< LagrangeInterpolatorSettings >( 6 );
+        }
+
+        const std::map< double, double > tabulatedData = tabulateFunctionAdaptively< double, double >(
+                    &getPeakedFunctionValue, 0.0, 1.0, 0.1, interpolatorSettings,
+                    boost::make_shared< AdaptiveTabulationSettings >( 0.0, absoluteErrorTolerance ) );
+
+        // Check that grid is nonuniform, with smallest spacing near peak.
+        double minimumSpacing = 1.0, maximumSpacing = 0.0, locationOfMinimumSpacing = 0.0;
+        for( std::map< double, double >::const_iterator dataIterator = ++tabulatedData.begin( );
+             dataIterator != tabulatedData.end( ); dataIterator++ )
+        {
+            std::map< double, double >::const_iterator previousIterator = dataIterator;
+            previousIterator--;
+            const double spacing = dataIterator->first - previousIterator->first;
+            if( spacing < minimumSpacing )
+            {
+                minimumSpacing = spacing;
+                locationOfMinimumSpacing = previousIterator->first;
+            }
+            maximumSpacing = std::max( maximumSpacing, spacing );
+        }
+        BOOST_CHECK_GT( maximumSpacing, 4.0 * minimumSpacing );
+        BOOST_CHECK_SMALL( locationOfMinimumSpacing - 0.3, 0.1 );
+
+        // Check that number of nodes is smaller than that of uniform grid with smallest spacing.
+        BOOST_CHECK_LT( static_cast< double >( tabulatedData.size( ) ), 0.5 / minimumSpacing );
+
+        // Check interpolation error over complete range.
+        boost::shared_ptr< OneDimensionalInterpolator< double, double > > interpolator =
+                createOneDimensionalInterpolator( tabulatedData, interpolatorSettings );
+        for( int i = 0; i <= 2000; i++ )
+        {
+            const double targetValue = static_cast< double >( i ) / 2000.0;
+            BOOST_CHECK_SMALL( interpolator->interpolate( targetValue ) - getPeakedFunctionValue( targetValue ),
+                               4.0 * absoluteErrorTolerance );
+        }
+    }
+}
+
+// Test adaptive tabulation of vector function (eccentric orbit) with multi-output cubic spline.
+BOOST_AUTO_TEST_CASE( testAdaptiveTabulationOfVectorFunction )
+{
+    const double relativeErrorTolerance = 1.0E-6;
+    const double absoluteErrorTolerance = 1.0E-7;
+    const double orbitalPeriod = 2.0 * 3.14159265358979323846;
+
+    const std::map< double, Eigen::Vector2d > tabulatedData = tabulateFunctionAdaptively< double, Eigen::Vector2d >(
+                &getEccentricOrbitPosition, -orbitalPeriod / 2.0, orbitalPeriod / 2.0, orbitalPeriod / 16.0,
+                boost::make_shared< InterpolatorSettings >( cubic_spline_interpolator ),
+                boost::make_shared< AdaptiveTabulationSettings >( relativeErrorTolerance, absoluteErrorTolerance ) );
+
+    // Check that grid is densest near pericenter (time zero).
+    int numberOfNodesNearPericenter = 0;
+    for( std::map< double, Eigen::Vector2d >::const_iterator dataIterator = tabulatedData.begin( );
+         dataIterator != tabulatedData.end( ); dataIterator++ )
+    {
+        if( std::fabs( dataIterator->first ) < orbitalPeriod / 8.0 )
+        {
+            numberOfNodesNearPericenter++;
+        }
+    }
+    BOOST_CHECK_GT( numberOfNodesNearPericenter, static_cast< int >( tabulatedData.size( ) ) / 2 );
+
+    // Check interpolation error over complete range.
+    boost::shared_ptr< OneDimensionalInterpolator< double, Eigen::Vector2d > > interpolator =
+            createOneDimensionalInterpolator(
+                tabulatedData, boost::make_shared< InterpolatorSettings >( cubic_spline_interpolator ) );
+    for( int i = 0; i <= 2000; i++ )
+    {
+        const double time = -orbitalPeriod / 2.0 + orbitalPeriod * static_cast< double >( i ) / 2000.0;
+        BOOST_CHECK_SMALL( ( interpolator->interpolate( time ) - getEccentricOrbitPosition( time ) ).norm( ),
+                           4.0 * ( absoluteErrorTolerance + relativeErrorTolerance ) );
+    }
+}
+
+// Test limits on bisection and number of nodes, and inconsistent input.
+BOOST_AUTO_TEST_CASE( testAdaptiveTabulationLimits )
+{
+    // Check that refinement of discontinuity is limited by maximum number of bisections.
+    const std::map< double, double > tabulatedData = tabulateFunctionAdaptively< double, double >(
+                &getStepFunctionValue, 0.0, 1.0, 0.25,
+                boost::make_shared< InterpolatorSettings >( linear_interpolator ),
+                boost::make_shared< AdaptiveTabulationSettings >( 1.0E-10, 0.0, 10 ) );
+    BOOST_CHECK_EQUAL( tabulatedData.size( ), 15 );
+    std::map< double, double >::const_iterator upperIterator = tabulatedData.lower_bound( 0.55 );
+    std::map< double, double >::const_iterator lowerIterator = upperIterator;
+    lowerIterator--;
+    BOOST_CHECK_CLOSE_FRACTION( upperIterator->first - lowerIterator->first, 0.25 / 1024.0, 1.0E-12 );
+
+    // Check that exceeding maximum number of nodes is detected.
+    BOOST_CHECK_THROW( ( tabulateFunctionAdaptively< double, double >(
+                             &getStepFunctionValue, 0.0, 1.0, 0.25,
+                             boost::make_shared< InterpolatorSettings >( linear_interpolator ),
+                             boost::make_shared< AdaptiveTabulationSettings >( 1.0E-10, 0.0, 10, 12 ) ) ),
+                       std::runtime_error );
+
+    // Check inconsistent input.
+    BOOST_CHECK_THROW( ( tabulateFunctionAdaptively< double, double >(
+                             &getStepFunctionValue, 1.0, 0.0, 0.25,
+                             boost::make_shared< InterpolatorSettings >( linear_interpolator ),
+                             boost::make_shared< AdaptiveTabulationSettings >( ) ) ),
+                       std::runtime_error );
+    BOOST_CHECK_THROW( ( tabulateFunctionAdaptively< double, double >(
+                             &getStepFunctionValue, 0.0, 1.0, 0.25,
+                             boost::make_shared< HermiteInterpolatorSettings >( 2 ),
+                             boost::make_shared< AdaptiveTabulationSettings >( ) ) ),
+                       std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -0,0 +1,178 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/make_shared.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/Interpolators/createInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/hermiteInterpolator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace interpolators;
+
+BOOST_AUTO_TEST_SUITE( test_hermite_interpolation )
+
+// Test exact reproduction of polynomials of maximum degree.
+BOOST_AUTO_TEST_CASE( testHermitePolynomialReproduction )
+{
+    for( int numberOfNodes = 2; numberOfNodes <= 6; numberOfNodes++ )
+    {
+        for( int useSecondDerivatives = 0; useSecondDerivatives < 2; useSecondDerivatives++ )
+        {
+            // Create polynomial of maximum degree that is reproduced by interpolator.
+            const int polynomialDegree = ( useSecondDerivatives ? 3 : 2 ) * numberOfNodes - 1;
+            std::vector< double > polynomialCoefficients;
+            for( int i = 0; i <= polynomialDegree; i++ )
+            {
+                polynomialCoefficients.push_back( std::cos( static_cast< double >( i ) ) / ( i + 1 ) );
+            }
+
+            // Create data on non-uniform grid.
+            std::map< double, double > dataMap;
+            std::vector< double > firstDerivatives, secondDerivatives;
+            for( int i = 0; i < 20; i++ )
+            {
+                const double independentValue = 0.05 * static_cast< double >( i ) +
+                        0.01 * std::sin( static_cast< double >( i ) );
+                double value = 0.0, firstDerivative = 0.0, secondDerivative = 0.0;
+                for( int j = polynomialDegree; j >= 0; j-- )
+                {
+                    secondDerivative = secondDerivative * independentValue + 2.0 * firstDerivative;
+                    firstDerivative = firstDerivative * independentValue + value;
+                    value = value * independentValue + polynomialCoefficients[ j ];
+                }
+                dataMap[ independentValue ] = value;
+                firstDerivatives.push_back( firstDerivative );
+                secondDerivatives.push_back( secondDerivative );
+            }
+
+            boost::shared_ptr< OneDimensionalInterpolator< double, double > > interpolator =
+                    createOneDimensionalInterpolator(
+                        dataMap, boost::make_shared< HermiteInterpolatorSettings >( numberOfNodes ),
+                        firstDerivatives, useSecondDerivatives ? secondDerivatives : std::vector< double >( ) );
+
+            // Check interpolation (including intervals at edges of data) against polynomial.
+            for( int i = 0; i < 376; i++ )
+            {
+                const double targetValue = 0.0025 * static_cast< double >( i );
+                double expectedValue = 0.0, expectedDerivative = 0.0;
+                for( int j = polynomialDegree; j >= 0; j-- )
+                {
+                    expectedDerivative = expectedDerivative * targetValue + expectedValue;
+                    expectedValue = expectedValue * targetValue + polynomialCoefficients[ j ];
+                }
+
+                BOOST_CHECK_SMALL( interpolator->interpolate( targetValue ) - expectedValue, 1.0E-12 );
+
+                double interpolatedValue, interpolatedDerivative;
+                LookUpSchemeCursor cursor;
+                boost::dynamic_pointer_cast< HermiteInterpolator< double, double > >(
+                            interpolator )->interpolateValueAndDerivative(
+                            targetValue, interpolatedValue, interpolatedDerivative, cursor );
+                BOOST_CHECK_SMALL( interpolatedValue - expectedValue, 1.0E-12 );
+                BOOST_CHECK_SMALL( interpolatedDerivative - expectedDerivative, 1.0E-10 );
+            }
+        }
+    }
+
+    // Check inconsistent input.
+    std::map< double, double > dataMap;
+    for( int i = 0; i < 5; i++ )
+    {
+        dataMap[ static_cast< double >( i ) ] = 0.0;
+    }
+    BOOST_CHECK_THROW( ( HermiteInterpolator< double, double >( dataMap, std::vector< double >( 4, 0.0 ), 2 ) ),
+                       std::runtime_error );
+    BOOST_CHECK_THROW( ( HermiteInterpolator< double, double >( dataMap, std::vector< double >( 5, 0.0 ), 6 ) ),
+                       std::runtime_error );
+    BOOST_CHECK_THROW( ( HermiteInterpolator< double, double >(
+                             dataMap, std::vector< double >( 5, 0.0 ), 2, std::vector< double >( 3, 0.0 ) ) ),
+                       std::runtime_error );
+}
+
+// Test Hermite interpolation of circular orbit states, compared to Lagrange interpolation.
+BOOST_AUTO_TEST_CASE( testHermiteStateInterpolation )
+{
+    // Create sparsely tabulated circular orbit (about 20 points per orbit), with accelerations.
+    const double meanMotion = 2.0 * 3.14159265358979323846 / 5400.0;
+    const double orbitRadius = 6878.0E3;
+    std::map< double, Eigen::Matrix< double, 6, 1 > > stateMap;
+    std::vector< Eigen::Vector3d > accelerations;
+    for( int i = 0; i < 100; i++ )
+    {
+        const double time = 1.0E8 + 270.0 * static_cast< double >( i );
+        const double angle = meanMotion * ( time - 1.0E8 );
+        Eigen::Matrix< double, 6, 1 > state;
+        state << orbitRadius * std::cos( angle ), orbitRadius * std::sin( angle ), 0.0,
+                -orbitRadius * meanMotion * std::sin( angle ), orbitRadius * meanMotion * std::cos( angle ), 0.0;
+        stateMap[ time ] = state;
+        accelerations.push_back( -meanMotion * meanMotion * state.segment( 0, 3 ) );
+    }
+
+    HermiteStateInterpolator< double, double > hermiteInterpolator( stateMap, 8 );
+    HermiteStateInterpolator< double, double > hermiteAccelerationInterpolator( stateMap, 6, accelerations );
+    LagrangeInterpolator< double, Eigen::Matrix< double, 6, 1 > > lagrangeInterpolator( stateMap, 8 );
+
+    double maximumHermitePositionError = 0.0, maximumHermiteVelocityError = 0.0;
+    double maximumHermiteAccelerationPositionError = 0.0, maximumLagrangePositionError = 0.0;
+    for( int i = 0; i < 2000; i++ )
+    {
+        const double time = 1.0E8 + 300.0 + 13.1 * static_cast< double >( i );
+        const double angle = meanMotion * ( time - 1.0E8 );
+        Eigen::Matrix< double, 6, 1 > expectedState;
+        expectedState << orbitRadius * std::cos( angle ), orbitRadius * std::sin( angle ), 0.0,
+                -orbitRadius * meanMotion * std::sin( angle ), orbitRadius * meanMotion * std::cos( angle ), 0.0;
+
+        const Eigen::Matrix< double, 6, 1 > hermiteState = hermiteInterpolator.interpolate( time );
+        maximumHermitePositionError = std::max(
+                    maximumHermitePositionError, ( hermiteState - expectedState ).segment( 0, 3 ).norm( ) );
+        maximumHermiteVelocityError = std::max(
+                    maximumHermiteVelocityError, ( hermiteState - expectedState ).segment( 3, 3 ).norm( ) );
+        maximumHermiteAccelerationPositionError = std::max(
+                    maximumHermiteAccelerationPositionError,
+                    ( hermiteAccelerationInterpolator.interpolate( time ) - expectedState ).segment( 0, 3 ).norm( ) );
+        maximumLagrangePositionError = std::max(
+                    maximumLagrangePositionError,
+                    ( lagrangeInterpolator.interpolate( time ) - expectedState ).segment( 0, 3 ).norm( ) );
+    }
+
+    BOOST_CHECK_SMALL( maximumHermitePositionError, 1.0E-5 );
+    BOOST_CHECK_SMALL( maximumHermiteVelocityError, 1.0E-7 );
+    BOOST_CHECK_SMALL( maximumHermiteAccelerationPositionError, 1.0E-5 );
+    BOOST_CHECK_SMALL( maximumHermitePositionError, 1.0E-3 * maximumLagrangePositionError );
+
+    // Check that data points are reproduced.
+    for( std::map< double, Eigen::Matrix< double, 6, 1 > >::const_iterator stateIterator = stateMap.begin( );
+         stateIterator != stateMap.end( ); stateIterator++ )
+    {
+        BOOST_CHECK_SMALL( ( hermiteInterpolator.interpolate( stateIterator->first ) -
+                             stateIterator->second ).segment( 0, 3 ).norm( ), 1.0E-6 );
+        BOOST_CHECK_SMALL( ( hermiteInterpolator.interpolate( stateIterator->first ) -
+                             stateIterator->second ).segment( 3, 3 ).norm( ), 1.0E-9 );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -0,0 +1,289 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/bind.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/multi_array.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/Interpolators/interpolatorSerialization.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace interpolators;
+
+//! Function to create a unique (empty) temporary directory for the files written by the tests.
+boost::filesystem::path createTemporaryTestDirectory( )
+{
+    boost::filesystem::path testDirectory = boost::filesystem::temp_directory_path( ) /
+            boost::filesystem::unique_path( "tudat_interpolator_serialization_%%%%%%%%" );
+    boost::filesystem::create_directories( testDirectory );
+    return testDirectory;
+}
+
+//! Function to write an interpolator to file, read it back, and compare the results of both interpolators.
+template< typename IndependentVariableType, typename DependentVariableType, typename InterpolatorType >
+void checkInterpolatorRoundTrip(
+        const boost::shared_ptr< OneDimensionalInterpolator< IndependentVariableType, DependentVariableType > >
+        interpolator, const std::string& fileName )
+{
+    writeOneDimensionalInterpolatorToFile( interpolator, fileName );
+    boost::shared_ptr< OneDimensionalInterpolator< IndependentVariableType, DependentVariableType > >
+            readInterpolator = readOneDimensionalInterpolatorFromFile<
+            IndependentVariableType, DependentVariableType >( fileName );
+
+    // Check interpolator type and lookup scheme.
+    BOOST_CHECK( boost::dynamic_pointer_cast< InterpolatorType >( readInterpolator ) != NULL );
+    BOOST_CHECK_EQUAL( getSerializedLookupScheme( readInterpolator->getLookUpScheme( ) ),
+                       getSerializedLookupScheme( interpolator->getLookUpScheme( ) ) );
+
+    // Check that interpolated values (including extrapolation) are identical.
+    const std::vector< IndependentVariableType > independentValues = interpolator->getIndependentValues( );
+    const IndependentVariableType lowerBound = independentValues.front( );
+    const IndependentVariableType upperBound = independentValues.back( );
+    for( int i = 0; i <= 500; i++ )
+    {
+        const IndependentVariableType targetValue =
+                lowerBound + ( upperBound - lowerBound ) * static_cast< IndependentVariableType >( i ) / 500.0;
+        BOOST_CHECK( interpolator->interpolate( targetValue ) == readInterpolator->interpolate( targetValue ) );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE( test_interpolator_serialization )
+
+// Test writing and reading of all one-dimensional interpolator types.
+BOOST_AUTO_TEST_CASE( testOneDimensionalInterpolatorRoundTrip )
+{
+    const boost::filesystem::path testDirectory = createTemporaryTestDirectory( );
+    const std::string fileName = ( testDirectory / "interpolator.bin" ).string( );
+
+    // Create scalar and state data on non-uniform grid.
+    std::vector< double > independentValues;
+    std::vector< double > dependentValues, derivativeValues, secondDerivativeValues;
+    std::map< double, double > dataMap;
+    std::map< double, Eigen::Matrix< double, 6, 1 > > stateMap;
+    std::vector< Eigen::Vector3d > accelerations;
+    for( int i = 0; i < 40; i++ )
+    {
+        const double independentValue = 10.0 * static_cast< double >( i ) + std::sin( static_cast< double >( i ) );
+        independentValues.push_back( independentValue );
+        dependentValues.push_back( std::sin( independentValue / 30.0 ) );
+        derivativeValues.push_back( std::cos( independentValue / 30.0 ) / 30.0 );
+        secondDerivativeValues.push_back( -std::sin( independentValue / 30.0 ) / 900.0 );
+        dataMap[ independentValue ] = dependentValues.back( );
+
+        Eigen::Matrix< double, 6, 1 > state;
+        state << std::cos( independentValue / 30.0 ), std::sin( independentValue / 30.0 ), 0.1,
+                -std::sin( independentValue / 30.0 ) / 30.0, std::cos( independentValue / 30.0 ) / 30.0, 0.0;
+        stateMap[ independentValue ] = state;
+        accelerations.push_back( -state.segment( 0, 3 ) / 900.0 );
+    }
+
+    checkInterpolatorRoundTrip< double, double, LinearInterpolator< double, double > >(
+                boost::make_shared< LinearInterpolator< double, double > >( dataMap, binarySearch ), fileName );
+    checkInterpolatorRoundTrip< double, double, CubicSplineInterpolator< double, double > >(
+                boost::make_shared< CubicSplineInterpolator< double, double > >( dataMap ), fileName );
+    checkInterpolatorRoundTrip< double, double, LagrangeInterpolator< double, double > >(
+                boost::make_shared< LagrangeInterpolator< double, double > >( dataMap, 6 ), fileName );
+    checkInterpolatorRoundTrip< double, double, LagrangeInterpolator< double, double, long double > >(
+                boost::make_shared< LagrangeInterpolator< double, double, long double > >( dataMap, 8 ), fileName );
+    checkInterpolatorRoundTrip< double, double, HermiteCubicSplineInterpolator< double, double > >(
+                boost::make_shared< HermiteCubicSplineInterpolator< double, double > >(
+                    dataMap, derivativeValues ), fileName );
+    checkInterpolatorRoundTrip< double, double, HermiteInterpolator< double, double > >(
+                boost::make_shared< HermiteInterpolator< double, double > >(
+                    dataMap, derivativeValues, 3, secondDerivativeValues ), fileName );
+
+    typedef Eigen::Matrix< double, 6, 1 > StateType;
+    checkInterpolatorRoundTrip< double, StateType, MatrixLagrangeInterpolator< double, StateType, double > >(
+                boost::make_shared< MatrixLagrangeInterpolator< double, StateType, double > >( stateMap, 8 ),
+                fileName );
+    checkInterpolatorRoundTrip< double, StateType, LagrangeInterpolator< double, StateType > >(
+                boost::make_shared< LagrangeInterpolator< double, StateType > >( stateMap, 6 ), fileName );
+    checkInterpolatorRoundTrip< double, StateType, HermiteStateInterpolator< double, double > >(
+                boost::make_shared< HermiteStateInterpolator< double, double > >( stateMap, 4, accelerations ),
+                fileName );
+    checkInterpolatorRoundTrip< double, StateType, MultiOutputCubicSplineInterpolator< double, double, 6 > >(
+                boost::make_shared< MultiOutputCubicSplineInterpolator< double, double, 6 > >( stateMap ), fileName );
+
+    // Check that boundary handling of Lagrange interpolator is retained.
+    writeOneDimensionalInterpolatorToFile< double, double >(
+                boost::make_shared< LagrangeInterpolator< double, double > >(
+                    dataMap, 6, huntingAlgorithm, lagrange_no_boundary_interpolation ), fileName );
+    boost::shared_ptr< LagrangeInterpolator< double, double > > readLagrangeInterpolator =
+            boost::dynamic_pointer_cast< LagrangeInterpolator< double, double > >(
+                readOneDimensionalInterpolatorFromFile< double, double >( fileName ) );
+    BOOST_CHECK_EQUAL( readLagrangeInterpolator->getBoundaryHandling( ), lagrange_no_boundary_interpolation );
+
+    // Check that inconsistent variable types are detected.
+    writeOneDimensionalInterpolatorToFile< double, double >(
+                boost::make_shared< LinearInterpolator< double, double > >( dataMap ), fileName );
+    BOOST_CHECK_THROW( ( readOneDimensionalInterpolatorFromFile< double, Eigen::Vector3d >( fileName ) ),
+                       std::runtime_error );
+    BOOST_CHECK_THROW( ( readOneDimensionalInterpolatorFromFile< long double, double >( fileName ) ),
+                       std::runtime_error );
+    BOOST_CHECK_THROW( ( readOneDimensionalInterpolatorFromFile< double, double >( fileName, "otherKey" ) ),
+                       std::runtime_error );
+    BOOST_CHECK_THROW( ( readMultiLinearInterpolatorFromFile< double, double, 2 >( fileName ) ), std::runtime_error );
+
+    // Check that concurrent writers of the same file do not interfere (i.e. use different temporary files).
+    {
+        SerializedInterpolatorFileWriter unfinishedWriter( fileName, serialized_linear_interpolator, "" );
+        writeOneDimensionalInterpolatorToFile< double, double >(
+                    boost::make_shared< CubicSplineInterpolator< double, double > >( dataMap ), fileName );
+        unfinishedWriter.writeDataBlock( dependentValues );
+    }
+    CubicSplineInterpolator< double, double > expectedInterpolator( dataMap );
+    BOOST_CHECK_EQUAL( ( readOneDimensionalInterpolatorFromFile< double, double >( fileName )->interpolate( 123.4 ) ),
+                       expectedInterpolator.interpolate( 123.4 ) );
+    int numberOfFilesInDirectory = 0;
+    for( boost::filesystem::directory_iterator fileIterator( testDirectory );
+         fileIterator != boost::filesystem::directory_iterator( ); fileIterator++ )
+    {
+        numberOfFilesInDirectory++;
+    }
+    BOOST_CHECK_EQUAL( numberOfFilesInDirectory, 1 );
+
+    boost::filesystem::remove_all( testDirectory );
+}
+
+// Test writing and reading of multi-linear interpolator.
+BOOST_AUTO_TEST_CASE( testMultiLinearInterpolatorRoundTrip )
+{
+    const boost::filesystem::path testDirectory = createTemporaryTestDirectory( );
+    const std::string fileName = ( testDirectory / "multiLinearInterpolator.bin" ).string( );
+
+    std::vector< std::vector< double > > independentValues( 3 );
+    for( int i = 0; i < 3; i++ )
+    {
+        for( int j = 0; j < 5 + i; j++ )
+        {
+            independentValues[ i ].push_back( static_cast< double >( j * j ) + 0.5 * static_cast< double >( i ) );
+        }
+    }
+    boost::multi_array< double, 3 > dependentData( boost::extents[ 5 ][ 6 ][ 7 ] );
+    for( int i = 0; i < 5; i++ )
+    {
+        for( int j = 0; j < 6; j++ )
+        {
+            for( int k = 0; k < 7; k++ )
+            {
+                dependentData[ i ][ j ][ k ] = std::cos( static_cast< double >( i + 2 * j ) ) * k;
+            }
+        }
+    }
+
+    boost::shared_ptr< MultiLinearInterpolator< double, double, 3 > > interpolator =
+            boost::make_shared< MultiLinearInterpolator< double, double, 3 > >(
+                independentValues, dependentData, binarySearch );
+    writeMultiLinearInterpolatorToFile( interpolator, fileName );
+    boost::shared_ptr< MultiLinearInterpolator< double, double, 3 > > readInterpolator =
+            readMultiLinearInterpolatorFromFile< double, double, 3 >( fileName );
+
+    BOOST_CHECK( readInterpolator->getDependentData( ) == dependentData );
+    for( int i = 0; i < 200; i++ )
+    {
+        std::vector< double > targetValues( 3 );
+        targetValues[ 0 ] = -1.0 + 0.09 * static_cast< double >( i );
+        targetValues[ 1 ] = 0.13 * static_cast< double >( i );
+        targetValues[ 2 ] = 37.0 - 0.19 * static_cast< double >( i );
+        BOOST_CHECK_EQUAL( interpolator->interpolate( targetValues ), readInterpolator->interpolate( targetValues ) );
+    }
+
+    BOOST_CHECK_THROW( ( readMultiLinearInterpolatorFromFile< double, double, 2 >( fileName ) ), std::runtime_error );
+    BOOST_CHECK_THROW( ( readOneDimensionalInterpolatorFromFile< double, double >( fileName ) ), std::runtime_error );
+
+    boost::filesystem::remove_all( testDirectory );
+}
+
+//! Function to create interpolator for cache test, counting the number of times it is called.
+boost::shared_ptr< OneDimensionalInterpolator< double, double > > createCacheTestInterpolator(
+        const std::map< double, double >& dataMap, int& numberOfCalls )
+{
+    numberOfCalls++;
+    return boost::make_shared< LagrangeInterpolator< double, double > >( dataMap, 6 );
+}
+
+// Test retrieval of interpolators from cache directory.
+BOOST_AUTO_TEST_CASE( testInterpolatorCache )
+{
+    const boost::filesystem::path testDirectory = createTemporaryTestDirectory( );
+    const std::string cacheDirectory = ( testDirectory / "cache" ).string( );
+
+    std::map< double, double > dataMap;
+    for( int i = 0; i < 30; i++ )
+    {
+        dataMap[ 0.1 * static_cast< double >( i ) ] = std::exp( -0.1 * static_cast< double >( i ) );
+    }
+
+    const std::string settingsKey = "testData;" + getInterpolatorSettingsKey(
+                boost::make_shared< LagrangeInterpolatorSettings >( 6 ) );
+    int numberOfCalls = 0;
+    boost::function< boost::shared_ptr< OneDimensionalInterpolator< double, double > >( ) > createInterpolator =
+            boost::bind( &createCacheTestInterpolator, boost::cref( dataMap ), boost::ref( numberOfCalls ) );
+
+    // Check that interpolator is created only once, and read from cache subsequently.
+    boost::shared_ptr< OneDimensionalInterpolator< double, double > > firstInterpolator =
+            getCachedOneDimensionalInterpolator< double, double >( cacheDirectory, settingsKey, createInterpolator );
+    BOOST_CHECK_EQUAL( numberOfCalls, 1 );
+    boost::shared_ptr< OneDimensionalInterpolator< double, double > > secondInterpolator =
+            getCachedOneDimensionalInterpolator< double, double >( cacheDirectory, settingsKey, createInterpolator );
+    BOOST_CHECK_EQUAL( numberOfCalls, 1 );
+    BOOST_CHECK( ( boost::dynamic_pointer_cast< LagrangeInterpolator< double, double > >(
+                       secondInterpolator ) != NULL ) );
+    BOOST_CHECK_EQUAL( firstInterpolator->interpolate( 1.234 ), secondInterpolator->interpolate( 1.234 ) );
+
+    // Check that different settings lead to new cache file.
+    const std::string otherSettingsKey = "testData;" + getInterpolatorSettingsKey(
+                boost::make_shared< LagrangeInterpolatorSettings >( 8 ) );
+    BOOST_CHECK( otherSettingsKey != settingsKey );
+    getCachedOneDimensionalInterpolator< double, double >( cacheDirectory, otherSettingsKey, createInterpolator );
+    BOOST_CHECK_EQUAL( numberOfCalls, 2 );
+
+    // Check that corrupted cache file is recreated.
+    int numberOfCacheFiles = 0;
+    for( boost::filesystem::directory_iterator fileIterator( cacheDirectory );
+         fileIterator != boost::filesystem::directory_iterator( ); fileIterator++ )
+    {
+        numberOfCacheFiles++;
+        std::ofstream corruptedFile( fileIterator->path( ).string( ).c_str( ), std::ios::out | std::ios::trunc );
+        corruptedFile << "corrupted";
+    }
+    BOOST_CHECK_EQUAL( numberOfCacheFiles, 2 );
+
+    secondInterpolator =
+            getCachedOneDimensionalInterpolator< double, double >( cacheDirectory, settingsKey, createInterpolator );
+    BOOST_CHECK_EQUAL( numberOfCalls, 3 );
+    BOOST_CHECK_EQUAL( firstInterpolator->interpolate( 1.234 ), secondInterpolator->interpolate( 1.234 ) );
+    getCachedOneDimensionalInterpolator< double, double >( cacheDirectory, settingsKey, createInterpolator );
+    BOOST_CHECK_EQUAL( numberOfCalls, 3 );
+
+    boost::filesystem::remove_all( testDirectory );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -0,0 +1,165 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <map>
+#include <thread>
+#include <vector>
+
+#include <boost/make_shared.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Mathematics/Interpolators/cubicSplineInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/linearInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/lookupScheme.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace interpolators;
+
+//! Function to interpolate at a list of values, as performed by a single thread.
+void interpolateAtValues( const boost::shared_ptr< OneDimensionalInterpolator< double, double > > interpolator,
+                          const std::vector< double >* valuesToInterpolate,
+                          std::vector< double >* interpolatedValues )
+{
+    interpolatedValues->resize( valuesToInterpolate->size( ) );
+    for( unsigned int i = 0; i < valuesToInterpolate->size( ); i++ )
+    {
+        interpolatedValues->at( i ) = interpolator->interpolate( valuesToInterpolate->at( i ) );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE( test_interpolator_thread_safety )
+
+// Test concurrent interpolation from a single interpolator by several threads.
+BOOST_AUTO_TEST_CASE( testConcurrentInterpolation )
+{
+    // Create data on non-uniform grid, so that hunting and binary search lookup schemes are used.
+    std::map< double, double > dataToInterpolate;
+    for( int i = 0; i < 2000; i++ )
+    {
+        const double independentValue = static_cast< double >( i ) + 0.3 * std::sin( static_cast< double >( i ) );
+        dataToInterpolate[ independentValue ] = std::cos( 0.01 * independentValue );
+    }
+
+    std::vector< boost::shared_ptr< OneDimensionalInterpolator< double, double > > > interpolators;
+    interpolators.push_back( boost::make_shared< LagrangeInterpolator< double, double > >( dataToInterpolate, 8 ) );
+    interpolators.push_back( boost::make_shared< LagrangeInterpolator< double, double > >(
+                                 dataToInterpolate, 6, binarySearch ) );
+    interpolators.push_back( boost::make_shared< CubicSplineInterpolator< double, double > >( dataToInterpolate ) );
+    interpolators.push_back( boost::make_shared< LinearInterpolator< double, double > >( dataToInterpolate ) );
+
+    // Create a different sequence of (sorted and random) values for each thread.
+    const int numberOfThreads = 4;
+    boost::random::mt19937 randomNumberGenerator( 42 );
+    boost::random::uniform_real_distribution< double > uniformDistribution( 0.0, 1999.0 );
+    std::vector< std::vector< double > > valuesToInterpolate( numberOfThreads );
+    for( int i = 0; i < numberOfThreads; i++ )
+    {
+        for( int j = 0; j < 20000; j++ )
+        {
+            valuesToInterpolate[ i ].push_back(
+                        ( i % 2 == 0 ) ? ( 0.0999 * static_cast< double >( j ) + static_cast< double >( i ) ) :
+                                         uniformDistribution( randomNumberGenerator ) );
+        }
+    }
+
+    for( unsigned int k = 0; k < interpolators.size( ); k++ )
+    {
+        // Compute reference values serially, with explicit cursor.
+        std::vector< std::vector< double > > expectedValues( numberOfThreads );
+        for( int i = 0; i < numberOfThreads; i++ )
+        {
+            LookUpSchemeCursor cursor;
+            for( unsigned int j = 0; j < valuesToInterpolate[ i ].size( ); j++ )
+            {
+                expectedValues[ i ].push_back( interpolators[ k ]->interpolate( valuesToInterpolate[ i ][ j ], cursor ) );
+            }
+        }
+
+        // Interpolate concurrently, with thread-local cursors.
+        std::vector< std::vector< double > > interpolatedValues( numberOfThreads );
+        std::vector< std::thread > threads;
+        for( int i = 0; i < numberOfThreads; i++ )
+        {
+            threads.push_back( std::thread( &interpolateAtValues, interpolators[ k ],
+                                            &valuesToInterpolate[ i ], &interpolatedValues[ i ] ) );
+        }
+        for( int i = 0; i < numberOfThreads; i++ )
+        {
+            threads[ i ].join( );
+        }
+
+        for( int i = 0; i < numberOfThreads; i++ )
+        {
+            for( unsigned int j = 0; j < valuesToInterpolate[ i ].size( ); j++ )
+            {
+                BOOST_CHECK_EQUAL( interpolatedValues[ i ][ j ], expectedValues[ i ][ j ] );
+            }
+        }
+
+        // Check interpolation at multiple values.
+        std::vector< double > multipleInterpolatedValues;
+        interpolators[ k ]->interpolateAtMultipleValues( valuesToInterpolate[ 0 ], multipleInterpolatedValues );
+        for( unsigned int j = 0; j < valuesToInterpolate[ 0 ].size( ); j++ )
+        {
+            BOOST_CHECK_EQUAL( multipleInterpolatedValues[ j ], expectedValues[ 0 ][ j ] );
+        }
+    }
+}
+
+// Test lookup schemes with explicit cursors.
+BOOST_AUTO_TEST_CASE( testLookupSchemeCursors )
+{
+    std::vector< double > independentValues;
+    for( int i = 0; i < 100; i++ )
+    {
+        independentValues.push_back( std::exp( 0.05 * static_cast< double >( i ) ) );
+    }
+
+    HuntingAlgorithmLookupScheme< double > huntingLookupScheme( independentValues );
+    BinarySearchLookupScheme< double > binarySearchLookupScheme( independentValues );
+
+    // Alternate between two cursors, and check against binary search.
+    LookUpSchemeCursor firstCursor, secondCursor;
+    for( int i = 0; i < 500; i++ )
+    {
+        const double firstValue = 1.0 + 0.027 * static_cast< double >( i );
+        const double secondValue = 140.0 - 0.25 * static_cast< double >( i );
+        const int expectedFirstIndex = binarySearchLookupScheme.findNearestLowerNeighbour( firstValue );
+        const int expectedSecondIndex = binarySearchLookupScheme.findNearestLowerNeighbour( secondValue );
+
+        BOOST_CHECK_EQUAL( huntingLookupScheme.findNearestLowerNeighbour( firstValue, firstCursor ),
+                           expectedFirstIndex );
+        BOOST_CHECK_EQUAL( firstCursor.previousNearestLowerIndex_, expectedFirstIndex );
+        BOOST_CHECK_EQUAL( binarySearchLookupScheme.findNearestLowerNeighbour( secondValue, secondCursor ),
+                           expectedSecondIndex );
+        BOOST_CHECK_EQUAL( huntingLookupScheme.findNearestLowerNeighbour( secondValue ), expectedSecondIndex );
+    }
+
+    // Check that cursor used for larger table is ignored.
+    LookUpSchemeCursor invalidCursor;
+    invalidCursor.previousNearestLowerIndex_ = 1000;
+    BOOST_CHECK_EQUAL( huntingLookupScheme.findNearestLowerNeighbour( 2.0, invalidCursor ),
+                       binarySearchLookupScheme.findNearestLowerNeighbour( 2.0 ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
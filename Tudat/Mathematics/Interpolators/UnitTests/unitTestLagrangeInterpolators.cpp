@@ -41,6 +41,7 @@
 #include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 
 #include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/matrixLagrangeInterpolator.h"
 
 namespace tudat
 {
@@ -588,7 +589,90 @@ BOOST_AUTO_TEST_CASE( test_lagrange_error_checks )
     }
 }
 
+// Test to check whether the matrix Lagrange interpolator reproduces the results of the Lagrange interpolator
+BOOST_AUTO_TEST_CASE( test_matrix_lagrange_interpolation )
+{
+    std::vector< double > independentVariableVector = getIndependentVariableVector( );
+
+    // Create matrix and vector data (6x8 matrices, as for state transition and sensitivity matrices).
+    std::map< double, Eigen::MatrixXd > matrixDataMap;
+    std::map< double, Eigen::Matrix< double, 6, 1 > > vectorDataMap;
+    for( unsigned int i = 0; i < independentVariableVector.size( ); i++ )
+    {
+        const double independentValue = independentVariableVector.at( i );
+        Eigen::MatrixXd matrixValue( 6, 8 );
+        for( int j = 0; j < 6; j++ )
+        {
+            for( int k = 0; k < 8; k++ )
+            {
+                matrixValue( j, k ) = std::sin( 0.1 * independentValue * static_cast< double >( j + 1 ) +
+                                                static_cast< double >( k ) );
+            }
+        }
+        matrixDataMap[ independentValue ] = matrixValue;
+        vectorDataMap[ independentValue ] = matrixValue.col( 3 );
+    }
 
+    for( unsigned int numberOfStages = 4; numberOfStages <= 10; numberOfStages += 2 )
+    {
+        interpolators::LagrangeInterpolator< double, Eigen::MatrixXd > matrixInterpolator(
+                    matrixDataMap, numberOfStages );
+        interpolators::MatrixLagrangeInterpolator< double, Eigen::MatrixXd > blockMatrixInterpolator(
+                    matrixDataMap, numberOfStages );
+        interpolators::LagrangeInterpolator< double, Eigen::Matrix< double, 6, 1 > > vectorInterpolator(
+                    vectorDataMap, numberOfStages );
+        interpolators::MatrixLagrangeInterpolator< double, Eigen::Matrix< double, 6, 1 > > blockVectorInterpolator(
+                    vectorDataMap, numberOfStages );
+
+        // Access interpolators through base class, as done for state transition and sensitivity matrices.
+        const interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd >& baseMatrixInterpolator =
+                matrixInterpolator;
+        const interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd >& baseBlockMatrixInterpolator =
+                blockMatrixInterpolator;
+
+        // Test at data points, between data points and in boundary regions.
+        Eigen::MatrixXd interpolatedMatrix, baseInterpolatedMatrix;
+        for( unsigned int i = 0; i < 4 * ( independentVariableVector.size( ) - 1 ); i++ )
+        {
+            const double testValue = independentVariableVector.at( i / 4 ) + 0.25 * static_cast< double >( i % 4 ) *
+                    ( independentVariableVector.at( i / 4 + 1 ) - independentVariableVector.at( i / 4 ) );
+
+            const Eigen::MatrixXd expectedMatrix = matrixInterpolator.interpolate( testValue );
+            blockMatrixInterpolator.interpolate( testValue, interpolatedMatrix );
+            BOOST_CHECK_EQUAL( interpolatedMatrix.rows( ), 6 );
+            BOOST_CHECK_EQUAL( interpolatedMatrix.cols( ), 8 );
+            BOOST_CHECK_SMALL( ( interpolatedMatrix - expectedMatrix ).cwiseAbs( ).maxCoeff( ),
+                               1.0E-13 * ( 1.0 + expectedMatrix.cwiseAbs( ).maxCoeff( ) ) );
+            BOOST_CHECK_EQUAL( ( blockMatrixInterpolator.interpolate( testValue ) - interpolatedMatrix ).norm( ), 0.0 );
+
+            // Check interpolation by reference through base class (overridden and default implementation).
+            baseBlockMatrixInterpolator.interpolate( testValue, baseInterpolatedMatrix );
+            BOOST_CHECK_EQUAL( ( baseInterpolatedMatrix - interpolatedMatrix ).norm( ), 0.0 );
+            baseMatrixInterpolator.interpolate( testValue, baseInterpolatedMatrix );
+            BOOST_CHECK_EQUAL( ( baseInterpolatedMatrix - expectedMatrix ).norm( ), 0.0 );
+
+            const Eigen::Matrix< double, 6, 1 > expectedVector = vectorInterpolator.interpolate( testValue );
+            BOOST_CHECK_SMALL( ( blockVectorInterpolator.interpolate( testValue ) - expectedVector ).cwiseAbs( ).maxCoeff( ),
+                               1.0E-13 * ( 1.0 + expectedVector.cwiseAbs( ).maxCoeff( ) ) );
+        }
+
+        // Check dependent values reconstructed from contiguous storage.
+        const std::vector< Eigen::MatrixXd > dependentValues = blockMatrixInterpolator.getDependentValues( );
+        const std::vector< Eigen::MatrixXd > expectedDependentValues = matrixInterpolator.getDependentValues( );
+        BOOST_CHECK_EQUAL( dependentValues.size( ), expectedDependentValues.size( ) );
+        for( unsigned int i = 0; i < dependentValues.size( ); i++ )
+        {
+            BOOST_CHECK_EQUAL( dependentValues.at( i ).rows( ), 6 );
+            BOOST_CHECK_EQUAL( dependentValues.at( i ).cols( ), 8 );
+            BOOST_CHECK_EQUAL( ( dependentValues.at( i ) - expectedDependentValues.at( i ) ).norm( ), 0.0 );
+        }
+    }
+
+    // Check that dependent variables of different size are rejected (away from the boundary interpolators).
+    matrixDataMap[ independentVariableVector.at( 8 ) ] = Eigen::MatrixXd::Zero( 6, 7 );
+    BOOST_CHECK_THROW( ( interpolators::MatrixLagrangeInterpolator< double, Eigen::MatrixXd >( matrixDataMap, 4 ) ),
+                       std::runtime_error );
+}
 
 BOOST_AUTO_TEST_SUITE_END( )
 
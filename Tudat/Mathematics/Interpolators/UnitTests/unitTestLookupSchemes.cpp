@@ -0,0 +1,175 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <map>
+#include <vector>
+
+#include <boost/make_shared.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Mathematics/Interpolators/createInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/lookupScheme.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace interpolators;
+
+//! Function to check that a lookup scheme reproduces the results of a binary search.
+void checkLookupSchemeAgainstBinarySearch(
+        const std::vector< double >& independentValues,
+        const boost::shared_ptr< LookUpScheme< double > > lookUpScheme )
+{
+    BinarySearchLookupScheme< double > binarySearchLookupScheme( independentValues );
+
+    // Check values on and next to the nodes, and outside of the range of the nodes.
+    std::vector< double > valuesToLookup;
+    for( unsigned int i = 0; i < independentValues.size( ); i++ )
+    {
+        valuesToLookup.push_back( independentValues[ i ] );
+        valuesToLookup.push_back( std::nextafter( independentValues[ i ], -1.0E300 ) );
+        valuesToLookup.push_back( std::nextafter( independentValues[ i ], 1.0E300 ) );
+    }
+    valuesToLookup.push_back( independentValues.front( ) - 1.0E3 );
+    valuesToLookup.push_back( independentValues.back( ) + 1.0E3 );
+
+    // Check random values within range.
+    boost::random::mt19937 randomNumberGenerator( 42 );
+    boost::random::uniform_real_distribution< double > uniformDistribution(
+                independentValues.front( ), independentValues.back( ) );
+    for( int i = 0; i < 1000; i++ )
+    {
+        valuesToLookup.push_back( uniformDistribution( randomNumberGenerator ) );
+    }
+
+    for( unsigned int i = 0; i < valuesToLookup.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( lookUpScheme->findNearestLowerNeighbour( valuesToLookup[ i ] ),
+                           binarySearchLookupScheme.findNearestLowerNeighbour( valuesToLookup[ i ] ) );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE( test_lookup_schemes )
+
+// Test uniform and piecewise uniform grid lookup schemes against binary search.
+BOOST_AUTO_TEST_CASE( testUniformGridLookupSchemes )
+{
+    // Create uniform grid (with rounding errors due to large offset), nearly uniform grid, and grid
+    // with strongly varying spacing.
+    std::vector< double > uniformGrid, nearlyUniformGrid, nonUniformGrid;
+    for( int i = 0; i < 200; i++ )
+    {
+        uniformGrid.push_back( 1.0E8 + static_cast< double >( i ) * 60.1 );
+        nearlyUniformGrid.push_back( -3.0 + 0.01 * static_cast< double >( i ) +
+                                     0.003 * std::sin( 0.3 * static_cast< double >( i ) ) );
+        nonUniformGrid.push_back( std::exp( 0.05 * static_cast< double >( i ) ) );
+    }
+
+    // Check selection of lookup schemes.
+    BOOST_CHECK_EQUAL( getBestSuitedLookupScheme( uniformGrid, huntingAlgorithm ), uniformGridLookup );
+    BOOST_CHECK_EQUAL( getBestSuitedLookupScheme( uniformGrid, binarySearch ), uniformGridLookup );
+    BOOST_CHECK_EQUAL( getBestSuitedLookupScheme( nearlyUniformGrid, huntingAlgorithm ),
+                       piecewiseUniformGridLookup );
+    BOOST_CHECK_EQUAL( getBestSuitedLookupScheme( nonUniformGrid, huntingAlgorithm ), huntingAlgorithm );
+    BOOST_CHECK_EQUAL( getBestSuitedLookupScheme( nonUniformGrid, binarySearch ), binarySearch );
+    BOOST_CHECK( boost::dynamic_pointer_cast< UniformGridLookupScheme< double > >(
+                     createLookupScheme( uniformGrid, huntingAlgorithm ) ) != NULL );
+    BOOST_CHECK( boost::dynamic_pointer_cast< PiecewiseUniformGridLookupScheme< double > >(
+                     createLookupScheme( nearlyUniformGrid, binarySearch ) ) != NULL );
+
+    // Check results of lookup schemes (also for grids for which they are not automatically selected).
+    checkLookupSchemeAgainstBinarySearch(
+                uniformGrid, boost::make_shared< UniformGridLookupScheme< double > >( uniformGrid ) );
+    checkLookupSchemeAgainstBinarySearch(
+                nearlyUniformGrid, boost::make_shared< UniformGridLookupScheme< double > >( nearlyUniformGrid ) );
+    checkLookupSchemeAgainstBinarySearch(
+                nonUniformGrid, boost::make_shared< UniformGridLookupScheme< double > >( nonUniformGrid ) );
+    checkLookupSchemeAgainstBinarySearch(
+                uniformGrid, boost::make_shared< PiecewiseUniformGridLookupScheme< double > >( uniformGrid ) );
+    checkLookupSchemeAgainstBinarySearch(
+                nearlyUniformGrid, boost::make_shared< PiecewiseUniformGridLookupScheme< double > >(
+                    nearlyUniformGrid ) );
+    checkLookupSchemeAgainstBinarySearch(
+                nonUniformGrid, boost::make_shared< PiecewiseUniformGridLookupScheme< double > >(
+                    nonUniformGrid ) );
+
+    // Check that a grid with a single interval is handled.
+    std::vector< double > singleIntervalGrid;
+    singleIntervalGrid.push_back( 1.0 );
+    singleIntervalGrid.push_back( 2.0 );
+    checkLookupSchemeAgainstBinarySearch(
+                singleIntervalGrid, boost::make_shared< UniformGridLookupScheme< double > >( singleIntervalGrid ) );
+    checkLookupSchemeAgainstBinarySearch(
+                singleIntervalGrid, boost::make_shared< PiecewiseUniformGridLookupScheme< double > >(
+                    singleIntervalGrid ) );
+}
+
+// Test automatic selection of uniform grid lookup scheme by interpolators.
+BOOST_AUTO_TEST_CASE( testUniformGridLookupSchemeInInterpolators )
+{
+    std::map< double, double > dataToInterpolate;
+    for( int i = 0; i < 100; i++ )
+    {
+        const double independentValue = 10.0 + 0.5 * static_cast< double >( i );
+        dataToInterpolate[ independentValue ] = std::cos( independentValue );
+    }
+
+    // Create interpolators with (default) hunting algorithm.
+    boost::shared_ptr< OneDimensionalInterpolator< double, double > > interpolator =
+            createOneDimensionalInterpolator( dataToInterpolate, boost::make_shared< InterpolatorSettings >(
+                                                  cubic_spline_interpolator ) );
+    BOOST_CHECK( boost::dynamic_pointer_cast< UniformGridLookupScheme< double > >(
+                     interpolator->getLookUpScheme( ) ) != NULL );
+
+    boost::shared_ptr< OneDimensionalInterpolator< double, double > > lagrangeInterpolator =
+            createOneDimensionalInterpolator( dataToInterpolate, boost::make_shared< LagrangeInterpolatorSettings >( 6 ) );
+    BOOST_CHECK( boost::dynamic_pointer_cast< UniformGridLookupScheme< double > >(
+                     lagrangeInterpolator->getLookUpScheme( ) ) != NULL );
+
+    std::map< double, double > nonUniformDataToInterpolate = dataToInterpolate;
+    nonUniformDataToInterpolate[ 10.01 ] = std::cos( 10.01 );
+    BOOST_CHECK( boost::dynamic_pointer_cast< HuntingAlgorithmLookupScheme< double > >(
+                     createOneDimensionalInterpolator(
+                         nonUniformDataToInterpolate, boost::make_shared< InterpolatorSettings >(
+                             linear_interpolator ) )->getLookUpScheme( ) ) != NULL );
+
+    // Check interpolated values against interpolated function (away from the boundaries), and
+    // against manual linear interpolation.
+    LinearInterpolator< double, double > linearInterpolator( dataToInterpolate, uniformGridLookup );
+    LinearInterpolator< double, double > piecewiseLinearInterpolator( dataToInterpolate, piecewiseUniformGridLookup );
+    for( int i = 1; i < 495; i++ )
+    {
+        const double testValue = 10.0 + 0.1 * static_cast< double >( i ) - 0.0123;
+        if( i > 30 && i < 465 )
+        {
+            BOOST_CHECK_SMALL( interpolator->interpolate( testValue ) - std::cos( testValue ), 1.0E-3 );
+            BOOST_CHECK_SMALL( lagrangeInterpolator->interpolate( testValue ) - std::cos( testValue ), 1.0E-4 );
+        }
+
+        const double lowerNode = 10.0 + 0.5 * std::floor( ( testValue - 10.0 ) / 0.5 );
+        const double expectedValue = std::cos( lowerNode ) + ( testValue - lowerNode ) / 0.5 *
+                ( std::cos( lowerNode + 0.5 ) - std::cos( lowerNode ) );
+        BOOST_CHECK_SMALL( linearInterpolator.interpolate( testValue ) - expectedValue, 1.0E-14 );
+        BOOST_CHECK_EQUAL( linearInterpolator.interpolate( testValue ),
+                           piecewiseLinearInterpolator.interpolate( testValue ) );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
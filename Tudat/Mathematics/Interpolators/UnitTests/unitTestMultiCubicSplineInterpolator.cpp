@@ -0,0 +1,228 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/multi_array.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/Interpolators/cubicSplineInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/multiCubicSplineInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/multiLinearInterpolator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace interpolators;
+
+//! Function to create a non-uniform grid of independent variables.
+std::vector< double > getNonUniformGrid( const int numberOfPoints, const double offset )
+{
+    std::vector< double > grid;
+    for( int i = 0; i < numberOfPoints; i++ )
+    {
+        grid.push_back( offset + static_cast< double >( i ) + 0.2 * std::sin( static_cast< double >( i * i ) ) );
+    }
+    return grid;
+}
+
+BOOST_AUTO_TEST_SUITE( test_multi_cubic_spline_interpolation )
+
+// Test separable data against product of one-dimensional cubic splines.
+BOOST_AUTO_TEST_CASE( testSeparableDataAgainstOneDimensionalSplines )
+{
+    std::vector< std::vector< double > > independentValues;
+    independentValues.push_back( getNonUniformGrid( 7, -2.0 ) );
+    independentValues.push_back( getNonUniformGrid( 5, 1.0 ) );
+    independentValues.push_back( getNonUniformGrid( 6, 0.5 ) );
+
+    // Create data as product of functions of each independent variable.
+    std::vector< std::vector< double > > oneDimensionalData( 3 );
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        for( unsigned int j = 0; j < independentValues[ i ].size( ); j++ )
+        {
+            oneDimensionalData[ i ].push_back( std::cos( 0.7 * independentValues[ i ][ j ] + i ) );
+        }
+    }
+
+    boost::multi_array< double, 3 > dependentData( boost::extents[ 7 ][ 5 ][ 6 ] );
+    for( int i = 0; i < 7; i++ )
+    {
+        for( int j = 0; j < 5; j++ )
+        {
+            for( int k = 0; k < 6; k++ )
+            {
+                dependentData[ i ][ j ][ k ] =
+                        oneDimensionalData[ 0 ][ i ] * oneDimensionalData[ 1 ][ j ] * oneDimensionalData[ 2 ][ k ];
+            }
+        }
+    }
+
+    MultiCubicSplineInterpolator< double, double, 3 > multiCubicSplineInterpolator(
+                independentValues, dependentData );
+    std::vector< CubicSplineInterpolator< double, double > > oneDimensionalInterpolators;
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        oneDimensionalInterpolators.push_back(
+                    CubicSplineInterpolator< double, double >( independentValues[ i ], oneDimensionalData[ i ] ) );
+    }
+
+    // Check reproduction of data at nodes.
+    std::vector< double > pointToInterpolate( 3 );
+    for( int i = 0; i < 7; i++ )
+    {
+        for( int j = 0; j < 5; j++ )
+        {
+            for( int k = 0; k < 6; k++ )
+            {
+                pointToInterpolate[ 0 ] = independentValues[ 0 ][ i ];
+                pointToInterpolate[ 1 ] = independentValues[ 1 ][ j ];
+                pointToInterpolate[ 2 ] = independentValues[ 2 ][ k ];
+                BOOST_CHECK_SMALL( multiCubicSplineInterpolator.interpolate( pointToInterpolate ) -
+                                   dependentData[ i ][ j ][ k ], 1.0E-14 );
+            }
+        }
+    }
+
+    // Check interpolation (and extrapolation) against product of one-dimensional splines.
+    for( int i = 0; i < 1000; i++ )
+    {
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            pointToInterpolate[ j ] = independentValues[ j ].front( ) - 0.5 +
+                    ( independentValues[ j ].back( ) - independentValues[ j ].front( ) + 1.0 ) *
+                    std::fmod( 0.123 * static_cast< double >( i * ( j + 2 ) ) + 0.01, 1.0 );
+        }
+        const double expectedValue =
+                oneDimensionalInterpolators[ 0 ].interpolate( pointToInterpolate[ 0 ] ) *
+                oneDimensionalInterpolators[ 1 ].interpolate( pointToInterpolate[ 1 ] ) *
+                oneDimensionalInterpolators[ 2 ].interpolate( pointToInterpolate[ 2 ] );
+        BOOST_CHECK_SMALL( multiCubicSplineInterpolator.interpolateAtPoint( pointToInterpolate ) - expectedValue,
+                           1.0E-14 );
+    }
+}
+
+// Test smoothness of interpolation across grid lines, and accuracy compared to multi-linear interpolation.
+BOOST_AUTO_TEST_CASE( testSmoothnessAndAccuracy )
+{
+    std::vector< std::vector< double > > independentValues;
+    std::vector< double > firstGrid, secondGrid;
+    for( int i = 0; i < 21; i++ )
+    {
+        firstGrid.push_back( 0.1 * static_cast< double >( i ) );
+        secondGrid.push_back( 0.15 * static_cast< double >( i ) - 1.0 );
+    }
+    independentValues.push_back( firstGrid );
+    independentValues.push_back( secondGrid );
+
+    // Create vector-valued data of non-separable function.
+    boost::multi_array< Eigen::Vector2d, 2 > dependentData( boost::extents[ 21 ][ 21 ] );
+    for( int i = 0; i < 21; i++ )
+    {
+        for( int j = 0; j < 21; j++ )
+        {
+            dependentData[ i ][ j ] = Eigen::Vector2d( std::sin( firstGrid[ i ] + secondGrid[ j ] * secondGrid[ j ] ),
+                                                       std::exp( -firstGrid[ i ] * secondGrid[ j ] ) );
+        }
+    }
+
+    MultiCubicSplineInterpolator< double, Eigen::Vector2d, 2 > multiCubicSplineInterpolator(
+                independentValues, dependentData );
+    MultiLinearInterpolator< double, Eigen::Vector2d, 2 > multiLinearInterpolator(
+                independentValues, dependentData );
+
+    // Check that interpolation error (away from boundaries) is much smaller than for multi-linear interpolation.
+    std::vector< double > pointToInterpolate( 2 );
+    double maximumCubicSplineError = 0.0, maximumLinearError = 0.0;
+    for( int i = 0; i < 50; i++ )
+    {
+        for( int j = 0; j < 50; j++ )
+        {
+            pointToInterpolate[ 0 ] = 0.5 + 0.02 * static_cast< double >( i ) + 0.0013;
+            pointToInterpolate[ 1 ] = -0.25 + 0.03 * static_cast< double >( j ) + 0.0017;
+            const Eigen::Vector2d expectedValue(
+                        std::sin( pointToInterpolate[ 0 ] + pointToInterpolate[ 1 ] * pointToInterpolate[ 1 ] ),
+                        std::exp( -pointToInterpolate[ 0 ] * pointToInterpolate[ 1 ] ) );
+            maximumCubicSplineError = std::max(
+                        maximumCubicSplineError,
+                        ( multiCubicSplineInterpolator.interpolate( pointToInterpolate ) - expectedValue ).norm( ) );
+            maximumLinearError = std::max(
+                        maximumLinearError,
+                        ( multiLinearInterpolator.interpolate( pointToInterpolate ) - expectedValue ).norm( ) );
+        }
+    }
+    BOOST_CHECK_SMALL( maximumCubicSplineError, 5.0E-4 );
+    BOOST_CHECK_SMALL( maximumCubicSplineError, 1.0E-2 * maximumLinearError );
+
+    // Check continuity of first derivatives across grid lines, using finite differences on either side.
+    const double finiteDifferenceStep = 1.0E-5;
+    for( int i = 1; i < 20; i++ )
+    {
+        pointToInterpolate[ 0 ] = firstGrid[ i ];
+        pointToInterpolate[ 1 ] = 0.123 + 0.01 * static_cast< double >( i );
+        const Eigen::Vector2d centralValue = multiCubicSplineInterpolator.interpolate( pointToInterpolate );
+
+        pointToInterpolate[ 0 ] = firstGrid[ i ] + finiteDifferenceStep;
+        const Eigen::Vector2d upperDerivative =
+                ( multiCubicSplineInterpolator.interpolate( pointToInterpolate ) - centralValue ) /
+                finiteDifferenceStep;
+        pointToInterpolate[ 0 ] = firstGrid[ i ] - finiteDifferenceStep;
+        const Eigen::Vector2d lowerDerivative =
+                ( centralValue - multiCubicSplineInterpolator.interpolate( pointToInterpolate ) ) /
+                finiteDifferenceStep;
+        BOOST_CHECK_SMALL( ( upperDerivative - lowerDerivative ).norm( ), 1.0E-3 );
+
+        pointToInterpolate[ 0 ] = firstGrid[ i ];
+        const Eigen::Vector2d linearUpperDerivative =
+                ( multiLinearInterpolator.interpolate(
+                      std::vector< double >( { firstGrid[ i ] + finiteDifferenceStep, pointToInterpolate[ 1 ] } ) ) -
+                  multiLinearInterpolator.interpolate( pointToInterpolate ) ) / finiteDifferenceStep;
+        const Eigen::Vector2d linearLowerDerivative =
+                ( multiLinearInterpolator.interpolate( pointToInterpolate ) -
+                  multiLinearInterpolator.interpolate(
+                      std::vector< double >( { firstGrid[ i ] - finiteDifferenceStep, pointToInterpolate[ 1 ] } ) ) ) /
+                finiteDifferenceStep;
+        BOOST_CHECK( ( linearUpperDerivative - linearLowerDerivative ).norm( ) >
+                     10.0 * ( upperDerivative - lowerDerivative ).norm( ) );
+    }
+}
+
+// Test handling of inconsistent input.
+BOOST_AUTO_TEST_CASE( testInconsistentInput )
+{
+    std::vector< std::vector< double > > independentValues( 2, getNonUniformGrid( 4, 0.0 ) );
+    boost::multi_array< double, 2 > dependentData( boost::extents[ 4 ][ 3 ] );
+    BOOST_CHECK_THROW( ( MultiCubicSplineInterpolator< double, double, 2 >( independentValues, dependentData ) ),
+                       std::runtime_error );
+
+    independentValues[ 1 ].resize( 1 );
+    dependentData.resize( boost::extents[ 4 ][ 1 ] );
+    BOOST_CHECK_THROW( ( MultiCubicSplineInterpolator< double, double, 2 >( independentValues, dependentData ) ),
+                       std::runtime_error );
+
+    independentValues[ 1 ] = getNonUniformGrid( 3, 0.0 );
+    dependentData.resize( boost::extents[ 4 ][ 3 ] );
+    MultiCubicSplineInterpolator< double, double, 2 > interpolator( independentValues, dependentData );
+    BOOST_CHECK_THROW( interpolator.interpolate( std::vector< double >( 3, 0.5 ) ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -172,6 +172,67 @@ BOOST_AUTO_TEST_CASE( test4Dimensions )
                                 std::numeric_limits< double >::epsilon( ) );
 }
 
+// Test 3: 3-dimensional test with vector-valued data on non-uniform grid. Multi-linear functions
+// must be reproduced exactly (up to rounding errors).
+BOOST_AUTO_TEST_CASE( test3DimensionsVectorValued )
+{
+    // Create non-uniform independent variable grid.
+    std::vector< std::vector< double > > independentValues( 3 );
+    for ( int i = 0; i < 7; i++ )
+    {
+        independentValues[ 0 ].push_back( std::pow( static_cast< double >( i ), 1.5 ) );
+        independentValues[ 1 ].push_back( -2.0 + 0.3 * static_cast< double >( i * i ) );
+    }
+    for ( int i = 0; i < 4; i++ )
+    {
+        independentValues[ 2 ].push_back( std::exp( 0.5 * static_cast< double >( i ) ) );
+    }
+
+    // Create dependent values from multi-linear functions.
+    boost::multi_array< Eigen::Matrix< double, 6, 1 >, 3 > dependentValues( boost::extents[ 7 ][ 7 ][ 4 ] );
+    for ( int i = 0; i < 7; i++ )
+    {
+        for ( int j = 0; j < 7; j++ )
+        {
+            for ( int k = 0; k < 4; k++ )
+            {
+                const double x = independentValues[ 0 ][ i ];
+                const double y = independentValues[ 1 ][ j ];
+                const double z = independentValues[ 2 ][ k ];
+                dependentValues[ i ][ j ][ k ] << 1.0 + x, y * z, x * y * z, 2.0 - x * z, 3.0, x + y + z;
+            }
+        }
+    }
+
+    interpolators::MultiLinearInterpolator< double, Eigen::Matrix< double, 6, 1 >, 3 > interpolator(
+            independentValues, dependentValues );
+
+    std::vector< double > targetValue( 3 );
+    for ( int i = 0; i < 50; i++ )
+    {
+        targetValue[ 0 ] = 0.27 * static_cast< double >( i );
+        targetValue[ 1 ] = -2.0 + 0.2 * static_cast< double >( i );
+        targetValue[ 2 ] = 1.0 + 0.07 * static_cast< double >( 50 - i );
+
+        const double x = targetValue[ 0 ];
+        const double y = targetValue[ 1 ];
+        const double z = targetValue[ 2 ];
+        Eigen::Matrix< double, 6, 1 > expectedValue;
+        expectedValue << 1.0 + x, y * z, x * y * z, 2.0 - x * z, 3.0, x + y + z;
+
+        const Eigen::Matrix< double, 6, 1 > interpolatedValue = interpolator.interpolate( targetValue );
+        for ( int j = 0; j < 6; j++ )
+        {
+            BOOST_CHECK_SMALL( interpolatedValue( j ) - expectedValue( j ), 1.0E-12 );
+        }
+        BOOST_CHECK_EQUAL( ( interpolator.interpolateAtPoint( targetValue ) - interpolatedValue ).norm( ), 0.0 );
+    }
+
+    // Check that wrong number of independent variables is rejected.
+    targetValue.resize( 2 );
+    BOOST_CHECK_THROW( interpolator.interpolate( targetValue ), std::runtime_error );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -0,0 +1,126 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/Interpolators/cubicSplineInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/multiOutputCubicSplineInterpolator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace interpolators;
+
+BOOST_AUTO_TEST_SUITE( test_multi_output_cubic_spline_interpolation )
+
+// Test multi-output cubic spline against separate cubic splines for each dependent variable.
+BOOST_AUTO_TEST_CASE( testAgainstSeparateCubicSplines )
+{
+    // Create data on non-uniform grid.
+    std::vector< double > independentValues;
+    std::vector< std::vector< double > > dependentValues( 3 );
+    for( int i = 0; i < 25; i++ )
+    {
+        const double independentValue = 5.0 * static_cast< double >( i ) + 1.5 * std::sin( static_cast< double >( i ) );
+        independentValues.push_back( independentValue );
+        dependentValues[ 0 ].push_back( 1.2 * std::exp( -independentValue / 7.0 ) );
+        dependentValues[ 1 ].push_back( 1.0E5 * std::exp( -independentValue / 8.0 ) );
+        dependentValues[ 2 ].push_back( 288.0 - 0.5 * independentValue + 10.0 * std::sin( independentValue / 20.0 ) );
+    }
+
+    MultiOutputCubicSplineInterpolator< double, double, 3 > multiOutputInterpolator(
+                independentValues, dependentValues );
+    std::vector< CubicSplineInterpolator< double, double > > separateInterpolators;
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        separateInterpolators.push_back(
+                    CubicSplineInterpolator< double, double >( independentValues, dependentValues[ i ] ) );
+    }
+
+    // Check interpolation (including extrapolation) against separate cubic splines.
+    for( int i = 0; i < 1000; i++ )
+    {
+        const double targetValue = -10.0 + 0.143 * static_cast< double >( i );
+        const Eigen::Vector3d interpolatedValues = multiOutputInterpolator.interpolate( targetValue );
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            const double expectedValue = separateInterpolators[ j ].interpolate( targetValue );
+            BOOST_CHECK_SMALL( interpolatedValues( j ) - expectedValue,
+                               1.0E-13 * std::max( std::fabs( expectedValue ), 1.0 ) );
+        }
+    }
+
+    // Check reproduction of data at nodes, for interpolator created from map.
+    std::map< double, Eigen::Vector3d > dataMap;
+    for( unsigned int i = 0; i < independentValues.size( ); i++ )
+    {
+        dataMap[ independentValues[ i ] ] =
+                Eigen::Vector3d( dependentValues[ 0 ][ i ], dependentValues[ 1 ][ i ], dependentValues[ 2 ][ i ] );
+    }
+    MultiOutputCubicSplineInterpolator< double, double, 3 > mapInterpolator( dataMap, binarySearch );
+    LookUpSchemeCursor cursor;
+    for( std::map< double, Eigen::Vector3d >::const_iterator dataIterator = dataMap.begin( );
+         dataIterator != dataMap.end( ); dataIterator++ )
+    {
+        const Eigen::Vector3d interpolatedValues = mapInterpolator.interpolate( dataIterator->first, cursor );
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_SMALL( interpolatedValues( j ) - dataIterator->second( j ),
+                               1.0E-14 * std::fabs( dataIterator->second( j ) ) );
+        }
+    }
+}
+
+// Test handling of two data points (linear interpolation) and inconsistent input.
+BOOST_AUTO_TEST_CASE( testLimitCasesAndInconsistentInput )
+{
+    std::vector< double > independentValues;
+    independentValues.push_back( 1.0 );
+    independentValues.push_back( 3.0 );
+    std::vector< std::vector< double > > dependentValues( 2 );
+    dependentValues[ 0 ].push_back( 2.0 );
+    dependentValues[ 0 ].push_back( 6.0 );
+    dependentValues[ 1 ].push_back( -1.0 );
+    dependentValues[ 1 ].push_back( -2.0 );
+
+    MultiOutputCubicSplineInterpolator< double, double, 2 > interpolator( independentValues, dependentValues );
+    const Eigen::Vector2d interpolatedValues = interpolator.interpolate( 2.5 );
+    BOOST_CHECK_SMALL( interpolatedValues( 0 ) - 5.0, 1.0E-15 );
+    BOOST_CHECK_SMALL( interpolatedValues( 1 ) + 1.75, 1.0E-15 );
+
+    BOOST_CHECK_THROW( ( MultiOutputCubicSplineInterpolator< double, double, 3 >(
+                             independentValues, dependentValues ) ), std::runtime_error );
+
+    dependentValues[ 1 ].push_back( -3.0 );
+    BOOST_CHECK_THROW( ( MultiOutputCubicSplineInterpolator< double, double, 2 >(
+                             independentValues, dependentValues ) ), std::runtime_error );
+
+    independentValues.resize( 1 );
+    dependentValues[ 0 ].resize( 1 );
+    dependentValues[ 1 ].resize( 1 );
+    BOOST_CHECK_THROW( ( MultiOutputCubicSplineInterpolator< double, double, 2 >(
+                             independentValues, dependentValues ) ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
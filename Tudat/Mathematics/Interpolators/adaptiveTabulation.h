@@ -0,0 +1,340 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_ADAPTIVE_TABULATION_H
+#define TUDAT_ADAPTIVE_TABULATION_H
+
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <boost/bind.hpp>
+#include <boost/function.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/Interpolators/createInterpolator.h"
+
+namespace tudat
+{
+
+namespace interpolators
+{
+
+//! Class defining settings for the adaptive tabulation of a function.
+/*!
+ *  Class defining settings for the adaptive tabulation of a function (see tabulateFunctionAdaptively). An interval of
+ *  the tabulation is bisected if the interpolation error at its midpoint exceeds the tolerance for any entry of the
+ *  dependent variable, i.e. if |interpolated - exact| > absoluteErrorTolerance + relativeErrorTolerance * |exact|.
+ */
+class AdaptiveTabulationSettings
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor.
+     *  \param relativeErrorTolerance Relative tolerance of interpolation error, for each entry of dependent variable.
+     *  \param absoluteErrorTolerance Absolute tolerance of interpolation error, for each entry of dependent variable.
+     *  \param maximumNumberOfBisections Maximum number of times that an interval of the initial grid may be bisected,
+     *  limiting the smallest spacing of the grid (e.g. near discontinuities of the function).
+     *  \param maximumNumberOfNodes Maximum number of nodes of the tabulation (exception is thrown if exceeded).
+     */
+    AdaptiveTabulationSettings( const double relativeErrorTolerance = 1.0E-8,
+                                const double absoluteErrorTolerance = 0.0,
+                                const int maximumNumberOfBisections = 20,
+                                const int maximumNumberOfNodes = 1000000 ):
+        relativeErrorTolerance_( relativeErrorTolerance ), absoluteErrorTolerance_( absoluteErrorTolerance ),
+        maximumNumberOfBisections_( maximumNumberOfBisections ), maximumNumberOfNodes_( maximumNumberOfNodes ){ }
+
+    //! Destructor.
+    virtual ~AdaptiveTabulationSettings( ){ }
+
+    //! Function to return relative tolerance of interpolation error.
+    /*!
+     *  Function to return relative tolerance of interpolation error, for each entry of dependent variable.
+     *  \return Relative tolerance of interpolation error.
+     */
+    double getRelativeErrorTolerance( )
+    {
+        return relativeErrorTolerance_;
+    }
+
+    //! Function to return absolute tolerance of interpolation error.
+    /*!
+     *  Function to return absolute tolerance of interpolation error, for each entry of dependent variable.
+     *  \return Absolute tolerance of interpolation error.
+     */
+    double getAbsoluteErrorTolerance( )
+    {
+        return absoluteErrorTolerance_;
+    }
+
+    //! Function to return maximum number of times that an interval of the initial grid may be bisected.
+    /*!
+     *  Function to return maximum number of times that an interval of the initial grid may be bisected.
+     *  \return Maximum number of times that an interval of the initial grid may be bisected.
+     */
+    int getMaximumNumberOfBisections( )
+    {
+        return maximumNumberOfBisections_;
+    }
+
+    //! Function to return maximum number of nodes of the tabulation.
+    /*!
+     *  Function to return maximum number of nodes of the tabulation.
+     *  \return Maximum number of nodes of the tabulation.
+     */
+    int getMaximumNumberOfNodes( )
+    {
+        return maximumNumberOfNodes_;
+    }
+
+protected:
+
+    //! Relative tolerance of interpolation error, for each entry of dependent variable.
+    double relativeErrorTolerance_;
+
+    //! Absolute tolerance of interpolation error, for each entry of dependent variable.
+    double absoluteErrorTolerance_;
+
+    //! Maximum number of times that an interval of the initial grid may be bisected.
+    int maximumNumberOfBisections_;
+
+    //! Maximum number of nodes of the tabulation.
+    int maximumNumberOfNodes_;
+};
+
+//! Function to check whether an interpolated scalar is within the tolerance of adaptive tabulation.
+/*!
+ *  Function to check whether an interpolated scalar is within the tolerance of adaptive tabulation.
+ *  \param interpolatedValue Interpolated value.
+ *  \param exactValue Exact value (from function that is tabulated).
+ *  \param relativeErrorTolerance Relative tolerance of interpolation error.
+ *  \param absoluteErrorTolerance Absolute tolerance of interpolation error.
+ *  \return True if interpolation error is within tolerance.
+ */
+template< typename ScalarType >
+bool isWithinTabulationTolerance( const ScalarType& interpolatedValue,
+                                  const ScalarType& exactValue,
+                                  const double relativeErrorTolerance,
+                                  const double absoluteErrorTolerance )
+{
+    using std::abs;
+    return abs( interpolatedValue - exactValue ) <=
+            static_cast< ScalarType >( absoluteErrorTolerance ) +
+            static_cast< ScalarType >( relativeErrorTolerance ) * abs( exactValue );
+}
+
+//! Function to check whether an interpolated matrix is within the tolerance of adaptive tabulation.
+/*!
+ *  Function to check whether all entries of an interpolated matrix are within the tolerance of adaptive tabulation.
+ *  \param interpolatedValue Interpolated value.
+ *  \param exactValue Exact value (from function that is tabulated).
+ *  \param relativeErrorTolerance Relative tolerance of interpolation error.
+ *  \param absoluteErrorTolerance Absolute tolerance of interpolation error.
+ *  \return True if interpolation error of all entries is within tolerance.
+ */
+template< typename ScalarType, int Rows, int Columns, int Options, int MaximumRows, int MaximumColumns >
+bool isWithinTabulationTolerance(
+        const Eigen::Matrix< ScalarType, Rows, Columns, Options, MaximumRows, MaximumColumns >& interpolatedValue,
+        const Eigen::Matrix< ScalarType, Rows, Columns, Options, MaximumRows, MaximumColumns >& exactValue,
+        const double relativeErrorTolerance,
+        const double absoluteErrorTolerance )
+{
+    return ( ( interpolatedValue - exactValue ).array( ).abs( ) <=
+             static_cast< ScalarType >( absoluteErrorTolerance ) +
+             static_cast< ScalarType >( relativeErrorTolerance ) * exactValue.array( ).abs( ) ).all( );
+}
+
+//! Function to tabulate a function on a grid that is adaptively refined to meet an interpolation error tolerance.
+/*!
+ *  Function to tabulate a function on a grid that is adaptively refined to meet an interpolation error tolerance.
+ *  The function is first tabulated on a uniform grid with (approximately) the given initial step size. Subsequently,
+ *  an interpolator is created from the tabulated data, and each interval for which the interpolation error at its
+ *  midpoint exceeds the tolerance is bisected (with the function value at the midpoint added to the data). This is
+ *  repeated until all intervals meet the tolerance, or have been bisected the maximum number of times. The result is
+ *  a nonuniform grid that is dense only where the function requires it (e.g. around the pericenter of an eccentric
+ *  orbit). Each midpoint is evaluated only once, so that the number of calls to the (typically expensive) function is
+ *  roughly twice the final number of nodes.
+ *  \param sourceFunction Function that is to be tabulated.
+ *  \param lowerBound Lower bound of independent variable of tabulation.
+ *  \param upperBound Upper bound of independent variable of tabulation.
+ *  \param initialStepSize Step size of initial, uniform, grid (rounded down to fit the range an integer number of
+ *  times).
+ *  \param createInterpolator Function creating the interpolator (with which the tabulation is to be used) from the
+ *  tabulated data.
+ *  \param tabulationSettings Settings for adaptive tabulation.
+ *  \return Map of adaptively tabulated function, with independent variables as keys.
+ */
+template< typename IndependentVariableType, typename DependentVariableType >
+std::map< IndependentVariableType, DependentVariableType > tabulateFunctionAdaptivelyWithCustomInterpolator(
+        const boost::function< DependentVariableType( const IndependentVariableType ) > sourceFunction,
+        const IndependentVariableType lowerBound,
+        const IndependentVariableType upperBound,
+        const IndependentVariableType initialStepSize,
+        const boost::function< boost::shared_ptr< OneDimensionalInterpolator<
+        IndependentVariableType, DependentVariableType > >(
+            const std::map< IndependentVariableType, DependentVariableType >& ) > createInterpolator,
+        const boost::shared_ptr< AdaptiveTabulationSettings > tabulationSettings )
+{
+    typedef std::map< IndependentVariableType, DependentVariableType > DataMap;
+
+    if( !( upperBound > lowerBound ) || !( initialStepSize > static_cast< IndependentVariableType >( 0 ) ) )
+    {
+        throw std::runtime_error( "Error when tabulating function adaptively, bounds must be ascending and initial "
+                                  "step size must be positive." );
+    }
+
+    // Tabulate function on initial uniform grid.
+    using std::ceil;
+    const int numberOfInitialIntervals = static_cast< int >(
+                ceil( ( upperBound - lowerBound ) / initialStepSize ) );
+    if( numberOfInitialIntervals + 1 > tabulationSettings->getMaximumNumberOfNodes( ) )
+    {
+        throw std::runtime_error( "Error when tabulating function adaptively, initial grid exceeds maximum number of "
+                                  "nodes." );
+    }
+    const IndependentVariableType initialGridSpacing =
+            ( upperBound - lowerBound ) / static_cast< IndependentVariableType >( numberOfInitialIntervals );
+
+    DataMap tabulatedData;
+    for( int i = 0; i < numberOfInitialIntervals; i++ )
+    {
+        const IndependentVariableType independentValue =
+                lowerBound + static_cast< IndependentVariableType >( i ) * initialGridSpacing;
+        tabulatedData.insert( tabulatedData.end( ), std::make_pair( independentValue,
+                                                                    sourceFunction( independentValue ) ) );
+    }
+    tabulatedData.insert( tabulatedData.end( ), std::make_pair( upperBound, sourceFunction( upperBound ) ) );
+
+    // Smallest interval that may be bisected.
+    const IndependentVariableType minimumBisectedInterval =
+            initialGridSpacing / std::pow( 2.0, tabulationSettings->getMaximumNumberOfBisections( ) - 1 ) *
+            static_cast< IndependentVariableType >( 0.75 );
+
+    // Function values at midpoints of intervals that have already been checked.
+    DataMap midpointValues;
+
+    // Bisect intervals until all meet tolerance.
+    std::vector< std::pair< IndependentVariableType, DependentVariableType > > newNodes;
+    do
+    {
+        newNodes.clear( );
+        boost::shared_ptr< OneDimensionalInterpolator< IndependentVariableType, DependentVariableType > >
+                interpolator = createInterpolator( tabulatedData );
+        LookUpSchemeCursor cursor;
+
+        typename DataMap::const_iterator lowerNode = tabulatedData.begin( );
+        typename DataMap::const_iterator upperNode = lowerNode;
+        for( upperNode++; upperNode != tabulatedData.end( ); lowerNode++, upperNode++ )
+        {
+            const IndependentVariableType intervalSize = upperNode->first - lowerNode->first;
+            if( intervalSize < minimumBisectedInterval )
+            {
+                continue;
+            }
+
+            // Retrieve function value at midpoint (computed only once).
+            const IndependentVariableType midpoint =
+                    lowerNode->first + intervalSize / static_cast< IndependentVariableType >( 2 );
+            typename DataMap::iterator midpointIterator = midpointValues.find( midpoint );
+            if( midpointIterator == midpointValues.end( ) )
+            {
+                midpointIterator = midpointValues.insert(
+                            midpointValues.end( ), std::make_pair( midpoint, sourceFunction( midpoint ) ) );
+            }
+
+            if( !isWithinTabulationTolerance(
+                        interpolator->interpolate( midpoint, cursor ), midpointIterator->second,
+                        tabulationSettings->getRelativeErrorTolerance( ),
+                        tabulationSettings->getAbsoluteErrorTolerance( ) ) )
+            {
+                newNodes.push_back( *midpointIterator );
+                midpointValues.erase( midpointIterator );
+            }
+        }
+
+        if( static_cast< int >( tabulatedData.size( ) + newNodes.size( ) ) >
+                tabulationSettings->getMaximumNumberOfNodes( ) )
+        {
+            throw std::runtime_error( "Error when tabulating function adaptively, maximum number of nodes (" +
+                                      boost::lexical_cast< std::string >(
+                                          tabulationSettings->getMaximumNumberOfNodes( ) ) + ") exceeded." );
+        }
+        tabulatedData.insert( newNodes.begin( ), newNodes.end( ) );
+    }
+    while( newNodes.size( ) > 0 );
+
+    return tabulatedData;
+}
+
+//! Function to create an interpolator from tabulated data and interpolator settings.
+/*!
+ *  Function to create an interpolator from tabulated data and interpolator settings, for use with
+ *  tabulateFunctionAdaptivelyWithCustomInterpolator. Only interpolators that do not require derivatives of the data
+ *  are supported.
+ *  \param tabulatedData Map of tabulated data, with independent variables as keys.
+ *  \param interpolatorSettings Settings of interpolator that is to be created.
+ *  \return Interpolator created from tabulated data.
+ */
+template< typename IndependentVariableType, typename DependentVariableType >
+boost::shared_ptr< OneDimensionalInterpolator< IndependentVariableType, DependentVariableType > >
+createInterpolatorForTabulation(
+        const std::map< IndependentVariableType, DependentVariableType >& tabulatedData,
+        const boost::shared_ptr< InterpolatorSettings > interpolatorSettings )
+{
+    return createOneDimensionalInterpolator( tabulatedData, interpolatorSettings );
+}
+
+//! Function to tabulate a function on a grid that is adaptively refined to meet an interpolation error tolerance.
+/*!
+ *  Function to tabulate a function on a grid that is adaptively refined to meet an interpolation error tolerance,
+ *  for an interpolator defined by interpolator settings (see tabulateFunctionAdaptivelyWithCustomInterpolator).
+ *  Only interpolators that do not require derivatives of the data are supported.
+ *  \param sourceFunction Function that is to be tabulated.
+ *  \param lowerBound Lower bound of independent variable of tabulation.
+ *  \param upperBound Upper bound of independent variable of tabulation.
+ *  \param initialStepSize Step size of initial, uniform, grid.
+ *  \param interpolatorSettings Settings of interpolator with which the tabulation is to be used.
+ *  \param tabulationSettings Settings for adaptive tabulation.
+ *  \return Map of adaptively tabulated function, with independent variables as keys.
+ */
+template< typename IndependentVariableType, typename DependentVariableType >
+std::map< IndependentVariableType, DependentVariableType > tabulateFunctionAdaptively(
+        const boost::function< DependentVariableType( const IndependentVariableType ) > sourceFunction,
+        const IndependentVariableType lowerBound,
+        const IndependentVariableType upperBound,
+        const IndependentVariableType initialStepSize,
+        const boost::shared_ptr< InterpolatorSettings > interpolatorSettings,
+        const boost::shared_ptr< AdaptiveTabulationSettings > tabulationSettings )
+{
+    if( interpolatorSettings->getInterpolatorType( ) == hermite_spline_interpolator ||
+            interpolatorSettings->getInterpolatorType( ) == hermite_interpolator )
+    {
+        throw std::runtime_error( "Error when tabulating function adaptively, Hermite interpolators are not "
+                                  "supported." );
+    }
+
+    return tabulateFunctionAdaptivelyWithCustomInterpolator< IndependentVariableType, DependentVariableType >(
+                sourceFunction, lowerBound, upperBound, initialStepSize,
+                boost::bind( &createInterpolatorForTabulation< IndependentVariableType, DependentVariableType >,
+                             _1, interpolatorSettings ), tabulationSettings );
+}
+
+} // namespace interpolators
+
+} // namespace tudat
+
+#endif // TUDAT_ADAPTIVE_TABULATION_H
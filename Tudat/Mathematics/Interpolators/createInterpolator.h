@@ -18,6 +18,7 @@
 #include "Tudat/Mathematics/Interpolators/linearInterpolator.h"
 #include "Tudat/Mathematics/Interpolators/cubicSplineInterpolator.h"
 #include "Tudat/Mathematics/Interpolators/hermiteCubicSplineInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/hermiteInterpolator.h"
 #include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
 
 namespace tudat
@@ -32,7 +33,8 @@ enum OneDimensionalInterpolatorTypes
     linear_interpolator = 1,
     cubic_spline_interpolator = 2,
     lagrange_interpolator = 3,
-    hermite_spline_interpolator = 4
+    hermite_spline_interpolator = 4,
+    hermite_interpolator = 5
 };
 
 //! Base class for providing settings for creating an interpolator.
@@ -50,7 +52,9 @@ public:
     /*!
      *  Constructor
      * \param interpolatorType Selected type of interpolator.
-     * \param selectedLookupScheme Selected type of lookup scheme for independent variables.
+     * \param selectedLookupScheme Selected type of lookup scheme for independent variables. A
+     * hunting or binary search scheme is replaced by a constant-time scheme if the independent
+     * variables are (nearly) uniformly spaced (see createLookupScheme).
      */
     InterpolatorSettings( const OneDimensionalInterpolatorTypes interpolatorType,
                           const AvailableLookupScheme selectedLookupScheme = huntingAlgorithm ):
@@ -154,6 +158,45 @@ protected:
 
 };
 
+//! Class for providing settings to creating an Hermite interpolator of arbitrary order.
+class HermiteInterpolatorSettings: public InterpolatorSettings
+{
+public:
+
+    //! Constructor.
+    /*!
+     * Constructor.
+     * \param numberOfNodes Number of nodes used for each interpolation, the interpolating polynomial is of degree
+     * 2 * numberOfNodes - 1 (or 3 * numberOfNodes - 1 if second derivatives are provided).
+     * \param selectedLookupScheme Selected type of lookup scheme for independent variables.
+     */
+    HermiteInterpolatorSettings(
+            const int numberOfNodes,
+            const AvailableLookupScheme selectedLookupScheme = huntingAlgorithm ):
+        InterpolatorSettings( hermite_interpolator, selectedLookupScheme ),
+        numberOfNodes_( numberOfNodes )
+    { }
+
+    //! Destructor
+    ~HermiteInterpolatorSettings( ){ }
+
+    //! Function to get the number of nodes used for each interpolation.
+    /*!
+     * Function to get the number of nodes used for each interpolation.
+     * \return Number of nodes used for each interpolation.
+     */
+    int getNumberOfNodes( )
+    {
+        return numberOfNodes_;
+    }
+
+protected:
+
+    //! Number of nodes used for each interpolation.
+    int numberOfNodes_;
+
+};
+
 
 //! Function to create an interpolator
 /*!
@@ -165,6 +208,9 @@ protected:
  *  \param firstDerivativeOfDependentVariables First derivative of dependent variables w.r.t. independent variable at
  *  independent variables values in values of dataToInterpolate. By default, this vector is empty, it only needs to
  *  be supplied if the selected interpolator requires this data (e.g. Hermite spline).
+ *  \param secondDerivativeOfDependentVariables Second derivative of dependent variables w.r.t. independent variable
+ *  at independent variables values in values of dataToInterpolate. By default, this vector is empty, it may only be
+ *  supplied for an Hermite interpolator (of arbitrary order).
  *  \return Interpolator created from dataToInterpolate using interpolatorSettings.
  */
 template< typename IndependentVariableType, typename DependentVariableType >
@@ -173,6 +219,8 @@ createOneDimensionalInterpolator(
         const std::map< IndependentVariableType, DependentVariableType > dataToInterpolate,
         const boost::shared_ptr< InterpolatorSettings > interpolatorSettings,
         const std::vector< DependentVariableType > firstDerivativeOfDependentVariables =
+        std::vector< DependentVariableType >( ),
+        const std::vector< DependentVariableType > secondDerivativeOfDependentVariables =
         std::vector< DependentVariableType >( ) )
 {
     boost::shared_ptr< OneDimensionalInterpolator< IndependentVariableType, DependentVariableType > >
@@ -235,6 +283,22 @@ createOneDimensionalInterpolator(
                     interpolatorSettings->getSelectedLookupScheme( ) );
         break;
     }
+    case hermite_interpolator:
+    {
+        // Check consistency of input
+        boost::shared_ptr< HermiteInterpolatorSettings > hermiteInterpolatorSettings =
+                boost::dynamic_pointer_cast< HermiteInterpolatorSettings >( interpolatorSettings );
+        if( hermiteInterpolatorSettings == NULL )
+        {
+            throw std::runtime_error( "Error, did not recognize hermite interpolator settings" );
+        }
+        createdInterpolator = boost::make_shared< HermiteInterpolator
+                < IndependentVariableType, DependentVariableType > >(
+                    dataToInterpolate, firstDerivativeOfDependentVariables,
+                    hermiteInterpolatorSettings->getNumberOfNodes( ), secondDerivativeOfDependentVariables,
+                    interpolatorSettings->getSelectedLookupScheme( ) );
+        break;
+    }
 
     default:
         throw std::runtime_error(
@@ -185,6 +185,47 @@ public:
         calculateSecondDerivatives( );
     }
 
+    //! Cubic spline interpolator constructor from pre-computed second derivatives.
+    /*!
+     * Cubic spline interpolator constructor taking separate vectors of dependent and independent
+     * variable values, and the second derivatives of the curve at the nodes that were previously
+     * computed for these data (see getSecondDerivatives), e.g. when reading the interpolator from
+     * a file.
+     * \param independentVariables Vector with the independent variable values, must be
+     *  sorted in ascending order.
+     * \param dependentVariables Vector with the dependent variable values.
+     * \param secondDerivatives Vector with the second derivatives of the curve at the nodes.
+     * \param selectedLookupScheme Look-up scheme that is to be used when finding interval
+     * of requested independent variable value.
+     */
+    CubicSplineInterpolator( const std::vector< IndependentVariableType >& independentVariables,
+                             const std::vector< DependentVariableType >& dependentVariables,
+                             const std::vector< DependentVariableType >& secondDerivatives,
+                             AvailableLookupScheme selectedLookupScheme = huntingAlgorithm ):
+        secondDerivativeOfCurve_( secondDerivatives )
+    {
+        // Verify that the initialization variables are not empty and consistent.
+        if ( independentVariables.size( ) == 0 || dependentVariables.size( ) == 0 )
+        {
+            boost::throw_exception( boost::enable_error_info( std::runtime_error(
+               "The vectors used in the cubic spline interpolator initialization are empty." ) ) );
+        }
+        if ( dependentVariables.size( ) != independentVariables.size( ) ||
+             secondDerivatives.size( ) != independentVariables.size( ) )
+        {
+            throw std::runtime_error( "Error: independent variables, dependent variables and second derivatives not of same size in cubic spline constructor" );
+        }
+
+        // Set dependent and independent variable values.
+        independentValues_ = independentVariables;
+        dependentValues_ = dependentVariables;
+        numberOfDataPoints_ = independentValues_.size( );
+        zeroValue_ = dependentVariables[ 0 ] - dependentVariables[ 0 ];
+
+        // Create lookup scheme.
+        this->makeLookupScheme( selectedLookupScheme );
+    }
+
     //! Cubic spline interpolator constructor.
     /*!
      * Cubic spline interpolator constructor taking single map of independent and dependent
@@ -234,7 +275,7 @@ public:
     ~CubicSplineInterpolator( ){ }
 
     // Statement required to prevent hiding of base class functions.
-    using Interpolator< IndependentVariableType, DependentVariableType >::interpolate;
+    using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::interpolate;
 
     //! Interpolate.
     /*!
@@ -242,17 +283,19 @@ public:
      * yield an interpolated value of the dependent variable.
      * \param targetIndependentVariableValue Target independent variable value at which point
      * the interpolation is performed.
+     * \param cursor Cursor storing the state of the sequence of lookups (modified by function).
      * \return Interpolated dependent variable value.
      */
     DependentVariableType interpolate(
-            const IndependentVariableType targetIndependentVariableValue )
+            const IndependentVariableType targetIndependentVariableValue,
+            LookUpSchemeCursor& cursor ) const
     {
         using std::pow;
 
         // Determine the lower entry in the table corresponding to the target independent variable
         // value.
         int lowerEntry_ = lookUpScheme_->findNearestLowerNeighbour(
-                    targetIndependentVariableValue );
+                    targetIndependentVariableValue, cursor );
 
         // Get independent variable values bounding interval in which requested value lies.
         IndependentVariableType lowerValue, upperValue, squareDifference;
@@ -276,6 +319,16 @@ public:
                 coefficientD_ * secondDerivativeOfCurve_[ lowerEntry_ + 1 ];
     }
 
+    //! Function to return the second derivatives of the curve at the nodes.
+    /*!
+     * Function to return the second derivatives of the curve at the nodes.
+     * \return Second derivatives of the curve at the nodes.
+     */
+    const std::vector< DependentVariableType >& getSecondDerivatives( )
+    {
+        return secondDerivativeOfCurve_;
+    }
+
 protected:
 
 private:
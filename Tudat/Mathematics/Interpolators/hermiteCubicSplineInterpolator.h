@@ -111,18 +111,26 @@ public:
         return coefficients_;
     }
 
+    //! Get derivatives of dependent variables at nodes.
+    const std::vector< DependentVariableType >& getDerivativeValues( )
+    {
+        return derivativeValues_;
+    }
+
     //! Function interpolates dependent variable value at given independent variable value.
     /*!
      *  Function interpolates dependent variable value at given independent variable value.
      *  \param targetIndependentVariableValue Value of independent variable at which interpolation
      *  is to take place.
+     *  \param cursor Cursor storing the state of the sequence of lookups (modified by function).
      *  \return Interpolated value of interpolated dependent variable.
      */
-    DependentVariableType interpolate( const IndependentVariableType targetIndependentVariableValue )
+    DependentVariableType interpolate( const IndependentVariableType targetIndependentVariableValue,
+                                       LookUpSchemeCursor& cursor ) const
     {
         // Determine the lower entry in the table corresponding to the target independent variable value.
         int lowerEntry_ = lookUpScheme_->findNearestLowerNeighbour(
-                    targetIndependentVariableValue );
+                    targetIndependentVariableValue, cursor );
 
         // Compute Hermite spline
         IndependentVariableType factor = ( targetIndependentVariableValue - independentValues_[ lowerEntry_ ] )
@@ -0,0 +1,450 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Burden R.L., Faires J.D., Numerical Analysis, 9th edition. Brooks/Cole, 2011.
+ */
+
+#ifndef TUDAT_HERMITE_INTERPOLATOR_H
+#define TUDAT_HERMITE_INTERPOLATOR_H
+
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/array.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/Interpolators/oneDimensionalInterpolator.h"
+
+namespace tudat
+{
+
+namespace interpolators
+{
+
+//! Maximum number of nodes used by a single evaluation of the Hermite interpolators.
+static const int maximumNumberOfHermiteNodes = 16;
+
+//! Function to evaluate the Hermite interpolating polynomial, and its derivative, through a set of nodes.
+/*!
+ *  Function to evaluate the Hermite interpolating polynomial, and its derivative, through a set of nodes at which
+ *  the value and first (and optionally second) derivative of the interpolated function are known. The polynomial is
+ *  computed in Newton form from divided differences with repeated nodes (Burden & Faires, 2011), w.r.t. an
+ *  independent variable normalized by the span of the nodes. The polynomial is of degree 2N-1 (or 3N-1 if second
+ *  derivatives are used) for N nodes.
+ *  \tparam IndependentVariableType Type of independent variables.
+ *  \tparam ValueType Type of interpolated values.
+ *  \tparam ScalarType Type of scalar with which the values are multiplied.
+ *  \param nodes Independent variable values of the nodes (N entries, sorted in ascending order).
+ *  \param values Values of interpolated function at the nodes.
+ *  \param firstDerivatives First derivatives of interpolated function at the nodes.
+ *  \param secondDerivatives Second derivatives of interpolated function at the nodes (NULL if not used).
+ *  \param numberOfNodes Number of nodes N (at least 2, at most maximumNumberOfHermiteNodes).
+ *  \param targetIndependentVariableValue Value of independent variable at which the polynomial is to be evaluated.
+ *  \param interpolatedValue Value of polynomial at targetIndependentVariableValue (returned by reference).
+ *  \param interpolatedDerivative Derivative of polynomial at targetIndependentVariableValue (returned by reference).
+ */
+template< typename IndependentVariableType, typename ValueType, typename ScalarType >
+void evaluateHermitePolynomial( const IndependentVariableType* nodes,
+                                const ValueType* values,
+                                const ValueType* firstDerivatives,
+                                const ValueType* secondDerivatives,
+                                const int numberOfNodes,
+                                const IndependentVariableType targetIndependentVariableValue,
+                                ValueType& interpolatedValue,
+                                ValueType& interpolatedDerivative )
+{
+    const int multiplicity = ( secondDerivatives == NULL ) ? 2 : 3;
+    const int numberOfCoefficients = multiplicity * numberOfNodes;
+
+    // Compute normalized nodes, and scale derivatives accordingly.
+    const IndependentVariableType nodeSpan = nodes[ numberOfNodes - 1 ] - nodes[ 0 ];
+    boost::array< ScalarType, maximumNumberOfHermiteNodes > normalizedNodes =
+            boost::array< ScalarType, maximumNumberOfHermiteNodes >( );
+    for( int i = 0; i < numberOfNodes; i++ )
+    {
+        normalizedNodes[ i ] = static_cast< ScalarType >( ( nodes[ i ] - nodes[ 0 ] ) / nodeSpan );
+    }
+    const ScalarType firstDerivativeScaling = static_cast< ScalarType >( nodeSpan );
+    const ScalarType secondDerivativeScaling = firstDerivativeScaling * firstDerivativeScaling /
+            static_cast< ScalarType >( 2.0 );
+
+    // Compute divided differences in place, coefficients j is the divided difference of the first j+1 (repeated)
+    // nodes after the final iteration (value-initialized, since the compiler cannot see that only the first
+    // numberOfCoefficients entries are read).
+    boost::array< ValueType, 3 * maximumNumberOfHermiteNodes > coefficients =
+            boost::array< ValueType, 3 * maximumNumberOfHermiteNodes >( );
+    for( int j = 0; j < numberOfCoefficients; j++ )
+    {
+        coefficients[ j ] = values[ j / multiplicity ];
+    }
+    for( int level = 1; level < numberOfCoefficients; level++ )
+    {
+        for( int j = numberOfCoefficients - 1; j >= level; j-- )
+        {
+            const int currentNode = j / multiplicity;
+            const int lowerNode = ( j - level ) / multiplicity;
+            if( currentNode == lowerNode && level == 1 )
+            {
+                coefficients[ j ] = firstDerivatives[ currentNode ] * firstDerivativeScaling;
+            }
+            else if( currentNode == lowerNode )
+            {
+                coefficients[ j ] = secondDerivatives[ currentNode ] * secondDerivativeScaling;
+            }
+            else
+            {
+                coefficients[ j ] = ( coefficients[ j ] - coefficients[ j - 1 ] ) /
+                        ( normalizedNodes[ currentNode ] - normalizedNodes[ lowerNode ] );
+            }
+        }
+    }
+
+    // Evaluate Newton form of polynomial and its derivative.
+    const ScalarType normalizedTargetValue =
+            static_cast< ScalarType >( ( targetIndependentVariableValue - nodes[ 0 ] ) / nodeSpan );
+    interpolatedValue = coefficients[ numberOfCoefficients - 1 ];
+    interpolatedDerivative = interpolatedValue - interpolatedValue;
+    for( int j = numberOfCoefficients - 2; j >= 0; j-- )
+    {
+        const ScalarType nodeDifference = normalizedTargetValue - normalizedNodes[ j / multiplicity ];
+        interpolatedDerivative = interpolatedDerivative * nodeDifference + interpolatedValue;
+        interpolatedValue = interpolatedValue * nodeDifference + coefficients[ j ];
+    }
+    interpolatedDerivative = interpolatedDerivative / firstDerivativeScaling;
+}
+
+//! Function to determine the index of the first node used for an Hermite interpolation.
+/*!
+ *  Function to determine the index of the first node used for an Hermite interpolation, so that the nodes are
+ *  centered around the interval containing the target value, but are shifted near the edges of the data.
+ *  \param nearestLowerIndex Index of the nearest lower data point of the target value.
+ *  \param numberOfNodes Number of nodes used for each interpolation.
+ *  \param numberOfDataPoints Total number of data points.
+ *  \return Index of the first node used for the interpolation.
+ */
+inline int getFirstHermiteNodeIndex( const int nearestLowerIndex, const int numberOfNodes,
+                                     const int numberOfDataPoints )
+{
+    int firstNodeIndex = nearestLowerIndex + 1 - numberOfNodes / 2;
+    if( firstNodeIndex < 0 )
+    {
+        firstNodeIndex = 0;
+    }
+    else if( firstNodeIndex > numberOfDataPoints - numberOfNodes )
+    {
+        firstNodeIndex = numberOfDataPoints - numberOfNodes;
+    }
+    return firstNodeIndex;
+}
+
+//! Function to check the input of an Hermite interpolator.
+/*!
+ *  Function to check the input of an Hermite interpolator, throws an error if it is inconsistent.
+ *  \param numberOfDataPoints Number of data points of dependent variables.
+ *  \param numberOfFirstDerivatives Number of first derivatives of dependent variables.
+ *  \param numberOfSecondDerivatives Number of second derivatives of dependent variables (zero if not used).
+ *  \param numberOfNodes Number of nodes used for each interpolation.
+ */
+inline void checkHermiteInterpolatorInput( const unsigned int numberOfDataPoints,
+                                           const unsigned int numberOfFirstDerivatives,
+                                           const unsigned int numberOfSecondDerivatives,
+                                           const int numberOfNodes )
+{
+    if( numberOfNodes < 2 || numberOfNodes > maximumNumberOfHermiteNodes )
+    {
+        throw std::runtime_error( "Error: number of nodes of Hermite interpolator must be between 2 and " +
+                                  boost::lexical_cast< std::string >( maximumNumberOfHermiteNodes ) + "." );
+    }
+    if( numberOfDataPoints < static_cast< unsigned int >( numberOfNodes ) )
+    {
+        throw std::runtime_error( "Error: Hermite interpolator has fewer data points than nodes." );
+    }
+    if( numberOfFirstDerivatives != numberOfDataPoints )
+    {
+        throw std::runtime_error( "Error: first derivative values incompatible in Hermite interpolator." );
+    }
+    if( numberOfSecondDerivatives != 0 && numberOfSecondDerivatives != numberOfDataPoints )
+    {
+        throw std::runtime_error( "Error: second derivative values incompatible in Hermite interpolator." );
+    }
+}
+
+//! Hermite interpolator of arbitrary order.
+/*!
+ *  Hermite interpolator, which interpolates the dependent variables using a polynomial that matches both the
+ *  values and the first derivatives (and optionally the second derivatives) at a given number of nodes around the
+ *  requested independent variable value. For N nodes, the polynomial is of degree 2N-1 (or 3N-1 when second
+ *  derivatives are used), so that a much sparser table is required than for Lagrange interpolation of the same
+ *  accuracy. Near the edges of the table, the nodes are shifted so that they remain within the data.
+ *  \tparam IndependentVariableType Type of independent variables.
+ *  \tparam DependentVariableType Type of dependent variables.
+ *  \tparam ScalarType Type of scalar with which the dependent variables are multiplied.
+ */
+template< typename IndependentVariableType, typename DependentVariableType,
+          typename ScalarType = IndependentVariableType >
+class HermiteInterpolator: public OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >
+{
+public:
+
+    using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::dependentValues_;
+    using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::independentValues_;
+    using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::lookUpScheme_;
+    using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::interpolate;
+
+    //! Constructor from data map.
+    /*!
+     *  Constructor from data map.
+     *  \param dataMap Map with the independent variable values as keys and corresponding dependent variable values as
+     *  values.
+     *  \param firstDerivativeValues First derivatives of dependent variables at values of dataMap (in same order).
+     *  \param numberOfNodes Number of nodes used for each interpolation.
+     *  \param secondDerivativeValues Second derivatives of dependent variables at values of dataMap (in same order),
+     *  empty if no second derivatives are to be used.
+     *  \param selectedLookupScheme Look-up scheme that is to be used when finding interval of requested independent
+     *  variable value.
+     */
+    HermiteInterpolator( const std::map< IndependentVariableType, DependentVariableType >& dataMap,
+                         const std::vector< DependentVariableType >& firstDerivativeValues,
+                         const int numberOfNodes,
+                         const std::vector< DependentVariableType >& secondDerivativeValues =
+            std::vector< DependentVariableType >( ),
+                         const AvailableLookupScheme selectedLookupScheme = huntingAlgorithm ):
+        numberOfNodes_( numberOfNodes ),
+        firstDerivativeValues_( firstDerivativeValues ), secondDerivativeValues_( secondDerivativeValues )
+    {
+        checkHermiteInterpolatorInput( dataMap.size( ), firstDerivativeValues.size( ),
+                                       secondDerivativeValues.size( ), numberOfNodes );
+
+        // Fill data vectors with data from map.
+        for( typename std::map< IndependentVariableType, DependentVariableType >::const_iterator
+             mapIterator = dataMap.begin( ); mapIterator != dataMap.end( ); mapIterator++ )
+        {
+            independentValues_.push_back( mapIterator->first );
+            dependentValues_.push_back( mapIterator->second );
+        }
+
+        this->makeLookupScheme( selectedLookupScheme );
+    }
+
+    //! Destructor.
+    ~HermiteInterpolator( ){ }
+
+    //! Function interpolates dependent variable value at given independent variable value.
+    /*!
+     *  Function interpolates dependent variable value at given independent variable value.
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation is to take place.
+     *  \param cursor Cursor storing the state of the sequence of lookups (modified by function).
+     *  \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolate( const IndependentVariableType targetIndependentVariableValue,
+                                       LookUpSchemeCursor& cursor ) const
+    {
+        DependentVariableType interpolatedValue, interpolatedDerivative;
+        interpolateValueAndDerivative( targetIndependentVariableValue, interpolatedValue, interpolatedDerivative,
+                                       cursor );
+        return interpolatedValue;
+    }
+
+    //! Function interpolates dependent variable value, and its derivative, at given independent variable value.
+    /*!
+     *  Function interpolates dependent variable value, and its derivative (i.e. the derivative of the interpolating
+     *  polynomial), at given independent variable value.
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation is to take place.
+     *  \param interpolatedValue Interpolated value of dependent variable (returned by reference).
+     *  \param interpolatedDerivative Interpolated derivative of dependent variable (returned by reference).
+     *  \param cursor Cursor storing the state of the sequence of lookups (modified by function).
+     */
+    void interpolateValueAndDerivative( const IndependentVariableType targetIndependentVariableValue,
+                                        DependentVariableType& interpolatedValue,
+                                        DependentVariableType& interpolatedDerivative,
+                                        LookUpSchemeCursor& cursor ) const
+    {
+        const int firstNodeIndex = getFirstHermiteNodeIndex(
+                    lookUpScheme_->findNearestLowerNeighbour( targetIndependentVariableValue, cursor ),
+                    numberOfNodes_, independentValues_.size( ) );
+
+        evaluateHermitePolynomial< IndependentVariableType, DependentVariableType, ScalarType >(
+                    &independentValues_[ firstNodeIndex ], &dependentValues_[ firstNodeIndex ],
+                    &firstDerivativeValues_[ firstNodeIndex ],
+                    secondDerivativeValues_.size( ) > 0 ? &secondDerivativeValues_[ firstNodeIndex ] : NULL,
+                    numberOfNodes_, targetIndependentVariableValue, interpolatedValue, interpolatedDerivative );
+    }
+
+    //! Function to return the number of nodes used for each interpolation.
+    /*!
+     *  Function to return the number of nodes used for each interpolation.
+     *  \return Number of nodes used for each interpolation.
+     */
+    int getNumberOfNodes( )
+    {
+        return numberOfNodes_;
+    }
+
+    //! Function to return the first derivatives of the dependent variables at the nodes.
+    /*!
+     *  Function to return the first derivatives of the dependent variables at the nodes.
+     *  \return First derivatives of the dependent variables at the nodes.
+     */
+    const std::vector< DependentVariableType >& getFirstDerivativeValues( )
+    {
+        return firstDerivativeValues_;
+    }
+
+    //! Function to return the second derivatives of the dependent variables at the nodes.
+    /*!
+     *  Function to return the second derivatives of the dependent variables at the nodes.
+     *  \return Second derivatives of the dependent variables at the nodes (empty if not used).
+     */
+    const std::vector< DependentVariableType >& getSecondDerivativeValues( )
+    {
+        return secondDerivativeValues_;
+    }
+
+private:
+
+    //! Number of nodes used for each interpolation.
+    int numberOfNodes_;
+
+    //! First derivatives of dependent variables at independentValues_.
+    std::vector< DependentVariableType > firstDerivativeValues_;
+
+    //! Second derivatives of dependent variables at independentValues_ (empty if not used).
+    std::vector< DependentVariableType > secondDerivativeValues_;
+};
+
+//! Hermite interpolator for Cartesian state histories.
+/*!
+ *  Hermite interpolator for Cartesian state histories, which interpolates the position using the velocity (and
+ *  optionally acceleration) as its derivatives (see HermiteInterpolator). The interpolated velocity is the derivative
+ *  of the interpolated position, so that the interpolated state is consistent. Since the velocity is exactly the
+ *  derivative of the position, this allows states to be tabulated much more sparsely than for Lagrange
+ *  interpolation at the same accuracy.
+ *  \tparam IndependentVariableType Type of independent variables (time).
+ *  \tparam StateScalarType Type of scalar of states.
+ */
+template< typename IndependentVariableType, typename StateScalarType >
+class HermiteStateInterpolator:
+        public OneDimensionalInterpolator< IndependentVariableType, Eigen::Matrix< StateScalarType, 6, 1 > >
+{
+public:
+
+    using OneDimensionalInterpolator< IndependentVariableType, Eigen::Matrix< StateScalarType, 6, 1 > >::
+    dependentValues_;
+    using OneDimensionalInterpolator< IndependentVariableType, Eigen::Matrix< StateScalarType, 6, 1 > >::
+    independentValues_;
+    using OneDimensionalInterpolator< IndependentVariableType, Eigen::Matrix< StateScalarType, 6, 1 > >::
+    lookUpScheme_;
+    using OneDimensionalInterpolator< IndependentVariableType, Eigen::Matrix< StateScalarType, 6, 1 > >::
+    interpolate;
+
+    //! Constructor from state history.
+    /*!
+     *  Constructor from state history.
+     *  \param stateMap Map with times as keys and Cartesian states (position, velocity) as values.
+     *  \param numberOfNodes Number of nodes used for each interpolation.
+     *  \param accelerations Accelerations at the times of stateMap (in same order), empty if no accelerations are to
+     *  be used.
+     *  \param selectedLookupScheme Look-up scheme that is to be used when finding interval of requested time.
+     */
+    HermiteStateInterpolator(
+            const std::map< IndependentVariableType, Eigen::Matrix< StateScalarType, 6, 1 > >& stateMap,
+            const int numberOfNodes,
+            const std::vector< Eigen::Matrix< StateScalarType, 3, 1 > >& accelerations =
+            std::vector< Eigen::Matrix< StateScalarType, 3, 1 > >( ),
+            const AvailableLookupScheme selectedLookupScheme = huntingAlgorithm ):
+        numberOfNodes_( numberOfNodes ), accelerations_( accelerations )
+    {
+        checkHermiteInterpolatorInput( stateMap.size( ), stateMap.size( ), accelerations.size( ), numberOfNodes );
+
+        // Fill data vectors with data from map.
+        for( typename std::map< IndependentVariableType, Eigen::Matrix< StateScalarType, 6, 1 > >::const_iterator
+             mapIterator = stateMap.begin( ); mapIterator != stateMap.end( ); mapIterator++ )
+        {
+            independentValues_.push_back( mapIterator->first );
+            dependentValues_.push_back( mapIterator->second );
+        }
+
+        this->makeLookupScheme( selectedLookupScheme );
+    }
+
+    //! Destructor.
+    ~HermiteStateInterpolator( ){ }
+
+    //! Function interpolates state at given time.
+    /*!
+     *  Function interpolates state at given time.
+     *  \param targetIndependentVariableValue Time at which interpolation is to take place.
+     *  \param cursor Cursor storing the state of the sequence of lookups (modified by function).
+     *  \return Interpolated state.
+     */
+    Eigen::Matrix< StateScalarType, 6, 1 > interpolate( const IndependentVariableType targetIndependentVariableValue,
+                                                        LookUpSchemeCursor& cursor ) const
+    {
+        const int firstNodeIndex = getFirstHermiteNodeIndex(
+                    lookUpScheme_->findNearestLowerNeighbour( targetIndependentVariableValue, cursor ),
+                    numberOfNodes_, independentValues_.size( ) );
+
+        // Retrieve positions and velocities of nodes.
+        boost::array< Eigen::Matrix< StateScalarType, 3, 1 >, maximumNumberOfHermiteNodes > positions, velocities;
+        for( int i = 0; i < numberOfNodes_; i++ )
+        {
+            positions[ i ] = dependentValues_[ firstNodeIndex + i ].segment( 0, 3 );
+            velocities[ i ] = dependentValues_[ firstNodeIndex + i ].segment( 3, 3 );
+        }
+
+        Eigen::Matrix< StateScalarType, 3, 1 > interpolatedPosition, interpolatedVelocity;
+        evaluateHermitePolynomial< IndependentVariableType, Eigen::Matrix< StateScalarType, 3, 1 >, StateScalarType >(
+                    &independentValues_[ firstNodeIndex ], positions.data( ), velocities.data( ),
+                    accelerations_.size( ) > 0 ? &accelerations_[ firstNodeIndex ] : NULL,
+                    numberOfNodes_, targetIndependentVariableValue, interpolatedPosition, interpolatedVelocity );
+
+        Eigen::Matrix< StateScalarType, 6, 1 > interpolatedState;
+        interpolatedState << interpolatedPosition, interpolatedVelocity;
+        return interpolatedState;
+    }
+
+    //! Function to return the number of nodes used for each interpolation.
+    /*!
+     *  Function to return the number of nodes used for each interpolation.
+     *  \return Number of nodes used for each interpolation.
+     */
+    int getNumberOfNodes( )
+    {
+        return numberOfNodes_;
+    }
+
+    //! Function to return the accelerations at the nodes.
+    /*!
+     *  Function to return the accelerations at the nodes.
+     *  \return Accelerations at the nodes (empty if not used).
+     */
+    const std::vector< Eigen::Matrix< StateScalarType, 3, 1 > >& getAccelerations( )
+    {
+        return accelerations_;
+    }
+
+private:
+
+    //! Number of nodes used for each interpolation.
+    int numberOfNodes_;
+
+    //! Accelerations at independentValues_ (empty if not used).
+    std::vector< Eigen::Matrix< StateScalarType, 3, 1 > > accelerations_;
+};
+
+} // namespace interpolators
+
+} // namespace tudat
+
+#endif // TUDAT_HERMITE_INTERPOLATOR_H
@@ -0,0 +1,302 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+#include <boost/filesystem.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/static_assert.hpp>
+
+#include "Tudat/Mathematics/Interpolators/interpolatorSerialization.h"
+
+namespace tudat
+{
+
+namespace interpolators
+{
+
+BOOST_STATIC_ASSERT( sizeof( SerializedInterpolatorFileHeader ) == 80 );
+BOOST_STATIC_ASSERT( sizeof( SerializedDataBlockHeader ) == 16 );
+
+//! Identifier of binary interpolator file type.
+static const char serializedInterpolatorFileIdentifier[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'I', 'N', 'T' };
+
+//! Current version of binary interpolator file format.
+static const boost::uint32_t serializedInterpolatorFormatVersion = 1;
+
+//! Marker used to verify byte order of binary interpolator file.
+static const boost::uint32_t serializedInterpolatorByteOrderMarker = 0x01020304;
+
+//! Alignment (in bytes) of data blocks in binary interpolator file.
+static const boost::uint64_t serializedDataBlockAlignment = 16;
+
+//! Function to compute the number of padding bytes required to align a data block.
+static boost::uint64_t getDataBlockPadding( const boost::uint64_t dataBlockSize )
+{
+    return ( serializedDataBlockAlignment - dataBlockSize % serializedDataBlockAlignment ) %
+            serializedDataBlockAlignment;
+}
+
+//! Constructor, opens the (temporary) file, and writes the settings key.
+SerializedInterpolatorFileWriter::SerializedInterpolatorFileWriter(
+        const std::string& fileName,
+        const SerializedInterpolatorType interpolatorType,
+        const std::string& settingsKey ):
+    fileName_( fileName ),
+    temporaryFileName_( boost::filesystem::unique_path( fileName + ".%%%%-%%%%-%%%%.tmp" ).string( ) ),
+    isClosed_( false )
+{
+    // Initialize file header.
+    std::memset( &fileHeader_, 0, sizeof( fileHeader_ ) );
+    std::memcpy( fileHeader_.fileIdentifier, serializedInterpolatorFileIdentifier,
+                 sizeof( fileHeader_.fileIdentifier ) );
+    fileHeader_.formatVersion = serializedInterpolatorFormatVersion;
+    fileHeader_.byteOrderMarker = serializedInterpolatorByteOrderMarker;
+    fileHeader_.interpolatorType = interpolatorType;
+
+    // Open file, and reserve space for header (written when closing file).
+    fileStream_.open( temporaryFileName_.c_str( ), std::ios::out | std::ios::binary | std::ios::trunc );
+    if( fileStream_.fail( ) )
+    {
+        throw std::runtime_error( "Error, binary interpolator file " + temporaryFileName_ +
+                                  " could not be opened for writing." );
+    }
+    fileStream_.write( reinterpret_cast< const char* >( &fileHeader_ ), sizeof( fileHeader_ ) );
+
+    writeDataBlock( settingsKey.c_str( ), settingsKey.size( ), sizeof( char ) );
+}
+
+//! Destructor, removes the temporary file if the writer was not closed.
+SerializedInterpolatorFileWriter::~SerializedInterpolatorFileWriter( )
+{
+    if( !isClosed_ )
+    {
+        fileStream_.close( );
+        std::remove( temporaryFileName_.c_str( ) );
+    }
+}
+
+//! Function to write a data block.
+void SerializedInterpolatorFileWriter::writeDataBlock(
+        const void* data, const boost::uint64_t numberOfElements, const boost::uint64_t elementSize )
+{
+    SerializedDataBlockHeader dataBlockHeader;
+    dataBlockHeader.numberOfElements = numberOfElements;
+    dataBlockHeader.elementSize = elementSize;
+    fileStream_.write( reinterpret_cast< const char* >( &dataBlockHeader ), sizeof( dataBlockHeader ) );
+
+    const boost::uint64_t dataBlockSize = numberOfElements * elementSize;
+    if( dataBlockSize > 0 )
+    {
+        fileStream_.write( static_cast< const char* >( data ), static_cast< std::streamsize >( dataBlockSize ) );
+    }
+
+    const char padding[ serializedDataBlockAlignment ] = { };
+    fileStream_.write( padding, static_cast< std::streamsize >( getDataBlockPadding( dataBlockSize ) ) );
+
+    fileHeader_.numberOfDataBlocks++;
+}
+
+//! Function to write the file header, close the file, and rename it to the requested file name.
+void SerializedInterpolatorFileWriter::close( )
+{
+    // Write final header.
+    fileHeader_.fileSize = static_cast< boost::uint64_t >( fileStream_.tellp( ) );
+    fileStream_.seekp( 0 );
+    fileStream_.write( reinterpret_cast< const char* >( &fileHeader_ ), sizeof( fileHeader_ ) );
+    fileStream_.close( );
+
+    if( fileStream_.fail( ) )
+    {
+        std::remove( temporaryFileName_.c_str( ) );
+        isClosed_ = true;
+        throw std::runtime_error( "Error when writing binary interpolator file " + temporaryFileName_ );
+    }
+
+    // Move completed file to requested file name.
+    isClosed_ = true;
+    try
+    {
+        boost::filesystem::rename( temporaryFileName_, fileName_ );
+    }
+    catch( boost::filesystem::filesystem_error& renameError )
+    {
+        std::remove( temporaryFileName_.c_str( ) );
+        throw std::runtime_error( "Error, binary interpolator file " + fileName_ + " could not be created: " +
+                                  renameError.what( ) );
+    }
+}
+
+//! Constructor, maps binary interpolator file into memory.
+SerializedInterpolatorFileReader::SerializedInterpolatorFileReader(
+        const std::string& fileName, const std::string& settingsKey ):
+    fileName_( fileName ), nextDataBlockOffset_( sizeof( SerializedInterpolatorFileHeader ) ),
+    numberOfDataBlocksRead_( 0 )
+{
+    // Map complete file into memory (read-only).
+    try
+    {
+        boost::interprocess::file_mapping( fileName.c_str( ), boost::interprocess::read_only ).swap( fileMapping_ );
+        boost::interprocess::mapped_region( fileMapping_, boost::interprocess::read_only ).swap( mappedRegion_ );
+    }
+    catch( boost::interprocess::interprocess_exception& mappingException )
+    {
+        throw std::runtime_error( "Error, binary interpolator file " + fileName +
+                                  " could not be mapped into memory: " + mappingException.what( ) );
+    }
+
+    // Check file header.
+    if( mappedRegion_.get_size( ) < sizeof( SerializedInterpolatorFileHeader ) )
+    {
+        throw std::runtime_error( "Error, file " + fileName + " is too small to be a binary interpolator file." );
+    }
+
+    fileHeader_ = static_cast< const SerializedInterpolatorFileHeader* >( mappedRegion_.get_address( ) );
+    if( std::memcmp( fileHeader_->fileIdentifier, serializedInterpolatorFileIdentifier,
+                     sizeof( fileHeader_->fileIdentifier ) ) != 0 )
+    {
+        throw std::runtime_error( "Error, file " + fileName + " is not a binary interpolator file." );
+    }
+    else if( fileHeader_->byteOrderMarker != serializedInterpolatorByteOrderMarker )
+    {
+        throw std::runtime_error( "Error, binary interpolator file " + fileName +
+                                  " was written with different byte order." );
+    }
+    else if( fileHeader_->formatVersion != serializedInterpolatorFormatVersion )
+    {
+        throw std::runtime_error( "Error, binary interpolator file " + fileName + " has unsupported format version " +
+                                  boost::lexical_cast< std::string >( fileHeader_->formatVersion ) );
+    }
+    else if( fileHeader_->fileSize != mappedRegion_.get_size( ) )
+    {
+        throw std::runtime_error( "Error, size of binary interpolator file " + fileName +
+                                  " is inconsistent with its header (file may be incomplete)." );
+    }
+
+    // Check settings key.
+    boost::uint64_t settingsKeySize;
+    const char* fileSettingsKey = static_cast< const char* >( getNextDataBlock( sizeof( char ), settingsKeySize ) );
+    if( std::string( fileSettingsKey, settingsKeySize ) != settingsKey )
+    {
+        throw std::runtime_error( "Error, settings key of binary interpolator file " + fileName +
+                                  " is different from requested settings key." );
+    }
+}
+
+//! Function to retrieve the next data block.
+const void* SerializedInterpolatorFileReader::getNextDataBlock(
+        const boost::uint64_t elementSize, boost::uint64_t& numberOfElements )
+{
+    if( numberOfDataBlocksRead_ >= fileHeader_->numberOfDataBlocks ||
+            nextDataBlockOffset_ + sizeof( SerializedDataBlockHeader ) > mappedRegion_.get_size( ) )
+    {
+        throw std::runtime_error( "Error, binary interpolator file " + fileName_ +
+                                  " contains fewer data blocks than required." );
+    }
+
+    // Check data block header.
+    const char* fileData = static_cast< const char* >( mappedRegion_.get_address( ) );
+    const SerializedDataBlockHeader* dataBlockHeader =
+            reinterpret_cast< const SerializedDataBlockHeader* >( fileData + nextDataBlockOffset_ );
+    if( dataBlockHeader->elementSize != elementSize )
+    {
+        throw std::runtime_error( "Error, element size of data block " +
+                                  boost::lexical_cast< std::string >( numberOfDataBlocksRead_ ) +
+                                  " of binary interpolator file " + fileName_ + " is inconsistent." );
+    }
+
+    const boost::uint64_t dataBlockOffset = nextDataBlockOffset_ + sizeof( SerializedDataBlockHeader );
+    const boost::uint64_t dataBlockSize = dataBlockHeader->numberOfElements * elementSize;
+    if( dataBlockSize / elementSize != dataBlockHeader->numberOfElements ||
+            dataBlockOffset + dataBlockSize > mappedRegion_.get_size( ) )
+    {
+        throw std::runtime_error( "Error, size of data block " +
+                                  boost::lexical_cast< std::string >( numberOfDataBlocksRead_ ) +
+                                  " of binary interpolator file " + fileName_ + " is inconsistent." );
+    }
+
+    numberOfElements = dataBlockHeader->numberOfElements;
+    nextDataBlockOffset_ = dataBlockOffset + dataBlockSize + getDataBlockPadding( dataBlockSize );
+    numberOfDataBlocksRead_++;
+
+    return fileData + dataBlockOffset;
+}
+
+//! Function to compute the hash of a settings key.
+std::string computeSettingsKeyHash( const std::string& settingsKey )
+{
+    boost::uint64_t hash = 14695981039346656037ULL;
+    for( unsigned int i = 0; i < settingsKey.size( ); i++ )
+    {
+        hash ^= static_cast< unsigned char >( settingsKey[ i ] );
+        hash *= 1099511628211ULL;
+    }
+
+    std::ostringstream hashStream;
+    hashStream.width( 16 );
+    hashStream.fill( '0' );
+    hashStream << std::hex << hash;
+    return hashStream.str( );
+}
+
+//! Function to create a settings key describing interpolator settings.
+std::string getInterpolatorSettingsKey( const boost::shared_ptr< InterpolatorSettings > interpolatorSettings )
+{
+    std::string settingsKey =
+            "interpolator=" + boost::lexical_cast< std::string >( interpolatorSettings->getInterpolatorType( ) ) +
+            ";lookup=" + boost::lexical_cast< std::string >( interpolatorSettings->getSelectedLookupScheme( ) ) + ";";
+
+    if( boost::shared_ptr< LagrangeInterpolatorSettings > lagrangeInterpolatorSettings =
+            boost::dynamic_pointer_cast< LagrangeInterpolatorSettings >( interpolatorSettings ) )
+    {
+        settingsKey += "order=" + boost::lexical_cast< std::string >(
+                    lagrangeInterpolatorSettings->getInterpolatorOrder( ) ) +
+                ";longDouble=" + boost::lexical_cast< std::string >(
+                    lagrangeInterpolatorSettings->getUseLongDoubleTimeStep( ) ) +
+                ";boundary=" + boost::lexical_cast< std::string >(
+                    lagrangeInterpolatorSettings->getBoundaryHandling( ) ) + ";";
+    }
+    else if( boost::shared_ptr< HermiteInterpolatorSettings > hermiteInterpolatorSettings =
+             boost::dynamic_pointer_cast< HermiteInterpolatorSettings >( interpolatorSettings ) )
+    {
+        settingsKey += "nodes=" + boost::lexical_cast< std::string >(
+                    hermiteInterpolatorSettings->getNumberOfNodes( ) ) + ";";
+    }
+
+    return settingsKey;
+}
+
+//! Function to retrieve the name of the cache file of an interpolator.
+std::string getInterpolatorCacheFileName( const std::string& cacheDirectory, const std::string& settingsKey )
+{
+    return ( boost::filesystem::path( cacheDirectory ) /
+             ( "interpolator_" + computeSettingsKeyHash( settingsKey ) + ".bin" ) ).string( );
+}
+
+//! Function to ensure that the directory in which cached interpolators are stored exists.
+void createInterpolatorCacheDirectory( const std::string& cacheDirectory )
+{
+    try
+    {
+        boost::filesystem::create_directories( cacheDirectory );
+    }
+    catch( boost::filesystem::filesystem_error& directoryError )
+    {
+        throw std::runtime_error( "Error, interpolator cache directory " + cacheDirectory +
+                                  " could not be created: " + directoryError.what( ) );
+    }
+}
+
+} // namespace interpolators
+
+} // namespace tudat
@@ -0,0 +1,1143 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_INTERPOLATOR_SERIALIZATION_H
+#define TUDAT_INTERPOLATOR_SERIALIZATION_H
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/array.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/function.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/multi_array.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/Interpolators/createInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/matrixLagrangeInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/multiLinearInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/multiOutputCubicSplineInterpolator.h"
+
+namespace tudat
+{
+
+namespace interpolators
+{
+
+//! Types of interpolators that can be written to (and read from) a binary interpolator file.
+/*!
+ *  Types of interpolators that can be written to (and read from) a binary interpolator file. The values of the entries
+ *  are stored in the file, and must not be changed.
+ */
+enum SerializedInterpolatorType
+{
+    serialized_linear_interpolator = 1,
+    serialized_cubic_spline_interpolator = 2,
+    serialized_lagrange_interpolator = 3,
+    serialized_matrix_lagrange_interpolator = 4,
+    serialized_hermite_cubic_spline_interpolator = 5,
+    serialized_hermite_interpolator = 6,
+    serialized_hermite_state_interpolator = 7,
+    serialized_multi_output_cubic_spline_interpolator = 8,
+    serialized_multi_linear_interpolator = 9
+};
+
+//! Header of binary interpolator file.
+/*!
+ *  Header of binary interpolator file, as written by SerializedInterpolatorFileWriter. The header (of fixed size of 80
+ *  bytes) is followed by a number of data blocks. Each data block consists of a SerializedDataBlockHeader, followed by
+ *  the raw memory of the elements of the block (e.g. the independent or dependent values of the interpolator), padded
+ *  to a multiple of 16 bytes. Consequently, the data of each block is suitably aligned to be used directly from a
+ *  memory-mapped file. The first data block contains the settings key with which the file was written (see
+ *  getCachedOneDimensionalInterpolator). Only files with the same byte order and scalar types as those of the machine
+ *  and program by which they are read are supported.
+ */
+struct SerializedInterpolatorFileHeader
+{
+    //! Identifier of file type (equal to TUDATINT, without terminating null character).
+    char fileIdentifier[ 8 ];
+
+    //! Version of binary file format.
+    boost::uint32_t formatVersion;
+
+    //! Marker to verify that file was written with same byte order as that of the machine on which it is read.
+    boost::uint32_t byteOrderMarker;
+
+    //! Type of interpolator (value from SerializedInterpolatorType enum).
+    boost::uint32_t interpolatorType;
+
+    //! Number of data blocks following the header.
+    boost::uint32_t numberOfDataBlocks;
+
+    //! Size (in bytes) of independent variables.
+    boost::uint32_t independentVariableSize;
+
+    //! Number of binary digits of mantissa of independent variables (zero if not a floating point type).
+    boost::uint32_t independentVariableDigits;
+
+    //! Size (in bytes) of the scalars of the dependent variables.
+    boost::uint32_t dependentScalarSize;
+
+    //! Number of binary digits of mantissa of the scalars of the dependent variables.
+    boost::uint32_t dependentScalarDigits;
+
+    //! Number of rows of dependent variables (1 for scalar dependent variables).
+    boost::int32_t dependentVariableRows;
+
+    //! Number of columns of dependent variables (1 for scalar dependent variables).
+    boost::int32_t dependentVariableColumns;
+
+    //! Lookup scheme used by interpolator (value from AvailableLookupScheme enum).
+    boost::int32_t lookupScheme;
+
+    //! Number of stages (Lagrange interpolators) or nodes (Hermite interpolators) of interpolator.
+    boost::int32_t numberOfStages;
+
+    //! Boundary handling of Lagrange interpolators (value from LagrangeInterpolatorBoundaryHandling enum).
+    boost::int32_t boundaryHandling;
+
+    //! Number of binary digits of mantissa of scalars in which the Lagrange interpolation weights are computed.
+    boost::int32_t weightScalarDigits;
+
+    //! Number of independent variables of interpolator.
+    boost::int32_t numberOfDimensions;
+
+    //! Reserved for future use (zero).
+    boost::int32_t reserved;
+
+    //! Total size of file (in bytes).
+    boost::uint64_t fileSize;
+};
+
+//! Header of data block in binary interpolator file.
+struct SerializedDataBlockHeader
+{
+    //! Number of elements in data block.
+    boost::uint64_t numberOfElements;
+
+    //! Size (in bytes) of single element in data block.
+    boost::uint64_t elementSize;
+};
+
+//! Traits of (in)dependent variable types that can be written to a binary interpolator file.
+/*!
+ *  Traits of (in)dependent variable types that can be written to a binary interpolator file, for scalar types. The
+ *  variables are written as their raw memory, so that only scalar types and fixed-size Eigen matrices are supported.
+ */
+template< typename VariableType >
+struct SerializedVariableTraits
+{
+    //! Type of scalars of which variable consists.
+    typedef VariableType ScalarType;
+
+    //! Number of rows and columns of variable (enum, so that they can be bound to references without definition).
+    enum
+    {
+        numberOfRows = 1,
+        numberOfColumns = 1
+    };
+
+    //! Boolean denoting whether the variable is an Eigen matrix.
+    static const bool isMatrix = false;
+};
+
+//! Traits of (in)dependent variable types that can be written to a binary interpolator file, for Eigen matrices.
+template< typename MatrixScalarType, int Rows, int Columns, int Options, int MaximumRows, int MaximumColumns >
+struct SerializedVariableTraits< Eigen::Matrix< MatrixScalarType, Rows, Columns, Options, MaximumRows,
+        MaximumColumns > >
+{
+    BOOST_STATIC_ASSERT_MSG( Rows > 0 && Columns > 0,
+                             "Only fixed-size matrices can be written to binary interpolator files" );
+
+    //! Type of scalars of which variable consists.
+    typedef MatrixScalarType ScalarType;
+
+    //! Number of rows and columns of variable (enum, so that they can be bound to references without definition).
+    enum
+    {
+        numberOfRows = Rows,
+        numberOfColumns = Columns
+    };
+
+    //! Boolean denoting whether the variable is an Eigen matrix.
+    static const bool isMatrix = true;
+};
+
+//! Function to retrieve the number of binary digits of the mantissa of a scalar type.
+/*!
+ *  Function to retrieve the number of binary digits of the mantissa of a scalar type, used (together with its size)
+ *  to identify the scalar types in a binary interpolator file.
+ *  \return Number of binary digits of the mantissa of the scalar type (zero if not a floating point type).
+ */
+template< typename ScalarType >
+boost::uint32_t getSerializedScalarDigits( )
+{
+    return std::numeric_limits< ScalarType >::is_specialized ?
+                static_cast< boost::uint32_t >( std::numeric_limits< ScalarType >::digits ) : 0;
+}
+
+//! Function to create a string identifying the (in)dependent variable types of an interpolator.
+/*!
+ *  Function to create a string identifying the (in)dependent variable types of an interpolator, used to distinguish
+ *  cached interpolators with different variable types but identical settings.
+ *  \return String identifying the (in)dependent variable types of an interpolator.
+ */
+template< typename IndependentVariableType, typename DependentVariableType >
+std::string getSerializedVariableTypesKey( )
+{
+    typedef SerializedVariableTraits< DependentVariableType > DependentTraits;
+    return "independent=" + boost::lexical_cast< std::string >( sizeof( IndependentVariableType ) ) + "/" +
+            boost::lexical_cast< std::string >( getSerializedScalarDigits< IndependentVariableType >( ) ) +
+            ";dependent=" + boost::lexical_cast< std::string >(
+                sizeof( typename DependentTraits::ScalarType ) ) + "/" +
+            boost::lexical_cast< std::string >(
+                getSerializedScalarDigits< typename DependentTraits::ScalarType >( ) ) + "/" +
+            boost::lexical_cast< std::string >( DependentTraits::numberOfRows ) + "x" +
+            boost::lexical_cast< std::string >( DependentTraits::numberOfColumns ) + ";";
+}
+
+//! Class to write a binary interpolator file.
+/*!
+ *  Class to write a binary interpolator file, in the format defined by SerializedInterpolatorFileHeader. The data are
+ *  written to a temporary file with a unique name, which is renamed to the requested file name when the writer is
+ *  closed, so that (other processes) reading the file concurrently never see an incomplete file, and several writers
+ *  of the same file do not interfere. If the writer is destroyed without
+ *  being closed (e.g. due to an exception), the temporary file is removed.
+ */
+class SerializedInterpolatorFileWriter
+{
+public:
+
+    //! Constructor, opens the (temporary) file, and writes the settings key.
+    /*!
+     *  Constructor, opens the (temporary) file, and writes the settings key.
+     *  \param fileName Name of binary interpolator file that is to be written.
+     *  \param interpolatorType Type of interpolator that is written.
+     *  \param settingsKey Settings key with which the interpolator is written (see getCachedOneDimensionalInterpolator).
+     */
+    SerializedInterpolatorFileWriter( const std::string& fileName,
+                                      const SerializedInterpolatorType interpolatorType,
+                                      const std::string& settingsKey );
+
+    //! Destructor, removes the temporary file if the writer was not closed.
+    ~SerializedInterpolatorFileWriter( );
+
+    //! Function to set the (in)dependent variable types in the file header.
+    template< typename IndependentVariableType, typename DependentVariableType >
+    void setVariableTypes( )
+    {
+        typedef SerializedVariableTraits< DependentVariableType > DependentTraits;
+        fileHeader_.independentVariableSize = sizeof( IndependentVariableType );
+        fileHeader_.independentVariableDigits = getSerializedScalarDigits< IndependentVariableType >( );
+        fileHeader_.dependentScalarSize = sizeof( typename DependentTraits::ScalarType );
+        fileHeader_.dependentScalarDigits = getSerializedScalarDigits< typename DependentTraits::ScalarType >( );
+        fileHeader_.dependentVariableRows = DependentTraits::numberOfRows;
+        fileHeader_.dependentVariableColumns = DependentTraits::numberOfColumns;
+    }
+
+    //! Function to retrieve the file header, to set the interpolator-specific properties.
+    /*!
+     *  Function to retrieve the file header, to set the interpolator-specific properties. The header is written to
+     *  the file when the writer is closed.
+     *  \return File header.
+     */
+    SerializedInterpolatorFileHeader& getFileHeader( )
+    {
+        return fileHeader_;
+    }
+
+    //! Function to write a data block.
+    /*!
+     *  Function to write a data block, consisting of the raw memory of a number of elements.
+     *  \param data Pointer to first element of data block.
+     *  \param numberOfElements Number of elements in data block.
+     *  \param elementSize Size (in bytes) of single element.
+     */
+    void writeDataBlock( const void* data, const boost::uint64_t numberOfElements, const boost::uint64_t elementSize );
+
+    //! Function to write the contents of a vector as a data block.
+    /*!
+     *  Function to write the contents of a vector as a data block.
+     *  \param data Vector that is to be written.
+     */
+    template< typename ElementType >
+    void writeDataBlock( const std::vector< ElementType >& data )
+    {
+        writeDataBlock( data.size( ) > 0 ? &data[ 0 ] : NULL, data.size( ), sizeof( ElementType ) );
+    }
+
+    //! Function to write the file header, close the file, and rename it to the requested file name.
+    void close( );
+
+private:
+
+    //! Name of binary interpolator file that is to be written.
+    std::string fileName_;
+
+    //! Name of temporary file to which the data are written.
+    std::string temporaryFileName_;
+
+    //! Stream to which the data are written.
+    std::ofstream fileStream_;
+
+    //! Header of file.
+    SerializedInterpolatorFileHeader fileHeader_;
+
+    //! Boolean denoting whether the writer has been closed.
+    bool isClosed_;
+};
+
+//! Class to read a binary interpolator file.
+/*!
+ *  Class to read a binary interpolator file (as written by SerializedInterpolatorFileWriter), which is mapped read-only
+ *  into memory upon construction. The data blocks are retrieved in the order in which they were written.
+ */
+class SerializedInterpolatorFileReader
+{
+public:
+
+    //! Constructor, maps binary interpolator file into memory.
+    /*!
+     *  Constructor, maps binary interpolator file into memory, and checks its header and settings key.
+     *  \param fileName Name of binary interpolator file.
+     *  \param settingsKey Settings key with which the interpolator must have been written (exception is thrown if
+     *  the key in the file is different).
+     */
+    SerializedInterpolatorFileReader( const std::string& fileName, const std::string& settingsKey );
+
+    //! Function to retrieve the file header.
+    const SerializedInterpolatorFileHeader& getFileHeader( ) const
+    {
+        return *fileHeader_;
+    }
+
+    //! Function to check the (in)dependent variable types of the file against those of the requested interpolator.
+    template< typename IndependentVariableType, typename DependentVariableType >
+    void checkVariableTypes( ) const
+    {
+        typedef SerializedVariableTraits< DependentVariableType > DependentTraits;
+        if( fileHeader_->independentVariableSize != sizeof( IndependentVariableType ) ||
+                fileHeader_->independentVariableDigits != getSerializedScalarDigits< IndependentVariableType >( ) ||
+                fileHeader_->dependentScalarSize != sizeof( typename DependentTraits::ScalarType ) ||
+                fileHeader_->dependentScalarDigits !=
+                getSerializedScalarDigits< typename DependentTraits::ScalarType >( ) ||
+                fileHeader_->dependentVariableRows != DependentTraits::numberOfRows ||
+                fileHeader_->dependentVariableColumns != DependentTraits::numberOfColumns )
+        {
+            throw std::runtime_error( "Error, variable types in binary interpolator file " + fileName_ +
+                                      " are inconsistent with requested interpolator." );
+        }
+    }
+
+    //! Function to retrieve the next data block.
+    /*!
+     *  Function to retrieve the next data block, after checking its element size.
+     *  \param elementSize Expected size (in bytes) of single element.
+     *  \param numberOfElements Number of elements in data block (returned by reference).
+     *  \return Pointer to first element of data block in mapped file.
+     */
+    const void* getNextDataBlock( const boost::uint64_t elementSize, boost::uint64_t& numberOfElements );
+
+    //! Function to read the next data block into a vector.
+    /*!
+     *  Function to read the next data block into a vector.
+     *  \param data Vector into which data block is read (returned by reference).
+     */
+    template< typename ElementType >
+    void readDataBlock( std::vector< ElementType >& data )
+    {
+        boost::uint64_t numberOfElements;
+        const void* blockData = getNextDataBlock( sizeof( ElementType ), numberOfElements );
+        data.resize( numberOfElements );
+        if( numberOfElements > 0 )
+        {
+            std::memcpy( static_cast< void* >( &data[ 0 ] ), blockData, numberOfElements * sizeof( ElementType ) );
+        }
+    }
+
+private:
+
+    //! Name of binary interpolator file.
+    std::string fileName_;
+
+    //! Object representing the binary interpolator file.
+    boost::interprocess::file_mapping fileMapping_;
+
+    //! Region of memory into which the complete binary interpolator file is mapped.
+    boost::interprocess::mapped_region mappedRegion_;
+
+    //! Pointer to header of file in mapped region.
+    const SerializedInterpolatorFileHeader* fileHeader_;
+
+    //! Offset (in bytes) of the next data block from the start of the file.
+    boost::uint64_t nextDataBlockOffset_;
+
+    //! Number of data blocks that have been retrieved.
+    boost::uint32_t numberOfDataBlocksRead_;
+};
+
+//! Function to retrieve the lookup scheme type that is to be used to recreate an interpolator.
+/*!
+ *  Function to retrieve the lookup scheme type that is to be used to recreate an interpolator. The constant-time
+ *  lookup schemes are selected automatically from the data (see createLookupScheme), so that only the choice between
+ *  binary search and hunting algorithm needs to be stored.
+ *  \param lookUpScheme Lookup scheme used by interpolator.
+ *  \return Lookup scheme type that is to be used to recreate the interpolator.
+ */
+template< typename IndependentVariableType >
+AvailableLookupScheme getSerializedLookupScheme(
+        const boost::shared_ptr< LookUpScheme< IndependentVariableType > > lookUpScheme )
+{
+    return ( boost::dynamic_pointer_cast< BinarySearchLookupScheme< IndependentVariableType > >( lookUpScheme ) !=
+             NULL ) ? binarySearch : huntingAlgorithm;
+}
+
+//! Function to check whether an interpolator is a MatrixLagrangeInterpolator (for matrix dependent variables).
+template< typename IndependentVariableType, typename DependentVariableType >
+bool isMatrixLagrangeInterpolator(
+        const boost::shared_ptr< OneDimensionalInterpolator< IndependentVariableType, DependentVariableType > >
+        interpolator, boost::true_type )
+{
+    return ( boost::dynamic_pointer_cast< MatrixLagrangeInterpolator<
+             IndependentVariableType, DependentVariableType, double > >( interpolator ) != NULL ) ||
+            ( boost::dynamic_pointer_cast< MatrixLagrangeInterpolator<
+              IndependentVariableType, DependentVariableType, long double > >( interpolator ) != NULL );
+}
+
+//! Function to check whether an interpolator is a MatrixLagrangeInterpolator (for scalar dependent variables).
+template< typename IndependentVariableType, typename DependentVariableType >
+bool isMatrixLagrangeInterpolator(
+        const boost::shared_ptr< OneDimensionalInterpolator< IndependentVariableType, DependentVariableType > >,
+        boost::false_type )
+{
+    return false;
+}
+
+//! Function to retrieve the serialized type of a one-dimensional interpolator.
+/*!
+ *  Function to retrieve the serialized type of a one-dimensional interpolator, throws an exception if the interpolator
+ *  type cannot be written to a binary interpolator file.
+ *  \param interpolator Interpolator for which the type is to be determined.
+ *  \return Serialized type of interpolator.
+ */
+template< typename IndependentVariableType, typename DependentVariableType >
+SerializedInterpolatorType getSerializedInterpolatorType(
+        const boost::shared_ptr< OneDimensionalInterpolator< IndependentVariableType, DependentVariableType > >
+        interpolator )
+{
+    typedef SerializedVariableTraits< DependentVariableType > DependentTraits;
+    typedef typename DependentTraits::ScalarType DependentScalarType;
+
+    if( boost::dynamic_pointer_cast< LinearInterpolator< IndependentVariableType, DependentVariableType > >(
+                interpolator ) != NULL )
+    {
+        return serialized_linear_interpolator;
+    }
+    else if( boost::dynamic_pointer_cast< CubicSplineInterpolator< IndependentVariableType, DependentVariableType > >(
+                 interpolator ) != NULL )
+    {
+        return serialized_cubic_spline_interpolator;
+    }
+    else if( isMatrixLagrangeInterpolator(
+                 interpolator, boost::integral_constant< bool, DependentTraits::isMatrix >( ) ) )
+    {
+        return serialized_matrix_lagrange_interpolator;
+    }
+    else if( ( boost::dynamic_pointer_cast< LagrangeInterpolator<
+               IndependentVariableType, DependentVariableType, double > >( interpolator ) != NULL ) ||
+             ( boost::dynamic_pointer_cast< LagrangeInterpolator<
+               IndependentVariableType, DependentVariableType, long double > >( interpolator ) != NULL ) )
+    {
+        return serialized_lagrange_interpolator;
+    }
+    else if( boost::dynamic_pointer_cast< HermiteCubicSplineInterpolator<
+             IndependentVariableType, DependentVariableType > >( interpolator ) != NULL )
+    {
+        return serialized_hermite_cubic_spline_interpolator;
+    }
+    else if( boost::dynamic_pointer_cast< HermiteInterpolator< IndependentVariableType, DependentVariableType > >(
+                 interpolator ) != NULL )
+    {
+        return serialized_hermite_interpolator;
+    }
+    else if( boost::dynamic_pointer_cast< HermiteStateInterpolator< IndependentVariableType, DependentScalarType > >(
+                 interpolator ) != NULL )
+    {
+        return serialized_hermite_state_interpolator;
+    }
+    else if( boost::dynamic_pointer_cast< MultiOutputCubicSplineInterpolator<
+             IndependentVariableType, DependentScalarType, DependentTraits::numberOfRows > >( interpolator ) != NULL )
+    {
+        return serialized_multi_output_cubic_spline_interpolator;
+    }
+    else
+    {
+        throw std::runtime_error( "Error, interpolator type cannot be written to binary interpolator file." );
+    }
+}
+
+//! Function to write the denominators of a Lagrange interpolator to a binary interpolator file.
+/*!
+ *  Function to write the denominators of a Lagrange interpolator (and its number of stages and boundary handling) to
+ *  a binary interpolator file.
+ *  \param interpolator Lagrange interpolator that is to be written.
+ *  \param fileWriter Writer of binary interpolator file.
+ */
+template< typename IndependentVariableType, typename DependentVariableType, typename WeightScalarType >
+void writeLagrangeInterpolatorData(
+        const boost::shared_ptr< LagrangeInterpolator< IndependentVariableType, DependentVariableType,
+        WeightScalarType > > interpolator,
+        SerializedInterpolatorFileWriter& fileWriter )
+{
+    fileWriter.getFileHeader( ).numberOfStages = interpolator->getNumberOfStages( );
+    fileWriter.getFileHeader( ).boundaryHandling = interpolator->getBoundaryHandling( );
+    fileWriter.getFileHeader( ).weightScalarDigits = getSerializedScalarDigits< WeightScalarType >( );
+    fileWriter.writeDataBlock( interpolator->getDenominators( ) );
+}
+
+//! Function to write a one-dimensional interpolator to a binary file.
+/*!
+ *  Function to write a one-dimensional interpolator to a binary file (see SerializedInterpolatorFileHeader), from
+ *  which it can be recreated using readOneDimensionalInterpolatorFromFile. In addition to the data points, the
+ *  quantities that the interpolator pre-computes from the data points (e.g. denominators of Lagrange interpolators
+ *  and second derivatives of cubic splines) are written, so that these need not be recomputed when reading the file.
+ *  All interpolator types in this module are supported, for scalar or fixed-size Eigen matrix dependent variables.
+ *  \param interpolator Interpolator that is to be written.
+ *  \param fileName Name of binary interpolator file that is to be written.
+ *  \param settingsKey Settings key that is stored in the file, and must be provided when reading the file (optional).
+ */
+template< typename IndependentVariableType, typename DependentVariableType >
+void writeOneDimensionalInterpolatorToFile(
+        const boost::shared_ptr< OneDimensionalInterpolator< IndependentVariableType, DependentVariableType > >
+        interpolator,
+        const std::string& fileName,
+        const std::string& settingsKey = "" )
+{
+    typedef typename SerializedVariableTraits< DependentVariableType >::ScalarType DependentScalarType;
+
+    // Write properties and data points common to all interpolators.
+    const SerializedInterpolatorType interpolatorType = getSerializedInterpolatorType( interpolator );
+    SerializedInterpolatorFileWriter fileWriter( fileName, interpolatorType, settingsKey );
+    fileWriter.setVariableTypes< IndependentVariableType, DependentVariableType >( );
+    fileWriter.getFileHeader( ).lookupScheme = getSerializedLookupScheme( interpolator->getLookUpScheme( ) );
+    fileWriter.getFileHeader( ).numberOfDimensions = 1;
+    fileWriter.writeDataBlock( interpolator->getIndependentValues( ) );
+    fileWriter.writeDataBlock( interpolator->getDependentValues( ) );
+
+    // Write interpolator-specific properties and data.
+    switch( interpolatorType )
+    {
+    case serialized_cubic_spline_interpolator:
+        fileWriter.writeDataBlock( boost::dynamic_pointer_cast< CubicSplineInterpolator<
+                                   IndependentVariableType, DependentVariableType > >(
+                                       interpolator )->getSecondDerivatives( ) );
+        break;
+    case serialized_lagrange_interpolator:
+    case serialized_matrix_lagrange_interpolator:
+        if( boost::dynamic_pointer_cast< LagrangeInterpolator<
+                IndependentVariableType, DependentVariableType, double > >( interpolator ) != NULL )
+        {
+            writeLagrangeInterpolatorData(
+                        boost::dynamic_pointer_cast< LagrangeInterpolator<
+                        IndependentVariableType, DependentVariableType, double > >( interpolator ), fileWriter );
+        }
+        else
+        {
+            writeLagrangeInterpolatorData(
+                        boost::dynamic_pointer_cast< LagrangeInterpolator<
+                        IndependentVariableType, DependentVariableType, long double > >( interpolator ), fileWriter );
+        }
+        break;
+    case serialized_hermite_cubic_spline_interpolator:
+        fileWriter.writeDataBlock( boost::dynamic_pointer_cast< HermiteCubicSplineInterpolator<
+                                   IndependentVariableType, DependentVariableType > >(
+                                       interpolator )->getDerivativeValues( ) );
+        break;
+    case serialized_hermite_interpolator:
+    {
+        boost::shared_ptr< HermiteInterpolator< IndependentVariableType, DependentVariableType > >
+                hermiteInterpolator = boost::dynamic_pointer_cast<
+                HermiteInterpolator< IndependentVariableType, DependentVariableType > >( interpolator );
+        fileWriter.getFileHeader( ).numberOfStages = hermiteInterpolator->getNumberOfNodes( );
+        fileWriter.writeDataBlock( hermiteInterpolator->getFirstDerivativeValues( ) );
+        fileWriter.writeDataBlock( hermiteInterpolator->getSecondDerivativeValues( ) );
+        break;
+    }
+    case serialized_hermite_state_interpolator:
+    {
+        boost::shared_ptr< HermiteStateInterpolator< IndependentVariableType, DependentScalarType > >
+                hermiteInterpolator = boost::dynamic_pointer_cast<
+                HermiteStateInterpolator< IndependentVariableType, DependentScalarType > >( interpolator );
+        fileWriter.getFileHeader( ).numberOfStages = hermiteInterpolator->getNumberOfNodes( );
+        fileWriter.writeDataBlock( hermiteInterpolator->getAccelerations( ) );
+        break;
+    }
+    default:
+        break;
+    }
+
+    fileWriter.close( );
+}
+
+//! Function to create a data map from vectors of independent and dependent variables.
+/*!
+ *  Function to create a data map from vectors of independent and dependent variables, sorted in ascending order of
+ *  the independent variables (so that each entry is inserted at the end of the map in constant time).
+ *  \param independentValues Vector of independent variables, sorted in ascending order.
+ *  \param dependentValues Vector of dependent variables.
+ *  \return Map with independent variables as keys and dependent variables as values.
+ */
+template< typename IndependentVariableType, typename DependentVariableType >
+std::map< IndependentVariableType, DependentVariableType > createSortedDataMap(
+        const std::vector< IndependentVariableType >& independentValues,
+        const std::vector< DependentVariableType >& dependentValues )
+{
+    std::map< IndependentVariableType, DependentVariableType > dataMap;
+    for( unsigned int i = 0; i < independentValues.size( ) && i < dependentValues.size( ); i++ )
+    {
+        dataMap.insert( dataMap.end( ), std::make_pair( independentValues[ i ], dependentValues[ i ] ) );
+    }
+    return dataMap;
+}
+
+//! Function to recreate a Lagrange interpolator from the data read from a binary interpolator file.
+/*!
+ *  Function to recreate a (matrix) Lagrange interpolator from the data read from a binary interpolator file, including
+ *  its pre-computed denominators.
+ *  \param fileReader Reader of binary interpolator file, positioned at the block of denominators.
+ *  \param independentValues Independent variables read from file.
+ *  \param dependentValues Dependent variables read from file.
+ *  \param lookupScheme Lookup scheme that is to be used.
+ *  \param useMatrixInterpolator Boolean denoting whether a MatrixLagrangeInterpolator is to be created.
+ *  \return Recreated Lagrange interpolator.
+ */
+template< typename IndependentVariableType, typename DependentVariableType, typename WeightScalarType >
+boost::shared_ptr< OneDimensionalInterpolator< IndependentVariableType, DependentVariableType > >
+createSerializedLagrangeInterpolator(
+        SerializedInterpolatorFileReader& fileReader,
+        const std::vector< IndependentVariableType >& independentValues,
+        const std::vector< DependentVariableType >& dependentValues,
+        const AvailableLookupScheme lookupScheme,
+        boost::true_type useMatrixInterpolator )
+{
+    std::vector< WeightScalarType > denominators;
+    fileReader.readDataBlock( denominators );
+    return boost::make_shared< MatrixLagrangeInterpolator<
+            IndependentVariableType, DependentVariableType, WeightScalarType > >(
+                independentValues, dependentValues, fileReader.getFileHeader( ).numberOfStages, denominators,
+                lookupScheme, static_cast< LagrangeInterpolatorBoundaryHandling >(
+                    fileReader.getFileHeader( ).boundaryHandling ) );
+}
+
+//! Function to recreate a Lagrange interpolator from the data read from a binary interpolator file.
+/*!
+ *  Function to recreate a Lagrange interpolator from the data read from a binary interpolator file, including its
+ *  pre-computed denominators (see overload for MatrixLagrangeInterpolator).
+ */
+template< typename IndependentVariableType, typename DependentVariableType, typename WeightScalarType >
+boost::shared_ptr< OneDimensionalInterpolator< IndependentVariableType, DependentVariableType > >
+createSerializedLagrangeInterpolator(
+        SerializedInterpolatorFileReader& fileReader,
+        const std::vector< IndependentVariableType >& independentValues,
+        const std::vector< DependentVariableType >& dependentValues,
+        const AvailableLookupScheme lookupScheme,
+        boost::false_type useMatrixInterpolator )
+{
+    std::vector< WeightScalarType > denominators;
+    fileReader.readDataBlock( denominators );
+    return boost::make_shared< LagrangeInterpolator<
+            IndependentVariableType, DependentVariableType, WeightScalarType > >(
+                independentValues, dependentValues, fileReader.getFileHeader( ).numberOfStages, denominators,
+                lookupScheme, static_cast< LagrangeInterpolatorBoundaryHandling >(
+                    fileReader.getFileHeader( ).boundaryHandling ) );
+}
+
+//! Function to recreate a Hermite state interpolator from the data read from a binary interpolator file.
+/*!
+ *  Function to recreate a Hermite state interpolator from the data read from a binary interpolator file.
+ *  \param fileReader Reader of binary interpolator file, positioned at the block of accelerations.
+ *  \param independentValues Independent variables (times) read from file.
+ *  \param dependentValues Dependent variables (states) read from file.
+ *  \param lookupScheme Lookup scheme that is to be used.
+ *  \param isStateInterpolator Boolean denoting whether the dependent variables are Cartesian states.
+ *  \return Recreated Hermite state interpolator.
+ */
+template< typename IndependentVariableType, typename DependentVariableType >
+boost::shared_ptr< OneDimensionalInterpolator< IndependentVariableType, DependentVariableType > >
+createSerializedHermiteStateInterpolator(
+        SerializedInterpolatorFileReader& fileReader,
+        const std::vector< IndependentVariableType >& independentValues,
+        const std::vector< DependentVariableType >& dependentValues,
+        const AvailableLookupScheme lookupScheme,
+        boost::true_type isStateInterpolator )
+{
+    typedef typename SerializedVariableTraits< DependentVariableType >::ScalarType StateScalarType;
+
+    std::vector< Eigen::Matrix< StateScalarType, 3, 1 > > accelerations;
+    fileReader.readDataBlock( accelerations );
+    return boost::make_shared< HermiteStateInterpolator< IndependentVariableType, StateScalarType > >(
+                createSortedDataMap( independentValues, dependentValues ),
+                fileReader.getFileHeader( ).numberOfStages, accelerations, lookupScheme );
+}
+
+//! Function to recreate a Hermite state interpolator from the data read from a binary interpolator file.
+/*!
+ *  Function to recreate a Hermite state interpolator from the data read from a binary interpolator file, for dependent
+ *  variables that are not Cartesian states (throws exception).
+ */
+template< typename IndependentVariableType, typename DependentVariableType >
+boost::shared_ptr< OneDimensionalInterpolator< IndependentVariableType, DependentVariableType > >
+createSerializedHermiteStateInterpolator(
+        SerializedInterpolatorFileReader&,
+        const std::vector< IndependentVariableType >&,
+        const std::vector< DependentVariableType >&,
+        const AvailableLookupScheme,
+        boost::false_type isStateInterpolator )
+{
+    throw std::runtime_error( "Error, Hermite state interpolator in binary interpolator file is incompatible with "
+                              "requested dependent variable type." );
+}
+
+//! Function to recreate a multi-output cubic spline interpolator from the data read from a binary interpolator file.
+/*!
+ *  Function to recreate a multi-output cubic spline interpolator from the data read from a binary interpolator file.
+ *  \param independentValues Independent variables read from file.
+ *  \param dependentValues Dependent variables read from file.
+ *  \param lookupScheme Lookup scheme that is to be used.
+ *  \param isVectorInterpolator Boolean denoting whether the dependent variables are Eigen vectors.
+ *  \return Recreated multi-output cubic spline interpolator.
+ */
+template< typename IndependentVariableType, typename DependentVariableType >
+boost::shared_ptr< OneDimensionalInterpolator< IndependentVariableType, DependentVariableType > >
+createSerializedMultiOutputCubicSplineInterpolator(
+        const std::vector< IndependentVariableType >& independentValues,
+        const std::vector< DependentVariableType >& dependentValues,
+        const AvailableLookupScheme lookupScheme,
+        boost::true_type isVectorInterpolator )
+{
+    typedef SerializedVariableTraits< DependentVariableType > DependentTraits;
+    return boost::make_shared< MultiOutputCubicSplineInterpolator<
+            IndependentVariableType, typename DependentTraits::ScalarType, DependentTraits::numberOfRows > >(
+                createSortedDataMap( independentValues, dependentValues ), lookupScheme );
+}
+
+//! Function to recreate a multi-output cubic spline interpolator from the data read from a binary interpolator file.
+/*!
+ *  Function to recreate a multi-output cubic spline interpolator from the data read from a binary interpolator file,
+ *  for dependent variables that are not Eigen vectors (throws exception).
+ */
+template< typename IndependentVariableType, typename DependentVariableType >
+boost::shared_ptr< OneDimensionalInterpolator< IndependentVariableType, DependentVariableType > >
+createSerializedMultiOutputCubicSplineInterpolator(
+        const std::vector< IndependentVariableType >&,
+        const std::vector< DependentVariableType >&,
+        const AvailableLookupScheme,
+        boost::false_type isVectorInterpolator )
+{
+    throw std::runtime_error( "Error, multi-output cubic spline interpolator in binary interpolator file is "
+                              "incompatible with requested dependent variable type." );
+}
+
+//! Function to read a one-dimensional interpolator from a binary file.
+/*!
+ *  Function to read a one-dimensional interpolator from a binary file, as written by
+ *  writeOneDimensionalInterpolatorToFile. The interpolator is recreated with the same type and settings as the
+ *  interpolator that was written, using the pre-computed quantities in the file where applicable, so that it provides
+ *  identical results. An exception is thrown if the file is inconsistent, or if its variable types or settings key do
+ *  not match the requested ones.
+ *  \param fileName Name of binary interpolator file.
+ *  \param settingsKey Settings key with which the file must have been written (optional).
+ *  \return Interpolator read from file.
+ */
+template< typename IndependentVariableType, typename DependentVariableType >
+boost::shared_ptr< OneDimensionalInterpolator< IndependentVariableType, DependentVariableType > >
+readOneDimensionalInterpolatorFromFile(
+        const std::string& fileName,
+        const std::string& settingsKey = "" )
+{
+    typedef SerializedVariableTraits< DependentVariableType > DependentTraits;
+    typedef typename DependentTraits::ScalarType DependentScalarType;
+
+    // Open file, check its consistency, and read data points.
+    SerializedInterpolatorFileReader fileReader( fileName, settingsKey );
+    fileReader.checkVariableTypes< IndependentVariableType, DependentVariableType >( );
+    const SerializedInterpolatorFileHeader& fileHeader = fileReader.getFileHeader( );
+    if( fileHeader.numberOfDimensions != 1 )
+    {
+        throw std::runtime_error( "Error, binary interpolator file " + fileName +
+                                  " does not contain a one-dimensional interpolator." );
+    }
+    const AvailableLookupScheme lookupScheme = static_cast< AvailableLookupScheme >( fileHeader.lookupScheme );
+
+    std::vector< IndependentVariableType > independentValues;
+    fileReader.readDataBlock( independentValues );
+    std::vector< DependentVariableType > dependentValues;
+    fileReader.readDataBlock( dependentValues );
+
+    // Recreate interpolator of requested type.
+    boost::shared_ptr< OneDimensionalInterpolator< IndependentVariableType, DependentVariableType > > interpolator;
+    switch( fileHeader.interpolatorType )
+    {
+    case serialized_linear_interpolator:
+        interpolator = boost::make_shared< LinearInterpolator< IndependentVariableType, DependentVariableType > >(
+                    independentValues, dependentValues, lookupScheme );
+        break;
+    case serialized_cubic_spline_interpolator:
+    {
+        std::vector< DependentVariableType > secondDerivatives;
+        fileReader.readDataBlock( secondDerivatives );
+        interpolator = boost::make_shared< CubicSplineInterpolator< IndependentVariableType, DependentVariableType > >(
+                    independentValues, dependentValues, secondDerivatives, lookupScheme );
+        break;
+    }
+    case serialized_lagrange_interpolator:
+    case serialized_matrix_lagrange_interpolator:
+    {
+        if( fileHeader.interpolatorType == serialized_matrix_lagrange_interpolator && !DependentTraits::isMatrix )
+        {
+            throw std::runtime_error( "Error, matrix Lagrange interpolator in binary interpolator file " + fileName +
+                                      " is incompatible with requested dependent variable type." );
+        }
+        const bool useMatrixInterpolator = ( fileHeader.interpolatorType == serialized_matrix_lagrange_interpolator );
+
+        if( fileHeader.weightScalarDigits == static_cast< boost::int32_t >( getSerializedScalarDigits< double >( ) ) )
+        {
+            interpolator = useMatrixInterpolator ?
+                        createSerializedLagrangeInterpolator< IndependentVariableType, DependentVariableType, double >(
+                            fileReader, independentValues, dependentValues, lookupScheme,
+                            boost::integral_constant< bool, DependentTraits::isMatrix >( ) ) :
+                        createSerializedLagrangeInterpolator< IndependentVariableType, DependentVariableType, double >(
+                            fileReader, independentValues, dependentValues, lookupScheme, boost::false_type( ) );
+        }
+        else
+        {
+            interpolator = useMatrixInterpolator ?
+                        createSerializedLagrangeInterpolator<
+                        IndependentVariableType, DependentVariableType, long double >(
+                            fileReader, independentValues, dependentValues, lookupScheme,
+                            boost::integral_constant< bool, DependentTraits::isMatrix >( ) ) :
+                        createSerializedLagrangeInterpolator<
+                        IndependentVariableType, DependentVariableType, long double >(
+                            fileReader, independentValues, dependentValues, lookupScheme, boost::false_type( ) );
+        }
+        break;
+    }
+    case serialized_hermite_cubic_spline_interpolator:
+    {
+        std::vector< DependentVariableType > derivativeValues;
+        fileReader.readDataBlock( derivativeValues );
+        interpolator = boost::make_shared< HermiteCubicSplineInterpolator<
+                IndependentVariableType, DependentVariableType > >(
+                    independentValues, dependentValues, derivativeValues, lookupScheme );
+        break;
+    }
+    case serialized_hermite_interpolator:
+    {
+        std::vector< DependentVariableType > firstDerivativeValues, secondDerivativeValues;
+        fileReader.readDataBlock( firstDerivativeValues );
+        fileReader.readDataBlock( secondDerivativeValues );
+        interpolator = boost::make_shared< HermiteInterpolator< IndependentVariableType, DependentVariableType > >(
+                    createSortedDataMap( independentValues, dependentValues ), firstDerivativeValues,
+                    fileHeader.numberOfStages, secondDerivativeValues, lookupScheme );
+        break;
+    }
+    case serialized_hermite_state_interpolator:
+        interpolator = createSerializedHermiteStateInterpolator(
+                    fileReader, independentValues, dependentValues, lookupScheme,
+                    boost::is_same< DependentVariableType, Eigen::Matrix< DependentScalarType, 6, 1 > >( ) );
+        break;
+    case serialized_multi_output_cubic_spline_interpolator:
+        interpolator = createSerializedMultiOutputCubicSplineInterpolator(
+                    independentValues, dependentValues, lookupScheme,
+                    boost::is_same< DependentVariableType,
+                    Eigen::Matrix< DependentScalarType, DependentTraits::numberOfRows, 1 > >( ) );
+        break;
+    default:
+        throw std::runtime_error( "Error, binary interpolator file " + fileName + " contains unknown interpolator type " +
+                                  boost::lexical_cast< std::string >( fileHeader.interpolatorType ) );
+    }
+
+    return interpolator;
+}
+
+//! Function to write a multi-linear interpolator to a binary file.
+/*!
+ *  Function to write a multi-linear interpolator to a binary file (see SerializedInterpolatorFileHeader), from which
+ *  it can be recreated using readMultiLinearInterpolatorFromFile. The independent variables of each dimension are
+ *  written as separate data blocks, followed by the dependent data in row-major (C) storage order.
+ *  \param interpolator Interpolator that is to be written.
+ *  \param fileName Name of binary interpolator file that is to be written.
+ *  \param settingsKey Settings key that is stored in the file, and must be provided when reading the file (optional).
+ */
+template< typename IndependentVariableType, typename DependentVariableType, int NumberOfDimensions >
+void writeMultiLinearInterpolatorToFile(
+        const boost::shared_ptr< MultiLinearInterpolator< IndependentVariableType, DependentVariableType,
+        NumberOfDimensions > > interpolator,
+        const std::string& fileName,
+        const std::string& settingsKey = "" )
+{
+    SerializedInterpolatorFileWriter fileWriter( fileName, serialized_multi_linear_interpolator, settingsKey );
+    fileWriter.setVariableTypes< IndependentVariableType, DependentVariableType >( );
+    fileWriter.getFileHeader( ).lookupScheme = getSerializedLookupScheme( interpolator->getLookUpSchemes( )[ 0 ] );
+    fileWriter.getFileHeader( ).numberOfDimensions = NumberOfDimensions;
+
+    // Write independent variables of each dimension.
+    const std::vector< std::vector< IndependentVariableType > >& independentValues =
+            interpolator->getIndependentValues( );
+    for( int i = 0; i < NumberOfDimensions; i++ )
+    {
+        fileWriter.writeDataBlock( independentValues[ i ] );
+    }
+
+    // Write dependent data, in row-major storage order.
+    const boost::multi_array< DependentVariableType, NumberOfDimensions >& dependentData =
+            interpolator->getDependentData( );
+    if( dependentData.storage_order( ) == boost::c_storage_order( ) )
+    {
+        fileWriter.writeDataBlock( dependentData.data( ), dependentData.num_elements( ),
+                                   sizeof( DependentVariableType ) );
+    }
+    else
+    {
+        boost::array< std::size_t, NumberOfDimensions > dataShape;
+        std::copy( dependentData.shape( ), dependentData.shape( ) + NumberOfDimensions, dataShape.begin( ) );
+        boost::multi_array< DependentVariableType, NumberOfDimensions > rowMajorDependentData( dataShape );
+        rowMajorDependentData = dependentData;
+        fileWriter.writeDataBlock( rowMajorDependentData.data( ), rowMajorDependentData.num_elements( ),
+                                   sizeof( DependentVariableType ) );
+    }
+
+    fileWriter.close( );
+}
+
+//! Function to read a multi-linear interpolator from a binary file.
+/*!
+ *  Function to read a multi-linear interpolator from a binary file, as written by writeMultiLinearInterpolatorToFile.
+ *  An exception is thrown if the file is inconsistent, or if its variable types, number of dimensions or settings key
+ *  do not match the requested ones.
+ *  \param fileName Name of binary interpolator file.
+ *  \param settingsKey Settings key with which the file must have been written (optional).
+ *  \return Interpolator read from file.
+ */
+template< typename IndependentVariableType, typename DependentVariableType, int NumberOfDimensions >
+boost::shared_ptr< MultiLinearInterpolator< IndependentVariableType, DependentVariableType, NumberOfDimensions > >
+readMultiLinearInterpolatorFromFile(
+        const std::string& fileName,
+        const std::string& settingsKey = "" )
+{
+    // Open file and check its consistency.
+    SerializedInterpolatorFileReader fileReader( fileName, settingsKey );
+    fileReader.checkVariableTypes< IndependentVariableType, DependentVariableType >( );
+    const SerializedInterpolatorFileHeader& fileHeader = fileReader.getFileHeader( );
+    if( fileHeader.interpolatorType != serialized_multi_linear_interpolator ||
+            fileHeader.numberOfDimensions != NumberOfDimensions )
+    {
+        throw std::runtime_error( "Error, binary interpolator file " + fileName + " does not contain a multi-linear "
+                                  "interpolator with " + boost::lexical_cast< std::string >( NumberOfDimensions ) +
+                                  " dimensions." );
+    }
+
+    // Read independent variables of each dimension.
+    std::vector< std::vector< IndependentVariableType > > independentValues( NumberOfDimensions );
+    boost::array< std::size_t, NumberOfDimensions > dataShape;
+    for( int i = 0; i < NumberOfDimensions; i++ )
+    {
+        fileReader.readDataBlock( independentValues[ i ] );
+        dataShape[ i ] = independentValues[ i ].size( );
+    }
+
+    // Read dependent data.
+    boost::multi_array< DependentVariableType, NumberOfDimensions > dependentData( dataShape );
+    boost::uint64_t numberOfElements;
+    const void* dependentDataBlock = fileReader.getNextDataBlock( sizeof( DependentVariableType ), numberOfElements );
+    if( numberOfElements != dependentData.num_elements( ) )
+    {
+        throw std::runtime_error( "Error, size of dependent data in binary interpolator file " + fileName +
+                                  " is inconsistent with independent variables." );
+    }
+    if( numberOfElements > 0 )
+    {
+        std::memcpy( static_cast< void* >( dependentData.data( ) ), dependentDataBlock,
+                     numberOfElements * sizeof( DependentVariableType ) );
+    }
+
+    return boost::make_shared< MultiLinearInterpolator<
+            IndependentVariableType, DependentVariableType, NumberOfDimensions > >(
+                independentValues, dependentData, static_cast< AvailableLookupScheme >( fileHeader.lookupScheme ) );
+}
+
+//! Function to compute the hash of a settings key.
+/*!
+ *  Function to compute the (64-bit FNV-1a) hash of a settings key, which is identical on all platforms and in all
+ *  program runs, so that it can be used to identify cached interpolator files.
+ *  \param settingsKey Settings key for which hash is to be computed.
+ *  \return Hash of settings key, as 16-character hexadecimal string.
+ */
+std::string computeSettingsKeyHash( const std::string& settingsKey );
+
+//! Function to create a settings key describing interpolator settings.
+/*!
+ *  Function to create a settings key describing interpolator settings (type, lookup scheme and type-specific
+ *  settings), to be used as part of the key of a cached interpolator.
+ *  \param interpolatorSettings Interpolator settings that are to be described.
+ *  \return Settings key describing interpolator settings.
+ */
+std::string getInterpolatorSettingsKey( const boost::shared_ptr< InterpolatorSettings > interpolatorSettings );
+
+//! Function to retrieve the name of the cache file of an interpolator.
+/*!
+ *  Function to retrieve the name of the cache file of an interpolator, which is identified by the hash of its settings
+ *  key.
+ *  \param cacheDirectory Directory in which cached interpolators are stored.
+ *  \param settingsKey Settings key of interpolator.
+ *  \return Name of cache file of interpolator.
+ */
+std::string getInterpolatorCacheFileName( const std::string& cacheDirectory, const std::string& settingsKey );
+
+//! Function to ensure that the directory in which cached interpolators are stored exists.
+/*!
+ *  Function to ensure that the directory in which cached interpolators are stored exists, creating it if necessary.
+ *  \param cacheDirectory Directory in which cached interpolators are stored.
+ */
+void createInterpolatorCacheDirectory( const std::string& cacheDirectory );
+
+//! Function to retrieve a one-dimensional interpolator from a cache directory, creating and caching it if necessary.
+/*!
+ *  Function to retrieve a one-dimensional interpolator from a cache directory. The settings key must uniquely
+ *  describe the data and settings from which the interpolator is created (e.g. the source, range and step size of the
+ *  data, combined with the output of getInterpolatorSettingsKey), and is extended with the (in)dependent variable
+ *  types. If a cache file for this key exists, and can be read, the interpolator is read from this file, which
+ *  requires neither the data points nor the pre-computed quantities of the interpolator to be recomputed. Otherwise,
+ *  the interpolator is created using the provided function, and written to the cache directory for subsequent use (a
+ *  warning is printed if writing fails, but the interpolator is still returned).
+ *  \param cacheDirectory Directory in which cached interpolators are stored (created if it does not exist).
+ *  \param settingsKey Settings key uniquely describing the interpolator.
+ *  \param createInterpolator Function creating the interpolator, called only if no valid cache file exists.
+ *  \return Interpolator read from cache, or newly created.
+ */
+template< typename IndependentVariableType, typename DependentVariableType >
+boost::shared_ptr< OneDimensionalInterpolator< IndependentVariableType, DependentVariableType > >
+getCachedOneDimensionalInterpolator(
+        const std::string& cacheDirectory,
+        const std::string& settingsKey,
+        const boost::function< boost::shared_ptr< OneDimensionalInterpolator<
+        IndependentVariableType, DependentVariableType > >( ) > createInterpolator )
+{
+    const std::string fullSettingsKey = settingsKey + ";" +
+            getSerializedVariableTypesKey< IndependentVariableType, DependentVariableType >( );
+    const std::string cacheFileName = getInterpolatorCacheFileName( cacheDirectory, fullSettingsKey );
+
+    // Read interpolator from cache, if possible.
+    std::ifstream cacheFileStream( cacheFileName.c_str( ) );
+    if( cacheFileStream.good( ) )
+    {
+        cacheFileStream.close( );
+        try
+        {
+            return readOneDimensionalInterpolatorFromFile< IndependentVariableType, DependentVariableType >(
+                        cacheFileName, fullSettingsKey );
+        }
+        catch( std::runtime_error& readError )
+        {
+            std::cerr << "Warning, cached interpolator could not be read, and is recreated: "
+                      << readError.what( ) << std::endl;
+        }
+    }
+
+    // Create interpolator, and write it to cache.
+    boost::shared_ptr< OneDimensionalInterpolator< IndependentVariableType, DependentVariableType > > interpolator =
+            createInterpolator( );
+    try
+    {
+        createInterpolatorCacheDirectory( cacheDirectory );
+        writeOneDimensionalInterpolatorToFile( interpolator, cacheFileName, fullSettingsKey );
+    }
+    catch( std::runtime_error& writeError )
+    {
+        std::cerr << "Warning, interpolator could not be written to cache: " << writeError.what( ) << std::endl;
+    }
+    return interpolator;
+}
+
+//! Function to retrieve a multi-linear interpolator from a cache directory, creating and caching it if necessary.
+/*!
+ *  Function to retrieve a multi-linear interpolator from a cache directory, creating and caching it if necessary (see
+ *  getCachedOneDimensionalInterpolator).
+ *  \param cacheDirectory Directory in which cached interpolators are stored (created if it does not exist).
+ *  \param settingsKey Settings key uniquely describing the interpolator.
+ *  \param createInterpolator Function creating the interpolator, called only if no valid cache file exists.
+ *  \return Interpolator read from cache, or newly created.
+ */
+template< typename IndependentVariableType, typename DependentVariableType, int NumberOfDimensions >
+boost::shared_ptr< MultiLinearInterpolator< IndependentVariableType, DependentVariableType, NumberOfDimensions > >
+getCachedMultiLinearInterpolator(
+        const std::string& cacheDirectory,
+        const std::string& settingsKey,
+        const boost::function< boost::shared_ptr< MultiLinearInterpolator<
+        IndependentVariableType, DependentVariableType, NumberOfDimensions > >( ) > createInterpolator )
+{
+    const std::string fullSettingsKey = settingsKey + ";" +
+            getSerializedVariableTypesKey< IndependentVariableType, DependentVariableType >( ) +
+            "dimensions=" + boost::lexical_cast< std::string >( NumberOfDimensions ) + ";";
+    const std::string cacheFileName = getInterpolatorCacheFileName( cacheDirectory, fullSettingsKey );
+
+    // Read interpolator from cache, if possible.
+    std::ifstream cacheFileStream( cacheFileName.c_str( ) );
+    if( cacheFileStream.good( ) )
+    {
+        cacheFileStream.close( );
+        try
+        {
+            return readMultiLinearInterpolatorFromFile<
+                    IndependentVariableType, DependentVariableType, NumberOfDimensions >(
+                        cacheFileName, fullSettingsKey );
+        }
+        catch( std::runtime_error& readError )
+        {
+            std::cerr << "Warning, cached interpolator could not be read, and is recreated: "
+                      << readError.what( ) << std::endl;
+        }
+    }
+
+    // Create interpolator, and write it to cache.
+    boost::shared_ptr< MultiLinearInterpolator< IndependentVariableType, DependentVariableType, NumberOfDimensions > >
+            interpolator = createInterpolator( );
+    try
+    {
+        createInterpolatorCacheDirectory( cacheDirectory );
+        writeMultiLinearInterpolatorToFile( interpolator, cacheFileName, fullSettingsKey );
+    }
+    catch( std::runtime_error& writeError )
+    {
+        std::cerr << "Warning, interpolator could not be written to cache: " << writeError.what( ) << std::endl;
+    }
+    return interpolator;
+}
+
+} // namespace interpolators
+
+} // namespace tudat
+
+#endif // TUDAT_INTERPOLATOR_SERIALIZATION_H
@@ -106,49 +106,67 @@ public:
             lagrange_cubic_spline_boundary_interpolation ):
         numberOfStages_( numberOfStages ), boundaryHandling_( boundaryHandling )
     {
-        if( numberOfStages_ % 2 != 0 )
-        {
-            throw std::runtime_error(
-                        "Error: Lagrange interpolator currently only handles even orders." );
-        }
-
-        // Set data vectors.
+        // Set and check data vectors.
         independentValues_ = independentVariables;
         dependentValues_ = dependentVariables;
-        numberOfIndependentValues_ = static_cast< int >( independentValues_.size( ) );
+        checkAndInitializeDataVectors( );
 
-        // Verify that the initialization variables are not empty.
-        if ( numberOfIndependentValues_ == 0 || dependentValues_.size( ) == 0 )
-        {
-            throw std::runtime_error(
-                "Error: Vectors used in the Lagrange interpolator initialization are empty." );
-        }
+        // Create lookup scheme from independent variable values.
+        this->makeLookupScheme( selectedLookupScheme );
 
-        // Check consistency of input data.
-        if( static_cast< int >( dependentValues_.size( ) ) != numberOfIndependentValues_ )
+        // Calculate denominators for each interval, to prevent recalculations dueint each
+        // interpolation call.
+        initializeDenominators( );
+        initializeBoundaryInterpolators( selectedLookupScheme );
+    }
+
+    //! Constructor from vectors of independent/dependent data and pre-computed denominators.
+    /*!
+     *  This constructor initializes the interpolator from two vectors containing the independent
+     *  variables and dependent variables, and the denominators of the interpolating polynomials
+     *  that were previously computed for these data (see getDenominators), e.g. when reading the
+     *  interpolator from a file.
+     *  \param independentVariables Vector of values of independent variables that are used, must be
+     *  sorted in ascending order.
+     *  \param dependentVariables Vector of values of dependent variables that are used.
+     *  \param numberOfStages Number of data points that are used to calculate the interpolating
+     *  polynomial (must be even).
+     *  \param denominators Pre-computed denominators of the interpolating polynomials.
+     *  \param selectedLookupScheme Identifier of lookupscheme from enum. This algorithm is used
+     *  to find the nearest lower data point in the independent variables when requesting
+     *  interpolation.
+     *  \param boundaryHandling Method to be used for handling boundaries of the interpolation domain.
+     */
+    LagrangeInterpolator( const std::vector< IndependentVariableType >& independentVariables,
+                          const std::vector< DependentVariableType >& dependentVariables,
+                          const int numberOfStages,
+                          const std::vector< ScalarType >& denominators,
+                          const AvailableLookupScheme selectedLookupScheme = huntingAlgorithm,
+                          const LagrangeInterpolatorBoundaryHandling boundaryHandling =
+            lagrange_cubic_spline_boundary_interpolation ):
+        denominators_( denominators ), numberOfStages_( numberOfStages ),
+        boundaryHandling_( boundaryHandling )
+    {
+        // Set and check data vectors.
+        independentValues_ = independentVariables;
+        dependentValues_ = dependentVariables;
+        checkAndInitializeDataVectors( );
+
+        if( numberOfStages_ < 2 )
         {
             throw std::runtime_error(
-                "Error: indep. and dep. variables incompatible in Lagrange interpolator." );
+                        "Error, Lagrange interplator number of stages must be greater than 2." );
         }
-
-        // Define zero entry for dependent variable.
-        zeroEntry_ = dependentVariables[ 0 ] - dependentVariables[ 0 ];
-        if( zeroEntry_ != zeroEntry_ )
+        if( static_cast< int >( denominators_.size( ) ) !=
+                numberOfIndependentValues_ * numberOfStages_ )
         {
             throw std::runtime_error(
-                "Error: Lagrange interpolator cannot identify zero entry." );
+                        "Error: pre-computed denominators incompatible in Lagrange interpolator." );
         }
+        offsetEntries_ = numberOfStages_ / 2 - 1;
 
-        // Create lookup scheme from independent variable values.
         this->makeLookupScheme( selectedLookupScheme );
-
-        // Calculate denominators for each interval, to prevent recalculations dueint each
-        // interpolation call.
-        initializeDenominators( );
         initializeBoundaryInterpolators( selectedLookupScheme );
-
-        // Pre-allocate cache vector for computational efficiency.
-        independentVariableDifferenceCache.resize( 2 * offsetEntries_ + 2 );
     }
 
     //! Constructor from map of independent/dependent data.
@@ -211,8 +229,6 @@ public:
         //interpolation call.
         initializeDenominators( );
         initializeBoundaryInterpolators( selectedLookupScheme );
-
-        independentVariableDifferenceCache.resize( 2 * offsetEntries_ + 2 );
     }
 
     //! Destructor.
@@ -231,10 +247,12 @@ public:
      *  a cubic spline with natural boundary conditions is used.
      *  \param targetIndependentVariableValue Value of independent variable at which interpolation
      *  is to take place.
+     *  \param cursor Cursor storing the state of the sequence of lookups (modified by function).
      *  \return Interpolated value of dependent variable.
      */
     DependentVariableType interpolate(
-            const IndependentVariableType targetIndependentVariableValue )
+            const IndependentVariableType targetIndependentVariableValue,
+            LookUpSchemeCursor& cursor ) const
     {
         using std::pow;
 
@@ -244,7 +262,7 @@ public:
 
         // Find interpolation interval
         int lowerEntry = lookUpScheme_->findNearestLowerNeighbour(
-                    targetIndependentVariableValue );
+                    targetIndependentVariableValue, cursor );
 
         // Check if requested interval is inside region in which centered lagrange interpolation
         // can be used.
@@ -295,28 +313,27 @@ public:
             }
             else
             {
-                // Set up repeated numerator and cache of independent variable values from which
-                // interpolant is created.
+                // Set up repeated numerator from differences w.r.t. independent variable values
+                // from which interpolant is created.
                 int j = 0;
                 for( int i = 0; i <= 2 * offsetEntries_ + 1; i++ )
                 {
                     j = i + lowerEntry - offsetEntries_;
-                    independentVariableDifferenceCache[ i ] =
-                            static_cast< ScalarType >(
+                    repeatedNumerator *= static_cast< ScalarType >(
                                 targetIndependentVariableValue - independentValues_[ j ] );
-
-                    repeatedNumerator *= independentVariableDifferenceCache[ i ];
-
                 }
 
-                // Evaluate interpolating polynomial at requested data point.
+                // Evaluate interpolating polynomial at requested data point (differences are
+                // recomputed, rather than cached in a member, so that the interpolator is not
+                // modified by this function).
                 for( int i = 0; i <=  2 *offsetEntries_ + 1; i++ )
                 {
                     j = i + lowerEntry - offsetEntries_;
                     interpolatedValue += dependentValues_[ j ]  *
                             ( repeatedNumerator /
-                              ( independentVariableDifferenceCache[ i ] *
-                                denominators[ lowerEntry ][ j - lowerEntry + offsetEntries_ ] ) );
+                              ( static_cast< ScalarType >(
+                                    targetIndependentVariableValue - independentValues_[ j ] ) *
+                                denominators_[ lowerEntry * numberOfStages_ + i ] ) );
                 }
             }
         }
@@ -324,10 +341,78 @@ public:
         return interpolatedValue;
     }
 
+    //! Function to return the number of stages of the interpolator.
+    /*!
+     *  Function to return the number of stages of the interpolator.
+     *  \return Number of data points that are used to calculate the interpolating polynomial.
+     */
+    int getNumberOfStages( )
+    {
+        return numberOfStages_;
+    }
+
+    //! Function to return the method used for handling boundaries of the interpolation domain.
+    /*!
+     *  Function to return the method used for handling boundaries of the interpolation domain.
+     *  \return Method used for handling boundaries of the interpolation domain.
+     */
+    LagrangeInterpolatorBoundaryHandling getBoundaryHandling( )
+    {
+        return boundaryHandling_;
+    }
+
+    //! Function to return the pre-computed denominators of the interpolating polynomials.
+    /*!
+     *  Function to return the pre-computed denominators of the interpolating polynomials, with
+     *  entry i * numberOfStages + j the denominator of data point j of the polynomial used in
+     *  interval i (zero for intervals in which the boundary interpolation is used).
+     *  \return Pre-computed denominators of the interpolating polynomials.
+     */
+    const std::vector< ScalarType >& getDenominators( )
+    {
+        return denominators_;
+    }
 
 protected:
 
-private:
+    //! Function to check the data vectors, and initialize the variables derived from them.
+    /*!
+     *  Function to check the number of stages and the (previously set) data vectors for
+     *  consistency, and to initialize the number of data points and the zero entry of the
+     *  dependent variables.
+     */
+    void checkAndInitializeDataVectors( )
+    {
+        if( numberOfStages_ % 2 != 0 )
+        {
+            throw std::runtime_error(
+                        "Error: Lagrange interpolator currently only handles even orders." );
+        }
+
+        numberOfIndependentValues_ = static_cast< int >( independentValues_.size( ) );
+
+        // Verify that the initialization variables are not empty.
+        if ( numberOfIndependentValues_ == 0 || dependentValues_.size( ) == 0 )
+        {
+            throw std::runtime_error(
+                "Error: Vectors used in the Lagrange interpolator initialization are empty." );
+        }
+
+        // Check consistency of input data.
+        if( static_cast< int >( dependentValues_.size( ) ) != numberOfIndependentValues_ )
+        {
+            throw std::runtime_error(
+                "Error: indep. and dep. variables incompatible in Lagrange interpolator." );
+        }
+
+        // Define zero entry for dependent variable.
+        zeroEntry_ = dependentValues_[ 0 ] - dependentValues_[ 0 ];
+        if( zeroEntry_ != zeroEntry_ )
+        {
+            throw std::runtime_error(
+                "Error: Lagrange interpolator cannot identify zero entry." );
+        }
+    }
 
     //! Function called at initialization which pre-computes the denominators of the
     //! interpolants at each interval.
@@ -352,27 +437,27 @@ private:
         // Determine offset from boundary of interpolation interval where interpolant is valid.
         offsetEntries_ = numberOfStages_ / 2 - 1;
 
-        // Iterate over all intervals and calculate denominators
+        // Iterate over all intervals in which the centered interpolant is used, and calculate
+        // denominators (stored contiguously, numberOfStages_ entries per interval).
         int currentIterationStart;
-        denominators.resize( numberOfIndependentValues_ );
-        for( int i = offsetEntries_; i <= numberOfIndependentValues_ - offsetEntries_; i++ )
+        denominators_.assign( numberOfIndependentValues_ * numberOfStages_,
+                              mathematical_constants::getFloatingInteger< ScalarType >( 0 ) );
+        for( int i = offsetEntries_; i < numberOfIndependentValues_ - offsetEntries_ - 1; i++ )
         {
             // Determine start index in independent variables for current polynomial
             currentIterationStart = i - offsetEntries_;
 
-            denominators[ i ].resize( 2 * offsetEntries_ + 2 );
-
             // Calculate all denominators for single interval.
             for( int j = 0; j <= 2 * offsetEntries_ + 1; j++ )
             {
-                denominators[ i ][ j ] =
-                        mathematical_constants::getFloatingInteger< ScalarType >( 1 );
+                ScalarType& currentDenominator = denominators_[ i * numberOfStages_ + j ];
+                currentDenominator = mathematical_constants::getFloatingInteger< ScalarType >( 1 );
 
                 for( int k = 0; k <= 2 * offsetEntries_ + 1; k++ )
                 {
                     if( k != j )
                     {
-                        denominators[ i ][ j ] *= static_cast< ScalarType >(
+                        currentDenominator *= static_cast< ScalarType >(
                                     independentValues_[ j + currentIterationStart ] -
                                     independentValues_[ k + currentIterationStart ] );
                     }
@@ -427,7 +512,11 @@ private:
     }
 
     //! Pre-computed denominators to be used in interpolation
-    std::vector< std::vector< ScalarType > > denominators;
+    /*!
+     *  Pre-computed denominators to be used in interpolation, with entry i * numberOfStages_ + j
+     *  the denominator of data point j of the polynomial used in interval i.
+     */
+    std::vector< ScalarType > denominators_;
 
     //! Zero entry for dependent variables
     /*!
@@ -450,8 +539,6 @@ private:
      */
     int offsetEntries_;
 
-    std::vector< ScalarType > independentVariableDifferenceCache;
-
     //! Interpolator to be used at beginning of domain.
     boost::shared_ptr< OneDimensionalInterpolator
     < IndependentVariableType, DependentVariableType > > beginInterpolator_;
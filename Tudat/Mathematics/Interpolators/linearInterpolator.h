@@ -95,7 +95,7 @@ public:
     independentValues_;
     using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::
     lookUpScheme_;
-    using Interpolator< IndependentVariableType, DependentVariableType >::interpolate;
+    using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::interpolate;
 
     //! Constructor from map of independent/dependent data.
     /*!
@@ -178,13 +178,15 @@ public:
      * Function interpolates dependent variable value at given independent variable value.
      * \param independentVariableValue Value of independent variable at which interpolation
      *          is to take place.
+     * \param cursor Cursor storing the state of the sequence of lookups (modified by function).
      * \return Interpolated value of dependent variable.
      */
-    DependentVariableType interpolate( const IndependentVariableType independentVariableValue )
+    DependentVariableType interpolate( const IndependentVariableType independentVariableValue,
+                                       LookUpSchemeCursor& cursor ) const
     {
         // Lookup nearest lower index.
         int newNearestLowerIndex = lookUpScheme_->findNearestLowerNeighbour(
-                    independentVariableValue );
+                    independentVariableValue, cursor );
 
         // Perform linear interpolation.
         DependentVariableType interpolatedValue = dependentValues_[ newNearestLowerIndex ] +
@@ -36,8 +36,14 @@
 #ifndef TUDAT_LOOK_UP_SCHEME_H
 #define TUDAT_LOOK_UP_SCHEME_H
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
+#include <boost/make_shared.hpp>
 #include <boost/shared_ptr.hpp>
 
 #include "Tudat/Mathematics/BasicMathematics/nearestNeighbourSearch.h"
@@ -54,13 +60,89 @@ namespace interpolators
 enum AvailableLookupScheme
 {
     huntingAlgorithm,
-    binarySearch
+    binarySearch,
+    uniformGridLookup,
+    piecewiseUniformGridLookup
 };
 
+//! Cursor storing the state of a sequence of lookups.
+/*!
+ * Cursor storing the state of a sequence of lookups, i.e. the result of the previous lookup, which
+ * is used by the hunting algorithm as initial guess. By storing this state outside of the lookup
+ * scheme (and interpolator), a single lookup scheme may be used concurrently by several threads,
+ * each with its own cursor. A cursor may be used with any lookup scheme; if its state is invalid
+ * for the lookup scheme it is used with (e.g. if it was last used for a larger table), it is
+ * ignored and reset.
+ */
+class LookUpSchemeCursor
+{
+public:
+
+    //! Constructor.
+    /*!
+     * Constructor, initializes the cursor to denote that no previous lookup has been performed.
+     */
+    LookUpSchemeCursor( ): previousNearestLowerIndex_( -1 ) { }
+
+    //! Function to reset the cursor.
+    /*!
+     * Function to reset the cursor, so that the next lookup does not use its previous result.
+     */
+    void reset( )
+    {
+        previousNearestLowerIndex_ = -1;
+    }
+
+    //! Nearest lower index found in the previous lookup (-1 if none).
+    int previousNearestLowerIndex_;
+};
+
+//! Function to generate a unique identifier for a lookup scheme or interpolator.
+/*!
+ * Function to generate a unique identifier for a lookup scheme or interpolator, by which its
+ * thread-local cursor is retrieved (see getThreadLocalLookUpSchemeCursor).
+ * \return Unique identifier (never zero).
+ */
+inline unsigned long long generateLookUpSchemeCursorOwnerIdentifier( )
+{
+    static std::atomic< unsigned long long > identifierCounter( 0 );
+    return ++identifierCounter;
+}
+
+//! Function to retrieve the thread-local cursor of a lookup scheme or interpolator.
+/*!
+ * Function to retrieve the thread-local cursor of a lookup scheme or interpolator, which is used
+ * for lookups for which no cursor is provided explicitly. The cursors are stored in a fixed-size
+ * cache for each thread, indexed by the identifier of their owner. If the entry for the owner is
+ * occupied by the cursor of another owner (which occurs only if a thread alternates between more
+ * lookup schemes than the size of the cache), a reset cursor is returned, which reduces only the
+ * efficiency of the next lookup.
+ * \param ownerIdentifier Identifier of lookup scheme or interpolator for which the cursor is to be
+ * retrieved (see generateLookUpSchemeCursorOwnerIdentifier).
+ * \return Cursor of the current thread for the given owner.
+ */
+inline LookUpSchemeCursor& getThreadLocalLookUpSchemeCursor( const unsigned long long ownerIdentifier )
+{
+    static const unsigned long long cacheSize = 128;
+    static thread_local std::pair< unsigned long long, LookUpSchemeCursor > cursorCache[ cacheSize ];
+
+    std::pair< unsigned long long, LookUpSchemeCursor >& cacheEntry =
+            cursorCache[ ownerIdentifier % cacheSize ];
+    if( cacheEntry.first != ownerIdentifier )
+    {
+        cacheEntry.first = ownerIdentifier;
+        cacheEntry.second.reset( );
+    }
+    return cacheEntry.second;
+}
+
 //! Look-up scheme class for nearest left neighbour search.
 /*!
  * Look-up scheme class for nearest left neighbour search,
- * allows for different types of look-up scheme with a single interface.
+ * allows for different types of look-up scheme with a single interface. The lookup schemes are
+ * not modified by a lookup: the state of a sequence of lookups is stored in a cursor, which is
+ * either provided explicitly, or retrieved from storage local to the calling thread. Therefore,
+ * a lookup scheme may be used concurrently by several threads.
  * \tparam IndependentVariableType Type of entries of vector in which lookup is to be performed.
  */
 template< typename IndependentVariableType >
@@ -75,7 +157,8 @@ public:
      * lookup procedure.
      */
     LookUpScheme( const std::vector< IndependentVariableType >& independentVariableValues )
-        : independentVariableValues_( independentVariableValues )
+        : independentVariableValues_( independentVariableValues ),
+          cursorOwnerIdentifier_( generateLookUpSchemeCursorOwnerIdentifier( ) )
     { }
 
     //! Destructor.
@@ -86,12 +169,38 @@ public:
 
     //! Find nearest left neighbour.
     /*!
-     * Function finds nearest left neighbour of given value in independentVariableValues_.
+     * Function finds nearest left neighbour of given value in independentVariableValues_, using
+     * the cursor of the calling thread for this lookup scheme.
      * \param valueToLookup Value of which nearest neaighbour is to be determined.
      * \return Index of entry in independentVariableValues_ vector which is nearest lower neighbour
      * to valueToLookup.
      */
-    virtual int findNearestLowerNeighbour( const IndependentVariableType valueToLookup ) = 0;
+    virtual int findNearestLowerNeighbour( const IndependentVariableType valueToLookup ) const
+    {
+        return findNearestLowerNeighbour( valueToLookup, getThreadLocalCursor( ) );
+    }
+
+    //! Find nearest left neighbour, using a given cursor.
+    /*!
+     * Function finds nearest left neighbour of given value in independentVariableValues_, using
+     * (and updating) the state of a sequence of lookups stored in the given cursor.
+     * \param valueToLookup Value of which nearest neaighbour is to be determined.
+     * \param cursor Cursor storing the state of the sequence of lookups (modified by function).
+     * \return Index of entry in independentVariableValues_ vector which is nearest lower neighbour
+     * to valueToLookup.
+     */
+    virtual int findNearestLowerNeighbour( const IndependentVariableType valueToLookup,
+                                           LookUpSchemeCursor& cursor ) const = 0;
+
+    //! Function to retrieve the cursor of the calling thread for this lookup scheme.
+    /*!
+     * Function to retrieve the cursor of the calling thread for this lookup scheme.
+     * \return Cursor of the calling thread for this lookup scheme.
+     */
+    LookUpSchemeCursor& getThreadLocalCursor( ) const
+    {
+        return getThreadLocalLookUpSchemeCursor( cursorOwnerIdentifier_ );
+    }
 
 protected:
 
@@ -100,11 +209,71 @@ protected:
      * Vector of independent variable values in which lookup is to be performed.
      */
     std::vector< IndependentVariableType > independentVariableValues_;
+
+    //! Identifier by which the thread-local cursors of this lookup scheme are retrieved.
+    /*!
+     * Identifier by which the thread-local cursors of this lookup scheme are retrieved.
+     */
+    unsigned long long cursorOwnerIdentifier_;
 };
 
+//! Function to find the nearest left neighbour using the previous result stored in a cursor.
+/*!
+ * Function to find the nearest left neighbour of a value in a sorted vector, using the result of
+ * the previous lookup stored in a cursor as initial guess for a hunting algorithm. If the cursor
+ * contains no (valid) previous result, a binary search is used. The cursor is updated with the
+ * new result.
+ * \tparam IndependentVariableType Type of entries of vector in which lookup is to be performed.
+ * \param independentVariableValues Vector, sorted in ascending order, in which lookup is to be
+ * performed.
+ * \param valueToLookup Value of which nearest neighbour is to be determined.
+ * \param cursor Cursor storing the state of the sequence of lookups (modified by function).
+ * \return Index of entry in independentVariableValues vector which is nearest lower neighbour to
+ * valueToLookup.
+ */
+template< typename IndependentVariableType >
+int findNearestLowerNeighbourUsingCursor(
+        const std::vector< IndependentVariableType >& independentVariableValues,
+        const IndependentVariableType valueToLookup,
+        LookUpSchemeCursor& cursor )
+{
+    int newNearestLowerIndex = 0;
+    const int previousNearestLowerIndex = cursor.previousNearestLowerIndex_;
+
+    // If no valid previous result is available, use binary search.
+    if( previousNearestLowerIndex < 0 ||
+            previousNearestLowerIndex > static_cast< int >( independentVariableValues.size( ) ) - 2 )
+    {
+        newNearestLowerIndex = basic_mathematics::computeNearestLeftNeighborUsingBinarySearch
+                < IndependentVariableType >( independentVariableValues, valueToLookup );
+    }
+
+    // If requested value is in same interval, return same value as previous time.
+    else if( basic_mathematics::isIndependentVariableInInterval< IndependentVariableType >
+             ( previousNearestLowerIndex, valueToLookup, independentVariableValues ) )
+    {
+        newNearestLowerIndex = previousNearestLowerIndex;
+    }
+
+    // Otherwise, perform hunting algorithm.
+    else
+    {
+        newNearestLowerIndex =
+                basic_mathematics::findNearestLeftNeighbourUsingHuntingAlgorithm<
+                IndependentVariableType >
+                ( valueToLookup, previousNearestLowerIndex, independentVariableValues );
+    }
+
+    // Set calculated value for use in next call.
+    cursor.previousNearestLowerIndex_ = newNearestLowerIndex;
+
+    return newNearestLowerIndex;
+}
+
 //! Look-up scheme class for nearest left neighbour search using hunting algorithm.
 /*!
- *  Look-up scheme class for nearest left neighbour search using hunting algorithm.
+ *  Look-up scheme class for nearest left neighbour search using hunting algorithm, with the
+ *  result of the previous lookup (stored in a cursor) as initial guess.
  *  \tparam IndependentVariableType Type of entries of vector in which lookup is to be performed.
  */
 template< typename IndependentVariableType >
@@ -113,18 +282,17 @@ class HuntingAlgorithmLookupScheme: public LookUpScheme< IndependentVariableType
 public:
 
     using LookUpScheme< IndependentVariableType >::independentVariableValues_;
+    using LookUpScheme< IndependentVariableType >::findNearestLowerNeighbour;
 
     //! Constructor, used to set data vector.
     /*!
-     *  Constructor, used to set data vector. Initializes guess from 'previous' request to 0.
+     *  Constructor, used to set data vector.
      * \param independentVariableValues vector of independent variable values in which to perform
      * lookup procedure.
      */
     HuntingAlgorithmLookupScheme( const std::vector< IndependentVariableType >&
                                   independentVariableValues )
-        : LookUpScheme< IndependentVariableType >( independentVariableValues ),
-          isFirstLookupDone( 0 ),
-          previousNearestLowerIndex_( 0 )
+        : LookUpScheme< IndependentVariableType >( independentVariableValues )
     { }
 
     //! Default destructor
@@ -133,74 +301,205 @@ public:
      */
     ~HuntingAlgorithmLookupScheme( ){ }
 
-    //! Find nearest left neighbour.
+    //! Find nearest left neighbour, using a given cursor.
     /*!
-     * Function finds nearest left neighbour of given value in ndependentVariableValues_. If this
-     * is first call of function, a binary search is used.
+     * Function finds nearest left neighbour of given value in independentVariableValues_. If
+     * the cursor contains no previous result, a binary search is used.
      * \param valueToLookup Value of which nearest neighbour is to be determined.
+     * \param cursor Cursor storing the state of the sequence of lookups (modified by function).
+     * \return Index of entry in independentVariableValues_ vector which is nearest lower neighbour
+     * to valueToLookup.
+     */
+    int findNearestLowerNeighbour( const IndependentVariableType valueToLookup,
+                                   LookUpSchemeCursor& cursor ) const
+    {
+        return findNearestLowerNeighbourUsingCursor( independentVariableValues_, valueToLookup, cursor );
+    }
+};
+
+//! Look-up scheme class for nearest left neighbour search using binary search algorithm.
+/*!
+ * Look-up scheme class for nearest left neighbour search using binary search algorithm. If a
+ * cursor is provided explicitly (denoting a sequence of related lookups, e.g. at sorted values),
+ * the hunting algorithm is used instead, with the result of the previous lookup as initial guess.
+ * \tparam IndependentVariableType Type of entries of vector in which lookup is to be performed.
+ */
+template< typename IndependentVariableType >
+class BinarySearchLookupScheme: public LookUpScheme< IndependentVariableType >
+{
+public:
+
+    using LookUpScheme< IndependentVariableType >::independentVariableValues_;
+
+    //! Constructor, used to set data vector.
+    /*!
+     * Constructor, used to set data vector.
+     * \param independentVariableValues vector of independent variable values in which to perform
+     * lookup procedure.
+     */
+    BinarySearchLookupScheme(
+            const std::vector< IndependentVariableType >& independentVariableValues )
+        : LookUpScheme< IndependentVariableType >( independentVariableValues )
+    { }
+
+    //! Default destructor
+    /*!
+     *  Default destructor
+     */
+    ~BinarySearchLookupScheme( ){ }
+
+    //! Find nearest left neighbour.
+    /*!
+     * Function finds nearest left neighbour of given value in independentVariableValues_.
+     * \param valueToLookup Value of which nearest neaighbour is to be determined.
+     * \return Index of entry in independentVariableValues_ vector which is nearest lower neighbour
+     * to valueToLookup.
+     */
+    int findNearestLowerNeighbour( const IndependentVariableType valueToLookup ) const
+    {
+        return basic_mathematics::computeNearestLeftNeighborUsingBinarySearch
+                < IndependentVariableType >( independentVariableValues_, valueToLookup );
+    }
+
+    //! Find nearest left neighbour, using a given cursor.
+    /*!
+     * Function finds nearest left neighbour of given value in independentVariableValues_, using
+     * the hunting algorithm with the previous result stored in the cursor as initial guess.
+     * \param valueToLookup Value of which nearest neaighbour is to be determined.
+     * \param cursor Cursor storing the state of the sequence of lookups (modified by function).
      * \return Index of entry in independentVariableValues_ vector which is nearest lower neighbour
      * to valueToLookup.
      */
-    int findNearestLowerNeighbour( const IndependentVariableType valueToLookup )
+    int findNearestLowerNeighbour( const IndependentVariableType valueToLookup,
+                                   LookUpSchemeCursor& cursor ) const
     {
-        // Initialize return value.
-        int newNearestLowerIndex = 0;
+        return findNearestLowerNeighbourUsingCursor( independentVariableValues_, valueToLookup, cursor );
+    }
+};
+
+//! Look-up scheme class for nearest left neighbour search in a uniformly spaced vector.
+/*!
+ * Look-up scheme class for nearest left neighbour search in a (nearly) uniformly spaced vector.
+ * The index of the nearest left neighbour is computed directly from the distance to the first
+ * entry, after which it is corrected (typically by at most one step) for the deviation of the
+ * entries from a perfectly uniform grid. The lookup therefore takes constant time, independently
+ * of the size of the vector and of the previously requested value.
+ * \tparam IndependentVariableType Type of entries of vector in which lookup is to be performed.
+ */
+template< typename IndependentVariableType >
+class UniformGridLookupScheme: public LookUpScheme< IndependentVariableType >
+{
+public:
 
-        // If this is first call of function, use binary search.
-        if ( !isFirstLookupDone )
+    using LookUpScheme< IndependentVariableType >::independentVariableValues_;
+
+    //! Constructor, used to set data vector.
+    /*!
+     * Constructor, used to set data vector, and compute the (mean) spacing of its entries.
+     * \param independentVariableValues vector of independent variable values in which to perform
+     * lookup procedure, sorted in ascending order.
+     */
+    UniformGridLookupScheme(
+            const std::vector< IndependentVariableType >& independentVariableValues )
+        : LookUpScheme< IndependentVariableType >( independentVariableValues )
+    {
+        if( independentVariableValues_.size( ) < 2 ||
+                !( independentVariableValues_.back( ) > independentVariableValues_.front( ) ) )
         {
-            newNearestLowerIndex = basic_mathematics::computeNearestLeftNeighborUsingBinarySearch
-                    < IndependentVariableType >( independentVariableValues_, valueToLookup );
-            isFirstLookupDone = 1;
+            throw std::runtime_error( "Error when creating uniform grid lookup scheme, at least two "
+                                      "ascending independent variable values are required." );
         }
 
-        else
+        maximumLowerIndex_ = static_cast< int >( independentVariableValues_.size( ) ) - 2;
+        inverseStepSize_ = static_cast< IndependentVariableType >( maximumLowerIndex_ + 1 ) /
+                ( independentVariableValues_.back( ) - independentVariableValues_.front( ) );
+    }
+
+    //! Default destructor
+    /*!
+     *  Default destructor
+     */
+    ~UniformGridLookupScheme( ){ }
+
+    //! Find nearest left neighbour.
+    /*!
+     * Function finds nearest left neighbour of given value in independentVariableValues_. Values
+     * outside the range of independentVariableValues_ are assigned to the first or last interval.
+     * \param valueToLookup Value of which nearest neighbour is to be determined.
+     * \return Index of entry in independentVariableValues_ vector which is nearest lower neighbour
+     * to valueToLookup.
+     */
+    int findNearestLowerNeighbour( const IndependentVariableType valueToLookup ) const
+    {
+        // Compute index on uniform grid, limited to valid range.
+        const IndependentVariableType scaledValue =
+                ( valueToLookup - independentVariableValues_.front( ) ) * inverseStepSize_;
+        int lowerIndex = 0;
+        if( scaledValue >= static_cast< IndependentVariableType >( maximumLowerIndex_ ) )
         {
-            // If requested value is in same interval, return same value as previous time.
-            if ( basic_mathematics::isIndependentVariableInInterval< IndependentVariableType >
-                 ( previousNearestLowerIndex_,  valueToLookup, independentVariableValues_ ) )
-            {
-                newNearestLowerIndex = previousNearestLowerIndex_;
-            }
+            lowerIndex = maximumLowerIndex_;
+        }
+        else if( scaledValue > static_cast< IndependentVariableType >( 0 ) )
+        {
+            lowerIndex = static_cast< int >( scaledValue );
+        }
 
-            // Otherwise, perform hunting algorithm.
-            else
-            {
-                newNearestLowerIndex =
-                        basic_mathematics::findNearestLeftNeighbourUsingHuntingAlgorithm<
-                        IndependentVariableType >
-                        (  valueToLookup, previousNearestLowerIndex_, independentVariableValues_ );
-            }
+        // Correct for deviations of grid from uniform spacing.
+        while( lowerIndex > 0 && valueToLookup < independentVariableValues_[ lowerIndex ] )
+        {
+            lowerIndex--;
+        }
+        while( lowerIndex < maximumLowerIndex_ &&
+               valueToLookup >= independentVariableValues_[ lowerIndex + 1 ] )
+        {
+            lowerIndex++;
         }
 
-        // Set calculated value for use in next call.
-        previousNearestLowerIndex_ = newNearestLowerIndex;
+        return lowerIndex;
+    }
 
-        return newNearestLowerIndex;
+    //! Find nearest left neighbour, using a given cursor.
+    /*!
+     * Function finds nearest left neighbour of given value in independentVariableValues_. Since
+     * the lookup takes constant time, the cursor is not used.
+     * \param valueToLookup Value of which nearest neighbour is to be determined.
+     * \param cursor Cursor storing the state of the sequence of lookups (unused).
+     * \return Index of entry in independentVariableValues_ vector which is nearest lower neighbour
+     * to valueToLookup.
+     */
+    int findNearestLowerNeighbour( const IndependentVariableType valueToLookup,
+                                   LookUpSchemeCursor& cursor ) const
+    {
+        return findNearestLowerNeighbour( valueToLookup );
     }
 
 private:
 
-    //! Boolean to denote whether a lookup has been done.
+    //! Inverse of mean spacing of independent variable values.
     /*!
-     * Boolean to denote whether a lookup has been done.
+     * Inverse of mean spacing of independent variable values.
      */
-    bool isFirstLookupDone;
+    IndependentVariableType inverseStepSize_;
 
-    //! Nearest left index during previous call.
+    //! Index of lower neighbour of last interval.
     /*!
-     * Nearest left index during previous call
+     * Index of lower neighbour of last interval (size of independentVariableValues_ minus 2).
      */
-    int previousNearestLowerIndex_;
+    int maximumLowerIndex_;
 };
 
-//! Look-up scheme class for nearest left neighbour search using binary search algorithm.
+//! Look-up scheme class for nearest left neighbour search in a piecewise uniformly spaced vector.
 /*!
- * Look-up scheme class for nearest left neighbour search using binary search algorithm.
+ * Look-up scheme class for nearest left neighbour search in a vector with entries that are
+ * nearly, or piecewise, uniformly spaced. The range of the entries is divided into a uniform grid
+ * of buckets (as many as there are intervals), and for each bucket the nearest left neighbour of
+ * its start is stored. A lookup computes the bucket of the requested value directly, after which
+ * the nearest left neighbour is found by a linear search from the start of the bucket. The number
+ * of steps in this search is limited by the ratio of the mean and smallest spacing of the entries.
  * \tparam IndependentVariableType Type of entries of vector in which lookup is to be performed.
  */
 template< typename IndependentVariableType >
-class BinarySearchLookupScheme: public LookUpScheme< IndependentVariableType >
+class PiecewiseUniformGridLookupScheme: public LookUpScheme< IndependentVariableType >
 {
 public:
 
@@ -208,35 +507,243 @@ public:
 
     //! Constructor, used to set data vector.
     /*!
-     * Constructor, used to set data vector.
+     * Constructor, used to set data vector, and compute the nearest left neighbours of the buckets.
      * \param independentVariableValues vector of independent variable values in which to perform
-     * lookup procedure.
+     * lookup procedure, sorted in ascending order.
      */
-    BinarySearchLookupScheme(
+    PiecewiseUniformGridLookupScheme(
             const std::vector< IndependentVariableType >& independentVariableValues )
         : LookUpScheme< IndependentVariableType >( independentVariableValues )
-    { }
+    {
+        if( independentVariableValues_.size( ) < 2 ||
+                !( independentVariableValues_.back( ) > independentVariableValues_.front( ) ) )
+        {
+            throw std::runtime_error( "Error when creating piecewise uniform grid lookup scheme, at "
+                                      "least two ascending independent variable values are required." );
+        }
+
+        maximumLowerIndex_ = static_cast< int >( independentVariableValues_.size( ) ) - 2;
+        const int numberOfBuckets = maximumLowerIndex_ + 1;
+        const IndependentVariableType bucketSize =
+                ( independentVariableValues_.back( ) - independentVariableValues_.front( ) ) /
+                static_cast< IndependentVariableType >( numberOfBuckets );
+        inverseBucketSize_ = static_cast< IndependentVariableType >( 1 ) / bucketSize;
+
+        // Find nearest left neighbour of start of each bucket.
+        bucketLowerIndices_.resize( numberOfBuckets );
+        int lowerIndex = 0;
+        for( int i = 0; i < numberOfBuckets; i++ )
+        {
+            const IndependentVariableType bucketStart = independentVariableValues_.front( ) +
+                    static_cast< IndependentVariableType >( i ) * bucketSize;
+            while( lowerIndex < maximumLowerIndex_ &&
+                   bucketStart >= independentVariableValues_[ lowerIndex + 1 ] )
+            {
+                lowerIndex++;
+            }
+            bucketLowerIndices_[ i ] = lowerIndex;
+        }
+    }
 
     //! Default destructor
     /*!
      *  Default destructor
      */
-    ~BinarySearchLookupScheme( ){ }
+    ~PiecewiseUniformGridLookupScheme( ){ }
 
     //! Find nearest left neighbour.
     /*!
-     * Function finds nearest left neighbour of given value in independentVariableValues_.
-     * \param valueToLookup Value of which nearest neaighbour is to be determined.
+     * Function finds nearest left neighbour of given value in independentVariableValues_. Values
+     * outside the range of independentVariableValues_ are assigned to the first or last interval.
+     * \param valueToLookup Value of which nearest neighbour is to be determined.
      * \return Index of entry in independentVariableValues_ vector which is nearest lower neighbour
      * to valueToLookup.
      */
-    int findNearestLowerNeighbour( const IndependentVariableType valueToLookup )
+    int findNearestLowerNeighbour( const IndependentVariableType valueToLookup ) const
     {
-        return basic_mathematics::computeNearestLeftNeighborUsingBinarySearch
-                < IndependentVariableType >( independentVariableValues_, valueToLookup );
+        // Compute bucket in which value lies, limited to valid range.
+        const IndependentVariableType scaledValue =
+                ( valueToLookup - independentVariableValues_.front( ) ) * inverseBucketSize_;
+        int lowerIndex = 0;
+        if( scaledValue >= static_cast< IndependentVariableType >( maximumLowerIndex_ ) )
+        {
+            lowerIndex = bucketLowerIndices_[ maximumLowerIndex_ ];
+        }
+        else if( scaledValue > static_cast< IndependentVariableType >( 0 ) )
+        {
+            lowerIndex = bucketLowerIndices_[ static_cast< int >( scaledValue ) ];
+        }
+
+        // Search nearest left neighbour from start of bucket (correcting for rounding errors in
+        // the bucket computation).
+        while( lowerIndex > 0 && valueToLookup < independentVariableValues_[ lowerIndex ] )
+        {
+            lowerIndex--;
+        }
+        while( lowerIndex < maximumLowerIndex_ &&
+               valueToLookup >= independentVariableValues_[ lowerIndex + 1 ] )
+        {
+            lowerIndex++;
+        }
+
+        return lowerIndex;
+    }
+
+    //! Find nearest left neighbour, using a given cursor.
+    /*!
+     * Function finds nearest left neighbour of given value in independentVariableValues_. Since
+     * the lookup takes constant time, the cursor is not used.
+     * \param valueToLookup Value of which nearest neighbour is to be determined.
+     * \param cursor Cursor storing the state of the sequence of lookups (unused).
+     * \return Index of entry in independentVariableValues_ vector which is nearest lower neighbour
+     * to valueToLookup.
+     */
+    int findNearestLowerNeighbour( const IndependentVariableType valueToLookup,
+                                   LookUpSchemeCursor& cursor ) const
+    {
+        return findNearestLowerNeighbour( valueToLookup );
     }
+
+private:
+
+    //! Inverse of size of buckets.
+    /*!
+     * Inverse of size of buckets.
+     */
+    IndependentVariableType inverseBucketSize_;
+
+    //! Index of lower neighbour of last interval.
+    /*!
+     * Index of lower neighbour of last interval (size of independentVariableValues_ minus 2).
+     */
+    int maximumLowerIndex_;
+
+    //! Nearest left neighbours of the start of each bucket.
+    /*!
+     * Nearest left neighbours of the start of each bucket.
+     */
+    std::vector< int > bucketLowerIndices_;
 };
 
+//! Function to determine the lookup scheme best suited to a vector of independent variables.
+/*!
+ * Function to determine the lookup scheme best suited to a vector of independent variables. If
+ * the entries are uniformly spaced (to within the given tolerance, relative to the mean spacing),
+ * a uniform grid lookup is returned. If the ratio of the largest and smallest spacing does not
+ * exceed the given maximum, a piecewise uniform grid lookup is returned. Otherwise, the selected
+ * scheme is returned. An explicitly selected uniform or piecewise uniform grid lookup is always
+ * retained.
+ * \param independentVariableValues Vector of independent variable values, sorted in ascending
+ * order.
+ * \param selectedScheme Type of look-up scheme that was selected.
+ * \param uniformSpacingTolerance Maximum deviation of entries from a uniform grid, relative to the
+ * mean spacing, for which the entries are considered uniformly spaced.
+ * \param maximumSpacingRatio Maximum ratio of largest and smallest spacing for which a piecewise
+ * uniform grid lookup is used.
+ * \return Type of look-up scheme that is to be used.
+ */
+template< typename IndependentVariableType >
+AvailableLookupScheme getBestSuitedLookupScheme(
+        const std::vector< IndependentVariableType >& independentVariableValues,
+        const AvailableLookupScheme selectedScheme,
+        const double uniformSpacingTolerance = 1.0E-3,
+        const double maximumSpacingRatio = 4.0 )
+{
+    if( selectedScheme == uniformGridLookup || selectedScheme == piecewiseUniformGridLookup ||
+            independentVariableValues.size( ) < 3 )
+    {
+        return selectedScheme;
+    }
+
+    const int numberOfIntervals = static_cast< int >( independentVariableValues.size( ) ) - 1;
+    const IndependentVariableType firstValue = independentVariableValues.front( );
+    const IndependentVariableType meanStepSize =
+            ( independentVariableValues.back( ) - firstValue ) /
+            static_cast< IndependentVariableType >( numberOfIntervals );
+
+    // Compute largest deviation from uniform grid, and smallest and largest spacing.
+    IndependentVariableType maximumDeviation = static_cast< IndependentVariableType >( 0 );
+    IndependentVariableType minimumStepSize = independentVariableValues[ 1 ] - firstValue;
+    IndependentVariableType maximumStepSize = minimumStepSize;
+    for( int i = 1; i <= numberOfIntervals; i++ )
+    {
+        const IndependentVariableType stepSize =
+                independentVariableValues[ i ] - independentVariableValues[ i - 1 ];
+        minimumStepSize = std::min( minimumStepSize, stepSize );
+        maximumStepSize = std::max( maximumStepSize, stepSize );
+
+        using std::abs;
+        maximumDeviation = std::max(
+                    maximumDeviation, static_cast< IndependentVariableType >(
+                        abs( independentVariableValues[ i ] - firstValue -
+                             static_cast< IndependentVariableType >( i ) * meanStepSize ) ) );
+    }
+
+    // Grid is not strictly ascending, use selected scheme.
+    if( !( minimumStepSize > static_cast< IndependentVariableType >( 0 ) ) )
+    {
+        return selectedScheme;
+    }
+    else if( maximumDeviation <=
+             static_cast< IndependentVariableType >( uniformSpacingTolerance ) * meanStepSize )
+    {
+        return uniformGridLookup;
+    }
+    else if( maximumStepSize <=
+             static_cast< IndependentVariableType >( maximumSpacingRatio ) * minimumStepSize )
+    {
+        return piecewiseUniformGridLookup;
+    }
+    else
+    {
+        return selectedScheme;
+    }
+}
+
+//! Function to create a lookup scheme.
+/*!
+ * Function to create a lookup scheme for a vector of independent variables. For the hunting and
+ * binary search schemes, the constant-time uniform or piecewise uniform grid lookup is used
+ * instead if the spacing of the entries is suitable (see getBestSuitedLookupScheme).
+ * \param independentVariableValues Vector of independent variable values, sorted in ascending
+ * order.
+ * \param selectedScheme Type of look-up scheme that is to be used.
+ * \return Lookup scheme for independentVariableValues.
+ */
+template< typename IndependentVariableType >
+boost::shared_ptr< LookUpScheme< IndependentVariableType > > createLookupScheme(
+        const std::vector< IndependentVariableType >& independentVariableValues,
+        const AvailableLookupScheme selectedScheme )
+{
+    boost::shared_ptr< LookUpScheme< IndependentVariableType > > lookUpScheme;
+
+    // Find which type of scheme is used.
+    switch( getBestSuitedLookupScheme( independentVariableValues, selectedScheme ) )
+    {
+    case binarySearch:
+        lookUpScheme = boost::make_shared< BinarySearchLookupScheme< IndependentVariableType > >(
+                    independentVariableValues );
+        break;
+    case huntingAlgorithm:
+        lookUpScheme = boost::make_shared< HuntingAlgorithmLookupScheme< IndependentVariableType > >(
+                    independentVariableValues );
+        break;
+    case uniformGridLookup:
+        lookUpScheme = boost::make_shared< UniformGridLookupScheme< IndependentVariableType > >(
+                    independentVariableValues );
+        break;
+    case piecewiseUniformGridLookup:
+        lookUpScheme = boost::make_shared<
+                PiecewiseUniformGridLookupScheme< IndependentVariableType > >(
+                    independentVariableValues );
+        break;
+    default:
+        throw std::runtime_error( "Error, lookup scheme not found when making lookup scheme." );
+    }
+
+    return lookUpScheme;
+}
+
 //! Typedef for shared-pointer to LookUpScheme object with double-type entries.
 typedef boost::shared_ptr< LookUpScheme< double > > LookUpSchemeDoublePointer;
 
@@ -248,6 +755,14 @@ HuntingAlgorithmLookupSchemeDoublePointer;
 typedef boost::shared_ptr< BinarySearchLookupScheme< double > >
 BinarySearchLookupSchemeDoublePointer;
 
+//! Typedef for shared-pointer to UniformGridLookupScheme object with double-type entries.
+typedef boost::shared_ptr< UniformGridLookupScheme< double > >
+UniformGridLookupSchemeDoublePointer;
+
+//! Typedef for shared-pointer to PiecewiseUniformGridLookupScheme object with double-type entries.
+typedef boost::shared_ptr< PiecewiseUniformGridLookupScheme< double > >
+PiecewiseUniformGridLookupSchemeDoublePointer;
+
 } // namespace interpolators
 } // namespace tudat
 
@@ -0,0 +1,303 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_MATRIXLAGRANGEINTERPOLATOR_H
+#define TUDAT_MATRIXLAGRANGEINTERPOLATOR_H
+
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
+
+namespace tudat
+{
+
+namespace interpolators
+{
+
+//! Class to perform Lagrange polynomial interpolation of matrices and vectors.
+/*!
+ *  Class to perform Lagrange polynomial interpolation of Eigen matrices or vectors (e.g. states or state transition
+ *  matrices), producing the same results as the LagrangeInterpolator class (up to rounding errors). The dependent
+ *  values are stored contiguously (and only there), with each (flattened) dependent value in one column of a single
+ *  matrix. The
+ *  interpolation weights of the data points are computed once, into a fixed-size array, after which the interpolated
+ *  value is computed as a single dense matrix-vector product of the block of data points and the weights. No memory is
+ *  allocated during the interpolation if the interpolated value is returned by reference (see
+ *  OneDimensionalInterpolator::interpolate overloads with interpolatedValue argument, which may also be called through
+ *  a pointer to the base class), as opposed to the LagrangeInterpolator, which allocates for each accumulated data
+ *  point if the dependent variables are dynamically sized.
+ *  \tparam IndependentVariableType Type of independent variable.
+ *  \tparam DependentVariableType Type of dependent variable (Eigen matrix or vector type).
+ *  \tparam ScalarType Scalar type in which the interpolation weights are computed.
+ */
+template< typename IndependentVariableType, typename DependentVariableType,
+          typename ScalarType = IndependentVariableType >
+class MatrixLagrangeInterpolator :
+        public LagrangeInterpolator< IndependentVariableType, DependentVariableType, ScalarType >
+{
+public:
+
+    //! Typedef for scalar type of dependent variables.
+    typedef typename DependentVariableType::Scalar DependentScalarType;
+
+    //! Using statements to prevent having to put 'this' everywhere in the code.
+    using LagrangeInterpolator< IndependentVariableType, DependentVariableType, ScalarType >::dependentValues_;
+    using LagrangeInterpolator< IndependentVariableType, DependentVariableType, ScalarType >::independentValues_;
+    using LagrangeInterpolator< IndependentVariableType, DependentVariableType, ScalarType >::lookUpScheme_;
+    using LagrangeInterpolator< IndependentVariableType, DependentVariableType, ScalarType >::numberOfStages_;
+    using LagrangeInterpolator< IndependentVariableType, DependentVariableType, ScalarType >::offsetEntries_;
+    using LagrangeInterpolator< IndependentVariableType, DependentVariableType, ScalarType >::denominators_;
+    using LagrangeInterpolator< IndependentVariableType, DependentVariableType, ScalarType >::beginInterpolator_;
+    using LagrangeInterpolator< IndependentVariableType, DependentVariableType, ScalarType >::endInterpolator_;
+    using LagrangeInterpolator< IndependentVariableType, DependentVariableType, ScalarType >::
+    numberOfIndependentValues_;
+    using LagrangeInterpolator< IndependentVariableType, DependentVariableType, ScalarType >::boundaryHandling_;
+
+    //! Maximum number of stages of the interpolator.
+    static const int maximumNumberOfStages = 16;
+
+    //! Constructor from vectors of independent/dependent data.
+    /*!
+     *  This constructor initializes the interpolator from two vectors containing the independent variables and
+     *  dependent variables. A look-up scheme can be provided to override the given default.
+     *  \param independentVariables Vector of values of independent variables that are used, must be sorted in
+     *  ascending order.
+     *  \param dependentVariables Vector of values of dependent variables that are used (all of equal size).
+     *  \param numberOfStages Number of data points that are used to calculate the interpolating polynomial (must be
+     *  even, and at most maximumNumberOfStages).
+     *  \param selectedLookupScheme Identifier of lookupscheme from enum. This algorithm is used to find the nearest
+     *  lower data point in the independent variables when requesting interpolation.
+     *  \param boundaryHandling Method to be used for handling boundaries of the interpolation domain.
+     */
+    MatrixLagrangeInterpolator( const std::vector< IndependentVariableType >& independentVariables,
+                                const std::vector< DependentVariableType >& dependentVariables,
+                                const int numberOfStages,
+                                const AvailableLookupScheme selectedLookupScheme = huntingAlgorithm,
+                                const LagrangeInterpolatorBoundaryHandling boundaryHandling =
+            lagrange_cubic_spline_boundary_interpolation ):
+        LagrangeInterpolator< IndependentVariableType, DependentVariableType, ScalarType >(
+            independentVariables, dependentVariables, numberOfStages, selectedLookupScheme, boundaryHandling )
+    {
+        initializeDependentValueBlock( );
+    }
+
+    //! Constructor from vectors of independent/dependent data and pre-computed denominators.
+    /*!
+     *  This constructor initializes the interpolator from two vectors containing the independent variables and
+     *  dependent variables, and the denominators of the interpolating polynomials that were previously computed for
+     *  these data (see LagrangeInterpolator::getDenominators), e.g. when reading the interpolator from a file.
+     *  \param independentVariables Vector of values of independent variables that are used, must be sorted in
+     *  ascending order.
+     *  \param dependentVariables Vector of values of dependent variables that are used (all of equal size).
+     *  \param numberOfStages Number of data points that are used to calculate the interpolating polynomial (must be
+     *  even, and at most maximumNumberOfStages).
+     *  \param denominators Pre-computed denominators of the interpolating polynomials.
+     *  \param selectedLookupScheme Identifier of lookupscheme from enum. This algorithm is used to find the nearest
+     *  lower data point in the independent variables when requesting interpolation.
+     *  \param boundaryHandling Method to be used for handling boundaries of the interpolation domain.
+     */
+    MatrixLagrangeInterpolator( const std::vector< IndependentVariableType >& independentVariables,
+                                const std::vector< DependentVariableType >& dependentVariables,
+                                const int numberOfStages,
+                                const std::vector< ScalarType >& denominators,
+                                const AvailableLookupScheme selectedLookupScheme = huntingAlgorithm,
+                                const LagrangeInterpolatorBoundaryHandling boundaryHandling =
+            lagrange_cubic_spline_boundary_interpolation ):
+        LagrangeInterpolator< IndependentVariableType, DependentVariableType, ScalarType >(
+            independentVariables, dependentVariables, numberOfStages, denominators, selectedLookupScheme,
+            boundaryHandling )
+    {
+        initializeDependentValueBlock( );
+    }
+
+    //! Constructor from map of independent/dependent data.
+    /*!
+     *  This constructor initializes the interpolator from a map containing independent variables as key and dependent
+     *  variables as value. A look-up scheme can be provided to override the given default.
+     *  \param dataMap Map containing independent variables as key and dependent variables (all of equal size) as
+     *  value.
+     *  \param numberOfStages Number of data points that are used to calculate the interpolating polynomial (must be
+     *  even, and at most maximumNumberOfStages).
+     *  \param selectedLookupScheme Identifier of lookupscheme from enum. This algorithm is used to find the nearest
+     *  lower data point in the independent variables when requesting interpolation.
+     *  \param boundaryHandling Method to be used for handling boundaries of the interpolation domain.
+     */
+    MatrixLagrangeInterpolator( const std::map< IndependentVariableType, DependentVariableType >& dataMap,
+                                const int numberOfStages,
+                                const AvailableLookupScheme selectedLookupScheme = huntingAlgorithm,
+                                const LagrangeInterpolatorBoundaryHandling boundaryHandling =
+            lagrange_cubic_spline_boundary_interpolation ):
+        LagrangeInterpolator< IndependentVariableType, DependentVariableType, ScalarType >(
+            dataMap, numberOfStages, selectedLookupScheme, boundaryHandling )
+    {
+        initializeDependentValueBlock( );
+    }
+
+    //! Destructor.
+    ~MatrixLagrangeInterpolator( ){ }
+
+    // Using statement to prevent compiler warning.
+    using LagrangeInterpolator< IndependentVariableType, DependentVariableType, ScalarType >::interpolate;
+
+    //! Function interpolates dependent variable value at given independent variable value.
+    /*!
+     *  Function interpolates dependent variable value at given independent variable value (see
+     *  LagrangeInterpolator::interpolate).
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation is to take place.
+     *  \param cursor Cursor storing the state of the sequence of lookups (modified by function).
+     *  \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolate( const IndependentVariableType targetIndependentVariableValue,
+                                       LookUpSchemeCursor& cursor ) const
+    {
+        DependentVariableType interpolatedValue;
+        interpolate( targetIndependentVariableValue, interpolatedValue, cursor );
+        return interpolatedValue;
+    }
+
+    //! Function interpolates dependent variable value at given independent variable value, returned by reference.
+    /*!
+     *  Function interpolates dependent variable value at given independent variable value, returned by reference
+     *  (overriding the function of the base class). The interpolated value is only resized if its size is not yet
+     *  correct, so that no memory is allocated if it is reused between calls (except in the cubic spline boundary
+     *  regions).
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation is to take place.
+     *  \param interpolatedValue Interpolated value of dependent variable (returned by reference).
+     *  \param cursor Cursor storing the state of the sequence of lookups (modified by function).
+     */
+    void interpolate( const IndependentVariableType targetIndependentVariableValue,
+                      DependentVariableType& interpolatedValue,
+                      LookUpSchemeCursor& cursor ) const
+    {
+        // Find interpolation interval
+        const int lowerEntry = lookUpScheme_->findNearestLowerNeighbour( targetIndependentVariableValue, cursor );
+
+        // Check if requested interval is inside region in which centered lagrange interpolation can be used.
+        if( lowerEntry < offsetEntries_ || lowerEntry >= numberOfIndependentValues_ - offsetEntries_ - 1 )
+        {
+            if( boundaryHandling_ == lagrange_no_boundary_interpolation )
+            {
+                throw std::runtime_error( "Error: Lagrange interpolator outside allowed bounds." );
+            }
+            interpolatedValue = ( lowerEntry < offsetEntries_ ? beginInterpolator_ : endInterpolator_ )->interpolate(
+                        targetIndependentVariableValue );
+            return;
+        }
+
+        if( interpolatedValue.rows( ) != dependentValueRows_ || interpolatedValue.cols( ) != dependentValueColumns_ )
+        {
+            interpolatedValue.resize( dependentValueRows_, dependentValueColumns_ );
+        }
+        Eigen::Map< Eigen::Matrix< DependentScalarType, Eigen::Dynamic, 1 > > flattenedInterpolatedValue(
+                    interpolatedValue.data( ), dependentValueBlock_.rows( ) );
+
+        // Check if requested independent variable is equal to data point
+        for( int i = ( lowerEntry > 0 ? -1 : 0 ); i <= 1; i++ )
+        {
+            if( independentValues_[ lowerEntry + i ] == targetIndependentVariableValue )
+            {
+                flattenedInterpolatedValue = dependentValueBlock_.col( lowerEntry + i );
+                return;
+            }
+        }
+
+        // Compute weights of data points in interpolating polynomial.
+        Eigen::Matrix< DependentScalarType, Eigen::Dynamic, 1, 0, maximumNumberOfStages, 1 > weights( numberOfStages_ );
+        ScalarType repeatedNumerator = mathematical_constants::getFloatingInteger< ScalarType >( 1 );
+        for( int i = 0; i < numberOfStages_; i++ )
+        {
+            repeatedNumerator *= static_cast< ScalarType >(
+                        targetIndependentVariableValue - independentValues_[ i + lowerEntry - offsetEntries_ ] );
+        }
+        for( int i = 0; i < numberOfStages_; i++ )
+        {
+            weights( i ) = static_cast< DependentScalarType >(
+                        repeatedNumerator /
+                        ( static_cast< ScalarType >(
+                              targetIndependentVariableValue - independentValues_[ i + lowerEntry - offsetEntries_ ] ) *
+                          denominators_[ lowerEntry * numberOfStages_ + i ] ) );
+        }
+
+        // Evaluate interpolating polynomial as product of block of data points and weights.
+        flattenedInterpolatedValue.noalias( ) =
+                dependentValueBlock_.middleCols( lowerEntry - offsetEntries_, numberOfStages_ ) * weights;
+    }
+
+    //! Function to return the vector with dependent variables used by the interpolator.
+    /*!
+     *  Function to return the vector with dependent variables used by the interpolator, which is reconstructed from
+     *  the contiguously stored dependent values.
+     *  \return Dependent variables used by the interpolator.
+     */
+    std::vector< DependentVariableType > getDependentValues( )
+    {
+        std::vector< DependentVariableType > dependentValues( numberOfIndependentValues_ );
+        for( int i = 0; i < numberOfIndependentValues_; i++ )
+        {
+            dependentValues[ i ].resize( dependentValueRows_, dependentValueColumns_ );
+            Eigen::Map< Eigen::Matrix< DependentScalarType, Eigen::Dynamic, 1 > >(
+                        dependentValues[ i ].data( ), dependentValueBlock_.rows( ) ) = dependentValueBlock_.col( i );
+        }
+        return dependentValues;
+    }
+
+private:
+
+    //! Function called at initialization which stores the dependent values contiguously.
+    /*!
+     *  Function called at initialization which stores the dependent values contiguously, after which the dependent
+     *  values stored by the base class (which are no longer used) are released.
+     */
+    void initializeDependentValueBlock( )
+    {
+        if( numberOfStages_ > maximumNumberOfStages )
+        {
+            throw std::runtime_error( "Error, matrix Lagrange interpolator number of stages is too large." );
+        }
+
+        dependentValueRows_ = static_cast< int >( dependentValues_[ 0 ].rows( ) );
+        dependentValueColumns_ = static_cast< int >( dependentValues_[ 0 ].cols( ) );
+
+        dependentValueBlock_.resize( dependentValueRows_ * dependentValueColumns_, numberOfIndependentValues_ );
+        for( int i = 0; i < numberOfIndependentValues_; i++ )
+        {
+            if( dependentValues_[ i ].rows( ) != dependentValueRows_ ||
+                    dependentValues_[ i ].cols( ) != dependentValueColumns_ )
+            {
+                throw std::runtime_error(
+                            "Error, matrix Lagrange interpolator requires dependent variables of equal size." );
+            }
+            dependentValueBlock_.col( i ) = Eigen::Map< const Eigen::Matrix< DependentScalarType, Eigen::Dynamic, 1 > >(
+                        dependentValues_[ i ].data( ), dependentValueBlock_.rows( ) );
+        }
+        std::vector< DependentVariableType >( ).swap( dependentValues_ );
+    }
+
+    //! Dependent values, with the (flattened) dependent value of data point i in column i.
+    Eigen::Matrix< DependentScalarType, Eigen::Dynamic, Eigen::Dynamic > dependentValueBlock_;
+
+    //! Number of rows of dependent values.
+    int dependentValueRows_;
+
+    //! Number of columns of dependent values.
+    int dependentValueColumns_;
+};
+
+} // namespace interpolators
+
+} // namespace tudat
+
+#endif // TUDAT_MATRIXLAGRANGEINTERPOLATOR_H
@@ -0,0 +1,355 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Press W.H., et al., Numerical Recipes in C++: The Art of Scientific Computing. Cambridge University Press,
+ *          February 2002.
+ */
+
+#ifndef TUDAT_MULTI_CUBIC_SPLINE_INTERPOLATOR_H
+#define TUDAT_MULTI_CUBIC_SPLINE_INTERPOLATOR_H
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/array.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/multi_array.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Mathematics/Interpolators/interpolator.h"
+#include "Tudat/Mathematics/Interpolators/lookupScheme.h"
+
+namespace tudat
+{
+namespace interpolators
+{
+
+//! Class for performing tensor-product cubic spline interpolation for arbitrary number of independent variables.
+/*!
+ *  Class for performing tensor-product cubic spline interpolation on a (possibly non-uniform) hyper-rectangular grid
+ *  for an arbitrary number of independent variables, with natural boundary conditions (zero second derivative at the
+ *  edges of the grid) in each dimension. Contrary to the MultiLinearInterpolator, the interpolated value is
+ *  continuous up to its second derivatives, also when crossing grid lines, which prevents step-size rejections of
+ *  variable step-size integrators when the interpolator is used in the equations of motion.
+ *
+ *  In one dimension, the cubic spline in interval [x_i,x_{i+1}] is given by A y_i + B y_{i+1} + C y''_i + D y''_{i+1}
+ *  (Press et al., 2002), with y'' the second derivatives of the spline at the data points. The tensor-product spline
+ *  is evaluated in the same manner, using the mixed second derivatives w.r.t. each subset of the independent
+ *  variables at the corners of the grid hyper-rectangle containing the requested point. These 2^{numberOfDimensions}
+ *  coefficients are pre-computed for each data point at construction (by solving the tridiagonal spline equations
+ *  along each grid line), and stored contiguously per data point. The interpolation is then a weighted sum of
+ *  4^{numberOfDimensions} coefficients, with weights formed as products of A, B, C and D of each dimension, which is
+ *  performed with fixed-size arrays (no memory is allocated). Outside of the grid, the polynomials of the outermost
+ *  intervals are extrapolated.
+ *  \tparam IndependentVariableType Type for independent variables.
+ *  \tparam DependentVariableType Type for dependent variable.
+ *  \tparam numberOfDimensions Number of independent variables.
+ */
+template< typename IndependentVariableType, typename DependentVariableType, int numberOfDimensions >
+class MultiCubicSplineInterpolator: public Interpolator< IndependentVariableType, DependentVariableType >
+{
+public:
+
+    //! Number of corners of the grid hyper-rectangle used for the interpolation.
+    static const int numberOfCorners = 1 << numberOfDimensions;
+
+    //! Number of coefficients used for the interpolation.
+    static const int numberOfTerms = 1 << ( 2 * numberOfDimensions );
+
+    //! Constructor taking independent and dependent variable data.
+    /*!
+     *  Constructor taking independent and dependent variable data, and computing the spline coefficients.
+     *  \param independentValues Vector of vectors containing data points of independent variables, each must be
+     *  sorted in ascending order and contain at least two entries.
+     *  \param dependentData Multi-dimensional array of dependent data at each point of hyper-rectangular grid formed by
+     *  independent variable points.
+     *  \param selectedLookupScheme Identifier of lookupscheme from enum. This algorithm is used to find the nearest lower
+     *  data point in the independent variables when requesting interpolation.
+     */
+    MultiCubicSplineInterpolator(
+            const std::vector< std::vector< IndependentVariableType > >& independentValues,
+            const boost::multi_array< DependentVariableType, numberOfDimensions >& dependentData,
+            const AvailableLookupScheme selectedLookupScheme = huntingAlgorithm ):
+        independentValues_( independentValues )
+    {
+        // Check consistency of input data of dependent and independent data.
+        if( independentValues.size( ) != numberOfDimensions )
+        {
+            throw std::runtime_error( "Error: dimension of independent value vector provided to multi-cubic spline "
+                                      "interpolator incompatible with template parameter." );
+        }
+        for( int i = 0; i < numberOfDimensions; i++ )
+        {
+            if( independentValues[ i ].size( ) != dependentData.shape( )[ i ] )
+            {
+                throw std::runtime_error( "Error: number of data points in dimension " +
+                                          boost::lexical_cast< std::string >( i ) +
+                                          " of independent and dependent data of multi-cubic spline interpolator "
+                                          "incompatible." );
+            }
+            if( independentValues[ i ].size( ) < 2 )
+            {
+                throw std::runtime_error( "Error: at least two data points are required in dimension " +
+                                          boost::lexical_cast< std::string >( i ) +
+                                          " of multi-cubic spline interpolator." );
+            }
+        }
+
+        // Create lookup schemes.
+        lookUpSchemes_.resize( numberOfDimensions );
+        for( int i = 0; i < numberOfDimensions; i++ )
+        {
+            lookUpSchemes_[ i ] = createLookupScheme( independentValues_[ i ], selectedLookupScheme );
+        }
+
+        computeCoefficients( dependentData );
+    }
+
+    //! Destructor.
+    ~MultiCubicSplineInterpolator( ){ }
+
+    //! Function to perform interpolation.
+    /*!
+     *  This function performs the tensor-product cubic spline interpolation.
+     *  \param independentValuesToInterpolate Vector of values of independent variables at which the value of the
+     *  dependent variable is to be determined.
+     *  \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolate( const std::vector< IndependentVariableType >& independentValuesToInterpolate )
+    {
+        return interpolateAtPoint( independentValuesToInterpolate );
+    }
+
+    //! Function to perform interpolation.
+    /*!
+     *  This function performs the tensor-product cubic spline interpolation. It does not modify the interpolator, so
+     *  that it may be called concurrently from several threads.
+     *  \param independentValuesToInterpolate Vector of values of independent variables at which the value of the
+     *  dependent variable is to be determined.
+     *  \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolateAtPoint(
+            const std::vector< IndependentVariableType >& independentValuesToInterpolate ) const
+    {
+        if( independentValuesToInterpolate.size( ) != numberOfDimensions )
+        {
+            throw std::runtime_error(
+                        "Error: number of independent variables provided to multi-cubic spline interpolator is "
+                        "incorrect." );
+        }
+
+        // Determine the nearest lower neighbours, offset of corresponding data point, and compute weights of
+        // coefficients as products of A, B, C and D (see class description) of each dimension; digit i (in base 4) of
+        // the index of the weights denotes the term of dimension i.
+        int lowerCornerIndex = 0;
+        boost::array< IndependentVariableType, numberOfTerms > termWeights;
+        termWeights[ 0 ] = mathematical_constants::getFloatingInteger< IndependentVariableType >( 1 );
+        for( int i = 0; i < numberOfDimensions; i++ )
+        {
+            const int nearestLowerIndex = lookUpSchemes_[ i ]->findNearestLowerNeighbour(
+                        independentValuesToInterpolate[ i ] );
+            lowerCornerIndex += nearestLowerIndex * strides_[ i ];
+
+            const IndependentVariableType intervalSize =
+                    independentValues_[ i ][ nearestLowerIndex + 1 ] - independentValues_[ i ][ nearestLowerIndex ];
+            const IndependentVariableType coefficientA =
+                    ( independentValues_[ i ][ nearestLowerIndex + 1 ] - independentValuesToInterpolate[ i ] ) /
+                    intervalSize;
+            const IndependentVariableType coefficientB =
+                    mathematical_constants::getFloatingInteger< IndependentVariableType >( 1 ) - coefficientA;
+            const IndependentVariableType coefficientC =
+                    ( coefficientA * coefficientA * coefficientA - coefficientA ) * intervalSize * intervalSize /
+                    mathematical_constants::getFloatingInteger< IndependentVariableType >( 6 );
+            const IndependentVariableType coefficientD =
+                    ( coefficientB * coefficientB * coefficientB - coefficientB ) * intervalSize * intervalSize /
+                    mathematical_constants::getFloatingInteger< IndependentVariableType >( 6 );
+
+            const int numberOfTermsSet = 1 << ( 2 * i );
+            for( int j = 0; j < numberOfTermsSet; j++ )
+            {
+                const IndependentVariableType currentWeight = termWeights[ j ];
+                termWeights[ j ] = currentWeight * coefficientA;
+                termWeights[ j + numberOfTermsSet ] = currentWeight * coefficientB;
+                termWeights[ j + 2 * numberOfTermsSet ] = currentWeight * coefficientC;
+                termWeights[ j + 3 * numberOfTermsSet ] = currentWeight * coefficientD;
+            }
+        }
+
+        // Sum weighted coefficients.
+        const DependentVariableType* lowerCornerCoefficients = &coefficients_[ lowerCornerIndex * numberOfCorners ];
+        DependentVariableType interpolatedValue = termWeights[ 0 ] * lowerCornerCoefficients[ 0 ];
+        for( int j = 1; j < numberOfTerms; j++ )
+        {
+            interpolatedValue += termWeights[ j ] * lowerCornerCoefficients[ termOffsets_[ j ] ];
+        }
+        return interpolatedValue;
+    }
+
+    //! Function to return the number of independent variables of the interpolation.
+    /*!
+     *  Function to return the number of independent variables of the interpolation, i.e. size that the vector used as
+     *  input for Interpolator::interpolate should be.
+     *  \return Number of independent variables of the interpolation.
+     */
+    int getNumberOfDimensions( )
+    {
+        return numberOfDimensions;
+    }
+
+private:
+
+    //! Function to compute the spline coefficients of all data points.
+    /*!
+     *  Function to compute the spline coefficients of all data points, i.e. the mixed second derivatives of the
+     *  tensor-product spline w.r.t. each subset of the independent variables, as well as the offsets of all
+     *  coefficients used for an interpolation w.r.t. the first coefficient of the lower corner.
+     *  \param dependentData Multi-dimensional array of dependent data at each point of grid.
+     */
+    void computeCoefficients( const boost::multi_array< DependentVariableType, numberOfDimensions >& dependentData )
+    {
+        // Compute strides of data points (in row-major order).
+        int numberOfDataPoints = 1;
+        for( int i = numberOfDimensions - 1; i >= 0; i-- )
+        {
+            strides_[ i ] = numberOfDataPoints;
+            numberOfDataPoints *= static_cast< int >( independentValues_[ i ].size( ) );
+        }
+
+        // Copy dependent data into coefficients (independent of index bases and storage order of input).
+        coefficients_.resize( numberOfDataPoints * numberOfCorners );
+        for( int j = 0; j < numberOfDataPoints; j++ )
+        {
+            const DependentVariableType* dataPoint = dependentData.origin( );
+            for( int i = 0; i < numberOfDimensions; i++ )
+            {
+                dataPoint += ( ( j / strides_[ i ] ) % static_cast< int >( independentValues_[ i ].size( ) ) +
+                               dependentData.index_bases( )[ i ] ) * dependentData.strides( )[ i ];
+            }
+            for( int k = 0; k < numberOfCorners; k++ )
+            {
+                coefficients_[ j * numberOfCorners + k ] = *dataPoint;
+            }
+        }
+
+        // Compute second derivatives w.r.t. each subset of independent variables (bit i of subset index denotes
+        // derivative w.r.t. independent variable i), from the derivatives w.r.t. the subset without its lowest
+        // independent variable.
+        for( int k = 1; k < numberOfCorners; k++ )
+        {
+            int dimension = 0;
+            while( !( k & ( 1 << dimension ) ) )
+            {
+                dimension++;
+            }
+            computeSecondDerivativesAlongDimension( dimension, k - ( 1 << dimension ), k );
+        }
+
+        // Compute offsets of coefficients used for interpolation; bit 2i of the term index denotes the upper data point
+        // in dimension i, bit 2i+1 denotes the second derivative w.r.t. independent variable i.
+        for( int j = 0; j < numberOfTerms; j++ )
+        {
+            termOffsets_[ j ] = 0;
+            for( int i = 0; i < numberOfDimensions; i++ )
+            {
+                if( j & ( 1 << ( 2 * i ) ) )
+                {
+                    termOffsets_[ j ] += strides_[ i ] * numberOfCorners;
+                }
+                if( j & ( 1 << ( 2 * i + 1 ) ) )
+                {
+                    termOffsets_[ j ] += 1 << i;
+                }
+            }
+        }
+    }
+
+    //! Function to compute the second derivatives of a set of coefficients along grid lines in a single dimension.
+    /*!
+     *  Function to compute the second derivatives of a natural cubic spline through a set of coefficients along all
+     *  grid lines in a single dimension, by solving the tridiagonal spline equations (Press et al., 2002).
+     *  \param dimension Dimension along which the spline equations are to be solved.
+     *  \param inputIndex Index (in the coefficients of each data point) of the values that are to be interpolated.
+     *  \param outputIndex Index (in the coefficients of each data point) at which the second derivatives are set.
+     */
+    void computeSecondDerivativesAlongDimension( const int dimension, const int inputIndex, const int outputIndex )
+    {
+        const std::vector< IndependentVariableType >& nodes = independentValues_[ dimension ];
+        const int numberOfNodes = static_cast< int >( nodes.size( ) );
+        const int stride = strides_[ dimension ] * numberOfCorners;
+        const int numberOfDataPoints = static_cast< int >( coefficients_.size( ) ) / numberOfCorners;
+
+        // Compute diagonal and off-diagonal terms of forward sweep of tridiagonal system.
+        std::vector< IndependentVariableType > modifiedUpperDiagonal( numberOfNodes, 0.0 );
+        std::vector< IndependentVariableType > modifiedDiagonal( numberOfNodes, 1.0 );
+        for( int i = 1; i < numberOfNodes - 1; i++ )
+        {
+            const IndependentVariableType lowerDiagonal = ( nodes[ i ] - nodes[ i - 1 ] ) / 6.0;
+            modifiedDiagonal[ i ] = ( nodes[ i + 1 ] - nodes[ i - 1 ] ) / 3.0 -
+                    lowerDiagonal * modifiedUpperDiagonal[ i - 1 ];
+            modifiedUpperDiagonal[ i ] = ( nodes[ i + 1 ] - nodes[ i ] ) / 6.0 / modifiedDiagonal[ i ];
+        }
+
+        // Iterate over all grid lines along dimension (i.e. data points with index zero in dimension).
+        std::vector< DependentVariableType > modifiedRightHandSide( numberOfNodes );
+        for( int j = 0; j < numberOfDataPoints; j++ )
+        {
+            if( ( j / strides_[ dimension ] ) % numberOfNodes != 0 )
+            {
+                continue;
+            }
+            DependentVariableType* input = &coefficients_[ j * numberOfCorners + inputIndex ];
+            DependentVariableType* output = &coefficients_[ j * numberOfCorners + outputIndex ];
+            const DependentVariableType zeroEntry = input[ 0 ] - input[ 0 ];
+
+            // Perform forward sweep, with zero second derivative at ends (natural spline).
+            modifiedRightHandSide[ 0 ] = zeroEntry;
+            for( int i = 1; i < numberOfNodes - 1; i++ )
+            {
+                const IndependentVariableType lowerDiagonal = ( nodes[ i ] - nodes[ i - 1 ] ) / 6.0;
+                const DependentVariableType rightHandSide =
+                        ( input[ ( i + 1 ) * stride ] - input[ i * stride ] ) / ( nodes[ i + 1 ] - nodes[ i ] ) -
+                        ( input[ i * stride ] - input[ ( i - 1 ) * stride ] ) / ( nodes[ i ] - nodes[ i - 1 ] );
+                modifiedRightHandSide[ i ] = ( rightHandSide - lowerDiagonal * modifiedRightHandSide[ i - 1 ] ) /
+                        modifiedDiagonal[ i ];
+            }
+
+            // Perform back substitution.
+            output[ ( numberOfNodes - 1 ) * stride ] = zeroEntry;
+            for( int i = numberOfNodes - 2; i > 0; i-- )
+            {
+                output[ i * stride ] = modifiedRightHandSide[ i ] -
+                        modifiedUpperDiagonal[ i ] * output[ ( i + 1 ) * stride ];
+            }
+            output[ 0 ] = zeroEntry;
+        }
+    }
+
+    //! Vector of vectors containing independent variables.
+    std::vector< std::vector< IndependentVariableType > > independentValues_;
+
+    //! Look-up schemes used to determine in which interval the requested independent variable values fall.
+    std::vector< boost::shared_ptr< LookUpScheme< IndependentVariableType > > > lookUpSchemes_;
+
+    //! Spline coefficients of all data points, with the numberOfCorners coefficients of each data point contiguous.
+    std::vector< DependentVariableType > coefficients_;
+
+    //! Strides of data points in each dimension (in row-major order).
+    boost::array< int, numberOfDimensions > strides_;
+
+    //! Offsets of coefficients used for interpolation w.r.t. first coefficient of lower corner.
+    boost::array< int, numberOfTerms > termOffsets_;
+};
+
+} // namespace interpolators
+} // namespace tudat
+
+#endif // TUDAT_MULTI_CUBIC_SPLINE_INTERPOLATOR_H
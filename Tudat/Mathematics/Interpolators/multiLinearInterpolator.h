@@ -61,6 +61,7 @@
 
 #include "Tudat/Mathematics/Interpolators/lookupScheme.h"
 #include "Tudat/Mathematics/Interpolators/interpolator.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 #include "Tudat/Mathematics/BasicMathematics/nearestNeighbourSearch.h"
 
 namespace tudat
@@ -71,8 +72,12 @@ namespace interpolators
 //! Class for performing multi-linear interpolation for arbitrary number of independent variables.
 /*!
  * Class for performing multi-linear interpolation for arbitrary number of independent variables.
- * Interpolation is calculated recursively over all dimensions of independent variables. Note
- * that the types (i.e. double, float) of all independent variables must be the same.
+ * Note that the types (i.e. double, float) of all independent variables must be the same. The
+ * interpolated value is computed as the weighted sum of the dependent variable values at the
+ * 2^{numberOfDimensions} corners of the grid hyper-rectangle containing the requested point. The
+ * offsets of these corners in the (contiguous) storage of the dependent data are pre-computed from
+ * the strides of the data array, and all intermediate quantities are stored in fixed-size arrays,
+ * so that no memory is allocated during the interpolation.
  * \tparam IndependentVariableType Type for independent variables.
  * \tparam DependentVariableType Type for dependent variable.
  * \tparam numberOfDimensions Number of independent variables.
@@ -84,6 +89,9 @@ class MultiLinearInterpolator: public Interpolator< IndependentVariableType,
 {
 public:
 
+    //! Number of corners of the grid hyper-rectangle used for the interpolation.
+    static const int numberOfCorners = 1 << numberOfDimensions;
+
     //! Constructor taking independent and dependent variable data.
     /*!
      * \param independentValues Vector of vectors containing data points of independent variables,
@@ -117,9 +125,16 @@ public:
                         boost::lexical_cast< std::string >( i ) + "of independent and dependent data incompatible";
                 throw std::runtime_error( errorMessage );
             }
+            if ( independentValues[ i ].size( ) < 2 )
+            {
+                std::string errorMessage = "Error: at least two data points are required in dimension " +
+                        boost::lexical_cast< std::string >( i ) + " of multi-linear interpolator";
+                throw std::runtime_error( errorMessage );
+            }
         }
 
         makeLookupSchemes( selectedLookupScheme );
+        initializeCornerOffsets( );
     }
 
     //! Default destructor
@@ -138,27 +153,67 @@ public:
     DependentVariableType interpolate(
             const std::vector< IndependentVariableType >& independentValuesToInterpolate )
     {
-        // Determine the nearest lower neighbours.
-        std::vector< int > nearestLowerIndices;
-        nearestLowerIndices.resize( numberOfDimensions );
-        for ( unsigned int i = 0; i < numberOfDimensions; i++ )
+        return interpolateAtPoint( independentValuesToInterpolate );
+    }
+
+    //! Function to perform interpolation.
+    /*!
+     *  This function performs the multilinear interpolation. It does not modify the interpolator,
+     *  so that it may be called concurrently from several threads.
+     *  \param independentValuesToInterpolate Vector of values of independent variables at which
+     *  the value of the dependent variable is to be determined.
+     *  \return Interpolated value of dependent variable in all dimensions.
+     */
+    DependentVariableType interpolateAtPoint(
+            const std::vector< IndependentVariableType >& independentValuesToInterpolate ) const
+    {
+        if ( independentValuesToInterpolate.size( ) != numberOfDimensions )
         {
-            nearestLowerIndices[ i ] = lookUpSchemes_[ i ]->findNearestLowerNeighbour(
-                    independentValuesToInterpolate[ i ] );
+            throw std::runtime_error(
+                        "Error: number of independent variables provided to multi-linear interpolator is incorrect." );
         }
 
-        // Initialize function evaluation indices to -1 for debugging purposes.
-        boost::array< int, numberOfDimensions > interpolationIndices;
+        // Determine the nearest lower neighbours, offset of corresponding data point, and weights
+        // of lower and upper data points in each dimension.
+        int lowerCornerOffset = 0;
+        boost::array< IndependentVariableType, numberOfDimensions > upperFractions;
+        boost::array< IndependentVariableType, numberOfDimensions > lowerFractions;
         for ( int i = 0; i < numberOfDimensions; i++ )
         {
-            interpolationIndices[ i ] = -1;
+            const int nearestLowerIndex = lookUpSchemes_[ i ]->findNearestLowerNeighbour(
+                        independentValuesToInterpolate[ i ] );
+            lowerCornerOffset += nearestLowerIndex * strides_[ i ];
+
+            const IndependentVariableType intervalSize =
+                    independentValues_[ i ][ nearestLowerIndex + 1 ] - independentValues_[ i ][ nearestLowerIndex ];
+            upperFractions[ i ] = ( independentValuesToInterpolate[ i ] -
+                                    independentValues_[ i ][ nearestLowerIndex ] ) / intervalSize;
+            lowerFractions[ i ] = -( independentValuesToInterpolate[ i ] -
+                                     independentValues_[ i ][ nearestLowerIndex + 1 ] ) / intervalSize;
         }
 
-        // Call first step of interpolation, this function calls itself at subsequent independent
-        // variable dimensions to evaluate and properly scale dependent variable table values at
-        // all 2^n grid edges.
-        return performRecursiveInterpolationStep( 0, independentValuesToInterpolate,
-                                                  interpolationIndices, nearestLowerIndices );
+        // Compute weights of all corners as products of fractions (bit i of corner index denotes
+        // upper data point in dimension i).
+        boost::array< IndependentVariableType, numberOfCorners > cornerWeights;
+        cornerWeights[ 0 ] = mathematical_constants::getFloatingInteger< IndependentVariableType >( 1 );
+        for ( int i = 0; i < numberOfDimensions; i++ )
+        {
+            const int numberOfCornersSet = 1 << i;
+            for ( int j = 0; j < numberOfCornersSet; j++ )
+            {
+                cornerWeights[ j + numberOfCornersSet ] = cornerWeights[ j ] * upperFractions[ i ];
+                cornerWeights[ j ] *= lowerFractions[ i ];
+            }
+        }
+
+        // Sum weighted values at corners.
+        const DependentVariableType* lowerCornerValue = dependentData_.origin( ) + lowerCornerOffset;
+        DependentVariableType interpolatedValue = cornerWeights[ 0 ] * lowerCornerValue[ 0 ];
+        for ( int j = 1; j < numberOfCorners; j++ )
+        {
+            interpolatedValue += cornerWeights[ j ] * lowerCornerValue[ cornerOffsets_[ j ] ];
+        }
+        return interpolatedValue;
     }
 
     //! Function to return the number of independent variables of the interpolation.
@@ -172,6 +227,36 @@ public:
         return numberOfDimensions;
     }
 
+    //! Function to return the lookup schemes used by the interpolator.
+    /*!
+     *  Function to return the lookup schemes used by the interpolator, one for each dimension.
+     *  \return Lookup schemes used by the interpolator.
+     */
+    std::vector< boost::shared_ptr< LookUpScheme< IndependentVariableType > > > getLookUpSchemes( )
+    {
+        return lookUpSchemes_;
+    }
+
+    //! Function to return the independent variables used by the interpolator.
+    /*!
+     *  Function to return the independent variables used by the interpolator.
+     *  \return Vector of vectors containing independent variables, one vector for each dimension.
+     */
+    const std::vector< std::vector< IndependentVariableType > >& getIndependentValues( )
+    {
+        return independentValues_;
+    }
+
+    //! Function to return the dependent data used by the interpolator.
+    /*!
+     *  Function to return the dependent data used by the interpolator.
+     *  \return Multi-dimensional array of dependent data at each point of the grid.
+     */
+    const boost::multi_array< DependentVariableType, numberOfDimensions >& getDependentData( )
+    {
+        return dependentData_;
+    }
+
 
 private:
 
@@ -180,118 +265,44 @@ private:
      * This function creates the look up scheme that is to be used in determining the interval of
      * the independent variable grid where the interpolation is to be performed. It takes the type
      * of lookup scheme as an enum and constructs the lookup scheme from the independentValues_
-     * that have been set previously.
+     * that have been set previously. For each dimension in which the independentValues_ are
+     * (nearly) uniformly spaced, a constant-time lookup scheme is used instead of a hunting or
+     * binary search scheme (see createLookupScheme).
      *  \param selectedScheme Type of look-up scheme that is to be used
      */
     void makeLookupSchemes( const AvailableLookupScheme selectedScheme )
     {
         lookUpSchemes_.resize( numberOfDimensions );
-        // Find which type of scheme is used.
-        switch( selectedScheme )
+        for( int i = 0; i < numberOfDimensions; i++ )
         {
-        case binarySearch:
-
-            for( int i = 0; i < numberOfDimensions; i++ )
-            {
-                // Create binary search look up scheme.
-                lookUpSchemes_[ i ] = boost::shared_ptr< LookUpScheme< IndependentVariableType > >
-                        ( new BinarySearchLookupScheme< IndependentVariableType >(
-                              independentValues_[ i ] ) );
-            }
-
-            break;
-
-        case huntingAlgorithm:
-
-            for( int i = 0; i < numberOfDimensions; i++ )
-            {
-                // Create hunting scheme, which uses an intial guess from previous look-ups.
-                lookUpSchemes_[ i ] = boost::shared_ptr< LookUpScheme< IndependentVariableType > >
-                        ( new HuntingAlgorithmLookupScheme< IndependentVariableType >(
-                              independentValues_[ i ] ) );
-            }
-
-            break;
-
-        default:
-
-            throw std::runtime_error( "Warning: lookup scheme not found when making scheme for 1-D interpolator" );
+            lookUpSchemes_[ i ] = createLookupScheme( independentValues_[ i ], selectedScheme );
         }
     }
 
-    //! Perform the step in a single dimension of the interpolation process.
+    //! Function to pre-compute the offsets of the corners of a grid hyper-rectangle.
     /*!
-     * Function calculates single dimension of the interpolation process. Function calls itself if
-     * final dimension not yet reached. Calling this function with currentVariable = 0 will result
-     * in 2^{numberOfDimensions} number of calls to the function at currentVariable =
-     * numberOfDimensions -1. As such, the complete series of calls, starting at currentVariable =
-     * 0, retrieves the dependent variable values at all edges of the grid hyper-rectangle and
-     * properly scales them.
-     * \param currentVariable Dimension in which this interpolation step is to be performed.
-     * \param independentValuesToInterpolate Vector of values of independent variables at which
-     *          interpolation is to be performed.
-     * \param currentArrayIndices Array of indices modified at index = currentVariable at each
-     *          call of function. Variable is passed to dependentData in highest step to return
-     *          data for interpolation.
-     * \param nearestLowerIndices Indices in subvectors of independentValues_ vector. That is, the
-     *  n-th entry of nearestLowerIndices represent the nearest lower neighbour in the n-th
-     *  interpolation dimension of the independent variable vectors.
-     * \return Interpolated value in a single dimension
+     * Function to pre-compute the strides of the dependent data array in each dimension, and the
+     * offsets (in the storage of the dependent data) of the corners of a grid hyper-rectangle w.r.t.
+     * its lower corner, with bit i of the corner index denoting the upper data point in dimension i.
      */
-    DependentVariableType performRecursiveInterpolationStep(
-            const unsigned int currentVariable,
-            const std::vector< IndependentVariableType >& independentValuesToInterpolate,
-            boost::array< int, numberOfDimensions > currentArrayIndices,
-            const std::vector< int >& nearestLowerIndices )
+    void initializeCornerOffsets( )
     {
-        IndependentVariableType upperFraction, lowerFraction;
-        DependentVariableType upperContribution, lowerContribution;
-
-        // Calculate fractions of data points above and below independent
-        // variable value to be added to interpolated value.
-        upperFraction = ( independentValuesToInterpolate[ currentVariable ] -
-                          independentValues_[ currentVariable ]
-                          [ nearestLowerIndices[ currentVariable ] ] ) /
-                ( independentValues_[ currentVariable ]
-                  [ nearestLowerIndices[ currentVariable ] + 1 ] -
-                  independentValues_[ currentVariable ]
-                  [ nearestLowerIndices[ currentVariable ] ] );
-        lowerFraction = -( independentValuesToInterpolate[ currentVariable ] -
-                           independentValues_[ currentVariable ]
-                           [ nearestLowerIndices[ currentVariable ] + 1 ] ) /
-                ( independentValues_[ currentVariable ]
-                  [ nearestLowerIndices[ currentVariable ] + 1 ] -
-                  independentValues_[ currentVariable ]
-                  [ nearestLowerIndices[ currentVariable ] ] );
-
-        // If at top dimension, call dependent variable data.
-        if ( currentVariable == numberOfDimensions - 1 )
+        for( int i = 0; i < numberOfDimensions; i++ )
         {
-            currentArrayIndices[ numberOfDimensions - 1 ] = nearestLowerIndices[ currentVariable ];
-            lowerContribution = dependentData_( currentArrayIndices );
-            currentArrayIndices[ numberOfDimensions - 1 ] = nearestLowerIndices[ currentVariable ]
-                                                            + 1;
-            upperContribution = dependentData_( currentArrayIndices );
+            strides_[ i ] = static_cast< int >( dependentData_.strides( )[ i ] );
         }
 
-        // If at lower dimension, update currentArrayIndices and call function with
-        // currentVariable++.
-        else
+        for( int j = 0; j < numberOfCorners; j++ )
         {
-            currentArrayIndices[ currentVariable ] = nearestLowerIndices[ currentVariable ];
-            lowerContribution = performRecursiveInterpolationStep(
-                        currentVariable + 1, independentValuesToInterpolate,
-                        currentArrayIndices, nearestLowerIndices );
-            currentArrayIndices[ currentVariable ] = nearestLowerIndices[ currentVariable ] + 1;
-            upperContribution = performRecursiveInterpolationStep(
-                        currentVariable + 1, independentValuesToInterpolate,
-                        currentArrayIndices, nearestLowerIndices );
+            cornerOffsets_[ j ] = 0;
+            for( int i = 0; i < numberOfDimensions; i++ )
+            {
+                if( j & ( 1 << i ) )
+                {
+                    cornerOffsets_[ j ] += strides_[ i ];
+                }
+            }
         }
-
-        // Return interpolated value.
-        DependentVariableType returnValue = upperFraction * upperContribution +
-                                            lowerFraction * lowerContribution;
-        return returnValue;
     }
 
     //! Vector with pointers to look-up scheme.
@@ -314,6 +325,17 @@ private:
      * independent variable points.
      */
     boost::multi_array< DependentVariableType, numberOfDimensions > dependentData_;
+
+    //! Strides of dependent data array in each dimension.
+    boost::array< int, numberOfDimensions > strides_;
+
+    //! Offsets of the corners of a grid hyper-rectangle w.r.t. its lower corner.
+    /*!
+     * Offsets (in the storage of dependent data array) of the corners of a grid hyper-rectangle
+     * w.r.t. its lower corner, with bit i of the corner index denoting the upper data point in
+     * dimension i.
+     */
+    boost::array< int, numberOfCorners > cornerOffsets_;
 };
 
 } // namespace interpolators
@@ -0,0 +1,220 @@
+/*    Copyright (c) 2010-2016, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Press W.H., et al. Numerical Recipes in C++: The Art of Scientific Computing. Cambridge
+ *          University Press, February 2002.
+ */
+
+#ifndef TUDAT_MULTI_OUTPUT_CUBIC_SPLINE_INTERPOLATOR_H
+#define TUDAT_MULTI_OUTPUT_CUBIC_SPLINE_INTERPOLATOR_H
+
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/Interpolators/oneDimensionalInterpolator.h"
+
+namespace tudat
+{
+namespace interpolators
+{
+
+//! Cubic spline interpolator for several dependent variables tabulated on the same independent variable values.
+/*!
+ *  Cubic spline interpolator (natural boundary conditions, as CubicSplineInterpolator) for several scalar dependent
+ *  variables tabulated on the same independent variable values, e.g. atmospheric properties as a function of
+ *  altitude. All dependent variables are interpolated with a single lookup. The polynomial coefficients of each
+ *  interval are precomputed and stored contiguously (four columns per interval), so that all dependent variables are
+ *  obtained from a single matrix-vector product with the powers of the offset from the lower node of the interval.
+ *  \tparam IndependentVariableType Type of independent variables.
+ *  \tparam ScalarType Type of scalar dependent variables.
+ *  \tparam NumberOfOutputs Number of dependent variables.
+ */
+template< typename IndependentVariableType, typename ScalarType, int NumberOfOutputs >
+class MultiOutputCubicSplineInterpolator:
+        public OneDimensionalInterpolator< IndependentVariableType, Eigen::Matrix< ScalarType, NumberOfOutputs, 1 > >
+{
+public:
+
+    //! Typedef for vector of dependent variables.
+    typedef Eigen::Matrix< ScalarType, NumberOfOutputs, 1 > DependentVariableVector;
+
+    using OneDimensionalInterpolator< IndependentVariableType, DependentVariableVector >::dependentValues_;
+    using OneDimensionalInterpolator< IndependentVariableType, DependentVariableVector >::independentValues_;
+    using OneDimensionalInterpolator< IndependentVariableType, DependentVariableVector >::lookUpScheme_;
+    using OneDimensionalInterpolator< IndependentVariableType, DependentVariableVector >::interpolate;
+
+    //! Constructor taking separate vectors for each dependent variable.
+    /*!
+     *  Constructor taking separate vectors for each dependent variable.
+     *  \param independentValues Vector with the independent variable values, must be sorted in ascending order.
+     *  \param dependentValues Vector (of size NumberOfOutputs) with vectors of values of each dependent variable at
+     *  independentValues.
+     *  \param selectedLookupScheme Look-up scheme that is to be used when finding interval of requested independent
+     *  variable value.
+     */
+    MultiOutputCubicSplineInterpolator(
+            const std::vector< IndependentVariableType >& independentValues,
+            const std::vector< std::vector< ScalarType > >& dependentValues,
+            const AvailableLookupScheme selectedLookupScheme = huntingAlgorithm )
+    {
+        if( dependentValues.size( ) != NumberOfOutputs )
+        {
+            throw std::runtime_error( "Error: number of dependent variables of multi-output cubic spline interpolator "
+                                      "incompatible with template parameter." );
+        }
+
+        independentValues_ = independentValues;
+        dependentValues_.resize( independentValues.size( ) );
+        for( int i = 0; i < NumberOfOutputs; i++ )
+        {
+            if( dependentValues[ i ].size( ) != independentValues.size( ) )
+            {
+                throw std::runtime_error( "Error: independent and dependent variables not of same size in "
+                                          "multi-output cubic spline interpolator." );
+            }
+            for( unsigned int j = 0; j < independentValues.size( ); j++ )
+            {
+                dependentValues_[ j ]( i ) = dependentValues[ i ][ j ];
+            }
+        }
+
+        initialize( selectedLookupScheme );
+    }
+
+    //! Constructor taking a single map of independent and dependent variable values.
+    /*!
+     *  Constructor taking a single map of independent and dependent variable values.
+     *  \param dataMap Map with the independent variable values as keys and corresponding vectors of dependent variable
+     *  values as values.
+     *  \param selectedLookupScheme Look-up scheme that is to be used when finding interval of requested independent
+     *  variable value.
+     */
+    MultiOutputCubicSplineInterpolator(
+            const std::map< IndependentVariableType, DependentVariableVector >& dataMap,
+            const AvailableLookupScheme selectedLookupScheme = huntingAlgorithm )
+    {
+        for( typename std::map< IndependentVariableType, DependentVariableVector >::const_iterator
+             mapIterator = dataMap.begin( ); mapIterator != dataMap.end( ); mapIterator++ )
+        {
+            independentValues_.push_back( mapIterator->first );
+            dependentValues_.push_back( mapIterator->second );
+        }
+
+        initialize( selectedLookupScheme );
+    }
+
+    //! Destructor.
+    ~MultiOutputCubicSplineInterpolator( ){ }
+
+    //! Function interpolates dependent variable values at given independent variable value.
+    /*!
+     *  Function interpolates dependent variable values at given independent variable value.
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation is to take place.
+     *  \param cursor Cursor storing the state of the sequence of lookups (modified by function).
+     *  \return Interpolated values of all dependent variables.
+     */
+    DependentVariableVector interpolate( const IndependentVariableType targetIndependentVariableValue,
+                                         LookUpSchemeCursor& cursor ) const
+    {
+        const int lowerEntry = lookUpScheme_->findNearestLowerNeighbour( targetIndependentVariableValue, cursor );
+
+        // Evaluate polynomials of all dependent variables in a single product.
+        const ScalarType offset =
+                static_cast< ScalarType >( targetIndependentVariableValue - independentValues_[ lowerEntry ] );
+        Eigen::Matrix< ScalarType, 4, 1 > offsetPowers;
+        offsetPowers << 1.0, offset, offset * offset, offset * offset * offset;
+        return polynomialCoefficients_.template middleCols< 4 >( 4 * lowerEntry ) * offsetPowers;
+    }
+
+    //! Function to return the polynomial coefficients of all intervals.
+    /*!
+     *  Function to return the polynomial coefficients of all intervals, with columns 4i to 4i+3 containing the
+     *  coefficients of the zeroth to third power of the offset from the lower node of interval i.
+     *  \return Polynomial coefficients of all intervals.
+     */
+    Eigen::Matrix< ScalarType, NumberOfOutputs, Eigen::Dynamic > getPolynomialCoefficients( )
+    {
+        return polynomialCoefficients_;
+    }
+
+private:
+
+    //! Function to compute the polynomial coefficients of each interval, and create the lookup scheme.
+    /*!
+     *  Function to compute the second derivatives of the natural cubic splines at the nodes (Press et al., 2002),
+     *  from which the polynomial coefficients of each interval are computed, and to create the lookup scheme.
+     *  \param selectedLookupScheme Look-up scheme that is to be used when finding interval of requested independent
+     *  variable value.
+     */
+    void initialize( const AvailableLookupScheme selectedLookupScheme )
+    {
+        const int numberOfDataPoints = static_cast< int >( independentValues_.size( ) );
+        if( numberOfDataPoints < 2 )
+        {
+            throw std::runtime_error(
+                        "Error: at least two data points are required by multi-output cubic spline interpolator." );
+        }
+
+        // Compute second derivatives at nodes by solving tridiagonal system (forward sweep and back substitution),
+        // with zero second derivatives at end points.
+        std::vector< ScalarType > intervalSizes( numberOfDataPoints - 1 );
+        for( int i = 0; i < numberOfDataPoints - 1; i++ )
+        {
+            intervalSizes[ i ] = static_cast< ScalarType >( independentValues_[ i + 1 ] - independentValues_[ i ] );
+        }
+
+        std::vector< ScalarType > modifiedSuperDiagonal( numberOfDataPoints, 0.0 );
+        Eigen::Matrix< ScalarType, NumberOfOutputs, Eigen::Dynamic > secondDerivatives =
+                Eigen::Matrix< ScalarType, NumberOfOutputs, Eigen::Dynamic >::Zero(
+                    NumberOfOutputs, numberOfDataPoints );
+        for( int i = 1; i < numberOfDataPoints - 1; i++ )
+        {
+            const ScalarType modifiedDiagonal = 2.0 * ( intervalSizes[ i - 1 ] + intervalSizes[ i ] ) -
+                    intervalSizes[ i - 1 ] * modifiedSuperDiagonal[ i - 1 ];
+            modifiedSuperDiagonal[ i ] = intervalSizes[ i ] / modifiedDiagonal;
+            secondDerivatives.col( i ) =
+                    ( 6.0 * ( ( dependentValues_[ i + 1 ] - dependentValues_[ i ] ) / intervalSizes[ i ] -
+                              ( dependentValues_[ i ] - dependentValues_[ i - 1 ] ) / intervalSizes[ i - 1 ] ) -
+                      intervalSizes[ i - 1 ] * secondDerivatives.col( i - 1 ) ) / modifiedDiagonal;
+        }
+        for( int i = numberOfDataPoints - 3; i > 0; i-- )
+        {
+            secondDerivatives.col( i ) -= modifiedSuperDiagonal[ i ] * secondDerivatives.col( i + 1 );
+        }
+
+        // Compute polynomial coefficients of each interval.
+        polynomialCoefficients_.resize( NumberOfOutputs, 4 * ( numberOfDataPoints - 1 ) );
+        for( int i = 0; i < numberOfDataPoints - 1; i++ )
+        {
+            polynomialCoefficients_.col( 4 * i ) = dependentValues_[ i ];
+            polynomialCoefficients_.col( 4 * i + 1 ) =
+                    ( dependentValues_[ i + 1 ] - dependentValues_[ i ] ) / intervalSizes[ i ] -
+                    intervalSizes[ i ] * ( 2.0 * secondDerivatives.col( i ) + secondDerivatives.col( i + 1 ) ) / 6.0;
+            polynomialCoefficients_.col( 4 * i + 2 ) = secondDerivatives.col( i ) / 2.0;
+            polynomialCoefficients_.col( 4 * i + 3 ) =
+                    ( secondDerivatives.col( i + 1 ) - secondDerivatives.col( i ) ) / ( 6.0 * intervalSizes[ i ] );
+        }
+
+        this->makeLookupScheme( selectedLookupScheme );
+    }
+
+    //! Polynomial coefficients of all intervals (four columns per interval).
+    Eigen::Matrix< ScalarType, NumberOfOutputs, Eigen::Dynamic > polynomialCoefficients_;
+};
+
+} // namespace interpolators
+} // namespace tudat
+
+#endif // TUDAT_MULTI_OUTPUT_CUBIC_SPLINE_INTERPOLATOR_H
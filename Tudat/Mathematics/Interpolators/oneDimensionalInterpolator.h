@@ -35,9 +35,11 @@
 #ifndef TUDAT_ONE_DIMENSIONAL_INTERPOLATOR_H
 #define TUDAT_ONE_DIMENSIONAL_INTERPOLATOR_H
 
+#include <algorithm>
 #include <iostream>
 #include <vector>
 
+#include <boost/make_shared.hpp>
 #include <boost/shared_ptr.hpp>
 
 #include "Tudat/Mathematics/Interpolators/lookupScheme.h"
@@ -63,6 +65,14 @@ public:
 
     using Interpolator< IndependentVariableType, DependentVariableType >::interpolate;
 
+    //! Default constructor.
+    /*!
+     * Default constructor, sets the identifier by which the thread-local lookup cursors of the
+     * interpolator are retrieved.
+     */
+    OneDimensionalInterpolator( ):
+        cursorOwnerIdentifier_( generateLookUpSchemeCursorOwnerIdentifier( ) ) { }
+
     //! Destructor.
     /*!
      * Destructor.
@@ -95,13 +105,94 @@ public:
 
     //! Function to perform interpolation.
     /*!
-     * This function performs the interpolation
+     * This function performs the interpolation, using the lookup cursor of the calling thread for
+     * this interpolator. Since the interpolator is not modified by the interpolation, this function
+     * may be called concurrently from several threads.
+     * \param independentVariableValue Independent variable value at which the value of the
+     *          dependent variable is to be determined.
+     * \return Interpolated value of dependent variable.
+     */
+    virtual DependentVariableType
+            interpolate( const IndependentVariableType independentVariableValue )
+    {
+        return interpolate( independentVariableValue,
+                            getThreadLocalLookUpSchemeCursor( cursorOwnerIdentifier_ ) );
+    }
+
+    //! Function to perform interpolation, using a given lookup cursor.
+    /*!
+     * This function performs the interpolation, using (and updating) the state of a sequence of
+     * lookups stored in the given cursor. A cursor should not be used by several threads
+     * simultaneously.
      * \param independentVariableValue Independent variable value at which the value of the
      *          dependent variable is to be determined.
+     * \param cursor Cursor storing the state of the sequence of lookups (modified by function).
      * \return Interpolated value of dependent variable.
      */
     virtual DependentVariableType
-            interpolate( const IndependentVariableType independentVariableValue ) = 0;
+            interpolate( const IndependentVariableType independentVariableValue,
+                         LookUpSchemeCursor& cursor ) const = 0;
+
+    //! Function to perform interpolation, using a given lookup cursor, returning the result by reference.
+    /*!
+     * This function performs the interpolation, using (and updating) the state of a sequence of
+     * lookups stored in the given cursor, and returns the interpolated value by reference. By
+     * default, the interpolated value is assigned from the value returned by the function above.
+     * Derived classes may override this function to reuse the memory of the interpolated value, so
+     * that no memory is allocated if the same interpolated value is passed in subsequent calls
+     * (see e.g. MatrixLagrangeInterpolator).
+     * \param independentVariableValue Independent variable value at which the value of the
+     *          dependent variable is to be determined.
+     * \param interpolatedValue Interpolated value of dependent variable (returned by reference).
+     * \param cursor Cursor storing the state of the sequence of lookups (modified by function).
+     */
+    virtual void interpolate( const IndependentVariableType independentVariableValue,
+                              DependentVariableType& interpolatedValue,
+                              LookUpSchemeCursor& cursor ) const
+    {
+        interpolatedValue = interpolate( independentVariableValue, cursor );
+    }
+
+    //! Function to perform interpolation, returning the result by reference.
+    /*!
+     * This function performs the interpolation, using the lookup cursor of the calling thread for
+     * this interpolator, and returns the interpolated value by reference (see the overload with
+     * cursor argument).
+     * \param independentVariableValue Independent variable value at which the value of the
+     *          dependent variable is to be determined.
+     * \param interpolatedValue Interpolated value of dependent variable (returned by reference).
+     */
+    void interpolate( const IndependentVariableType independentVariableValue,
+                      DependentVariableType& interpolatedValue ) const
+    {
+        interpolate( independentVariableValue, interpolatedValue,
+                     getThreadLocalLookUpSchemeCursor( cursorOwnerIdentifier_ ) );
+    }
+
+    //! Function to perform interpolation at a list of independent variable values.
+    /*!
+     * This function performs the interpolation at a list of independent variable values, by
+     * calling the function that takes a single independent variable value for each entry. A
+     * single cursor is used for all values, so that for values sorted in ascending order the
+     * interval of each value is found from that of the previous value in a few comparisons (also if
+     * the interpolator uses a binary search).
+     * \param independentVariableValues Independent variable values at which the values of the
+     *          dependent variable are to be determined.
+     * \param interpolatedValues Interpolated values of dependent variable (returned by reference),
+     *          in the same order as independentVariableValues.
+     */
+    virtual void interpolateAtMultipleValues(
+            const std::vector< IndependentVariableType >& independentVariableValues,
+            std::vector< DependentVariableType >& interpolatedValues ) const
+    {
+        interpolatedValues.resize( independentVariableValues.size( ) );
+
+        LookUpSchemeCursor cursor;
+        for( unsigned int i = 0; i < independentVariableValues.size( ); i++ )
+        {
+            interpolatedValues[ i ] = interpolate( independentVariableValues[ i ], cursor );
+        }
+    }
 
     //! Function to return the number of independent variables of the interpolation.
     /*!
@@ -129,7 +220,7 @@ public:
      *  Function to return the ector with independent variables used by the interpolator.
      *  \return Independent variables used by the interpolator.
      */
-    std::vector< IndependentVariableType > getIndependentValues( )
+    virtual std::vector< IndependentVariableType > getIndependentValues( )
     {
         return independentValues_;
     }
@@ -139,7 +230,7 @@ public:
      *  Function to return the ector with dependent variables used by the interpolator.
      *  \return Dependent variables used by the interpolator.
      */
-    std::vector< DependentVariableType > getDependentValues( )
+    virtual std::vector< DependentVariableType > getDependentValues( )
     {
         return dependentValues_;
     }
@@ -151,33 +242,14 @@ protected:
      * This function creates the look-up scheme that is to be used in determining the interval of
      * the independent variable grid where the interpolation is to be performed. It takes the type
      * of lookup scheme as an enum and constructs the look-up scheme from the independentValues_
-     * that have been set previously.
+     * that have been set previously. If the independentValues_ are (nearly) uniformly spaced, a
+     * constant-time lookup scheme is used instead of a hunting or binary search scheme (see
+     * createLookupScheme).
      *  \param selectedScheme Type of look-up scheme that is to be used
      */
     void makeLookupScheme( const AvailableLookupScheme selectedScheme )
     {
-        // Find which type of scheme is used.
-        switch( selectedScheme )
-        {
-        case binarySearch:
-
-            // Create binary search look up scheme.
-            lookUpScheme_ = boost::shared_ptr< LookUpScheme< IndependentVariableType > >
-                    ( new BinarySearchLookupScheme< IndependentVariableType >
-                      ( independentValues_ ) );
-            break;
-
-        case huntingAlgorithm:
-
-            // Create hunting scheme, which uses an intial guess from previous look-ups.
-            lookUpScheme_ = boost::shared_ptr< LookUpScheme< IndependentVariableType > >
-                    ( new HuntingAlgorithmLookupScheme< IndependentVariableType >
-                      ( independentValues_ ) );
-            break;
-
-        default:
-            throw std::runtime_error( "Warning: lookup scheme not found when making scheme for 1-D interpolator" );
-        }
+        lookUpScheme_ = createLookupScheme( independentValues_, selectedScheme );
     }
 
     //! Pointer to look up scheme.
@@ -187,6 +259,12 @@ protected:
      */
     boost::shared_ptr< LookUpScheme< IndependentVariableType > > lookUpScheme_;
 
+    //! Identifier by which the thread-local lookup cursors of the interpolator are retrieved.
+    /*!
+     * Identifier by which the thread-local lookup cursors of the interpolator are retrieved.
+     */
+    unsigned long long cursorOwnerIdentifier_;
+
     //! Vector with dependent variables.
     /*!
      * Vector with dependent variables.
@@ -8,13 +8,19 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <map>
+#include <mutex>
+
 #include <boost/lambda/lambda.hpp>
 #include <boost/lexical_cast.hpp>
+#include <boost/weak_ptr.hpp>
 
 #if USE_CSPICE
 #include "Tudat/External/SpiceInterface/spiceEphemeris.h"
 #endif
 
+#include "Tudat/Astrodynamics/Ephemerides/chebyshevEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/jplBinaryEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/keplerEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/tabulatedEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/approximatePlanetPositions.h"
@@ -31,6 +37,54 @@ namespace simulation_setup
 
 using namespace ephemerides;
 
+//! Function to retrieve memory-mapped JPL DE binary ephemeris file, sharing a single mapping per file.
+/*!
+ *  Function to retrieve memory-mapped JPL DE binary ephemeris file. The file is mapped only once for as long as any
+ *  ephemeris created from it exists, so that the header is parsed only once when creating the ephemerides of
+ *  multiple bodies. The list of opened files is guarded by a mutex, so that this function may be called from
+ *  multiple threads.
+ *  \param fileName Name of JPL DE binary ephemeris file.
+ *  \return Memory-mapped JPL DE binary ephemeris file.
+ */
+JplBinaryEphemerisFilePointer getJplBinaryEphemerisFile( const std::string& fileName )
+{
+    static std::map< std::string, boost::weak_ptr< JplBinaryEphemerisFile > > openedEphemerisFiles;
+    static std::mutex openedEphemerisFilesMutex;
+
+    std::lock_guard< std::mutex > openedEphemerisFilesLock( openedEphemerisFilesMutex );
+    JplBinaryEphemerisFilePointer ephemerisFile = openedEphemerisFiles[ fileName ].lock( );
+    if( ephemerisFile == NULL )
+    {
+        ephemerisFile = boost::make_shared< JplBinaryEphemerisFile >( fileName );
+        openedEphemerisFiles[ fileName ] = ephemerisFile;
+    }
+    return ephemerisFile;
+}
+
+#if USE_CSPICE
+//! Function to retrieve the name under which the ephemeris of a body is retrieved from Spice.
+/*!
+ *  Function to retrieve the name under which the ephemeris of a body is retrieved from Spice. Since only the
+ *  barycenters of planetary systems are included in the standard DE ephemerides, 'Barycenter' is appended to the
+ *  names of planets with moons (with a warning).
+ *  \param bodyName Name of body for which the ephemeris is to be retrieved.
+ *  \return Name under which the ephemeris of the body is retrieved from Spice.
+ */
+std::string getSpiceEphemerisBodyName( const std::string& bodyName )
+{
+    std::string inputName = bodyName;
+    if( bodyName == "Mars" ||
+            bodyName == "Jupiter"  || bodyName == "Saturn" ||
+            bodyName == "Uranus" || bodyName == "Neptune" )
+    {
+        inputName += " Barycenter";
+        std::cerr<<"Warning, position of "<<bodyName<<" taken as barycenter of that body's "
+                <<"planetary system."<<std::endl;
+    }
+    return inputName;
+}
+#endif
+
 //! Function to create a ephemeris model.
 boost::shared_ptr< ephemerides::Ephemeris > createBodyEphemeris(
         const boost::shared_ptr< EphemerisSettings > ephemerisSettings,
@@ -81,16 +135,7 @@ boost::shared_ptr< ephemerides::Ephemeris > createBodyEphemeris(
         {
             // Since only the barycenters of planetary systems are included in the standard DE
             // ephemerides, append 'Barycenter' to body name.
-            std::string inputName;
-            inputName = bodyName;
-            if( bodyName == "Mars" ||
-                    bodyName == "Jupiter"  || bodyName == "Saturn" ||
-                    bodyName == "Uranus" || bodyName == "Neptune" )
-            {
-                inputName += " Barycenter";
-                std::cerr<<"Warning, position of "<<bodyName<<" taken as barycenter of that body's "
-                        <<"planetary system."<<std::endl;
-            }
+            std::string inputName = getSpiceEphemerisBodyName( bodyName );
 
             // Create corresponding ephemeris object.
             if( !interpolatedEphemerisSettings->getUseLongDoubleStates( ) )
@@ -102,7 +147,9 @@ boost::shared_ptr< ephemerides::Ephemeris > createBodyEphemeris(
                         interpolatedEphemerisSettings->getTimeStep( ),
                         interpolatedEphemerisSettings->getFrameOrigin( ),
                         interpolatedEphemerisSettings->getFrameOrientation( ),
-                        interpolatedEphemerisSettings->getInterpolatorSettings( ) );
+                        interpolatedEphemerisSettings->getInterpolatorSettings( ),
+                        interpolatedEphemerisSettings->getInterpolatorCacheDirectory( ),
+                        interpolatedEphemerisSettings->getAdaptiveTabulationSettings( ) );
             }
             else
             {
@@ -113,7 +160,9 @@ boost::shared_ptr< ephemerides::Ephemeris > createBodyEphemeris(
                         static_cast< long double >( interpolatedEphemerisSettings->getTimeStep( ) ),
                         interpolatedEphemerisSettings->getFrameOrigin( ),
                         interpolatedEphemerisSettings->getFrameOrientation( ),
-                        interpolatedEphemerisSettings->getInterpolatorSettings( ) );
+                        interpolatedEphemerisSettings->getInterpolatorSettings( ),
+                        interpolatedEphemerisSettings->getInterpolatorCacheDirectory( ),
+                        interpolatedEphemerisSettings->getAdaptiveTabulationSettings( ) );
             }
         }
         break;
@@ -237,6 +286,88 @@ boost::shared_ptr< ephemerides::Ephemeris > createBodyEphemeris(
         }
         break;
     }
+    case chebyshev_ephemeris:
+    {
+        // Check consistency of type and class.
+        boost::shared_ptr< ChebyshevEphemerisSettings > chebyshevEphemerisSettings =
+                boost::dynamic_pointer_cast< ChebyshevEphemerisSettings >( ephemerisSettings );
+        if( chebyshevEphemerisSettings == NULL )
+        {
+            throw std::runtime_error( "Error, expected Chebyshev ephemeris settings for " + bodyName );
+        }
+        else
+        {
+            // Determine state function to which Chebyshev polynomials are to be fitted.
+            boost::function< basic_mathematics::Vector6d( const double ) > stateFunction;
+            if( !chebyshevEphemerisSettings->getStateFunction( ).empty( ) )
+            {
+                stateFunction = chebyshevEphemerisSettings->getStateFunction( );
+            }
+            else if( chebyshevEphemerisSettings->getBodyStateHistory( ).size( ) > 0 )
+            {
+                boost::shared_ptr< Ephemeris > tabulatedEphemeris =
+                        boost::make_shared< TabulatedCartesianEphemeris< > >(
+                            boost::make_shared<
+                            interpolators::LagrangeInterpolator< double, basic_mathematics::Vector6d > >
+                            ( chebyshevEphemerisSettings->getBodyStateHistory( ), 6,
+                              interpolators::huntingAlgorithm,
+                              interpolators::lagrange_cubic_spline_boundary_interpolation ),
+                            chebyshevEphemerisSettings->getFrameOrigin( ),
+                            chebyshevEphemerisSettings->getFrameOrientation( ) );
+                stateFunction = boost::bind( &Ephemeris::getCartesianStateFromEphemeris, tabulatedEphemeris, _1,
+                                             basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+            }
+            else
+            {
+#if USE_CSPICE
+                stateFunction = boost::bind( &spice_interface::getBodyCartesianStateAtEpoch,
+                                             getSpiceEphemerisBodyName( bodyName ),
+                                             chebyshevEphemerisSettings->getFrameOrigin( ),
+                                             chebyshevEphemerisSettings->getFrameOrientation( ), "none", _1 );
+#else
+                throw std::runtime_error( "Error, Chebyshev ephemeris for " + bodyName + " requires Spice when no "
+                                          "state function or state history is provided." );
+#endif
+            }
+
+            // Create ephemeris
+            ephemeris = boost::make_shared< ChebyshevEphemeris >(
+                        stateFunction,
+                        chebyshevEphemerisSettings->getInitialTime( ),
+                        chebyshevEphemerisSettings->getFinalTime( ),
+                        chebyshevEphemerisSettings->getPositionTolerance( ),
+                        chebyshevEphemerisSettings->getFrameOrigin( ),
+                        chebyshevEphemerisSettings->getFrameOrientation( ),
+                        chebyshevEphemerisSettings->getPolynomialDegree( ),
+                        chebyshevEphemerisSettings->getMaximumNumberOfBisections( ) );
+        }
+        break;
+    }
+    case jpl_binary_ephemeris:
+    {
+        // Check consistency of type and class.
+        boost::shared_ptr< JplBinaryEphemerisSettings > jplEphemerisSettings =
+                boost::dynamic_pointer_cast< JplBinaryEphemerisSettings >( ephemerisSettings );
+        if( jplEphemerisSettings == NULL )
+        {
+            throw std::runtime_error( "Error, expected JPL binary ephemeris settings for " + bodyName );
+        }
+        else
+        {
+            JplBinaryEphemerisFilePointer ephemerisFile = jplEphemerisSettings->getEphemerisFile( );
+            if( ephemerisFile == NULL )
+            {
+                ephemerisFile = getJplBinaryEphemerisFile( jplEphemerisSettings->getEphemerisFileName( ) );
+            }
+
+            // Create ephemeris
+            ephemeris = boost::make_shared< JplBinaryEphemeris >(
+                        ephemerisFile, bodyName,
+                        jplEphemerisSettings->getFrameOrigin( ),
+                        jplEphemerisSettings->getFrameOrientation( ) );
+        }
+        break;
+    }
     default:
     {
         throw std::runtime_error(
@@ -14,13 +14,19 @@
 #include <string>
 #include <map>
 
+#include <boost/bind.hpp>
+#include <boost/function.hpp>
+#include <boost/lexical_cast.hpp>
 #include <boost/shared_ptr.hpp>
 
 #include "Tudat/InputOutput/matrixTextFileReader.h"
 #include "Tudat/Astrodynamics/Ephemerides/ephemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/tabulatedEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/approximatePlanetPositionsBase.h"
+#include "Tudat/Astrodynamics/Ephemerides/jplBinaryEphemeris.h"
+#include "Tudat/Mathematics/Interpolators/adaptiveTabulation.h"
 #include "Tudat/Mathematics/Interpolators/createInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/interpolatorSerialization.h"
 #include "Tudat/External/SpiceInterface/spiceInterface.h"
 
 namespace tudat
@@ -41,7 +47,9 @@ enum EphemerisType
     tabulated_ephemeris,
     interpolated_spice,
     constant_ephemeris,
-    kepler_ephemeris
+    kepler_ephemeris,
+    chebyshev_ephemeris,
+    jpl_binary_ephemeris
 };
 
 //! Class for providing settings for ephemeris model.
@@ -231,7 +239,7 @@ public:
         DirectSpiceEphemerisSettings( frameOrigin, frameOrientation, 0, 0, 0,
                                       interpolated_spice ),
         initialTime_( initialTime ), finalTime_( finalTime ), timeStep_( timeStep ),
-        interpolatorSettings_( interpolatorSettings ), useLongDoubleStates_( 0 ){ }
+        interpolatorSettings_( interpolatorSettings ), useLongDoubleStates_( 0 ), interpolatorCacheDirectory_( "" ){ }
 
     //! Function to return initial time from which interpolated data from Spice should be created.
     /*!
@@ -275,6 +283,53 @@ public:
         useLongDoubleStates_ = useLongDoubleStates;
     }
 
+    //! Function to return directory in which the state interpolator is cached.
+    /*!
+     *  Function to return directory in which the state interpolator is cached (empty if no cache is used).
+     *  \return Directory in which the state interpolator is cached.
+     */
+    std::string getInterpolatorCacheDirectory( )
+    {
+        return interpolatorCacheDirectory_;
+    }
+
+    //! Function to set directory in which the state interpolator is cached.
+    /*!
+     *  Function to set directory in which the state interpolator is cached. If set, the interpolator is read from a
+     *  binary file in this directory if it was created before with identical settings, so that Spice need not be
+     *  called (see interpolators::getCachedOneDimensionalInterpolator). The cache is identified by the body, frame,
+     *  time interval and interpolator settings only, so it must be cleared manually when the Spice kernels change.
+     *  \param interpolatorCacheDirectory Directory in which the state interpolator is cached (empty for no cache).
+     */
+    void setInterpolatorCacheDirectory( const std::string& interpolatorCacheDirectory )
+    {
+        interpolatorCacheDirectory_ = interpolatorCacheDirectory;
+    }
+
+    //! Function to return settings for adaptive tabulation of the Spice data.
+    /*!
+     *  Function to return settings for adaptive tabulation of the Spice data (NULL if a fixed time step is used).
+     *  \return Settings for adaptive tabulation of the Spice data.
+     */
+    boost::shared_ptr< interpolators::AdaptiveTabulationSettings > getAdaptiveTabulationSettings( )
+    {
+        return adaptiveTabulationSettings_;
+    }
+
+    //! Function to set settings for adaptive tabulation of the Spice data.
+    /*!
+     *  Function to set settings for adaptive tabulation of the Spice data. If set, the time step is used as the
+     *  initial time step, which is refined where needed to meet the error tolerance of the state interpolation (see
+     *  interpolators::tabulateFunctionAdaptively), instead of being used for the complete time interval.
+     *  \param adaptiveTabulationSettings Settings for adaptive tabulation of the Spice data (NULL for fixed time
+     *  step).
+     */
+    void setAdaptiveTabulationSettings(
+            const boost::shared_ptr< interpolators::AdaptiveTabulationSettings > adaptiveTabulationSettings )
+    {
+        adaptiveTabulationSettings_ = adaptiveTabulationSettings;
+    }
+
 private:
 
     //! Initial time from which interpolated data from Spice should be created.
@@ -290,6 +345,12 @@ private:
     boost::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings_;
 
     bool useLongDoubleStates_;
+
+    //! Directory in which the state interpolator is cached (empty if no cache is used).
+    std::string interpolatorCacheDirectory_;
+
+    //! Settings for adaptive tabulation of the Spice data (NULL if a fixed time step is used).
+    boost::shared_ptr< interpolators::AdaptiveTabulationSettings > adaptiveTabulationSettings_;
 };
 
 //! EphemerisSettings derived class for defining settings of an approximate ephemeris for major
@@ -559,8 +620,320 @@ private:
     bool useLongDoubleStates_;
 };
 
+//! EphemerisSettings derived class for defining settings of an ephemeris represented by piecewise Chebyshev
+//! polynomials.
+/*!
+ *  EphemerisSettings derived class for defining settings of an ephemeris represented by piecewise Chebyshev
+ *  polynomials (ChebyshevEphemeris class), which are fitted to a state history upon creation. The state history can
+ *  be taken from Spice (for the body for which the ephemeris is created), from a user-defined state function, or from
+ *  a tabulated state history (interpolated using a 6th order Lagrange interpolator). Compared to an ephemeris
+ *  interpolated from Spice, the (adaptively segmented) Chebyshev representation typically requires much fewer states
+ *  to be retrieved from Spice and much less memory, and provides a faster state evaluation.
+ */
+class ChebyshevEphemerisSettings: public EphemerisSettings
+{
+public:
+
+    //! Constructor for fitting to Spice ephemeris of body.
+    /*!
+     *  Constructor for fitting to Spice ephemeris of body for which ephemeris is created.
+     *  \param initialTime Start time of interval over which the ephemeris is to be fitted.
+     *  \param finalTime End time of interval over which the ephemeris is to be fitted.
+     *  \param positionTolerance Maximum allowed error in the position norm of the fit.
+     *  \param frameOrigin Name of body relative to which the ephemeris is to be calculated
+     *  (optional "SSB" by default).
+     *  \param frameOrientation Orientatioan of the reference frame in which the epehemeris is to be calculated
+     *  (optional, "ECLIPJ2000" by default).
+     *  \param polynomialDegree Degree of the Chebyshev polynomials in each segment (default 12).
+     *  \param maximumNumberOfBisections Maximum number of bisections of the fit interval (default 20).
+     */
+    ChebyshevEphemerisSettings( const double initialTime,
+                                const double finalTime,
+                                const double positionTolerance,
+                                const std::string frameOrigin = "SSB",
+                                const std::string frameOrientation = "ECLIPJ2000",
+                                const int polynomialDegree = 12,
+                                const int maximumNumberOfBisections = 20 ):
+        EphemerisSettings( chebyshev_ephemeris, frameOrigin, frameOrientation ),
+        initialTime_( initialTime ), finalTime_( finalTime ), positionTolerance_( positionTolerance ),
+        polynomialDegree_( polynomialDegree ), maximumNumberOfBisections_( maximumNumberOfBisections ){ }
+
+    //! Constructor for fitting to user-defined state function.
+    /*!
+     *  Constructor for fitting to user-defined state function.
+     *  \param stateFunction Function returning the state as a function of time that is to be fitted.
+     *  \param initialTime Start time of interval over which the ephemeris is to be fitted.
+     *  \param finalTime End time of interval over which the ephemeris is to be fitted.
+     *  \param positionTolerance Maximum allowed error in the position norm of the fit.
+     *  \param frameOrigin Name of body relative to which the ephemeris is to be calculated
+     *  (optional "SSB" by default).
+     *  \param frameOrientation Orientatioan of the reference frame in which the epehemeris is to be calculated
+     *  (optional, "ECLIPJ2000" by default).
+     *  \param polynomialDegree Degree of the Chebyshev polynomials in each segment (default 12).
+     *  \param maximumNumberOfBisections Maximum number of bisections of the fit interval (default 20).
+     */
+    ChebyshevEphemerisSettings( const boost::function< basic_mathematics::Vector6d( const double ) > stateFunction,
+                                const double initialTime,
+                                const double finalTime,
+                                const double positionTolerance,
+                                const std::string frameOrigin = "SSB",
+                                const std::string frameOrientation = "ECLIPJ2000",
+                                const int polynomialDegree = 12,
+                                const int maximumNumberOfBisections = 20 ):
+        EphemerisSettings( chebyshev_ephemeris, frameOrigin, frameOrientation ),
+        stateFunction_( stateFunction ),
+        initialTime_( initialTime ), finalTime_( finalTime ), positionTolerance_( positionTolerance ),
+        polynomialDegree_( polynomialDegree ), maximumNumberOfBisections_( maximumNumberOfBisections ){ }
+
+    //! Constructor for fitting to tabulated state history.
+    /*!
+     *  Constructor for fitting to tabulated state history, over the full time span of the state history.
+     *  \param bodyStateHistory Data map (time as key, Cartesian state as values) to which the ephemeris is to be fitted.
+     *  \param positionTolerance Maximum allowed error in the position norm of the fit.
+     *  \param frameOrigin Name of body relative to which the ephemeris is to be calculated
+     *  (optional "SSB" by default).
+     *  \param frameOrientation Orientatioan of the reference frame in which the epehemeris is to be calculated
+     *  (optional, "ECLIPJ2000" by default).
+     *  \param polynomialDegree Degree of the Chebyshev polynomials in each segment (default 12).
+     *  \param maximumNumberOfBisections Maximum number of bisections of the fit interval (default 20).
+     */
+    ChebyshevEphemerisSettings( const std::map< double, basic_mathematics::Vector6d >& bodyStateHistory,
+                                const double positionTolerance,
+                                const std::string frameOrigin = "SSB",
+                                const std::string frameOrientation = "ECLIPJ2000",
+                                const int polynomialDegree = 12,
+                                const int maximumNumberOfBisections = 20 ):
+        EphemerisSettings( chebyshev_ephemeris, frameOrigin, frameOrientation ),
+        bodyStateHistory_( bodyStateHistory ), positionTolerance_( positionTolerance ),
+        polynomialDegree_( polynomialDegree ), maximumNumberOfBisections_( maximumNumberOfBisections )
+    {
+        if( bodyStateHistory_.size( ) < 2 )
+        {
+            throw std::runtime_error( "Error when creating Chebyshev ephemeris settings, state history too short." );
+        }
+        initialTime_ = bodyStateHistory_.begin( )->first;
+        finalTime_ = bodyStateHistory_.rbegin( )->first;
+    }
+
+    //! Function returning user-defined state function to which the ephemeris is to be fitted.
+    /*!
+     *  Function returning user-defined state function to which the ephemeris is to be fitted (empty if not used).
+     *  \return User-defined state function to which the ephemeris is to be fitted.
+     */
+    boost::function< basic_mathematics::Vector6d( const double ) > getStateFunction( )
+    { return stateFunction_; }
+
+    //! Function returning tabulated state history to which the ephemeris is to be fitted.
+    /*!
+     *  Function returning tabulated state history to which the ephemeris is to be fitted (empty if not used).
+     *  \return Tabulated state history to which the ephemeris is to be fitted.
+     */
+    std::map< double, basic_mathematics::Vector6d > getBodyStateHistory( )
+    { return bodyStateHistory_; }
+
+    //! Function returning start time of interval over which the ephemeris is to be fitted.
+    /*!
+     *  Function returning start time of interval over which the ephemeris is to be fitted.
+     *  \return Start time of interval over which the ephemeris is to be fitted.
+     */
+    double getInitialTime( ){ return initialTime_; }
+
+    //! Function returning end time of interval over which the ephemeris is to be fitted.
+    /*!
+     *  Function returning end time of interval over which the ephemeris is to be fitted.
+     *  \return End time of interval over which the ephemeris is to be fitted.
+     */
+    double getFinalTime( ){ return finalTime_; }
+
+    //! Function returning maximum allowed error in the position norm of the fit.
+    /*!
+     *  Function returning maximum allowed error in the position norm of the fit.
+     *  \return Maximum allowed error in the position norm of the fit.
+     */
+    double getPositionTolerance( ){ return positionTolerance_; }
+
+    //! Function returning degree of the Chebyshev polynomials in each segment.
+    /*!
+     *  Function returning degree of the Chebyshev polynomials in each segment.
+     *  \return Degree of the Chebyshev polynomials in each segment.
+     */
+    int getPolynomialDegree( ){ return polynomialDegree_; }
+
+    //! Function returning maximum number of bisections of the fit interval.
+    /*!
+     *  Function returning maximum number of bisections of the fit interval.
+     *  \return Maximum number of bisections of the fit interval.
+     */
+    int getMaximumNumberOfBisections( ){ return maximumNumberOfBisections_; }
+
+private:
+
+    //! User-defined state function to which the ephemeris is to be fitted (empty if not used).
+    boost::function< basic_mathematics::Vector6d( const double ) > stateFunction_;
+
+    //! Tabulated state history to which the ephemeris is to be fitted (empty if not used).
+    std::map< double, basic_mathematics::Vector6d > bodyStateHistory_;
+
+    //! Start time of interval over which the ephemeris is to be fitted.
+    double initialTime_;
+
+    //! End time of interval over which the ephemeris is to be fitted.
+    double finalTime_;
+
+    //! Maximum allowed error in the position norm of the fit.
+    double positionTolerance_;
+
+    //! Degree of the Chebyshev polynomials in each segment.
+    int polynomialDegree_;
+
+    //! Maximum number of bisections of the fit interval.
+    int maximumNumberOfBisections_;
+};
+
+//! EphemerisSettings derived class for defining settings of an ephemeris read directly from a JPL DE binary file.
+/*!
+ *  EphemerisSettings derived class for defining settings of an ephemeris read directly from a JPL DE binary file
+ *  (e.g. DE430 or DE440), without using the Spice toolkit (see JplBinaryEphemeris). The resulting ephemeris can be
+ *  evaluated concurrently from multiple threads. Ephemerides created from settings with the same file name share a
+ *  single memory mapping of the file.
+ */
+class JplBinaryEphemerisSettings: public EphemerisSettings
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor.
+     *  \param ephemerisFileName Name of JPL DE binary ephemeris file.
+     *  \param frameOrigin Name of body relative to which the ephemeris is to be calculated
+     *  (optional "SSB" by default).
+     *  \param frameOrientation Orientatioan of the reference frame in which the epehemeris is to be calculated,
+     *  J2000 or ECLIPJ2000 (optional, "ECLIPJ2000" by default).
+     */
+    JplBinaryEphemerisSettings( const std::string& ephemerisFileName,
+                                const std::string frameOrigin = "SSB",
+                                const std::string frameOrientation = "ECLIPJ2000" ):
+        EphemerisSettings( jpl_binary_ephemeris, frameOrigin, frameOrientation ),
+        ephemerisFileName_( ephemerisFileName ){ }
+
+    //! Constructor with previously opened ephemeris file.
+    /*!
+     *  Constructor with previously opened ephemeris file.
+     *  \param ephemerisFile Memory-mapped JPL DE binary ephemeris file.
+     *  \param frameOrigin Name of body relative to which the ephemeris is to be calculated
+     *  (optional "SSB" by default).
+     *  \param frameOrientation Orientatioan of the reference frame in which the epehemeris is to be calculated,
+     *  J2000 or ECLIPJ2000 (optional, "ECLIPJ2000" by default).
+     */
+    JplBinaryEphemerisSettings( const ephemerides::JplBinaryEphemerisFilePointer ephemerisFile,
+                                const std::string frameOrigin = "SSB",
+                                const std::string frameOrientation = "ECLIPJ2000" ):
+        EphemerisSettings( jpl_binary_ephemeris, frameOrigin, frameOrientation ),
+        ephemerisFile_( ephemerisFile ){ }
+
+    //! Function returning name of JPL DE binary ephemeris file.
+    /*!
+     *  Function returning name of JPL DE binary ephemeris file (empty if opened file was provided).
+     *  \return Name of JPL DE binary ephemeris file.
+     */
+    std::string getEphemerisFileName( ){ return ephemerisFileName_; }
+
+    //! Function returning previously opened ephemeris file.
+    /*!
+     *  Function returning previously opened ephemeris file (NULL if file name was provided).
+     *  \return Previously opened ephemeris file.
+     */
+    ephemerides::JplBinaryEphemerisFilePointer getEphemerisFile( ){ return ephemerisFile_; }
+
+private:
+
+    //! Name of JPL DE binary ephemeris file.
+    std::string ephemerisFileName_;
+
+    //! Previously opened ephemeris file.
+    ephemerides::JplBinaryEphemerisFilePointer ephemerisFile_;
+};
+
 #if USE_CSPICE
 
+//! Function to retrieve the state of a body from Spice, for tabulation.
+/*!
+ *  Function to retrieve the state of a body from Spice (without aberration corrections), for tabulation.
+ * \param body Name of body for which ephemeris data is to be retrieved.
+ * \param observerName Name of body relative to which the ephemeris is to be calculated.
+ * \param referenceFrameName Orientatioan of the reference frame in which the epehemeris is to be
+ *          calculated.
+ * \param time Time at which state is to be retrieved.
+ * \return State of body from Spice.
+ */
+template< typename StateScalarType, typename TimeType >
+Eigen::Matrix< StateScalarType, 6, 1 > getBodyCartesianStateFromSpiceForTabulation(
+        const std::string& body,
+        const std::string& observerName,
+        const std::string& referenceFrameName,
+        const TimeType time )
+{
+    return spice_interface::getBodyCartesianStateAtEpoch(
+                body, observerName, referenceFrameName, "none", static_cast< double >( time ) ).
+            template cast< StateScalarType >( );
+}
+
+//! Function to create a state interpolator using data from Spice.
+/*!
+ *  Function to create a state interpolator using data from Spice, retrieved at a constant time step, or with time
+ *  steps selected adaptively to meet an interpolation error tolerance.
+ * \param body Name of body for which ephemeris data is to be retrieved.
+ * \param initialTime Initial time from which interpolated data from Spice should be created.
+ * \param endTime Final time from which interpolated data from Spice should be created.
+ * \param timeStep Time step with which interpolated data from Spice should be created.
+ * \param observerName Name of body relative to which the ephemeris is to be calculated.
+ * \param referenceFrameName Orientatioan of the reference frame in which the epehemeris is to be
+ *          calculated.
+ * \param interpolatorSettings Settings to be used for the state interpolation.
+ * \param adaptiveTabulationSettings Settings for adaptive tabulation, in which case timeStep is used as the initial
+ *          time step (NULL for tabulation at constant time step).
+ * \return State interpolator using data from Spice.
+ */
+template< typename StateScalarType, typename TimeType >
+boost::shared_ptr< interpolators::OneDimensionalInterpolator< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > > >
+createStateInterpolatorFromSpice(
+        const std::string& body,
+        const TimeType initialTime,
+        const TimeType endTime,
+        const TimeType timeStep,
+        const std::string& observerName,
+        const std::string& referenceFrameName,
+        const boost::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings,
+        const boost::shared_ptr< interpolators::AdaptiveTabulationSettings > adaptiveTabulationSettings =
+        boost::shared_ptr< interpolators::AdaptiveTabulationSettings >( ) )
+{
+    std::map< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > > timeHistoryOfState;
+
+    if( adaptiveTabulationSettings == NULL )
+    {
+        // Calculate state from spice at given time intervals and store in timeHistoryOfState.
+        TimeType currentTime = initialTime;
+        while( currentTime < endTime )
+        {
+            timeHistoryOfState[ currentTime ] = getBodyCartesianStateFromSpiceForTabulation< StateScalarType >(
+                        body, observerName, referenceFrameName, currentTime );
+            currentTime += timeStep;
+        }
+    }
+    else
+    {
+        // Calculate state from spice at adaptively selected times.
+        timeHistoryOfState =
+                interpolators::tabulateFunctionAdaptively< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > >(
+                    boost::bind( &getBodyCartesianStateFromSpiceForTabulation< StateScalarType, TimeType >,
+                                 body, observerName, referenceFrameName, _1 ),
+                    initialTime, endTime, timeStep, interpolatorSettings, adaptiveTabulationSettings );
+    }
+
+    // Create interpolator.
+    return interpolators::createOneDimensionalInterpolator( timeHistoryOfState, interpolatorSettings );
+}
+
 //! Function to create a tabulated ephemeris using data from Spice.
 /*!
  *  Function to create a tabulated ephemeris using data from Spice.
@@ -576,6 +949,14 @@ private:
  * \param observerName Name of body relative to which the ephemeris is to be calculated.
  * \param referenceFrameName Orientatioan of the reference frame in which the epehemeris is to be
  *          calculated.
+ * \param interpolatorSettings Settings to be used for the state interpolation.
+ * \param interpolatorCacheDirectory Directory in which the state interpolator is cached (empty for no cache). If
+ *          the interpolator was created before with identical settings, it is read from this directory instead of
+ *          being recreated from Spice. The settings with which the interpolator is identified include the file name,
+ *          size and modification time of all loaded Spice kernels, so that the cached interpolator is recreated
+ *          when the loaded kernels change.
+ * \param adaptiveTabulationSettings Settings for adaptive tabulation, in which case timeStep is used as the initial
+ *          time step (NULL for tabulation at constant time step).
  * \return Tabulated ephemeris using data from Spice.
  */
 template< typename StateScalarType = double, typename TimeType = double >
@@ -587,26 +968,46 @@ boost::shared_ptr< ephemerides::Ephemeris > createTabulatedEphemerisFromSpice(
         const std::string& observerName,
         const std::string& referenceFrameName,
         boost::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings =
-        boost::make_shared< interpolators::LagrangeInterpolatorSettings >( 8 ) )
+        boost::make_shared< interpolators::LagrangeInterpolatorSettings >( 8 ),
+        const std::string& interpolatorCacheDirectory = "",
+        const boost::shared_ptr< interpolators::AdaptiveTabulationSettings > adaptiveTabulationSettings =
+        boost::shared_ptr< interpolators::AdaptiveTabulationSettings >( ) )
 {
     using namespace interpolators;
 
-    std::map< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > > timeHistoryOfState;
+    typedef Eigen::Matrix< StateScalarType, 6, 1 > StateType;
+    boost::function< boost::shared_ptr< OneDimensionalInterpolator< TimeType, StateType > >( ) > createInterpolator =
+            boost::bind( &createStateInterpolatorFromSpice< StateScalarType, TimeType >, body, initialTime, endTime,
+                         timeStep, observerName, referenceFrameName, interpolatorSettings,
+                         adaptiveTabulationSettings );
 
-    // Calculate state from spice at given time intervals and store in timeHistoryOfState.
-    TimeType currentTime = initialTime;
-    while( currentTime < endTime )
+    // Create interpolator, or retrieve it from cache.
+    boost::shared_ptr< OneDimensionalInterpolator< TimeType, StateType > > interpolator;
+    if( interpolatorCacheDirectory == "" )
     {
-        timeHistoryOfState[ currentTime ] = spice_interface::getBodyCartesianStateAtEpoch(
-                    body, observerName, referenceFrameName, "none", static_cast< double >( currentTime ) ).
-                template cast< StateScalarType >( );
-        currentTime += timeStep;
+        interpolator = createInterpolator( );
+    }
+    else
+    {
+        std::string settingsKey =
+                "spice;body=" + body + ";observer=" + observerName + ";frame=" + referenceFrameName +
+                ";initialTime=" + boost::lexical_cast< std::string >( initialTime ) +
+                ";endTime=" + boost::lexical_cast< std::string >( endTime ) +
+                ";timeStep=" + boost::lexical_cast< std::string >( timeStep ) + ";" +
+                getInterpolatorSettingsKey( interpolatorSettings ) +
+                spice_interface::getLoadedSpiceKernelsIdentifier( );
+        if( adaptiveTabulationSettings != NULL )
+        {
+            settingsKey += "adaptive;relativeTolerance=" + boost::lexical_cast< std::string >(
+                        adaptiveTabulationSettings->getRelativeErrorTolerance( ) ) +
+                    ";absoluteTolerance=" + boost::lexical_cast< std::string >(
+                        adaptiveTabulationSettings->getAbsoluteErrorTolerance( ) ) +
+                    ";bisections=" + boost::lexical_cast< std::string >(
+                        adaptiveTabulationSettings->getMaximumNumberOfBisections( ) ) + ";";
+        }
+        interpolator = getCachedOneDimensionalInterpolator< TimeType, StateType >(
+                    interpolatorCacheDirectory, settingsKey, createInterpolator );
     }
-
-    // Create interpolator.
-    boost::shared_ptr< OneDimensionalInterpolator< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > > > interpolator =
-            interpolators::createOneDimensionalInterpolator(
-                timeHistoryOfState, interpolatorSettings );
 
     // Create ephemeris and return.
     return boost::make_shared< ephemerides::TabulatedCartesianEphemeris< StateScalarType, TimeType > >(
@@ -14,9 +14,12 @@
 #include <boost/multi_array.hpp>
 #include <boost/assign/list_of.hpp>
 
+#include <algorithm>
 #include <vector>
 
 #include "Tudat/Astrodynamics/Aerodynamics/aerodynamicGuidance.h"
+#include "Tudat/Mathematics/Interpolators/createInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/multiCubicSplineInterpolator.h"
 #include "Tudat/Mathematics/Interpolators/multiLinearInterpolator.h"
 #include "Tudat/Astrodynamics/Aerodynamics/flightConditions.h"
 #include "Tudat/Astrodynamics/Aerodynamics/customAerodynamicCoefficientInterface.h"
@@ -353,6 +356,9 @@ public:
      *  coefficients are positive along the positive axes of the body or aerodynamic frame
      *  (see areCoefficientsInAerodynamicFrame). Note that for (lift, drag, side force), the
      *  coefficients are typically defined in negative direction.
+     *  \param interpolationSettings Settings to be used for creating the multi-dimensional interpolator of data. Only
+     *  linear_interpolator (multi-linear interpolation) and cubic_spline_interpolator (tensor-product cubic spline
+     *  interpolation, continuous in its first and second derivatives) are supported.
      */
     TabulatedAerodynamicCoefficientSettings(
             const std::vector< std::vector< double > > independentVariables,
@@ -365,7 +371,9 @@ public:
             const std::vector< aerodynamics::AerodynamicCoefficientsIndependentVariables >
             independentVariableNames,
             const bool areCoefficientsInAerodynamicFrame = 1,
-            const bool areCoefficientsInNegativeAxisDirection = 1 ):
+            const bool areCoefficientsInNegativeAxisDirection = 1,
+            const boost::shared_ptr< interpolators::InterpolatorSettings > interpolationSettings =
+            boost::make_shared< interpolators::InterpolatorSettings >( interpolators::linear_interpolator ) ):
         AerodynamicCoefficientSettings(
             tabulated_coefficients, referenceLength, referenceArea,
             lateralReferenceLength, momentReferencePoint,
@@ -373,7 +381,8 @@ public:
             areCoefficientsInNegativeAxisDirection ),
         independentVariables_( independentVariables ),
         forceCoefficients_( forceCoefficients ),
-        momentCoefficients_( momentCoefficients ){ }
+        momentCoefficients_( momentCoefficients ),
+        interpolationSettings_( interpolationSettings ){ }
 
     //! Constructor, sets properties of aerodynamic force coefficients, zero moment coefficients.
     /*!
@@ -393,6 +402,9 @@ public:
      *  coefficients are positive along the positive axes of the body or aerodynamic frame
      *  (see areCoefficientsInAerodynamicFrame). Note that for (lift, drag, side force), the
      *  coefficients are typically defined in negative direction.
+     *  \param interpolationSettings Settings to be used for creating the multi-dimensional interpolator of data. Only
+     *  linear_interpolator (multi-linear interpolation) and cubic_spline_interpolator (tensor-product cubic spline
+     *  interpolation, continuous in its first and second derivatives) are supported.
      */
     TabulatedAerodynamicCoefficientSettings(
             const std::vector< std::vector< double > > independentVariables,
@@ -400,14 +412,17 @@ public:
             const double referenceArea,
             const std::vector< aerodynamics::AerodynamicCoefficientsIndependentVariables > independentVariableNames,
             const bool areCoefficientsInAerodynamicFrame = 1,
-            const bool areCoefficientsInNegativeAxisDirection = 1 ):
+            const bool areCoefficientsInNegativeAxisDirection = 1,
+            const boost::shared_ptr< interpolators::InterpolatorSettings > interpolationSettings =
+            boost::make_shared< interpolators::InterpolatorSettings >( interpolators::linear_interpolator ) ):
         AerodynamicCoefficientSettings(
             tabulated_coefficients, TUDAT_NAN, referenceArea,
             TUDAT_NAN, Eigen::Vector3d::Constant( TUDAT_NAN ),
             independentVariableNames, areCoefficientsInAerodynamicFrame,
             areCoefficientsInNegativeAxisDirection ),
         independentVariables_( independentVariables ),
-        forceCoefficients_( forceCoefficients ){ }
+        forceCoefficients_( forceCoefficients ),
+        interpolationSettings_( interpolationSettings ){ }
 
     ~TabulatedAerodynamicCoefficientSettings( ){ }
 
@@ -441,6 +456,16 @@ public:
         return momentCoefficients_;
     }
 
+    //! Function to return settings to be used for creating the multi-dimensional interpolator of data.
+    /*!
+     * Function to return settings to be used for creating the multi-dimensional interpolator of data.
+     * \return Settings to be used for creating the multi-dimensional interpolator of data.
+     */
+    boost::shared_ptr< interpolators::InterpolatorSettings > getInterpolationSettings( )
+    {
+        return interpolationSettings_;
+    }
+
 private:
 
     //! Values of indepependent variables at which the coefficients in the tables are defined.
@@ -455,6 +480,9 @@ private:
 
     //! Values of moment coefficients at independent variables defined  by independentVariables_.
     boost::multi_array< Eigen::Vector3d, NumberOfDimensions > momentCoefficients_;
+
+    //! Settings to be used for creating the multi-dimensional interpolator of data.
+    boost::shared_ptr< interpolators::InterpolatorSettings > interpolationSettings_;
 };
 
 //! Object for setting aerodynamic coefficients from a user-defined 1-dimensional table.
@@ -683,6 +711,8 @@ createConstantCoefficientAerodynamicCoefficientInterface(
  *  coefficients are positive along the positive axes of the body or aerodynamic frame
  *  (see areCoefficientsInAerodynamicFrame). Note that for (lift, drag, side force), the
  *  coefficients are typically defined in negative direction.
+ *  \param interpolationSettings Settings to be used for creating the multi-dimensional interpolator of data (only
+ *  linear_interpolator and cubic_spline_interpolator types are supported). If empty, multi-linear interpolation is used.
  *  \return Tabulated aerodynamic coefficient interface pointer.
  */
 template< int NumberOfDimensions >
@@ -698,7 +728,9 @@ createTabulatedCoefficientAerodynamicCoefficientInterface(
         const double lateralReferenceLength,
         const Eigen::Vector3d& momentReferencePoint,
         const bool areCoefficientsInAerodynamicFrame = 0,
-        const bool areCoefficientsInNegativeAxisDirection = 1 )
+        const bool areCoefficientsInNegativeAxisDirection = 1,
+        const boost::shared_ptr< interpolators::InterpolatorSettings > interpolationSettings =
+        boost::shared_ptr< interpolators::InterpolatorSettings >( ) )
 {
     // Check input consistency.
     if( independentVariables.size( ) != NumberOfDimensions )
@@ -712,26 +744,63 @@ createTabulatedCoefficientAerodynamicCoefficientInterface(
 
     }
 
-    // Create interpolators for coefficients.
-    boost::shared_ptr< interpolators::MultiLinearInterpolator
-            < double, Eigen::Vector3d, NumberOfDimensions > > forceInterpolator =
-            boost::make_shared< interpolators::MultiLinearInterpolator
-            < double, Eigen::Vector3d, NumberOfDimensions > >(
-                independentVariables, forceCoefficients );
-    boost::shared_ptr< interpolators::MultiLinearInterpolator
-            < double, Eigen::Vector3d, NumberOfDimensions > > momentInterpolator =
-            boost::make_shared< interpolators::MultiLinearInterpolator
-            < double, Eigen::Vector3d, NumberOfDimensions > >(
-                independentVariables, momentCoefficients );
+    const bool areMomentCoefficientsProvided = ( momentCoefficients.num_elements( ) > 0 );
+    if( areMomentCoefficientsProvided &&
+            !std::equal( forceCoefficients.shape( ), forceCoefficients.shape( ) + NumberOfDimensions,
+                         momentCoefficients.shape( ) ) )
+    {
+        throw std::runtime_error( "Error when creating tabulated aerodynamic coefficient interface, inconsistent force and moment coefficient dimensioning" );
+    }
+
+    // Combine force and moment coefficients, so that they are interpolated in a single pass, using the same weights
+    // (moment coefficients are zero if none are provided).
+    boost::multi_array< basic_mathematics::Vector6d, NumberOfDimensions > coefficients(
+                std::vector< std::size_t >( forceCoefficients.shape( ),
+                                            forceCoefficients.shape( ) + NumberOfDimensions ) );
+    for( std::size_t i = 0; i < coefficients.num_elements( ); i++ )
+    {
+        coefficients.data( )[ i ] << forceCoefficients.data( )[ i ],
+                ( areMomentCoefficientsProvided ? momentCoefficients.data( )[ i ] : Eigen::Vector3d::Zero( ) );
+    }
+
+    // Create interpolator for coefficients.
+    boost::function< basic_mathematics::Vector6d( const std::vector< double >& ) > coefficientFunction;
+    const interpolators::AvailableLookupScheme lookupScheme =
+            ( interpolationSettings == NULL ) ? interpolators::huntingAlgorithm :
+                                                interpolationSettings->getSelectedLookupScheme( );
+    if( interpolationSettings == NULL ||
+            interpolationSettings->getInterpolatorType( ) == interpolators::linear_interpolator )
+    {
+        boost::shared_ptr< interpolators::MultiLinearInterpolator
+                < double, basic_mathematics::Vector6d, NumberOfDimensions > > coefficientInterpolator =
+                boost::make_shared< interpolators::MultiLinearInterpolator
+                < double, basic_mathematics::Vector6d, NumberOfDimensions > >(
+                    independentVariables, coefficients, lookupScheme );
+        coefficientFunction = boost::bind( &interpolators::MultiLinearInterpolator
+                                           < double, basic_mathematics::Vector6d, NumberOfDimensions >::interpolateAtPoint,
+                                           coefficientInterpolator, _1 );
+    }
+    else if( interpolationSettings->getInterpolatorType( ) == interpolators::cubic_spline_interpolator )
+    {
+        boost::shared_ptr< interpolators::MultiCubicSplineInterpolator
+                < double, basic_mathematics::Vector6d, NumberOfDimensions > > coefficientInterpolator =
+                boost::make_shared< interpolators::MultiCubicSplineInterpolator
+                < double, basic_mathematics::Vector6d, NumberOfDimensions > >(
+                    independentVariables, coefficients, lookupScheme );
+        coefficientFunction = boost::bind( &interpolators::MultiCubicSplineInterpolator
+                                           < double, basic_mathematics::Vector6d, NumberOfDimensions >::interpolateAtPoint,
+                                           coefficientInterpolator, _1 );
+    }
+    else
+    {
+        throw std::runtime_error( "Error when creating tabulated aerodynamic coefficient interface, interpolator type " +
+                                  boost::lexical_cast< std::string >( interpolationSettings->getInterpolatorType( ) ) +
+                                  " not supported for multi-dimensional coefficients." );
+    }
 
     // Create aerodynamic coefficient interface.
     return  boost::make_shared< aerodynamics::CustomAerodynamicCoefficientInterface >(
-                boost::bind( &interpolators::MultiLinearInterpolator
-                             < double, Eigen::Vector3d, NumberOfDimensions >::interpolate,
-                             forceInterpolator, _1 ),
-                boost::bind( &interpolators::MultiLinearInterpolator
-                             < double, Eigen::Vector3d, NumberOfDimensions >::interpolate,
-                             momentInterpolator, _1 ),
+                coefficientFunction,
                 referenceLength, referenceArea, lateralReferenceLength, momentReferencePoint,
                 independentVariableNames,
                 areCoefficientsInAerodynamicFrame, areCoefficientsInNegativeAxisDirection );
@@ -789,7 +858,8 @@ createTabulatedCoefficientAerodynamicCoefficientInterface(
                     tabulatedCoefficientSettings->getReferenceLength( ),
                     tabulatedCoefficientSettings->getMomentReferencePoint( ),
                     tabulatedCoefficientSettings->getAreCoefficientsInAerodynamicFrame( ),
-                    tabulatedCoefficientSettings->getAreCoefficientsInNegativeAxisDirection( ) );
+                    tabulatedCoefficientSettings->getAreCoefficientsInNegativeAxisDirection( ),
+                    tabulatedCoefficientSettings->getInterpolationSettings( ) );
     }
 }
 
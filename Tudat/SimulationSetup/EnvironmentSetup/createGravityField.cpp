@@ -132,6 +132,145 @@ std::pair< double, double  > readGravityFieldFile(
     return std::make_pair( gravitationalParameter, referenceRadius );
 }
 
+//! Function to read a spherical harmonic gravity field file in the ICGEM format
+std::pair< double, double > readIcgemGravityFieldFile(
+        const std::string& fileName, const int maximumDegree, const int maximumOrder,
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd >& coefficients )
+{
+    // Attempt to open gravity file.
+    std::fstream stream( fileName.c_str( ), std::ios::in );
+    if( stream.fail( ) )
+    {
+        throw std::runtime_error( "ICGEM gravity field data file " + fileName + " could not be opened." );
+    }
+
+    // Declare variables for reading file.
+    std::vector< std::string > vectorOfIndividualStrings;
+    std::string line;
+    double gravitationalParameter = TUDAT_NAN;
+    double referenceRadius = TUDAT_NAN;
+
+    // Read header, up to end_of_head keyword.
+    bool isHeaderRead = false;
+    while( !isHeaderRead && std::getline( stream, line ) )
+    {
+        boost::algorithm::trim( line );
+        boost::algorithm::split( vectorOfIndividualStrings, line, boost::algorithm::is_any_of( "\t " ),
+                                 boost::algorithm::token_compress_on );
+        if( vectorOfIndividualStrings.at( 0 ) == "end_of_head" )
+        {
+            isHeaderRead = true;
+        }
+        else if( vectorOfIndividualStrings.size( ) > 1 )
+        {
+            // Numbers in ICGEM files may use Fortran-style exponents.
+            boost::algorithm::replace_all( vectorOfIndividualStrings.at( 1 ), "D", "E" );
+            boost::algorithm::replace_all( vectorOfIndividualStrings.at( 1 ), "d", "e" );
+            if( vectorOfIndividualStrings.at( 0 ) == "earth_gravity_constant" )
+            {
+                gravitationalParameter = boost::lexical_cast< double >( vectorOfIndividualStrings.at( 1 ) );
+            }
+            else if( vectorOfIndividualStrings.at( 0 ) == "radius" )
+            {
+                referenceRadius = boost::lexical_cast< double >( vectorOfIndividualStrings.at( 1 ) );
+            }
+            else if( vectorOfIndividualStrings.at( 0 ) == "norm" &&
+                     vectorOfIndividualStrings.at( 1 ) != "fully_normalized" )
+            {
+                throw std::runtime_error( "Error when reading ICGEM gravity field file " + fileName +
+                                          ", only fully normalized coefficients are supported." );
+            }
+        }
+    }
+
+    if( !isHeaderRead || ( gravitationalParameter != gravitationalParameter ) ||
+            ( referenceRadius != referenceRadius ) )
+    {
+        throw std::runtime_error( "Error when reading ICGEM gravity field file " + fileName +
+                                  ", no complete header found." );
+    }
+
+    // Read coefficients up to required maximum degree and order.
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumOrder + 1 );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumOrder + 1 );
+    int currentDegree, currentOrder;
+    while( std::getline( stream, line ) )
+    {
+        boost::algorithm::trim( line );
+        boost::algorithm::split( vectorOfIndividualStrings, line, boost::algorithm::is_any_of( "\t " ),
+                                 boost::algorithm::token_compress_on );
+        if( vectorOfIndividualStrings.at( 0 ) == "gfc" )
+        {
+            if( vectorOfIndividualStrings.size( ) < 5 )
+            {
+                throw std::runtime_error( "Error when reading ICGEM gravity field file " + fileName +
+                                          ", number of fields is " +
+                                          boost::lexical_cast< std::string >( vectorOfIndividualStrings.size( ) ) );
+            }
+
+            currentDegree = boost::lexical_cast< int >( vectorOfIndividualStrings[ 1 ] );
+            currentOrder = boost::lexical_cast< int >( vectorOfIndividualStrings[ 2 ] );
+            if( currentDegree <= maximumDegree && currentOrder <= maximumOrder )
+            {
+                boost::algorithm::replace_all( vectorOfIndividualStrings[ 3 ], "D", "E" );
+                boost::algorithm::replace_all( vectorOfIndividualStrings[ 4 ], "D", "E" );
+                cosineCoefficients( currentDegree, currentOrder ) =
+                        boost::lexical_cast< double >( vectorOfIndividualStrings[ 3 ] );
+                sineCoefficients( currentDegree, currentOrder ) =
+                        boost::lexical_cast< double >( vectorOfIndividualStrings[ 4 ] );
+            }
+        }
+    }
+
+    // Set cosine coefficient at (0,0) to 1.
+    cosineCoefficients( 0, 0 ) = 1.0;
+    coefficients = std::make_pair( cosineCoefficients, sineCoefficients );
+
+    return std::make_pair( gravitationalParameter, referenceRadius );
+}
+
+//! Function to convert a spherical harmonic gravity field text file to a binary file.
+void convertGravityFieldFileToBinary(
+        const std::string& textFileName, const std::string& binaryFileName,
+        const int maximumDegree, const int maximumOrder,
+        const GravityFieldFileFormat fileFormat,
+        const std::string& referenceFrame,
+        const int gravitationalParameterIndex, const int referenceRadiusIndex,
+        const double gravitationalParameter, const double referenceRadius )
+{
+    // Read text file.
+    std::pair< Eigen::MatrixXd, Eigen::MatrixXd > coefficients;
+    std::pair< double, double > referenceData;
+    switch( fileFormat )
+    {
+    case degree_order_coefficient_file:
+        referenceData = readGravityFieldFile( textFileName, maximumDegree, maximumOrder, coefficients,
+                                              gravitationalParameterIndex, referenceRadiusIndex );
+        if( !( gravitationalParameterIndex >= 0 ) )
+        {
+            referenceData = std::make_pair( gravitationalParameter, referenceRadius );
+        }
+        break;
+    case icgem_file:
+        referenceData = readIcgemGravityFieldFile( textFileName, maximumDegree, maximumOrder, coefficients );
+        break;
+    default:
+        throw std::runtime_error( "Error, did not recognize gravity field file format " +
+                                  boost::lexical_cast< std::string >( fileFormat ) );
+    }
+
+    if( ( referenceData.first != referenceData.first ) || ( referenceData.second != referenceData.second ) )
+    {
+        throw std::runtime_error( "Error when converting gravity field file " + textFileName +
+                                  ", gravitational parameter and reference radius not defined." );
+    }
+
+    // Write binary file.
+    gravitation::writeSphericalHarmonicsCoefficientsToBinaryFile(
+                binaryFileName, referenceData.first, referenceData.second,
+                coefficients.first, coefficients.second, referenceFrame );
+}
+
 //! Function to create a gravity field model.
 boost::shared_ptr< gravitation::GravityFieldModel > createGravityFieldModel(
         const boost::shared_ptr< GravityFieldSettings > gravityFieldSettings,
@@ -203,8 +342,17 @@ boost::shared_ptr< gravitation::GravityFieldModel > createGravityFieldModel(
         }
         else
         {
+            // Create time-independent field directly from mapped coefficients (if any), without copying them.
+            if( ( sphericalHarmonicFieldSettings->getMappedCoefficients( ) != NULL ) &&
+                    gravityFieldVariationSettings.size( ) == 0 &&
+                    sphericalHarmonicFieldSettings->getCreateTimeDependentField( ) == 0 )
+            {
+                gravityFieldModel = boost::make_shared< SphericalHarmonicsGravityField >(
+                            sphericalHarmonicFieldSettings->getMappedCoefficients( ),
+                            sphericalHarmonicFieldSettings->getAssociatedReferenceFrame( ) );
+            }
             // Check consistency of cosine and sine coefficients.
-            if( ( sphericalHarmonicFieldSettings->getCosineCoefficients( ).rows( ) !=
+            else if( ( sphericalHarmonicFieldSettings->getCosineCoefficients( ).rows( ) !=
                   sphericalHarmonicFieldSettings->getSineCoefficients( ).rows( ) ) ||
                     ( sphericalHarmonicFieldSettings->getCosineCoefficients( ).cols( ) !=
                       sphericalHarmonicFieldSettings->getSineCoefficients( ).cols( ) ) )
@@ -26,6 +26,7 @@
 
 #include "Tudat/SimulationSetup/EnvironmentSetup/body.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/createGravityFieldVariations.h"
+#include "Tudat/Astrodynamics/Gravitation/binarySphericalHarmonicsCoefficients.h"
 #include "Tudat/Astrodynamics/Gravitation/gravityFieldModel.h"
 #include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsGravityField.h"
 #include "Tudat/Astrodynamics/Gravitation/gravityFieldVariations.h"
@@ -139,6 +140,28 @@ public:
         createTimeDependentField_( 0 )
     {  }
 
+    //! Constructor, using coefficients from a memory-mapped binary file.
+    /*!
+     *  Constructor, using the gravitational parameter, reference radius and coefficients from a memory-mapped binary
+     *  file (see gravitation::MappedSphericalHarmonicsCoefficients). If no field variations are used, the created
+     *  gravity field uses the packed coefficients directly from the mapped file, without copying them as a whole.
+     *  \param mappedCoefficients Object providing the gravitational parameter, reference radius and coefficients
+     *  from a memory-mapped binary file.
+     *  \param associatedReferenceFrame Identifier for body-fixed reference frame to which the coefficients are
+     *  referred (if empty, the reference frame in the binary file is used).
+     */
+    SphericalHarmonicsGravityFieldSettings(
+            const gravitation::MappedSphericalHarmonicsCoefficientsPointer mappedCoefficients,
+            const std::string& associatedReferenceFrame = "" ):
+        GravityFieldSettings( spherical_harmonic ),
+        gravitationalParameter_( mappedCoefficients->getGravitationalParameter( ) ),
+        referenceRadius_( mappedCoefficients->getReferenceRadius( ) ),
+        associatedReferenceFrame_( associatedReferenceFrame.empty( ) ? mappedCoefficients->getReferenceFrame( ) :
+                                                                       associatedReferenceFrame ),
+        createTimeDependentField_( 0 ),
+        mappedCoefficients_( mappedCoefficients )
+    {  }
+
     //! Function to return gravitational parameter for gravity field.
     /*!
      *  Function to return gravitational parameter for gravity field.
@@ -155,17 +178,40 @@ public:
 
     //! Function to return cosine spherical harmonic coefficients (geodesy normalized).
     /*!
-     *  Function to return cosine spherical harmonic coefficients (geodesy normalized).
+     *  Function to return cosine spherical harmonic coefficients (geodesy normalized). Coefficients from a
+     *  memory-mapped binary file are copied to the cosineCoefficients_ member on the first call.
      *  \return Cosine spherical harmonic coefficients (geodesy normalized).
      */
-    Eigen::MatrixXd getCosineCoefficients( ){ return cosineCoefficients_; }
+    const Eigen::MatrixXd& getCosineCoefficients( )
+    {
+        if( mappedCoefficients_ != NULL && cosineCoefficients_.size( ) == 0 )
+        {
+            cosineCoefficients_ = mappedCoefficients_->getCosineCoefficients( );
+        }
+        return cosineCoefficients_;
+    }
 
     //! Function to return sine spherical harmonic coefficients (geodesy normalized).
     /*!
-     *  Function to return sine spherical harmonic coefficients (geodesy normalized).
+     *  Function to return sine spherical harmonic coefficients (geodesy normalized). Coefficients from a
+     *  memory-mapped binary file are copied to the sineCoefficients_ member on the first call.
      *  \return Sine spherical harmonic coefficients (geodesy normalized).
      */
-    Eigen::MatrixXd getSineCoefficients( ){ return sineCoefficients_; }
+    const Eigen::MatrixXd& getSineCoefficients( )
+    {
+        if( mappedCoefficients_ != NULL && sineCoefficients_.size( ) == 0 )
+        {
+            sineCoefficients_ = mappedCoefficients_->getSineCoefficients( );
+        }
+        return sineCoefficients_;
+    }
+
+    //! Function to return coefficients from memory-mapped binary file (NULL if coefficients are set directly).
+    /*!
+     *  Function to return coefficients from memory-mapped binary file (NULL if coefficients are set directly).
+     *  \return Coefficients from memory-mapped binary file.
+     */
+    gravitation::MappedSphericalHarmonicsCoefficientsPointer getMappedCoefficients( ){ return mappedCoefficients_; }
 
     //! Function to return identifier for body-fixed reference frame.
     /*!
@@ -202,6 +248,9 @@ private:
 
     bool createTimeDependentField_;
 
+    //! Coefficients from memory-mapped binary file (NULL if coefficients are set directly).
+    gravitation::MappedSphericalHarmonicsCoefficientsPointer mappedCoefficients_;
+
 };
 
 //! Function to read a spherical harmonic gravity field file
@@ -229,6 +278,60 @@ std::pair< double, double > readGravityFieldFile(
         std::pair< Eigen::MatrixXd, Eigen::MatrixXd >& coefficients,
         const int gravitationalParameterIndex = -1, const int referenceRadiusIndex = -1 );
 
+//! Function to read a spherical harmonic gravity field file in the ICGEM format
+/*!
+ *  Function to read a spherical harmonic gravity field file in the format of the International Centre for Global Earth
+ *  Models (ICGEM, .gfc files, in which e.g. EGM2008 is distributed), returns (by reference) cosine and sine
+ *  spherical harmonic coefficients. The gravitational parameter and reference radius are read from the
+ *  earth_gravity_constant and radius keywords in the file header (which is terminated by the end_of_head keyword).
+ *  Subsequently, all lines starting with the gfc keyword are parsed as: gfc, degree, order, cosine coefficient, sine
+ *  coefficient (any further columns are ignored). Only the static part of the field is read, time-variable terms are
+ *  not supported. All coefficients not defined in the file are set to zero (except C(0,0) which is always 1.0)
+ *  \param fileName Name of ICGEM gravity field file to be loaded.
+ *  \param maximumDegree Maximum degree of gravity field to be loaded.
+ *  \param maximumOrder Maximum order of gravity field to be loaded.
+ *  \param coefficients Spherical harmonics coefficients (first is cosine, second is sine).
+ *  \return Pair of gravitational parameter and reference radius.
+ */
+std::pair< double, double > readIcgemGravityFieldFile(
+        const std::string& fileName, const int maximumDegree, const int maximumOrder,
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd >& coefficients );
+
+//! Enum listing the text formats of spherical harmonic gravity field files that can be read.
+enum GravityFieldFileFormat
+{
+    //! Format read by readGravityFieldFile: degree, order, cosine coefficient, sine coefficient (e.g. PDS SHA files).
+    degree_order_coefficient_file,
+    //! Format read by readIcgemGravityFieldFile (ICGEM .gfc files).
+    icgem_file
+};
+
+//! Function to convert a spherical harmonic gravity field text file to a binary file.
+/*!
+ *  Function to convert a spherical harmonic gravity field text file to a binary file, which can be loaded
+ *  (without parsing or copying the coefficients) using gravitation::MappedSphericalHarmonicsCoefficients. For
+ *  a file in the degree_order_coefficient_file format, the gravitational parameter and reference radius are read from
+ *  the header if gravitationalParameterIndex and referenceRadiusIndex are provided (see readGravityFieldFile), and taken
+ *  from the gravitationalParameter and referenceRadius input otherwise.
+ *  \param textFileName Name of the gravity field text file that is to be converted.
+ *  \param binaryFileName Name of the binary file that is to be written.
+ *  \param maximumDegree Maximum degree of gravity field to be converted.
+ *  \param maximumOrder Maximum order of gravity field to be converted.
+ *  \param fileFormat Format of gravity field text file.
+ *  \param referenceFrame Identifier for body-fixed reference frame to which the coefficients are referred.
+ *  \param gravitationalParameterIndex Index of gravitational parameter in header of text file (if any).
+ *  \param referenceRadiusIndex Index of reference radius in header of text file (if any).
+ *  \param gravitationalParameter Gravitational parameter, used if it is not read from the text file.
+ *  \param referenceRadius Reference radius, used if it is not read from the text file.
+ */
+void convertGravityFieldFileToBinary(
+        const std::string& textFileName, const std::string& binaryFileName,
+        const int maximumDegree, const int maximumOrder,
+        const GravityFieldFileFormat fileFormat = degree_order_coefficient_file,
+        const std::string& referenceFrame = "",
+        const int gravitationalParameterIndex = -1, const int referenceRadiusIndex = -1,
+        const double gravitationalParameter = TUDAT_NAN, const double referenceRadius = TUDAT_NAN );
+
 //! Function to create a gravity field model.
 /*!
  *  Function to create a gravity field model based on model-specific settings for the gravity field.
@@ -12,6 +12,7 @@
 
 #include "Tudat/Astrodynamics/Gravitation/gravityFieldVariations.h"
 #include "Tudat/Astrodynamics/Gravitation/basicSolidBodyTideGravityFieldVariations.h"
+#include "Tudat/Astrodynamics/Gravitation/fastSolidBodyTideGravityFieldVariations.h"
 #include "Tudat/Astrodynamics/Gravitation/tabulatedGravityFieldVariations.h"
 #include "Tudat/Astrodynamics/Gravitation/timeDependentSphericalHarmonicsGravityField.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/createGravityFieldVariations.h"
@@ -117,6 +118,22 @@ boost::shared_ptr< gravitation::GravityFieldVariations > createGravityFieldVaria
         }
         else
         {
+            // Check if efficient model is requested.
+            boost::shared_ptr< FastSolidBodyGravityFieldVariationSettings > fastSolidBodyGravityVariationSettings =
+                    boost::dynamic_pointer_cast< FastSolidBodyGravityFieldVariationSettings >(
+                        gravityFieldVariationSettings );
+
+            // Check whether states are to be retrieved from ephemerides, i.e. if variations are not evaluated at
+            // current time only.
+            bool useEphemerides = ( gravityFieldVariationSettings->getInterpolatorSettings( ) != NULL );
+            if( fastSolidBodyGravityVariationSettings != NULL )
+            {
+                if( fastSolidBodyGravityVariationSettings->getTideUpdateInterval( ) > 0.0 )
+                {
+                    useEphemerides = true;
+                }
+            }
+
             // Define list of required input.
             std::vector< std::string > deformingBodies
                     = basicSolidBodyGravityVariationSettings->getDeformingBodies( );
@@ -138,7 +155,7 @@ boost::shared_ptr< gravitation::GravityFieldVariations > createGravityFieldVaria
                 
                 // Create body state functions (depending on whether the variation is calculated
                 // directly during propagation, or a priori by an interpolator
-                if( gravityFieldVariationSettings->getInterpolatorSettings( ) != NULL )
+                if( useEphemerides )
                 {
                     deformingBodyStateFunctions.push_back(
                                 boost::bind(
@@ -168,7 +185,7 @@ boost::shared_ptr< gravitation::GravityFieldVariations > createGravityFieldVaria
             }
 
             // Set state and orientation functions of perturbed body.
-            if( gravityFieldVariationSettings->getInterpolatorSettings( ) != NULL )
+            if( useEphemerides )
             {
                 deformedBodyStateFunction = boost::bind( &Body::getStateInBaseFrameFromEphemeris,
                                                          bodyMap.at( body ), _1 );
@@ -191,16 +208,33 @@ boost::shared_ptr< gravitation::GravityFieldVariations > createGravityFieldVaria
                                  bodyMap.at( body )->getGravityFieldModel( ) );
             
             // Create basic tidal variation object.
-            gravityFieldVariationModel
-                    = boost::make_shared< BasicSolidBodyTideGravityFieldVariations >(
-                        deformedBodyStateFunction,
-                        deformedBodyOrientationFunction,
-                        deformingBodyStateFunctions,
-                        basicSolidBodyGravityVariationSettings->getBodyReferenceRadius( ),
-                        gravitionalParameterOfDeformedBody,
-                        gravitionalParametersOfDeformingBodies,
-                        basicSolidBodyGravityVariationSettings->getLoveNumbers( ),
-                        deformingBodies );
+            if( fastSolidBodyGravityVariationSettings != NULL )
+            {
+                gravityFieldVariationModel
+                        = boost::make_shared< FastSolidBodyTideGravityFieldVariations >(
+                            deformedBodyStateFunction,
+                            deformedBodyOrientationFunction,
+                            deformingBodyStateFunctions,
+                            basicSolidBodyGravityVariationSettings->getBodyReferenceRadius( ),
+                            gravitionalParameterOfDeformedBody,
+                            gravitionalParametersOfDeformingBodies,
+                            basicSolidBodyGravityVariationSettings->getLoveNumbers( ),
+                            deformingBodies,
+                            fastSolidBodyGravityVariationSettings->getTideUpdateInterval( ) );
+            }
+            else
+            {
+                gravityFieldVariationModel
+                        = boost::make_shared< BasicSolidBodyTideGravityFieldVariations >(
+                            deformedBodyStateFunction,
+                            deformedBodyOrientationFunction,
+                            deformingBodyStateFunctions,
+                            basicSolidBodyGravityVariationSettings->getBodyReferenceRadius( ),
+                            gravitionalParameterOfDeformedBody,
+                            gravitionalParametersOfDeformingBodies,
+                            basicSolidBodyGravityVariationSettings->getLoveNumbers( ),
+                            deformingBodies );
+            }
         }
         break;
     }    
@@ -197,6 +197,58 @@ protected:
 
 };
 
+//! Class to define settings for basic degree 2 and 3 tidal gravity field variations, using the efficient
+//! FastSolidBodyTideGravityFieldVariations model.
+/*!
+ * Class to define settings for basic degree 2 and 3 tidal gravity field variations, using the efficient
+ * FastSolidBodyTideGravityFieldVariations model, which computes the same variations as the
+ * BasicSolidBodyTideGravityFieldVariations model (created using BasicSolidBodyGravityFieldVariationSettings). Optionally,
+ * the tide may be evaluated at a coarser cadence during propagation, and interpolated in between, in which case the states
+ * of the bodies involved are retrieved from their ephemerides.
+ */
+class FastSolidBodyGravityFieldVariationSettings: public BasicSolidBodyGravityFieldVariationSettings
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param deformingBodies List of bodies causing tidal deformation
+     * \param loveNumbers List of Love number for the deformed body. First vector level denotes
+     *  degree (index 0 = degree 2), second vector level denotes order. Maximum degree must be 2 or 3.
+     * \param bodyReferenceRadius Reference (typically equatorial) radius of body being deformed
+     * \param tideUpdateInterval Interval between subsequent evaluations of the tide during propagation, between which the
+     * tide is interpolated. If zero (default), the tide is evaluated directly at each time.
+     * \param interpolatorSettings Settings that are to be used to create an interpolator for the
+     * gravity field variations immediately upon creation (to be used during propagation). Default
+     * is NULL, in which no interpolation is used, and the model is evaluated during propagation.
+     */
+    FastSolidBodyGravityFieldVariationSettings(
+            const std::vector< std::string > deformingBodies,
+            const std::vector< std::vector< std::complex< double > > > loveNumbers,
+            const double bodyReferenceRadius,
+            const double tideUpdateInterval = 0.0,
+            const boost::shared_ptr< ModelInterpolationSettings > interpolatorSettings = NULL ):
+        BasicSolidBodyGravityFieldVariationSettings(
+            deformingBodies, loveNumbers, bodyReferenceRadius, interpolatorSettings ),
+        tideUpdateInterval_( tideUpdateInterval ){ }
+
+    virtual ~FastSolidBodyGravityFieldVariationSettings( ){ }
+
+    //! Function to retrieve interval between subsequent evaluations of the tide during propagation.
+    /*!
+     * \brief Function to retrieve interval between subsequent evaluations of the tide during propagation.
+     * \return Interval between subsequent evaluations of the tide during propagation (zero if evaluated at each time).
+     */
+    double getTideUpdateInterval( ){ return tideUpdateInterval_; }
+
+protected:
+
+    //! Interval between subsequent evaluations of the tide during propagation (zero if evaluated at each time).
+    double tideUpdateInterval_;
+
+};
+
 //! Class to define settings for tabulated gravity field variations.
 class TabulatedGravityFieldVariationSettings: public GravityFieldVariationSettings
 {
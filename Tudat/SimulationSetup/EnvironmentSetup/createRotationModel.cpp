@@ -11,6 +11,8 @@
 #include <boost/make_shared.hpp>
 #include <boost/lexical_cast.hpp>
 
+#include "Tudat/Astrodynamics/Ephemerides/earthRotationalEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/iauRotationalEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/simpleRotationalEphemeris.h"
 #if USE_CSPICE
 #include "Tudat/External/SpiceInterface/spiceRotationalEphemeris.h"
@@ -59,6 +61,41 @@ boost::shared_ptr< ephemerides::RotationalEphemeris > createRotationModel(
         }
         break;
     }
+    case iau_rotation_model:
+    {
+        // Create rotational ephemeris from IAU rotation elements of body.
+        rotationalEphemeris = createIauRotationalEphemeris(
+                    body, rotationModelSettings->getOriginalFrame( ),
+                    rotationModelSettings->getTargetFrame( ) );
+        break;
+    }
+    case earth_rotation_model:
+    {
+        // Check whether settings for Earth rotation model are consistent with its type.
+        boost::shared_ptr< EarthRotationModelSettings > earthRotationSettings =
+                boost::dynamic_pointer_cast< EarthRotationModelSettings >( rotationModelSettings );
+        if( earthRotationSettings == NULL )
+        {
+            throw std::runtime_error(
+                        "Error, expected Earth rotation model settings for " + body );
+        }
+        else
+        {
+            // Read Earth orientation parameters, if provided, and create Earth rotation model.
+            boost::shared_ptr< EarthOrientationParameters > earthOrientationParameters;
+            if( earthRotationSettings->getEarthOrientationParametersFile( ) != "" )
+            {
+                earthOrientationParameters = readEarthOrientationParametersFromFile(
+                            earthRotationSettings->getEarthOrientationParametersFile( ) );
+            }
+            rotationalEphemeris = boost::make_shared< EarthRotationalEphemeris >(
+                        earthOrientationParameters,
+                        earthRotationSettings->getPrecessionNutationUpdateInterval( ),
+                        earthRotationSettings->getOriginalFrame( ),
+                        earthRotationSettings->getTargetFrame( ) );
+        }
+        break;
+    }
     #if USE_CSPICE
     case spice_rotation_model:
     {
@@ -34,7 +34,9 @@ namespace simulation_setup
 enum RotationModelType
 {
     simple_rotation_model,
-    spice_rotation_model
+    spice_rotation_model,
+    iau_rotation_model,
+    earth_rotation_model
 };
 
 //! Class for providing settings for rotation model.
@@ -166,6 +168,51 @@ private:
     double rotationRate_;
 };
 
+//! RotationModelSettings derived class for defining settings of the high-precision Earth rotation model.
+class EarthRotationModelSettings: public RotationModelSettings
+{
+public:
+    //! Constructor,
+    /*!
+     *  Constructor, sets Earth rotation model properties.
+     *  \param earthOrientationParametersFile Path of file from which Earth orientation parameters are to be read (see
+     *  ephemerides::readEarthOrientationParametersFromFile). If empty, no Earth orientation parameters are used.
+     *  \param precessionNutationUpdateInterval Time interval at which the precession-nutation model is evaluated
+     *  (and in between which its results are interpolated), zero or negative for direct evaluation.
+     *  \param originalFrame Base frame of rotation model (J2000 or ECLIPJ2000).
+     *  \param targetFrame Target frame of rotation model.
+     */
+    EarthRotationModelSettings( const std::string& earthOrientationParametersFile = "",
+                                const double precessionNutationUpdateInterval = 3600.0,
+                                const std::string& originalFrame = "J2000",
+                                const std::string& targetFrame = "ITRS" ):
+        RotationModelSettings( earth_rotation_model, originalFrame, targetFrame ),
+        earthOrientationParametersFile_( earthOrientationParametersFile ),
+        precessionNutationUpdateInterval_( precessionNutationUpdateInterval ){ }
+
+    //! Function to return path of file from which Earth orientation parameters are to be read.
+    /*!
+     *  Function to return path of file from which Earth orientation parameters are to be read.
+     *  \return Path of file from which Earth orientation parameters are to be read.
+     */
+    std::string getEarthOrientationParametersFile( ){ return earthOrientationParametersFile_; }
+
+    //! Function to return time interval at which the precession-nutation model is evaluated.
+    /*!
+     *  Function to return time interval at which the precession-nutation model is evaluated.
+     *  \return Time interval at which the precession-nutation model is evaluated.
+     */
+    double getPrecessionNutationUpdateInterval( ){ return precessionNutationUpdateInterval_; }
+
+private:
+
+    //! Path of file from which Earth orientation parameters are to be read.
+    std::string earthOrientationParametersFile_;
+
+    //! Time interval at which the precession-nutation model is evaluated.
+    double precessionNutationUpdateInterval_;
+};
+
 //! Function to create a rotation model.
 /*!
  *  Function to create a rotation model based on model-specific settings for the rotation.
@@ -203,6 +203,14 @@ boost::shared_ptr< acceleration_partials::AccelerationPartial > createAnalytical
         }
         break;
     }
+    case multiple_third_body_central_gravity:
+
+        // Partials of combined third-body acceleration are not implemented; reject explicitly.
+        throw std::runtime_error(
+                "Error when making acceleration partial of acceleration on " + acceleratedBody.first +
+                ", partials of combined third-body point-mass acceleration (multiple_third_body_central_gravity) are "
+                "not supported; use a separate central_gravity acceleration for each perturbing body instead." );
+        break;
     default:
         std::string errorMessage = "Acceleration model " + boost::lexical_cast< std::string >( accelerationType ) +
                 " not found when making acceleration partial";
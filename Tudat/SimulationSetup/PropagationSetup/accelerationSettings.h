@@ -72,17 +72,31 @@ public:
      *  Constructor to set maximum degree and order that is to be taken into account.
      *  \param maximumDegree Maximum degree
      *  \param maximumOrder Maximum order
+     *  \param truncationTolerance Tolerance for adaptive truncation of the expansion: degrees n for which (R/r)^n is
+     *  below this value are omitted at each evaluation (see gravitation::computeAdaptiveTruncationDegree). If zero
+     *  (default), the expansion is always evaluated up to maximumDegree.
+     *  \param truncationHysteresisFactor Hysteresis factor for adaptive truncation: a degree is only omitted again once
+     *  (R/r)^n is below truncationTolerance divided by this factor.
      */
     SphericalHarmonicAccelerationSettings( const int maximumDegree,
-                                           const int maximumOrder ):
+                                           const int maximumOrder,
+                                           const double truncationTolerance = 0.0,
+                                           const double truncationHysteresisFactor = 10.0 ):
         AccelerationSettings( basic_astrodynamics::spherical_harmonic_gravity ),
-        maximumDegree_( maximumDegree ), maximumOrder_( maximumOrder ){ }
+        maximumDegree_( maximumDegree ), maximumOrder_( maximumOrder ),
+        truncationTolerance_( truncationTolerance ), truncationHysteresisFactor_( truncationHysteresisFactor ){ }
 
     //! Maximum degree that is to be used for spherical harmonic acceleration
     int maximumDegree_;
 
     //! Maximum order that is to be used for spherical harmonic acceleration
     int maximumOrder_;
+
+    //! Tolerance for adaptive truncation of the expansion (zero if no adaptive truncation is used).
+    double truncationTolerance_;
+
+    //! Hysteresis factor for adaptive truncation of the expansion.
+    double truncationHysteresisFactor_;
 };
 
 //! Class for providing acceleration settings for mutual spherical harmonics acceleration model.
@@ -137,6 +151,33 @@ public:
     int maximumOrderOfCentralBody_;
 };
 
+//! Class for providing settings for a combined point-mass third-body acceleration of multiple perturbing bodies.
+/*!
+ *  Class for providing settings for a combined point-mass third-body acceleration of multiple perturbing bodies
+ *  (MultipleThirdBodyCentralGravityAcceleration), replacing a separate central_gravity setting for each perturbing
+ *  body. Since the perturbing bodies are defined by this class, the name of the body exerting the acceleration in the
+ *  SelectedAccelerationMap is only used for bookkeeping; typically, the central body of the propagation is used.
+ *  No acceleration partials are available for this acceleration, so that it can not be used when propagating
+ *  variational equations or estimating parameters.
+ */
+class MultipleThirdBodyAccelerationSettings: public AccelerationSettings
+{
+public:
+
+    //! Constructor to set the perturbing bodies.
+    /*!
+     * Constructor to set the perturbing bodies.
+     * \param perturbingBodies Names of the bodies exerting the third-body acceleration (may not include the body
+     * undergoing the acceleration or the central body).
+     */
+    MultipleThirdBodyAccelerationSettings( const std::vector< std::string >& perturbingBodies ):
+        AccelerationSettings( basic_astrodynamics::multiple_third_body_central_gravity ),
+        perturbingBodies_( perturbingBodies ){ }
+
+    //! Names of the bodies exerting the third-body acceleration.
+    std::vector< std::string > perturbingBodies_;
+};
+
 //! Interface class that allows single interpolator to be used for thrust direction and magnitude (which are separated in
 //! thrust implementation)
 class FullThrustInterpolationInterface
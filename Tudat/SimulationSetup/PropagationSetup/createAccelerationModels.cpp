@@ -359,6 +359,14 @@ createSphericalHarmonicsGravityAcceleration(
                       boost::bind( &Body::getPosition, bodyExertingAcceleration ),
                       boost::bind( &Body::getCurrentRotationToGlobalFrame,
                                    bodyExertingAcceleration ), useCentralBodyFixedFrame );
+
+            // Set adaptive truncation of expansion, if requested.
+            if( sphericalHarmonicsSettings->truncationTolerance_ > 0.0 )
+            {
+                accelerationModel->setAdaptiveTruncation(
+                            sphericalHarmonicsSettings->truncationTolerance_,
+                            sphericalHarmonicsSettings->truncationHysteresisFactor_ );
+            }
         }
     }
     return accelerationModel;
@@ -866,6 +874,99 @@ createThrustAcceleratioModel(
                 updateFunction, timeResetFunction, totalUpdateSettings );
 }
 
+//! Function to retrieve the current positions of a list of bodies into a single matrix.
+void getPositionsOfBodies( const std::vector< boost::shared_ptr< Body > >& bodies, Eigen::Matrix3Xd& positions )
+{
+    for( unsigned int i = 0; i < bodies.size( ); i++ )
+    {
+        positions.col( i ) = bodies[ i ]->getPosition( );
+    }
+}
+
+//! Function to retrieve the current gravitational parameters of a list of gravity field models into a single vector.
+void getGravitationalParametersOfBodies(
+        const std::vector< boost::shared_ptr< gravitation::GravityFieldModel > >& gravityFieldModels,
+        Eigen::VectorXd& gravitationalParameters )
+{
+    for( unsigned int i = 0; i < gravityFieldModels.size( ); i++ )
+    {
+        gravitationalParameters( i ) = gravityFieldModels[ i ]->getGravitationalParameter( );
+    }
+}
+
+//! Function to create a combined point-mass third-body acceleration model of multiple perturbing bodies.
+boost::shared_ptr< gravitation::MultipleThirdBodyCentralGravityAcceleration >
+createMultipleThirdBodyCentralGravityAccelerationModel(
+        const boost::shared_ptr< Body > bodyUndergoingAcceleration,
+        const boost::shared_ptr< AccelerationSettings > accelerationSettings,
+        const std::string& nameOfBodyUndergoingAcceleration,
+        const boost::shared_ptr< Body > centralBody,
+        const std::string& nameOfCentralBody,
+        const NamedBodyMap& bodyMap )
+{
+    // Check input consistency
+    boost::shared_ptr< MultipleThirdBodyAccelerationSettings > multipleThirdBodySettings =
+            boost::dynamic_pointer_cast< MultipleThirdBodyAccelerationSettings >( accelerationSettings );
+    if( multipleThirdBodySettings == NULL )
+    {
+        throw std::runtime_error( "Error when creating multiple third-body acceleration, input is inconsistent" );
+    }
+
+    // Retrieve perturbing bodies and their gravity field models.
+    std::vector< std::string > perturbingBodyNames = multipleThirdBodySettings->perturbingBodies_;
+    std::vector< boost::shared_ptr< Body > > perturbingBodies;
+    std::vector< boost::shared_ptr< gravitation::GravityFieldModel > > gravityFieldModels;
+    for( unsigned int i = 0; i < perturbingBodyNames.size( ); i++ )
+    {
+        if( bodyMap.count( perturbingBodyNames.at( i ) ) == 0 )
+        {
+            throw std::runtime_error(
+                        "Error when creating multiple third-body acceleration on " + nameOfBodyUndergoingAcceleration +
+                        ", perturbing body " + perturbingBodyNames.at( i ) + " not found." );
+        }
+        else if( perturbingBodyNames.at( i ) == nameOfBodyUndergoingAcceleration ||
+                 perturbingBodyNames.at( i ) == nameOfCentralBody )
+        {
+            throw std::runtime_error(
+                        "Error when creating multiple third-body acceleration on " + nameOfBodyUndergoingAcceleration +
+                        ", perturbing body " + perturbingBodyNames.at( i ) +
+                        " may not be body undergoing acceleration or central body." );
+        }
+        else if( bodyMap.at( perturbingBodyNames.at( i ) )->getGravityFieldModel( ) == NULL )
+        {
+            throw std::runtime_error(
+                        "Error, gravity field model not set when making multiple third-body acceleration of " +
+                        perturbingBodyNames.at( i ) + " on " + nameOfBodyUndergoingAcceleration );
+        }
+
+        perturbingBodies.push_back( bodyMap.at( perturbingBodyNames.at( i ) ) );
+        gravityFieldModels.push_back( perturbingBodies.back( )->getGravityFieldModel( ) );
+    }
+
+    // Create acceleration object, without indirect terms if central body is inertial frame origin.
+    boost::shared_ptr< MultipleThirdBodyCentralGravityAcceleration > accelerationModelPointer;
+    if( centralBody == NULL )
+    {
+        accelerationModelPointer = boost::make_shared< MultipleThirdBodyCentralGravityAcceleration >(
+                    boost::bind( &Body::getPosition, bodyUndergoingAcceleration ),
+                    boost::bind( &getPositionsOfBodies, perturbingBodies, _1 ),
+                    boost::bind( &getGravitationalParametersOfBodies, gravityFieldModels, _1 ),
+                    perturbingBodyNames, nameOfCentralBody,
+                    boost::lambda::constant( Eigen::Vector3d::Zero( ) ), false );
+    }
+    else
+    {
+        accelerationModelPointer = boost::make_shared< MultipleThirdBodyCentralGravityAcceleration >(
+                    boost::bind( &Body::getPosition, bodyUndergoingAcceleration ),
+                    boost::bind( &getPositionsOfBodies, perturbingBodies, _1 ),
+                    boost::bind( &getGravitationalParametersOfBodies, gravityFieldModels, _1 ),
+                    perturbingBodyNames, nameOfCentralBody,
+                    boost::bind( &Body::getPosition, centralBody ), true );
+    }
+
+    return accelerationModelPointer;
+}
+
 
 //! Function to create acceleration model object.
 boost::shared_ptr< AccelerationModel< Eigen::Vector3d > > createAccelerationModel(
@@ -921,6 +1022,11 @@ boost::shared_ptr< AccelerationModel< Eigen::Vector3d > > createAccelerationMode
                     accelerationSettings, bodyMap,
                     nameOfBodyUndergoingAcceleration );
         break;
+    case multiple_third_body_central_gravity:
+        accelerationModelPointer = createMultipleThirdBodyCentralGravityAccelerationModel(
+                    bodyUndergoingAcceleration, accelerationSettings,
+                    nameOfBodyUndergoingAcceleration, centralBody, nameOfCentralBody, bodyMap );
+        break;
     default:
         throw std::runtime_error(
                     std::string( "Error, acceleration model ") +
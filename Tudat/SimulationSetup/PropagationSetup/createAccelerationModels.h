@@ -21,6 +21,7 @@
 #include "Tudat/SimulationSetup/PropagationSetup/accelerationSettings.h"
 #include "Tudat/Astrodynamics/ElectroMagnetism/cannonBallRadiationPressureAcceleration.h"
 #include "Tudat/Astrodynamics/Gravitation/thirdBodyPerturbation.h"
+#include "Tudat/Astrodynamics/Gravitation/multipleThirdBodyPerturbation.h"
 
 namespace tudat
 {
@@ -318,6 +319,48 @@ createThrustAcceleratioModel(
         const NamedBodyMap& bodyMap,
         const std::string& nameOfBodyUndergoingThrust );
 
+//! Function to retrieve the current positions of a list of bodies into a single matrix.
+/*!
+ *  Function to retrieve the current positions of a list of bodies into a single matrix.
+ *  \param bodies List of bodies of which the positions are to be retrieved.
+ *  \param positions Current positions of bodies, one per column (returned by reference).
+ */
+void getPositionsOfBodies( const std::vector< boost::shared_ptr< Body > >& bodies, Eigen::Matrix3Xd& positions );
+
+//! Function to retrieve the current gravitational parameters of a list of gravity field models into a single vector.
+/*!
+ *  Function to retrieve the current gravitational parameters of a list of gravity field models into a single vector.
+ *  \param gravityFieldModels List of gravity field models of which the gravitational parameters are to be retrieved.
+ *  \param gravitationalParameters Current gravitational parameters (returned by reference).
+ */
+void getGravitationalParametersOfBodies(
+        const std::vector< boost::shared_ptr< gravitation::GravityFieldModel > >& gravityFieldModels,
+        Eigen::VectorXd& gravitationalParameters );
+
+//! Function to create a combined point-mass third-body acceleration model of multiple perturbing bodies.
+/*!
+ *  Function to create a combined point-mass third-body acceleration model of multiple perturbing bodies, with the
+ *  perturbing bodies defined by the accelerationSettings (of type MultipleThirdBodyAccelerationSettings).
+ *  \param bodyUndergoingAcceleration Pointer to object of body that is being accelerated.
+ *  \param accelerationSettings Settings of the acceleration model.
+ *  \param nameOfBodyUndergoingAcceleration Name of object of body that is being accelerated.
+ *  \param centralBody Pointer to central body in frame centered at which acceleration is to be
+ *  calculated (NULL if inertial frame origin).
+ *  \param nameOfCentralBody Name of central body in frame cenetered at which acceleration is to
+ *  be calculated.
+ *  \param bodyMap List of pointers to bodies required for the creation of the acceleration model
+ *  objects.
+ *  \return Pointer to object for calculating combined third-body acceleration.
+ */
+boost::shared_ptr< gravitation::MultipleThirdBodyCentralGravityAcceleration >
+createMultipleThirdBodyCentralGravityAccelerationModel(
+        const boost::shared_ptr< Body > bodyUndergoingAcceleration,
+        const boost::shared_ptr< AccelerationSettings > accelerationSettings,
+        const std::string& nameOfBodyUndergoingAcceleration,
+        const boost::shared_ptr< Body > centralBody,
+        const std::string& nameOfCentralBody,
+        const NamedBodyMap& bodyMap );
+
 //! Function to create acceleration model object.
 /*!
  *  Function to create acceleration model object.
@@ -294,6 +294,38 @@ createTranslationalEquationsOfMotionEnvironmentUpdaterSettings(
 
                     break;
                 }
+                case multiple_third_body_central_gravity:
+                {
+                    boost::shared_ptr< gravitation::MultipleThirdBodyCentralGravityAcceleration >
+                            thirdBodyAcceleration = boost::dynamic_pointer_cast<
+                            gravitation::MultipleThirdBodyCentralGravityAcceleration >(
+                                accelerationModelIterator->second.at( i ) );
+                    if( thirdBodyAcceleration == NULL )
+                    {
+                        throw std::runtime_error(
+                                    std::string( "Error, incompatible input (MultipleThirdBodyCentralGravityAcceleration) to" )
+                                    + std::string(  "createTranslationalEquationsOfMotionEnvironmentUpdaterSettings" ) );
+                    }
+
+                    // Add translational state of all perturbing bodies, and central body, to update list.
+                    std::vector< std::string > perturbingBodies = thirdBodyAcceleration->getPerturbingBodyNames( );
+                    for( unsigned int j = 0; j < perturbingBodies.size( ); j++ )
+                    {
+                        if( translationalAccelerationModels.count( perturbingBodies.at( j ) ) == 0 )
+                        {
+                            singleAccelerationUpdateNeeds[ body_transational_state_update ].push_back(
+                                        perturbingBodies.at( j ) );
+                        }
+                    }
+
+                    if( thirdBodyAcceleration->getUseIndirectTerms( ) && translationalAccelerationModels.count(
+                                thirdBodyAcceleration->getCentralBodyName( ) ) == 0 )
+                    {
+                        singleAccelerationUpdateNeeds[ body_transational_state_update ].push_back(
+                                    thirdBodyAcceleration->getCentralBodyName( ) );
+                    }
+                    break;
+                }
                 default:
                     throw std::runtime_error( std::string( "Error when setting acceleration model update needs, model type not recognized: " ) +
                                               boost::lexical_cast< std::string >( currentAccelerationModelType ) );
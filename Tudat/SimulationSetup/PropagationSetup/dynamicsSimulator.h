@@ -68,6 +68,8 @@ Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > getInitialStatesOfBodies(
     boost::shared_ptr< ephemerides::Ephemeris > ephemerisOfCurrentBody;
 
     // Iterate over all bodies.
+    std::vector< std::string > correctionOrigins, correctionBodies;
+    std::vector< unsigned int > correctedBodyIndices;
     for( unsigned int i = 0; i < bodiesToIntegrate.size( ) ; i++ )
     {
         ephemerisOfCurrentBody = bodyMap.at( bodiesToIntegrate.at( i ) )->getEphemeris( );
@@ -76,13 +78,24 @@ Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > getInitialStatesOfBodies(
         systemInitialState.segment( i * 6 , 6 ) = ephemerisOfCurrentBody->getTemplatedStateFromEphemeris<
                 StateScalarType, TimeType >( initialTime );
 
-        // Correct initial state if integration origin and ephemeris origin are not equal.
+        // Set correction of initial state if integration origin and ephemeris origin are not equal.
         if( centralBodies.at( i ) != ephemerisOfCurrentBody->getReferenceFrameOrigin( ) )
         {
-            boost::shared_ptr< ephemerides::Ephemeris > correctionEphemeris =
-                    frameManager->getEphemeris( ephemerisOfCurrentBody->getReferenceFrameOrigin( ), centralBodies.at( i ) );
-            systemInitialState.segment( i * 6 , 6 ) -= correctionEphemeris->getTemplatedStateFromEphemeris<
-                    StateScalarType, TimeType >( initialTime );
+            correctionOrigins.push_back( ephemerisOfCurrentBody->getReferenceFrameOrigin( ) );
+            correctionBodies.push_back( centralBodies.at( i ) );
+            correctedBodyIndices.push_back( i );
+        }
+    }
+
+    // Correct initial states, computing the states of all required frame origins at once.
+    if( correctedBodyIndices.size( ) > 0 )
+    {
+        std::vector< Eigen::Matrix< StateScalarType, 6, 1 > > initialStateCorrections =
+                frameManager->getRelativeStates< StateScalarType, TimeType >(
+                    correctionOrigins, correctionBodies, initialTime );
+        for( unsigned int i = 0; i < correctedBodyIndices.size( ); i++ )
+        {
+            systemInitialState.segment( correctedBodyIndices.at( i ) * 6 , 6 ) -= initialStateCorrections.at( i );
         }
     }
     return systemInitialState;
@@ -14,6 +14,7 @@
 #include <boost/function.hpp>
 
 #include "Tudat/Astrodynamics/Aerodynamics/aerodynamics.h"
+#include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsGravityModel.h"
 #include "Tudat/Astrodynamics/Propagators/dynamicsStateDerivativeModel.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/body.h"
 #include "Tudat/SimulationSetup/PropagationSetup/propagationOutputSettings.h"
@@ -298,6 +299,34 @@ boost::function< double( ) > getDoubleDependentVariableFunction(
                                         bodyAerodynamicAngleVariableSaveSettings->angle_ );
         break;
     }
+    case spherical_harmonic_truncation_degree_dependent_variable:
+    {
+        // Retrieve spherical harmonic acceleration exerted by secondary body on body with property.
+        std::vector< boost::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > >
+                listOfSuitableAccelerationModels = getAccelerationBetweenBodies(
+                    bodyWithProperty, secondaryBody, stateDerivativeModels,
+                    basic_astrodynamics::spherical_harmonic_gravity );
+        if( listOfSuitableAccelerationModels.size( ) != 1 )
+        {
+            std::string errorMessage = "Error when getting spherical harmonic acceleration between bodies " +
+                    bodyWithProperty + " and " + secondaryBody + ", no such acceleration found";
+            throw std::runtime_error( errorMessage );
+        }
+
+        boost::shared_ptr< gravitation::SphericalHarmonicsGravitationalAccelerationModel > sphericalHarmonicAcceleration =
+                boost::dynamic_pointer_cast< gravitation::SphericalHarmonicsGravitationalAccelerationModel >(
+                    listOfSuitableAccelerationModels.at( 0 ) );
+        if( sphericalHarmonicAcceleration == NULL )
+        {
+            std::string errorMessage = "Error when getting spherical harmonic truncation degree between bodies " +
+                    bodyWithProperty + " and " + secondaryBody + ", acceleration model type is incompatible";
+            throw std::runtime_error( errorMessage );
+        }
+        variableFunction = boost::bind(
+                    &gravitation::SphericalHarmonicsGravitationalAccelerationModel::getCurrentMaximumDegree,
+                    sphericalHarmonicAcceleration );
+        break;
+    }
     default:
         std::string errorMessage =
                 "Error, did not recognize double dependent variable type when making variable function: " +
@@ -28,6 +28,7 @@
 #include "Tudat/Astrodynamics/BasicAstrodynamics/massRateModel.h"
 #include "Tudat/Astrodynamics/Propagators/singleStateTypeDerivative.h"
 #include "Tudat/Astrodynamics/Propagators/nBodyStateDerivative.h"
+#include "Tudat/Mathematics/Interpolators/createInterpolator.h"
 #include "Tudat/SimulationSetup/PropagationSetup/propagationOutputSettings.h"
 #include "Tudat/SimulationSetup/PropagationSetup/propagationTerminationSettings.h"
 
@@ -256,6 +257,15 @@ public:
     //! Type of translational state propagator to be used
     TranslationalPropagatorType propagator_;
 
+    //! Settings for the interpolator of the ephemerides that are reset from the propagated states.
+    /*!
+     *  Settings for the interpolator of the ephemerides that are reset from the propagated states. By default (NULL),
+     *  a Lagrange interpolator (order 6) is used. An HermiteInterpolatorSettings object may be provided to use the
+     *  propagated velocities as derivatives of the positions, which allows the states to be saved much more sparsely
+     *  at the same interpolation accuracy.
+     */
+    boost::shared_ptr< interpolators::InterpolatorSettings > ephemerisInterpolatorSettings_;
+
 };
 
 
@@ -12,8 +12,10 @@
 #define TUDAT_SETNUMERICALLYINTEGRATEDSTATES_H
 
 #include "Tudat/SimulationSetup/EnvironmentSetup/body.h"
+#include "Tudat/Astrodynamics/Ephemerides/columnarStateHistory.h"
 #include "Tudat/Astrodynamics/Ephemerides/frameManager.h"
 #include "Tudat/Astrodynamics/Ephemerides/tabulatedEphemeris.h"
+#include "Tudat/Mathematics/Interpolators/createInterpolator.h"
 #include "Tudat/SimulationSetup/PropagationSetup/propagationSettings.h"
 
 
@@ -129,10 +131,53 @@ boost::shared_ptr< interpolators::OneDimensionalInterpolator< TimeType, Eigen::M
 createStateInterpolator(
         const std::map< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > >& stateMap );
 
+//! Function to create an interpolator for the new translational state of a body, from interpolator settings.
+/*!
+ * Function to create an interpolator for the new translational state of a body, from interpolator settings. For
+ * HermiteInterpolatorSettings, an HermiteStateInterpolator is created, which uses the velocities in the state history
+ * as the derivatives of the positions.
+ * \param stateMap New state history, w.r.t. the required ephemeris origin.
+ * \param interpolatorSettings Settings for the interpolator that is to be created (Lagrange interpolator of order 6
+ * if NULL).
+ * \return Interpolator that produces the required continuous state.
+ */
+template< typename TimeType, typename StateScalarType >
+boost::shared_ptr< interpolators::OneDimensionalInterpolator< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > > >
+createStateInterpolator(
+        const std::map< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > >& stateMap,
+        const boost::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings )
+{
+    using namespace tudat::interpolators;
+
+    if( interpolatorSettings == NULL )
+    {
+        return createStateInterpolator( stateMap );
+    }
+    else if( interpolatorSettings->getInterpolatorType( ) == hermite_interpolator )
+    {
+        boost::shared_ptr< HermiteInterpolatorSettings > hermiteInterpolatorSettings =
+                boost::dynamic_pointer_cast< HermiteInterpolatorSettings >( interpolatorSettings );
+        if( hermiteInterpolatorSettings == NULL )
+        {
+            throw std::runtime_error( "Error, did not recognize hermite interpolator settings for state interpolation" );
+        }
+        return boost::make_shared< HermiteStateInterpolator< TimeType, StateScalarType > >(
+                    stateMap, hermiteInterpolatorSettings->getNumberOfNodes( ),
+                    std::vector< Eigen::Matrix< StateScalarType, 3, 1 > >( ),
+                    interpolatorSettings->getSelectedLookupScheme( ) );
+    }
+    else
+    {
+        return createOneDimensionalInterpolator( stateMap, interpolatorSettings );
+    }
+}
+
 //! Create and reset ephemerides interpolator
 /*!
  * Creates and resets the interpolator for the ephemerides of the integrated bodies from the
- * numerical integration results.
+ * numerical integration results. The translational states of all bodies are copied once into a single
+ * ColumnarStateHistory (with a single time axis and set of Lagrange denominators), from which the
+ * state of each body is interpolated by a ColumnarStateHistorySliceInterpolator.
  * \param bodyMap List of bodies used in simulations.
  * \param bodiesToIntegrate List of names of bodies which are numericall integrated (in the order in
  * which they are in the equationsOfMotionNumericalSolution map.
@@ -142,6 +187,8 @@ createStateInterpolator(
  * motion, in Cartesian elements w.r.t. integratation origins.
  * \param integrationToEphemerisFrameFunctions Function to provide the states of the ephemeris
  * origins of each body w.r.t. their respective integration origins.
+ * \param ephemerisInterpolatorSettings Settings for the interpolators of the ephemerides. If NULL (default), the
+ * states are interpolated from a ColumnarStateHistory, as described above.
  */
 template< typename TimeType, typename StateScalarType >
 void createAndSetInterpolatorsForEphemerides(
@@ -152,10 +199,21 @@ void createAndSetInterpolatorsForEphemerides(
         const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& equationsOfMotionNumericalSolution,
         const std::map< std::string, boost::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > >&
         integrationToEphemerisFrameFunctions =
-        std::map< std::string, boost::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > >( ) )
+        std::map< std::string, boost::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > >( ),
+        const boost::shared_ptr< interpolators::InterpolatorSettings > ephemerisInterpolatorSettings =
+        boost::shared_ptr< interpolators::InterpolatorSettings >( ) )
 {
     using namespace tudat::interpolators;
 
+    // Store states of all bodies in single columnar history, if sufficient data points are available and no
+    // specific interpolator is requested.
+    boost::shared_ptr< ephemerides::ColumnarStateHistory< StateScalarType, TimeType > > stateHistory;
+    if( equationsOfMotionNumericalSolution.size( ) >= 6 && ephemerisInterpolatorSettings == NULL )
+    {
+        stateHistory = boost::make_shared< ephemerides::ColumnarStateHistory< StateScalarType, TimeType > >(
+                    equationsOfMotionNumericalSolution, startIndex, 6 * bodiesToIntegrate.size( ), 6 );
+    }
+
     // Iterate over all bodies that are integrated numerically and create state interpolator.
     for( unsigned int i = 0; i < ephemerisUpdateOrder.size( ); i++ )
     {
@@ -180,10 +238,32 @@ void createAndSetInterpolatorsForEphemerides(
 
         // Create and reset interpolator.
         boost::shared_ptr< OneDimensionalInterpolator< TimeType, Eigen::Matrix< StateScalarType, 6, 1 > > >
-                ephemerisInterpolator =
-                createStateInterpolator(
-                    convertNumericalSolutionToEphemerisInput(
-                        bodyIndex, startIndex, equationsOfMotionNumericalSolution, integrationToEphemerisFrameFunction ) );
+                ephemerisInterpolator;
+        if( stateHistory != NULL )
+        {
+            // Change origin of states of current body in place (after previous bodies in update order are reset).
+            if( integrationToEphemerisFrameFunction != 0 )
+            {
+                const std::vector< TimeType >& times = stateHistory->getTimes( );
+                for( unsigned int j = 0; j < times.size( ); j++ )
+                {
+                    stateHistory->getStates( ).block( 6 * bodyIndex, j, 6, 1 ) -=
+                            integrationToEphemerisFrameFunction( times.at( j ) );
+                }
+            }
+
+            ephemerisInterpolator = boost::make_shared<
+                    ephemerides::ColumnarStateHistorySliceInterpolator< StateScalarType, TimeType > >(
+                        stateHistory, 6 * bodyIndex );
+        }
+        else
+        {
+            ephemerisInterpolator =
+                    createStateInterpolator(
+                        convertNumericalSolutionToEphemerisInput(
+                            bodyIndex, startIndex, equationsOfMotionNumericalSolution,
+                            integrationToEphemerisFrameFunction ), ephemerisInterpolatorSettings );
+        }
 
         resetIntegratedEphemerisOfBody(
                     bodyMap, ephemerisInterpolator, bodiesToIntegrate.at( bodyIndex ) );
@@ -204,6 +284,8 @@ void createAndSetInterpolatorsForEphemerides(
  * motion, in Cartesian elements w.r.t. integratation origins.
  * \param integrationToEphemerisFrameFunctions Function to provide the states of the ephemeris
  * origins of each body w.r.t. their respective integration origins.
+ * \param ephemerisInterpolatorSettings Settings for the interpolators of the ephemerides (default interpolation if
+ * NULL, see createAndSetInterpolatorsForEphemerides).
  */
 template< typename TimeType, typename StateScalarType >
 void resetIntegratedEphemerides(
@@ -214,7 +296,9 @@ void resetIntegratedEphemerides(
         std::vector< std::string > ephemerisUpdateOrder = std::vector< std::string >( ),
         const std::map< std::string, boost::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > >&
         integrationToEphemerisFrameFunctions =
-        std::map< std::string, boost::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > >( ) )
+        std::map< std::string, boost::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > >( ),
+        const boost::shared_ptr< interpolators::InterpolatorSettings > ephemerisInterpolatorSettings =
+        boost::shared_ptr< interpolators::InterpolatorSettings >( ) )
 {
     // Set update order arbitrarily if no order is provided.
     if( ephemerisUpdateOrder.size( ) == 0 )
@@ -242,7 +326,8 @@ void resetIntegratedEphemerides(
     // Create interpolators from numerical integration results (states) at discrete times.
     createAndSetInterpolatorsForEphemerides(
                 bodyMap, bodiesToIntegrate, startIndexAndSize.first, ephemerisUpdateOrder,
-                equationsOfMotionNumericalSolution, integrationToEphemerisFrameFunctions );
+                equationsOfMotionNumericalSolution, integrationToEphemerisFrameFunctions,
+                ephemerisInterpolatorSettings );
 }
 
 //! Resets the mass models of the integrated bodies from the numerical integration results.
@@ -356,16 +441,21 @@ public:
      * \param centralBodies List of origing w.r.t. which the translational states are integrated
      * (with the same order as bodiesToIntegrate).
      * \param frameManager Object to get state of one body w.r.t. another body.
+     * \param ephemerisInterpolatorSettings Settings for the interpolators of the ephemerides (default interpolation if
+     * NULL, see createAndSetInterpolatorsForEphemerides).
      */
     TranslationalStateIntegratedStateProcessor(
             const int startIndex,
             const simulation_setup::NamedBodyMap& bodyMap,
             const std::vector< std::string >& bodiesToIntegrate,
             const std::vector< std::string >& centralBodies,
-            const boost::shared_ptr< ephemerides::ReferenceFrameManager > frameManager ):
+            const boost::shared_ptr< ephemerides::ReferenceFrameManager > frameManager,
+            const boost::shared_ptr< interpolators::InterpolatorSettings > ephemerisInterpolatorSettings =
+            boost::shared_ptr< interpolators::InterpolatorSettings >( ) ):
         IntegratedStateProcessor< TimeType, StateScalarType >(
             transational_state, std::make_pair( startIndex, 6 * bodiesToIntegrate.size( ) ) ),
-        bodyMap_( bodyMap ), bodiesToIntegrate_( bodiesToIntegrate )
+        bodyMap_( bodyMap ), bodiesToIntegrate_( bodiesToIntegrate ),
+        ephemerisInterpolatorSettings_( ephemerisInterpolatorSettings )
     {
         // Get update orders.
         ephemerisUpdateOrder_ = determineEphemerisUpdateorder(
@@ -395,7 +485,7 @@ public:
     {
         resetIntegratedEphemerides< TimeType, StateScalarType >(
                     bodyMap_, numericalSolution, bodiesToIntegrate_, this->startIndexAndSize_, ephemerisUpdateOrder_,
-                    integrationToEphemerisFrameFunctions_ );
+                    integrationToEphemerisFrameFunctions_, ephemerisInterpolatorSettings_ );
     }
 
 private:
@@ -417,6 +507,9 @@ private:
     //! integration origins.
     std::map< std::string, boost::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > >
     integrationToEphemerisFrameFunctions_;
+
+    //! Settings for the interpolators of the ephemerides (default interpolation if NULL).
+    boost::shared_ptr< interpolators::InterpolatorSettings > ephemerisInterpolatorSettings_;
 };
 
 //! Class used for processing numerically integrated masses of bodies.
@@ -638,7 +731,8 @@ createIntegratedStateProcessors(
         integratedStateProcessors[ transational_state ].push_back(
                     boost::make_shared< TranslationalStateIntegratedStateProcessor< TimeType, StateScalarType > >(
                         startIndex, bodyMap, translationalPropagatorSettings->bodiesToIntegrate_,
-                        translationalPropagatorSettings->centralBodies_, frameManager ) );
+                        translationalPropagatorSettings->centralBodies_, frameManager,
+                        translationalPropagatorSettings->ephemerisInterpolatorSettings_ ) );
         break;
     }
     case body_mass_state:
@@ -11,7 +11,13 @@
 #ifndef TUDAT_THRUSTSETTINGS_H
 #define TUDAT_THRUSTSETTINGS_H
 
+#include <boost/bind.hpp>
 #include <boost/function.hpp>
+#include <boost/make_shared.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/Interpolators/adaptiveTabulation.h"
 
 namespace tudat
 {
@@ -304,6 +310,83 @@ public:
     boost::function< void( const double ) > customThrustResetFunction_;
 };
 
+//! Function to retrieve thrust magnitude and specific impulse from functions, for tabulation.
+/*!
+ * Function to retrieve thrust magnitude and specific impulse from functions, for tabulation.
+ * \param thrustMagnitudeFunction Function returning thrust magnitude as a function of time.
+ * \param specificImpulseFunction Function returning specific impulse as a function of time.
+ * \param time Time at which thrust magnitude and specific impulse are to be retrieved.
+ * \return Vector with thrust magnitude (entry 0) and specific impulse (entry 1).
+ */
+inline Eigen::Vector2d getThrustMagnitudeAndSpecificImpulseForTabulation(
+        const boost::function< double( const double ) > thrustMagnitudeFunction,
+        const boost::function< double( const double ) > specificImpulseFunction,
+        const double time )
+{
+    return Eigen::Vector2d( thrustMagnitudeFunction( time ), specificImpulseFunction( time ) );
+}
+
+//! Function to retrieve single entry of interpolated thrust magnitude and specific impulse.
+/*!
+ * Function to retrieve single entry of interpolated thrust magnitude and specific impulse.
+ * \param thrustInterpolator Interpolator for thrust magnitude (entry 0) and specific impulse (entry 1).
+ * \param entry Index of entry that is to be retrieved.
+ * \param time Time at which entry is to be retrieved.
+ * \return Interpolated thrust magnitude (entry 0) or specific impulse (entry 1).
+ */
+inline double getTabulatedThrustMagnitudeOrSpecificImpulse(
+        const boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::Vector2d > >
+        thrustInterpolator,
+        const int entry,
+        const double time )
+{
+    return thrustInterpolator->interpolate( time )( entry );
+}
+
+//! Function to create thrust settings from adaptively tabulated thrust magnitude and specific impulse.
+/*!
+ * Function to create thrust settings from adaptively tabulated thrust magnitude and specific impulse. The thrust
+ * magnitude and specific impulse functions of the input settings are tabulated at nodes that are selected such that
+ * the interpolation error meets the given tolerances (see interpolators::tabulateFunctionAdaptively), so that
+ * expensive (e.g. engine model) functions need not be evaluated during propagation. The remaining settings are
+ * copied from the input settings.
+ * \param sourceThrustSettings Thrust settings of which the thrust magnitude and specific impulse are to be tabulated.
+ * \param startTime Start time of the tabulation.
+ * \param endTime End time of the tabulation.
+ * \param initialTimeStep Time step of the initial (uniform) grid, which is refined where needed.
+ * \param interpolatorSettings Settings of interpolator that is to be used (Hermite interpolators not supported).
+ * \param tabulationSettings Settings for the adaptive tabulation (error tolerances and limits).
+ * \return Thrust settings using interpolated thrust magnitude and specific impulse.
+ */
+inline boost::shared_ptr< FromFunctionThrustEngineSettings > createAdaptivelyTabulatedThrustEngineSettings(
+        const boost::shared_ptr< FromFunctionThrustEngineSettings > sourceThrustSettings,
+        const double startTime,
+        const double endTime,
+        const double initialTimeStep,
+        const boost::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings =
+        boost::make_shared< interpolators::InterpolatorSettings >( interpolators::linear_interpolator ),
+        const boost::shared_ptr< interpolators::AdaptiveTabulationSettings > tabulationSettings =
+        boost::make_shared< interpolators::AdaptiveTabulationSettings >( ) )
+{
+    // Tabulate thrust magnitude and specific impulse on adaptively selected grid.
+    const std::map< double, Eigen::Vector2d > tabulatedThrust =
+            interpolators::tabulateFunctionAdaptively< double, Eigen::Vector2d >(
+                boost::bind( &getThrustMagnitudeAndSpecificImpulseForTabulation,
+                             sourceThrustSettings->thrustMagnitudeFunction_,
+                             sourceThrustSettings->specificImpulseFunction_, _1 ),
+                startTime, endTime, initialTimeStep, interpolatorSettings, tabulationSettings );
+
+    boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::Vector2d > > thrustInterpolator =
+            interpolators::createOneDimensionalInterpolator( tabulatedThrust, interpolatorSettings );
+
+    return boost::make_shared< FromFunctionThrustEngineSettings >(
+                boost::bind( &getTabulatedThrustMagnitudeOrSpecificImpulse, thrustInterpolator, 0, _1 ),
+                boost::bind( &getTabulatedThrustMagnitudeOrSpecificImpulse, thrustInterpolator, 1, _1 ),
+                sourceThrustSettings->isEngineOnFunction_,
+                sourceThrustSettings->bodyFixedThrustDirection_,
+                sourceThrustSettings->customThrustResetFunction_ );
+}
+
 } // namespace simulation_setup
 
 } // namespace tudat
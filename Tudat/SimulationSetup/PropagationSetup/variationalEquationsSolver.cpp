@@ -8,6 +8,7 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include "Tudat/Mathematics/Interpolators/matrixLagrangeInterpolator.h"
 #include "Tudat/SimulationSetup/PropagationSetup/variationalEquationsSolver.h"
 
 namespace tudat
@@ -23,9 +24,10 @@ void createStateTransitionAndSensitivityMatrixInterpolator(
         std::vector< std::map< double, Eigen::MatrixXd > >& variationalEquationsSolution,
         const bool clearRawSolution )
 {
-    // Create interpolator for state transition matrix.
+    // Create interpolator for state transition matrix (storing the matrices contiguously, so that no memory is
+    // allocated while accumulating the interpolated matrix).
     stateTransitionMatrixInterpolator=
-            boost::make_shared< interpolators::LagrangeInterpolator< double, Eigen::MatrixXd > >(
+            boost::make_shared< interpolators::MatrixLagrangeInterpolator< double, Eigen::MatrixXd > >(
                 utilities::createVectorFromMapKeys< Eigen::MatrixXd, double >( variationalEquationsSolution[ 0 ] ),
                 utilities::createVectorFromMapValues< Eigen::MatrixXd, double >( variationalEquationsSolution[ 0 ] ), 4 );
     if( clearRawSolution )
@@ -35,7 +37,7 @@ void createStateTransitionAndSensitivityMatrixInterpolator(
 
     // Create interpolator for sensitivity matrix.
     sensitivityMatrixInterpolator =
-            boost::make_shared< interpolators::LagrangeInterpolator< double, Eigen::MatrixXd > >(
+            boost::make_shared< interpolators::MatrixLagrangeInterpolator< double, Eigen::MatrixXd > >(
                 utilities::createVectorFromMapKeys< Eigen::MatrixXd, double >( variationalEquationsSolution[ 1 ] ),
                 utilities::createVectorFromMapValues< Eigen::MatrixXd, double >( variationalEquationsSolution[ 1 ] ), 4 );
     if( clearRawSolution )